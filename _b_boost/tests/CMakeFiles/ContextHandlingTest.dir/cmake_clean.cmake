@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ContextHandlingTest.dir/integration/ContextHandlingTest.cpp.o"
+  "CMakeFiles/ContextHandlingTest.dir/integration/ContextHandlingTest.cpp.o.d"
+  "ContextHandlingTest"
+  "ContextHandlingTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ContextHandlingTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
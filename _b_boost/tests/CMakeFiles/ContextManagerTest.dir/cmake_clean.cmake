@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ContextManagerTest.dir/unit/ContextManagerTest.cpp.o"
+  "CMakeFiles/ContextManagerTest.dir/unit/ContextManagerTest.cpp.o.d"
+  "ContextManagerTest"
+  "ContextManagerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ContextManagerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
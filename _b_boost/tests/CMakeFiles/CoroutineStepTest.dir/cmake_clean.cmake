@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CoroutineStepTest.dir/integration/CoroutineStepTest.cpp.o"
+  "CMakeFiles/CoroutineStepTest.dir/integration/CoroutineStepTest.cpp.o.d"
+  "CoroutineStepTest"
+  "CoroutineStepTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CoroutineStepTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CucumberExpressionErrorsTest.dir/unit/CucumberExpressionErrorsTest.cpp.o"
+  "CMakeFiles/CucumberExpressionErrorsTest.dir/unit/CucumberExpressionErrorsTest.cpp.o.d"
+  "CucumberExpressionErrorsTest"
+  "CucumberExpressionErrorsTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CucumberExpressionErrorsTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CucumberExpressionTest.dir/unit/CucumberExpressionTest.cpp.o"
+  "CMakeFiles/CucumberExpressionTest.dir/unit/CucumberExpressionTest.cpp.o.d"
+  "CucumberExpressionTest"
+  "CucumberExpressionTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CucumberExpressionTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DurationHistoryTest.dir/unit/DurationHistoryTest.cpp.o"
+  "CMakeFiles/DurationHistoryTest.dir/unit/DurationHistoryTest.cpp.o.d"
+  "DurationHistoryTest"
+  "DurationHistoryTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DurationHistoryTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GTestDriverTest.dir/integration/drivers/GTestDriverTest.cpp.o"
+  "CMakeFiles/GTestDriverTest.dir/integration/drivers/GTestDriverTest.cpp.o.d"
+  "GTestDriverTest"
+  "GTestDriverTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GTestDriverTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HardwareCountersTest.dir/unit/HardwareCountersTest.cpp.o"
+  "CMakeFiles/HardwareCountersTest.dir/unit/HardwareCountersTest.cpp.o.d"
+  "HardwareCountersTest"
+  "HardwareCountersTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HardwareCountersTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RegexTest.dir/unit/RegexTest.cpp.o"
+  "CMakeFiles/RegexTest.dir/unit/RegexTest.cpp.o.d"
+  "RegexTest"
+  "RegexTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RegexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
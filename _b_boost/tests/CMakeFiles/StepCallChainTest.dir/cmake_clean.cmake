@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepCallChainTest.dir/unit/StepCallChainTest.cpp.o"
+  "CMakeFiles/StepCallChainTest.dir/unit/StepCallChainTest.cpp.o.d"
+  "StepCallChainTest"
+  "StepCallChainTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepCallChainTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
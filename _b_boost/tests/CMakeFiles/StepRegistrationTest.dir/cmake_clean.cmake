@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepRegistrationTest.dir/integration/StepRegistrationTest.cpp.o"
+  "CMakeFiles/StepRegistrationTest.dir/integration/StepRegistrationTest.cpp.o.d"
+  "StepRegistrationTest"
+  "StepRegistrationTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepRegistrationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
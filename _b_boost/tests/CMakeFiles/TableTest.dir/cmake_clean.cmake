@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TableTest.dir/unit/TableTest.cpp.o"
+  "CMakeFiles/TableTest.dir/unit/TableTest.cpp.o.d"
+  "TableTest"
+  "TableTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TableTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
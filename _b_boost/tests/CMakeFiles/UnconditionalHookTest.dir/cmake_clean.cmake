@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UnconditionalHookTest.dir/unit/UnconditionalHookTest.cpp.o"
+  "CMakeFiles/UnconditionalHookTest.dir/unit/UnconditionalHookTest.cpp.o.d"
+  "UnconditionalHookTest"
+  "UnconditionalHookTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnconditionalHookTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
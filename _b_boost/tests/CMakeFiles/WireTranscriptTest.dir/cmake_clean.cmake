@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WireTranscriptTest.dir/integration/WireTranscriptTest.cpp.o"
+  "CMakeFiles/WireTranscriptTest.dir/integration/WireTranscriptTest.cpp.o.d"
+  "WireTranscriptTest"
+  "WireTranscriptTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WireTranscriptTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "CucumberCpp::cucumber-cpp" for configuration ""
+set_property(TARGET CucumberCpp::cucumber-cpp APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(CucumberCpp::cucumber-cpp PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libcucumber-cpp.a"
+  )
+
+list(APPEND _cmake_import_check_targets CucumberCpp::cucumber-cpp )
+list(APPEND _cmake_import_check_files_for_CucumberCpp::cucumber-cpp "${_IMPORT_PREFIX}/lib/libcucumber-cpp.a" )
+
+# Import target "CucumberCpp::cucumber-cpp-runner" for configuration ""
+set_property(TARGET CucumberCpp::cucumber-cpp-runner APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(CucumberCpp::cucumber-cpp-runner PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libcucumber-cpp-runner.a"
+  )
+
+list(APPEND _cmake_import_check_targets CucumberCpp::cucumber-cpp-runner )
+list(APPEND _cmake_import_check_files_for_CucumberCpp::cucumber-cpp-runner "${_IMPORT_PREFIX}/lib/libcucumber-cpp-runner.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
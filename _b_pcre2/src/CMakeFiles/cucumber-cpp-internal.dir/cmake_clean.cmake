@@ -0,0 +1,93 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cucumber-cpp-internal.dir/AllocationTracking.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/AllocationTracking.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/ContextManager.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/ContextManager.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/CpuAffinity.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/CpuAffinity.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/CucumberExpression.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/CucumberExpression.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/CukeCommands.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/CukeCommands.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/CukeEngine.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/CukeEngine.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/CukeEngineImpl.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/CukeEngineImpl.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/DurationHistory.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/DurationHistory.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/HardwareCounters.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/HardwareCounters.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/HookRegistrar.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/HookRegistrar.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/ImpactRecord.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/ImpactRecord.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/JsonString.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/JsonString.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/Regex.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/Regex.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/Scenario.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/Scenario.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/ScenarioRunner.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/ScenarioRunner.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StartupProfile.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StartupProfile.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepBenchmark.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepBenchmark.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepExecutor.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepExecutor.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepIndex.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepIndex.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepLibrary.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepLibrary.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepManager.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepManager.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepSnapshot.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepSnapshot.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepTimeouts.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StepTimeouts.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/StringPool.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/StringPool.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/Table.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/Table.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/Tag.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/Tag.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/Telemetry.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/Telemetry.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/ThreadPool.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/ThreadPool.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/Timings.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/Timings.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/TraceRecorder.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/TraceRecorder.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/Watchdog.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/Watchdog.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/SharedMemoryServer.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/SharedMemoryServer.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireCoordinator.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireCoordinator.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireProtocol.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireProtocol.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireProtocolCommands.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireProtocolCommands.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireSession.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireSession.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireTranscript.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/connectors/wire/WireTranscript.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/drivers/GTestDriver.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/drivers/GTestDriver.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/drivers/GenericDriver.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/drivers/GenericDriver.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/gherkin/FeatureParser.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/gherkin/FeatureParser.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/gherkin/FeatureSource.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/gherkin/FeatureSource.cpp.o.d"
+  "CMakeFiles/cucumber-cpp-internal.dir/regex/Pcre2Regex.cpp.o"
+  "CMakeFiles/cucumber-cpp-internal.dir/regex/Pcre2Regex.cpp.o.d"
+  "libcucumber-cpp-internal.a"
+  "libcucumber-cpp-internal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cucumber-cpp-internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
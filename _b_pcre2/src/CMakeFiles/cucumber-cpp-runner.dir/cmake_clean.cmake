@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cucumber-cpp-runner.dir/runner.cpp.o"
+  "CMakeFiles/cucumber-cpp-runner.dir/runner.cpp.o.d"
+  "libcucumber-cpp-runner.a"
+  "libcucumber-cpp-runner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cucumber-cpp-runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
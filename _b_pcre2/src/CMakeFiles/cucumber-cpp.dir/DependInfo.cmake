@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/AllocationTracking.cpp" "src/CMakeFiles/cucumber-cpp.dir/AllocationTracking.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/AllocationTracking.cpp.o.d"
+  "/root/repo/src/ContextManager.cpp" "src/CMakeFiles/cucumber-cpp.dir/ContextManager.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/ContextManager.cpp.o.d"
+  "/root/repo/src/CpuAffinity.cpp" "src/CMakeFiles/cucumber-cpp.dir/CpuAffinity.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/CpuAffinity.cpp.o.d"
+  "/root/repo/src/CucumberExpression.cpp" "src/CMakeFiles/cucumber-cpp.dir/CucumberExpression.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/CucumberExpression.cpp.o.d"
+  "/root/repo/src/CukeCommands.cpp" "src/CMakeFiles/cucumber-cpp.dir/CukeCommands.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/CukeCommands.cpp.o.d"
+  "/root/repo/src/CukeEngine.cpp" "src/CMakeFiles/cucumber-cpp.dir/CukeEngine.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/CukeEngine.cpp.o.d"
+  "/root/repo/src/CukeEngineImpl.cpp" "src/CMakeFiles/cucumber-cpp.dir/CukeEngineImpl.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/CukeEngineImpl.cpp.o.d"
+  "/root/repo/src/DurationHistory.cpp" "src/CMakeFiles/cucumber-cpp.dir/DurationHistory.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/DurationHistory.cpp.o.d"
+  "/root/repo/src/HardwareCounters.cpp" "src/CMakeFiles/cucumber-cpp.dir/HardwareCounters.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/HardwareCounters.cpp.o.d"
+  "/root/repo/src/HookRegistrar.cpp" "src/CMakeFiles/cucumber-cpp.dir/HookRegistrar.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/HookRegistrar.cpp.o.d"
+  "/root/repo/src/ImpactRecord.cpp" "src/CMakeFiles/cucumber-cpp.dir/ImpactRecord.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/ImpactRecord.cpp.o.d"
+  "/root/repo/src/JsonString.cpp" "src/CMakeFiles/cucumber-cpp.dir/JsonString.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/JsonString.cpp.o.d"
+  "/root/repo/src/Regex.cpp" "src/CMakeFiles/cucumber-cpp.dir/Regex.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/Regex.cpp.o.d"
+  "/root/repo/src/Scenario.cpp" "src/CMakeFiles/cucumber-cpp.dir/Scenario.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/Scenario.cpp.o.d"
+  "/root/repo/src/ScenarioRunner.cpp" "src/CMakeFiles/cucumber-cpp.dir/ScenarioRunner.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/ScenarioRunner.cpp.o.d"
+  "/root/repo/src/StartupProfile.cpp" "src/CMakeFiles/cucumber-cpp.dir/StartupProfile.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StartupProfile.cpp.o.d"
+  "/root/repo/src/StepBenchmark.cpp" "src/CMakeFiles/cucumber-cpp.dir/StepBenchmark.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StepBenchmark.cpp.o.d"
+  "/root/repo/src/StepExecutor.cpp" "src/CMakeFiles/cucumber-cpp.dir/StepExecutor.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StepExecutor.cpp.o.d"
+  "/root/repo/src/StepIndex.cpp" "src/CMakeFiles/cucumber-cpp.dir/StepIndex.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StepIndex.cpp.o.d"
+  "/root/repo/src/StepLibrary.cpp" "src/CMakeFiles/cucumber-cpp.dir/StepLibrary.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StepLibrary.cpp.o.d"
+  "/root/repo/src/StepManager.cpp" "src/CMakeFiles/cucumber-cpp.dir/StepManager.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StepManager.cpp.o.d"
+  "/root/repo/src/StepSnapshot.cpp" "src/CMakeFiles/cucumber-cpp.dir/StepSnapshot.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StepSnapshot.cpp.o.d"
+  "/root/repo/src/StepTimeouts.cpp" "src/CMakeFiles/cucumber-cpp.dir/StepTimeouts.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StepTimeouts.cpp.o.d"
+  "/root/repo/src/StringPool.cpp" "src/CMakeFiles/cucumber-cpp.dir/StringPool.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/StringPool.cpp.o.d"
+  "/root/repo/src/Table.cpp" "src/CMakeFiles/cucumber-cpp.dir/Table.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/Table.cpp.o.d"
+  "/root/repo/src/Tag.cpp" "src/CMakeFiles/cucumber-cpp.dir/Tag.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/Tag.cpp.o.d"
+  "/root/repo/src/Telemetry.cpp" "src/CMakeFiles/cucumber-cpp.dir/Telemetry.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/Telemetry.cpp.o.d"
+  "/root/repo/src/ThreadPool.cpp" "src/CMakeFiles/cucumber-cpp.dir/ThreadPool.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/ThreadPool.cpp.o.d"
+  "/root/repo/src/Timings.cpp" "src/CMakeFiles/cucumber-cpp.dir/Timings.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/Timings.cpp.o.d"
+  "/root/repo/src/TraceRecorder.cpp" "src/CMakeFiles/cucumber-cpp.dir/TraceRecorder.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/TraceRecorder.cpp.o.d"
+  "/root/repo/src/Watchdog.cpp" "src/CMakeFiles/cucumber-cpp.dir/Watchdog.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/Watchdog.cpp.o.d"
+  "/root/repo/src/connectors/wire/SharedMemoryServer.cpp" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/SharedMemoryServer.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/SharedMemoryServer.cpp.o.d"
+  "/root/repo/src/connectors/wire/WireCoordinator.cpp" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireCoordinator.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireCoordinator.cpp.o.d"
+  "/root/repo/src/connectors/wire/WireProtocol.cpp" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocol.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocol.cpp.o.d"
+  "/root/repo/src/connectors/wire/WireProtocolCommands.cpp" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocolCommands.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocolCommands.cpp.o.d"
+  "/root/repo/src/connectors/wire/WireSession.cpp" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireSession.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireSession.cpp.o.d"
+  "/root/repo/src/connectors/wire/WireTranscript.cpp" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireTranscript.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/connectors/wire/WireTranscript.cpp.o.d"
+  "/root/repo/src/drivers/GTestDriver.cpp" "src/CMakeFiles/cucumber-cpp.dir/drivers/GTestDriver.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/drivers/GTestDriver.cpp.o.d"
+  "/root/repo/src/drivers/GenericDriver.cpp" "src/CMakeFiles/cucumber-cpp.dir/drivers/GenericDriver.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/drivers/GenericDriver.cpp.o.d"
+  "/root/repo/src/gherkin/FeatureParser.cpp" "src/CMakeFiles/cucumber-cpp.dir/gherkin/FeatureParser.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/gherkin/FeatureParser.cpp.o.d"
+  "/root/repo/src/gherkin/FeatureSource.cpp" "src/CMakeFiles/cucumber-cpp.dir/gherkin/FeatureSource.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/gherkin/FeatureSource.cpp.o.d"
+  "/root/repo/src/regex/Pcre2Regex.cpp" "src/CMakeFiles/cucumber-cpp.dir/regex/Pcre2Regex.cpp.o" "gcc" "src/CMakeFiles/cucumber-cpp.dir/regex/Pcre2Regex.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,93 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cucumber-cpp.dir/AllocationTracking.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/AllocationTracking.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/ContextManager.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/ContextManager.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/CpuAffinity.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/CpuAffinity.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/CucumberExpression.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/CucumberExpression.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/CukeCommands.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/CukeCommands.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/CukeEngine.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/CukeEngine.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/CukeEngineImpl.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/CukeEngineImpl.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/DurationHistory.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/DurationHistory.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/HardwareCounters.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/HardwareCounters.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/HookRegistrar.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/HookRegistrar.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/ImpactRecord.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/ImpactRecord.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/JsonString.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/JsonString.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/Regex.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/Regex.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/Scenario.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/Scenario.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/ScenarioRunner.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/ScenarioRunner.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StartupProfile.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StartupProfile.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StepBenchmark.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StepBenchmark.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StepExecutor.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StepExecutor.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StepIndex.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StepIndex.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StepLibrary.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StepLibrary.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StepManager.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StepManager.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StepSnapshot.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StepSnapshot.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StepTimeouts.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StepTimeouts.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/StringPool.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/StringPool.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/Table.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/Table.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/Tag.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/Tag.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/Telemetry.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/Telemetry.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/ThreadPool.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/ThreadPool.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/Timings.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/Timings.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/TraceRecorder.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/TraceRecorder.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/Watchdog.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/Watchdog.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/SharedMemoryServer.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/SharedMemoryServer.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireCoordinator.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireCoordinator.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocol.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocol.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocolCommands.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireProtocolCommands.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireSession.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireSession.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireTranscript.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/connectors/wire/WireTranscript.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/drivers/GTestDriver.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/drivers/GTestDriver.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/drivers/GenericDriver.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/drivers/GenericDriver.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/gherkin/FeatureParser.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/gherkin/FeatureParser.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/gherkin/FeatureSource.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/gherkin/FeatureSource.cpp.o.d"
+  "CMakeFiles/cucumber-cpp.dir/regex/Pcre2Regex.cpp.o"
+  "CMakeFiles/cucumber-cpp.dir/regex/Pcre2Regex.cpp.o.d"
+  "libcucumber-cpp.a"
+  "libcucumber-cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cucumber-cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CpuAffinityTest.dir/unit/CpuAffinityTest.cpp.o"
+  "CMakeFiles/CpuAffinityTest.dir/unit/CpuAffinityTest.cpp.o.d"
+  "CpuAffinityTest"
+  "CpuAffinityTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CpuAffinityTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
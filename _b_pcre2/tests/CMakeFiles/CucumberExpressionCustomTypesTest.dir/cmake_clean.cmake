@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CucumberExpressionCustomTypesTest.dir/unit/CucumberExpressionCustomTypesTest.cpp.o"
+  "CMakeFiles/CucumberExpressionCustomTypesTest.dir/unit/CucumberExpressionCustomTypesTest.cpp.o.d"
+  "CucumberExpressionCustomTypesTest"
+  "CucumberExpressionCustomTypesTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CucumberExpressionCustomTypesTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
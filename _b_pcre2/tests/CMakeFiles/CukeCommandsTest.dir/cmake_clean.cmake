@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CukeCommandsTest.dir/unit/CukeCommandsTest.cpp.o"
+  "CMakeFiles/CukeCommandsTest.dir/unit/CukeCommandsTest.cpp.o.d"
+  "CukeCommandsTest"
+  "CukeCommandsTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CukeCommandsTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CustomParameterTypesIntegrationTest.dir/integration/CustomParameterTypesIntegrationTest.cpp.o"
+  "CMakeFiles/CustomParameterTypesIntegrationTest.dir/integration/CustomParameterTypesIntegrationTest.cpp.o.d"
+  "CustomParameterTypesIntegrationTest"
+  "CustomParameterTypesIntegrationTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CustomParameterTypesIntegrationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GenericDriverTest.dir/integration/drivers/GenericDriverTest.cpp.o"
+  "CMakeFiles/GenericDriverTest.dir/integration/drivers/GenericDriverTest.cpp.o.d"
+  "GenericDriverTest"
+  "GenericDriverTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GenericDriverTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HookRegistrationTest.dir/integration/HookRegistrationTest.cpp.o"
+  "CMakeFiles/HookRegistrationTest.dir/integration/HookRegistrationTest.cpp.o.d"
+  "HookRegistrationTest"
+  "HookRegistrationTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HookRegistrationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IdempotentStepTest.dir/unit/IdempotentStepTest.cpp.o"
+  "CMakeFiles/IdempotentStepTest.dir/unit/IdempotentStepTest.cpp.o.d"
+  "IdempotentStepTest"
+  "IdempotentStepTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IdempotentStepTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
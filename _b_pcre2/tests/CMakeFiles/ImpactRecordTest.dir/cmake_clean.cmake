@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ImpactRecordTest.dir/unit/ImpactRecordTest.cpp.o"
+  "CMakeFiles/ImpactRecordTest.dir/unit/ImpactRecordTest.cpp.o.d"
+  "ImpactRecordTest"
+  "ImpactRecordTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ImpactRecordTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/JsonStringTest.dir/unit/JsonStringTest.cpp.o"
+  "CMakeFiles/JsonStringTest.dir/unit/JsonStringTest.cpp.o.d"
+  "JsonStringTest"
+  "JsonStringTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/JsonStringTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
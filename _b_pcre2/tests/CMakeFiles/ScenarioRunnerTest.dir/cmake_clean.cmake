@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ScenarioRunnerTest.dir/integration/ScenarioRunnerTest.cpp.o"
+  "CMakeFiles/ScenarioRunnerTest.dir/integration/ScenarioRunnerTest.cpp.o.d"
+  "ScenarioRunnerTest"
+  "ScenarioRunnerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ScenarioRunnerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StartupProfileTest.dir/unit/StartupProfileTest.cpp.o"
+  "CMakeFiles/StartupProfileTest.dir/unit/StartupProfileTest.cpp.o.d"
+  "StartupProfileTest"
+  "StartupProfileTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StartupProfileTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepBenchmarkTest.dir/unit/StepBenchmarkTest.cpp.o"
+  "CMakeFiles/StepBenchmarkTest.dir/unit/StepBenchmarkTest.cpp.o.d"
+  "StepBenchmarkTest"
+  "StepBenchmarkTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepBenchmarkTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
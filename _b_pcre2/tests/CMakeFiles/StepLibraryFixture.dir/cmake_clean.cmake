@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepLibraryFixture.dir/utils/StepLibraryFixture.cpp.o"
+  "CMakeFiles/StepLibraryFixture.dir/utils/StepLibraryFixture.cpp.o.d"
+  "libStepLibraryFixture.pdb"
+  "libStepLibraryFixture.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepLibraryFixture.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepManagerTest.dir/unit/StepManagerTest.cpp.o"
+  "CMakeFiles/StepManagerTest.dir/unit/StepManagerTest.cpp.o.d"
+  "StepManagerTest"
+  "StepManagerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepManagerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepTimeoutsTest.dir/unit/StepTimeoutsTest.cpp.o"
+  "CMakeFiles/StepTimeoutsTest.dir/unit/StepTimeoutsTest.cpp.o.d"
+  "StepTimeoutsTest"
+  "StepTimeoutsTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepTimeoutsTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TagTest.dir/unit/TagTest.cpp.o"
+  "CMakeFiles/TagTest.dir/unit/TagTest.cpp.o.d"
+  "TagTest"
+  "TagTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TagTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
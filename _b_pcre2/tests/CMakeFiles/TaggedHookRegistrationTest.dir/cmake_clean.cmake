@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TaggedHookRegistrationTest.dir/integration/TaggedHookRegistrationTest.cpp.o"
+  "CMakeFiles/TaggedHookRegistrationTest.dir/integration/TaggedHookRegistrationTest.cpp.o.d"
+  "TaggedHookRegistrationTest"
+  "TaggedHookRegistrationTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TaggedHookRegistrationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TraceRecorderTest.dir/unit/TraceRecorderTest.cpp.o"
+  "CMakeFiles/TraceRecorderTest.dir/unit/TraceRecorderTest.cpp.o.d"
+  "TraceRecorderTest"
+  "TraceRecorderTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TraceRecorderTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
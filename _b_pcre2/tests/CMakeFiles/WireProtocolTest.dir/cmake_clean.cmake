@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WireProtocolTest.dir/integration/WireProtocolTest.cpp.o"
+  "CMakeFiles/WireProtocolTest.dir/integration/WireProtocolTest.cpp.o.d"
+  "WireProtocolTest"
+  "WireProtocolTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WireProtocolTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,1104 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_b_pcre2/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ContextHandlingTest.contextsAreCreatedWhenNeeded "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.contextsAreCreatedWhenNeeded")
+set_tests_properties(ContextHandlingTest.contextsAreCreatedWhenNeeded PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.sameContextTypesShareTheSamePointer "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.sameContextTypesShareTheSamePointer")
+set_tests_properties(ContextHandlingTest.sameContextTypesShareTheSamePointer PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.theSameContextIsNotCreatedTwice "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.theSameContextIsNotCreatedTwice")
+set_tests_properties(ContextHandlingTest.theSameContextIsNotCreatedTwice PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.contextsArePurgedExplicitlyOnly "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.contextsArePurgedExplicitlyOnly")
+set_tests_properties(ContextHandlingTest.contextsArePurgedExplicitlyOnly PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.purgedContextsAreCreatedAgain "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.purgedContextsAreCreatedAgain")
+set_tests_properties(ContextHandlingTest.purgedContextsAreCreatedAgain PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.pooledContextsAreSharedWithinAScenario "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.pooledContextsAreSharedWithinAScenario")
+set_tests_properties(ContextHandlingTest.pooledContextsAreSharedWithinAScenario PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.pooledContextsAreResetInPlaceForTheNextScenario "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.pooledContextsAreResetInPlaceForTheNextScenario")
+set_tests_properties(ContextHandlingTest.pooledContextsAreResetInPlaceForTheNextScenario PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.pooledContextsWithoutResetAreAssignedANewInstance "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.pooledContextsWithoutResetAreAssignedANewInstance")
+set_tests_properties(ContextHandlingTest.pooledContextsWithoutResetAreAssignedANewInstance PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.contextsAreSeparatePerSession "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.contextsAreSeparatePerSession")
+set_tests_properties(ContextHandlingTest.contextsAreSeparatePerSession PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.threadsWithoutSessionHaveTheirOwnContexts "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.threadsWithoutSessionHaveTheirOwnContexts")
+set_tests_properties(ContextHandlingTest.threadsWithoutSessionHaveTheirOwnContexts PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.featureContextsOutliveTheScenariosOfTheirFeature "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.featureContextsOutliveTheScenariosOfTheirFeature")
+set_tests_properties(ContextHandlingTest.featureContextsOutliveTheScenariosOfTheirFeature PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest.runContextsAreSharedBySessionsUntilTheRunEnds "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_filter=ContextHandlingTest.runContextsAreSharedBySessionsUntilTheRunEnds")
+set_tests_properties(ContextHandlingTest.runContextsAreSharedBySessionsUntilTheRunEnds PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextHandlingTest "/root/repo/_b_pcre2/tests/ContextHandlingTest" "--gtest_output=xml:TEST-ContextHandlingTest.xml")
+set_tests_properties(ContextHandlingTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;39;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoroutineStepTest.waitsForTheBodyWhenInvokedAsAnyOtherStep "/root/repo/_b_pcre2/tests/CoroutineStepTest" "--gtest_filter=CoroutineStepTest.waitsForTheBodyWhenInvokedAsAnyOtherStep")
+set_tests_properties(CoroutineStepTest.waitsForTheBodyWhenInvokedAsAnyOtherStep PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;42;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoroutineStepTest.reportsTheOutcomeOfAsynchronousBodies "/root/repo/_b_pcre2/tests/CoroutineStepTest" "--gtest_filter=CoroutineStepTest.reportsTheOutcomeOfAsynchronousBodies")
+set_tests_properties(CoroutineStepTest.reportsTheOutcomeOfAsynchronousBodies PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;42;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoroutineStepTest.interleavesWaitingScenariosOnALane "/root/repo/_b_pcre2/tests/CoroutineStepTest" "--gtest_filter=CoroutineStepTest.interleavesWaitingScenariosOnALane")
+set_tests_properties(CoroutineStepTest.interleavesWaitingScenariosOnALane PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;42;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoroutineStepTest "/root/repo/_b_pcre2/tests/CoroutineStepTest" "--gtest_output=xml:TEST-CoroutineStepTest.xml")
+set_tests_properties(CoroutineStepTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;42;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CustomParameterTypesIntegrationTest.CustomColorType "/root/repo/_b_pcre2/tests/CustomParameterTypesIntegrationTest" "--gtest_filter=CustomParameterTypesIntegrationTest.CustomColorType")
+set_tests_properties(CustomParameterTypesIntegrationTest.CustomColorType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;45;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CustomParameterTypesIntegrationTest.CustomGenderType "/root/repo/_b_pcre2/tests/CustomParameterTypesIntegrationTest" "--gtest_filter=CustomParameterTypesIntegrationTest.CustomGenderType")
+set_tests_properties(CustomParameterTypesIntegrationTest.CustomGenderType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;45;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CustomParameterTypesIntegrationTest.CustomAndBuiltInTypes "/root/repo/_b_pcre2/tests/CustomParameterTypesIntegrationTest" "--gtest_filter=CustomParameterTypesIntegrationTest.CustomAndBuiltInTypes")
+set_tests_properties(CustomParameterTypesIntegrationTest.CustomAndBuiltInTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;45;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CustomParameterTypesIntegrationTest.BuiltInTypesAlwaysWork "/root/repo/_b_pcre2/tests/CustomParameterTypesIntegrationTest" "--gtest_filter=CustomParameterTypesIntegrationTest.BuiltInTypesAlwaysWork")
+set_tests_properties(CustomParameterTypesIntegrationTest.BuiltInTypesAlwaysWork PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;45;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CustomParameterTypesIntegrationTest "/root/repo/_b_pcre2/tests/CustomParameterTypesIntegrationTest" "--gtest_output=xml:TEST-CustomParameterTypesIntegrationTest.xml")
+set_tests_properties(CustomParameterTypesIntegrationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;45;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.hooksAreRegisteredByTheMacros "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.hooksAreRegisteredByTheMacros")
+set_tests_properties(HookRegistrationTest.hooksAreRegisteredByTheMacros PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.beforeHooksAreInvokedInAnyOrder "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.beforeHooksAreInvokedInAnyOrder")
+set_tests_properties(HookRegistrationTest.beforeHooksAreInvokedInAnyOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.aroundStepHooksAreInvokedInAnyOrderButNested "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.aroundStepHooksAreInvokedInAnyOrderButNested")
+set_tests_properties(HookRegistrationTest.aroundStepHooksAreInvokedInAnyOrderButNested PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.afterStepHooksAreInvokedInAnyOrder "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.afterStepHooksAreInvokedInAnyOrder")
+set_tests_properties(HookRegistrationTest.afterStepHooksAreInvokedInAnyOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.afterHooksAreInvokedInAnyOrder "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.afterHooksAreInvokedInAnyOrder")
+set_tests_properties(HookRegistrationTest.afterHooksAreInvokedInAnyOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.contextIsAccessibleInAfterHooks "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.contextIsAccessibleInAfterHooks")
+set_tests_properties(HookRegistrationTest.contextIsAccessibleInAfterHooks PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.afterStepHooksAreInvokedAfterAroundStepHooks "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.afterStepHooksAreInvokedAfterAroundStepHooks")
+set_tests_properties(HookRegistrationTest.afterStepHooksAreInvokedAfterAroundStepHooks PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.beforeAllHooksAreInvokedInAnyOrderDuringFirstScenarioOnly "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.beforeAllHooksAreInvokedInAnyOrderDuringFirstScenarioOnly")
+set_tests_properties(HookRegistrationTest.beforeAllHooksAreInvokedInAnyOrderDuringFirstScenarioOnly PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.beforeAllHooksAreNotInvokedIfNoScenariosRun "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.beforeAllHooksAreNotInvokedIfNoScenariosRun")
+set_tests_properties(HookRegistrationTest.beforeAllHooksAreNotInvokedIfNoScenariosRun PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.afterAllHooksAreNotInvokedIfNoScenariosRun "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.afterAllHooksAreNotInvokedIfNoScenariosRun")
+set_tests_properties(HookRegistrationTest.afterAllHooksAreNotInvokedIfNoScenariosRun PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.afterAllHooksAreInvokedOnceDuringDestructionOnly "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_filter=HookRegistrationTest.afterAllHooksAreInvokedOnceDuringDestructionOnly")
+set_tests_properties(HookRegistrationTest.afterAllHooksAreInvokedOnceDuringDestructionOnly PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest "/root/repo/_b_pcre2/tests/HookRegistrationTest" "--gtest_output=xml:TEST-HookRegistrationTest.xml")
+set_tests_properties(HookRegistrationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;46;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.runsScenariosInParallelAndKeepsTheirOrder "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.runsScenariosInParallelAndKeepsTheirOrder")
+set_tests_properties(ScenarioRunnerTest.runsScenariosInParallelAndKeepsTheirOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.reportsTheFirstStepThatDoesNotPass "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.reportsTheFirstStepThatDoesNotPass")
+set_tests_properties(ScenarioRunnerTest.reportsTheFirstStepThatDoesNotPass PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.runsSerialScenariosOnASingleLane "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.runsSerialScenariosOnASingleLane")
+set_tests_properties(ScenarioRunnerTest.runsSerialScenariosOnASingleLane PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.startsTheScenariosExpectedToTakeLongestFirst "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.startsTheScenariosExpectedToTakeLongestFirst")
+set_tests_properties(ScenarioRunnerTest.startsTheScenariosExpectedToTakeLongestFirst PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.matchesEveryDistinctStepTextOnce "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.matchesEveryDistinctStepTextOnce")
+set_tests_properties(ScenarioRunnerTest.matchesEveryDistinctStepTextOnce PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.matchesTheExpansionsOfAnOutlineStepTogether "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.matchesTheExpansionsOfAnOutlineStepTogether")
+set_tests_properties(ScenarioRunnerTest.matchesTheExpansionsOfAnOutlineStepTogether PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.skipsTheRemainingScenariosOnceOneFailed "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.skipsTheRemainingScenariosOnceOneFailed")
+set_tests_properties(ScenarioRunnerTest.skipsTheRemainingScenariosOnceOneFailed PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.skipsTheScenariosSharingATagWithOneThatFailed "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.skipsTheScenariosSharingATagWithOneThatFailed")
+set_tests_properties(ScenarioRunnerTest.skipsTheScenariosSharingATagWithOneThatFailed PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.onlyMatchesStepsOnADryRun "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.onlyMatchesStepsOnADryRun")
+set_tests_properties(ScenarioRunnerTest.onlyMatchesStepsOnADryRun PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.runsNothingWithoutScenarios "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.runsNothingWithoutScenarios")
+set_tests_properties(ScenarioRunnerTest.runsNothingWithoutScenarios PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest.runsTheBackgroundOnceAndRestoresItsContexts "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_filter=ScenarioRunnerTest.runsTheBackgroundOnceAndRestoresItsContexts")
+set_tests_properties(ScenarioRunnerTest.runsTheBackgroundOnceAndRestoresItsContexts PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioRunnerTest "/root/repo/_b_pcre2/tests/ScenarioRunnerTest" "--gtest_output=xml:TEST-ScenarioRunnerTest.xml")
+set_tests_properties(ScenarioRunnerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;47;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SharedMemoryServerTest.exchangesMessagesUntilTheClientDisconnects "/root/repo/_b_pcre2/tests/SharedMemoryServerTest" "--gtest_filter=SharedMemoryServerTest.exchangesMessagesUntilTheClientDisconnects")
+set_tests_properties(SharedMemoryServerTest.exchangesMessagesUntilTheClientDisconnects PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;50;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SharedMemoryServerTest.answersPipelinedRequestsInOrder "/root/repo/_b_pcre2/tests/SharedMemoryServerTest" "--gtest_filter=SharedMemoryServerTest.answersPipelinedRequestsInOrder")
+set_tests_properties(SharedMemoryServerTest.answersPipelinedRequestsInOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;50;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SharedMemoryServerTest.servesOneClientAtATime "/root/repo/_b_pcre2/tests/SharedMemoryServerTest" "--gtest_filter=SharedMemoryServerTest.servesOneClientAtATime")
+set_tests_properties(SharedMemoryServerTest.servesOneClientAtATime PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;50;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SharedMemoryServerTest.clientFailsOnceTheServerIsGone "/root/repo/_b_pcre2/tests/SharedMemoryServerTest" "--gtest_filter=SharedMemoryServerTest.clientFailsOnceTheServerIsGone")
+set_tests_properties(SharedMemoryServerTest.clientFailsOnceTheServerIsGone PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;50;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SharedMemoryServerTest.takesAClientWhoseProcessIsGoneForDisconnected "/root/repo/_b_pcre2/tests/SharedMemoryServerTest" "--gtest_filter=SharedMemoryServerTest.takesAClientWhoseProcessIsGoneForDisconnected")
+set_tests_properties(SharedMemoryServerTest.takesAClientWhoseProcessIsGoneForDisconnected PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;50;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SharedMemoryServerTest.endsTheSessionOfARequestTooLong "/root/repo/_b_pcre2/tests/SharedMemoryServerTest" "--gtest_filter=SharedMemoryServerTest.endsTheSessionOfARequestTooLong")
+set_tests_properties(SharedMemoryServerTest.endsTheSessionOfARequestTooLong PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;50;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SharedMemoryServerTest "/root/repo/_b_pcre2/tests/SharedMemoryServerTest" "--gtest_output=xml:TEST-SharedMemoryServerTest.xml")
+set_tests_properties(SharedMemoryServerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;50;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepRegistrationTest.manualRegistration "/root/repo/_b_pcre2/tests/StepRegistrationTest" "--gtest_filter=StepRegistrationTest.manualRegistration")
+set_tests_properties(StepRegistrationTest.manualRegistration PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;55;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepRegistrationTest.macroRegistration "/root/repo/_b_pcre2/tests/StepRegistrationTest" "--gtest_filter=StepRegistrationTest.macroRegistration")
+set_tests_properties(StepRegistrationTest.macroRegistration PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;55;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepRegistrationTest "/root/repo/_b_pcre2/tests/StepRegistrationTest" "--gtest_output=xml:TEST-StepRegistrationTest.xml")
+set_tests_properties(StepRegistrationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;55;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.noTaggedHooksAreInvokedIfNoScenarioTag "/root/repo/_b_pcre2/tests/TaggedHookRegistrationTest" "--gtest_filter=HookRegistrationTest.noTaggedHooksAreInvokedIfNoScenarioTag")
+set_tests_properties(HookRegistrationTest.noTaggedHooksAreInvokedIfNoScenarioTag PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;56;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.orTagsAreEnforced "/root/repo/_b_pcre2/tests/TaggedHookRegistrationTest" "--gtest_filter=HookRegistrationTest.orTagsAreEnforced")
+set_tests_properties(HookRegistrationTest.orTagsAreEnforced PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;56;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.andTagsAreEnforced "/root/repo/_b_pcre2/tests/TaggedHookRegistrationTest" "--gtest_filter=HookRegistrationTest.andTagsAreEnforced")
+set_tests_properties(HookRegistrationTest.andTagsAreEnforced PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;56;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.taggedStepHooksAreInvokedForEveryStepOfTheScenario "/root/repo/_b_pcre2/tests/TaggedHookRegistrationTest" "--gtest_filter=HookRegistrationTest.taggedStepHooksAreInvokedForEveryStepOfTheScenario")
+set_tests_properties(HookRegistrationTest.taggedStepHooksAreInvokedForEveryStepOfTheScenario PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;56;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HookRegistrationTest.booleanTagExpressionsAreEnforced "/root/repo/_b_pcre2/tests/TaggedHookRegistrationTest" "--gtest_filter=HookRegistrationTest.booleanTagExpressionsAreEnforced")
+set_tests_properties(HookRegistrationTest.booleanTagExpressionsAreEnforced PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;56;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TaggedHookRegistrationTest "/root/repo/_b_pcre2/tests/TaggedHookRegistrationTest" "--gtest_output=xml:TEST-TaggedHookRegistrationTest.xml")
+set_tests_properties(TaggedHookRegistrationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;56;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCoordinatorTest.givesScenariosToTheWorkerExpectedToBeDoneFirst "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=WireCoordinatorTest.givesScenariosToTheWorkerExpectedToBeDoneFirst")
+set_tests_properties(WireCoordinatorTest.givesScenariosToTheWorkerExpectedToBeDoneFirst PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCoordinatorTest.expectsUnknownScenariosToTakeTheAverageDuration "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=WireCoordinatorTest.expectsUnknownScenariosToTakeTheAverageDuration")
+set_tests_properties(WireCoordinatorTest.expectsUnknownScenariosToTakeTheAverageDuration PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCoordinatorTest.recordsDurationsInTheHistory "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=WireCoordinatorTest.recordsDurationsInTheHistory")
+set_tests_properties(WireCoordinatorTest.recordsDurationsInTheHistory PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCoordinatorTest.forgetsTheWorkOfAbandonedScenarios "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=WireCoordinatorTest.forgetsTheWorkOfAbandonedScenarios")
+set_tests_properties(WireCoordinatorTest.forgetsTheWorkOfAbandonedScenarios PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCoordinatorWorkersTest.needsWorkers "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=WireCoordinatorWorkersTest.needsWorkers")
+set_tests_properties(WireCoordinatorWorkersTest.needsWorkers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCoordinatorKeyTest.recognisesScenariosByTagsAndSteps "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=WireCoordinatorKeyTest.recognisesScenariosByTagsAndSteps")
+set_tests_properties(WireCoordinatorKeyTest.recognisesScenariosByTagsAndSteps PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoordinatingProtocolHandlerTest.forwardsEachScenarioToTheWorkerPickedForIt "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=CoordinatingProtocolHandlerTest.forwardsEachScenarioToTheWorkerPickedForIt")
+set_tests_properties(CoordinatingProtocolHandlerTest.forwardsEachScenarioToTheWorkerPickedForIt PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoordinatingProtocolHandlerTest.keepsClientsOnJson "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=CoordinatingProtocolHandlerTest.keepsClientsOnJson")
+set_tests_properties(CoordinatingProtocolHandlerTest.keepsClientsOnJson PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoordinatingProtocolHandlerTest.reportsWorkerFailuresAndReconnects "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=CoordinatingProtocolHandlerTest.reportsWorkerFailuresAndReconnects")
+set_tests_properties(CoordinatingProtocolHandlerTest.reportsWorkerFailuresAndReconnects PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CoordinatingProtocolHandlerTest.takesRunScenarioRequestsForWholeScenarios "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_filter=CoordinatingProtocolHandlerTest.takesRunScenarioRequestsForWholeScenarios")
+set_tests_properties(CoordinatingProtocolHandlerTest.takesRunScenarioRequestsForWholeScenarios PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCoordinatorTest "/root/repo/_b_pcre2/tests/WireCoordinatorTest" "--gtest_output=xml:TEST-WireCoordinatorTest.xml")
+set_tests_properties(WireCoordinatorTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;57;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.decodesUnknownOrMalformedMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.decodesUnknownOrMalformedMessage")
+set_tests_properties(WireMessageCodecTest.decodesUnknownOrMalformedMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesStepMatchesMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesStepMatchesMessage")
+set_tests_properties(WireMessageCodecTest.handlesStepMatchesMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesStepMatchesBatchMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesStepMatchesBatchMessage")
+set_tests_properties(WireMessageCodecTest.handlesStepMatchesBatchMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesBeginFeatureMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesBeginFeatureMessage")
+set_tests_properties(WireMessageCodecTest.handlesBeginFeatureMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesBeginScenarioMessageWithoutArgument "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesBeginScenarioMessageWithoutArgument")
+set_tests_properties(WireMessageCodecTest.handlesBeginScenarioMessageWithoutArgument PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesBeginScenarioMessageWithTagsArgument "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesBeginScenarioMessageWithTagsArgument")
+set_tests_properties(WireMessageCodecTest.handlesBeginScenarioMessageWithTagsArgument PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesBeginScenarioMessageWithNullArgument "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesBeginScenarioMessageWithNullArgument")
+set_tests_properties(WireMessageCodecTest.handlesBeginScenarioMessageWithNullArgument PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesInvokeMessageWithNoArgs "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesInvokeMessageWithNoArgs")
+set_tests_properties(WireMessageCodecTest.handlesInvokeMessageWithNoArgs PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesInvokeMessageWithoutTableArgs "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesInvokeMessageWithoutTableArgs")
+set_tests_properties(WireMessageCodecTest.handlesInvokeMessageWithoutTableArgs PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesInvokeMessageWithTableArgs "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesInvokeMessageWithTableArgs")
+set_tests_properties(WireMessageCodecTest.handlesInvokeMessageWithTableArgs PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesInvokeMessageWithNullArg "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesInvokeMessageWithNullArg")
+set_tests_properties(WireMessageCodecTest.handlesInvokeMessageWithNullArg PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesInvokeMessageWithUnevenTableRows "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesInvokeMessageWithUnevenTableRows")
+set_tests_properties(WireMessageCodecTest.handlesInvokeMessageWithUnevenTableRows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.failsOnInvokeMessageWithMalformedTable "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.failsOnInvokeMessageWithMalformedTable")
+set_tests_properties(WireMessageCodecTest.failsOnInvokeMessageWithMalformedTable PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesEndScenarioMessageWithoutArgument "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesEndScenarioMessageWithoutArgument")
+set_tests_properties(WireMessageCodecTest.handlesEndScenarioMessageWithoutArgument PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesEndScenarioMessageWithNullArgument "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesEndScenarioMessageWithNullArgument")
+set_tests_properties(WireMessageCodecTest.handlesEndScenarioMessageWithNullArgument PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesEndScenarioMessageWithTagsArgument "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesEndScenarioMessageWithTagsArgument")
+set_tests_properties(WireMessageCodecTest.handlesEndScenarioMessageWithTagsArgument PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesSnippetTextMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesSnippetTextMessage")
+set_tests_properties(WireMessageCodecTest.handlesSnippetTextMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesRunScenarioMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesRunScenarioMessage")
+set_tests_properties(WireMessageCodecTest.handlesRunScenarioMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesStatsMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesStatsMessage")
+set_tests_properties(WireMessageCodecTest.handlesStatsMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesLoadLibraryMessage "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesLoadLibraryMessage")
+set_tests_properties(WireMessageCodecTest.handlesLoadLibraryMessage PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.refusesLoadLibraryMessageUnlessAllowed "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.refusesLoadLibraryMessageUnlessAllowed")
+set_tests_properties(WireMessageCodecTest.refusesLoadLibraryMessageUnlessAllowed PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.refusesLoadLibraryMessageWhileScenariosRun "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.refusesLoadLibraryMessageWhileScenariosRun")
+set_tests_properties(WireMessageCodecTest.refusesLoadLibraryMessageWhileScenariosRun PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesSuccessResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesSuccessResponse")
+set_tests_properties(WireMessageCodecTest.handlesSuccessResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesSimpleFailureResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesSimpleFailureResponse")
+set_tests_properties(WireMessageCodecTest.handlesSimpleFailureResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesDetailedFailureResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesDetailedFailureResponse")
+set_tests_properties(WireMessageCodecTest.handlesDetailedFailureResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesPendingResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesPendingResponse")
+set_tests_properties(WireMessageCodecTest.handlesPendingResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesEmptyStepMatchesResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesEmptyStepMatchesResponse")
+set_tests_properties(WireMessageCodecTest.handlesEmptyStepMatchesResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesStepMatchesResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesStepMatchesResponse")
+set_tests_properties(WireMessageCodecTest.handlesStepMatchesResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesStepMatchesBatchResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesStepMatchesBatchResponse")
+set_tests_properties(WireMessageCodecTest.handlesStepMatchesBatchResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesRunScenarioResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesRunScenarioResponse")
+set_tests_properties(WireMessageCodecTest.handlesRunScenarioResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesSnippetTextResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesSnippetTextResponse")
+set_tests_properties(WireMessageCodecTest.handlesSnippetTextResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.handlesStatsResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.handlesStatsResponse")
+set_tests_properties(WireMessageCodecTest.handlesStatsResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.encodesResponseUsingRawUtf8 "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.encodesResponseUsingRawUtf8")
+set_tests_properties(WireMessageCodecTest.encodesResponseUsingRawUtf8 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.escapesSpecialCharactersInResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.escapesSpecialCharactersInResponse")
+set_tests_properties(WireMessageCodecTest.escapesSpecialCharactersInResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireMessageCodecTest.rejectsInvalidUtf8InResponse "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireMessageCodecTest.rejectsInvalidUtf8InResponse")
+set_tests_properties(WireMessageCodecTest.rejectsInvalidUtf8InResponse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(MessagePackWireMessageCodecTest.decodesAndEncodesMessagePack "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=MessagePackWireMessageCodecTest.decodesAndEncodesMessagePack")
+set_tests_properties(MessagePackWireMessageCodecTest.decodesAndEncodesMessagePack PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolHandlerTest.negotiatesMessagePackCodec "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireProtocolHandlerTest.negotiatesMessagePackCodec")
+set_tests_properties(WireProtocolHandlerTest.negotiatesMessagePackCodec PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolHandlerTest.countsTheBytesDecodedAndEncoded "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireProtocolHandlerTest.countsTheBytesDecodedAndEncoded")
+set_tests_properties(WireProtocolHandlerTest.countsTheBytesDecodedAndEncoded PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolHandlerTest.refusesUnsupportedCodec "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireProtocolHandlerTest.refusesUnsupportedCodec")
+set_tests_properties(WireProtocolHandlerTest.refusesUnsupportedCodec PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolHandlerTest.handlesRequestsPreparedAhead "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireProtocolHandlerTest.handlesRequestsPreparedAhead")
+set_tests_properties(WireProtocolHandlerTest.handlesRequestsPreparedAhead PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolHandlerTest.answersRepeatedStepMatchesFromItsCache "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireProtocolHandlerTest.answersRepeatedStepMatchesFromItsCache")
+set_tests_properties(WireProtocolHandlerTest.answersRepeatedStepMatchesFromItsCache PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolHandlerTest.preparesRepeatedStepMatchesAheadOfHandlingThem "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireProtocolHandlerTest.preparesRepeatedStepMatchesAheadOfHandlingThem")
+set_tests_properties(WireProtocolHandlerTest.preparesRepeatedStepMatchesAheadOfHandlingThem PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolHandlerTest.cachesNoStepMatchesFoundBeforeMatchingChanged "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireProtocolHandlerTest.cachesNoStepMatchesFoundBeforeMatchingChanged")
+set_tests_properties(WireProtocolHandlerTest.cachesNoStepMatchesFoundBeforeMatchingChanged PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireRequestScratchTest.keepsTheScratchUntilTheOutermostRequestEnds "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireRequestScratchTest.keepsTheScratchUntilTheOutermostRequestEnds")
+set_tests_properties(WireRequestScratchTest.keepsTheScratchUntilTheOutermostRequestEnds PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCommandsTest.invokeMovesArgumentsIntoTheEngine "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireCommandsTest.invokeMovesArgumentsIntoTheEngine")
+set_tests_properties(WireCommandsTest.invokeMovesArgumentsIntoTheEngine PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCommandsTest.succesfulInvokeReturnsSuccess "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireCommandsTest.succesfulInvokeReturnsSuccess")
+set_tests_properties(WireCommandsTest.succesfulInvokeReturnsSuccess PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCommandsTest.throwingFailureInvokeReturnsFailure "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireCommandsTest.throwingFailureInvokeReturnsFailure")
+set_tests_properties(WireCommandsTest.throwingFailureInvokeReturnsFailure PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCommandsTest.throwingPendingStepReturnsPending "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireCommandsTest.throwingPendingStepReturnsPending")
+set_tests_properties(WireCommandsTest.throwingPendingStepReturnsPending PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCommandsTest.returnedFailureInvokeReturnsFailure "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireCommandsTest.returnedFailureInvokeReturnsFailure")
+set_tests_properties(WireCommandsTest.returnedFailureInvokeReturnsFailure PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCommandsTest.throwingAnythingInvokeReturnsFailure "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireCommandsTest.throwingAnythingInvokeReturnsFailure")
+set_tests_properties(WireCommandsTest.throwingAnythingInvokeReturnsFailure PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireCommandsTest.runScenarioSkipsTheStepsAfterAFailure "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_filter=WireCommandsTest.runScenarioSkipsTheStepsAfterAFailure")
+set_tests_properties(WireCommandsTest.runScenarioSkipsTheStepsAfterAFailure PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireProtocolTest "/root/repo/_b_pcre2/tests/WireProtocolTest" "--gtest_output=xml:TEST-WireProtocolTest.xml")
+set_tests_properties(WireProtocolTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;58;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireSessionTest.preparesARequestWhileHandlingAnother "/root/repo/_b_pcre2/tests/WireSessionTest" "--gtest_filter=WireSessionTest.preparesARequestWhileHandlingAnother")
+set_tests_properties(WireSessionTest.preparesARequestWhileHandlingAnother PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;59;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireSessionTest "/root/repo/_b_pcre2/tests/WireSessionTest" "--gtest_output=xml:TEST-WireSessionTest.xml")
+set_tests_properties(WireSessionTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;59;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireTranscriptTest.readsWhatWasWrittenIncludingLineBreaks "/root/repo/_b_pcre2/tests/WireTranscriptTest" "--gtest_filter=WireTranscriptTest.readsWhatWasWrittenIncludingLineBreaks")
+set_tests_properties(WireTranscriptTest.readsWhatWasWrittenIncludingLineBreaks PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;60;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireTranscriptTest.failsOnMalformedTranscripts "/root/repo/_b_pcre2/tests/WireTranscriptTest" "--gtest_filter=WireTranscriptTest.failsOnMalformedTranscripts")
+set_tests_properties(WireTranscriptTest.failsOnMalformedTranscripts PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;60;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireTranscriptTest.recordsRequestsAndResponsesOfEverySession "/root/repo/_b_pcre2/tests/WireTranscriptTest" "--gtest_filter=WireTranscriptTest.recordsRequestsAndResponsesOfEverySession")
+set_tests_properties(WireTranscriptTest.recordsRequestsAndResponsesOfEverySession PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;60;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireTranscriptTest.replaysSessionsComparingTheirResponses "/root/repo/_b_pcre2/tests/WireTranscriptTest" "--gtest_filter=WireTranscriptTest.replaysSessionsComparingTheirResponses")
+set_tests_properties(WireTranscriptTest.replaysSessionsComparingTheirResponses PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;60;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WireTranscriptTest "/root/repo/_b_pcre2/tests/WireTranscriptTest" "--gtest_output=xml:TEST-WireTranscriptTest.xml")
+set_tests_properties(WireTranscriptTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;60;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(AllocationTrackingTest.countsTheAllocationsOfTheThread "/root/repo/_b_pcre2/tests/AllocationTrackingTest" "--gtest_filter=AllocationTrackingTest.countsTheAllocationsOfTheThread")
+set_tests_properties(AllocationTrackingTest.countsTheAllocationsOfTheThread PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;61;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(AllocationTrackingTest.recordsTheBytesStepsAndScenariosRetain "/root/repo/_b_pcre2/tests/AllocationTrackingTest" "--gtest_filter=AllocationTrackingTest.recordsTheBytesStepsAndScenariosRetain")
+set_tests_properties(AllocationTrackingTest.recordsTheBytesStepsAndScenariosRetain PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;61;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(AllocationTrackingTest "/root/repo/_b_pcre2/tests/AllocationTrackingTest" "--gtest_output=xml:TEST-AllocationTrackingTest.xml")
+set_tests_properties(AllocationTrackingTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;61;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(BasicStepTest.handlesPendingSteps "/root/repo/_b_pcre2/tests/BasicStepTest" "--gtest_filter=BasicStepTest.handlesPendingSteps")
+set_tests_properties(BasicStepTest.handlesPendingSteps PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;62;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(BasicStepTest.invokeResultsKeepTheirDescriptionWhenCopiedOrMoved "/root/repo/_b_pcre2/tests/BasicStepTest" "--gtest_filter=BasicStepTest.invokeResultsKeepTheirDescriptionWhenCopiedOrMoved")
+set_tests_properties(BasicStepTest.invokeResultsKeepTheirDescriptionWhenCopiedOrMoved PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;62;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(BasicStepTest "/root/repo/_b_pcre2/tests/BasicStepTest" "--gtest_output=xml:TEST-BasicStepTest.xml")
+set_tests_properties(BasicStepTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;62;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.createsValidContextPointers "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.createsValidContextPointers")
+set_tests_properties(ContextManagerTest.createsValidContextPointers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.allowsCreatingTheSameContextTypeTwice "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.allowsCreatingTheSameContextTypeTwice")
+set_tests_properties(ContextManagerTest.allowsCreatingTheSameContextTypeTwice PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.purgesContexts "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.purgesContexts")
+set_tests_properties(ContextManagerTest.purgesContexts PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.destroysContextsInReverseOrderOfCreation "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.destroysContextsInReverseOrderOfCreation")
+set_tests_properties(ContextManagerTest.destroysContextsInReverseOrderOfCreation PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.alignsContextsAcrossBlocks "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.alignsContextsAcrossBlocks")
+set_tests_properties(ContextManagerTest.alignsContextsAcrossBlocks PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.contextsThatFailToConstructAreNotKept "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.contextsThatFailToConstructAreNotKept")
+set_tests_properties(ContextManagerTest.contextsThatFailToConstructAreNotKept PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.countsTheContextsAliveInTheProcess "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.countsTheContextsAliveInTheProcess")
+set_tests_properties(ContextManagerTest.countsTheContextsAliveInTheProcess PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest.destroysPurgedContextsInTheBackgroundWhenAsked "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_filter=ContextManagerTest.destroysPurgedContextsInTheBackgroundWhenAsked")
+set_tests_properties(ContextManagerTest.destroysPurgedContextsInTheBackgroundWhenAsked PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ContextManagerTest "/root/repo/_b_pcre2/tests/ContextManagerTest" "--gtest_output=xml:TEST-ContextManagerTest.xml")
+set_tests_properties(ContextManagerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;63;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CpuAffinityTest.parsesCpusAndRanges "/root/repo/_b_pcre2/tests/CpuAffinityTest" "--gtest_filter=CpuAffinityTest.parsesCpusAndRanges")
+set_tests_properties(CpuAffinityTest.parsesCpusAndRanges PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;64;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CpuAffinityTest.rejectsMalformedLists "/root/repo/_b_pcre2/tests/CpuAffinityTest" "--gtest_filter=CpuAffinityTest.rejectsMalformedLists")
+set_tests_properties(CpuAffinityTest.rejectsMalformedLists PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;64;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CpuAffinityTest.handsCpusOutInTurn "/root/repo/_b_pcre2/tests/CpuAffinityTest" "--gtest_filter=CpuAffinityTest.handsCpusOutInTurn")
+set_tests_properties(CpuAffinityTest.handsCpusOutInTurn PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;64;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CpuAffinityTest.restoresTheCpusOfThreadsPinnedInScope "/root/repo/_b_pcre2/tests/CpuAffinityTest" "--gtest_filter=CpuAffinityTest.restoresTheCpusOfThreadsPinnedInScope")
+set_tests_properties(CpuAffinityTest.restoresTheCpusOfThreadsPinnedInScope PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;64;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CpuAffinityTest "/root/repo/_b_pcre2/tests/CpuAffinityTest" "--gtest_output=xml:TEST-CpuAffinityTest.xml")
+set_tests_properties(CpuAffinityTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;64;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.NoCustomTypesFile_BuiltInTypesStillWork "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.NoCustomTypesFile_BuiltInTypesStillWork")
+set_tests_properties(CucumberExpressionCustomTypesTest.NoCustomTypesFile_BuiltInTypesStillWork PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.NoCustomTypesFile_UnknownTypeThrows "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.NoCustomTypesFile_UnknownTypeThrows")
+set_tests_properties(CucumberExpressionCustomTypesTest.NoCustomTypesFile_UnknownTypeThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.ValidCustomTypesFile "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.ValidCustomTypesFile")
+set_tests_properties(CucumberExpressionCustomTypesTest.ValidCustomTypesFile PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.EmptyJsonArray "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.EmptyJsonArray")
+set_tests_properties(CucumberExpressionCustomTypesTest.EmptyJsonArray PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.InvalidJson_ReturnsEmpty "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.InvalidJson_ReturnsEmpty")
+set_tests_properties(CucumberExpressionCustomTypesTest.InvalidJson_ReturnsEmpty PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.JsonObject_ReturnsEmpty "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.JsonObject_ReturnsEmpty")
+set_tests_properties(CucumberExpressionCustomTypesTest.JsonObject_ReturnsEmpty PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.MissingNameField_SkipsEntry "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.MissingNameField_SkipsEntry")
+set_tests_properties(CucumberExpressionCustomTypesTest.MissingNameField_SkipsEntry PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.MissingRegexpField_SkipsEntry "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.MissingRegexpField_SkipsEntry")
+set_tests_properties(CucumberExpressionCustomTypesTest.MissingRegexpField_SkipsEntry PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.IntegrationTest_CustomColorType "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_also_run_disabled_tests" "--gtest_filter=CucumberExpressionCustomTypesTest.DISABLED_IntegrationTest_CustomColorType")
+set_tests_properties(CucumberExpressionCustomTypesTest.IntegrationTest_CustomColorType PROPERTIES  DISABLED "TRUE" _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;390;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.IntegrationTest_CustomGenderType "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_also_run_disabled_tests" "--gtest_filter=CucumberExpressionCustomTypesTest.DISABLED_IntegrationTest_CustomGenderType")
+set_tests_properties(CucumberExpressionCustomTypesTest.IntegrationTest_CustomGenderType PROPERTIES  DISABLED "TRUE" _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;390;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.DefinedTypes "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.DefinedTypes")
+set_tests_properties(CucumberExpressionCustomTypesTest.DefinedTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.InvalidDefinedTypesThrow "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.InvalidDefinedTypesThrow")
+set_tests_properties(CucumberExpressionCustomTypesTest.InvalidDefinedTypesThrow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.LoadedTypes "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.LoadedTypes")
+set_tests_properties(CucumberExpressionCustomTypesTest.LoadedTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.MatcherRunsCustomTypes "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.MatcherRunsCustomTypes")
+set_tests_properties(CucumberExpressionCustomTypesTest.MatcherRunsCustomTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest.TransformedTypes "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_filter=CucumberExpressionCustomTypesTest.TransformedTypes")
+set_tests_properties(CucumberExpressionCustomTypesTest.TransformedTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionCustomTypesTest "/root/repo/_b_pcre2/tests/CucumberExpressionCustomTypesTest" "--gtest_output=xml:TEST-CucumberExpressionCustomTypesTest.xml")
+set_tests_properties(CucumberExpressionCustomTypesTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;65;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyExpressionThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyExpressionThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyExpressionThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnfinishedParenthesisThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnfinishedParenthesisThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnfinishedParenthesisThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnfinishedParenthesisWithTextThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnfinishedParenthesisWithTextThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnfinishedParenthesisWithTextThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnclosedParameterBraceThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnclosedParameterBraceThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnclosedParameterBraceThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnclosedBraceAtEndThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnclosedBraceAtEndThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnclosedBraceAtEndThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnmatchedClosingBraceThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnmatchedClosingBraceThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnmatchedClosingBraceThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnmatchedClosingBraceInTextThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnmatchedClosingBraceInTextThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnmatchedClosingBraceInTextThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultipleUnmatchedClosingBracesThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultipleUnmatchedClosingBracesThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultipleUnmatchedClosingBracesThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnmatchedClosingParenthesisThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnmatchedClosingParenthesisThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnmatchedClosingParenthesisThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnmatchedClosingParenthesisInTextThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnmatchedClosingParenthesisInTextThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnmatchedClosingParenthesisInTextThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultipleUnmatchedClosingParenthesesThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultipleUnmatchedClosingParenthesesThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultipleUnmatchedClosingParenthesesThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyOptionalAtStartThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyOptionalAtStartThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyOptionalAtStartThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyOptionalAtEndThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyOptionalAtEndThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyOptionalAtEndThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultipleEmptyOptionalsThrow "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultipleEmptyOptionalsThrow")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultipleEmptyOptionalsThrow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.OptionalParameterTypeThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.OptionalParameterTypeThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.OptionalParameterTypeThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.OptionalStringParameterThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.OptionalStringParameterThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.OptionalStringParameterThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.OptionalParameterTypeWithTextThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.OptionalParameterTypeWithTextThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.OptionalParameterTypeWithTextThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.NestedOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.NestedOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.NestedOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.DeeplyNestedOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.DeeplyNestedOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.DeeplyNestedOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultiLevelNestedOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultiLevelNestedOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultiLevelNestedOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.AlternationInOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.AlternationInOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.AlternationInOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.ComplexAlternationInOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.ComplexAlternationInOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.ComplexAlternationInOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyAlternativeThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyAlternativeThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyAlternativeThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyFirstAlternativeThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyFirstAlternativeThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyFirstAlternativeThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyLastAlternativeThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyLastAlternativeThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyLastAlternativeThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultipleEmptyAlternativesThrow "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultipleEmptyAlternativesThrow")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultipleEmptyAlternativesThrow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentLeftParameterThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentLeftParameterThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentLeftParameterThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentRightParameterThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentRightParameterThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentRightParameterThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.EmptyAlternativeByAdjacentOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnknownParameterTypeThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnknownParameterTypeThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnknownParameterTypeThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnknownParameterTypeWithTextThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnknownParameterTypeWithTextThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnknownParameterTypeWithTextThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultipleUnknownParameterTypesThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultipleUnknownParameterTypesThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultipleUnknownParameterTypesThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MixedKnownUnknownParameterTypesThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MixedKnownUnknownParameterTypesThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MixedKnownUnknownParameterTypesThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.ParameterTypeWithWhitespaceThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.ParameterTypeWithWhitespaceThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.ParameterTypeWithWhitespaceThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.ParameterTypeWithInvalidCharsThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.ParameterTypeWithInvalidCharsThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.ParameterTypeWithInvalidCharsThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.ConsecutiveSlashesThrow "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.ConsecutiveSlashesThrow")
+set_tests_properties(CucumberExpressionpressionErrorsTest.ConsecutiveSlashesThrow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultipleConsecutiveSlashesThrow "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultipleConsecutiveSlashesThrow")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultipleConsecutiveSlashesThrow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MixedUnmatchedBracesAndParenthesesThrow "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MixedUnmatchedBracesAndParenthesesThrow")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MixedUnmatchedBracesAndParenthesesThrow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.UnfinishedParameterInOptionalThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.UnfinishedParameterInOptionalThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.UnfinishedParameterInOptionalThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.MultipleErrorConditionsThrow "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.MultipleErrorConditionsThrow")
+set_tests_properties(CucumberExpressionpressionErrorsTest.MultipleErrorConditionsThrow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.ValidFollowedByInvalidThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.ValidFollowedByInvalidThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.ValidFollowedByInvalidThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionErrorsTest.InvalidInMiddleOfValidThrows "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_filter=CucumberExpressionpressionErrorsTest.InvalidInMiddleOfValidThrows")
+set_tests_properties(CucumberExpressionpressionErrorsTest.InvalidInMiddleOfValidThrows PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionErrorsTest "/root/repo/_b_pcre2/tests/CucumberExpressionErrorsTest" "--gtest_output=xml:TEST-CucumberExpressionErrorsTest.xml")
+set_tests_properties(CucumberExpressionErrorsTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;66;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesInt "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesInt")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesInt PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesIntNegative "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesIntNegative")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesIntNegative PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.DoesNotMatchSingleMinusAsInt "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.DoesNotMatchSingleMinusAsInt")
+set_tests_properties(CucumberExpressionMatchingTest.DoesNotMatchSingleMinusAsInt PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesWord "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesWord")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesWord PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesFloat "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesFloat")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesFloat PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesFloatNegative "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesFloatNegative")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesFloatNegative PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesFloatWithoutIntegerPart "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesFloatWithoutIntegerPart")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesFloatWithoutIntegerPart PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.DoesntMatchFloatAsInt "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.DoesntMatchFloatAsInt")
+set_tests_properties(CucumberExpressionMatchingTest.DoesntMatchFloatAsInt PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesDouble "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesDouble")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesDouble PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesByte "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesByte")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesByte PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesShort "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesShort")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesShort PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesLong "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesLong")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesLong PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesBigInteger "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesBigInteger")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesBigInteger PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesBigDecimal "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesBigDecimal")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesBigDecimal PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesAnonymousParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesAnonymousParameterType")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesAnonymousParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesDoubleQuotedString "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesDoubleQuotedString")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesDoubleQuotedString PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesSingleQuotedString "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesSingleQuotedString")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesSingleQuotedString PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesMultipleDoubleQuotedStrings "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesMultipleDoubleQuotedStrings")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesMultipleDoubleQuotedStrings PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesMultipleSingleQuotedStrings "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesMultipleSingleQuotedStrings")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesMultipleSingleQuotedStrings PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesDoubleQuotedStringWithSingleQuotes "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesDoubleQuotedStringWithSingleQuotes")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesDoubleQuotedStringWithSingleQuotes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesSingleQuotedStringWithDoubleQuotes "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesSingleQuotedStringWithDoubleQuotes")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesSingleQuotedStringWithDoubleQuotes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesDoubleQuotedEmptyString "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesDoubleQuotedEmptyString")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesDoubleQuotedEmptyString PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesSingleQuotedEmptyString "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesSingleQuotedEmptyString")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesSingleQuotedEmptyString PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.DoesNotMatchMisquotedString "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.DoesNotMatchMisquotedString")
+set_tests_properties(CucumberExpressionMatchingTest.DoesNotMatchMisquotedString PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesEscapedParenthesis1 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesEscapedParenthesis1")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesEscapedParenthesis1 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesEscapedSlash "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesEscapedSlash")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesEscapedSlash PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesDoublyEscapedSlash "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesDoublyEscapedSlash")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesDoublyEscapedSlash PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesOptionalInAlternation1 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesOptionalInAlternation1")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesOptionalInAlternation1 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesOptionalInAlternation2 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesOptionalInAlternation2")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesOptionalInAlternation2 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesOptionalInAlternation3 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesOptionalInAlternation3")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesOptionalInAlternation3 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesOptionalBeforeAlternation1 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesOptionalBeforeAlternation1")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesOptionalBeforeAlternation1 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesOptionalBeforeAlternation2 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesOptionalBeforeAlternation2")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesOptionalBeforeAlternation2 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatchesAlternation "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatchesAlternation")
+set_tests_properties(CucumberExpressionMatchingTest.MatchesAlternation PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.AllowsParameterInAlternation1 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.AllowsParameterInAlternation1")
+set_tests_properties(CucumberExpressionMatchingTest.AllowsParameterInAlternation1 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.AllowsParameterInAlternation2 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.AllowsParameterInAlternation2")
+set_tests_properties(CucumberExpressionMatchingTest.AllowsParameterInAlternation2 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.ThrowsUnknownParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.ThrowsUnknownParameterType")
+set_tests_properties(CucumberExpressionMatchingTest.ThrowsUnknownParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.DoesNotAllowUnfinishedParenthesis1 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.DoesNotAllowUnfinishedParenthesis1")
+set_tests_properties(CucumberExpressionMatchingTest.DoesNotAllowUnfinishedParenthesis1 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.DoesNotAllowUnfinishedParenthesis3 "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.DoesNotAllowUnfinishedParenthesis3")
+set_tests_properties(CucumberExpressionMatchingTest.DoesNotAllowUnfinishedParenthesis3 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MultipleParametersInSequence "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MultipleParametersInSequence")
+set_tests_properties(CucumberExpressionMatchingTest.MultipleParametersInSequence PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MultipleParametersAndText "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MultipleParametersAndText")
+set_tests_properties(CucumberExpressionMatchingTest.MultipleParametersAndText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.ParameterWithOptional "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.ParameterWithOptional")
+set_tests_properties(CucumberExpressionMatchingTest.ParameterWithOptional PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.ParameterWithOptionalPlural "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.ParameterWithOptionalPlural")
+set_tests_properties(CucumberExpressionMatchingTest.ParameterWithOptionalPlural PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.ExpressionWithOnlySpaces "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.ExpressionWithOnlySpaces")
+set_tests_properties(CucumberExpressionMatchingTest.ExpressionWithOnlySpaces PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.ParameterNotMatching "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.ParameterNotMatching")
+set_tests_properties(CucumberExpressionMatchingTest.ParameterNotMatching PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.TextCaseSensitive "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.TextCaseSensitive")
+set_tests_properties(CucumberExpressionMatchingTest.TextCaseSensitive PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.WordParameterMatchesNonWhitespace "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.WordParameterMatchesNonWhitespace")
+set_tests_properties(CucumberExpressionMatchingTest.WordParameterMatchesNonWhitespace PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatcherAgreesWithRegex "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatcherAgreesWithRegex")
+set_tests_properties(CucumberExpressionMatchingTest.MatcherAgreesWithRegex PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest.MatcherOnlyForSupportedExpressions "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_filter=CucumberExpressionMatchingTest.MatcherOnlyForSupportedExpressions")
+set_tests_properties(CucumberExpressionMatchingTest.MatcherOnlyForSupportedExpressions PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionMatchingTest "/root/repo/_b_pcre2/tests/CucumberExpressionMatchingTest" "--gtest_output=xml:TEST-CucumberExpressionMatchingTest.xml")
+set_tests_properties(CucumberExpressionMatchingTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;67;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.SimpleLiteralText "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.SimpleLiteralText")
+set_tests_properties(CucumberExpressionpressionTest.SimpleLiteralText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.IntParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.IntParameterType")
+set_tests_properties(CucumberExpressionpressionTest.IntParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.FloatParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.FloatParameterType")
+set_tests_properties(CucumberExpressionpressionTest.FloatParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.WordParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.WordParameterType")
+set_tests_properties(CucumberExpressionpressionTest.WordParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.StringParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.StringParameterType")
+set_tests_properties(CucumberExpressionpressionTest.StringParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.AnonymousParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.AnonymousParameterType")
+set_tests_properties(CucumberExpressionpressionTest.AnonymousParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.OptionalTextSingle "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.OptionalTextSingle")
+set_tests_properties(CucumberExpressionpressionTest.OptionalTextSingle PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.OptionalTextMultiple "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.OptionalTextMultiple")
+set_tests_properties(CucumberExpressionpressionTest.OptionalTextMultiple PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.MultipleParameters "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.MultipleParameters")
+set_tests_properties(CucumberExpressionpressionTest.MultipleParameters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.EscapedBraces "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.EscapedBraces")
+set_tests_properties(CucumberExpressionpressionTest.EscapedBraces PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.EscapedParentheses "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.EscapedParentheses")
+set_tests_properties(CucumberExpressionpressionTest.EscapedParentheses PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.AlternativeText "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.AlternativeText")
+set_tests_properties(CucumberExpressionpressionTest.AlternativeText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.EmptyExpression "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.EmptyExpression")
+set_tests_properties(CucumberExpressionpressionTest.EmptyExpression PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.UnclosedBrace "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.UnclosedBrace")
+set_tests_properties(CucumberExpressionpressionTest.UnclosedBrace PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.UnmatchedClosingBrace "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.UnmatchedClosingBrace")
+set_tests_properties(CucumberExpressionpressionTest.UnmatchedClosingBrace PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.UnclosedParenthesis "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.UnclosedParenthesis")
+set_tests_properties(CucumberExpressionpressionTest.UnclosedParenthesis PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.UnmatchedClosingParenthesis "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.UnmatchedClosingParenthesis")
+set_tests_properties(CucumberExpressionpressionTest.UnmatchedClosingParenthesis PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.UnknownParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.UnknownParameterType")
+set_tests_properties(CucumberExpressionpressionTest.UnknownParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.NestedParameterTypes "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.NestedParameterTypes")
+set_tests_properties(CucumberExpressionpressionTest.NestedParameterTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.AllBuiltInTypes "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.AllBuiltInTypes")
+set_tests_properties(CucumberExpressionpressionTest.AllBuiltInTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.ComplexRealWorldExpression "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.ComplexRealWorldExpression")
+set_tests_properties(CucumberExpressionpressionTest.ComplexRealWorldExpression PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.EscapedForwardSlash "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.EscapedForwardSlash")
+set_tests_properties(CucumberExpressionpressionTest.EscapedForwardSlash PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.MixedOptionalAndParameters "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.MixedOptionalAndParameters")
+set_tests_properties(CucumberExpressionpressionTest.MixedOptionalAndParameters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.LongLiteralText "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.LongLiteralText")
+set_tests_properties(CucumberExpressionpressionTest.LongLiteralText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.NumericCornerCases "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.NumericCornerCases")
+set_tests_properties(CucumberExpressionpressionTest.NumericCornerCases PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.SpecialCharactersInLiterals "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.SpecialCharactersInLiterals")
+set_tests_properties(CucumberExpressionpressionTest.SpecialCharactersInLiterals PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.CompileMatchesTransform "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.CompileMatchesTransform")
+set_tests_properties(CucumberExpressionpressionTest.CompileMatchesTransform PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.ParametersSkipGroupsOfParameterTypes "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.ParametersSkipGroupsOfParameterTypes")
+set_tests_properties(CucumberExpressionpressionTest.ParametersSkipGroupsOfParameterTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionpressionTest.CachedTransformsAgreeAcrossThreads "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_filter=CucumberExpressionpressionTest.CachedTransformsAgreeAcrossThreads")
+set_tests_properties(CucumberExpressionpressionTest.CachedTransformsAgreeAcrossThreads PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTest "/root/repo/_b_pcre2/tests/CucumberExpressionTest" "--gtest_output=xml:TEST-CucumberExpressionTest.xml")
+set_tests_properties(CucumberExpressionTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;68;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.SimpleText "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.SimpleText")
+set_tests_properties(CucumberExpressionTransformationTest.SimpleText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.EmptyExpression "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.EmptyExpression")
+set_tests_properties(CucumberExpressionTransformationTest.EmptyExpression PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.ParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.ParameterType")
+set_tests_properties(CucumberExpressionTransformationTest.ParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.OptionalText "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.OptionalText")
+set_tests_properties(CucumberExpressionTransformationTest.OptionalText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.Alternation "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.Alternation")
+set_tests_properties(CucumberExpressionTransformationTest.Alternation PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.AlternationWithOptional "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.AlternationWithOptional")
+set_tests_properties(CucumberExpressionTransformationTest.AlternationWithOptional PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.AlternationNextToParameterAndOptional "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.AlternationNextToParameterAndOptional")
+set_tests_properties(CucumberExpressionTransformationTest.AlternationNextToParameterAndOptional PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.EscapeRegexCharacters "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.EscapeRegexCharacters")
+set_tests_properties(CucumberExpressionTransformationTest.EscapeRegexCharacters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.UnicodeText "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.UnicodeText")
+set_tests_properties(CucumberExpressionTransformationTest.UnicodeText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.ComplexMixedExpression "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.ComplexMixedExpression")
+set_tests_properties(CucumberExpressionTransformationTest.ComplexMixedExpression PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.MultipleParameters "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.MultipleParameters")
+set_tests_properties(CucumberExpressionTransformationTest.MultipleParameters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.EscapedCharacters "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.EscapedCharacters")
+set_tests_properties(CucumberExpressionTransformationTest.EscapedCharacters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.StringParameterType "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.StringParameterType")
+set_tests_properties(CucumberExpressionTransformationTest.StringParameterType PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.OptionalWithParameters "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.OptionalWithParameters")
+set_tests_properties(CucumberExpressionTransformationTest.OptionalWithParameters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.AlternationPositions "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.AlternationPositions")
+set_tests_properties(CucumberExpressionTransformationTest.AlternationPositions PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.MultipleAlternations "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.MultipleAlternations")
+set_tests_properties(CucumberExpressionTransformationTest.MultipleAlternations PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.AnonymousParameter "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.AnonymousParameter")
+set_tests_properties(CucumberExpressionTransformationTest.AnonymousParameter PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.WhitespacePreserved "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.WhitespacePreserved")
+set_tests_properties(CucumberExpressionTransformationTest.WhitespacePreserved PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.BracketsInLiterals "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.BracketsInLiterals")
+set_tests_properties(CucumberExpressionTransformationTest.BracketsInLiterals PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.PipeInLiterals "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.PipeInLiterals")
+set_tests_properties(CucumberExpressionTransformationTest.PipeInLiterals PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.OptionalInAlternations "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.OptionalInAlternations")
+set_tests_properties(CucumberExpressionTransformationTest.OptionalInAlternations PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.OptionalInAlternationsDifferentOrder "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.OptionalInAlternationsDifferentOrder")
+set_tests_properties(CucumberExpressionTransformationTest.OptionalInAlternationsDifferentOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.OptionalInAlternationsDifferentOrder2 "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.OptionalInAlternationsDifferentOrder2")
+set_tests_properties(CucumberExpressionTransformationTest.OptionalInAlternationsDifferentOrder2 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.TypeInOptional "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.TypeInOptional")
+set_tests_properties(CucumberExpressionTransformationTest.TypeInOptional PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.TypeInOptional2 "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.TypeInOptional2")
+set_tests_properties(CucumberExpressionTransformationTest.TypeInOptional2 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.AllParameterTypesTransformation "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.AllParameterTypesTransformation")
+set_tests_properties(CucumberExpressionTransformationTest.AllParameterTypesTransformation PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.CalcStepTransformation "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.CalcStepTransformation")
+set_tests_properties(CucumberExpressionTransformationTest.CalcStepTransformation PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest.CalcStepTransformation2 "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_filter=CucumberExpressionTransformationTest.CalcStepTransformation2")
+set_tests_properties(CucumberExpressionTransformationTest.CalcStepTransformation2 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CucumberExpressionTransformationTest "/root/repo/_b_pcre2/tests/CucumberExpressionTransformationTest" "--gtest_output=xml:TEST-CucumberExpressionTransformationTest.xml")
+set_tests_properties(CucumberExpressionTransformationTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;69;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.invokeHandlesParametersWithFuncArgs "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.invokeHandlesParametersWithFuncArgs")
+set_tests_properties(CukeCommandsTest.invokeHandlesParametersWithFuncArgs PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.invokeBindsFuncArgsToCucumberExpressionParameters "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.invokeBindsFuncArgsToCucumberExpressionParameters")
+set_tests_properties(CukeCommandsTest.invokeBindsFuncArgsToCucumberExpressionParameters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.invokePassesTransformedCustomParameters "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.invokePassesTransformedCustomParameters")
+set_tests_properties(CukeCommandsTest.invokePassesTransformedCustomParameters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.rejectsFuncArgsNotMatchingCucumberExpressionParameters "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.rejectsFuncArgsNotMatchingCucumberExpressionParameters")
+set_tests_properties(CukeCommandsTest.rejectsFuncArgsNotMatchingCucumberExpressionParameters PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.matchesCorrectly "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.matchesCorrectly")
+set_tests_properties(CukeCommandsTest.matchesCorrectly PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.invokeHandlesParametersWithoutMacro "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.invokeHandlesParametersWithoutMacro")
+set_tests_properties(CukeCommandsTest.invokeHandlesParametersWithoutMacro PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.invokeHandlesParametersWithMacro "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.invokeHandlesParametersWithMacro")
+set_tests_properties(CukeCommandsTest.invokeHandlesParametersWithMacro PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.reusesStepInstancesWhenAsked "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.reusesStepInstancesWhenAsked")
+set_tests_properties(CukeCommandsTest.reusesStepInstancesWhenAsked PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.producesSnippetsEscapingTitle "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.producesSnippetsEscapingTitle")
+set_tests_properties(CukeCommandsTest.producesSnippetsEscapingTitle PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.producesSnippetsForMultilineArguments "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.producesSnippetsForMultilineArguments")
+set_tests_properties(CukeCommandsTest.producesSnippetsForMultilineArguments PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeEngineSnippetsTest.producesASnippetPerDistinctStepName "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeEngineSnippetsTest.producesASnippetPerDistinctStepName")
+set_tests_properties(CukeEngineSnippetsTest.producesASnippetPerDistinctStepName PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.escapesCaractersInRegexes "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.escapesCaractersInRegexes")
+set_tests_properties(CukeCommandsTest.escapesCaractersInRegexes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest.escapesCharactersInCStrings "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_filter=CukeCommandsTest.escapesCharactersInCStrings")
+set_tests_properties(CukeCommandsTest.escapesCharactersInCStrings PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CukeCommandsTest "/root/repo/_b_pcre2/tests/CukeCommandsTest" "--gtest_output=xml:TEST-CukeCommandsTest.xml")
+set_tests_properties(CukeCommandsTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;70;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DurationHistoryTest.averagesDurationsWithEarlierOnes "/root/repo/_b_pcre2/tests/DurationHistoryTest" "--gtest_filter=DurationHistoryTest.averagesDurationsWithEarlierOnes")
+set_tests_properties(DurationHistoryTest.averagesDurationsWithEarlierOnes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;71;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DurationHistoryTest.keysAreStableHashesOfText "/root/repo/_b_pcre2/tests/DurationHistoryTest" "--gtest_filter=DurationHistoryTest.keysAreStableHashesOfText")
+set_tests_properties(DurationHistoryTest.keysAreStableHashesOfText PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;71;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DurationHistoryFileTest.keepsDurationsBetweenRuns "/root/repo/_b_pcre2/tests/DurationHistoryTest" "--gtest_filter=DurationHistoryFileTest.keepsDurationsBetweenRuns")
+set_tests_properties(DurationHistoryFileTest.keepsDurationsBetweenRuns PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;71;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DurationHistoryFileTest.dropsRecordsCutShort "/root/repo/_b_pcre2/tests/DurationHistoryTest" "--gtest_filter=DurationHistoryFileTest.dropsRecordsCutShort")
+set_tests_properties(DurationHistoryFileTest.dropsRecordsCutShort PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;71;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DurationHistoryFileTest.convertsTextScenarioHistories "/root/repo/_b_pcre2/tests/DurationHistoryTest" "--gtest_filter=DurationHistoryFileTest.convertsTextScenarioHistories")
+set_tests_properties(DurationHistoryFileTest.convertsTextScenarioHistories PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;71;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DurationHistoryFileTest.leavesOtherFilesUntouched "/root/repo/_b_pcre2/tests/DurationHistoryTest" "--gtest_filter=DurationHistoryFileTest.leavesOtherFilesUntouched")
+set_tests_properties(DurationHistoryFileTest.leavesOtherFilesUntouched PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;71;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DurationHistoryTest "/root/repo/_b_pcre2/tests/DurationHistoryTest" "--gtest_output=xml:TEST-DurationHistoryTest.xml")
+set_tests_properties(DurationHistoryTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;71;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.compilesEveryScenarioOfAFeature "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.compilesEveryScenarioOfAFeature")
+set_tests_properties(FeatureParserTest.compilesEveryScenarioOfAFeature PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.andAndButTakeThePrecedingKeyword "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.andAndButTakeThePrecedingKeyword")
+set_tests_properties(FeatureParserTest.andAndButTakeThePrecedingKeyword PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.inheritsTagsWithoutTheirAtSign "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.inheritsTagsWithoutTheirAtSign")
+set_tests_properties(FeatureParserTest.inheritsTagsWithoutTheirAtSign PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.prependsTheBackgroundOfFeatureAndRule "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.prependsTheBackgroundOfFeatureAndRule")
+set_tests_properties(FeatureParserTest.prependsTheBackgroundOfFeatureAndRule PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.readsDataTables "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.readsDataTables")
+set_tests_properties(FeatureParserTest.readsDataTables PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.readsDocStringsWithoutTheirIndentation "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.readsDocStringsWithoutTheirIndentation")
+set_tests_properties(FeatureParserTest.readsDocStringsWithoutTheirIndentation PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.decodesStepArgumentsOnlyWhenAsked "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.decodesStepArgumentsOnlyWhenAsked")
+set_tests_properties(FeatureParserTest.decodesStepArgumentsOnlyWhenAsked PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.expandsOutlinesIntoOneScenarioPerExampleRow "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.expandsOutlinesIntoOneScenarioPerExampleRow")
+set_tests_properties(FeatureParserTest.expandsOutlinesIntoOneScenarioPerExampleRow PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.compilesNothingForAnOutlineWithoutExamples "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.compilesNothingForAnOutlineWithoutExamples")
+set_tests_properties(FeatureParserTest.compilesNothingForAnOutlineWithoutExamples PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.reportsTheLineOfMalformedGherkin "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.reportsTheLineOfMalformedGherkin")
+set_tests_properties(FeatureParserTest.reportsTheLineOfMalformedGherkin PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.parsesMappedFiles "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.parsesMappedFiles")
+set_tests_properties(FeatureParserTest.parsesMappedFiles PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.parsesFilesInParallelKeepingTheirOrder "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.parsesFilesInParallelKeepingTheirOrder")
+set_tests_properties(FeatureParserTest.parsesFilesInParallelKeepingTheirOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest.failsForFilesThatCannotBeRead "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_filter=FeatureParserTest.failsForFilesThatCannotBeRead")
+set_tests_properties(FeatureParserTest.failsForFilesThatCannotBeRead PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FeatureParserTest "/root/repo/_b_pcre2/tests/FeatureParserTest" "--gtest_output=xml:TEST-FeatureParserTest.xml")
+set_tests_properties(FeatureParserTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;72;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HardwareCountersTest.subtractsEarlierSamples "/root/repo/_b_pcre2/tests/HardwareCountersTest" "--gtest_filter=HardwareCountersTest.subtractsEarlierSamples")
+set_tests_properties(HardwareCountersTest.subtractsEarlierSamples PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;73;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HardwareCountersTest.recordsAndReportsTheCountsOfSteps "/root/repo/_b_pcre2/tests/HardwareCountersTest" "--gtest_filter=HardwareCountersTest.recordsAndReportsTheCountsOfSteps")
+set_tests_properties(HardwareCountersTest.recordsAndReportsTheCountsOfSteps PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;73;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HardwareCountersTest.countsStepsOnlyWhenEnabled "/root/repo/_b_pcre2/tests/HardwareCountersTest" "--gtest_filter=HardwareCountersTest.countsStepsOnlyWhenEnabled")
+set_tests_properties(HardwareCountersTest.countsStepsOnlyWhenEnabled PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;73;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(HardwareCountersTest "/root/repo/_b_pcre2/tests/HardwareCountersTest" "--gtest_output=xml:TEST-HardwareCountersTest.xml")
+set_tests_properties(HardwareCountersTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;73;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(InvokeArgsTest.fingerprintsArgsAndTables "/root/repo/_b_pcre2/tests/IdempotentStepTest" "--gtest_filter=InvokeArgsTest.fingerprintsArgsAndTables")
+set_tests_properties(InvokeArgsTest.fingerprintsArgsAndTables PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;74;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(IdempotentStepTest.reusesResultsWithinTheFeature "/root/repo/_b_pcre2/tests/IdempotentStepTest" "--gtest_filter=IdempotentStepTest.reusesResultsWithinTheFeature")
+set_tests_properties(IdempotentStepTest.reusesResultsWithinTheFeature PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;74;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(IdempotentStepTest.reusesResultsWithinTheScenarioWithoutFeatures "/root/repo/_b_pcre2/tests/IdempotentStepTest" "--gtest_filter=IdempotentStepTest.reusesResultsWithinTheScenarioWithoutFeatures")
+set_tests_properties(IdempotentStepTest.reusesResultsWithinTheScenarioWithoutFeatures PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;74;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(IdempotentStepTest.runsFailedAndUnmarkedStepsAgain "/root/repo/_b_pcre2/tests/IdempotentStepTest" "--gtest_filter=IdempotentStepTest.runsFailedAndUnmarkedStepsAgain")
+set_tests_properties(IdempotentStepTest.runsFailedAndUnmarkedStepsAgain PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;74;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(IdempotentStepTest "/root/repo/_b_pcre2/tests/IdempotentStepTest" "--gtest_output=xml:TEST-IdempotentStepTest.xml")
+set_tests_properties(IdempotentStepTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;74;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ImpactRecordTest.recordsTheStepDefinitionsInvoked "/root/repo/_b_pcre2/tests/ImpactRecordTest" "--gtest_filter=ImpactRecordTest.recordsTheStepDefinitionsInvoked")
+set_tests_properties(ImpactRecordTest.recordsTheStepDefinitionsInvoked PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;75;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ImpactRecordTest.affectsScenariosUsingAChangedStepDefinitionFile "/root/repo/_b_pcre2/tests/ImpactRecordTest" "--gtest_filter=ImpactRecordTest.affectsScenariosUsingAChangedStepDefinitionFile")
+set_tests_properties(ImpactRecordTest.affectsScenariosUsingAChangedStepDefinitionFile PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;75;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ImpactRecordTest.affectsScenariosOfAChangedFeatureFile "/root/repo/_b_pcre2/tests/ImpactRecordTest" "--gtest_filter=ImpactRecordTest.affectsScenariosOfAChangedFeatureFile")
+set_tests_properties(ImpactRecordTest.affectsScenariosOfAChangedFeatureFile PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;75;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ImpactRecordTest.affectsScenariosThatFailedOrAreNew "/root/repo/_b_pcre2/tests/ImpactRecordTest" "--gtest_filter=ImpactRecordTest.affectsScenariosThatFailedOrAreNew")
+set_tests_properties(ImpactRecordTest.affectsScenariosThatFailedOrAreNew PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;75;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ImpactRecordTest.keepsScenariosThatDidNotRun "/root/repo/_b_pcre2/tests/ImpactRecordTest" "--gtest_filter=ImpactRecordTest.keepsScenariosThatDidNotRun")
+set_tests_properties(ImpactRecordTest.keepsScenariosThatDidNotRun PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;75;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ImpactRecordTest.savesAndLoadsTheRecord "/root/repo/_b_pcre2/tests/ImpactRecordTest" "--gtest_filter=ImpactRecordTest.savesAndLoadsTheRecord")
+set_tests_properties(ImpactRecordTest.savesAndLoadsTheRecord PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;75;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ImpactRecordTest "/root/repo/_b_pcre2/tests/ImpactRecordTest" "--gtest_output=xml:TEST-ImpactRecordTest.xml")
+set_tests_properties(ImpactRecordTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;75;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(JsonStringTest.findsSpecialBytesAtEveryOffsetOfABlock "/root/repo/_b_pcre2/tests/JsonStringTest" "--gtest_filter=JsonStringTest.findsSpecialBytesAtEveryOffsetOfABlock")
+set_tests_properties(JsonStringTest.findsSpecialBytesAtEveryOffsetOfABlock PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;76;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(JsonStringTest.escapesLikeNlohmannJson "/root/repo/_b_pcre2/tests/JsonStringTest" "--gtest_filter=JsonStringTest.escapesLikeNlohmannJson")
+set_tests_properties(JsonStringTest.escapesLikeNlohmannJson PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;76;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(JsonStringTest.rejectsInvalidUtf8 "/root/repo/_b_pcre2/tests/JsonStringTest" "--gtest_filter=JsonStringTest.rejectsInvalidUtf8")
+set_tests_properties(JsonStringTest.rejectsInvalidUtf8 PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;76;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(JsonStringTest "/root/repo/_b_pcre2/tests/JsonStringTest" "--gtest_output=xml:TEST-JsonStringTest.xml")
+set_tests_properties(JsonStringTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;76;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.matchesSimpleRegex "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.matchesSimpleRegex")
+set_tests_properties(RegexTest.matchesSimpleRegex PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.matchesRegexWithoutSubmatches "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.matchesRegexWithoutSubmatches")
+set_tests_properties(RegexTest.matchesRegexWithoutSubmatches PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.matchesRegexWithSubmatches "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.matchesRegexWithSubmatches")
+set_tests_properties(RegexTest.matchesRegexWithSubmatches PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.matchesRegexWithOptionalSubmatches "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.matchesRegexWithOptionalSubmatches")
+set_tests_properties(RegexTest.matchesRegexWithOptionalSubmatches PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findAllDoesNotMatchIfNoTokens "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findAllDoesNotMatchIfNoTokens")
+set_tests_properties(RegexTest.findAllDoesNotMatchIfNoTokens PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findReportsCodepointPositions "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findReportsCodepointPositions")
+set_tests_properties(RegexTest.findReportsCodepointPositions PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findAllExtractsTheFirstGroupOfEveryToken "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findAllExtractsTheFirstGroupOfEveryToken")
+set_tests_properties(RegexTest.findAllExtractsTheFirstGroupOfEveryToken PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findAllHasToMatchTheEntireInput "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findAllHasToMatchTheEntireInput")
+set_tests_properties(RegexTest.findAllHasToMatchTheEntireInput PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.rejectsInvalidRegexWithRegexError "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.rejectsInvalidRegexWithRegexError")
+set_tests_properties(RegexTest.rejectsInvalidRegexWithRegexError PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.copiesShareTheCompiledRegex "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.copiesShareTheCompiledRegex")
+set_tests_properties(RegexTest.copiesShareTheCompiledRegex PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.defersCompilationToFirstUse "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.defersCompilationToFirstUse")
+set_tests_properties(RegexTest.defersCompilationToFirstUse PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findsSubmatchSpansIntoReusedVector "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findsSubmatchSpansIntoReusedVector")
+set_tests_properties(RegexTest.findsSubmatchSpansIntoReusedVector PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findReportsCodepointPositionsOfSubmatchesOutOfOrder "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findReportsCodepointPositionsOfSubmatchesOutOfOrder")
+set_tests_properties(RegexTest.findReportsCodepointPositionsOfSubmatchesOutOfOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findsNoBacktrackingHazardInLinearExpressions "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findsNoBacktrackingHazardInLinearExpressions")
+set_tests_properties(RegexTest.findsNoBacktrackingHazardInLinearExpressions PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findsNestedUnboundedQuantifiers "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findsNestedUnboundedQuantifiers")
+set_tests_properties(RegexTest.findsNestedUnboundedQuantifiers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.findsUnboundedQuantifiersInLookarounds "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.findsUnboundedQuantifiersInLookarounds")
+set_tests_properties(RegexTest.findsUnboundedQuantifiersInLookarounds PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest.matchesExpressionsProneToBacktrackingOnLongInputs "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_filter=RegexTest.matchesExpressionsProneToBacktrackingOnLongInputs")
+set_tests_properties(RegexTest.matchesExpressionsProneToBacktrackingOnLongInputs PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(RegexTest "/root/repo/_b_pcre2/tests/RegexTest" "--gtest_output=xml:TEST-RegexTest.xml")
+set_tests_properties(RegexTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;77;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StartupProfileTest.recordsRegistrationsUntilFinished "/root/repo/_b_pcre2/tests/StartupProfileTest" "--gtest_filter=StartupProfileTest.recordsRegistrationsUntilFinished")
+set_tests_properties(StartupProfileTest.recordsRegistrationsUntilFinished PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;78;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StartupProfileTest "/root/repo/_b_pcre2/tests/StartupProfileTest" "--gtest_output=xml:TEST-StartupProfileTest.xml")
+set_tests_properties(StartupProfileTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;78;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StaticCucumberExpressionTest.transformsAsAtRunTime "/root/repo/_b_pcre2/tests/StaticCucumberExpressionTest" "--gtest_filter=StaticCucumberExpressionTest.transformsAsAtRunTime")
+set_tests_properties(StaticCucumberExpressionTest.transformsAsAtRunTime PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;79;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StaticCucumberExpressionTest.matchesRegularExpressionsWithoutThem "/root/repo/_b_pcre2/tests/StaticCucumberExpressionTest" "--gtest_filter=StaticCucumberExpressionTest.matchesRegularExpressionsWithoutThem")
+set_tests_properties(StaticCucumberExpressionTest.matchesRegularExpressionsWithoutThem PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;79;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StaticCucumberExpressionTest.leavesOtherStepMatchersToRunTime "/root/repo/_b_pcre2/tests/StaticCucumberExpressionTest" "--gtest_filter=StaticCucumberExpressionTest.leavesOtherStepMatchersToRunTime")
+set_tests_properties(StaticCucumberExpressionTest.leavesOtherStepMatchersToRunTime PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;79;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StaticCucumberExpressionTest.rejectsMalformedExpressions "/root/repo/_b_pcre2/tests/StaticCucumberExpressionTest" "--gtest_filter=StaticCucumberExpressionTest.rejectsMalformedExpressions")
+set_tests_properties(StaticCucumberExpressionTest.rejectsMalformedExpressions PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;79;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StaticCucumberExpressionTest.registersStepsTransformedAtCompileTime "/root/repo/_b_pcre2/tests/StaticCucumberExpressionTest" "--gtest_filter=StaticCucumberExpressionTest.registersStepsTransformedAtCompileTime")
+set_tests_properties(StaticCucumberExpressionTest.registersStepsTransformedAtCompileTime PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;79;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StaticCucumberExpressionTest "/root/repo/_b_pcre2/tests/StaticCucumberExpressionTest" "--gtest_output=xml:TEST-StaticCucumberExpressionTest.xml")
+set_tests_properties(StaticCucumberExpressionTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;79;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepBenchmarkSettingsTest.readsIterationsAndLimitsFromTags "/root/repo/_b_pcre2/tests/StepBenchmarkTest" "--gtest_filter=StepBenchmarkSettingsTest.readsIterationsAndLimitsFromTags")
+set_tests_properties(StepBenchmarkSettingsTest.readsIterationsAndLimitsFromTags PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;80;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepBenchmarkSettingsTest.rejectsMalformedTags "/root/repo/_b_pcre2/tests/StepBenchmarkTest" "--gtest_filter=StepBenchmarkSettingsTest.rejectsMalformedTags")
+set_tests_properties(StepBenchmarkSettingsTest.rejectsMalformedTags PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;80;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepBenchmarkSettingsTest.computesStatistics "/root/repo/_b_pcre2/tests/StepBenchmarkTest" "--gtest_filter=StepBenchmarkSettingsTest.computesStatistics")
+set_tests_properties(StepBenchmarkSettingsTest.computesStatistics PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;80;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepBenchmarkTest.benchmarkedStepsRunTheirIterationsAfterWarmingUp "/root/repo/_b_pcre2/tests/StepBenchmarkTest" "--gtest_filter=StepBenchmarkTest.benchmarkedStepsRunTheirIterationsAfterWarmingUp")
+set_tests_properties(StepBenchmarkTest.benchmarkedStepsRunTheirIterationsAfterWarmingUp PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;80;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepBenchmarkTest.benchmarkedStepsFailOverTheirLimits "/root/repo/_b_pcre2/tests/StepBenchmarkTest" "--gtest_filter=StepBenchmarkTest.benchmarkedStepsFailOverTheirLimits")
+set_tests_properties(StepBenchmarkTest.benchmarkedStepsFailOverTheirLimits PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;80;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepBenchmarkTest.benchmarksStopAtTheFirstFailure "/root/repo/_b_pcre2/tests/StepBenchmarkTest" "--gtest_filter=StepBenchmarkTest.benchmarksStopAtTheFirstFailure")
+set_tests_properties(StepBenchmarkTest.benchmarksStopAtTheFirstFailure PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;80;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepBenchmarkTest "/root/repo/_b_pcre2/tests/StepBenchmarkTest" "--gtest_output=xml:TEST-StepBenchmarkTest.xml")
+set_tests_properties(StepBenchmarkTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;80;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepCallChainTest.failsIfNoStep "/root/repo/_b_pcre2/tests/StepCallChainTest" "--gtest_filter=StepCallChainTest.failsIfNoStep")
+set_tests_properties(StepCallChainTest.failsIfNoStep PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;81;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepCallChainTest.stepExecutionReturnsTheExpectedResult "/root/repo/_b_pcre2/tests/StepCallChainTest" "--gtest_filter=StepCallChainTest.stepExecutionReturnsTheExpectedResult")
+set_tests_properties(StepCallChainTest.stepExecutionReturnsTheExpectedResult PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;81;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepCallChainTest.aroundHooksAreInvokedInTheCorrectOrder "/root/repo/_b_pcre2/tests/StepCallChainTest" "--gtest_filter=StepCallChainTest.aroundHooksAreInvokedInTheCorrectOrder")
+set_tests_properties(StepCallChainTest.aroundHooksAreInvokedInTheCorrectOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;81;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepCallChainTest.argsArePassedToTheStep "/root/repo/_b_pcre2/tests/StepCallChainTest" "--gtest_filter=StepCallChainTest.argsArePassedToTheStep")
+set_tests_properties(StepCallChainTest.argsArePassedToTheStep PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;81;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepCallChainTest.aroundHooksCanStopTheCallChain "/root/repo/_b_pcre2/tests/StepCallChainTest" "--gtest_filter=StepCallChainTest.aroundHooksCanStopTheCallChain")
+set_tests_properties(StepCallChainTest.aroundHooksCanStopTheCallChain PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;81;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepCallChainTest.longChainsOfAroundHooksRunTheStepOnce "/root/repo/_b_pcre2/tests/StepCallChainTest" "--gtest_filter=StepCallChainTest.longChainsOfAroundHooksRunTheStepOnce")
+set_tests_properties(StepCallChainTest.longChainsOfAroundHooksRunTheStepOnce PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;81;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepCallChainTest "/root/repo/_b_pcre2/tests/StepCallChainTest" "--gtest_output=xml:TEST-StepCallChainTest.xml")
+set_tests_properties(StepCallChainTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;81;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.extractsLiteralPrefixOfAnchoredRegexes "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.extractsLiteralPrefixOfAnchoredRegexes")
+set_tests_properties(StepIndexTest.extractsLiteralPrefixOfAnchoredRegexes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.extractsLiteralPrefixOfUnanchoredRegexes "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.extractsLiteralPrefixOfUnanchoredRegexes")
+set_tests_properties(StepIndexTest.extractsLiteralPrefixOfUnanchoredRegexes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.stopsAtCharactersMadeOptionalByQuantifiers "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.stopsAtCharactersMadeOptionalByQuantifiers")
+set_tests_properties(StepIndexTest.stopsAtCharactersMadeOptionalByQuantifiers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.keepsEscapedPunctuationButNotCharacterClasses "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.keepsEscapedPunctuationButNotCharacterClasses")
+set_tests_properties(StepIndexTest.keepsEscapedPunctuationButNotCharacterClasses PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.ignoresPrefixOfTopLevelAlternations "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.ignoresPrefixOfTopLevelAlternations")
+set_tests_properties(StepIndexTest.ignoresPrefixOfTopLevelAlternations PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.returnsCandidatesWhosePrefixFits "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.returnsCandidatesWhosePrefixFits")
+set_tests_properties(StepIndexTest.returnsCandidatesWhosePrefixFits PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.returnsCandidatesForDescriptionsStartingWithAPrefix "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.returnsCandidatesForDescriptionsStartingWithAPrefix")
+set_tests_properties(StepIndexTest.returnsCandidatesForDescriptionsStartingWithAPrefix PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.returnsCandidatesInIdOrder "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.returnsCandidatesInIdOrder")
+set_tests_properties(StepIndexTest.returnsCandidatesInIdOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.hasNoCandidatesOnceCleared "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.hasNoCandidatesOnceCleared")
+set_tests_properties(StepIndexTest.hasNoCandidatesOnceCleared PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.extractsRequiredLiteralsOutsideOfGroups "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.extractsRequiredLiteralsOutsideOfGroups")
+set_tests_properties(StepIndexTest.extractsRequiredLiteralsOutsideOfGroups PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.skipsTheBoundsOfBraceQuantifiers "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.skipsTheBoundsOfBraceQuantifiers")
+set_tests_properties(StepIndexTest.skipsTheBoundsOfBraceQuantifiers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.returnsCandidatesOfStepsWithBraceQuantifiers "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.returnsCandidatesOfStepsWithBraceQuantifiers")
+set_tests_properties(StepIndexTest.returnsCandidatesOfStepsWithBraceQuantifiers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.automatonFindsAllLiteralsInOnePass "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.automatonFindsAllLiteralsInOnePass")
+set_tests_properties(StepIndexTest.automatonFindsAllLiteralsInOnePass PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.automatonTakesLiteralsAddedOnceBuilt "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.automatonTakesLiteralsAddedOnceBuilt")
+set_tests_properties(StepIndexTest.automatonTakesLiteralsAddedOnceBuilt PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.returnsCandidatesContainingAllRequiredLiterals "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.returnsCandidatesContainingAllRequiredLiterals")
+set_tests_properties(StepIndexTest.returnsCandidatesContainingAllRequiredLiterals PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.knowsStepsWhosePrefixNoOtherOneStartsOrContinues "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.knowsStepsWhosePrefixNoOtherOneStartsOrContinues")
+set_tests_properties(StepIndexTest.knowsStepsWhosePrefixNoOtherOneStartsOrContinues PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest.knowsNoStepUnambiguousNextToUnanchoredOnes "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_filter=StepIndexTest.knowsNoStepUnambiguousNextToUnanchoredOnes")
+set_tests_properties(StepIndexTest.knowsNoStepUnambiguousNextToUnanchoredOnes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepIndexTest "/root/repo/_b_pcre2/tests/StepIndexTest" "--gtest_output=xml:TEST-StepIndexTest.xml")
+set_tests_properties(StepIndexTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;82;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepLibraryTest.loadsEachLibraryOnce "/root/repo/_b_pcre2/tests/StepLibraryTest" "--gtest_filter=StepLibraryTest.loadsEachLibraryOnce")
+set_tests_properties(StepLibraryTest.loadsEachLibraryOnce PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;84;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepLibraryTest.failsForLibrariesThatCannotBeLoaded "/root/repo/_b_pcre2/tests/StepLibraryTest" "--gtest_filter=StepLibraryTest.failsForLibrariesThatCannotBeLoaded")
+set_tests_properties(StepLibraryTest.failsForLibrariesThatCannotBeLoaded PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;84;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepLibraryTest "/root/repo/_b_pcre2/tests/StepLibraryTest" "--gtest_output=xml:TEST-StepLibraryTest.xml")
+set_tests_properties(StepLibraryTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;84;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.holdsNonConflictingSteps "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.holdsNonConflictingSteps")
+set_tests_properties(StepManagerTest.holdsNonConflictingSteps PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.holdsConflictingSteps "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.holdsConflictingSteps")
+set_tests_properties(StepManagerTest.holdsConflictingSteps PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.looksUpStepsById "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.looksUpStepsById")
+set_tests_properties(StepManagerTest.looksUpStepsById PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.registersStepsInBulk "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.registersStepsInBulk")
+set_tests_properties(StepManagerTest.registersStepsInBulk PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesStepsWithNonRegExMatchers "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesStepsWithNonRegExMatchers")
+set_tests_properties(StepManagerTest.matchesStepsWithNonRegExMatchers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesStepsWithRegExMatchers "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesStepsWithRegExMatchers")
+set_tests_properties(StepManagerTest.matchesStepsWithRegExMatchers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.extractsParamsFromRegExMatchers "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.extractsParamsFromRegExMatchers")
+set_tests_properties(StepManagerTest.extractsParamsFromRegExMatchers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.handlesMultipleMatches "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.handlesMultipleMatches")
+set_tests_properties(StepManagerTest.handlesMultipleMatches PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesStepsWithNonAsciiMatchers "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesStepsWithNonAsciiMatchers")
+set_tests_properties(StepManagerTest.matchesStepsWithNonAsciiMatchers PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.cachesMatchResults "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.cachesMatchResults")
+set_tests_properties(StepManagerTest.cachesMatchResults PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.cachedMatchesKeepExtractedParams "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.cachedMatchesKeepExtractedParams")
+set_tests_properties(StepManagerTest.cachedMatchesKeepExtractedParams PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.invalidatesCachedMatchesWhenStepsAreAdded "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.invalidatesCachedMatchesWhenStepsAreAdded")
+set_tests_properties(StepManagerTest.invalidatesCachedMatchesWhenStepsAreAdded PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesStepsWithMultiPatternIndex "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesStepsWithMultiPatternIndex")
+set_tests_properties(StepManagerTest.matchesStepsWithMultiPatternIndex PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.compilesLazyStepsOnFirstMatch "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.compilesLazyStepsOnFirstMatch")
+set_tests_properties(StepManagerTest.compilesLazyStepsOnFirstMatch PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.reportsInvalidLazyStepsWhenMatching "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.reportsInvalidLazyStepsWhenMatching")
+set_tests_properties(StepManagerTest.reportsInvalidLazyStepsWhenMatching PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesInParallelInRegistrationOrder "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesInParallelInRegistrationOrder")
+set_tests_properties(StepManagerTest.matchesInParallelInRegistrationOrder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesWhileStepsAreRegistered "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesWhileStepsAreRegistered")
+set_tests_properties(StepManagerTest.matchesWhileStepsAreRegistered PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesIntoReusableBuffer "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesIntoReusableBuffer")
+set_tests_properties(StepManagerTest.matchesIntoReusableBuffer PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesOutlineRowsLikeSeparateSteps "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesOutlineRowsLikeSeparateSteps")
+set_tests_properties(StepManagerTest.matchesOutlineRowsLikeSeparateSteps PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.matchesOutlineRowsStartingWithAPlaceholder "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.matchesOutlineRowsStartingWithAPlaceholder")
+set_tests_properties(StepManagerTest.matchesOutlineRowsStartingWithAPlaceholder PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.findsAmbiguousStepsWhenRegistered "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.findsAmbiguousStepsWhenRegistered")
+set_tests_properties(StepManagerTest.findsAmbiguousStepsWhenRegistered PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.stopsAtTheFirstMatchWhenAskedTo "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.stopsAtTheFirstMatchWhenAskedTo")
+set_tests_properties(StepManagerTest.stopsAtTheFirstMatchWhenAskedTo PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.triesTheMostMatchedStepsFirst "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.triesTheMostMatchedStepsFirst")
+set_tests_properties(StepManagerTest.triesTheMostMatchedStepsFirst PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest.reportsStepsProneToBacktracking "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StepManagerTest.reportsStepsProneToBacktracking")
+set_tests_properties(StepManagerTest.reportsStepsProneToBacktracking PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringConversionTest/*.convertsNumbersLikeStreams "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StringConversionTest/*.convertsNumbersLikeStreams")
+set_tests_properties(StringConversionTest/*.convertsNumbersLikeStreams PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringConversionTest/*.formatsNumbersLikeStreams "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=StringConversionTest/*.formatsNumbersLikeStreams")
+set_tests_properties(StringConversionTest/*.formatsNumbersLikeStreams PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(InvokeArgsTest.viewsArgumentsWhereTheyAreKept "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=InvokeArgsTest.viewsArgumentsWhereTheyAreKept")
+set_tests_properties(InvokeArgsTest.viewsArgumentsWhereTheyAreKept PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(InvokeArgsTest.buildsTheTableWhenFirstAskedFor "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=InvokeArgsTest.buildsTheTableWhenFirstAskedFor")
+set_tests_properties(InvokeArgsTest.buildsTheTableWhenFirstAskedFor PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(InvokeArgsTest.rejectsTablesWithUnevenRowsUpFront "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_filter=InvokeArgsTest.rejectsTablesWithUnevenRowsUpFront")
+set_tests_properties(InvokeArgsTest.rejectsTablesWithUnevenRowsUpFront PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepManagerTest "/root/repo/_b_pcre2/tests/StepManagerTest" "--gtest_output=xml:TEST-StepManagerTest.xml")
+set_tests_properties(StepManagerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;89;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepSnapshotTest.capturesStepsWithoutCustomParameterTypes "/root/repo/_b_pcre2/tests/StepSnapshotTest" "--gtest_filter=StepSnapshotTest.capturesStepsWithoutCustomParameterTypes")
+set_tests_properties(StepSnapshotTest.capturesStepsWithoutCustomParameterTypes PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;90;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepSnapshotTest.readsWhatItWrote "/root/repo/_b_pcre2/tests/StepSnapshotTest" "--gtest_filter=StepSnapshotTest.readsWhatItWrote")
+set_tests_properties(StepSnapshotTest.readsWhatItWrote PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;90;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepSnapshotTest.registersStepsFromTheLoadedSnapshot "/root/repo/_b_pcre2/tests/StepSnapshotTest" "--gtest_filter=StepSnapshotTest.registersStepsFromTheLoadedSnapshot")
+set_tests_properties(StepSnapshotTest.registersStepsFromTheLoadedSnapshot PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;90;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepSnapshotTest "/root/repo/_b_pcre2/tests/StepSnapshotTest" "--gtest_output=xml:TEST-StepSnapshotTest.xml")
+set_tests_properties(StepSnapshotTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;90;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioTimeoutsTest.readsBudgetsFromTags "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=ScenarioTimeoutsTest.readsBudgetsFromTags")
+set_tests_properties(ScenarioTimeoutsTest.readsBudgetsFromTags PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ScenarioTimeoutsTest.parsesDurations "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=ScenarioTimeoutsTest.parsesDurations")
+set_tests_properties(ScenarioTimeoutsTest.parsesDurations PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepTimeoutsTest.stepsWithinTheirBudgetSucceed "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=StepTimeoutsTest.stepsWithinTheirBudgetSucceed")
+set_tests_properties(StepTimeoutsTest.stepsWithinTheirBudgetSucceed PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepTimeoutsTest.stepsOverrunningTheirBudgetFail "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=StepTimeoutsTest.stepsOverrunningTheirBudgetFail")
+set_tests_properties(StepTimeoutsTest.stepsOverrunningTheirBudgetFail PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepTimeoutsTest.stepsOverrunningTheirBudgetShareTheirArgs "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=StepTimeoutsTest.stepsOverrunningTheirBudgetShareTheirArgs")
+set_tests_properties(StepTimeoutsTest.stepsOverrunningTheirBudgetShareTheirArgs PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepTimeoutsTest.stepsFailOnceTheScenarioBudgetIsSpent "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=StepTimeoutsTest.stepsFailOnceTheScenarioBudgetIsSpent")
+set_tests_properties(StepTimeoutsTest.stepsFailOnceTheScenarioBudgetIsSpent PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepTimeoutsTest.stepFailuresAreReportedWithinTheirBudget "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=StepTimeoutsTest.stepFailuresAreReportedWithinTheirBudget")
+set_tests_properties(StepTimeoutsTest.stepFailuresAreReportedWithinTheirBudget PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepTimeoutsTest.budgetsCanBeSetByHooks "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_filter=StepTimeoutsTest.budgetsCanBeSetByHooks")
+set_tests_properties(StepTimeoutsTest.budgetsCanBeSetByHooks PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StepTimeoutsTest "/root/repo/_b_pcre2/tests/StepTimeoutsTest" "--gtest_output=xml:TEST-StepTimeoutsTest.xml")
+set_tests_properties(StepTimeoutsTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;91;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringPoolTest.storesEachDistinctStringOnce "/root/repo/_b_pcre2/tests/StringPoolTest" "--gtest_filter=StringPoolTest.storesEachDistinctStringOnce")
+set_tests_properties(StringPoolTest.storesEachDistinctStringOnce PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;92;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringPoolTest.storesStringsBackToBack "/root/repo/_b_pcre2/tests/StringPoolTest" "--gtest_filter=StringPoolTest.storesStringsBackToBack")
+set_tests_properties(StringPoolTest.storesStringsBackToBack PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;92;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringPoolTest.keepsLongStringsApart "/root/repo/_b_pcre2/tests/StringPoolTest" "--gtest_filter=StringPoolTest.keepsLongStringsApart")
+set_tests_properties(StringPoolTest.keepsLongStringsApart PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;92;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringPoolTest "/root/repo/_b_pcre2/tests/StringPoolTest" "--gtest_output=xml:TEST-StringPoolTest.xml")
+set_tests_properties(StringPoolTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;92;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.forbidsRowsNotMatchingTableColumnsSize "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.forbidsRowsNotMatchingTableColumnsSize")
+set_tests_properties(TableTest.forbidsRowsNotMatchingTableColumnsSize PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.rowsCannotBeAddedBeforeColumnsAreSet "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.rowsCannotBeAddedBeforeColumnsAreSet")
+set_tests_properties(TableTest.rowsCannotBeAddedBeforeColumnsAreSet PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.columnsCannotBeChangesAfterRowsAreAdded "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.columnsCannotBeChangesAfterRowsAreAdded")
+set_tests_properties(TableTest.columnsCannotBeChangesAfterRowsAreAdded PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.addedRowsMatchColumnDefinition "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.addedRowsMatchColumnDefinition")
+set_tests_properties(TableTest.addedRowsMatchColumnDefinition PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.cellsAreAccessibleByRowAndColumn "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.cellsAreAccessibleByRowAndColumn")
+set_tests_properties(TableTest.cellsAreAccessibleByRowAndColumn PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.hashesIncludeRowsAddedAfterTheyWereBuilt "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.hashesIncludeRowsAddedAfterTheyWereBuilt")
+set_tests_properties(TableTest.hashesIncludeRowsAddedAfterTheyWereBuilt PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.hashesAreBuiltOnceForThreadsAskingAtOnce "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.hashesAreBuiltOnceForThreadsAskingAtOnce")
+set_tests_properties(TableTest.hashesAreBuiltOnceForThreadsAskingAtOnce PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.copiesBuildHashesOfTheirOwn "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.copiesBuildHashesOfTheirOwn")
+set_tests_properties(TableTest.copiesBuildHashesOfTheirOwn PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.convertsNumericColumnsOnce "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.convertsNumericColumnsOnce")
+set_tests_properties(TableTest.convertsNumericColumnsOnce PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.convertsCellsAsStepArgumentsAreConverted "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.convertsCellsAsStepArgumentsAreConverted")
+set_tests_properties(TableTest.convertsCellsAsStepArgumentsAreConverted PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.typedColumnsAreConvertedOnceForThreadsAskingAtOnce "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.typedColumnsAreConvertedOnceForThreadsAskingAtOnce")
+set_tests_properties(TableTest.typedColumnsAreConvertedOnceForThreadsAskingAtOnce PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.typedColumnsIncludeRowsAddedAfterTheyWereConverted "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.typedColumnsIncludeRowsAddedAfterTheyWereConverted")
+set_tests_properties(TableTest.typedColumnsIncludeRowsAddedAfterTheyWereConverted PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest.rowsAreViewedWhereTheyAreStored "/root/repo/_b_pcre2/tests/TableTest" "--gtest_filter=TableTest.rowsAreViewedWhereTheyAreStored")
+set_tests_properties(TableTest.rowsAreViewedWhereTheyAreStored PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TableTest "/root/repo/_b_pcre2/tests/TableTest" "--gtest_output=xml:TEST-TableTest.xml")
+set_tests_properties(TableTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;93;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.emptyOrExpressionMatchesNoTag "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.emptyOrExpressionMatchesNoTag")
+set_tests_properties(TagTest.emptyOrExpressionMatchesNoTag PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.orExpressionsMatchTheTagSpecified "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.orExpressionsMatchTheTagSpecified")
+set_tests_properties(TagTest.orExpressionsMatchTheTagSpecified PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.orExpressionsMatchAnyTagSpecified "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.orExpressionsMatchAnyTagSpecified")
+set_tests_properties(TagTest.orExpressionsMatchAnyTagSpecified PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.orExpressionsAllowSpaces "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.orExpressionsAllowSpaces")
+set_tests_properties(TagTest.orExpressionsAllowSpaces PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.emptyAndExpressionMatchesAnyTag "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.emptyAndExpressionMatchesAnyTag")
+set_tests_properties(TagTest.emptyAndExpressionMatchesAnyTag PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.singleAndExpressionMatchesTheTagSpecified "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.singleAndExpressionMatchesTheTagSpecified")
+set_tests_properties(TagTest.singleAndExpressionMatchesTheTagSpecified PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.andExpressionsMatchEveryTagSpecified "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.andExpressionsMatchEveryTagSpecified")
+set_tests_properties(TagTest.andExpressionsMatchEveryTagSpecified PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.andExpressionsAllowSpaces "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.andExpressionsAllowSpaces")
+set_tests_properties(TagTest.andExpressionsAllowSpaces PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.compositeTagExpressionsAreHandled "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.compositeTagExpressionsAreHandled")
+set_tests_properties(TagTest.compositeTagExpressionsAreHandled PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.tagSetsOnlyHoldTagsKnownToSomeExpression "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.tagSetsOnlyHoldTagsKnownToSomeExpression")
+set_tests_properties(TagTest.tagSetsOnlyHoldTagsKnownToSomeExpression PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.tagSetsSpanSeveralWords "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.tagSetsSpanSeveralWords")
+set_tests_properties(TagTest.tagSetsSpanSeveralWords PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.emptyBooleanExpressionMatchesAnyTag "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.emptyBooleanExpressionMatchesAnyTag")
+set_tests_properties(TagTest.emptyBooleanExpressionMatchesAnyTag PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.booleanExpressionsCombineTags "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.booleanExpressionsCombineTags")
+set_tests_properties(TagTest.booleanExpressionsCombineTags PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.booleanExpressionsBindNotTighterThanAndTighterThanOr "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.booleanExpressionsBindNotTighterThanAndTighterThanOr")
+set_tests_properties(TagTest.booleanExpressionsBindNotTighterThanAndTighterThanOr PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.booleanExpressionsAllowNesting "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.booleanExpressionsAllowNesting")
+set_tests_properties(TagTest.booleanExpressionsAllowNesting PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.malformedBooleanExpressionsAreRejected "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.malformedBooleanExpressionsAreRejected")
+set_tests_properties(TagTest.malformedBooleanExpressionsAreRejected PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest.hookNotationAcceptsLegacyAndBooleanArguments "/root/repo/_b_pcre2/tests/TagTest" "--gtest_filter=TagTest.hookNotationAcceptsLegacyAndBooleanArguments")
+set_tests_properties(TagTest.hookNotationAcceptsLegacyAndBooleanArguments PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TagTest "/root/repo/_b_pcre2/tests/TagTest" "--gtest_output=xml:TEST-TagTest.xml")
+set_tests_properties(TagTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;94;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ThreadPoolTest.returnsTaskResults "/root/repo/_b_pcre2/tests/ThreadPoolTest" "--gtest_filter=ThreadPoolTest.returnsTaskResults")
+set_tests_properties(ThreadPoolTest.returnsTaskResults PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;95;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ThreadPoolTest.forwardsTaskExceptions "/root/repo/_b_pcre2/tests/ThreadPoolTest" "--gtest_filter=ThreadPoolTest.forwardsTaskExceptions")
+set_tests_properties(ThreadPoolTest.forwardsTaskExceptions PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;95;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ThreadPoolTest.runsPendingTasksBeforeDestruction "/root/repo/_b_pcre2/tests/ThreadPoolTest" "--gtest_filter=ThreadPoolTest.runsPendingTasksBeforeDestruction")
+set_tests_properties(ThreadPoolTest.runsPendingTasksBeforeDestruction PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;95;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ThreadPoolTest "/root/repo/_b_pcre2/tests/ThreadPoolTest" "--gtest_output=xml:TEST-ThreadPoolTest.xml")
+set_tests_properties(ThreadPoolTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;95;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TimingsTest.bucketsKeepValuesWithinTheirPrecision "/root/repo/_b_pcre2/tests/TimingsTest" "--gtest_filter=TimingsTest.bucketsKeepValuesWithinTheirPrecision")
+set_tests_properties(TimingsTest.bucketsKeepValuesWithinTheirPrecision PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;96;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TimingsTest.histogramsReportPercentilesAndExactCountTotalAndMax "/root/repo/_b_pcre2/tests/TimingsTest" "--gtest_filter=TimingsTest.histogramsReportPercentilesAndExactCountTotalAndMax")
+set_tests_properties(TimingsTest.histogramsReportPercentilesAndExactCountTotalAndMax PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;96;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TimingsTest.mergesTheTimingsOfEveryThread "/root/repo/_b_pcre2/tests/TimingsTest" "--gtest_filter=TimingsTest.mergesTheTimingsOfEveryThread")
+set_tests_properties(TimingsTest.mergesTheTimingsOfEveryThread PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;96;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TimingsTest "/root/repo/_b_pcre2/tests/TimingsTest" "--gtest_output=xml:TEST-TimingsTest.xml")
+set_tests_properties(TimingsTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;96;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.parsesW3CTraceParents "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.parsesW3CTraceParents")
+set_tests_properties(TelemetryTest.parsesW3CTraceParents PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.rejectsMalformedTraceParents "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.rejectsMalformedTraceParents")
+set_tests_properties(TelemetryTest.rejectsMalformedTraceParents PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.startsSpansInTheTraceOfTheirParent "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.startsSpansInTheTraceOfTheirParent")
+set_tests_properties(TelemetryTest.startsSpansInTheTraceOfTheirParent PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.encodesSpansAsOtlpJson "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.encodesSpansAsOtlpJson")
+set_tests_properties(TelemetryTest.encodesSpansAsOtlpJson PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.exportsQueuedSpansInBatchesWhenFlushed "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.exportsQueuedSpansInBatchesWhenFlushed")
+set_tests_properties(TelemetryTest.exportsQueuedSpansInBatchesWhenFlushed PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.dropsSpansEndingWhileTheQueueIsFull "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.dropsSpansEndingWhileTheQueueIsFull")
+set_tests_properties(TelemetryTest.dropsSpansEndingWhileTheQueueIsFull PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.countsFailedExports "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.countsFailedExports")
+set_tests_properties(TelemetryTest.countsFailedExports PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest.exposesTheSpanOfTheRunningStep "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_filter=TelemetryTest.exposesTheSpanOfTheRunningStep")
+set_tests_properties(TelemetryTest.exposesTheSpanOfTheRunningStep PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TelemetryTest "/root/repo/_b_pcre2/tests/TelemetryTest" "--gtest_output=xml:TEST-TelemetryTest.xml")
+set_tests_properties(TelemetryTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;97;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TraceRecorderTest.recordsTheEventsOfEveryThreadWhileEnabled "/root/repo/_b_pcre2/tests/TraceRecorderTest" "--gtest_filter=TraceRecorderTest.recordsTheEventsOfEveryThreadWhileEnabled")
+set_tests_properties(TraceRecorderTest.recordsTheEventsOfEveryThreadWhileEnabled PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;98;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TraceRecorderTest.writesCompleteEventsInTheChromeTraceFormat "/root/repo/_b_pcre2/tests/TraceRecorderTest" "--gtest_filter=TraceRecorderTest.writesCompleteEventsInTheChromeTraceFormat")
+set_tests_properties(TraceRecorderTest.writesCompleteEventsInTheChromeTraceFormat PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;98;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(TraceRecorderTest "/root/repo/_b_pcre2/tests/TraceRecorderTest" "--gtest_output=xml:TEST-TraceRecorderTest.xml")
+set_tests_properties(TraceRecorderTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;98;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest.readsNamesAndDependenciesFromTheMacroArguments "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_filter=UnconditionalHookTest.readsNamesAndDependenciesFromTheMacroArguments")
+set_tests_properties(UnconditionalHookTest.readsNamesAndDependenciesFromTheMacroArguments PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest.runsIndependentHooksConcurrently "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_filter=UnconditionalHookTest.runsIndependentHooksConcurrently")
+set_tests_properties(UnconditionalHookTest.runsIndependentHooksConcurrently PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest.runsHooksOnceTheirDependenciesRan "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_filter=UnconditionalHookTest.runsHooksOnceTheirDependenciesRan")
+set_tests_properties(UnconditionalHookTest.runsHooksOnceTheirDependenciesRan PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest.runsUnnamedHooksAlone "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_filter=UnconditionalHookTest.runsUnnamedHooksAlone")
+set_tests_properties(UnconditionalHookTest.runsUnnamedHooksAlone PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest.joinsTheErrorsOfFailedHooks "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_filter=UnconditionalHookTest.joinsTheErrorsOfFailedHooks")
+set_tests_properties(UnconditionalHookTest.joinsTheErrorsOfFailedHooks PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest.rethrowsTheErrorOfASingleFailedHook "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_filter=UnconditionalHookTest.rethrowsTheErrorOfASingleFailedHook")
+set_tests_properties(UnconditionalHookTest.rethrowsTheErrorOfASingleFailedHook PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest.rejectsInvalidDependenciesBeforeRunningAnyHook "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_filter=UnconditionalHookTest.rejectsInvalidDependenciesBeforeRunningAnyHook")
+set_tests_properties(UnconditionalHookTest.rejectsInvalidDependenciesBeforeRunningAnyHook PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(UnconditionalHookTest "/root/repo/_b_pcre2/tests/UnconditionalHookTest" "--gtest_output=xml:TEST-UnconditionalHookTest.xml")
+set_tests_properties(UnconditionalHookTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;99;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WatchdogTest.callsBackOnceExpired "/root/repo/_b_pcre2/tests/WatchdogTest" "--gtest_filter=WatchdogTest.callsBackOnceExpired")
+set_tests_properties(WatchdogTest.callsBackOnceExpired PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;100;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WatchdogTest.expiresTimersBeyondATurnOfTheWheel "/root/repo/_b_pcre2/tests/WatchdogTest" "--gtest_filter=WatchdogTest.expiresTimersBeyondATurnOfTheWheel")
+set_tests_properties(WatchdogTest.expiresTimersBeyondATurnOfTheWheel PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;100;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WatchdogTest.disarmedTimersDoNotCallBack "/root/repo/_b_pcre2/tests/WatchdogTest" "--gtest_filter=WatchdogTest.disarmedTimersDoNotCallBack")
+set_tests_properties(WatchdogTest.disarmedTimersDoNotCallBack PROPERTIES  _BACKTRACE_TRIPLES "/usr/share/cmake-3.25/Modules/GoogleTest.cmake;402;add_test;/root/repo/tests/CMakeLists.txt;29;gtest_add_tests;/root/repo/tests/CMakeLists.txt;100;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(WatchdogTest "/root/repo/_b_pcre2/tests/WatchdogTest" "--gtest_output=xml:TEST-WatchdogTest.xml")
+set_tests_properties(WatchdogTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;100;cuke_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(GTestDriverTest "/root/repo/_b_pcre2/tests/GTestDriverTest")
+set_tests_properties(GTestDriverTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;20;add_test;/root/repo/tests/CMakeLists.txt;104;cuke_add_driver_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(GenericDriverTest "/root/repo/_b_pcre2/tests/GenericDriverTest")
+set_tests_properties(GenericDriverTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;20;add_test;/root/repo/tests/CMakeLists.txt;118;cuke_add_driver_test;/root/repo/tests/CMakeLists.txt;0;")
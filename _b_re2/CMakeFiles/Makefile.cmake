@@ -0,0 +1,180 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfig.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfigVersion.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/modules/FindRE2.cmake"
+  "/root/repo/cmake/modules/GitVersion.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/integration/ContextHandlingTest.cpp"
+  "/root/repo/tests/integration/CoroutineStepTest.cpp"
+  "/root/repo/tests/integration/CustomParameterTypesIntegrationTest.cpp"
+  "/root/repo/tests/integration/HookRegistrationTest.cpp"
+  "/root/repo/tests/integration/ScenarioRunnerTest.cpp"
+  "/root/repo/tests/integration/SharedMemoryServerTest.cpp"
+  "/root/repo/tests/integration/StepRegistrationTest.cpp"
+  "/root/repo/tests/integration/TaggedHookRegistrationTest.cpp"
+  "/root/repo/tests/integration/WireCoordinatorTest.cpp"
+  "/root/repo/tests/integration/WireProtocolTest.cpp"
+  "/root/repo/tests/integration/WireSessionTest.cpp"
+  "/root/repo/tests/integration/WireTranscriptTest.cpp"
+  "/root/repo/tests/unit/AllocationTrackingTest.cpp"
+  "/root/repo/tests/unit/BasicStepTest.cpp"
+  "/root/repo/tests/unit/ContextManagerTest.cpp"
+  "/root/repo/tests/unit/CpuAffinityTest.cpp"
+  "/root/repo/tests/unit/CucumberExpressionCustomTypesTest.cpp"
+  "/root/repo/tests/unit/CucumberExpressionErrorsTest.cpp"
+  "/root/repo/tests/unit/CucumberExpressionMatchingTest.cpp"
+  "/root/repo/tests/unit/CucumberExpressionTest.cpp"
+  "/root/repo/tests/unit/CucumberExpressionTransformationTest.cpp"
+  "/root/repo/tests/unit/CukeCommandsTest.cpp"
+  "/root/repo/tests/unit/DurationHistoryTest.cpp"
+  "/root/repo/tests/unit/FeatureParserTest.cpp"
+  "/root/repo/tests/unit/HardwareCountersTest.cpp"
+  "/root/repo/tests/unit/IdempotentStepTest.cpp"
+  "/root/repo/tests/unit/ImpactRecordTest.cpp"
+  "/root/repo/tests/unit/JsonStringTest.cpp"
+  "/root/repo/tests/unit/RegexTest.cpp"
+  "/root/repo/tests/unit/StartupProfileTest.cpp"
+  "/root/repo/tests/unit/StaticCucumberExpressionTest.cpp"
+  "/root/repo/tests/unit/StepBenchmarkTest.cpp"
+  "/root/repo/tests/unit/StepCallChainTest.cpp"
+  "/root/repo/tests/unit/StepIndexTest.cpp"
+  "/root/repo/tests/unit/StepLibraryTest.cpp"
+  "/root/repo/tests/unit/StepManagerTest.cpp"
+  "/root/repo/tests/unit/StepSnapshotTest.cpp"
+  "/root/repo/tests/unit/StepTimeoutsTest.cpp"
+  "/root/repo/tests/unit/StringPoolTest.cpp"
+  "/root/repo/tests/unit/TableTest.cpp"
+  "/root/repo/tests/unit/TagTest.cpp"
+  "/root/repo/tests/unit/TelemetryTest.cpp"
+  "/root/repo/tests/unit/ThreadPoolTest.cpp"
+  "/root/repo/tests/unit/TimingsTest.cpp"
+  "/root/repo/tests/unit/TraceRecorderTest.cpp"
+  "/root/repo/tests/unit/UnconditionalHookTest.cpp"
+  "/root/repo/tests/unit/WatchdogTest.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cucumber-cpp/internal/CukeExport.hpp"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/cucumber-cpp-internal.dir/DependInfo.cmake"
+  "src/CMakeFiles/cucumber-cpp.dir/DependInfo.cmake"
+  "src/CMakeFiles/cucumber-cpp-runner.dir/DependInfo.cmake"
+  "tests/CMakeFiles/utils.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContextHandlingTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CoroutineStepTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CustomParameterTypesIntegrationTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/HookRegistrationTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ScenarioRunnerTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/SharedMemoryServerTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepRegistrationTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/TaggedHookRegistrationTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/WireCoordinatorTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/WireProtocolTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/WireSessionTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/WireTranscriptTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/AllocationTrackingTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/BasicStepTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContextManagerTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CpuAffinityTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CucumberExpressionCustomTypesTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CucumberExpressionErrorsTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CucumberExpressionMatchingTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CucumberExpressionTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CucumberExpressionTransformationTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CukeCommandsTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/DurationHistoryTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/FeatureParserTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/HardwareCountersTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/IdempotentStepTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ImpactRecordTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/JsonStringTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/RegexTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StartupProfileTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StaticCucumberExpressionTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepBenchmarkTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepCallChainTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepIndexTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepLibraryFixture.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepLibraryTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepManagerTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepSnapshotTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StepTimeoutsTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StringPoolTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/TableTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/TagTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ThreadPoolTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/TimingsTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/TelemetryTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/TraceRecorderTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/UnconditionalHookTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/WatchdogTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/GTestDriverTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/GenericDriverTest.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AllocationTrackingTest"
+  "AllocationTrackingTest.pdb"
+  "CMakeFiles/AllocationTrackingTest.dir/unit/AllocationTrackingTest.cpp.o"
+  "CMakeFiles/AllocationTrackingTest.dir/unit/AllocationTrackingTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AllocationTrackingTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicStepTest"
+  "BasicStepTest.pdb"
+  "CMakeFiles/BasicStepTest.dir/unit/BasicStepTest.cpp.o"
+  "CMakeFiles/BasicStepTest.dir/unit/BasicStepTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BasicStepTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
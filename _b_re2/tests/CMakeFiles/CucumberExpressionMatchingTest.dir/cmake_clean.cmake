@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CucumberExpressionMatchingTest.dir/unit/CucumberExpressionMatchingTest.cpp.o"
+  "CMakeFiles/CucumberExpressionMatchingTest.dir/unit/CucumberExpressionMatchingTest.cpp.o.d"
+  "CucumberExpressionMatchingTest"
+  "CucumberExpressionMatchingTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CucumberExpressionMatchingTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CucumberExpressionTransformationTest.dir/unit/CucumberExpressionTransformationTest.cpp.o"
+  "CMakeFiles/CucumberExpressionTransformationTest.dir/unit/CucumberExpressionTransformationTest.cpp.o.d"
+  "CucumberExpressionTransformationTest"
+  "CucumberExpressionTransformationTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CucumberExpressionTransformationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FeatureParserTest.dir/unit/FeatureParserTest.cpp.o"
+  "CMakeFiles/FeatureParserTest.dir/unit/FeatureParserTest.cpp.o.d"
+  "FeatureParserTest"
+  "FeatureParserTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FeatureParserTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
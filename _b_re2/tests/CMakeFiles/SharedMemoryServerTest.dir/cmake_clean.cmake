@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SharedMemoryServerTest.dir/integration/SharedMemoryServerTest.cpp.o"
+  "CMakeFiles/SharedMemoryServerTest.dir/integration/SharedMemoryServerTest.cpp.o.d"
+  "SharedMemoryServerTest"
+  "SharedMemoryServerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SharedMemoryServerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
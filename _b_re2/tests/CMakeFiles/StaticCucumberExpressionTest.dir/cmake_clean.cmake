@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StaticCucumberExpressionTest.dir/unit/StaticCucumberExpressionTest.cpp.o"
+  "CMakeFiles/StaticCucumberExpressionTest.dir/unit/StaticCucumberExpressionTest.cpp.o.d"
+  "StaticCucumberExpressionTest"
+  "StaticCucumberExpressionTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StaticCucumberExpressionTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
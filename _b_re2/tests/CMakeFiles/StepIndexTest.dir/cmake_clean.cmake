@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepIndexTest.dir/unit/StepIndexTest.cpp.o"
+  "CMakeFiles/StepIndexTest.dir/unit/StepIndexTest.cpp.o.d"
+  "StepIndexTest"
+  "StepIndexTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepIndexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepLibraryTest.dir/unit/StepLibraryTest.cpp.o"
+  "CMakeFiles/StepLibraryTest.dir/unit/StepLibraryTest.cpp.o.d"
+  "StepLibraryTest"
+  "StepLibraryTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepLibraryTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
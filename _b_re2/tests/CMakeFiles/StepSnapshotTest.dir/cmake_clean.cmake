@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StepSnapshotTest.dir/unit/StepSnapshotTest.cpp.o"
+  "CMakeFiles/StepSnapshotTest.dir/unit/StepSnapshotTest.cpp.o.d"
+  "StepSnapshotTest"
+  "StepSnapshotTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StepSnapshotTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StringPoolTest.dir/unit/StringPoolTest.cpp.o"
+  "CMakeFiles/StringPoolTest.dir/unit/StringPoolTest.cpp.o.d"
+  "StringPoolTest"
+  "StringPoolTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StringPoolTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TelemetryTest.dir/unit/TelemetryTest.cpp.o"
+  "CMakeFiles/TelemetryTest.dir/unit/TelemetryTest.cpp.o.d"
+  "TelemetryTest"
+  "TelemetryTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TelemetryTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TimingsTest.dir/unit/TimingsTest.cpp.o"
+  "CMakeFiles/TimingsTest.dir/unit/TimingsTest.cpp.o.d"
+  "TimingsTest"
+  "TimingsTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimingsTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
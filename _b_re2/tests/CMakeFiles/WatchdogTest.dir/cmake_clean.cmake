@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WatchdogTest.dir/unit/WatchdogTest.cpp.o"
+  "CMakeFiles/WatchdogTest.dir/unit/WatchdogTest.cpp.o.d"
+  "WatchdogTest"
+  "WatchdogTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WatchdogTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
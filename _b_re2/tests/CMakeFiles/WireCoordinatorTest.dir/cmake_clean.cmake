@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WireCoordinatorTest.dir/integration/WireCoordinatorTest.cpp.o"
+  "CMakeFiles/WireCoordinatorTest.dir/integration/WireCoordinatorTest.cpp.o.d"
+  "WireCoordinatorTest"
+  "WireCoordinatorTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WireCoordinatorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
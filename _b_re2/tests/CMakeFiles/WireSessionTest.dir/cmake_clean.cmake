@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WireSessionTest.dir/integration/WireSessionTest.cpp.o"
+  "CMakeFiles/WireSessionTest.dir/integration/WireSessionTest.cpp.o.d"
+  "WireSessionTest"
+  "WireSessionTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WireSessionTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
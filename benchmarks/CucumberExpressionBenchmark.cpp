@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <cucumber-cpp/internal/utils/CucumberExpression.hpp>
+
+#include <string>
+
+using namespace cucumber::internal;
+
+namespace {
+
+const char* const EXPRESSIONS[] = {
+    "I have {int} cucumbers",
+    "there is/are {int} flight(s) to {string}",
+    "the {word} costs {float} euros at {int} o'clock",
+    "I have \\{literal\\} braces and {} anything",
+};
+
+void BM_Transform(benchmark::State& state) {
+    const std::string expression = EXPRESSIONS[state.range(0)];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cukex::transform(expression));
+    }
+}
+BENCHMARK(BM_Transform)->DenseRange(0, 3);
+
+void BM_TransformUnchecked(benchmark::State& state) {
+    const std::string expression = EXPRESSIONS[state.range(0)];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cukex::transformUnchecked(expression));
+    }
+}
+BENCHMARK(BM_TransformUnchecked)->DenseRange(0, 3);
+
+}
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include <cucumber-cpp/internal/step/StepManager.hpp>
+
+#include <string>
+
+using namespace cucumber::internal;
+
+namespace {
+
+void BM_FromStringInt(benchmark::State& state) {
+    const std::string text = "-1234567";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fromString<int>(text));
+    }
+}
+BENCHMARK(BM_FromStringInt);
+
+void BM_FromStringDouble(benchmark::State& state) {
+    const std::string text = "3.14159265";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fromString<double>(text));
+    }
+}
+BENCHMARK(BM_FromStringDouble);
+
+void BM_FromStringString(benchmark::State& state) {
+    const std::string text = "a cucumber of some length";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fromString<std::string>(text));
+    }
+}
+BENCHMARK(BM_FromStringString);
+
+void BM_FromStringChar(benchmark::State& state) {
+    const std::string text = "x";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fromString<char>(text));
+    }
+}
+BENCHMARK(BM_FromStringChar);
+
+}
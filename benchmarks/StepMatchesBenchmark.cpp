@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include "utils/StepManagerTestDouble.hpp"
+
+#include <string>
+
+using namespace cucumber::internal;
+
+namespace {
+
+/**
+ * Registers count step definitions, half regular expressions and half
+ * Cucumber Expressions, each with a literal prefix of its own
+ */
+void registerSteps(const std::size_t count) {
+    static std::size_t registered = 0;
+    if (registered == count) {
+        return;
+    }
+    StepManagerTestDouble::clearSteps();
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::string n = std::to_string(i);
+        StepManagerTestDouble::addStepDefinition(
+            i % 2 == 0 ? "^step " + n + " has (\\d+) items? in the (\\w+) basket$"
+                       : "user " + n + " visits page {int} as {word}"
+        );
+    }
+    registered = count;
+}
+
+std::string description(const std::size_t i) {
+    const std::string n = std::to_string(i);
+    return i % 2 == 0 ? "step " + n + " has 42 items in the red basket"
+                      : "user " + n + " visits page 7 as admin";
+}
+
+void BM_StepMatchesCached(benchmark::State& state) {
+    const std::size_t steps = static_cast<std::size_t>(state.range(0));
+    registerSteps(steps);
+    const std::string text = description(steps / 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(StepManager::stepMatches(text));
+    }
+}
+BENCHMARK(BM_StepMatchesCached)->RangeMultiplier(10)->Range(10, 10000);
+
+void BM_StepMatchesUncached(benchmark::State& state) {
+    const std::size_t steps = static_cast<std::size_t>(state.range(0));
+    registerSteps(steps);
+    StepMatchBuffer buffer;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        StepManager::stepMatches(description(i++ % steps), buffer);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(BM_StepMatchesUncached)->RangeMultiplier(10)->Range(10, 10000);
+
+void BM_StepMatchesUndefined(benchmark::State& state) {
+    registerSteps(static_cast<std::size_t>(state.range(0)));
+    StepMatchBuffer buffer;
+    for (auto _ : state) {
+        StepManager::stepMatches("nothing defines this step", buffer);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(BM_StepMatchesUndefined)->RangeMultiplier(10)->Range(10, 10000);
+
+}
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <cucumber-cpp/internal/Table.hpp>
+
+#include <string>
+
+using namespace cucumber::internal;
+
+namespace {
+
+const std::size_t COLUMNS = 8;
+
+void BM_TableAddRow(benchmark::State& state) {
+    const std::size_t rows = static_cast<std::size_t>(state.range(0));
+    Table::row_type row;
+    for (std::size_t i = 0; i < COLUMNS; ++i) {
+        row.push_back("cell " + std::to_string(i));
+    }
+    for (auto _ : state) {
+        Table table;
+        for (std::size_t i = 0; i < COLUMNS; ++i) {
+            table.addColumn("column " + std::to_string(i));
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            table.addRow(row);
+        }
+        benchmark::DoNotOptimize(table);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rows));
+}
+BENCHMARK(BM_TableAddRow)->RangeMultiplier(10)->Range(1, 1000);
+
+void BM_TableHashes(benchmark::State& state) {
+    const std::size_t rows = static_cast<std::size_t>(state.range(0));
+    Table::row_type row;
+    Table table;
+    for (std::size_t i = 0; i < COLUMNS; ++i) {
+        table.addColumn("column " + std::to_string(i));
+        row.push_back("cell " + std::to_string(i));
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        table.addRow(row);
+    }
+    for (auto _ : state) {
+        const Table copy(table);
+        benchmark::DoNotOptimize(copy.hashes());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rows));
+}
+BENCHMARK(BM_TableHashes)->RangeMultiplier(10)->Range(1, 1000);
+
+}
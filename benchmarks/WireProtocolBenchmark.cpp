@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <cucumber-cpp/internal/CukeEngineImpl.hpp>
+#include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+
+#include "utils/StepManagerTestDouble.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace cucumber::internal;
+
+namespace {
+
+/**
+ * An invoke request with a rows x columns table argument
+ */
+std::string invokeRequest(const std::size_t rows, const std::size_t columns) {
+    std::string request = R"(["invoke",{"id":"1","args":["42","some text",[)";
+    for (std::size_t i = 0; i < rows; ++i) {
+        request += i == 0 ? "[" : ",[";
+        for (std::size_t j = 0; j < columns; ++j) {
+            request += (j == 0 ? "\"" : ",\"") + std::to_string(i * columns + j) + "\"";
+        }
+        request += "]";
+    }
+    return request + "]]}]";
+}
+
+std::vector<StepMatch> stepMatches(const std::size_t count) {
+    std::vector<StepMatch> matches(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        matches[i].id = std::to_string(i);
+        matches[i].source = "steps/Steps.cpp:" + std::to_string(i);
+        matches[i].regexp = "^I have (\\d+) cucumbers in my \"([^\"]*)\"$";
+        matches[i].args = {{"42", 7}, {"belly", 25}};
+    }
+    return matches;
+}
+
+void BM_DecodeInvoke(benchmark::State& state) {
+    const JsonWireMessageCodec codec;
+    const std::string request = invokeRequest(
+        static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1))
+    );
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codec.decode(request));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(request.size()));
+}
+BENCHMARK(BM_DecodeInvoke)->Args({0, 0})->Args({2, 2})->Args({1000, 10});
+
+void BM_DecodeStepMatches(benchmark::State& state) {
+    const JsonWireMessageCodec codec;
+    const std::string request = R"(["step_matches",{"name_to_match":"I have 42 cucumbers"}])";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codec.decode(request));
+    }
+}
+BENCHMARK(BM_DecodeStepMatches);
+
+void BM_EncodeStepMatches(benchmark::State& state) {
+    const JsonWireMessageCodec codec;
+    const StepMatchesResponse response(stepMatches(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codec.encode(response));
+    }
+}
+BENCHMARK(BM_EncodeStepMatches)->Arg(1)->Arg(100);
+
+void BM_EncodeFailure(benchmark::State& state) {
+    const JsonWireMessageCodec codec;
+    const FailureResponse response(std::string(state.range(0), 'x'), "std::runtime_error");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(codec.encode(response));
+    }
+}
+BENCHMARK(BM_EncodeFailure)->Arg(16)->Arg(4096)->Arg(65536);
+
+/**
+ * Matches and invokes a step through the whole handler, as a wire server
+ * session does
+ */
+void BM_HandleRoundTrip(benchmark::State& state) {
+    StepManagerTestDouble::clearSteps();
+    const step_id_type id = StepManagerTestDouble::addStepDefinition("^I have (\\d+) cucumbers$");
+    CukeEngineImpl engine;
+    const JsonWireMessageCodec codec;
+    const WireProtocolHandler handler(codec, engine);
+    const std::string match = R"(["step_matches",{"name_to_match":"I have 42 cucumbers"}])";
+    const std::string invoke = R"(["invoke",{"id":")" + std::to_string(id)
+                             + R"(","args":["42"]}])";
+    handler.handle(R"(["begin_scenario"])");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handler.handle(match));
+        benchmark::DoNotOptimize(handler.handle(invoke));
+    }
+    handler.handle(R"(["end_scenario"])");
+}
+BENCHMARK(BM_HandleRoundTrip);
+
+}
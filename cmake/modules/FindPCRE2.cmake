@@ -0,0 +1,20 @@
+find_path(PCRE2_INCLUDE_DIR pcre2.h)
+find_library(PCRE2_LIBRARY NAMES pcre2-8)
+
+if (PCRE2_INCLUDE_DIR AND PCRE2_LIBRARY)
+    set(PCRE2_FOUND TRUE)
+else ()
+    set(PCRE2_FOUND FALSE)
+endif ()
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(PCRE2 REQUIRED_VARS PCRE2_INCLUDE_DIR PCRE2_LIBRARY)
+
+if (PCRE2_FOUND AND NOT TARGET PCRE2::pcre2-8)
+    add_library(PCRE2::pcre2-8 UNKNOWN IMPORTED)
+    set_target_properties(PCRE2::pcre2-8 PROPERTIES
+        IMPORTED_LOCATION "${PCRE2_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${PCRE2_INCLUDE_DIR}"
+        INTERFACE_COMPILE_DEFINITIONS PCRE2_CODE_UNIT_WIDTH=8
+    )
+endif ()
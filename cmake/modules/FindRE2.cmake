@@ -0,0 +1,19 @@
+find_path(RE2_INCLUDE_DIR re2/re2.h)
+find_library(RE2_LIBRARY NAMES re2)
+
+if (RE2_INCLUDE_DIR AND RE2_LIBRARY)
+    set(RE2_FOUND TRUE)
+else ()
+    set(RE2_FOUND FALSE)
+endif ()
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(RE2 REQUIRED_VARS RE2_INCLUDE_DIR RE2_LIBRARY)
+
+if (RE2_FOUND AND NOT TARGET re2::re2)
+    add_library(re2::re2 UNKNOWN IMPORTED)
+    set_target_properties(re2::re2 PROPERTIES
+        IMPORTED_LOCATION "${RE2_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${RE2_INCLUDE_DIR}"
+    )
+endif ()
@@ -0,0 +1,322 @@
+# Generates the step definitions, hooks and features of the synthetic suite.
+# Steps come in five kinds, taking turns: regular expressions, Cucumber
+# Expressions with built-in parameter types, with a custom parameter type,
+# with a table, and regular expressions with alternatives.
+
+set(_SYNTHETIC_NOUNS order invoice shipment account sensor device ticket parcel)
+set(_SYNTHETIC_REGIONS eu-west eu-central us-east ap-south)
+
+set(_SYNTHETIC_SOURCE_HEADER [==[
+// Generated by GenerateSuite.cmake
+#include <cucumber-cpp/generic.hpp>
+
+#include <SyntheticWorld.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+using cucumber::ScenarioScope;
+
+CUKE_PARAMETER_TYPE(region_@file@, "eu-west|eu-central|us-east|ap-south", [](std::string_view text) {
+    return Region(text);
+});
+]==])
+
+set(_SYNTHETIC_STEP_0 [==[
+
+GIVEN(
+    "^the @noun@ @step@ holds (\\d+) units? of \"([^\"]*)\"$",
+    (const int units, const std::string sku)
+) {
+    ScenarioScope<SyntheticWorld> world;
+    world->record(@step@, static_cast<std::uint64_t>(units) + sku.size());
+}
+]==])
+
+set(_SYNTHETIC_STEP_1 [==[
+
+WHEN(
+    "the @noun@ @step@ is moved by {int} cm(s) at a speed of {float}",
+    (const int distance, const double speed)
+) {
+    ScenarioScope<SyntheticWorld> world;
+    world->record(@step@, static_cast<std::uint64_t>(distance + speed));
+}
+]==])
+
+set(_SYNTHETIC_STEP_2 [==[
+
+THEN("the @noun@ @step@ is stored in {region_@file@}", (const Region& region)) {
+    ScenarioScope<SyntheticWorld> world;
+    world->record(@step@, region.name.size());
+}
+]==])
+
+set(_SYNTHETIC_STEP_3 [==[
+
+GIVEN("^the @noun@ @step@ has the following parts:$") {
+    TABLE_PARAM(parts);
+    ScenarioScope<SyntheticWorld> world;
+    std::uint64_t quantity = 0;
+    for (const auto row : parts.rows()) {
+        quantity += std::stoul(row[1]);
+    }
+    world->record(@step@, quantity);
+}
+]==])
+
+set(_SYNTHETIC_STEP_4 [==[
+
+THEN("^the @noun@ @step@ (?:is|becomes) (active|inactive)$", (const std::string state)) {
+    ScenarioScope<SyntheticWorld> world;
+    world->record(@step@, state.size());
+}
+]==])
+
+set(_SYNTHETIC_HOOKS_HEADER [==[
+// Generated by GenerateSuite.cmake
+#include <cucumber-cpp/generic.hpp>
+
+#include <SyntheticWorld.hpp>
+
+using cucumber::ScenarioScope;
+
+AROUND_STEP("@around") {
+    step->call();
+}
+
+AFTER_STEP("@audited") {
+    ScenarioScope<SyntheticWorld> world;
+    world->record(0, world->records);
+}
+]==])
+
+set(_SYNTHETIC_HOOKS [==[
+
+BEFORE("@tag@") {
+    ScenarioScope<SyntheticWorld> world;
+    world->record(@group@, 1);
+}
+
+AFTER("@tag@") {
+    ScenarioScope<SyntheticWorld> world;
+    world->record(@group@, world->checksum);
+}
+]==])
+
+set(_SYNTHETIC_PARTS_TABLE [==[
+      | part   | quantity |
+      | bolt   | 4        |
+      | nut    | 8        |
+      | washer | 2        |
+]==])
+
+# Writes the file unless it already has that content, so that configuring
+# again rebuilds nothing
+function(_synthetic_write path content)
+    if(EXISTS "${path}")
+        file(READ "${path}" _existing)
+        if(_existing STREQUAL content)
+            return()
+        endif()
+    endif()
+    file(WRITE "${path}" "${content}")
+endfunction()
+
+# Text of the step, without its keyword
+function(_synthetic_step_text step outline text_var)
+    list(LENGTH _SYNTHETIC_NOUNS _nouns)
+    math(EXPR _noun_index "${step} % ${_nouns}")
+    list(GET _SYNTHETIC_NOUNS ${_noun_index} noun)
+    math(EXPR _kind "${step} % 5")
+    if(_kind EQUAL 0)
+        if(outline)
+            set(_units "<units>")
+        else()
+            math(EXPR _units "${step} % 20 + 1")
+        endif()
+        set(_text "the ${noun} ${step} holds ${_units} units of \"sku-${step}\"")
+    elseif(_kind EQUAL 1)
+        if(outline)
+            set(_distance "<distance>")
+        else()
+            math(EXPR _distance "${step} % 90 + 10")
+        endif()
+        set(_text "the ${noun} ${step} is moved by ${_distance} cm at a speed of 2.5")
+    elseif(_kind EQUAL 2)
+        math(EXPR _region_index "${step} % 4")
+        list(GET _SYNTHETIC_REGIONS ${_region_index} _region)
+        set(_text "the ${noun} ${step} is stored in ${_region}")
+    elseif(_kind EQUAL 3)
+        set(_text "the ${noun} ${step} has the following parts:")
+    else()
+        set(_text "the ${noun} ${step} becomes active")
+    endif()
+    set(${text_var} "${_text}" PARENT_SCOPE)
+endfunction()
+
+# Step of a feature, with its keyword and table
+function(_synthetic_feature_step step outline table step_var)
+    _synthetic_step_text(${step} ${outline} _text)
+    math(EXPR _kind "${step} % 5")
+    if(_kind EQUAL 1)
+        set(_keyword "When")
+    elseif(_kind EQUAL 0 OR _kind EQUAL 3)
+        set(_keyword "Given")
+    else()
+        set(_keyword "Then")
+    endif()
+    set(_step "    ${_keyword} ${_text}\n")
+    if(_kind EQUAL 3)
+        string(APPEND _step "${table}")
+    endif()
+    set(${step_var} "${_step}" PARENT_SCOPE)
+endfunction()
+
+# generate_synthetic_suite(<output dir> <sources var>
+#     STEPS <n> FEATURES <n> SCENARIOS <n> TABLE_ROWS <n>)
+#
+# Writes the step definition sources, 250 steps to a file, and the hooks
+# source to the output directory, and sets the sources variable to them.
+# Writes to its features directory the features, the features with large
+# tables, wire_steps.txt and matches.transcript: steps and step_matches
+# requests spread over the step definitions, for cucumber-cpp-wireload.
+function(generate_synthetic_suite output_dir sources_var)
+    cmake_parse_arguments(SUITE "" "STEPS;FEATURES;SCENARIOS;TABLE_ROWS" "" ${ARGN})
+    set(_steps_per_file 250)
+    set(_hook_groups 16)
+    set(_steps_per_scenario 8)
+    set(_table_features 4)
+    set(_table_scenarios 5)
+    set(_features_dir "${output_dir}/features")
+    file(MAKE_DIRECTORY "${_features_dir}")
+    list(LENGTH _SYNTHETIC_NOUNS _nouns)
+
+    set(_sources)
+    math(EXPR _files "(${SUITE_STEPS} + ${_steps_per_file} - 1) / ${_steps_per_file}")
+    math(EXPR _last_file "${_files} - 1")
+    foreach(file RANGE ${_last_file})
+        string(CONFIGURE "${_SYNTHETIC_SOURCE_HEADER}" _source @ONLY)
+        math(EXPR _first "${file} * ${_steps_per_file}")
+        math(EXPR _last "${_first} + ${_steps_per_file} - 1")
+        if(_last GREATER_EQUAL SUITE_STEPS)
+            math(EXPR _last "${SUITE_STEPS} - 1")
+        endif()
+        foreach(step RANGE ${_first} ${_last})
+            math(EXPR _noun_index "${step} % ${_nouns}")
+            list(GET _SYNTHETIC_NOUNS ${_noun_index} noun)
+            math(EXPR _kind "${step} % 5")
+            string(CONFIGURE "${_SYNTHETIC_STEP_${_kind}}" _definition @ONLY)
+            string(APPEND _source "${_definition}")
+        endforeach()
+        set(_path "${output_dir}/SyntheticSteps${file}.cpp")
+        _synthetic_write("${_path}" "${_source}")
+        list(APPEND _sources "${_path}")
+    endforeach()
+
+    set(_source "${_SYNTHETIC_HOOKS_HEADER}")
+    math(EXPR _last_group "${_hook_groups} - 1")
+    foreach(group RANGE ${_last_group})
+        set(tag "@group_${group}")
+        string(CONFIGURE "${_SYNTHETIC_HOOKS}" _hooks @ONLY)
+        string(APPEND _source "${_hooks}")
+    endforeach()
+    set(_path "${output_dir}/SyntheticHooks.cpp")
+    _synthetic_write("${_path}" "${_source}")
+    list(APPEND _sources "${_path}")
+
+    # Steps picked by a linear congruential generator, the same every time
+    set(_random 12345)
+    math(EXPR _last_feature "${SUITE_FEATURES} - 1")
+    math(EXPR _last_scenario "${SUITE_SCENARIOS} - 1")
+    math(EXPR _last_step "${_steps_per_scenario} - 1")
+    foreach(feature RANGE ${_last_feature})
+        set(_feature "@synthetic\nFeature: Synthetic feature ${feature}\n")
+        foreach(scenario RANGE ${_last_scenario})
+            math(EXPR _group "(${feature} + ${scenario}) % ${_hook_groups}")
+            set(_tags "@group_${_group}")
+            math(EXPR _around "${scenario} % 4")
+            if(_around EQUAL 0)
+                string(APPEND _tags " @around")
+            endif()
+            math(EXPR _audited "${scenario} % 3")
+            if(_audited EQUAL 0)
+                string(APPEND _tags " @audited")
+            endif()
+            math(EXPR _outline "${scenario} % 5")
+            if(_outline EQUAL 4)
+                set(_outline TRUE)
+                set(_keyword "Scenario Outline")
+            else()
+                set(_outline FALSE)
+                set(_keyword "Scenario")
+            endif()
+            string(APPEND _feature "\n  ${_tags}\n  ${_keyword}: Scenario ${feature}.${scenario}\n")
+            foreach(_ RANGE ${_last_step})
+                math(EXPR _random "(${_random} * 1103515245 + 12345) % 2147483648")
+                math(EXPR _step "(${_random} / 65536) % ${SUITE_STEPS}")
+                _synthetic_feature_step(${_step} ${_outline} "${_SYNTHETIC_PARTS_TABLE}" _text)
+                string(APPEND _feature "${_text}")
+            endforeach()
+            if(_outline)
+                string(APPEND _feature "\n    Examples:\n      | units | distance |\n")
+                foreach(_row RANGE 1 5)
+                    math(EXPR _distance "${_row} * 10")
+                    string(APPEND _feature "      | ${_row}     | ${_distance}       |\n")
+                endforeach()
+            endif()
+        endforeach()
+        _synthetic_write("${_features_dir}/synthetic_${feature}.feature" "${_feature}")
+    endforeach()
+
+    set(_table "      | part | quantity |\n")
+    foreach(_row RANGE 1 ${SUITE_TABLE_ROWS})
+        math(EXPR _quantity "${_row} % 10 + 1")
+        string(APPEND _table "      | part-${_row} | ${_quantity} |\n")
+    endforeach()
+    math(EXPR _last_table_feature "${_table_features} - 1")
+    math(EXPR _last_table_scenario "${_table_scenarios} - 1")
+    foreach(feature RANGE ${_last_table_feature})
+        set(_feature "@tables\nFeature: Large tables ${feature}\n")
+        foreach(scenario RANGE ${_last_table_scenario})
+            string(APPEND _feature "\n  @audited\n  Scenario: Table ${feature}.${scenario}\n")
+            math(EXPR _random "(${_random} * 1103515245 + 12345) % 2147483648")
+            # The step taking a table, then the two before it
+            math(EXPR _step "(${_random} / 65536) % ${SUITE_STEPS} / 5 * 5 + 3")
+            if(_step GREATER_EQUAL SUITE_STEPS)
+                set(_step 3)
+            endif()
+            foreach(_offset 3 2 0)
+                math(EXPR _other "${_step} - ${_offset}")
+                _synthetic_feature_step(${_other} FALSE "${_table}" _text)
+                string(APPEND _feature "${_text}")
+            endforeach()
+        endforeach()
+        _synthetic_write("${_features_dir}/tables_${feature}.feature" "${_feature}")
+    endforeach()
+
+    set(_wire_steps "")
+    set(_transcript "# step_matches requests spread over the step definitions\n")
+    foreach(_sample RANGE 63)
+        math(EXPR _step "${_sample} * ${SUITE_STEPS} / 64")
+        math(EXPR _kind "${_step} % 5")
+        if(_kind EQUAL 3)
+            math(EXPR _step "${_step} - 1")
+        endif()
+        _synthetic_step_text(${_step} FALSE _text)
+        math(EXPR _wire_step "${_sample} % 4")
+        if(_wire_step EQUAL 0)
+            string(APPEND _wire_steps "${_text}\n")
+        endif()
+        string(REPLACE "\"" "\\\"" _text "${_text}")
+        string(APPEND _transcript "[\"step_matches\",{\"name_to_match\":\"${_text}\"}]\n")
+    endforeach()
+    _synthetic_write("${_features_dir}/wire_steps.txt" "${_wire_steps}")
+    _synthetic_write("${_features_dir}/matches.transcript" "${_transcript}")
+    _synthetic_write(
+        "${_features_dir}/step_definitions/cucumber.wire" "host: localhost\nport: 3902\n"
+    )
+
+    set(${sources_var} ${_sources} PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""Measures the synthetic suite on every transport.
+
+For the wire server over TCP and over a Unix socket: the time until it
+listens, the step_matches requests answered per second replaying
+matches.transcript with cucumber-cpp-wireload, and the steps invoked per
+second running scenarios of the steps in wire_steps.txt with it. For the
+native runner: the time it takes to run no feature, then the steps matched
+and invoked per second running the features with --dry-run and without,
+past that startup time. Also the peak resident set size of each.
+
+Every figure is the median of the repeated runs.
+"""
+
+import argparse
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument(
+        "--build-dir",
+        default="build",
+        help="Cucumber-CPP build directory, configured with -DCUKE_ENABLE_EXAMPLES=ON "
+        "and -DCUKE_ENABLE_TOOLS=ON (default build)",
+    )
+    parser.add_argument(
+        "--transports",
+        default="tcp,unix,native",
+        help="Comma separated among tcp, unix and native (default all)",
+    )
+    parser.add_argument(
+        "--connections", type=int, default=1, help="Wire connections at once (default 1)"
+    )
+    parser.add_argument(
+        "--scenarios",
+        type=int,
+        default=200,
+        help="Wire scenarios, and transcript replays, per connection (default 200)",
+    )
+    parser.add_argument(
+        "--jobs", type=int, default=1, help="Scenarios the native runner runs at once (default 1)"
+    )
+    parser.add_argument("--repeat", type=int, default=3, help="Runs of each measure (default 3)")
+    parser.add_argument("--json", help="Also write the figures to this file, to compare runs")
+    return parser.parse_args()
+
+
+def peak_megabytes(usage):
+    # Kilobytes on Linux, bytes on macOS
+    scale = 1 if sys.platform == "darwin" else 1024
+    return usage.ru_maxrss * scale / (1024 * 1024)
+
+
+def wait(process):
+    """Waits for the process to end: its exit code and peak RSS in MB, if known"""
+    if not hasattr(os, "wait4"):
+        return process.wait(), None
+    _, status, usage = os.wait4(process.pid, 0)
+    process.returncode = os.waitstatus_to_exitcode(status)
+    return process.returncode, peak_megabytes(usage)
+
+
+def run(command):
+    """Runs the command to completion: its output, wall time in s and peak RSS in MB"""
+    start = time.perf_counter()
+    process = subprocess.Popen(
+        command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True
+    )
+    output = process.stdout.read()
+    returncode, peak = wait(process)
+    elapsed = time.perf_counter() - start
+    if returncode != 0:
+        raise RuntimeError("{} exited with {}:\n{}".format(command[0], returncode, output))
+    return output, elapsed, peak
+
+
+class WireServer:
+    """SyntheticSteps serving sessions until stopped, started by a with statement"""
+
+    def __init__(self, executable, endpoint):
+        self.command = [executable, "--verbose", "--multi-session"] + endpoint
+        self.peak = None
+
+    def __enter__(self):
+        start = time.perf_counter()
+        self.process = subprocess.Popen(
+            self.command, stderr=subprocess.PIPE, universal_newlines=True
+        )
+        for line in self.process.stderr:
+            if line.startswith("Listening on"):
+                self.startup = time.perf_counter() - start
+                self.listening = line.strip()
+                break
+        else:
+            self.process.wait()
+            raise RuntimeError("{} exited without listening".format(self.command[0]))
+        # Keeps the server from blocking on a full pipe
+        threading.Thread(target=self.process.stderr.read, daemon=True).start()
+        return self
+
+    def __exit__(self, *_):
+        self.process.terminate()
+        _, self.peak = wait(self.process)
+
+
+def wireload(options, endpoint, arguments):
+    """Runs cucumber-cpp-wireload: its elapsed time and requests counted by command"""
+    output, _, _ = run(
+        [options.wireload]
+        + endpoint
+        + ["--connections", str(options.connections), "--scenarios", str(options.scenarios)]
+        + arguments
+    )
+    # The rate has more significant digits than the elapsed time
+    rate = re.search(r"([0-9.]+) messages in .*: ([0-9.]+) messages/s", output)
+    if not rate:
+        raise RuntimeError("Unexpected cucumber-cpp-wireload output:\n" + output)
+    counts = {
+        command: int(count)
+        for command, count in re.findall(r"^(\w+)\s+(\d+)\s", output, re.MULTILINE)
+    }
+    return float(rate.group(1)) / float(rate.group(2)), counts
+
+
+def measure_wire(options, transport):
+    with tempfile.TemporaryDirectory() as directory:
+        if transport == "tcp":
+            serve, connect = ["--port", "0"], None
+        else:
+            socket = os.path.join(directory, "synthetic.sock")
+            serve, connect = ["--unix", socket], ["--unix", socket]
+        return measure_wire_server(options, serve, connect)
+
+
+def measure_wire_server(options, serve, connect):
+    with open(os.path.join(options.features, "wire_steps.txt")) as steps_file:
+        steps = [line.strip() for line in steps_file if line.strip()]
+    step_options = [option for step in steps for option in ("--step", step)]
+    with WireServer(options.steps, serve) as server:
+        if connect is None:
+            connect = ["--port", server.listening.rsplit(":", 1)[1]]
+        seconds, counts = wireload(
+            options,
+            connect,
+            ["--transcript", os.path.join(options.features, "matches.transcript")],
+        )
+        matches = counts["step_matches"] / seconds
+        seconds, counts = wireload(options, connect, step_options)
+        invokes = counts["invoke"] / seconds
+    return {
+        "startup_ms": server.startup * 1000,
+        "matches_per_s": matches,
+        "invokes_per_s": invokes,
+        "peak_rss_mb": server.peak,
+    }
+
+
+def steps_run(output):
+    found = re.search(r"^(\d+) steps", output, re.MULTILINE)
+    if not found:
+        raise RuntimeError("Unexpected runner output:\n" + output)
+    return int(found.group(1))
+
+
+def measure_native(options):
+    runner = [options.runner, "--jobs", str(options.jobs)]
+    with tempfile.TemporaryDirectory() as nothing:
+        _, startup, _ = run(runner + [nothing])
+    output, dry_run, _ = run(runner + ["--dry-run", options.features])
+    matches = steps_run(output) / max(dry_run - startup, 1e-9)
+    output, elapsed, peak = run(runner + [options.features])
+    invokes = steps_run(output) / max(elapsed - startup, 1e-9)
+    return {
+        "startup_ms": startup * 1000,
+        "matches_per_s": matches,
+        "invokes_per_s": invokes,
+        "peak_rss_mb": peak,
+    }
+
+
+def median(runs, key):
+    values = [run[key] for run in runs if run[key] is not None]
+    return statistics.median(values) if values else None
+
+
+def main():
+    options = parse_args()
+    suite = os.path.join(options.build_dir, "examples", "SyntheticSuite")
+    suffix = ".exe" if sys.platform == "win32" else ""
+    options.steps = os.path.join(suite, "SyntheticSteps" + suffix)
+    options.runner = os.path.join(suite, "SyntheticRunner" + suffix)
+    options.wireload = os.path.join(options.build_dir, "tools", "cucumber-cpp-wireload" + suffix)
+    options.features = os.path.join(suite, "features")
+
+    results = {}
+    for transport in options.transports.split(","):
+        if transport not in ("tcp", "unix", "native"):
+            sys.exit("Unknown transport: " + transport)
+        runs = []
+        for _ in range(options.repeat):
+            if transport == "native":
+                runs.append(measure_native(options))
+            else:
+                runs.append(measure_wire(options, transport))
+        results[transport] = {key: median(runs, key) for key in runs[0]}
+
+    print(
+        "{:<10}{:>14}{:>14}{:>14}{:>16}".format(
+            "Transport", "Startup (ms)", "Matches/s", "Invokes/s", "Peak RSS (MB)"
+        )
+    )
+    for transport, figures in results.items():
+        peak = figures["peak_rss_mb"]
+        print(
+            "{:<10}{:>14.1f}{:>14.0f}{:>14.0f}{:>16}".format(
+                transport,
+                figures["startup_ms"],
+                figures["matches_per_s"],
+                figures["invokes_per_s"],
+                "{:.1f}".format(peak) if peak is not None else "-",
+            )
+        )
+    if options.json:
+        with open(options.json, "w") as out:
+            json.dump(results, out, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * What the generated steps and hooks act on. Cheap enough that the
+ * measurements are those of Cucumber-CPP rather than of the steps.
+ */
+class SyntheticWorld {
+public:
+    void record(std::uint64_t step, std::uint64_t value) {
+        checksum = (checksum ^ step) * 1099511628211u + value;
+        ++records;
+    }
+
+    std::uint64_t checksum = 14695981039346656037u;
+    std::uint64_t records = 0;
+};
+
+/**
+ * Custom parameter type of the generated steps
+ */
+struct Region {
+    explicit Region(std::string_view name) :
+        name(name) {
+    }
+
+    std::string name;
+};
@@ -0,0 +1,97 @@
+#ifndef CUKE_ALLOCATIONTRACKING_HPP_
+#define CUKE_ALLOCATIONTRACKING_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Allocations made on a thread since it started
+ */
+struct CUCUMBER_CPP_EXPORT AllocationCount {
+    std::uint64_t allocations;
+    std::uint64_t allocatedBytes;
+    std::uint64_t freedBytes;
+};
+
+/**
+ * Allocations of the calling thread along with the peak resident set size
+ * of the process, to compare with a later sample
+ */
+struct CUCUMBER_CPP_EXPORT AllocationSample {
+    AllocationCount count;
+    std::uint64_t peakResidentBytes;
+};
+
+/**
+ * Counts the allocations of the global operator new, once a step binary
+ * replaced it with CUKE_TRACK_ALLOCATIONS(). Every thread counts its own
+ * without locking, memory being counted as freed by the thread freeing it.
+ */
+class CUCUMBER_CPP_EXPORT AllocationTracking {
+public:
+    /**
+     * Whether the global operator new counts allocations
+     */
+    static bool isInstalled();
+    static AllocationCount thread();
+    static AllocationSample sample();
+    /**
+     * High-water mark of the resident set size of the process, 0 where
+     * unknown
+     */
+    static std::uint64_t peakResidentBytes();
+
+    /** For the replaced operators only */
+    static void* allocate(std::size_t size);
+    static void* allocate(std::size_t size, const std::nothrow_t&) noexcept;
+    static void deallocate(void* pointer) noexcept;
+};
+
+}
+}
+
+/**
+ * Replaces the global operator new and delete with ones counting the
+ * allocations of every thread. To be used once, at namespace scope, in a
+ * translation unit of the step binary.
+ */
+#define CUKE_TRACK_ALLOCATIONS()                                                 \
+    void* operator new(std::size_t size) {                                       \
+        return ::cucumber::internal::AllocationTracking::allocate(size);         \
+    }                                                                            \
+    void* operator new[](std::size_t size) {                                     \
+        return ::cucumber::internal::AllocationTracking::allocate(size);         \
+    }                                                                            \
+    void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept {   \
+        return ::cucumber::internal::AllocationTracking::allocate(size, tag);    \
+    }                                                                            \
+    void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { \
+        return ::cucumber::internal::AllocationTracking::allocate(size, tag);    \
+    }                                                                            \
+    void operator delete(void* pointer) noexcept {                               \
+        ::cucumber::internal::AllocationTracking::deallocate(pointer);           \
+    }                                                                            \
+    void operator delete[](void* pointer) noexcept {                             \
+        ::cucumber::internal::AllocationTracking::deallocate(pointer);           \
+    }                                                                            \
+    void operator delete(void* pointer, std::size_t) noexcept {                  \
+        ::cucumber::internal::AllocationTracking::deallocate(pointer);           \
+    }                                                                            \
+    void operator delete[](void* pointer, std::size_t) noexcept {                \
+        ::cucumber::internal::AllocationTracking::deallocate(pointer);           \
+    }                                                                            \
+    void operator delete(void* pointer, const std::nothrow_t&) noexcept {        \
+        ::cucumber::internal::AllocationTracking::deallocate(pointer);           \
+    }                                                                            \
+    void operator delete[](void* pointer, const std::nothrow_t&) noexcept {      \
+        ::cucumber::internal::AllocationTracking::deallocate(pointer);           \
+    }                                                                            \
+    static_assert(true, "")
+
+#endif /* CUKE_ALLOCATIONTRACKING_HPP_ */
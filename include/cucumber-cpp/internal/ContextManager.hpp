@@ -3,35 +3,366 @@
 
 #include <cucumber-cpp/internal/CukeExport.hpp>
 
-#include <vector>
-
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cucumber {
 
 namespace internal {
 
-typedef std::vector<std::shared_ptr<void>> contexts_type;
+/**
+ * Monotonic storage for the contexts of a scenario.
+ *
+ * Contexts are carved out of large blocks and are all destroyed at once, in
+ * reverse order of creation, by reset(). The memory is kept for the next
+ * scenario, so a steady state run allocates nothing per context.
+ */
+class CUCUMBER_CPP_EXPORT ContextArena {
+public:
+    ContextArena() = default;
+    ContextArena(const ContextArena&) = delete;
+    ContextArena& operator=(const ContextArena&) = delete;
+    ~ContextArena();
+
+    template<class T, class... Args>
+    T* create(Args&&... args);
+    void reset();
+
+    typedef std::size_t size_type;
+    size_type size() const;
+    /**
+     * Contexts alive in every arena of the process
+     */
+    static size_type liveContexts();
+
+    /**
+     * Hands the contexts of later resets, with their memory, to a thread
+     * destroying them in the background, so that scenarios end without
+     * waiting for their destructors. Resets wait while more than
+     * maxPendingBytes of arena memory is still to be destroyed. 0 turns it
+     * off again.
+     *
+     * Only for contexts whose destructors may run on another thread.
+     */
+    static void setBackgroundTeardown(std::size_t maxPendingBytes);
+    /**
+     * Waits until the contexts handed over so far are destroyed
+     */
+    static void waitForTeardown();
+
+private:
+    void* allocate(std::size_t size, std::size_t alignment);
+    void destroyContexts();
+    static void countContexts(std::ptrdiff_t change);
+
+    template<class T>
+    static void destroy(void* object) {
+        static_cast<T*>(object)->~T();
+    }
+
+    struct Context {
+        void* object;
+        void (*destroy)(void*);
+    };
+    std::vector<Context> contexts;
+
+    typedef std::vector<std::unique_ptr<unsigned char[]>> blocks_type;
+    blocks_type blocks;
+    std::size_t blockSize = 0;
+    std::size_t blockUsed = 0;
+    std::size_t reserved = 0;
+};
+
+template<class T, class... Args>
+T* ContextArena::create(Args&&... args) {
+    void* const storage = allocate(sizeof(T), alignof(T));
+    contexts.push_back({storage, NULL});
+    T* object;
+    try {
+        object = new (storage) T(std::forward<Args>(args)...);
+    } catch (...) {
+        contexts.pop_back();
+        throw;
+    }
+    contexts.back().destroy = &destroy<T>;
+    countContexts(1);
+    return object;
+}
+
+template<class T, class = void>
+struct has_context_reset : std::false_type {};
+
+template<class T>
+struct has_context_reset<T, std::void_t<decltype(std::declval<T&>().reset())>>
+    : std::true_type {};
+
+/**
+ * Brings a pooled context back to its initial state: through its reset()
+ * member when it has one, by assigning it a new instance otherwise.
+ */
+template<class T>
+void resetContext(T& context) {
+    if constexpr (has_context_reset<T>::value) {
+        context.reset();
+    } else {
+        context = T();
+    }
+}
+
+template<class T, class = void>
+struct has_context_snapshot : std::false_type {};
+
+template<class T>
+struct has_context_snapshot<T, std::void_t<decltype(T(std::declval<const T&>().snapshot()))>>
+    : std::true_type {};
+
+/**
+ * Copies contexts of a type with a snapshot() member, returning a T that
+ * can stand for it, into a snapshot and back into an arena
+ */
+struct ContextCopier {
+    std::shared_ptr<void> (*take)(const void* context);
+    void* (*restore)(ContextArena& arena, const void* copy);
+};
 
+template<class T>
+const ContextCopier* contextCopier() {
+    if constexpr (has_context_snapshot<T>::value) {
+        static const ContextCopier copier = {
+            [](const void* context) -> std::shared_ptr<void> {
+                return std::make_shared<T>(static_cast<const T*>(context)->snapshot());
+            },
+            [](ContextArena& arena, const void* copy) -> void* {
+                return arena.create<T>(static_cast<const T*>(copy)->snapshot());
+            },
+        };
+        return &copier;
+    } else {
+        return nullptr;
+    }
+}
+
+/**
+ * Scenario contexts as some steps left them, see ScenarioContexts::snapshot()
+ */
+class CUCUMBER_CPP_EXPORT ContextSnapshot {
+private:
+    friend class ScenarioContexts;
+
+    struct Context {
+        std::size_t typeId;
+        std::shared_ptr<void> copy;
+        const ContextCopier* copier;
+    };
+    std::vector<Context> contexts;
+};
+
+/**
+ * Contexts shared by type over a lifetime longer than a scenario, created
+ * on first use and destroyed by clear() or with the slots.
+ */
+class CUCUMBER_CPP_EXPORT ContextSlots {
+public:
+    template<class T>
+    T* context(std::size_t typeId);
+    void clear();
+
+private:
+    ContextArena arena;
+    std::vector<void*> contexts;
+};
+
+template<class T>
+T* ContextSlots::context(std::size_t typeId) {
+    if (typeId >= contexts.size()) {
+        contexts.resize(typeId + 1);
+    }
+    if (!contexts[typeId]) {
+        contexts[typeId] = arena.create<T>();
+    }
+    return static_cast<T*>(contexts[typeId]);
+}
+
+/**
+ * Contexts of the scenario run by one session.
+ *
+ * Scopes reach the current() instance of their thread. A session makes its
+ * own instance current before running any code of its scenario, so
+ * concurrent sessions, even when multiplexed on one thread, never share
+ * contexts. Threads that no session drives each have an instance of their
+ * own.
+ */
+class CUCUMBER_CPP_EXPORT ScenarioContexts {
+public:
+    ScenarioContexts() = default;
+    ScenarioContexts(const ScenarioContexts&) = delete;
+    ScenarioContexts& operator=(const ScenarioContexts&) = delete;
+    ~ScenarioContexts();
+
+    static ScenarioContexts& current();
+    void makeCurrent();
+
+    /**
+     * The T shared by the scenario, created on first use
+     */
+    template<class T>
+    T* context();
+    /**
+     * The T kept by the session across scenarios, reset on first use in
+     * every scenario but the one that created it
+     */
+    template<class T>
+    T* pooledContext();
+    /**
+     * A T of its own, not shared with any other caller
+     */
+    template<class T>
+    T* create();
+    /**
+     * The T shared by the scenarios of the feature the session is in,
+     * created on first use
+     */
+    template<class T>
+    T* featureContext();
+    /**
+     * The T shared by every session of the process until the AfterAll
+     * hooks have run, created on first use. Only its creation is guarded,
+     * so T must bear being used by concurrent sessions.
+     */
+    template<class T>
+    static T* runContext();
+
+    void purge();
+    /**
+     * Copies the contexts of the scenario so far, if all of them were
+     * reached through a ScenarioScope and have a snapshot() member, see
+     * has_context_snapshot. Null otherwise.
+     */
+    std::shared_ptr<const ContextSnapshot> snapshot() const;
+    /**
+     * Puts copies of the contexts of the snapshot in place, unless the
+     * scenario already has contexts of the same types
+     */
+    bool restore(const ContextSnapshot& snapshot);
+    /**
+     * Destroys the feature contexts, as the session moves on to another
+     * feature
+     */
+    void purgeFeature();
+    /**
+     * Keeps the feature contexts of another instance in place of its own
+     */
+    void shareFeatureContexts(const ScenarioContexts& other);
+    static void purgeRun();
+    ContextArena::size_type size() const;
+
+private:
+    typedef std::size_t type_id_type;
+    static type_id_type nextTypeId();
+    template<class T>
+    static type_id_type typeId() {
+        static const type_id_type id = nextTypeId();
+        return id;
+    }
+
+    struct PooledContext {
+        std::shared_ptr<void> object;
+        bool stale;
+    };
+
+    static std::mutex& runContextsMutex();
+    static ContextSlots& runContexts();
+
+    struct ScenarioContext {
+        void* object = nullptr;
+        const ContextCopier* copier = nullptr;
+    };
+
+    ContextArena arena;
+    std::vector<ScenarioContext> contexts;
+    std::vector<PooledContext> pooledContexts;
+    std::shared_ptr<ContextSlots> featureContexts;
+};
+
+template<class T>
+T* ScenarioContexts::context() {
+    const type_id_type id = typeId<T>();
+    if (id >= contexts.size()) {
+        contexts.resize(id + 1);
+    }
+    if (!contexts[id].object) {
+        contexts[id].object = arena.create<T>();
+        contexts[id].copier = contextCopier<T>();
+    }
+    return static_cast<T*>(contexts[id].object);
+}
+
+template<class T>
+T* ScenarioContexts::pooledContext() {
+    const type_id_type id = typeId<T>();
+    if (id >= pooledContexts.size()) {
+        pooledContexts.resize(id + 1);
+    }
+    PooledContext& pooled = pooledContexts[id];
+    if (!pooled.object) {
+        pooled.object = std::make_shared<T>();
+    } else if (pooled.stale) {
+        resetContext(*static_cast<T*>(pooled.object.get()));
+    }
+    pooled.stale = false;
+    return static_cast<T*>(pooled.object.get());
+}
+
+template<class T>
+T* ScenarioContexts::create() {
+    return arena.create<T>();
+}
+
+template<class T>
+T* ScenarioContexts::featureContext() {
+    if (!featureContexts) {
+        featureContexts = std::make_shared<ContextSlots>();
+    }
+    return featureContexts->context<T>(typeId<T>());
+}
+
+template<class T>
+T* ScenarioContexts::runContext() {
+    std::lock_guard<std::mutex> lock(runContextsMutex());
+    return runContexts().context<T>(typeId<T>());
+}
+
+/**
+ * Works on the current ScenarioContexts of the calling thread.
+ */
 class CUCUMBER_CPP_EXPORT ContextManager {
 public:
     void purgeContexts();
     template<class T>
-    std::weak_ptr<T> addContext();
+    T* addContext();
 
 protected:
-    static contexts_type contexts;
+    static ScenarioContexts& contexts();
 };
 
 template<class T>
-std::weak_ptr<T> ContextManager::addContext() {
-    std::shared_ptr<T> shared(std::make_shared<T>());
-    contexts.push_back(shared);
-    return std::weak_ptr<T>(shared);
+T* ContextManager::addContext() {
+    return contexts().create<T>();
 }
 
 }
 
+/**
+ * Shares one T with every other ScenarioScope<T> of the current scenario.
+ *
+ * The context lives until the scenario ends, so a ScenarioScope must not
+ * be kept beyond that.
+ */
 template<class T>
 class ScenarioScope {
 public:
@@ -42,35 +373,146 @@ public:
     T* get();
 
 private:
-    internal::ContextManager contextManager;
-    std::shared_ptr<T> context;
-    static std::weak_ptr<T> contextReference;
+    T* context;
 };
 
 template<class T>
-std::weak_ptr<T> ScenarioScope<T>::contextReference;
-
-template<class T>
-ScenarioScope<T>::ScenarioScope() {
-    if (contextReference.expired()) {
-        contextReference = contextManager.addContext<T>();
-    }
-    context = contextReference.lock();
+ScenarioScope<T>::ScenarioScope() :
+    context(internal::ScenarioContexts::current().context<T>()) {
 }
 
 template<class T>
 T& ScenarioScope<T>::operator*() {
-    return *(context.get());
+    return *context;
 }
 
 template<class T>
 T* ScenarioScope<T>::operator->() {
-    return (context.get());
+    return context;
 }
 
 template<class T>
 T* ScenarioScope<T>::get() {
-    return context.get();
+    return context;
+}
+
+/**
+ * Like ScenarioScope, but for contexts that are expensive to build.
+ *
+ * A single T is kept alive by the session across its scenarios. The first
+ * PooledScenarioScope<T> of every later scenario resets it in place, see
+ * internal::resetContext().
+ */
+template<class T>
+class PooledScenarioScope {
+public:
+    PooledScenarioScope();
+
+    T& operator*();
+    T* operator->();
+    T* get();
+
+private:
+    T* context;
+};
+
+template<class T>
+PooledScenarioScope<T>::PooledScenarioScope() :
+    context(internal::ScenarioContexts::current().pooledContext<T>()) {
+}
+
+template<class T>
+T& PooledScenarioScope<T>::operator*() {
+    return *context;
+}
+
+template<class T>
+T* PooledScenarioScope<T>::operator->() {
+    return context;
+}
+
+template<class T>
+T* PooledScenarioScope<T>::get() {
+    return context;
+}
+
+/**
+ * Shares one T with every other FeatureScope<T> of the scenarios of the
+ * current feature, for fixtures too expensive to build for each of them.
+ *
+ * The context lives until the session moves on to another feature, see
+ * CukeEngine::beginFeature(), or ends.
+ */
+template<class T>
+class FeatureScope {
+public:
+    FeatureScope();
+
+    T& operator*();
+    T* operator->();
+    T* get();
+
+private:
+    T* context;
+};
+
+template<class T>
+FeatureScope<T>::FeatureScope() :
+    context(internal::ScenarioContexts::current().featureContext<T>()) {
+}
+
+template<class T>
+T& FeatureScope<T>::operator*() {
+    return *context;
+}
+
+template<class T>
+T* FeatureScope<T>::operator->() {
+    return context;
+}
+
+template<class T>
+T* FeatureScope<T>::get() {
+    return context;
+}
+
+/**
+ * Shares one T with every other RunScope<T> of the run, in every session.
+ *
+ * The context lives until the AfterAll hooks have run. Sessions running
+ * at once share it, so T must bear concurrent use.
+ */
+template<class T>
+class RunScope {
+public:
+    RunScope();
+
+    T& operator*();
+    T* operator->();
+    T* get();
+
+private:
+    T* context;
+};
+
+template<class T>
+RunScope<T>::RunScope() :
+    context(internal::ScenarioContexts::runContext<T>()) {
+}
+
+template<class T>
+T& RunScope<T>::operator*() {
+    return *context;
+}
+
+template<class T>
+T* RunScope<T>::operator->() {
+    return context;
+}
+
+template<class T>
+T* RunScope<T>::get() {
+    return context;
 }
 
 }
@@ -1,17 +1,24 @@
 #ifndef CUKE_CUKECOMMANDS_HPP_
 #define CUKE_CUKECOMMANDS_HPP_
 
+#include "AllocationTracking.hpp"
 #include "ContextManager.hpp"
 #include <cucumber-cpp/internal/CukeExport.hpp>
 #include "Scenario.hpp"
+#include "StepBenchmark.hpp"
+#include "StepTimeouts.hpp"
+#include "Telemetry.hpp"
 #include "Table.hpp"
+#include "hook/HookRegistrar.hpp"
 #include "step/StepManager.hpp"
 
+#include <chrono>
 #include <map>
 #include <string>
 #include <sstream>
 
 #include <memory>
+#include <optional>
 
 namespace cucumber {
 namespace internal {
@@ -24,22 +31,97 @@ public:
     CukeCommands();
     virtual ~CukeCommands();
 
+    /**
+     * Destroys the feature contexts when the name differs from that of the
+     * previous feature
+     */
+    void beginFeature(const std::string& name);
+    /**
+     * Snapshots are kept until the feature changes, and only the first one
+     * under a key is taken
+     */
+    bool snapshotBackground(const std::string& key);
+    bool restoreBackground(const std::string& key);
+    /**
+     * Parent of the span of the next scenario, ignored if malformed
+     */
+    void continueTrace(const std::string& traceParent);
     void beginScenario(const TagExpression::tag_list& tags = TagExpression::tag_list());
     void endScenario();
     const std::string snippetText(const std::string stepKeyword, const std::string stepName, const std::string multilineArgClass = "") const;
     MatchResult stepMatches(const std::string description) const;
+    std::vector<MatchResult> outlineStepMatches(
+        const std::string& templateText, const std::vector<std::string>& descriptions
+    ) const;
     InvokeResult invoke(step_id_type id, const InvokeArgs* pArgs);
+    /**
+     * Shares the args with a step left running past its time budget
+     * instead of copying them for it
+     */
+    InvokeResult invoke(step_id_type id, std::shared_ptr<const InvokeArgs> args);
+    /**
+     * Invokes the step without blocking while its body waits
+     * asynchronously, calling back with its result on a thread of the
+     * executor. Steps run within a time budget, around step hooks or as
+     * benchmarks are invoked as by invoke() before returning.
+     */
+    void invokeAsync(
+        step_id_type id,
+        std::shared_ptr<const InvokeArgs> args,
+        StepExecutor& executor,
+        invoke_callback_type done
+    );
+
+    /**
+     * Scenarios begun and not yet ended by any session
+     */
+    static std::size_t runningScenarios();
 
 protected:
     const std::string escapeRegex(const std::string regex) const;
     const std::string escapeCString(const std::string str) const;
 
 private:
-    ContextManager contextManager;
-    bool hasStarted;
+    const ScenarioHooks& currentHooks();
+    void makeCurrent();
+    /**
+     * @param sharedArgs owning pArgs, or null if they are to be copied
+     */
+    InvokeResult invoke(
+        step_id_type id,
+        const InvokeArgs* pArgs,
+        const std::shared_ptr<const InvokeArgs>& sharedArgs
+    );
+    InvokeResult invokeWithinBudget(
+        const StepInfo* stepInfo,
+        const ScenarioHooks& hooks,
+        const InvokeArgs* pArgs,
+        const std::shared_ptr<const InvokeArgs>& sharedArgs
+    );
+    void rememberIdempotent(step_id_type id, const InvokeArgs* pArgs, const InvokeResult& result);
 
-private:
-    static std::shared_ptr<Scenario> currentScenario;
+    /** Shared with the steps left running past their budget */
+    std::shared_ptr<ScenarioContexts> contexts;
+    bool hasStarted;
+    std::string currentFeature;
+    /** Once a feature has begun, results of idempotent steps outlive their scenario */
+    bool featureBoundariesKnown;
+    /** Null for those that could not be taken */
+    std::map<std::string, std::shared_ptr<const ContextSnapshot>> backgroundSnapshots;
+    /** Results of idempotent steps in the feature, by args fingerprint */
+    std::map<step_id_type, std::map<std::string, InvokeResult>> idempotentResults;
+    std::shared_ptr<Scenario> currentScenario;
+    ScenarioHooks scenarioHooks;
+    ScenarioTimeouts timeouts;
+    StepBenchmark benchmark;
+    std::chrono::steady_clock::time_point scenarioStart;
+    /** Only while allocations are tracked */
+    std::optional<AllocationSample> scenarioAllocations;
+    std::optional<TraceContext> remoteParent;
+    /** Only while spans are exported */
+    std::optional<Span> scenarioSpan;
+    TimedStepRunner stepRunner;
+    bool stepAbandoned;
 };
 
 }
@@ -2,10 +2,15 @@
 #define CUKE_CUKEENGINE_HPP_
 
 #include <cstddef>
+#include <functional>
 #include <string>
+#include <string_view>
+#include <unordered_set>
+#include <variant>
 #include <vector>
 
 #include <cucumber-cpp/internal/CukeExport.hpp>
+#include "step/StepExecutor.hpp"
 
 namespace cucumber {
 namespace internal {
@@ -24,13 +29,24 @@ public:
     std::string regexp;
 };
 
+/**
+ * Step to generate a snippet for
+ */
+class CUCUMBER_CPP_EXPORT SnippetStep {
+public:
+    std::string keyword;
+    std::string name;
+    std::string multilineArgClass;
+};
+
 class CUCUMBER_CPP_EXPORT InvokeException {
 private:
-    const std::string message;
+    std::string message;
 
 public:
     InvokeException(const std::string& message);
     InvokeException(const InvokeException& rhs);
+    InvokeException& operator=(const InvokeException& rhs);
 
     const std::string getMessage() const;
 
@@ -39,11 +55,12 @@ public:
 
 class CUCUMBER_CPP_EXPORT InvokeFailureException : public InvokeException {
 private:
-    const std::string exceptionType;
+    std::string exceptionType;
 
 public:
     InvokeFailureException(const std::string& message, const std::string& exceptionType);
     InvokeFailureException(const InvokeFailureException& rhs);
+    InvokeFailureException& operator=(const InvokeFailureException& rhs);
 
     const std::string getExceptionType() const;
 };
@@ -52,6 +69,7 @@ class CUCUMBER_CPP_EXPORT PendingStepException : public InvokeException {
 public:
     PendingStepException(const std::string& message);
     PendingStepException(const PendingStepException& rhs);
+    PendingStepException& operator=(const PendingStepException& rhs);
 };
 
 /**
@@ -69,12 +87,78 @@ public:
     typedef string_array tags_type;
     typedef string_array invoke_args_type;
     typedef string_2d_array invoke_table_type;
+    /**
+     * Outcome of invoking a step: nothing if it passed, otherwise the
+     * InvokeException invokeStep() would have thrown
+     */
+    typedef std::variant<
+        std::monostate,
+        InvokeFailureException,
+        PendingStepException,
+        InvokeException>
+        invoke_result_type;
+    /**
+     * Called once with the outcome of invoking the step
+     */
+    typedef std::function<void(invoke_result_type)> async_callback_type;
 
     /**
      * Finds steps whose regexp match some text.
      */
     virtual std::vector<StepMatch> stepMatches(const std::string& name) const = 0;
 
+    /**
+     * Finds the steps matching each expansion of a Scenario Outline step,
+     * given the text of the step with its <placeholder>s.
+     */
+    virtual std::vector<std::vector<StepMatch>> outlineStepMatches(
+        const std::string& /*templateName*/, const std::vector<std::string>& names
+    ) const {
+        std::vector<std::vector<StepMatch>> matches;
+        matches.reserve(names.size());
+        for (const std::string& name : names) {
+            matches.push_back(stepMatches(name));
+        }
+        return matches;
+    }
+
+    /**
+     * Tells that the following scenarios belong to the named feature, so
+     * that the contexts of the previous one can go. Scenarios of a feature
+     * need not come one after the other.
+     */
+    virtual void beginFeature(const std::string& /*name*/) {
+    }
+
+    /**
+     * Keeps a copy of the contexts the steps of the scenario run so far
+     * left, as its Background did, for later scenarios of the feature to
+     * restore instead of running the same steps.
+     *
+     * @return false if the contexts cannot be copied
+     */
+    virtual bool snapshotBackground(const std::string& /*key*/) {
+        return false;
+    }
+
+    /**
+     * Puts the copy kept under the key in place of the contexts of the
+     * scenario just begun.
+     *
+     * @return false if there is none, the Background steps then having to
+     *         run
+     */
+    virtual bool restoreBackground(const std::string& /*key*/) {
+        return false;
+    }
+
+    /**
+     * Makes the next scenario part of the distributed trace of the W3C
+     * traceparent header given, when spans are exported
+     */
+    virtual void continueTrace(const std::string& /*traceParent*/) {
+    }
+
     /**
      * Starts a scenario.
      */
@@ -89,6 +173,55 @@ public:
         const std::string& id, const invoke_args_type& args, const invoke_table_type& tableArg
     ) = 0;
 
+    /**
+     * Like invokeStep(), but the arguments may be moved into the step instead
+     * of being copied.
+     *
+     * @throws InvokeException if the test fails or it is pending
+     */
+    virtual void invokeStepMovingArgs(
+        const std::string& id, invoke_args_type&& args, invoke_table_type&& tableArg
+    ) {
+        invokeStep(id, args, tableArg);
+    }
+
+    /**
+     * Like invokeStepMovingArgs(), but failing and pending steps are
+     * returned instead of thrown, which spares callers that report them
+     * anyway the cost of unwinding.
+     *
+     * @throws other exceptions than InvokeExceptions
+     */
+    virtual invoke_result_type tryInvokeStep(
+        const std::string& id, invoke_args_type&& args, invoke_table_type&& tableArg
+    ) {
+        try {
+            invokeStepMovingArgs(id, std::move(args), std::move(tableArg));
+        } catch (const InvokeFailureException& e) {
+            return e;
+        } catch (const PendingStepException& e) {
+            return e;
+        } catch (const InvokeException& e) {
+            return e;
+        }
+        return std::monostate();
+    }
+
+    /**
+     * Like tryInvokeStep(), but steps whose body waits asynchronously may
+     * call back later, on a thread of the executor, instead of blocking the
+     * calling thread meanwhile.
+     */
+    virtual void invokeStepAsync(
+        const std::string& id,
+        invoke_args_type&& args,
+        invoke_table_type&& tableArg,
+        StepExecutor& /*executor*/,
+        async_callback_type done
+    ) {
+        done(tryInvokeStep(id, std::move(args), std::move(tableArg)));
+    }
+
     /**
      * Ends a scenario.
      */
@@ -102,6 +235,22 @@ public:
     ) const
         = 0;
 
+    /**
+     * Returns the step definitions for several pending steps, one per
+     * distinct name in the order they first appear, since steps that only
+     * differ by keyword or argument would be defined twice.
+     */
+    virtual std::vector<std::string> snippetTexts(const std::vector<SnippetStep>& steps) const {
+        std::vector<std::string> snippets;
+        std::unordered_set<std::string_view> names;
+        for (const SnippetStep& step : steps) {
+            if (names.insert(step.name).second) {
+                snippets.push_back(snippetText(step.keyword, step.name, step.multilineArgClass));
+            }
+        }
+        return snippets;
+    }
+
     CUCUMBER_CPP_EXPORT CukeEngine();
     CUCUMBER_CPP_EXPORT virtual ~CukeEngine() = default;
 };
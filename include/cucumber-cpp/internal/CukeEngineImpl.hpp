@@ -17,13 +17,42 @@ namespace internal {
 class CUCUMBER_CPP_EXPORT CukeEngineImpl : public CukeEngine {
 private:
     CukeCommands cukeCommands;
+    bool dryRun = false;
 
 public:
+    /**
+     * Only matches steps when set: scenarios neither begin nor end, so that
+     * no contexts are created and no hooks run, and steps pass without
+     * being invoked
+     */
+    void setDryRun(bool dryRun);
+    bool isDryRun() const;
+
     std::vector<StepMatch> stepMatches(const std::string& name) const override;
+    std::vector<std::vector<StepMatch>> outlineStepMatches(
+        const std::string& templateName, const std::vector<std::string>& names
+    ) const override;
+    void beginFeature(const std::string& name) override;
+    bool snapshotBackground(const std::string& key) override;
+    bool restoreBackground(const std::string& key) override;
+    void continueTrace(const std::string& traceParent) override;
     void beginScenario(const tags_type& tags) override;
     void invokeStep(
         const std::string& id, const invoke_args_type& args, const invoke_table_type& tableArg
     ) override;
+    void invokeStepMovingArgs(
+        const std::string& id, invoke_args_type&& args, invoke_table_type&& tableArg
+    ) override;
+    invoke_result_type tryInvokeStep(
+        const std::string& id, invoke_args_type&& args, invoke_table_type&& tableArg
+    ) override;
+    void invokeStepAsync(
+        const std::string& id,
+        invoke_args_type&& args,
+        invoke_table_type&& tableArg,
+        StepExecutor& executor,
+        async_callback_type done
+    ) override;
     void endScenario(const tags_type& tags) override;
     std::string snippetText(
         const std::string& keyword, const std::string& name, const std::string& multilineArgClass
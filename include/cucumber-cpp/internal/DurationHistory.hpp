@@ -0,0 +1,76 @@
+#ifndef CUKE_DURATIONHISTORY_HPP_
+#define CUKE_DURATIONHISTORY_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * How long scenarios and step definitions took in earlier runs, for
+ * scheduling the longest work first. Each new duration is averaged with
+ * the one expected so far.
+ *
+ * Kept in an append-only binary log: an 8 byte header, then one record
+ * per duration of a kind byte, a key and nanoseconds, both 8 bytes little
+ * endian. Opening the log compacts it; a record cut short by a crash is
+ * dropped. Threads may record concurrently.
+ */
+class CUCUMBER_CPP_EXPORT DurationHistory {
+public:
+    typedef std::uint64_t key_type;
+    enum Kind : unsigned char { SCENARIO = 1, STEP = 2 };
+
+    /**
+     * History kept in memory only
+     */
+    DurationHistory() = default;
+    /**
+     * Loads the log if there is one, and appends every duration recorded
+     * from now on to it. A text scenario history, as the wire coordinator
+     * used to keep at the same path, is converted.
+     *
+     * @throws std::runtime_error if it cannot be written, or if the file is
+     *         neither a log nor a text history, leaving the file untouched
+     */
+    explicit DurationHistory(const std::string& path);
+
+    DurationHistory(const DurationHistory&) = delete;
+    DurationHistory& operator=(const DurationHistory&) = delete;
+
+    void record(Kind kind, key_type key, std::chrono::nanoseconds duration);
+
+    std::optional<std::chrono::nanoseconds> expected(Kind kind, key_type key) const;
+    /**
+     * Of everything of that kind with a duration
+     */
+    std::optional<std::chrono::nanoseconds> average(Kind kind) const;
+
+    /**
+     * Stable across processes and builds
+     */
+    static key_type key(std::string_view text);
+
+private:
+    void learn(Kind kind, key_type key, std::chrono::nanoseconds duration);
+
+    mutable std::mutex mutex;
+    std::map<std::pair<Kind, key_type>, std::chrono::nanoseconds> durations;
+    std::map<Kind, std::pair<std::chrono::nanoseconds, std::size_t>> totals;
+    std::ofstream log;
+};
+
+}
+}
+
+#endif /* CUKE_DURATIONHISTORY_HPP_ */
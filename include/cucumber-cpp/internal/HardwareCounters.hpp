@@ -0,0 +1,61 @@
+#ifndef CUKE_HARDWARECOUNTERS_HPP_
+#define CUKE_HARDWARECOUNTERS_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace cucumber {
+namespace internal {
+
+enum HardwareCounter {
+    COUNTED_CYCLES,
+    COUNTED_INSTRUCTIONS,
+    COUNTED_CACHE_MISSES,
+    COUNTED_BRANCH_MISSES,
+    HARDWARE_COUNTER_COUNT
+};
+
+/**
+ * Values of the hardware counters of a thread, 0 for those the processor
+ * does not count
+ */
+struct CUCUMBER_CPP_EXPORT HardwareCounterSample {
+    std::array<std::uint64_t, HARDWARE_COUNTER_COUNT> values{};
+
+    /**
+     * @return what was counted between the earlier sample and this one
+     */
+    HardwareCounterSample since(const HardwareCounterSample& earlier) const;
+};
+
+/**
+ * User space cycles, instructions, cache misses and branch misses of the
+ * calling thread, read from a perf_event_open group the thread opens on
+ * first use. Counts are scaled up while the kernel multiplexes the group
+ * with other events.
+ *
+ * Only available on Linux, when perf_event_paranoid is at most 2 and the
+ * processor exposes its counters, which virtual machines often do not.
+ */
+class CUCUMBER_CPP_EXPORT HardwareCounters {
+public:
+    /**
+     * Whether the counters of the calling thread could be opened
+     */
+    static bool isAvailable();
+
+    /**
+     * @return nothing when unavailable
+     */
+    static std::optional<HardwareCounterSample> sample();
+
+    static const char* name(HardwareCounter counter);
+};
+
+}
+}
+
+#endif /* CUKE_HARDWARECOUNTERS_HPP_ */
@@ -0,0 +1,71 @@
+#ifndef CUKE_IMPACTRECORD_HPP_
+#define CUKE_IMPACTRECORD_HPP_
+
+#include "ScenarioRunner.hpp"
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <iosfwd>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Which step definitions every scenario invoked in a run and whether it
+ * passed, so that the next run may be limited to the scenarios a change
+ * can affect. Scenarios are recognised by their location.
+ *
+ * Step definitions are recognised by the file name of their source, which
+ * keeps no directory. Hooks are not recorded.
+ */
+class CUCUMBER_CPP_EXPORT ImpactRecord {
+public:
+    struct Scenario {
+        bool passed = false;
+        /** Of the step definitions invoked, like "Steps.cpp:12" */
+        std::set<std::string> sources;
+    };
+    typedef std::map<std::string, Scenario> scenarios_type;
+
+    const scenarios_type& scenarios() const;
+
+    void record(const PickledScenario& scenario, const ScenarioResult& result);
+    /**
+     * Takes over what the previous record holds of a scenario that did not
+     * run, if this one holds nothing of it
+     */
+    void keep(const PickledScenario& scenario, const ImpactRecord& previous);
+
+    /**
+     * Whether the scenario has to run again after the files changed: when
+     * it is not recorded, did not pass, or its feature file or one of the
+     * step definitions it invoked changed
+     *
+     * @param changedFiles paths, as relative as they come
+     */
+    bool affects(const PickledScenario& scenario, const std::vector<std::string>& changedFiles)
+        const;
+
+    /**
+     * Reads a record written by save(), adding to this one
+     *
+     * @throws std::runtime_error if a line is malformed
+     */
+    void load(std::istream& in);
+    /**
+     * One line per scenario: "passed" or "failed", its location and the
+     * sources of its step definitions, separated by tabs
+     */
+    void save(std::ostream& out) const;
+
+private:
+    scenarios_type recorded;
+};
+
+}
+}
+
+#endif /* CUKE_IMPACTRECORD_HPP_ */
@@ -38,4 +38,24 @@
     const int class_name ::cukeRegId = registration_fn;                                   \
     void class_name ::bodyWithArgs args /**/
 
+// The body is a coroutine, whose arguments it keeps, see CoroutineStep.hpp
+#define CUKE_CO_OBJECT_(class_name, registration_fn, args)                                  \
+    class class_name : public ::cucumber::internal::CoroutineStep {                         \
+    public:                                                                                 \
+        ::cucumber::StepTask coroutineBody() override {                                     \
+            return invokeWithArgs(*this, &class_name::bodyWithArgs);                        \
+        }                                                                                   \
+        ::cucumber::StepTask bodyWithArgs args;                                             \
+                                                                                            \
+    private:                                                                                \
+        static const int cukeRegId;                                                         \
+    };                                                                                      \
+    static_assert(                                                                          \
+        ::cucumber::internal::takes_arguments_by_value<decltype(&class_name::bodyWithArgs)>:: \
+            value,                                                                          \
+        "Coroutine step bodies take their arguments by value"                               \
+    );                                                                                      \
+    const int class_name ::cukeRegId = registration_fn;                                     \
+    ::cucumber::StepTask class_name ::bodyWithArgs args /**/
+
 #endif /* CUKE_REGISTRATIONMACROS_HPP_ */
@@ -11,9 +11,11 @@ public:
     Scenario(const TagExpression::tag_list& tags = TagExpression::tag_list());
 
     const TagExpression::tag_list& getTags();
+    const TagSet& getTagSet();
 
 private:
     const TagExpression::tag_list tags;
+    const TagSet tagSet;
 };
 
 }
@@ -0,0 +1,221 @@
+#ifndef CUKE_SCENARIORUNNER_HPP_
+#define CUKE_SCENARIORUNNER_HPP_
+
+#include "CukeEngine.hpp"
+#include "DurationHistory.hpp"
+#include "utils/CpuAffinity.hpp"
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+class FeatureSource;
+
+/**
+ * Doc string or data table of a step still in its Gherkin form, viewing
+ * into the feature source. Only the steps that run get theirs decoded.
+ */
+class CUCUMBER_CPP_EXPORT RawStepArgument {
+public:
+    enum Kind { NONE, DOC_STRING, DATA_TABLE };
+
+    Kind kind = NONE;
+    /**
+     * Whole lines between the doc string delimiters, or the table rows
+     */
+    std::string_view lines;
+    /**
+     * Doc string delimiter character and the indentation stripped from its
+     * lines
+     */
+    char delimiter = '"';
+    std::size_t indent = 0;
+    /**
+     * Header and row of the outline example the step was expanded for, as
+     * table rows, whose values replace the placeholders
+     */
+    std::string_view exampleHeader;
+    std::string_view exampleRow;
+
+    std::string decodeDocString() const;
+    CukeEngine::invoke_table_type decodeTable() const;
+};
+
+class CUCUMBER_CPP_EXPORT PickledStep {
+public:
+    /**
+     * Given, When or Then; And and But take the keyword before them
+     */
+    std::string keyword;
+    std::string text;
+    /**
+     * Text of the Scenario Outline step this one was expanded from, with
+     * its <placeholder>s, empty for other steps
+     */
+    std::string templateText;
+    /**
+     * Passed as the last argument of the step when hasDocString is set
+     */
+    std::string docString;
+    bool hasDocString = false;
+    /**
+     * Header row first, empty if the step has no data table
+     */
+    CukeEngine::invoke_table_type table;
+    /**
+     * Takes the place of docString or table when set
+     */
+    RawStepArgument rawArgument;
+
+    bool hasTable() const;
+    std::string decodeDocString() const;
+    CukeEngine::invoke_table_type decodeTable() const;
+};
+
+/**
+ * A scenario with its steps and tags fully resolved, as Cucumber hands them
+ * to the wire server. Tags have no leading '@'.
+ */
+class CUCUMBER_CPP_EXPORT PickledScenario {
+public:
+    std::string name;
+    /**
+     * Where the scenario comes from, as "uri:line", empty if unknown
+     */
+    std::string location;
+    CukeEngine::tags_type tags;
+    std::vector<PickledStep> steps;
+    /**
+     * Number of the first steps that come from Background sections
+     */
+    std::size_t backgroundSteps = 0;
+    /**
+     * Keeps the text raw step arguments view into alive
+     */
+    std::shared_ptr<const FeatureSource> source;
+};
+
+enum RunStatus { RUN_PASSED, RUN_FAILED, RUN_PENDING, RUN_UNDEFINED, RUN_AMBIGUOUS, RUN_SKIPPED };
+
+class CUCUMBER_CPP_EXPORT StepResult {
+public:
+    RunStatus status = RUN_SKIPPED;
+    std::string message;
+    std::string exceptionType;
+    /** Of the step definition invoked, empty if none was */
+    std::string source;
+};
+
+/**
+ * Outcome of a scenario: the status and message of its first step that did
+ * not pass, or of the hook that failed around them.
+ */
+class CUCUMBER_CPP_EXPORT ScenarioResult {
+public:
+    RunStatus status = RUN_PASSED;
+    std::string message;
+    std::vector<StepResult> steps;
+};
+
+/**
+ * Runs scenarios in process on several lanes, each a thread with an engine
+ * of its own, instead of through a wire client.
+ *
+ * Every lane starts with an equal share of the scenarios and steals from
+ * the back of the others once its own are done. Scenarios tagged with the
+ * serial tag are all run by the first lane, one after the other. With a
+ * duration history the shares are dealt out longest scenario first. Engines
+ * share the process-wide BeforeAll and AfterAll hooks, which run once.
+ *
+ * Before any scenario starts, every distinct step text is matched once, the
+ * texts spread over the lanes. Expansions of the same Scenario Outline step
+ * are matched together through CukeEngine::outlineStepMatches. *
+ * A lane may keep several scenarios in flight, each on an engine of its
+ * own. It runs one step at a time, going on with another scenario while
+ * the step of one waits asynchronously, see CO_WHEN.
+ */
+class CUCUMBER_CPP_EXPORT ParallelScenarioRunner {
+public:
+    typedef std::vector<PickledScenario> scenarios_type;
+    typedef std::vector<ScenarioResult> results_type;
+    typedef std::function<std::unique_ptr<CukeEngine>()> engine_factory_type;
+
+    /**
+     * Scenarios skipped once one did not pass, without beginning them: no
+     * contexts are created and no Before hooks run for them
+     */
+    enum FailFast {
+        RUN_ALL,
+        SKIP_ALL_AFTER_FAILURE,
+        /** Those sharing a tag with a scenario that did not pass */
+        SKIP_SHARED_TAGS_AFTER_FAILURE
+    };
+
+    /**
+     * @param lanes Number of scenarios run at once, the calling thread
+     *              included. 0 picks one per hardware thread.
+     */
+    explicit ParallelScenarioRunner(std::size_t lanes = 0);
+
+    std::size_t getLanes() const;
+    std::size_t getScenariosPerLane() const;
+    /**
+     * Scenarios each lane keeps in flight while their steps wait
+     * asynchronously. Defaults to 1, for a scenario at a time.
+     */
+    void setScenariosPerLane(std::size_t scenarios);
+    void setSerialTag(const std::string& tag);
+    /**
+     * Defaults to RUN_ALL. Scenarios already in flight run to their end.
+     */
+    void setFailFast(FailFast failFast);
+    /**
+     * Creates the engine of each lane. Defaults to CukeEngineImpl.
+     */
+    void setEngineFactory(const engine_factory_type& engineFactory);
+    /**
+     * History to start the longest scenarios first from, and to record how
+     * long each one took to. None by default.
+     */
+    void setDurationHistory(DurationHistory* history);
+    /**
+     * Runs the Background steps of a feature only for its first scenario
+     * on an engine, later ones restoring copies of the contexts they left,
+     * see CukeEngine::snapshotBackground(). Off by default, as it is only
+     * right for Background steps whose effects all lie in scenario
+     * contexts.
+     */
+    void setBackgroundSnapshots(bool enabled);
+    /**
+     * Pins each lane to a cpu of the list in turn while it runs, the
+     * calling thread for lane 0 included. Lanes run anywhere by default.
+     */
+    void setCpus(const cpu_list_type& cpus);
+
+    /**
+     * @return the results in the order of the scenarios
+     */
+    results_type run(const scenarios_type& scenarios) const;
+
+private:
+    std::size_t lanes;
+    std::size_t scenariosPerLane;
+    std::string serialTag;
+    FailFast failFast;
+    engine_factory_type engineFactory;
+    DurationHistory* durationHistory;
+    bool backgroundSnapshots;
+    cpu_list_type cpus;
+};
+
+}
+}
+
+#endif /* CUKE_SCENARIORUNNER_HPP_ */
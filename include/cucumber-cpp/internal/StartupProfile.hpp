@@ -0,0 +1,88 @@
+#ifndef CUKE_STARTUPPROFILE_HPP_
+#define CUKE_STARTUPPROFILE_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+enum StartupOperation {
+    STARTUP_REGISTER_STEP,
+    STARTUP_TRANSFORM,
+    STARTUP_COMPILE_REGEX,
+    STARTUP_LOAD_PARAMETER_TYPES,
+    STARTUP_OPERATION_COUNT
+};
+
+struct CUCUMBER_CPP_EXPORT StartupEntry {
+    StartupOperation operation;
+    /** Step matcher, expression, regular expression or file */
+    std::string subject;
+    /** File and line of the step definition, only when registering steps */
+    std::string source;
+    std::chrono::steady_clock::duration elapsed;
+};
+
+/**
+ * Durations of what step libraries do while being loaded: step definitions
+ * register in static initializers, before any flag could enable this, so
+ * recording is on until finished. Registering a step includes the
+ * compilation of its matcher, which includes transforming a Cucumber
+ * Expression.
+ */
+class CUCUMBER_CPP_EXPORT StartupProfile {
+public:
+    static void record(
+        StartupOperation operation,
+        const std::string& subject,
+        const std::string& source,
+        std::chrono::steady_clock::duration elapsed
+    );
+
+    /**
+     * Stops recording, keeping what was recorded so far
+     */
+    static void finish();
+    static bool isRecording();
+
+    static std::vector<StartupEntry> entries();
+
+    /**
+     * Writes the totals of every operation and of every step definition
+     * file, then the slowest operations
+     */
+    static void report(std::ostream& out, std::size_t slowest = 20);
+};
+
+/**
+ * Records the time until it leaves its scope while startup is recorded
+ */
+class CUCUMBER_CPP_EXPORT ScopedStartupTiming {
+public:
+    ScopedStartupTiming(
+        StartupOperation operation, const std::string& subject, const std::string& source = ""
+    );
+    ~ScopedStartupTiming();
+
+    ScopedStartupTiming(const ScopedStartupTiming&) = delete;
+    ScopedStartupTiming& operator=(const ScopedStartupTiming&) = delete;
+
+private:
+    const StartupOperation operation;
+    const bool recording;
+    // Copied only while recording
+    const std::string subject;
+    const std::string source;
+    std::chrono::steady_clock::time_point start;
+};
+
+}
+}
+
+#endif /* CUKE_STARTUPPROFILE_HPP_ */
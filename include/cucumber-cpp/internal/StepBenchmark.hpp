@@ -0,0 +1,90 @@
+#ifndef CUKE_STEPBENCHMARK_HPP_
+#define CUKE_STEPBENCHMARK_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+class InvokeResult;
+
+/**
+ * Repeated invocations of the steps of a scenario, none unless tagged like
+ * "@benchmark(iterations=1000,warmup=100,p99=2ms)".
+ *
+ * Every step body runs warmup times, then iterations times measured, within
+ * the Around hooks that wrap it once. The step fails if a limit among mean,
+ * p50, p90, p99 and max is exceeded. Durations are in ns, us, ms or s. The
+ * warm-up defaults to a tenth of the iterations.
+ */
+class CUCUMBER_CPP_EXPORT StepBenchmark {
+public:
+    typedef std::chrono::nanoseconds duration_type;
+
+    struct Statistics {
+        std::size_t iterations = 0;
+        duration_type mean{0};
+        duration_type stddev{0};
+        duration_type min{0};
+        duration_type p50{0};
+        duration_type p90{0};
+        duration_type p99{0};
+        duration_type max{0};
+    };
+
+    std::size_t iterations = 0;
+    std::size_t warmup = 0;
+    /** Zero for none */
+    duration_type mean{0};
+    duration_type p50{0};
+    duration_type p90{0};
+    duration_type p99{0};
+    duration_type max{0};
+
+    StepBenchmark() = default;
+    StepBenchmark(const StepBenchmark&) = default;
+    StepBenchmark& operator=(const StepBenchmark&) = default;
+    ~StepBenchmark();
+
+    /**
+     * @throws std::invalid_argument if a benchmark tag is malformed
+     */
+    static StepBenchmark fromTags(const std::vector<std::string>& tags);
+    /**
+     * @throws std::invalid_argument if the duration is malformed
+     */
+    static duration_type parseDuration(const std::string& duration);
+    static Statistics statistics(std::vector<duration_type> samples);
+
+    bool isEnabled() const;
+
+    /**
+     * Runs the step as benchmarked, once if not enabled
+     *
+     * @param measured Called with the duration of every measured iteration
+     * @return the first result that is not a success, a failure if a limit
+     *         was exceeded, a success otherwise
+     */
+    InvokeResult run(
+        const std::function<InvokeResult()>& step,
+        const std::function<void(duration_type)>& measured = nullptr
+    ) const;
+
+    /**
+     * The benchmark of the session running on the calling thread, like
+     * ScenarioTimeouts::current()
+     */
+    static StepBenchmark& current();
+    void makeCurrent();
+};
+
+}
+}
+
+#endif /* CUKE_STEPBENCHMARK_HPP_ */
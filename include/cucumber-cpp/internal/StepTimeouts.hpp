@@ -0,0 +1,98 @@
+#ifndef CUKE_STEPTIMEOUTS_HPP_
+#define CUKE_STEPTIMEOUTS_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cucumber {
+
+namespace internal {
+
+/**
+ * Time budgets of the scenario run by a session, zero for none.
+ *
+ * The tag "@timeout(500ms)" gives each step of a scenario its budget and
+ * "@scenario_timeout(30s)" all its steps together. Durations are in ms, s
+ * or min. Before hooks may set them too, see setStepTimeout().
+ */
+class CUCUMBER_CPP_EXPORT ScenarioTimeouts {
+public:
+    typedef std::chrono::milliseconds duration_type;
+
+    duration_type step{0};
+    duration_type scenario{0};
+
+    ScenarioTimeouts() = default;
+    ScenarioTimeouts(const ScenarioTimeouts&) = default;
+    ScenarioTimeouts& operator=(const ScenarioTimeouts&) = default;
+    ~ScenarioTimeouts();
+
+    /**
+     * @throws std::invalid_argument if a timeout tag is malformed
+     */
+    static ScenarioTimeouts fromTags(const std::vector<std::string>& tags);
+    /**
+     * @throws std::invalid_argument if the duration is malformed
+     */
+    static duration_type parseDuration(const std::string& duration);
+
+    /**
+     * The budgets of the session running on the calling thread, like
+     * ScenarioContexts::current()
+     */
+    static ScenarioTimeouts& current();
+    void makeCurrent();
+};
+
+/**
+ * Runs steps on a thread of its own, kept from one step to the next, so
+ * that the session can give up on a step that overruns its budget.
+ *
+ * The Watchdog wakes the session up once the budget is spent. C++ has no
+ * way to stop the step, so it is left running on its thread, which is
+ * detached and replaced for the next steps. The step keeps whatever it was
+ * given alive.
+ */
+class CUCUMBER_CPP_EXPORT TimedStepRunner {
+public:
+    typedef std::function<void()> step_type;
+
+    TimedStepRunner() = default;
+    ~TimedStepRunner();
+
+    TimedStepRunner(const TimedStepRunner&) = delete;
+    TimedStepRunner& operator=(const TimedStepRunner&) = delete;
+
+    /**
+     * @return false if the step did not return within the budget
+     * @throws whatever the step throws
+     */
+    bool run(step_type step, std::chrono::nanoseconds budget);
+
+private:
+    struct Worker;
+    std::shared_ptr<Worker> worker;
+};
+
+}
+
+/**
+ * Time budget of each remaining step of the current scenario, zero for
+ * none. Meant for before hooks, as steps given a budget run on another
+ * thread.
+ */
+CUCUMBER_CPP_EXPORT void setStepTimeout(std::chrono::milliseconds timeout);
+/**
+ * Time budget of all the steps of the current scenario together, counted
+ * from its start
+ */
+CUCUMBER_CPP_EXPORT void setScenarioTimeout(std::chrono::milliseconds timeout);
+
+}
+
+#endif /* CUKE_STEPTIMEOUTS_HPP_ */
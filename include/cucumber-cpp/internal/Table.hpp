@@ -2,15 +2,28 @@
 #define CUKE_TABLE_HPP_
 
 #include <cucumber-cpp/internal/CukeExport.hpp>
+#include "utils/StringConversion.hpp"
 
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <map>
 #include <string>
 #include <stdexcept>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
 
 namespace cucumber {
 namespace internal {
 
+/**
+ * Data table stored row after row in a single cell array, with the column
+ * names kept once for the whole table.
+ */
 class CUCUMBER_CPP_EXPORT Table {
 private:
     typedef std::vector<std::string> basic_type;
@@ -20,6 +33,88 @@ public:
     typedef basic_type columns_type;
     typedef basic_type row_type;
     typedef std::vector<hash_row_type> hashes_type;
+    typedef basic_type::size_type size_type;
+
+    /**
+     * Cells of a row, read in place
+     */
+    class RowView {
+    public:
+        typedef basic_type::const_iterator const_iterator;
+
+        RowView(const_iterator first, size_type size) :
+            first(first),
+            cellCount(size) {
+        }
+
+        const_iterator begin() const {
+            return first;
+        }
+        const_iterator end() const {
+            return first + cellCount;
+        }
+        size_type size() const {
+            return cellCount;
+        }
+        const std::string& operator[](size_type column) const {
+            return first[column];
+        }
+
+    private:
+        const_iterator first;
+        size_type cellCount;
+    };
+
+    /**
+     * Forward iterator over the rows, building nothing for them
+     */
+    class RowIterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef RowView value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const RowView* pointer;
+        typedef RowView reference;
+
+        RowIterator(basic_type::const_iterator cell, size_type columnCount) :
+            cell(cell),
+            columnCount(columnCount) {
+        }
+
+        RowView operator*() const {
+            return RowView(cell, columnCount);
+        }
+        RowIterator& operator++() {
+            cell += columnCount;
+            return *this;
+        }
+        RowIterator operator++(int) {
+            RowIterator previous(*this);
+            ++*this;
+            return previous;
+        }
+        bool operator==(const RowIterator& other) const {
+            return cell == other.cell;
+        }
+        bool operator!=(const RowIterator& other) const {
+            return cell != other.cell;
+        }
+
+    private:
+        basic_type::const_iterator cell;
+        size_type columnCount;
+    };
+
+    struct RowRange {
+        RowIterator first, last;
+
+        RowIterator begin() const {
+            return first;
+        }
+        RowIterator end() const {
+            return last;
+        }
+    };
 
     /**
      * @brief addColumn
@@ -27,7 +122,7 @@ public:
      *
      * @throws std::runtime_error
      */
-    void addColumn(const std::string column);
+    void addColumn(std::string column);
 
     /**
      * @brief addRow
@@ -37,15 +132,123 @@ public:
      * @throws std::runtime_error
      */
     void addRow(const row_type& row);
+    /**
+     * Moves the cells in, freeing the row as it goes
+     */
+    void addRow(row_type&& row);
+    /**
+     * Makes room for as many rows, so that adding them moves no cells
+     */
+    void reserveRows(size_type count);
+
+    /**
+     * Rows as maps from column name to cell. They are only built the first
+     * time they are asked for, so prefer cell() on large tables. Threads
+     * may ask for them at once.
+     */
     const hashes_type& hashes() const;
+    /**
+     * Rows in order, viewed where they are stored: the cheapest way
+     * through large tables
+     */
+    RowRange rows() const;
+
+    const columns_type& getColumns() const;
+    size_type rowCount() const;
+
+    /**
+     * @throws std::out_of_range
+     */
+    const std::string& cell(size_type row, size_type column) const;
+
+    /**
+     * @throws std::out_of_range if there is no such row or column
+     */
+    const std::string& cell(size_type row, const std::string& column) const;
+
+    /**
+     * @throws std::out_of_range if there is no such column
+     */
+    size_type columnIndex(const std::string& column) const;
+
+    /**
+     * All cells of a numeric column, converted on the first call and kept
+     * until the next row is added. Threads may ask for them at once. Cells
+     * are read as step arguments of type T are.
+     *
+     * @throws std::out_of_range if there is no such column
+     * @throws std::invalid_argument if a cell is not a number of type T
+     */
+    template<typename T>
+    const std::vector<T>& column(const std::string& column) const;
 
 private:
-    hash_row_type buildHashRow(const row_type& row);
+    template<typename T>
+    static T parseCell(const std::string& cell);
+
+    typedef std::pair<size_type, std::type_index> typed_column_key_type;
+
+    /**
+     * Built by const accessors, which threads may call at once. Copies of
+     * the table start without them.
+     */
+    struct Caches {
+        Caches() = default;
+        Caches(const Caches&) noexcept {
+        }
+        Caches& operator=(const Caches&) noexcept {
+            hashRows.clear();
+            typedColumns.clear();
+            return *this;
+        }
+
+        std::mutex mutex;
+        hashes_type hashRows;
+        std::map<typed_column_key_type, std::shared_ptr<const void>> typedColumns;
+    };
 
     columns_type columns;
-    hashes_type rows;
+    basic_type cells;
+    mutable Caches caches;
 };
 
+template<typename T>
+const std::vector<T>& Table::column(const std::string& column) const {
+    static_assert(
+        std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+        "Typed table columns hold integral or floating point numbers"
+    );
+    const size_type index = columnIndex(column);
+    std::lock_guard<std::mutex> lock(caches.mutex);
+    std::shared_ptr<const void>& cached
+        = caches.typedColumns[typed_column_key_type(index, std::type_index(typeid(T)))];
+    if (!cached) {
+        const std::shared_ptr<std::vector<T>> values = std::make_shared<std::vector<T>>();
+        values->reserve(rowCount());
+        for (size_type row = 0; row < rowCount(); ++row) {
+            values->push_back(parseCell<T>(cells[row * columns.size() + index]));
+        }
+        cached = values;
+    }
+    return *static_cast<const std::vector<T>*>(cached.get());
+}
+
+template<typename T>
+T Table::parseCell(const std::string& cell) {
+    T value;
+    const char* const end = cell.data() + cell.size();
+    const std::from_chars_result result = std::from_chars(cell.data(), end, value);
+    if (result.ec == std::errc() && result.ptr == end) {
+        return value;
+    }
+    // Signs, spaces and the like, taken as step arguments take them
+    try {
+        return fromString<T>(cell);
+    } catch (const std::invalid_argument&) {
+        throw std::invalid_argument("Cannot convert table cell: " + cell);
+    }
+}
+
 }
 }
 
@@ -0,0 +1,189 @@
+#ifndef CUKE_TELEMETRY_HPP_
+#define CUKE_TELEMETRY_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Identifies a span within a distributed trace, as W3C Trace Context
+ * traceparent headers carry it
+ */
+struct CUCUMBER_CPP_EXPORT TraceContext {
+    /** 32 lowercase hexadecimal digits */
+    std::string traceId;
+    /** 16 lowercase hexadecimal digits */
+    std::string spanId;
+    bool sampled = true;
+
+    /**
+     * @return nothing if the header is malformed or its ids are all zero
+     */
+    static std::optional<TraceContext> parse(const std::string& traceParent);
+    std::string traceParent() const;
+};
+
+/**
+ * OpenTelemetry span of a scenario or a step
+ */
+struct CUCUMBER_CPP_EXPORT Span {
+    typedef std::vector<std::pair<std::string, std::string>> attributes_type;
+
+    TraceContext context;
+    /** Empty for the root span of a trace */
+    std::string parentSpanId;
+    std::string name;
+    std::chrono::system_clock::time_point start;
+    std::chrono::system_clock::time_point end;
+    attributes_type attributes;
+    bool failed = false;
+    std::string statusMessage;
+};
+
+class CUCUMBER_CPP_EXPORT SpanExporter {
+public:
+    /**
+     * Called from the thread of the BatchSpanProcessor only
+     */
+    virtual void exportSpans(const std::vector<Span>& spans) = 0;
+
+    virtual ~SpanExporter() = default;
+};
+
+/**
+ * Exports spans in the OTLP/HTTP JSON encoding, leaving the transport to a
+ * function posting the request body to the /v1/traces endpoint of a
+ * collector
+ */
+class CUCUMBER_CPP_EXPORT OtlpJsonExporter : public SpanExporter {
+public:
+    typedef std::function<void(const std::string& body)> post_type;
+
+    explicit OtlpJsonExporter(post_type post, std::string serviceName = "cucumber-cpp");
+
+    void exportSpans(const std::vector<Span>& spans) override;
+
+    static std::string encode(const std::vector<Span>& spans, const std::string& serviceName);
+
+private:
+    const post_type post;
+    const std::string serviceName;
+};
+
+/**
+ * Hands ended spans over to an exporter in batches, from a thread of its
+ * own, so that the threads running steps never wait for it. Spans ending
+ * while the queue is full are dropped.
+ */
+class CUCUMBER_CPP_EXPORT BatchSpanProcessor {
+public:
+    BatchSpanProcessor(
+        std::unique_ptr<SpanExporter> exporter,
+        std::size_t maxQueueSize = 2048,
+        std::size_t maxBatchSize = 512,
+        std::chrono::milliseconds scheduleDelay = std::chrono::milliseconds(1000)
+    );
+    /**
+     * Exports the spans still queued
+     */
+    ~BatchSpanProcessor();
+
+    BatchSpanProcessor(const BatchSpanProcessor&) = delete;
+    BatchSpanProcessor& operator=(const BatchSpanProcessor&) = delete;
+
+    void onEnd(Span span);
+    /**
+     * Waits until the spans queued so far were exported
+     */
+    void forceFlush();
+
+    std::uint64_t getDropped() const;
+    /** Batches the exporter threw on */
+    std::uint64_t getFailedExports() const;
+
+private:
+    void run();
+    std::vector<Span> takeBatch();
+
+    const std::unique_ptr<SpanExporter> exporter;
+    const std::size_t maxQueueSize;
+    const std::size_t maxBatchSize;
+    const std::chrono::milliseconds scheduleDelay;
+    mutable std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable exported;
+    std::deque<Span> queue;
+    std::uint64_t queued;
+    std::uint64_t done;
+    std::uint64_t dropped;
+    std::uint64_t failedExports;
+    bool flushing;
+    bool stopping;
+    std::thread thread;
+};
+
+/**
+ * Spans of the scenarios and steps run by CukeCommands, none until a
+ * processor is set
+ */
+class CUCUMBER_CPP_EXPORT Telemetry {
+public:
+    /**
+     * @param processor to outlive the scenarios, none when null
+     */
+    static void setProcessor(BatchSpanProcessor* processor);
+    static bool isEnabled();
+
+    /**
+     * A new span, in the trace of the parent if any, a new trace otherwise
+     */
+    static Span startSpan(const std::string& name, const TraceContext* parent);
+    static void endSpan(Span& span);
+
+    /**
+     * traceparent header of the step running on the calling thread, to
+     * pass on to the system under test so that its spans join the trace.
+     * Empty outside of a traced step.
+     */
+    static std::string currentTraceParent();
+};
+
+/**
+ * Span of a step, current on the calling thread until it leaves its scope
+ * and ends
+ */
+class CUCUMBER_CPP_EXPORT ScopedSpan {
+public:
+    ScopedSpan(const std::string& name, const TraceContext& parent);
+    ~ScopedSpan();
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+    void setAttribute(const std::string& key, const std::string& value);
+    void fail(const std::string& message);
+
+private:
+    Span span;
+    const TraceContext* const previous;
+};
+
+}
+}
+
+#endif /* CUKE_TELEMETRY_HPP_ */
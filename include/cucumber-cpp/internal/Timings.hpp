@@ -0,0 +1,242 @@
+#ifndef CUKE_TIMINGS_HPP_
+#define CUKE_TIMINGS_HPP_
+
+#include "AllocationTracking.hpp"
+#include "HardwareCounters.hpp"
+#include "step/StepManager.hpp"
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include <cucumber-cpp/internal/DurationHistory.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <optional>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Latency histogram in nanoseconds with buckets of logarithmically growing
+ * width (HDR style), keeping percentiles within about 6% of the recorded
+ * values. Count, total and maximum are exact.
+ *
+ * A single thread may record while others read, neither taking a lock.
+ */
+class CUCUMBER_CPP_EXPORT LatencyHistogram {
+public:
+    typedef std::uint64_t value_type;
+
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+    static constexpr unsigned SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    /** Longer durations, of about 18 minutes, share the last bucket */
+    static constexpr unsigned MAX_VALUE_BITS = 40;
+    static constexpr std::size_t BUCKET_COUNT =
+        (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram();
+    LatencyHistogram(const LatencyHistogram& other);
+    LatencyHistogram& operator=(const LatencyHistogram& other);
+
+    void record(value_type nanoseconds);
+    void add(const LatencyHistogram& other);
+
+    std::uint64_t getCount() const;
+    value_type getTotal() const;
+    value_type getMax() const;
+
+    /**
+     * @param percent Between 0 and 100
+     * @return The highest value of the bucket holding the percentile, 0 when
+     *         nothing was recorded
+     */
+    value_type percentile(double percent) const;
+
+    static std::size_t bucketIndex(value_type nanoseconds);
+    static value_type bucketUpperValue(std::size_t index);
+
+private:
+    std::array<std::atomic<std::uint32_t>, BUCKET_COUNT> buckets;
+    std::atomic<std::uint64_t> count;
+    std::atomic<value_type> total;
+    std::atomic<value_type> max;
+};
+
+enum TimedOperation {
+    TIMED_INVOKE,
+    TIMED_STEP_MATCHES,
+    TIMED_HOOKS,
+    TIMED_WIRE_REQUESTS,
+    TIMED_OPERATION_COUNT
+};
+
+/**
+ * Allocations of scenarios or of the invocations of a step definition, a
+ * value for each
+ */
+struct CUCUMBER_CPP_EXPORT AllocationHistograms {
+    LatencyHistogram allocations;
+    LatencyHistogram bytes;
+    /** Bytes allocated beyond those freed, none if fewer */
+    LatencyHistogram retainedBytes;
+    /** Growth of the peak resident set size of the whole process */
+    LatencyHistogram peakResidentGrowth;
+
+    void add(const AllocationHistograms& other);
+};
+
+/**
+ * Hardware counts of the invocations of a step definition, a value for
+ * each
+ */
+struct CUCUMBER_CPP_EXPORT HardwareCounterHistograms {
+    std::array<LatencyHistogram, HARDWARE_COUNTER_COUNT> counters;
+
+    void add(const HardwareCounterHistograms& other);
+};
+
+struct CUCUMBER_CPP_EXPORT TimingSnapshot {
+    typedef std::map<step_id_type, LatencyHistogram> steps_type;
+    typedef std::map<step_id_type, AllocationHistograms> step_allocations_type;
+    typedef std::map<step_id_type, HardwareCounterHistograms> step_counters_type;
+
+    std::array<LatencyHistogram, TIMED_OPERATION_COUNT> operations;
+    /** Invocations of each step definition */
+    steps_type steps;
+    /** Measured iterations of the benchmarked step definitions */
+    steps_type benchmarks;
+    AllocationHistograms scenarioAllocations;
+    step_allocations_type stepAllocations;
+    step_counters_type stepCounters;
+};
+
+/**
+ * Process wide timings of the operations of a test run, disabled by default.
+ *
+ * Every thread records into histograms of its own without locking, which
+ * snapshots merge. Timings are never reset: threads that end hand theirs
+ * over to the snapshots.
+ */
+class CUCUMBER_CPP_EXPORT Timings {
+public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /**
+     * @param stepId Only for TIMED_INVOKE
+     */
+    static void record(
+        TimedOperation operation,
+        std::chrono::steady_clock::duration elapsed,
+        step_id_type stepId = 0
+    );
+
+    /**
+     * Records a measured iteration of a benchmarked step, see StepBenchmark
+     */
+    static void recordBenchmark(std::chrono::nanoseconds elapsed, step_id_type stepId);
+
+    /**
+     * Records the allocations of scenarios and step invocations as well,
+     * when the step binary counts them with CUKE_TRACK_ALLOCATIONS().
+     * Disabled by default. Only the allocations of the thread running the
+     * scenario count, so this is only meaningful while each thread runs one
+     * scenario at a time.
+     */
+    static void setAllocationTracking(bool enabled);
+    static bool isTrackingAllocations();
+    /**
+     * Records what was allocated on the calling thread since the sample
+     */
+    static void recordScenarioAllocations(const AllocationSample& since);
+    static void recordStepAllocations(const AllocationSample& since, step_id_type stepId);
+
+    /**
+     * Records the hardware counts of step invocations as well, on the
+     * threads where HardwareCounters are available. Disabled by default.
+     */
+    static void setHardwareCounters(bool enabled);
+    static bool isCountingHardware();
+    static void recordStepCounters(const HardwareCounterSample& counted, step_id_type stepId);
+
+    static TimingSnapshot snapshot();
+
+    /**
+     * Writes the operations and the step definitions, slowest in total first,
+     * then the benchmarked ones, then their allocations if tracked, most retained bytes first, and
+     * their hardware counts if any, most cycles first
+     */
+    static void report(std::ostream& out);
+
+    /**
+     * Stream receiving the report once the AfterAll hooks ran, none when null
+     */
+    static void setAfterAllReport(std::ostream* out);
+    /**
+     * History receiving the mean duration of every step definition once the
+     * AfterAll hooks ran, keyed by its pattern, none when null
+     */
+    static void setDurationHistory(DurationHistory* history);
+    static void afterAll();
+};
+
+/**
+ * Records the time until it leaves its scope when timings are enabled
+ */
+class CUCUMBER_CPP_EXPORT ScopedTiming {
+public:
+    explicit ScopedTiming(TimedOperation operation, step_id_type stepId = 0);
+    ~ScopedTiming();
+
+    ScopedTiming(const ScopedTiming&) = delete;
+    ScopedTiming& operator=(const ScopedTiming&) = delete;
+
+private:
+    const TimedOperation operation;
+    const step_id_type stepId;
+    const bool enabled;
+    std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * Records the allocations of a step invocation until it leaves its scope,
+ * when they are tracked
+ */
+class CUCUMBER_CPP_EXPORT ScopedAllocations {
+public:
+    explicit ScopedAllocations(step_id_type stepId);
+    ~ScopedAllocations();
+
+    ScopedAllocations(const ScopedAllocations&) = delete;
+    ScopedAllocations& operator=(const ScopedAllocations&) = delete;
+
+private:
+    const step_id_type stepId;
+    const bool enabled;
+    AllocationSample start;
+};
+
+/**
+ * Records the hardware counts of a step invocation until it leaves its
+ * scope, when they are counted
+ */
+class CUCUMBER_CPP_EXPORT ScopedHardwareCounters {
+public:
+    explicit ScopedHardwareCounters(step_id_type stepId);
+    ~ScopedHardwareCounters();
+
+    ScopedHardwareCounters(const ScopedHardwareCounters&) = delete;
+    ScopedHardwareCounters& operator=(const ScopedHardwareCounters&) = delete;
+
+private:
+    const step_id_type stepId;
+    std::optional<HardwareCounterSample> start;
+};
+
+}
+}
+
+#endif /* CUKE_TIMINGS_HPP_ */
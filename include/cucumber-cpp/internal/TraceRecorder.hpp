@@ -0,0 +1,91 @@
+#ifndef CUKE_TRACERECORDER_HPP_
+#define CUKE_TRACERECORDER_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+struct CUCUMBER_CPP_EXPORT TraceEvent {
+    /** scenario, before, around, after_step, after, step_matches or invoke */
+    const char* category;
+    std::string name;
+    /** File and line of the step definition, or the feature of a scenario */
+    std::string source;
+    /** Of the steady clock, shared by the processes of a host */
+    std::chrono::steady_clock::time_point begin;
+    std::chrono::steady_clock::duration duration;
+    /** Numbered in the order threads first recorded, from 1 */
+    std::uint32_t thread;
+};
+
+/**
+ * Timeline of the scenarios, hooks, step matches and invocations of a run,
+ * written in the Chrome Trace Event format that chrome://tracing and the
+ * Perfetto UI open. Disabled by default.
+ *
+ * Every thread records into a buffer of its own, which snapshots gather.
+ * Events are kept until the end of the process.
+ */
+class CUCUMBER_CPP_EXPORT TraceRecorder {
+public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static void record(
+        const char* category,
+        std::string_view name,
+        std::string_view source,
+        std::chrono::steady_clock::time_point begin,
+        std::chrono::steady_clock::time_point end
+    );
+
+    /**
+     * @return the events of every thread, earliest first
+     */
+    static std::vector<TraceEvent> events();
+
+    /**
+     * Writes the events as a JSON trace, an object whose traceEvents are
+     * complete events of this process
+     */
+    static void write(std::ostream& out);
+
+    /**
+     * File receiving the trace once the AfterAll hooks ran, none when empty
+     */
+    static void setAfterAllFile(const std::string& path);
+    static void afterAll();
+};
+
+/**
+ * Records an event lasting until it leaves its scope when tracing is
+ * enabled. The name and source are only viewed until then.
+ */
+class CUCUMBER_CPP_EXPORT ScopedTraceEvent {
+public:
+    ScopedTraceEvent(const char* category, std::string_view name, std::string_view source = "");
+    ~ScopedTraceEvent();
+
+    ScopedTraceEvent(const ScopedTraceEvent&) = delete;
+    ScopedTraceEvent& operator=(const ScopedTraceEvent&) = delete;
+
+private:
+    const char* const category;
+    const std::string_view name;
+    const std::string_view source;
+    const bool enabled;
+    std::chrono::steady_clock::time_point begin;
+};
+
+}
+}
+
+#endif /* CUKE_TRACERECORDER_HPP_ */
@@ -1,17 +1,55 @@
 #ifndef CUKE_PROTOCOLHANDLER_HPP_
 #define CUKE_PROTOCOLHANDLER_HPP_
 
+#include <memory>
 #include <string>
 
 namespace cucumber {
 namespace internal {
 
+/**
+ * Request decoded ahead of being handled, see ProtocolHandler::prepare()
+ */
+class PreparedRequest {
+public:
+    virtual ~PreparedRequest() = default;
+};
+
 /**
  * Protocol that reads one command for each input line.
  */
 class ProtocolHandler {
 public:
     virtual std::string handle(const std::string& request) const = 0;
+
+    /**
+     * Decodes a request ahead of handling it, possibly on another thread
+     * while earlier requests are being handled. Null if the request cannot
+     * be decoded ahead, like one changing how the next requests are read:
+     * no request is read after it until it has been handled.
+     */
+    virtual std::shared_ptr<const PreparedRequest> prepare(const std::string& /*request*/) const {
+        return nullptr;
+    }
+
+    /**
+     * Handles a request, given what prepare() returned for it
+     */
+    virtual std::string handlePrepared(
+        const std::string& request, const PreparedRequest* /*prepared*/
+    ) const {
+        return handle(request);
+    }
+
+    /**
+     * Whether the next requests and their responses are binary messages,
+     * each preceded by its length as 4 bytes in network byte order,
+     * instead of lines.
+     */
+    virtual bool usesBinaryFrames() const {
+        return false;
+    }
+
     virtual ~ProtocolHandler() = default;
 };
 
@@ -0,0 +1,135 @@
+#ifndef CUKE_SHAREDMEMORYSERVER_HPP_
+#define CUKE_SHAREDMEMORYSERVER_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include "ProtocolHandler.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+#if defined(__linux__)
+
+namespace cucumber {
+namespace internal {
+
+class SharedMemorySegment;
+
+/**
+ * Server for a client on the same host, exchanging messages through a
+ * shared memory segment instead of a socket: a ring buffer for requests and
+ * another one for responses, the side waiting for the other one spinning
+ * briefly, then sleeping on a futex. Each message is a line, or a binary
+ * frame, without its delimiter or length prefix.
+ *
+ * A segment serves one client at a time, until it disconnects or its
+ * process is gone.
+ */
+class CUCUMBER_CPP_EXPORT SharedMemoryServer {
+public:
+    /**
+     * Creates the protocol handler, and with that the state, of a session
+     */
+    typedef std::function<std::unique_ptr<const ProtocolHandler>()> session_factory_type;
+
+    static const std::size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    /**
+     * Constructor for DI
+     */
+    SharedMemoryServer(const ProtocolHandler* protocolHandler);
+    ~SharedMemoryServer();
+
+    SharedMemoryServer(const SharedMemoryServer&) = delete;
+    SharedMemoryServer& operator=(const SharedMemoryServer&) = delete;
+
+    /**
+     * Creates the segment, replacing one left behind under the same name
+     *
+     * @param name of the segment, as for shm_open(), like "/cucumber-cpp"
+     * @param capacity of each ring buffer in bytes; longer messages go
+     *        through in several parts
+     * @throws std::system_error if the segment cannot be created
+     */
+    void listen(const std::string& name, std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Name of the segment this server is listening on, empty if none
+     */
+    const std::string& listenName() const;
+
+    /**
+     * Longest request a client may send, 16 MiB by default. The session of
+     * a longer one ends without reading it.
+     */
+    void setMaxMessageLength(std::size_t length);
+
+    /**
+     * Serve one client until it disconnects
+     */
+    void acceptOnce();
+
+    /**
+     * Serve clients one after the other, each with a protocol handler of
+     * its own.
+     *
+     * @param maxSessions number of clients after which no more are served,
+     *        or 0 to serve forever
+     */
+    void acceptSessions(const session_factory_type& newSession, std::size_t maxSessions = 0);
+
+private:
+    void serve(const ProtocolHandler& handler);
+
+    const ProtocolHandler* protocolHandler;
+    std::string name;
+    std::unique_ptr<SharedMemorySegment> segment;
+    std::size_t maxMessageLength;
+};
+
+/**
+ * Client of a SharedMemoryServer, for a runner or a bridge to a runner on
+ * the same host
+ */
+class CUCUMBER_CPP_EXPORT SharedMemoryClient {
+public:
+    /**
+     * @throws std::system_error if no server listens under that name
+     * @throws std::runtime_error if the server is busy with another client
+     */
+    explicit SharedMemoryClient(const std::string& name);
+    /**
+     * Disconnects, which ends the session on the server
+     */
+    ~SharedMemoryClient();
+
+    SharedMemoryClient(const SharedMemoryClient&) = delete;
+    SharedMemoryClient& operator=(const SharedMemoryClient&) = delete;
+
+    /**
+     * Sends a request without waiting for its response, so that requests
+     * may be pipelined
+     *
+     * @throws std::runtime_error if the server is gone
+     */
+    void send(const std::string& message);
+    /**
+     * Waits for the response to the oldest request sent
+     *
+     * @throws std::runtime_error if the server is gone
+     */
+    std::string receive();
+
+    std::string request(const std::string& message);
+
+private:
+    std::unique_ptr<SharedMemorySegment> segment;
+};
+
+}
+}
+
+#endif
+
+#endif /* CUKE_SHAREDMEMORYSERVER_HPP_ */
@@ -0,0 +1,151 @@
+#ifndef CUKE_WIRECOORDINATOR_HPP_
+#define CUKE_WIRECOORDINATOR_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include <cucumber-cpp/internal/DurationHistory.hpp>
+#include "ProtocolHandler.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Shares scenarios out among worker processes serving the same step
+ * definitions, possibly on other hosts: each scenario goes to the worker
+ * expected to be done first, from how long the scenarios it runs took
+ * before. Scenarios never seen take as long as the average one.
+ *
+ * Sessions of several clients may use it concurrently.
+ */
+class CUCUMBER_CPP_EXPORT WireCoordinator {
+public:
+    /** Index in workers() */
+    typedef std::size_t worker_type;
+    typedef std::uint64_t scenario_key_type;
+
+    static constexpr std::chrono::nanoseconds DEFAULT_DURATION = std::chrono::seconds(1);
+
+    /**
+     * @param workers addresses, like "host:3902"
+     * @param history of scenario durations, kept in memory only if none
+     * @throws std::invalid_argument if there are none
+     */
+    explicit WireCoordinator(
+        const std::vector<std::string>& workers, DurationHistory* history = nullptr
+    );
+
+    const std::vector<std::string>& workers() const;
+
+    /**
+     * Picks the worker expected to be done first, adding the scenario to
+     * its expected work
+     */
+    worker_type beginScenario(scenario_key_type scenario);
+    /**
+     * Takes the scenario off the work of its worker and learns how long it
+     * took, averaged with what it took before
+     */
+    void endScenario(
+        worker_type worker, scenario_key_type scenario, std::chrono::nanoseconds duration
+    );
+    /**
+     * Takes a scenario that did not end off the work of its worker
+     */
+    void abandonScenario(worker_type worker, scenario_key_type scenario);
+    /**
+     * Worker with the least work expected, for requests outside scenarios
+     */
+    worker_type leastLoaded() const;
+
+    std::chrono::nanoseconds expectedDuration(scenario_key_type scenario) const;
+
+    /**
+     * Recognises a scenario by its tags and by the steps matched since the
+     * previous one ended, Cucumber matching the steps of a scenario right
+     * before running it. The same in every process.
+     */
+    static scenario_key_type scenarioKey(
+        const std::vector<std::string>& tags, const std::vector<std::string>& stepNames
+    );
+
+private:
+    struct Worker {
+        std::chrono::nanoseconds expectedWork{0};
+        std::size_t scenarios = 0;
+    };
+
+    /** What each running scenario added to the work of its worker */
+    typedef std::multimap<std::pair<worker_type, scenario_key_type>, std::chrono::nanoseconds>
+        running_type;
+
+    worker_type leastLoadedLocked() const;
+    void releaseLocked(worker_type worker, scenario_key_type scenario);
+    std::chrono::nanoseconds expectedDurationLocked(scenario_key_type scenario) const;
+
+    const std::vector<std::string> addresses;
+    DurationHistory ownHistory;
+    DurationHistory& history;
+    mutable std::mutex mutex;
+    std::vector<Worker> load;
+    running_type running;
+};
+
+/**
+ * Line based connection to a worker
+ */
+class CUCUMBER_CPP_EXPORT WireWorkerConnection {
+public:
+    /**
+     * @throws std::runtime_error if the worker cannot be reached
+     */
+    virtual std::string request(const std::string& line) = 0;
+
+    virtual ~WireWorkerConnection() = default;
+};
+
+/**
+ * Protocol handler of a client of the coordinator, forwarding every
+ * request from begin_scenario to end_scenario, and every run_scenario
+ * request, to the worker the coordinator picks for the scenario, and the
+ * others to the least loaded worker. Connections to workers are opened on
+ * first use and kept for the session. Sessions stay with JSON lines.
+ */
+class CUCUMBER_CPP_EXPORT CoordinatingProtocolHandler : public ProtocolHandler {
+public:
+    typedef std::function<std::unique_ptr<WireWorkerConnection>(const std::string& address)>
+        connector_type;
+
+    CoordinatingProtocolHandler(WireCoordinator& coordinator, connector_type connect);
+    ~CoordinatingProtocolHandler() override;
+
+    std::string handle(const std::string& request) const override;
+
+private:
+    std::string forward(const std::string& request) const;
+    std::string forwardTo(WireCoordinator::worker_type worker, const std::string& request) const;
+
+    WireCoordinator& coordinator;
+    const connector_type connect;
+    mutable std::map<WireCoordinator::worker_type, std::unique_ptr<WireWorkerConnection>>
+        connections;
+    mutable std::vector<std::string> matchedNames;
+    mutable bool inScenario;
+    mutable WireCoordinator::worker_type scenarioWorker;
+    mutable WireCoordinator::scenario_key_type scenario;
+    mutable std::chrono::steady_clock::time_point scenarioStart;
+};
+
+}
+}
+
+#endif /* CUKE_WIRECOORDINATOR_HPP_ */
@@ -5,7 +5,14 @@
 #include "ProtocolHandler.hpp"
 #include "../../CukeEngine.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 
 namespace cucumber {
 namespace internal {
@@ -66,6 +73,39 @@ public:
     void accept(WireResponseVisitor& visitor) const override;
 };
 
+/**
+ * Matching steps of every step name in a batch, in the order of the names
+ */
+class CUCUMBER_CPP_EXPORT StepMatchesBatchResponse : public WireResponse {
+private:
+    const std::vector<std::vector<StepMatch>> matchingSteps;
+
+public:
+    StepMatchesBatchResponse(const std::vector<std::vector<StepMatch>>& matchingSteps);
+    const std::vector<std::vector<StepMatch>>& getMatchingSteps() const;
+
+    void accept(WireResponseVisitor& visitor) const override;
+};
+
+/**
+ * Results of the steps of a scenario run in a single round trip, in the
+ * order of the steps. Steps skipped after one that did not pass have no
+ * result.
+ */
+class CUCUMBER_CPP_EXPORT RunScenarioResponse : public WireResponse {
+public:
+    typedef std::vector<std::shared_ptr<const WireResponse>> step_results_type;
+
+private:
+    const step_results_type stepResults;
+
+public:
+    RunScenarioResponse(const step_results_type& stepResults);
+    const step_results_type& getStepResults() const;
+
+    void accept(WireResponseVisitor& visitor) const override;
+};
+
 class CUCUMBER_CPP_EXPORT SnippetTextResponse : public WireResponse {
 private:
     const std::string stepSnippet;
@@ -78,13 +118,55 @@ public:
     void accept(WireResponseVisitor& visitor) const override;
 };
 
+/**
+ * Counters of the process since it started, never reset. The latencies are
+ * only recorded while Timings are enabled.
+ */
+struct CUCUMBER_CPP_EXPORT WireStats {
+    struct Latency {
+        std::uint64_t count = 0;
+        std::uint64_t totalNanoseconds = 0;
+        std::uint64_t p50Nanoseconds = 0;
+        std::uint64_t p99Nanoseconds = 0;
+        std::uint64_t maxNanoseconds = 0;
+    };
+    typedef std::map<std::string, Latency> invocations_type;
+
+    std::uint64_t stepMatches = 0;
+    std::uint64_t stepMatchesCacheHits = 0;
+    std::uint64_t bytesDecoded = 0;
+    std::uint64_t bytesEncoded = 0;
+    std::uint64_t contexts = 0;
+    Latency hooks;
+    Latency requests;
+    /** By step id */
+    invocations_type invocations;
+    /** Whether the latencies are recorded, see Timings::setEnabled */
+    bool timed = false;
+};
+
+class CUCUMBER_CPP_EXPORT StatsResponse : public WireResponse {
+private:
+    const WireStats stats;
+
+public:
+    StatsResponse(const WireStats& stats);
+
+    const WireStats& getStats() const;
+
+    void accept(WireResponseVisitor& visitor) const override;
+};
+
 class CUCUMBER_CPP_EXPORT WireResponseVisitor {
 public:
     virtual void visit(const SuccessResponse& response) = 0;
     virtual void visit(const FailureResponse& response) = 0;
     virtual void visit(const PendingResponse& response) = 0;
     virtual void visit(const StepMatchesResponse& response) = 0;
+    virtual void visit(const StepMatchesBatchResponse& response) = 0;
+    virtual void visit(const RunScenarioResponse& response) = 0;
     virtual void visit(const SnippetTextResponse& response) = 0;
+    virtual void visit(const StatsResponse& response) = 0;
 
     virtual ~WireResponseVisitor() = default;
 };
@@ -106,6 +188,30 @@ public:
     virtual ~WireCommand() = default;
 };
 
+/**
+ * Scratch memory of the request handled on this thread: while a scope is
+ * open, the commands and responses of the wire protocol are allocated
+ * from a monotonic buffer, released in one go when the outermost scope
+ * closes. Elsewhere, as in requests prepared ahead, they use the heap.
+ */
+class CUCUMBER_CPP_EXPORT WireRequestScratch {
+public:
+    WireRequestScratch();
+    ~WireRequestScratch();
+
+    WireRequestScratch(const WireRequestScratch&) = delete;
+    WireRequestScratch& operator=(const WireRequestScratch&) = delete;
+
+    static std::pmr::memory_resource* resource();
+
+    template<typename T, typename... Args>
+    static std::shared_ptr<T> make(Args&&... args) {
+        return std::allocate_shared<T>(
+            std::pmr::polymorphic_allocator<T>(resource()), std::forward<Args>(args)...
+        );
+    }
+};
+
 class CUCUMBER_CPP_EXPORT WireMessageCodecException : public std::exception {
 private:
     const char* description;
@@ -158,19 +264,133 @@ public:
     const std::string encode(const WireResponse& response) const override;
 };
 
+/**
+ * JsonWireMessageCodec decoding the common requests, scenario boundaries,
+ * step_matches and invoke, with the simdjson On Demand parser instead of
+ * building a DOM. Other requests, and anything unusual in these, are left
+ * to JsonWireMessageCodec.
+ *
+ * Only built with CUKE_ENABLE_SIMDJSON.
+ */
+class CUCUMBER_CPP_EXPORT SimdJsonWireMessageCodec : public JsonWireMessageCodec {
+public:
+    SimdJsonWireMessageCodec() = default;
+    std::shared_ptr<WireCommand> decode(const std::string& request) const override;
+};
+
+/**
+ * WireMessageCodec implementation with MessagePack, the same messages as
+ * JsonWireMessageCodec in a binary encoding.
+ */
+class CUCUMBER_CPP_EXPORT MessagePackWireMessageCodec : public WireMessageCodec {
+public:
+    MessagePackWireMessageCodec() = default;
+    std::shared_ptr<WireCommand> decode(const std::string& request) const override;
+    const std::string encode(const WireResponse& response) const override;
+};
+
+/**
+ * WireMessageCodec decorator compressing messages with Zstandard, for
+ * large tables, doc strings and step match lists over slow links.
+ *
+ * Each message starts with a byte telling whether the rest is the message
+ * of the wrapped codec as is (0) or compressed (1). Short messages, and
+ * those that compression would not make shorter, are left as they are.
+ *
+ * Only built with CUKE_ENABLE_ZSTD.
+ */
+class CUCUMBER_CPP_EXPORT CompressingWireMessageCodec : public WireMessageCodec {
+public:
+    static const std::size_t DEFAULT_THRESHOLD = 1024;
+    /**
+     * Longest decompressed message accepted
+     */
+    static const std::size_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+
+    /**
+     * @param codec wrapped, which must outlive this one
+     * @param threshold size from which messages get compressed
+     */
+    CompressingWireMessageCodec(
+        const WireMessageCodec& codec, std::size_t threshold = DEFAULT_THRESHOLD
+    );
+
+    std::shared_ptr<WireCommand> decode(const std::string& request) const override;
+    const std::string encode(const WireResponse& response) const override;
+
+    /**
+     * Prefixes a message with its compression flag, for the client side
+     */
+    static std::string compress(
+        const std::string& message, std::size_t threshold = DEFAULT_THRESHOLD
+    );
+    /**
+     * @throws WireMessageCodecException if the message is malformed or too long
+     */
+    static std::string decompress(const std::string& message);
+
+private:
+    const WireMessageCodec& codec;
+    const std::size_t threshold;
+};
+
 /**
  * Wire protocol handler, delegating JSON encoding and decoding to a
  * codec object and running commands on a provided engine instance.
+ *
+ * A ["negotiate_codec", {"codec": "msgpack"}] request switches the rest of
+ * the connection to MessagePackWireMessageCodec, in binary frames, and
+ * "msgpack+zstd" to the same wrapped in CompressingWireMessageCodec when
+ * built with it.
+ *
+ * Responses to step_matches requests are kept by request until the step
+ * definitions change, so that repeated requests are answered without
+ * being decoded again.
  */
 class CUCUMBER_CPP_EXPORT WireProtocolHandler : public ProtocolHandler {
 private:
     const WireMessageCodec& codec;
     CukeEngine& engine;
+    mutable const WireMessageCodec* activeCodec;
+    typedef std::unordered_map<std::string, std::string> response_cache_type;
+    /** Guards the cache, which prepare() reads from the thread reading requests */
+    mutable std::mutex stepMatchesMutex;
+    mutable response_cache_type stepMatchesResponses;
+    mutable std::uint64_t stepMatchesGeneration;
+
+    /**
+     * Tells whether the response to the request is cached, copying it into
+     * the response if given
+     */
+    bool findStepMatches(const std::string& request, std::string* response) const;
+    std::string respond(const std::string& request, const PreparedRequest* prepared) const;
+    std::string negotiateCodec(const std::string& codecName) const;
+    std::string encodeFailure() const;
 
 public:
+    /**
+     * Maximum number of distinct step_matches requests whose responses are
+     * kept before they are flushed
+     */
+    static const std::size_t STEP_MATCHES_CACHE_CAPACITY = 10000;
+
     WireProtocolHandler(const WireMessageCodec& codec, CukeEngine& engine);
 
     std::string handle(const std::string& request) const override;
+    /**
+     * Decodes the command, or looks up its response when cached, unless it
+     * negotiates a codec
+     */
+    std::shared_ptr<const PreparedRequest> prepare(const std::string& request) const override;
+    std::string handlePrepared(const std::string& request, const PreparedRequest* prepared)
+        const override;
+    bool usesBinaryFrames() const override;
+
+    /**
+     * Sizes of the requests and responses of every handler in the process
+     */
+    static std::uint64_t bytesDecoded();
+    static std::uint64_t bytesEncoded();
 };
 
 }
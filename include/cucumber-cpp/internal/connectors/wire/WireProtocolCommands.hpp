@@ -10,13 +10,17 @@ namespace internal {
 class ScenarioCommand : public WireCommand {
 protected:
     const CukeEngine::tags_type tags;
+    /** W3C traceparent header of the client, if any */
+    const std::string traceParent;
 
-    ScenarioCommand(const CukeEngine::tags_type& tags);
+    ScenarioCommand(const CukeEngine::tags_type& tags, const std::string& traceParent = "");
+
+    void beginScenario(CukeEngine& engine) const;
 };
 
 class BeginScenarioCommand : public ScenarioCommand {
 public:
-    BeginScenarioCommand(const CukeEngine::tags_type& tags);
+    BeginScenarioCommand(const CukeEngine::tags_type& tags, const std::string& traceParent = "");
 
     std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
 };
@@ -28,6 +32,19 @@ public:
     std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
 };
 
+/**
+ * Moves on to another feature, see CukeEngine::beginFeature()
+ */
+class BeginFeatureCommand : public WireCommand {
+private:
+    const std::string name;
+
+public:
+    BeginFeatureCommand(const std::string& name);
+
+    std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
+};
+
 class StepMatchesCommand : public WireCommand {
 private:
     const std::string stepName;
@@ -38,11 +55,29 @@ public:
     std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
 };
 
+/**
+ * Matches many step names in a single round trip
+ */
+class StepMatchesBatchCommand : public WireCommand {
+private:
+    const std::vector<std::string> stepNames;
+
+public:
+    StepMatchesBatchCommand(const std::vector<std::string>& stepNames);
+
+    std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
+};
+
+/**
+ * Invokes a step. Commands built from moved arguments hand them over to
+ * the engine, so they can only run once.
+ */
 class InvokeCommand : public WireCommand {
 private:
     const std::string stepId;
-    const CukeEngine::invoke_args_type args;
-    const CukeEngine::invoke_table_type tableArg;
+    mutable CukeEngine::invoke_args_type args;
+    mutable CukeEngine::invoke_table_type tableArg;
+    const bool movingArgs;
 
 public:
     InvokeCommand(
@@ -50,6 +85,39 @@ public:
         const CukeEngine::invoke_args_type& args,
         const CukeEngine::invoke_table_type& tableArg
     );
+    InvokeCommand(
+        std::string&& stepId,
+        CukeEngine::invoke_args_type&& args,
+        CukeEngine::invoke_table_type&& tableArg
+    );
+
+    std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
+};
+
+/**
+ * Runs a whole scenario in a single round trip: begins it, invokes its
+ * steps in order and ends it. The steps after one that did not pass are
+ * skipped. Step arguments are handed over to the engine, so the command
+ * can only run once.
+ */
+class RunScenarioCommand : public ScenarioCommand {
+public:
+    struct Step {
+        std::string id;
+        CukeEngine::invoke_args_type args;
+        CukeEngine::invoke_table_type tableArg;
+    };
+    typedef std::vector<Step> steps_type;
+
+private:
+    mutable steps_type steps;
+
+public:
+    RunScenarioCommand(
+        const CukeEngine::tags_type& tags,
+        steps_type&& steps,
+        const std::string& traceParent = ""
+    );
 
     std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
 };
@@ -66,6 +134,44 @@ public:
     std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
 };
 
+/**
+ * Reports the counters of the process, see WireStats
+ */
+class StatsCommand : public WireCommand {
+public:
+    std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
+};
+
+/**
+ * Loads a shared library of step definitions, see StepLibraries. Fails
+ * unless libraries are loadable by clients, or while scenarios run.
+ */
+class LoadLibraryCommand : public WireCommand {
+private:
+    const std::string path;
+
+public:
+    LoadLibraryCommand(const std::string& path);
+
+    std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
+};
+
+/**
+ * Asks for the codec of the following messages. WireProtocolHandler acts
+ * on it instead of running it, as it does not concern the engine.
+ */
+class NegotiateCodecCommand : public WireCommand {
+private:
+    const std::string codecName;
+
+public:
+    NegotiateCodecCommand(const std::string& codecName);
+
+    const std::string& getCodecName() const;
+
+    std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
+};
+
 class FailingCommand : public WireCommand {
 public:
     std::shared_ptr<WireResponse> run(CukeEngine& engine) const override;
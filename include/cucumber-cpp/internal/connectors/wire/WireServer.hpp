@@ -2,11 +2,19 @@
 #define CUKE_WIRESERVER_HPP_
 
 #include <cucumber-cpp/internal/CukeExport.hpp>
+#include <cucumber-cpp/internal/utils/CpuAffinity.hpp>
 #include "ProtocolHandler.hpp"
 
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <memory>
 #include <string>
 
 #include <asio.hpp>
+#if defined(CUKE_ENABLE_TLS)
+#include <asio/ssl.hpp>
+#endif
 
 namespace cucumber {
 namespace internal {
@@ -16,6 +24,11 @@ namespace internal {
  */
 class CUCUMBER_CPP_EXPORT SocketServer {
 public:
+    /**
+     * Creates the protocol handler, and with that the state, of a session
+     */
+    typedef std::function<std::unique_ptr<const ProtocolHandler>()> session_factory_type;
+
     /**
      * Constructor for DI
      */
@@ -27,9 +40,98 @@ public:
      */
     virtual void acceptOnce() = 0;
 
+    /**
+     * Accept connections in a loop, serving each one concurrently on its own
+     * thread with a protocol handler of its own.
+     *
+     * @param newSession called on the accepting thread for every connection
+     * @param maxSessions number of connections after which no more are
+     *        accepted, or 0 to accept forever. Returns once these sessions
+     *        are closed.
+     */
+    virtual void acceptSessions(const session_factory_type& newSession, std::size_t maxSessions = 0)
+        = 0;
+
+    /**
+     * Like acceptSessions(), but multiplexes all sessions on the calling
+     * thread through asynchronous reads and writes on the io_context. Each
+     * session reuses its read and write buffers across requests; a request
+     * is handled synchronously, so sessions wait for each other's steps.
+     */
+    virtual void serveAsync(const session_factory_type& newSession, std::size_t maxSessions = 0)
+        = 0;
+
+#if !defined(_WIN32)
+    /**
+     * Forks worker processes that take connections from the listening
+     * socket one at a time, each with a protocol handler of its own. The
+     * workers share the state of this process copy-on-write, registered
+     * step definitions included, so sessions get a process of their own
+     * without paying for its startup. Only the calling thread is forked.
+     *
+     * @param newSession called in the worker for every connection
+     * @param workers number of worker processes
+     * @param maxSessions number of connections after which a worker exits,
+     *        or 0 to serve forever, replacing the workers killed by a
+     *        signal. Returns once the workers have exited.
+     *
+     * @throws std::system_error if a worker cannot be forked
+     */
+    void acceptForked(
+        const session_factory_type& newSession, std::size_t workers, std::size_t maxSessions = 0
+    );
+#endif
+
+    /**
+     * Gather responses instead of flushing each one, and write them only
+     * once no more complete requests are buffered: a client pipelining
+     * requests then gets its responses in few writes. Off by default.
+     */
+    void setWriteCoalescing(bool coalesce);
+
+    /**
+     * Read and decode the next requests of a connection, on the thread
+     * doing its I/O, while the current one is handled on an execution
+     * thread of the server. Responses are still written in request order.
+     * Off by default.
+     */
+    void setRequestPipelining(bool pipeline);
+
+    /**
+     * Largest binary frame a request may announce, 16 MiB by default. The
+     * connection of a longer one is closed without reading it.
+     */
+    void setMaxFrameLength(std::size_t length);
+
+    /**
+     * Stream told why connections are closed, such as for announcing a
+     * frame too long or for a request failing to be handled, and why
+     * forked workers failed. Nothing is told by default.
+     */
+    void setErrorLog(std::ostream* log);
+
+    /**
+     * Pins the threads running the requests of sessions, and forked
+     * workers, each to one of the cpus in turn, keeping their contexts on
+     * the NUMA node of that cpu. Threads are left unpinned by default.
+     */
+    void setExecutionCpus(const cpu_list_type& cpus);
+    /**
+     * Pins the threads only doing the I/O of connections, which pipelined
+     * and asynchronous sessions have, to the cpus in turn, out of the way
+     * of the execution threads
+     */
+    void setIoCpus(const cpu_list_type& cpus);
+
 protected:
     const ProtocolHandler* protocolHandler;
     asio::io_context ios;
+    bool coalesceWrites;
+    bool pipelineRequests;
+    std::size_t maxFrameLength;
+    std::ostream* errorLog;
+    CpuRotation executionCpus;
+    CpuRotation ioCpus;
 
     template<typename Protocol>
     void doListen(
@@ -37,7 +139,19 @@ protected:
     );
     template<typename Protocol>
     void doAcceptOnce(asio::basic_socket_acceptor<Protocol>& acceptor);
-    void processStream(std::iostream& stream);
+    template<typename Protocol>
+    void doAcceptSessions(
+        asio::basic_socket_acceptor<Protocol>& acceptor,
+        const session_factory_type& newSession,
+        std::size_t maxSessions
+    );
+    template<typename Protocol>
+    void doServeAsync(
+        asio::basic_socket_acceptor<Protocol>& acceptor,
+        const session_factory_type& newSession,
+        std::size_t maxSessions
+    );
+    void processStream(std::iostream& stream, const ProtocolHandler& handler);
 };
 
 /**
@@ -75,11 +189,82 @@ public:
     asio::ip::tcp::endpoint listenEndpoint() const;
 
     void acceptOnce() override;
+    void acceptSessions(const session_factory_type& newSession, std::size_t maxSessions = 0)
+        override;
+    void serveAsync(const session_factory_type& newSession, std::size_t maxSessions = 0) override;
 
 private:
     asio::ip::tcp::acceptor acceptor;
 };
 
+#if defined(CUKE_ENABLE_TLS)
+/**
+ * TCP socket server speaking TLS, for clients on other hosts.
+ *
+ * A connection is served until the client closes it, so a client may keep
+ * one open for many runs, and clients reconnecting resume their TLS session
+ * with an abbreviated handshake. Idle connections get TCP keep-alives. A
+ * client failing its handshake only loses its own connection.
+ */
+class CUCUMBER_CPP_EXPORT TLSSocketServer : public SocketServer {
+public:
+    typedef unsigned short port_type;
+    typedef asio::ssl::stream<asio::ip::tcp::socket> stream_type;
+
+    /**
+     * Context with a certificate chain and private key in PEM format,
+     * accepting TLS 1.2 and later and keeping sessions resumable for hours
+     *
+     * @throws std::system_error if a file cannot be loaded
+     */
+    static asio::ssl::context makeContext(
+        const std::string& certificateChainFile, const std::string& privateKeyFile
+    );
+
+    /**
+     * Constructor for DI
+     */
+    TLSSocketServer(const ProtocolHandler* protocolHandler, asio::ssl::context context);
+
+    /**
+     * Bind and listen to a TCP port
+     */
+    void listen(const port_type port);
+
+    /**
+     * Bind and listen to a TCP port on the given endpoint
+     */
+    void listen(const asio::ip::tcp::endpoint endpoint);
+
+    /**
+     * @throw std::system_error when not listening on any socket or
+     *        the endpoint cannot be determined.
+     */
+    asio::ip::tcp::endpoint listenEndpoint() const;
+
+    /**
+     * Accept one connection, or more until one completes its handshake
+     */
+    void acceptOnce() override;
+    void acceptSessions(const session_factory_type& newSession, std::size_t maxSessions = 0)
+        override;
+    void serveAsync(const session_factory_type& newSession, std::size_t maxSessions = 0) override;
+
+private:
+    /**
+     * @return false if the handshake failed
+     */
+    bool serve(
+        asio::io_context& streamIos,
+        asio::ip::tcp::socket socket,
+        std::shared_ptr<const ProtocolHandler> handler
+    );
+
+    asio::ssl::context context;
+    asio::ip::tcp::acceptor acceptor;
+};
+#endif
+
 #if defined(ASIO_HAS_LOCAL_SOCKETS)
 /**
  * Socket server that calls a protocol handler line by line
@@ -105,6 +290,9 @@ public:
     asio::local::stream_protocol::endpoint listenEndpoint() const;
 
     void acceptOnce() override;
+    void acceptSessions(const session_factory_type& newSession, std::size_t maxSessions = 0)
+        override;
+    void serveAsync(const session_factory_type& newSession, std::size_t maxSessions = 0) override;
 
     ~UnixSocketServer() override;
 
@@ -113,6 +301,69 @@ private:
 };
 #endif
 
+#if defined(ASIO_HAS_WINDOWS_STREAM_HANDLE)
+/**
+ * Named pipe server for clients on the same Windows host, sparing them the
+ * loopback TCP stack and its firewall prompts.
+ *
+ * A pipe instance waits for the next client with an overlapped
+ * ConnectNamedPipe, and the next instance is created as soon as a client
+ * connects. Connections are served through overlapped reads and writes on
+ * asio stream handles. Remote clients are rejected.
+ */
+class CUCUMBER_CPP_EXPORT NamedPipeServer : public SocketServer {
+public:
+    typedef asio::windows::stream_handle stream_type;
+
+    /**
+     * Constructor for DI
+     */
+    NamedPipeServer(const ProtocolHandler* protocolHandler);
+
+    /**
+     * Creates the first instance of the pipe
+     *
+     * @param pipeName like \\.\pipe\cucumber-cpp, or only its last part
+     * @throws std::system_error if another process holds the name
+     */
+    void listen(const std::string& pipeName);
+
+    /**
+     * Full name of the pipe, empty when not listening
+     */
+    const std::string& listenName() const;
+
+    void acceptOnce() override;
+    void acceptSessions(const session_factory_type& newSession, std::size_t maxSessions = 0)
+        override;
+    void serveAsync(const session_factory_type& newSession, std::size_t maxSessions = 0) override;
+
+    ~NamedPipeServer() override;
+
+private:
+    /**
+     * Waits for a client to connect to the pending instance, which it takes
+     */
+    stream_type accept(asio::io_context& streamIos);
+    /**
+     * The pending instance, connected, replaced by a new one
+     */
+    stream_type takeConnected(asio::io_context& streamIos);
+    void acceptAsync(
+        const std::function<void(stream_type)>& startSession, std::size_t remainingSessions
+    );
+    void serve(
+        asio::io_context& streamIos,
+        stream_type pipe,
+        std::shared_ptr<const ProtocolHandler> handler
+    );
+
+    std::string name;
+    /** Instance the next client connects to */
+    stream_type::native_handle_type pending;
+};
+#endif
+
 }
 }
 
@@ -0,0 +1,21 @@
+#ifndef CUKE_WIRESESSION_HPP_
+#define CUKE_WIRESESSION_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include "ProtocolHandler.hpp"
+
+#include <memory>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Protocol handler owning the state of one wire session, scenario contexts
+ * included, so that sessions can run their scenarios concurrently
+ */
+CUCUMBER_CPP_EXPORT std::unique_ptr<const ProtocolHandler> newWireSession(bool dryRun);
+
+}
+}
+
+#endif /* CUKE_WIRESESSION_HPP_ */
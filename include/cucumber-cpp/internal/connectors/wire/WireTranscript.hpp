@@ -0,0 +1,128 @@
+#ifndef CUKE_WIRETRANSCRIPT_HPP_
+#define CUKE_WIRETRANSCRIPT_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include "ProtocolHandler.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * A request or response of a wire session, as recorded in a transcript
+ */
+struct CUCUMBER_CPP_EXPORT WireTranscriptEntry {
+    typedef unsigned int session_type;
+    enum Direction { REQUEST = '>', RESPONSE = '<' };
+
+    /** Since the first message of the transcript */
+    std::uint64_t microseconds = 0;
+    session_type session = 0;
+    Direction direction = REQUEST;
+    std::string message;
+};
+
+/**
+ * Writes the messages of wire sessions to a transcript, one per line:
+ *
+ *   <microseconds> <session> <'>' for requests, '<' for responses> <length> <message>
+ *
+ * The length of the message in bytes keeps binary frames and messages
+ * holding line breaks readable. Sessions are numbered from 1 in order of
+ * creation. Sessions may write concurrently.
+ */
+class CUCUMBER_CPP_EXPORT WireTranscriptWriter {
+public:
+    explicit WireTranscriptWriter(std::ostream& out);
+
+    WireTranscriptEntry::session_type newSession();
+    void write(
+        WireTranscriptEntry::session_type session,
+        WireTranscriptEntry::Direction direction,
+        const std::string& message
+    );
+
+private:
+    std::mutex mutex;
+    std::ostream& out;
+    WireTranscriptEntry::session_type sessions;
+    const std::chrono::steady_clock::time_point start;
+};
+
+class CUCUMBER_CPP_EXPORT WireTranscriptReader {
+public:
+    explicit WireTranscriptReader(std::istream& in);
+
+    /**
+     * @return false at the end of the transcript
+     * @throws std::runtime_error if the transcript is malformed
+     */
+    bool next(WireTranscriptEntry& entry);
+
+private:
+    std::istream& in;
+};
+
+/**
+ * Records the requests a protocol handler receives and its responses
+ */
+class CUCUMBER_CPP_EXPORT RecordingProtocolHandler : public ProtocolHandler {
+public:
+    RecordingProtocolHandler(
+        std::unique_ptr<const ProtocolHandler> handler, WireTranscriptWriter& transcript
+    );
+
+    std::string handle(const std::string& request) const override;
+    std::shared_ptr<const PreparedRequest> prepare(const std::string& request) const override;
+    std::string handlePrepared(const std::string& request, const PreparedRequest* prepared)
+        const override;
+    bool usesBinaryFrames() const override;
+
+private:
+    const std::unique_ptr<const ProtocolHandler> handler;
+    WireTranscriptWriter& transcript;
+    const WireTranscriptEntry::session_type session;
+};
+
+/**
+ * Feeds the requests of a transcript to a protocol handler per recorded
+ * session, without a socket. Requests are handled in recorded order, one
+ * after the other and without waiting, and their responses compared with
+ * the recorded ones.
+ */
+class CUCUMBER_CPP_EXPORT WireTranscriptReplayer {
+public:
+    typedef std::function<std::unique_ptr<const ProtocolHandler>()> session_factory_type;
+
+    struct Result {
+        std::size_t requests = 0;
+        /** Responses that differ from the recorded ones */
+        std::size_t mismatches = 0;
+        /** Spent in the protocol handlers */
+        std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+    };
+
+    explicit WireTranscriptReplayer(session_factory_type newSession);
+
+    /**
+     * @param mismatches Receives the requests whose responses differ, if any
+     * @throws std::runtime_error if the transcript is malformed
+     */
+    Result replay(std::istream& transcript, std::ostream* mismatches = nullptr) const;
+
+private:
+    const session_factory_type newSession;
+};
+
+}
+}
+
+#endif /* CUKE_WIRETRANSCRIPT_HPP_ */
@@ -1,5 +1,8 @@
 #include "step/StepManager.hpp"
+#include "step/CoroutineStep.hpp"
+#include "step/StaticStep.hpp"
 #include "hook/HookRegistrar.hpp"
 #include "ContextManager.hpp"
+#include "StepTimeouts.hpp"
 #include "Macros.hpp"
 #include "drivers/DriverSelector.hpp"
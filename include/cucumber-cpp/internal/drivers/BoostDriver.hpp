@@ -10,11 +10,22 @@ namespace internal {
 class CukeBoostLogInterceptor;
 
 class CUCUMBER_CPP_EXPORT BoostStep : public BasicStep {
+public:
+    /**
+     * Runs steps without the results collector, the test log events and the
+     * report of every run, which take half of the time spent in Boost.Test.
+     * Failed checks are still reported, but signals and timeouts then fail
+     * the step without their description. Off by default.
+     */
+    static void setLightweightExecution(bool lightweight);
+    static bool isLightweightExecution();
+
 protected:
     const InvokeResult invokeStepBody() override;
 
 private:
     static void initBoostTest();
+    static void applyExecutionMode();
     void runWithMasterSuite();
 };
 
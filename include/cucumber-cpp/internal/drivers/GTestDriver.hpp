@@ -4,21 +4,33 @@
 #include <cucumber-cpp/internal/CukeExport.hpp>
 #include "../step/StepManager.hpp"
 
+#include <atomic>
 #include <iostream>
 
 namespace cucumber {
 namespace internal {
 
 class CUCUMBER_CPP_EXPORT GTestStep : public BasicStep {
+public:
+    /**
+     * Collects the failures of each step in the thread running it instead
+     * of throwing on the first one. A failed assertion then only returns
+     * from the function it is in, as in a test, and the step goes on if it
+     * is not the step body. Off by default.
+     */
+    static void setCollectingFailures(bool collecting);
+    static bool isCollectingFailures();
+
 protected:
     const InvokeResult invokeStepBody() override;
 
 private:
     void initGTest();
     void initFlags();
+    const InvokeResult invokeCollectingFailures();
 
 protected:
-    static bool initialized;
+    static std::atomic<bool> initialized;
 };
 
 #define STEP_INHERITANCE(step_name) ::cucumber::internal::GTestStep
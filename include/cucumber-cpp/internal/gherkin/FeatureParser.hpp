@@ -0,0 +1,82 @@
+#ifndef CUKE_FEATUREPARSER_HPP_
+#define CUKE_FEATUREPARSER_HPP_
+
+#include "../ScenarioRunner.hpp"
+#include "FeatureSource.hpp"
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Thrown for Gherkin that cannot be parsed, or a feature file that cannot
+ * be read. The line is 0 when the error is not about a particular line.
+ */
+class CUCUMBER_CPP_EXPORT FeatureParseException : public std::runtime_error {
+public:
+    FeatureParseException(const std::string& uri, std::size_t line, const std::string& message);
+
+    const std::string& getUri() const;
+    std::size_t getLine() const;
+
+private:
+    std::string uri;
+    std::size_t line;
+};
+
+/**
+ * Compiles Gherkin features into the scenarios Cucumber would hand to the
+ * wire server.
+ *
+ * Backgrounds are prepended to the steps of every scenario of their feature
+ * or rule, Scenario Outlines are expanded into one scenario per example row,
+ * and scenarios inherit the tags of their feature, rule and examples. Only
+ * the English keywords are understood.
+ *
+ * Parsing reads lines in place. Doc strings and data tables are only
+ * delimited: pickles keep their source alive and decode them when their
+ * step runs.
+ */
+class CUCUMBER_CPP_EXPORT FeatureParser {
+public:
+    typedef std::vector<PickledScenario> pickles_type;
+
+    /**
+     * @param uri Names the feature in locations and errors
+     * @throws FeatureParseException
+     */
+    pickles_type parse(std::string_view source, const std::string& uri) const;
+
+    /**
+     * @throws FeatureParseException
+     */
+    pickles_type parse(const std::shared_ptr<const FeatureSource>& source) const;
+
+    /**
+     * Parses the file mapped into memory
+     *
+     * @throws FeatureParseException
+     */
+    pickles_type parseFile(const std::string& path) const;
+
+    /**
+     * Parses and compiles the files on a pool of threads, one per hardware
+     * thread for 0. The pickles keep the order of the files.
+     *
+     * @throws FeatureParseException for the first file in order that fails
+     */
+    pickles_type parseFiles(const std::vector<std::string>& paths, std::size_t threads = 0)
+        const;
+};
+
+}
+}
+
+#endif /* CUKE_FEATUREPARSER_HPP_ */
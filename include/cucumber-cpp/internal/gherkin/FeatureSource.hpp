@@ -0,0 +1,47 @@
+#ifndef CUKE_FEATURESOURCE_HPP_
+#define CUKE_FEATURESOURCE_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Text of a feature, which parsed pickles keep viewing into until their
+ * steps run.
+ */
+class CUCUMBER_CPP_EXPORT FeatureSource {
+public:
+    virtual ~FeatureSource() = default;
+
+    FeatureSource(const FeatureSource&) = delete;
+    FeatureSource& operator=(const FeatureSource&) = delete;
+
+    const std::string& getUri() const;
+    std::string_view getText() const;
+
+    static std::shared_ptr<const FeatureSource> fromString(std::string text, std::string uri);
+
+    /**
+     * Maps the file into memory where the platform allows, reads it
+     * otherwise.
+     *
+     * @throws FeatureParseException if the file cannot be read
+     */
+    static std::shared_ptr<const FeatureSource> fromFile(const std::string& path);
+
+protected:
+    explicit FeatureSource(std::string uri);
+
+    std::string uri;
+    std::string_view text;
+};
+
+}
+}
+
+#endif /* CUKE_FEATURESOURCE_HPP_ */
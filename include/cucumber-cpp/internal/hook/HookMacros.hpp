@@ -87,37 +87,40 @@
 // **************                BEFORE_ALL HOOK               ************** //
 // ************************************************************************** //
 
-#define BEFORE_ALL()                             \
-    BEFORE_ALL_WITH_NAME_(CUKE_GEN_OBJECT_NAME_) \
+#define BEFORE_ALL(...)                                           \
+    BEFORE_ALL_WITH_NAME_(CUKE_GEN_OBJECT_NAME_, "" #__VA_ARGS__) \
     /**/
 
-#define BEFORE_ALL_WITH_NAME_(step_name)          \
-    CUKE_OBJECT_(                                 \
-        step_name,                                \
-        ::cucumber::internal::BeforeAllHook,      \
-        BEFORE_ALL_HOOK_REGISTRATION_(step_name), \
-        ()                                        \
-    )                                             \
+#define BEFORE_ALL_WITH_NAME_(step_name, name_notation)          \
+    CUKE_OBJECT_(                                                \
+        step_name,                                               \
+        ::cucumber::internal::BeforeAllHook,                     \
+        BEFORE_ALL_HOOK_REGISTRATION_(step_name, name_notation), \
+        ()                                                       \
+    )                                                            \
     /**/
 
-#define BEFORE_ALL_HOOK_REGISTRATION_(step_name) \
-    ::cucumber::internal::registerBeforeAllHook<step_name>() /**/
+#define BEFORE_ALL_HOOK_REGISTRATION_(step_name, name_notation) \
+    ::cucumber::internal::registerBeforeAllHook<step_name>(name_notation) /**/
 
 // ************************************************************************** //
 // **************                 AFTER_ALL HOOK               ************** //
 // ************************************************************************** //
 
-#define AFTER_ALL()                             \
-    AFTER_ALL_WITH_NAME_(CUKE_GEN_OBJECT_NAME_) \
+#define AFTER_ALL(...)                                           \
+    AFTER_ALL_WITH_NAME_(CUKE_GEN_OBJECT_NAME_, "" #__VA_ARGS__) \
     /**/
 
-#define AFTER_ALL_WITH_NAME_(step_name)                                                            \
-    CUKE_OBJECT_(                                                                                  \
-        step_name, ::cucumber::internal::AfterAllHook, AFTER_ALL_HOOK_REGISTRATION_(step_name), () \
-    )                                                                                              \
+#define AFTER_ALL_WITH_NAME_(step_name, name_notation)          \
+    CUKE_OBJECT_(                                               \
+        step_name,                                              \
+        ::cucumber::internal::AfterAllHook,                     \
+        AFTER_ALL_HOOK_REGISTRATION_(step_name, name_notation), \
+        ()                                                      \
+    )                                                           \
     /**/
 
-#define AFTER_ALL_HOOK_REGISTRATION_(step_name) \
-    ::cucumber::internal::registerAfterAllHook<step_name>() /**/
+#define AFTER_ALL_HOOK_REGISTRATION_(step_name, name_notation) \
+    ::cucumber::internal::registerAfterAllHook<step_name>(name_notation) /**/
 
 #endif /* CUKE_HOOKMACROS_HPP_ */
@@ -7,7 +7,8 @@
 #include "../step/StepManager.hpp"
 
 #include <memory>
-#include <list>
+#include <string>
+#include <vector>
 
 namespace cucumber {
 namespace internal {
@@ -22,12 +23,17 @@ public:
     virtual ~Hook() = default;
 
     void setTags(const std::string& csvTagNotation);
+    bool tagsMatch(Scenario* scenario);
     virtual void invokeHook(Scenario* scenario, CallableStep* step);
+    /**
+     * Runs the hook without looking at its tags, for callers that already
+     * know they match the scenario.
+     */
+    virtual void invokeMatchedHook(CallableStep* step);
     virtual void skipHook();
     virtual void body() = 0;
 
 protected:
-    bool tagsMatch(Scenario* scenario);
 
     template<typename Derived, typename R>
     static R invokeWithArgs(Derived& that, R (Derived::*f)()) {
@@ -35,7 +41,7 @@ protected:
     }
 
 private:
-    AndTagExpression tagExpression;
+    BooleanTagExpression tagExpression;
 };
 
 class CUCUMBER_CPP_EXPORT BeforeHook : public Hook {};
@@ -43,36 +49,82 @@ class CUCUMBER_CPP_EXPORT BeforeHook : public Hook {};
 class CUCUMBER_CPP_EXPORT AroundStepHook : public Hook {
 public:
     void invokeHook(Scenario* scenario, CallableStep* step) override;
+    void invokeMatchedHook(CallableStep* step) override;
     void skipHook() override;
 
 protected:
-    CallableStep* step;
+    /**
+     * The rest of the step chain run by the calling thread. Hooks are shared
+     * by concurrent sessions, so the chain is not stored in the hook.
+     */
+    class CUCUMBER_CPP_EXPORT CurrentStep {
+    public:
+        CallableStep* operator->() const;
+    };
+    CurrentStep step;
 };
 
 class CUCUMBER_CPP_EXPORT AfterStepHook : public Hook {};
 
 class CUCUMBER_CPP_EXPORT AfterHook : public Hook {};
 
+/**
+ * BeforeAll and AfterAll hooks. Those given a name run concurrently with
+ * each other, each once the hooks it depends on have run. Those without
+ * one run alone, after every hook registered before them and before every
+ * hook registered after them, as all of them did before names existed.
+ */
 class CUCUMBER_CPP_EXPORT UnconditionalHook : public Hook {
 public:
     void invokeHook(Scenario* scenario, CallableStep* step) override;
+
+    /**
+     * Reads the quoted arguments of the hook macro: its name, then the
+     * names of the hooks it depends on. No argument leaves it unnamed.
+     *
+     * @throws std::invalid_argument if a name is blank
+     */
+    void setDependencies(const std::string& csvNameNotation);
+    const std::string& getName() const;
+    const std::vector<std::string>& getDependencies() const;
+
+private:
+    std::string name;
+    std::vector<std::string> dependencies;
 };
 
 class CUCUMBER_CPP_EXPORT BeforeAllHook : public UnconditionalHook {};
 
 class CUCUMBER_CPP_EXPORT AfterAllHook : public UnconditionalHook {};
 
+struct ScenarioHooks;
+
 class CUCUMBER_CPP_EXPORT HookRegistrar {
 public:
-    typedef std::list<std::shared_ptr<Hook>> hook_list_type;
-    typedef std::list<std::shared_ptr<AroundStepHook>> aroundhook_list_type;
+    /**
+     * Hooks in the order they run: around step, after step and after hooks
+     * run from the last registered, the others from the first
+     */
+    typedef std::vector<std::shared_ptr<Hook>> hook_list_type;
+    typedef std::vector<std::shared_ptr<AroundStepHook>> aroundhook_list_type;
+    typedef std::vector<std::shared_ptr<UnconditionalHook>> unconditionalhook_list_type;
+    typedef std::vector<std::shared_ptr<Hook>> hook_chain_type;
+    typedef std::vector<std::shared_ptr<AroundStepHook>> aroundhook_chain_type;
+
+    /**
+     * Selects the scenario-level hooks whose tags match the scenario, in the
+     * order they run. Tags do not change within a scenario, so the result can
+     * be reused for all of its steps.
+     */
+    static ScenarioHooks resolveHooks(Scenario* scenario);
+    static void execHookChain(const hook_chain_type& hookChain);
 
     static void addBeforeHook(std::shared_ptr<BeforeHook> afterHook);
     static void execBeforeHooks(Scenario* scenario);
 
     static void addAroundStepHook(std::shared_ptr<AroundStepHook> aroundStepHook);
     static InvokeResult execStepChain(
-        Scenario* scenario, const StepInfo* stepInfo, const InvokeArgs* pArgs
+        const aroundhook_chain_type& aroundHooks, const StepInfo* stepInfo, const InvokeArgs* pArgs
     );
 
     static void addAfterStepHook(std::shared_ptr<AfterStepHook> afterStepHook);
@@ -89,52 +141,70 @@ public:
 
 private:
     static void execHooks(HookRegistrar::hook_list_type& hookList, Scenario* scenario);
+    template<typename Chain, typename List>
+    static Chain matchingHooks(const List& hookList, Scenario* scenario);
 
 protected:
-    static hook_list_type& beforeAllHooks();
+    /**
+     * Runs BeforeAll or AfterAll hooks, the named ones on threads of their
+     * own as soon as their dependencies have run. No hook starts once one
+     * has failed. The exception of a single failed hook is rethrown, those
+     * of several are joined into a std::runtime_error.
+     *
+     * @throws std::invalid_argument if a hook depends on an unknown name,
+     *         if two hooks have the same name or if dependencies form a
+     *         cycle, before any hook runs
+     */
+    static void execUnconditionalHooks(const unconditionalhook_list_type& hookList);
+
+    static unconditionalhook_list_type& beforeAllHooks();
     static hook_list_type& beforeHooks();
     static aroundhook_list_type& aroundStepHooks();
     static hook_list_type& afterStepHooks();
     static hook_list_type& afterHooks();
-    static hook_list_type& afterAllHooks();
+    static unconditionalhook_list_type& afterAllHooks();
 
 private:
     // We're a singleton so don't allow instances
     HookRegistrar() = delete;
 };
 
-class CUCUMBER_CPP_EXPORT StepCallChain {
+struct CUCUMBER_CPP_EXPORT ScenarioHooks {
+    HookRegistrar::hook_chain_type before;
+    HookRegistrar::aroundhook_chain_type aroundStep;
+    HookRegistrar::hook_chain_type afterStep;
+    HookRegistrar::hook_chain_type after;
+};
+
+/**
+ * Runs a step nested in around step hooks already known to match the
+ * scenario.
+ *
+ * The chain is itself the step that every hook calls to run the rest of
+ * it, so each hook adds a single invocation to the stack and nothing is
+ * created per hook.
+ */
+class CUCUMBER_CPP_EXPORT StepCallChain : public CallableStep {
 public:
     StepCallChain(
-        Scenario* scenario,
         const StepInfo* stepInfo,
         const InvokeArgs* pStepArgs,
-        HookRegistrar::aroundhook_list_type& aroundHooks
+        const HookRegistrar::aroundhook_chain_type& aroundHooks
     );
     InvokeResult exec();
-    void execNext();
+    void call() override;
 
 private:
     void execStep();
 
-    Scenario* scenario;
     const StepInfo* stepInfo;
     const InvokeArgs* pStepArgs;
 
-    HookRegistrar::aroundhook_list_type::iterator nextHook;
-    HookRegistrar::aroundhook_list_type::iterator hookEnd;
+    HookRegistrar::aroundhook_chain_type::const_iterator nextHook;
+    HookRegistrar::aroundhook_chain_type::const_iterator hookEnd;
     InvokeResult result;
 };
 
-class CUCUMBER_CPP_EXPORT CallableStepChain : public CallableStep {
-public:
-    CallableStepChain(StepCallChain* scc);
-    void call() override;
-
-private:
-    StepCallChain* scc;
-};
-
 template<class T>
 static int registerBeforeHook(const std::string& csvTagNotation) {
     std::shared_ptr<T> hook(std::make_shared<T>());
@@ -168,14 +238,18 @@ static int registerAfterHook(const std::string& csvTagNotation) {
 }
 
 template<class T>
-static int registerBeforeAllHook() {
-    HookRegistrar::addBeforeAllHook(std::make_shared<T>());
+static int registerBeforeAllHook(const std::string& csvNameNotation) {
+    std::shared_ptr<T> hook(std::make_shared<T>());
+    hook->setDependencies(csvNameNotation);
+    HookRegistrar::addBeforeAllHook(hook);
     return 0;
 }
 
 template<class T>
-static int registerAfterAllHook() {
-    HookRegistrar::addAfterAllHook(std::make_shared<T>());
+static int registerAfterAllHook(const std::string& csvNameNotation) {
+    std::shared_ptr<T> hook(std::make_shared<T>());
+    hook->setDependencies(csvNameNotation);
+    HookRegistrar::addAfterAllHook(hook);
     return 0;
 }
 
@@ -1,6 +1,7 @@
 #ifndef CUKE_TAG_HPP_
 #define CUKE_TAG_HPP_
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -10,23 +11,49 @@
 namespace cucumber {
 namespace internal {
 
-class CUCUMBER_CPP_EXPORT TagExpression {
+typedef std::size_t tag_id_type;
+
+/**
+ * Set of tags interned into small integer ids, one bit per id.
+ *
+ * Only tags mentioned by some tag expression get an id: other tags can
+ * never make an expression match, so they are left out of the set.
+ */
+class CUCUMBER_CPP_EXPORT TagSet {
 public:
     typedef std::vector<std::string> tag_list;
 
+    TagSet() = default;
+    TagSet(const tag_list& tags);
+
+    static tag_id_type intern(const std::string& tag);
+
+    void insert(tag_id_type id);
+    bool contains(tag_id_type id) const;
+    bool intersects(const TagSet& other) const;
+
+private:
+    typedef std::uint64_t word_type;
+    std::vector<word_type> words;
+};
+
+class CUCUMBER_CPP_EXPORT TagExpression {
+public:
+    typedef TagSet::tag_list tag_list;
+
     virtual ~TagExpression() = default;
-    virtual bool matches(const tag_list& tags) const = 0;
+    bool matches(const tag_list& tags) const;
+    virtual bool matches(const TagSet& tags) const = 0;
 };
 
 class CUCUMBER_CPP_EXPORT OrTagExpression : public TagExpression {
 public:
     OrTagExpression(const std::string& csvTagNotation);
-    bool matches(const tag_list& tags) const override;
+    using TagExpression::matches;
+    bool matches(const TagSet& tags) const override;
 
 private:
-    bool orTagMatchesTagList(const std::string& currentOrTag, const tag_list& tags) const;
-
-    tag_list orTags;
+    TagSet orTags;
 
     static Regex& csvTagNotationRegex();
 };
@@ -35,7 +62,8 @@ class CUCUMBER_CPP_EXPORT AndTagExpression : public TagExpression {
 public:
     AndTagExpression() = default;
     AndTagExpression(const std::string& csvTagNotation);
-    bool matches(const tag_list& tags) const override;
+    using TagExpression::matches;
+    bool matches(const TagSet& tags) const override;
 
 private:
     typedef std::vector<OrTagExpression> or_expressions_type;
@@ -44,6 +72,39 @@ private:
     static Regex& csvTagNotationRegex();
 };
 
+/**
+ * Cucumber tag expression such as "@a and not (@b or @c)".
+ *
+ * The expression is compiled into a postfix program over interned tags,
+ * evaluated on a stack of bits held in a single word. It throws
+ * std::invalid_argument if the expression is malformed.
+ */
+class CUCUMBER_CPP_EXPORT BooleanTagExpression : public TagExpression {
+public:
+    BooleanTagExpression() = default;
+    BooleanTagExpression(const std::string& expression);
+
+    /**
+     * Combines the tag arguments of a hook, as quoted by the hook macros.
+     * Every argument has to match, and each is either a tag expression or
+     * a legacy comma separated list of alternatives such as "@a,@b".
+     */
+    static BooleanTagExpression fromHookNotation(const std::string& csvTagNotation);
+
+    using TagExpression::matches;
+    bool matches(const TagSet& tags) const override;
+
+private:
+    enum Opcode { PUSH_TAG, NOT, AND, OR };
+    struct Instruction {
+        Opcode opcode;
+        tag_id_type tag;
+    };
+    typedef std::vector<Instruction> program_type;
+
+    program_type program;
+};
+
 }
 }
 
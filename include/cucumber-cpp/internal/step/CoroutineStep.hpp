@@ -0,0 +1,305 @@
+#ifndef CUKE_COROUTINESTEP_HPP_
+#define CUKE_COROUTINESTEP_HPP_
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+    #include "StepManager.hpp"
+    #include "../utils/Watchdog.hpp"
+
+    #include <chrono>
+    #include <coroutine>
+    #include <exception>
+    #include <functional>
+    #include <memory>
+    #include <stdexcept>
+    #include <type_traits>
+    #include <utility>
+
+    #define CUKE_COROUTINE_STEPS 1
+
+namespace cucumber {
+
+namespace internal {
+
+/**
+ * Executor resuming the coroutine step bodies that run on the calling
+ * thread, null outside of them
+ */
+inline StepExecutor*& currentStepExecutor() {
+    thread_local StepExecutor* executor = nullptr;
+    return executor;
+}
+
+inline void resumeOn(StepExecutor& executor, const std::coroutine_handle<> coroutine) {
+    StepExecutor*& current = currentStepExecutor();
+    StepExecutor* const previous = current;
+    current = &executor;
+    coroutine.resume();
+    current = previous;
+}
+
+}
+
+/**
+ * Return type of coroutine step bodies, and of the coroutines they await.
+ * Runs once awaited, or once the step is invoked.
+ */
+class StepTask {
+public:
+    struct FinalAwaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<Promise> coroutine
+        ) noexcept {
+            Promise& promise = coroutine.promise();
+            if (promise.continuation) {
+                return promise.continuation;
+            }
+            // Moved out first, as calling back may destroy the coroutine
+            const std::function<void()> completed = std::move(promise.completed);
+            completed();
+            return std::noop_coroutine();
+        }
+        void await_resume() const noexcept {
+        }
+    };
+
+    struct promise_type {
+        /** The coroutine awaiting this one, if any */
+        std::coroutine_handle<> continuation;
+        /** Called back once a task that nothing awaits completes */
+        std::function<void()> completed;
+        std::exception_ptr error;
+
+        StepTask get_return_object() {
+            return StepTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+        FinalAwaiter final_suspend() const noexcept {
+            return {};
+        }
+        void return_void() const noexcept {
+        }
+        void unhandled_exception() {
+            error = std::current_exception();
+        }
+    };
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    struct Awaiter {
+        handle_type coroutine;
+
+        bool await_ready() const noexcept {
+            return !coroutine || coroutine.done();
+        }
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept {
+            coroutine.promise().continuation = awaiting;
+            return coroutine;
+        }
+        void await_resume() const {
+            if (coroutine && coroutine.promise().error) {
+                std::rethrow_exception(coroutine.promise().error);
+            }
+        }
+    };
+
+    StepTask() = default;
+    explicit StepTask(const handle_type coroutine) :
+        coroutine(coroutine) {
+    }
+    StepTask(StepTask&& other) noexcept :
+        coroutine(std::exchange(other.coroutine, nullptr)) {
+    }
+    StepTask& operator=(StepTask&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            coroutine = std::exchange(other.coroutine, nullptr);
+        }
+        return *this;
+    }
+    ~StepTask() {
+        destroy();
+    }
+
+    StepTask(const StepTask&) = delete;
+    StepTask& operator=(const StepTask&) = delete;
+
+    Awaiter operator co_await() const noexcept {
+        return Awaiter{coroutine};
+    }
+
+    /**
+     * Runs the task until it first waits, calling back once it completes.
+     * Calling back may destroy the task.
+     */
+    void start(internal::StepExecutor& executor, std::function<void()> completed) {
+        coroutine.promise().completed = std::move(completed);
+        internal::resumeOn(executor, coroutine);
+    }
+
+    /**
+     * Rethrows what the completed task threw, if anything
+     */
+    void rethrowError() const {
+        if (coroutine.promise().error) {
+            std::rethrow_exception(coroutine.promise().error);
+        }
+    }
+
+private:
+    void destroy() {
+        if (coroutine) {
+            coroutine.destroy();
+        }
+    }
+
+    handle_type coroutine;
+};
+
+/**
+ * Awaited, suspends the step body until the function given to start is
+ * called, once and from any thread; start is called with it once the body
+ * is suspended. The body goes on on a thread of the executor the step was
+ * invoked with.
+ */
+template<typename Start>
+class ResumeAwaiter {
+public:
+    explicit ResumeAwaiter(Start start) :
+        start(std::move(start)) {
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+    void await_suspend(const std::coroutine_handle<> coroutine) {
+        internal::StepExecutor* const executor = internal::currentStepExecutor();
+        if (!executor) {
+            throw std::logic_error("Coroutine step bodies only wait when invoked as steps");
+        }
+        // Moved out, as the awaiter is gone once the body goes on
+        Start starting = std::move(start);
+        starting(std::function<void()>([executor, coroutine] {
+            executor->post([executor, coroutine] {
+                internal::resumeOn(*executor, coroutine);
+            });
+        }));
+    }
+    void await_resume() const noexcept {
+    }
+
+private:
+    Start start;
+};
+
+/**
+ * Hands the function resuming the step body to an asynchronous operation,
+ * typically as its completion handler:
+ *
+ *   co_await cucumber::resumeWhen([&](std::function<void()> resume) {
+ *       client.asyncGet(url, [&, resume](Response r) { response = r; resume(); });
+ *   });
+ */
+template<typename Start>
+ResumeAwaiter<Start> resumeWhen(Start start) {
+    return ResumeAwaiter<Start>(std::move(start));
+}
+
+/**
+ * Suspends the step body for the duration, rounded up to the Watchdog
+ * tick, without holding on to its thread
+ */
+inline auto resumeAfter(const std::chrono::milliseconds duration) {
+    return resumeWhen([duration](std::function<void()> resume) {
+        internal::Watchdog::instance().arm(duration, std::move(resume));
+    });
+}
+
+namespace internal {
+
+/**
+ * Step whose body is a coroutine, see CO_WHEN. Invoked asynchronously, the
+ * thread goes on with other work while the body waits. Invoked as any other
+ * step, the calling thread waits for the body.
+ *
+ * Failures are reported as with the generic driver, from what the body
+ * throws.
+ */
+class CoroutineStep : public BasicStep {
+public:
+    static void invokeAsync(
+        std::shared_ptr<CoroutineStep> step,
+        const InvokeArgs* pArgs,
+        const StepInfo::argument_indexes_type& argumentIndexes,
+        StepExecutor& executor,
+        invoke_callback_type done
+    ) {
+        CoroutineStep& invoked = *step;
+        invoked.prepareInvoke(pArgs, &argumentIndexes);
+        try {
+            invoked.task = invoked.coroutineBody();
+        } catch (...) {
+            done(currentExceptionResult());
+            return;
+        }
+        // The step keeps itself alive until its body completes
+        invoked.task.start(executor, [step = std::move(step), done = std::move(done)] {
+            done(step->result());
+        });
+    }
+
+protected:
+    virtual StepTask coroutineBody() = 0;
+
+    const InvokeResult invokeStepBody() override {
+        body();
+        return InvokeResult::success();
+    }
+
+    void body() override {
+        QueuedStepExecutor executor;
+        bool completed = false;
+        task = coroutineBody();
+        task.start(executor, [&completed] {
+            completed = true;
+        });
+        executor.runUntil([&completed] {
+            return completed;
+        });
+        task.rethrowError();
+    }
+
+private:
+    InvokeResult result() const {
+        try {
+            task.rethrowError();
+        } catch (...) {
+            return currentExceptionResult();
+        }
+        return completedResult(InvokeResult::success());
+    }
+
+    StepTask task;
+};
+
+/**
+ * Arguments of a coroutine body outlive the call that creates it, unlike
+ * the temporaries that references would bind to
+ */
+template<typename F>
+struct takes_arguments_by_value;
+
+template<typename C, typename R, typename... Args>
+struct takes_arguments_by_value<R (C::*)(Args...)>
+    : std::conjunction<std::negation<std::is_reference<Args>>...> {};
+
+}
+}
+
+#endif
+
+#endif /* CUKE_COROUTINESTEP_HPP_ */
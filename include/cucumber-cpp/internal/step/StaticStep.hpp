@@ -0,0 +1,66 @@
+#ifndef CUKE_STATICSTEP_HPP_
+#define CUKE_STATICSTEP_HPP_
+
+#include "StepManager.hpp"
+#include "StepSnapshot.hpp"
+#include "../utils/StaticCucumberExpression.hpp"
+
+#include <memory>
+#include <string>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * What registering the step derives from a compile time transform
+ */
+template<typename Transform>
+StepSnapshotEntry toStepSnapshotEntry(const Transform& transform) {
+    StepSnapshotEntry entry;
+    entry.regex = std::string(transform.getRegex());
+    for (const StaticParameter& parameter : transform.parameters) {
+        entry.parameters.push_back(
+            {std::string(BUILT_IN_PARAMETER_TYPES[parameter.type].name), parameter.group}
+        );
+    }
+    entry.hasMatcher = transform.matchable;
+    if (entry.hasMatcher) {
+        for (const StaticSegment& segment : transform.segments) {
+            std::vector<std::string> texts;
+            for (std::size_t i = 0; i < segment.texts; ++i) {
+                texts.emplace_back(transform.getText(segment.firstText + i));
+            }
+            entry.segments.push_back({segment.kind, std::move(texts), segment.groups, nullptr});
+        }
+    }
+    return entry;
+}
+
+/**
+ * Registers a step whose step matcher is known at compile time, given as a
+ * type with a static constexpr get() returning it. Cucumber Expressions
+ * with built-in parameter types only are transformed and validated by the
+ * compiler, so malformed ones fail the build; their regular expression is
+ * compiled the first time it is matched. Simple regular expressions get a
+ * matcher generated at compile time, and are only compiled for the texts
+ * it leaves to them. Other step matchers register as with registerStep.
+ */
+template<class T, class StepMatcher>
+static int registerStaticStep(StepMatcher, const char* file, const int line) {
+    typedef StaticStepMatcher<StepMatcher> static_matcher;
+    if constexpr (!static_matcher::sizes.transformed) {
+        return registerStep<T>(StepMatcher::get(), file, line);
+    } else {
+        const std::string stepMatcher = StepMatcher::get();
+        const std::string source = toSourceString(file, line);
+        const ScopedStartupTiming timing(STARTUP_REGISTER_STEP, stepMatcher, source);
+        return StepManager::addStep(std::make_shared<StepInvoker<T>>(
+            stepMatcher, source, toStepSnapshotEntry(static_matcher::transform)
+        ));
+    }
+}
+
+}
+}
+
+#endif /* CUKE_STATICSTEP_HPP_ */
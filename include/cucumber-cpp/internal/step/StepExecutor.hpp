@@ -0,0 +1,55 @@
+#ifndef CUKE_STEPEXECUTOR_HPP_
+#define CUKE_STEPEXECUTOR_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Where asynchronous steps go on once what they wait for is done
+ */
+class CUCUMBER_CPP_EXPORT StepExecutor {
+public:
+    typedef std::function<void()> task_type;
+
+    virtual ~StepExecutor() = default;
+
+    /**
+     * Runs the task later on a thread of the executor. Called from any
+     * thread.
+     */
+    virtual void post(task_type task) = 0;
+};
+
+/**
+ * Runs the tasks posted to it, in order, on the thread waiting for them
+ */
+class CUCUMBER_CPP_EXPORT QueuedStepExecutor : public StepExecutor {
+public:
+    void post(task_type task) override;
+
+    /**
+     * Waits for the next task and runs it
+     */
+    void runOne();
+    /**
+     * Runs tasks until done() returns true, checking it before each one
+     */
+    void runUntil(const std::function<bool()>& done);
+
+private:
+    std::mutex mutex;
+    std::condition_variable posted;
+    std::deque<task_type> tasks;
+};
+
+}
+}
+
+#endif /* CUKE_STEPEXECUTOR_HPP_ */
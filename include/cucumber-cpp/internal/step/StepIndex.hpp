@@ -0,0 +1,198 @@
+#ifndef CUKE_STEPINDEX_HPP_
+#define CUKE_STEPINDEX_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include "StepManager.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Literal text that every match of a regular expression must contain.
+ */
+struct CUCUMBER_CPP_EXPORT RegexLiteralPrefix {
+    /**
+     * Literal characters the regular expression starts with
+     */
+    std::string text;
+
+    /**
+     * True if the regular expression is anchored with '^', so the text has
+     * to be found at the beginning of the input instead of anywhere in it
+     */
+    bool anchored;
+};
+
+/**
+ * Extracts the literal prefix of an ECMAScript regular expression.
+ *
+ * The extraction is conservative: it stops at the first character that
+ * is not matched literally and drops characters made optional by a
+ * quantifier. Top-level alternations yield an empty prefix.
+ */
+CUCUMBER_CPP_EXPORT RegexLiteralPrefix extractLiteralPrefix(const std::string& regex);
+
+/**
+ * Extracts the literal fragments that every match of an ECMAScript regular
+ * expression must contain, outside of any group.
+ *
+ * Like extractLiteralPrefix() this is conservative: top-level alternations
+ * yield no fragments at all.
+ */
+CUCUMBER_CPP_EXPORT std::vector<std::string> extractRequiredLiterals(const std::string& regex);
+
+/**
+ * Aho-Corasick automaton finding a set of literals in a single pass.
+ */
+class CUCUMBER_CPP_EXPORT LiteralAutomaton {
+public:
+    typedef std::vector<std::string>::size_type literal_id_type;
+
+    LiteralAutomaton();
+
+    literal_id_type add(const std::string& literal);
+    literal_id_type size() const;
+
+    /**
+     * Flags, indexed by literal id, of the literals found in the text
+     */
+    std::vector<bool> find(const std::string& text) const;
+    void find(const std::string& text, std::vector<bool>& found) const;
+
+    /**
+     * Builds the automaton for the literals added so far, which find()
+     * would otherwise do on first use. Concurrent finds need it done.
+     *
+     * Literals added once it is built are inserted into the trie as it
+     * is, only its failure links being worked out again.
+     */
+    void prepare() const;
+
+private:
+    struct Node {
+        std::map<char, std::size_t> next;
+        std::size_t fail;
+        /** Literals ending at the node */
+        std::vector<literal_id_type> terminal;
+        /** Literals ending at the node or along its failure links */
+        std::vector<literal_id_type> output;
+    };
+
+    void build() const;
+
+    std::vector<std::string> literals;
+    mutable std::vector<Node> nodes;
+    /** Literals already in the trie */
+    mutable literal_id_type inserted;
+    mutable bool built;
+};
+
+/**
+ * Prefilter for step definitions based on the literal text of their regex.
+ *
+ * In LITERAL_PREFIX_INDEX mode anchored prefixes are stored in a trie, so that
+ * finding the candidates for a step description costs a walk of its first
+ * characters instead of a regular expression search per step definition.
+ *
+ * In MULTI_PATTERN_INDEX mode all literal fragments required by any step are
+ * compiled into a single automaton: one pass over the step description
+ * finds the steps it can match, whatever the number of step definitions.
+ */
+class CUCUMBER_CPP_EXPORT StepIndex {
+public:
+    typedef std::vector<step_id_type> candidates_type;
+
+    StepIndex(StepIndexMode mode = LITERAL_PREFIX_INDEX);
+
+    StepIndexMode getMode() const;
+
+    void add(step_id_type id, const std::string& regex);
+    /**
+     * Same as above with the literal text of the regular expression
+     * extracted beforehand. Only MULTI_PATTERN_INDEX uses the required
+     * literals.
+     */
+    void add(
+        step_id_type id, const RegexLiteralPrefix& prefix, const std::vector<std::string>& literals
+    );
+    void clear();
+
+    /**
+     * Step ids, in ascending order, whose literal text does not exclude
+     * a match for the step description.
+     */
+    candidates_type candidates(const std::string& stepDescription) const;
+    /**
+     * Same as above, filling lookup.candidates without allocating once the
+     * lookup storage has grown large enough.
+     */
+    void candidates(const std::string& stepDescription, StepIndexLookup& lookup) const;
+    /**
+     * Step ids, in ascending order, whose literal text does not exclude a
+     * match for some step description starting with the given text.
+     */
+    candidates_type prefixedCandidates(const std::string& descriptionPrefix) const;
+
+    /**
+     * Whether the literal text of the step rules out that any other step
+     * matches a description it matches: both are anchored and neither
+     * prefix starts the other. A match of such a step needs no search for
+     * others. Steps not anchored, or without a prefix, leave every step
+     * ambiguous.
+     */
+    bool isUnambiguous(step_id_type id) const;
+
+    /**
+     * Completes the lazy part of the index. Lookups are then free of side
+     * effects and can run concurrently.
+     */
+    void prepare() const;
+
+private:
+    struct TrieNode {
+        TrieNode() = default;
+        /** Deep copy, so that indexes can be copied */
+        TrieNode(const TrieNode& other);
+        TrieNode(TrieNode&&) = default;
+        TrieNode& operator=(const TrieNode& other);
+        TrieNode& operator=(TrieNode&&) = default;
+
+        std::map<char, std::unique_ptr<TrieNode>> children;
+        candidates_type ids;
+    };
+
+    struct RequiredLiterals {
+        step_id_type id;
+        RegexLiteralPrefix prefix;
+        std::vector<LiteralAutomaton::literal_id_type> literals;
+    };
+
+    void prefixCandidates(const std::string& stepDescription, StepIndexLookup& lookup) const;
+    void automatonCandidates(const std::string& stepDescription, StepIndexLookup& lookup) const;
+    static void subtreeCandidates(const TrieNode& node, candidates_type& result);
+    void analyseAmbiguity() const;
+
+    StepIndexMode mode;
+
+    TrieNode anchoredPrefixes;
+    std::vector<std::pair<step_id_type, std::string>> unanchoredPrefixes;
+
+    LiteralAutomaton automaton;
+    std::map<std::string, LiteralAutomaton::literal_id_type> automatonLiterals;
+    std::vector<RequiredLiterals> requiredLiterals;
+
+    std::vector<std::pair<step_id_type, RegexLiteralPrefix>> prefixes;
+    /** Indexed by step id, filled by prepare() */
+    mutable std::vector<bool> unambiguous;
+    mutable bool analysed = false;
+};
+
+}
+}
+
+#endif /* CUKE_STEPINDEX_HPP_ */
@@ -0,0 +1,54 @@
+#ifndef CUKE_STEPLIBRARY_HPP_
+#define CUKE_STEPLIBRARY_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Shared libraries of step definitions loaded while the process runs, such
+ * as by a wire server kept warm across jobs. Their static initializers
+ * register their steps and hooks as those linked in do, the steps being
+ * added to the prefilter index as it is.
+ *
+ * The libraries have to reach the step registry of the process, so both
+ * they and the process must link cucumber-cpp as a shared library. They
+ * are never unloaded.
+ *
+ * Loading is not synchronised with matching or invoking steps: libraries
+ * are to be loaded while no scenario runs.
+ *
+ * Wire clients may only have libraries loaded once allowed to, as they
+ * could otherwise load any file the server can read.
+ */
+class CUCUMBER_CPP_EXPORT StepLibraries {
+public:
+    /**
+     * Loads the library unless it already was.
+     *
+     * @return the number of step definitions it registered
+     *
+     * @throws std::runtime_error if it cannot be loaded
+     */
+    static std::size_t load(const std::string& path);
+    /**
+     * Paths of the libraries loaded, in the order they were
+     */
+    static std::vector<std::string> loaded();
+
+    /**
+     * Whether wire clients may load libraries, off by default
+     */
+    static void setLoadableByClients(bool loadable);
+    static bool isLoadableByClients();
+};
+
+}
+}
+
+#endif /* CUKE_STEPLIBRARY_HPP_ */
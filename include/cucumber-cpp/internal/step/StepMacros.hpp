@@ -27,8 +27,23 @@
     )                                                       \
     /**/
 
-#define CUKE_STEP_REGISTRATION_(step_name, step_matcher) \
-    ::cucumber::internal::registerStep<step_name>(step_matcher, __FILE__, __LINE__) /**/
+#ifdef CUKE_CONSTEXPR_STEPS
+    // The step matcher is passed as a type so that it can be transformed at compile time
+    #define CUKE_STEP_REGISTRATION_(step_name, step_matcher)                    \
+        ::cucumber::internal::registerStaticStep<step_name>(                    \
+            [] {                                                                \
+                struct StepMatcher {                                            \
+                    static constexpr const char* get() { return step_matcher; } \
+                };                                                              \
+                return StepMatcher();                                           \
+            }(),                                                                \
+            __FILE__,                                                           \
+            __LINE__                                                            \
+        ) /**/
+#else
+    #define CUKE_STEP_REGISTRATION_(step_name, step_matcher) \
+        ::cucumber::internal::registerStep<step_name>(step_matcher, __FILE__, __LINE__) /**/
+#endif
 
 // ************************************************************************** //
 // **************               GIVEN/WHEN/THEN                ************** //
@@ -38,6 +53,28 @@
 #define WHEN CUKE_STEP_
 #define THEN CUKE_STEP_
 
+// ************************************************************************** //
+// **************          CO_GIVEN/CO_WHEN/CO_THEN            ************** //
+// ************************************************************************** //
+
+// Step bodies that are C++20 coroutines returning cucumber::StepTask, see
+// CoroutineStep.hpp. They may co_await cucumber::resumeWhen(),
+// cucumber::resumeAfter() and other StepTasks.
+#define CUKE_CO_STEP_(...)                       \
+    CUKE_CO_STEP_WITH_NAME_(                     \
+        CUKE_GEN_OBJECT_NAME_,                   \
+        CUKE_STEP_GET_MATCHER_(__VA_ARGS__, ()), \
+        CUKE_STEP_GET_ARGS_(__VA_ARGS__, (), ()) \
+    )                                            \
+    /**/
+
+#define CUKE_CO_STEP_WITH_NAME_(step_name, step_matcher, args) \
+    CUKE_CO_OBJECT_(step_name, CUKE_STEP_REGISTRATION_(step_name, step_matcher), args) /**/
+
+#define CO_GIVEN CUKE_CO_STEP_
+#define CO_WHEN CUKE_CO_STEP_
+#define CO_THEN CUKE_CO_STEP_
+
 // ************************************************************************** //
 // **************                 REGEX_PARAM                  ************** //
 // ************************************************************************** //
@@ -45,4 +82,15 @@
 #define REGEX_PARAM(type, name) const type name(getInvokeArg<type>())
 #define TABLE_PARAM(name) const ::cucumber::internal::Table& name = getArgs()->getTableArg()
 
+// ************************************************************************** //
+// **************             CUKE_PARAMETER_TYPE              ************** //
+// ************************************************************************** //
+
+// Custom parameter type converted by a transformer taking a std::string_view,
+// whose result steps read as arguments. Defined ahead of the steps using it.
+#define CUKE_PARAMETER_TYPE(name, regexp, ...)                                  \
+    static const int CUKE_GEN_OBJECT_NAME_ =                                    \
+        ::cucumber::internal::registerParameterType(#name, regexp, __VA_ARGS__) \
+    /**/
+
 #endif /* CUKE_STEPMACROS_HPP_ */
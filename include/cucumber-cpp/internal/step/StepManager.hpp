@@ -1,18 +1,30 @@
 #ifndef CUKE_STEPMANAGER_HPP_
 #define CUKE_STEPMANAGER_HPP_
 
-#include <map>
+#include <cctype>
+#include <atomic>
+#include <cstdint>
+#include <charconv>
 #include <sstream>
 #include <stdexcept>
+#include <functional>
+#include <iosfwd>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 #include <cucumber-cpp/internal/CukeExport.hpp>
+#include "../StartupProfile.hpp"
 #include "../Table.hpp"
+#include "StepExecutor.hpp"
+#include "../utils/CucumberExpression.hpp"
 #include "../utils/IndexSequence.hpp"
 #include "../utils/Regex.hpp"
+#include "../utils/StringConversion.hpp"
 
 namespace cucumber {
 namespace internal {
@@ -20,6 +32,8 @@ namespace internal {
 typedef unsigned int step_id_type;
 
 class StepInfo;
+class StepIndex;
+class StepSnapshot;
 
 class CUCUMBER_CPP_EXPORT SingleStepMatch {
 public:
@@ -27,7 +41,10 @@ public:
 
     operator const void*() const;
 
-    std::shared_ptr<const StepInfo> stepInfo;
+    /**
+     * Owned by StepManager, which keeps step definitions once registered
+     */
+    const StepInfo* stepInfo = nullptr;
     submatches_type submatches;
 };
 
@@ -35,7 +52,7 @@ class CUCUMBER_CPP_EXPORT MatchResult {
 public:
     typedef std::vector<SingleStepMatch> match_results_type;
 
-    const match_results_type& getResultSet();
+    const match_results_type& getResultSet() const;
     void addMatch(SingleStepMatch match);
 
     explicit operator bool() const;
@@ -49,18 +66,37 @@ class CUCUMBER_CPP_EXPORT InvokeArgs {
 
 public:
     typedef args_type::size_type size_type;
+    /** Header row first, as the engine receives tables */
+    typedef std::vector<args_type> raw_table_type;
 
     InvokeArgs() = default;
 
-    void addArg(const std::string arg);
+    void addArg(std::string arg);
+    /**
+     * Keeps the table as it is, only turning it into a Table when the
+     * step asks for it
+     *
+     * @throws std::range_error if a row does not match the header
+     */
+    void setTableArg(raw_table_type&& table);
     Table& getVariableTableArg();
 
     template<class T>
     T getInvokeArg(size_type i) const;
+    /**
+     * Builds the table on the first call
+     */
     const Table& getTableArg() const;
+    /**
+     * Equal for invocations with the same args and table
+     */
+    std::string fingerprint() const;
 
 private:
-    Table tableArg;
+    void buildTableArg() const;
+
+    mutable raw_table_type rawTableArg;
+    mutable Table tableArg;
     args_type args;
 };
 
@@ -70,44 +106,148 @@ enum InvokeResultType {
     PENDING
 };
 
+/**
+ * Outcome of a step. Successes carry no description and copies share theirs,
+ * so passing results around allocates nothing.
+ */
 class CUCUMBER_CPP_EXPORT InvokeResult {
 private:
     InvokeResultType type;
-    std::string description;
+    /**
+     * Null when empty
+     */
+    std::shared_ptr<const std::string> description;
+    bool idempotent = false;
 
     InvokeResult(const InvokeResultType type, const char* description);
+    InvokeResult(const InvokeResultType type, std::string&& description);
 
 public:
     InvokeResult();
-    InvokeResult(const InvokeResult& ir);
-    InvokeResult& operator=(const InvokeResult& rhs);
 
     static InvokeResult success();
     static InvokeResult failure(const char* description);
-    static InvokeResult failure(const std::string& description);
+    static InvokeResult failure(std::string description);
     static InvokeResult pending(const char* description);
 
     bool isSuccess() const;
     bool isPending() const;
     InvokeResultType getType() const;
     const std::string& getDescription() const;
+
+    /**
+     * Whether the step said that invoking it again with the same args
+     * would change nothing, see BasicStep::idempotent()
+     */
+    bool isIdempotent() const;
+    void setIdempotent();
 };
 
-class CUCUMBER_CPP_EXPORT StepInfo : public std::enable_shared_from_this<StepInfo> {
+/**
+ * Called once with the result of a step invoked asynchronously
+ */
+typedef std::function<void(const InvokeResult&)> invoke_callback_type;
+
+/**
+ * What a bodyWithArgs argument is converted to, as far as checking it
+ * against the parameter types of a Cucumber Expression is concerned
+ */
+enum StepArgumentKind {
+    INTEGRAL_ARGUMENT,
+    FLOATING_POINT_ARGUMENT,
+    OTHER_ARGUMENT
+};
+
+struct StepSnapshotEntry;
+
+template<typename T>
+constexpr StepArgumentKind stepArgumentKind() {
+    return std::is_floating_point<T>::value ? FLOATING_POINT_ARGUMENT
+           : (std::is_integral<T>::value && !std::is_same<T, bool>::value) ? INTEGRAL_ARGUMENT
+                                                                           : OTHER_ARGUMENT;
+}
+
+class CUCUMBER_CPP_EXPORT StepInfo {
 public:
+    /**
+     * Invoke argument read for each bodyWithArgs argument, or empty to read
+     * them in order
+     */
+    typedef std::vector<InvokeArgs::size_type> argument_indexes_type;
+
     StepInfo(const std::string& stepMatcher, const std::string source);
 
     virtual ~StepInfo() = default;
 
+    /**
+     * @throws RegexComplexityError if the regular expression backend gave
+     *         up matching, naming the step definition
+     */
     SingleStepMatch matches(const std::string& stepDescription) const;
+    bool matches(
+        const std::string& stepDescription, std::vector<RegexSubmatchSpan>& submatches
+    ) const;
     virtual InvokeResult invokeStep(const InvokeArgs* pArgs) const = 0;
+    /**
+     * Whether the step body may wait asynchronously, see CO_WHEN
+     */
+    virtual bool isAsync() const;
+    /**
+     * Invokes the step without blocking while its body waits, calling back
+     * with its result on a thread of the executor once it completes. Steps
+     * that are not asynchronous call back before returning. The args must
+     * outlive the invocation.
+     */
+    virtual void invokeStepAsync(
+        const InvokeArgs* pArgs, StepExecutor& executor, invoke_callback_type done
+    ) const;
 
     step_id_type id;
     Regex regex;
-    const std::string source;
-    const std::string stepDef;
+    /**
+     * Like "Steps.cpp:12". Both strings are interned with those of the
+     * other step definitions.
+     */
+    const std::string_view source;
+    const std::string_view stepDef;
+    /**
+     * Empty unless the step matcher is a Cucumber Expression
+     */
+    const std::vector<CucumberExpressionParameter> parameters;
+    /**
+     * Descriptions matched since registration, missing those answered by
+     * the match cache
+     */
+    mutable std::atomic<std::uint64_t> matchCount;
+
+protected:
+    /**
+     * Maps the bodyWithArgs arguments to the capture groups of the
+     * parameters they stand for.
+     *
+     * @throws std::invalid_argument if there are more arguments than
+     *         parameters, or if a decimal parameter is read as an integer
+     */
+    argument_indexes_type bindArguments(const std::vector<StepArgumentKind>& arguments) const;
+
+    /**
+     * @param snapshot What a step snapshot, or the compile time transform
+     *        of the step matcher, knows of it, if anything
+     */
+    StepInfo(
+        const std::string& stepMatcher, const std::string& source, const StepSnapshotEntry* snapshot
+    );
 
 private:
+    SingleStepMatch singleStepMatch(RegexMatch& regexMatch) const;
+    /**
+     * Names the step definition in the error
+     */
+    RegexComplexityError complexityError(const RegexComplexityError& e) const;
+
+    // Matches in place of the regular expression when not null
+    const std::shared_ptr<const CucumberExpressionMatcher> matcher;
+
     // Shut up MSVC warning C4512: assignment operator could not be generated
     StepInfo& operator=(const StepInfo& other);
 };
@@ -117,6 +257,9 @@ public:
     virtual ~BasicStep() = default;
 
     InvokeResult invoke(const InvokeArgs* pArgs);
+    InvokeResult invoke(
+        const InvokeArgs* pArgs, const StepInfo::argument_indexes_type& argumentIndexes
+    );
 
 protected:
     typedef const Table table_type;
@@ -125,8 +268,31 @@ protected:
     virtual const InvokeResult invokeStepBody() = 0;
     virtual void body() = 0;
 
+    /**
+     * Makes the args readable by the body, for steps completing the
+     * invocation themselves
+     */
+    void prepareInvoke(
+        const InvokeArgs* pArgs, const StepInfo::argument_indexes_type* argumentIndexes
+    );
+    /**
+     * What invoke() returns for a body that returned, pending if it called
+     * pending()
+     */
+    InvokeResult completedResult(InvokeResult returnedResult) const;
+    /**
+     * What invoke() returns for a body that threw the exception being
+     * handled
+     */
+    static InvokeResult currentExceptionResult();
+
     void pending(const char* description);
     void pending();
+    /**
+     * Lets a successful invocation stand for those with the same args
+     * and table for the rest of the feature, which then run no body
+     */
+    void idempotent();
 
     template<class T>
     const T getInvokeArg();
@@ -134,7 +300,10 @@ protected:
 
     template<typename Derived, typename R, typename... Args, std::size_t... N>
     static R invokeWithIndexedArgs(Derived& that, R (Derived::*f)(Args...), index_sequence<N...>) {
-        return (that.*f)(that.pArgs->template getInvokeArg<typename std::decay<Args>::type>(N)...);
+        return (that.*f)(
+            that.pArgs->template getInvokeArg<typename std::decay<Args>::type>(that.argumentIndex(N)
+            )...
+        );
     }
 
     template<typename Derived, typename R, typename... Args>
@@ -144,80 +313,357 @@ protected:
     }
 
 private:
+    InvokeArgs::size_type argumentIndex(std::size_t argument) const;
+
     // FIXME: awful hack because of Boost::Test
     InvokeResult currentResult;
+    bool idempotentInvocation = false;
 
     const InvokeArgs* pArgs;
     InvokeArgs::size_type currentArgIndex;
+    const StepInfo::argument_indexes_type* argumentIndexes = nullptr;
+};
+
+/**
+ * Kinds of the bodyWithArgs arguments of a step class, none if it has no
+ * such member function
+ */
+template<typename T, typename = void>
+struct step_argument_kinds {
+    static std::vector<StepArgumentKind> get() {
+        return {};
+    }
+};
+
+template<typename F>
+struct member_function_argument_kinds;
+
+template<typename C, typename R, typename... Args>
+struct member_function_argument_kinds<R (C::*)(Args...)> {
+    static std::vector<StepArgumentKind> get() {
+        return {stepArgumentKind<typename std::decay<Args>::type>()...};
+    }
 };
 
+template<typename T>
+struct step_argument_kinds<T, std::void_t<decltype(&T::bodyWithArgs)>>
+    : member_function_argument_kinds<decltype(&T::bodyWithArgs)> {};
+
+/**
+ * Step classes that can be invoked asynchronously, through a static
+ * invokeAsync member function
+ */
+template<typename T, typename = void>
+struct is_async_step : std::false_type {};
+
+template<typename T>
+struct is_async_step<T, std::void_t<decltype(&T::invokeAsync)>> : std::true_type {};
+
 template<class T>
 class StepInvoker : public StepInfo {
 public:
     StepInvoker(const std::string& stepMatcher, const std::string source);
+    StepInvoker(
+        const std::string& stepMatcher, const std::string& source, const StepSnapshotEntry& entry
+    );
 
     InvokeResult invokeStep(const InvokeArgs* args) const override;
+    bool isAsync() const override;
+    void invokeStepAsync(
+        const InvokeArgs* pArgs, StepExecutor& executor, invoke_callback_type done
+    ) const override;
+
+private:
+    const argument_indexes_type argumentIndexes;
+};
+
+/**
+ * Prefilters selecting the step definitions searched by StepManager::stepMatches
+ */
+enum StepIndexMode {
+    LITERAL_PREFIX_INDEX,
+    MULTI_PATTERN_INDEX
+};
+
+/**
+ * Reusable storage for StepIndex::candidates
+ */
+struct StepIndexLookup {
+    std::vector<step_id_type> candidates;
+    std::vector<bool> literalsFound;
+};
+
+/**
+ * Reusable result storage for StepManager::stepMatches. Submatches are byte
+ * offsets into the matched step description, so once the vectors have grown
+ * large enough matching allocates no result storage.
+ */
+class CUCUMBER_CPP_EXPORT StepMatchBuffer {
+public:
+    typedef std::vector<RegexSubmatchSpan> submatches_type;
+
+    struct Match {
+        const StepInfo* stepInfo;
+        submatches_type::size_type firstSubmatch;
+        submatches_type::size_type submatchCount;
+    };
+    typedef std::vector<Match> matches_type;
+
+    void clear();
+
+    const matches_type& getMatches() const;
+    const RegexSubmatchSpan& getSubmatch(const Match& match, submatches_type::size_type i) const;
+
+private:
+    friend class StepManager;
+
+    matches_type matches;
+    submatches_type submatches;
+    submatches_type stepSubmatches;
+    StepIndexLookup lookup;
+};
+
+/**
+ * Two step definitions matching the same step description
+ */
+struct CUCUMBER_CPP_EXPORT StepAmbiguity {
+    const StepInfo* first;
+    const StepInfo* second;
+    /** Matched by both, empty when they have the same pattern */
+    std::string example;
 };
 
 class CUCUMBER_CPP_EXPORT StepManager {
 protected:
-    typedef std::map<step_id_type, std::shared_ptr<const StepInfo>> steps_type;
+    /**
+     * Indexed by step id, null where no step has the id. Ids are handed out
+     * in sequence so the vector stays dense.
+     */
+    typedef std::vector<std::shared_ptr<const StepInfo>> steps_type;
+    typedef std::unordered_map<std::string, MatchResult> match_cache_type;
 
 public:
+    /**
+     * Maximum number of distinct step descriptions kept in the match cache
+     * before it is flushed.
+     */
+    static constexpr match_cache_type::size_type MATCH_CACHE_CAPACITY = 10000;
+
+    /**
+     * Registers a step definition, invalidating all cached match results.
+     */
     static step_id_type addStep(std::shared_ptr<StepInfo> stepInfo);
+    /**
+     * Registers step definitions at once, growing the registry and
+     * invalidating cached match results only once.
+     */
+    static void addSteps(const std::vector<std::shared_ptr<StepInfo>>& stepInfos);
+
+    /**
+     * Finds the step definitions matching a step description.
+     *
+     * Only step definitions whose literal prefix fits the description are
+     * searched, and none after one that no other can match the same
+     * descriptions as, see StepIndex::isUnambiguous, or after the first
+     * match while first match only is enabled. Results are memoized by
+     * description until the next step registration.
+     */
     static MatchResult stepMatches(const std::string& stepDescription);
+    /**
+     * Finds the step definitions matching a step description into a buffer
+     * that is cleared first. Bypasses the match cache and the matching
+     * threads.
+     */
+    static void stepMatches(const std::string& stepDescription, StepMatchBuffer& buffer);
+    /**
+     * Finds the step definitions matching each row of a Scenario Outline
+     * step, the rows being its template with the <placeholder>s replaced.
+     *
+     * The step definitions that can match are looked up once, from the
+     * template text before its first placeholder. Rows are then only tried
+     * against those. Templates starting with a placeholder are matched row
+     * by row through stepMatches. Bypasses the match cache.
+     */
+    static std::vector<MatchResult> outlineStepMatches(
+        const std::string& templateText, const std::vector<std::string>& rowDescriptions
+    );
+    /**
+     * Pairs of step definitions known to match a same description: those
+     * with the same pattern, and those matching the literal text another
+     * one starts with when that one matches it as a whole. Others may
+     * still turn out ambiguous when matched.
+     */
+    static std::vector<StepAmbiguity> ambiguousSteps();
+    /**
+     * Writes a line per ambiguity found by ambiguousSteps(), if any
+     *
+     * @return whether any was found
+     */
+    static bool reportAmbiguousSteps(std::ostream& out);
+    /**
+     * Writes a line per step definition given as a regular expression
+     * that backtrackingHazard() finds prone to backtracking, if any.
+     * Cucumber Expressions are left out.
+     *
+     * @return whether any was found
+     */
+    static bool reportBacktrackingHazards(std::ostream& out);
     static const StepInfo* getStep(step_id_type id);
+    /**
+     * Registered step definitions, in order of their ids
+     */
+    static std::vector<const StepInfo*> getSteps();
+
+    /**
+     * Calls of the memoizing stepMatches since the process started, and how
+     * many of them the match cache answered. Never reset.
+     */
+    struct MatchCounters {
+        std::uint64_t calls;
+        std::uint64_t cacheHits;
+    };
+    static MatchCounters matchCounters();
+    /**
+     * Changes whenever a step registration or a matching setting may
+     * change what stepMatches finds, for caches of its results kept
+     * elsewhere.
+     */
+    static std::uint64_t matchGeneration();
+
+    /**
+     * Selects the prefilter used by stepMatches, rebuilding it from the
+     * registered steps.
+     */
+    static void setIndexMode(StepIndexMode mode);
+
+    /**
+     * Steps registered while lazy compilation is enabled keep only their
+     * regular expression string and compile it the first time they are
+     * matched. Matchers without parameter types are then always taken as
+     * regular expressions. Defaults to the CUKE_LAZY_STEP_COMPILATION
+     * build option.
+     */
+    static void setLazyCompilation(bool lazy);
+    static bool isLazyCompilation();
+
+    /**
+     * Steps invoked while instance reuse is enabled keep one instance of
+     * their class per thread, reset between invocations, instead of
+     * constructing one each time. Only for step classes keeping no state of
+     * their own from one invocation to the next. Defaults to the
+     * CUKE_REUSE_STEP_INSTANCES build option.
+     */
+    static void setInstanceReuse(bool reuse);
+    static bool isInstanceReuse();
+
+    /**
+     * While first match only is enabled, matching stops at the first step
+     * definition matching a description, so ambiguous steps go unnoticed.
+     * Only for step definitions checked free of ambiguity, by
+     * ambiguousSteps() or otherwise. Disabled by default. Flushes the
+     * match cache.
+     *
+     * Step definitions are then tried most matched first, in an order
+     * revised every HOT_ORDER_PERIOD matches.
+     */
+    static void setFirstMatchOnly(bool firstMatchOnly);
+    static bool isFirstMatchOnly();
+    static constexpr std::uint64_t HOT_ORDER_PERIOD = 1000;
+
+    /**
+     * Smallest number of prefiltered candidates for which stepMatches
+     * spreads the matching over its threads.
+     */
+    static constexpr std::size_t PARALLEL_MATCH_MIN_CANDIDATES = 256;
+
+    /**
+     * Sets how many threads, including the caller, stepMatches uses for
+     * large candidate sets. Results keep the order of sequential matching.
+     */
+    static void setMatchingThreads(std::size_t threads);
 
 protected:
-    static steps_type& steps();
+    /**
+     * Step definitions with their prepared index, never modified once
+     * published. Registrations change a draft of the next one, published
+     * at the first lookup that follows.
+     */
+    struct Registry;
+
+    /**
+     * The latest registry, without locking unless it was republished since
+     * the calling thread last looked it up
+     */
+    static std::shared_ptr<const Registry> registry();
+    static const steps_type& registeredSteps(const Registry& registry);
+    /**
+     * Unregisters every step definition, while nothing is matched
+     */
+    static void clearRegistry();
+    static match_cache_type& matchCache();
 
 private:
+    /**
+     * Draft of the next registry, only accessed with the registration
+     * mutex held
+     */
+    static steps_type& steps();
+    static StepIndex& stepIndex();
+    /**
+     * Invalidates the published registry and the match results found in
+     * it, once its draft was changed with the registration mutex held
+     */
+    static void draftChanged();
+    static void insertStep(std::shared_ptr<StepInfo> stepInfo, const StepSnapshot* snapshot);
+    /**
+     * Counts a match of the step definition, telling whether it leaves no
+     * other to search
+     */
+    static bool countMatch(const Registry& registry, step_id_type id);
+    /**
+     * Ranks of the step ids in the order to try them in, or null to try
+     * them in id order
+     */
+    static std::shared_ptr<const std::vector<std::uint32_t>> matchOrder(const Registry& registry);
+
     // We're a singleton so don't allow instances
     StepManager() = delete;
 };
 
-static inline std::string toSourceString(const char* filePath, const int line) {
-    using namespace std;
-    stringstream s;
-    string file(filePath);
-    string::size_type pos = file.find_last_of("/\\");
-    if (pos == string::npos) {
-        s << file;
-    } else {
-        s << file.substr(++pos);
+/**
+ * The file name of a path, found at compile time for __FILE__
+ */
+constexpr const char* sourceFileName(const char* filePath) {
+    const char* fileName = filePath;
+    for (const char* c = filePath; *c != '\0'; ++c) {
+        if (*c == '/' || *c == '\\') {
+            fileName = c + 1;
+        }
     }
-    s << ":" << line;
-    return s.str();
-}
-
-template<class T>
-static int registerStep(const std::string& stepMatcher, const char* file, const int line) {
-    return StepManager::addStep(
-        std::make_shared<StepInvoker<T>>(stepMatcher, toSourceString(file, line))
-    );
+    return fileName;
 }
 
-template<typename T>
-T fromString(const std::string& s) {
-    std::istringstream stream(s);
-    T t;
-    stream >> t;
-    if (stream.fail()) {
-        throw std::invalid_argument("Cannot convert parameter");
-    }
-    return t;
+static inline std::string toSourceString(const char* filePath, const int line) {
+    return std::string(sourceFileName(filePath)) + ':' + std::to_string(line);
 }
 
-template<>
-inline std::string fromString(const std::string& s) {
-    return s;
+template<class T>
+static int registerStep(const std::string& stepMatcher, const char* file, const int line) {
+    const std::string source = toSourceString(file, line);
+    const ScopedStartupTiming timing(STARTUP_REGISTER_STEP, stepMatcher, source);
+    return StepManager::addStep(std::make_shared<StepInvoker<T>>(stepMatcher, source));
 }
 
-template<typename T>
-std::string toString(T arg) {
-    std::stringstream s;
-    s << arg;
-    return s.str();
+/**
+ * Defines a custom parameter type with a transformer, see
+ * ParameterTypeRegistry::define()
+ */
+template<typename Transformer>
+static int registerParameterType(
+    const std::string& name, const std::string& regexp, Transformer transformer
+) {
+    ParameterTypeRegistry::define(name, regexp, std::move(transformer));
+    return 0;
 }
 
 template<typename T>
@@ -225,6 +671,12 @@ T InvokeArgs::getInvokeArg(size_type i) const {
     if (i >= args.size()) {
         throw std::invalid_argument("Parameter not found");
     }
+    if constexpr (!std::is_arithmetic<T>::value && !std::is_same<T, std::string>::value
+                  && !std::is_same<T, std::string_view>::value) {
+        if (const std::shared_ptr<const T> value = ParameterTypeRegistry::transformed<T>(args[i])) {
+            return *value;
+        }
+    }
     return fromString<T>(args.at(i));
 }
 
@@ -235,13 +687,49 @@ const T BasicStep::getInvokeArg() {
 
 template<class T>
 StepInvoker<T>::StepInvoker(const std::string& stepMatcher, const std::string source) :
-    StepInfo(stepMatcher, source) {
+    StepInfo(stepMatcher, source),
+    argumentIndexes(bindArguments(step_argument_kinds<T>::get())) {
+}
+
+template<class T>
+StepInvoker<T>::StepInvoker(
+    const std::string& stepMatcher, const std::string& source, const StepSnapshotEntry& entry
+) :
+    StepInfo(stepMatcher, source, &entry),
+    argumentIndexes(bindArguments(step_argument_kinds<T>::get())) {
 }
 
 template<class T>
 InvokeResult StepInvoker<T>::invokeStep(const InvokeArgs* pArgs) const {
-    T t;
-    return t.invoke(pArgs);
+    thread_local std::unique_ptr<T> reused;
+    thread_local bool reusedInUse = false;
+    if (!StepManager::isInstanceReuse() || reusedInUse) {
+        T t;
+        return t.invoke(pArgs, argumentIndexes);
+    }
+    if (!reused) {
+        reused = std::make_unique<T>();
+    }
+    reusedInUse = true;
+    InvokeResult result = reused->invoke(pArgs, argumentIndexes);
+    reusedInUse = false;
+    return result;
+}
+
+template<class T>
+bool StepInvoker<T>::isAsync() const {
+    return is_async_step<T>::value;
+}
+
+template<class T>
+void StepInvoker<T>::invokeStepAsync(
+    const InvokeArgs* pArgs, StepExecutor& executor, invoke_callback_type done
+) const {
+    if constexpr (is_async_step<T>::value) {
+        T::invokeAsync(std::make_shared<T>(), pArgs, argumentIndexes, executor, std::move(done));
+    } else {
+        StepInfo::invokeStepAsync(pArgs, executor, std::move(done));
+    }
 }
 
 }
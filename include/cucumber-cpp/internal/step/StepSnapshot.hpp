@@ -0,0 +1,107 @@
+#ifndef CUKE_STEPSNAPSHOT_HPP_
+#define CUKE_STEPSNAPSHOT_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include "StepIndex.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * What registering a step definition derives from its step matcher
+ */
+struct CUCUMBER_CPP_EXPORT StepSnapshotEntry {
+    /** Known to compile */
+    std::string regex;
+    std::vector<CucumberExpressionParameter> parameters;
+    /** Whether the step matcher is a Cucumber Expression with a matcher */
+    bool hasMatcher = false;
+    CucumberExpressionMatcher::segments_type segments;
+    RegexLiteralPrefix prefix = {std::string(), false};
+    std::vector<std::string> requiredLiterals;
+};
+
+/**
+ * Transformed regular expressions, parameters, matchers and prefilter
+ * literals of step definitions, saved so that later processes register
+ * the same steps without transforming, validating or analysing their step
+ * matchers again. Steps registered with a snapshot compile their regular
+ * expression the first time they are matched.
+ *
+ * The file named by CUKE_STEP_SNAPSHOT is loaded when the first step is
+ * registered, and rewritten by refresh() once the steps are registered if
+ * it is missing or was made for other steps or another version. Steps using
+ * custom parameter types, which may change between runs, are left out.
+ */
+class CUCUMBER_CPP_EXPORT StepSnapshot {
+public:
+    typedef std::unordered_map<std::string, StepSnapshotEntry> entries_type;
+
+    static constexpr const char* ENVIRONMENT_VARIABLE = "CUKE_STEP_SNAPSHOT";
+
+    StepSnapshot();
+
+    /**
+     * Snapshot of the steps registered so far
+     */
+    static StepSnapshot capture();
+
+    /**
+     * @throws std::runtime_error if the snapshot is malformed
+     */
+    static StepSnapshot read(std::istream& in);
+    void write(std::ostream& out) const;
+
+    /**
+     * @return The entry of a step matcher, null if there is none
+     */
+    const StepSnapshotEntry* find(const std::string& stepMatcher) const;
+    const entries_type& getEntries() const;
+
+    /**
+     * Whether the snapshot was made by this version and regular expression
+     * backend, which other snapshots cannot be used with
+     */
+    bool isCurrentVersion() const;
+    /**
+     * Whether the snapshot is of the current version and of the registered
+     * steps
+     */
+    bool isCurrent() const;
+
+    /**
+     * Hash of the step matchers registered so far, whatever their order
+     */
+    static std::uint64_t registrationHash();
+
+    /**
+     * Snapshot steps registered from now on are looked up in, none if null
+     */
+    static void load(std::shared_ptr<const StepSnapshot> snapshot);
+    static std::shared_ptr<const StepSnapshot> loaded();
+
+    /**
+     * Writes a snapshot of the registered steps to the file named by
+     * CUKE_STEP_SNAPSHOT unless the loaded one is current.
+     *
+     * @return Whether the file was written
+     */
+    static bool refresh();
+
+private:
+    std::string version;
+    std::uint64_t hash;
+    entries_type entries;
+};
+
+}
+}
+
+#endif /* CUKE_STEPSNAPSHOT_HPP_ */
@@ -0,0 +1,77 @@
+#ifndef CUKE_CPUAFFINITY_HPP_
+#define CUKE_CPUAFFINITY_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+typedef std::vector<unsigned int> cpu_list_type;
+
+/**
+ * Parses a list of cpus such as "0-3,8,10-11", as taskset takes them.
+ *
+ * @throws std::invalid_argument if the list is malformed
+ */
+CUCUMBER_CPP_EXPORT cpu_list_type parseCpuList(const std::string& list);
+
+/**
+ * Restricts the calling thread to the cpus. Linux places the memory a
+ * thread touches first on the NUMA node it runs on, so the contexts of a
+ * session pinned to the cpus of a node stay on that node.
+ *
+ * @return false if the cpus were refused, or anywhere but on Linux
+ */
+CUCUMBER_CPP_EXPORT bool pinThisThread(const cpu_list_type& cpus);
+/**
+ * The cpus the calling thread may run on, empty anywhere but on Linux
+ */
+CUCUMBER_CPP_EXPORT cpu_list_type threadCpus();
+
+/**
+ * Pins the calling thread to a cpu while it lives, then lets the thread
+ * run on the cpus it could before
+ */
+class CUCUMBER_CPP_EXPORT ScopedThreadPin {
+public:
+    explicit ScopedThreadPin(unsigned int cpu);
+    ~ScopedThreadPin();
+
+    ScopedThreadPin(const ScopedThreadPin&) = delete;
+    ScopedThreadPin& operator=(const ScopedThreadPin&) = delete;
+
+private:
+    cpu_list_type previous;
+};
+
+/**
+ * Hands the cpus of a list out in turn to the threads pinning themselves,
+ * which may do so concurrently. Pins nothing while the list is empty.
+ */
+class CUCUMBER_CPP_EXPORT CpuRotation {
+public:
+    /**
+     * Not to be called while threads pin themselves
+     */
+    void assign(const cpu_list_type& cpus);
+    bool empty() const;
+    /**
+     * The next cpu in turn, as a list of one, empty if there are none
+     */
+    cpu_list_type take();
+    void pinThisThread();
+
+private:
+    cpu_list_type cpus;
+    std::atomic<std::size_t> next{0};
+};
+
+}
+}
+
+#endif /* CUKE_CPUAFFINITY_HPP_ */
@@ -1,9 +1,17 @@
 #ifndef CUKE_CUCUMBER_EX_HPP_
 #define CUKE_CUCUMBER_EX_HPP_
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+#include "Regex.hpp"
 
 namespace cucumber::internal {
 
@@ -125,6 +133,178 @@ public:
         : CucumberExpressionpressionException("Cucumber expression cannot be empty") {}
 };
 
+/**
+ * Parameter type used in a Cucumber Expression, with the index of the
+ * capture group holding its text among all capture groups of the
+ * expression's regular expression
+ */
+struct CucumberExpressionParameter {
+    std::string type;
+    std::size_t group;
+};
+
+/**
+ * Custom parameter types, which Cucumber Expressions can use in addition to
+ * the built-in ones. The regular expression of each type is compiled once,
+ * when the type is defined.
+ *
+ * Unless types were defined or loaded before, custom_parameter_types.json
+ * in the working directory is read the first time an expression uses a
+ * type that is not built in. Conversions cached by cukex are dropped
+ * whenever the types change; steps already registered keep theirs.
+ */
+class ParameterTypeRegistry {
+public:
+    /**
+     * @throws CucumberExpressionpressionException if the name is that of a
+     *         built-in type or the regular expression is invalid
+     */
+    static void define(const std::string& name, const std::string& regexp);
+
+    /**
+     * Also converts the text of each parameter of the type, once per
+     * distinct text, with a transformer taking a std::string_view. Steps
+     * then read the parameter as the type the transformer returns. The
+     * text is converted as the step matches, or else the first time a
+     * step reads it.
+     *
+     * @throws CucumberExpressionpressionException as define() does
+     */
+    template<typename Transformer>
+    static void define(
+        const std::string& name, const std::string& regexp, Transformer transformer
+    );
+
+    /**
+     * Value of a custom type converting into T made of the text, or null
+     * if no type converts into T
+     *
+     * @throws what the transformer throws
+     */
+    template<typename T>
+    static std::shared_ptr<const T> transformed(const std::string& text) {
+        return std::static_pointer_cast<const T>(transformed(std::type_index(typeid(T)), text));
+    }
+
+    /**
+     * Converts the text of a parameter just matched if its type has a
+     * transformer, leaving any error to the step reading it
+     */
+    static void transformMatched(const std::string& name, const std::string& text);
+
+    /**
+     * Replaces the custom types by those of a JSON file holding an array of
+     * objects with "name" and "regexp" members:
+     *
+     *   [{"name": "color", "regexp": "red|blue|green"}]
+     *
+     * @throws CucumberExpressionpressionException if the file cannot be
+     *         read or a type cannot be defined, leaving the types unchanged
+     */
+    static void load(const std::string& path);
+
+    /**
+     * Removes all custom types, so that the default file is read again
+     * when a type that is not built in is used.
+     */
+    static void clear();
+
+    static bool isBuiltIn(const std::string& name);
+
+private:
+    typedef std::function<std::shared_ptr<const void>(std::string_view)> transformer_type;
+
+    static void defineTransformer(
+        const std::string& name, std::type_index type, transformer_type transformer
+    );
+    static std::shared_ptr<const void> transformed(std::type_index type, const std::string& text);
+};
+
+template<typename Transformer>
+void ParameterTypeRegistry::define(
+    const std::string& name, const std::string& regexp, Transformer transformer
+) {
+    typedef typename std::decay<decltype(transformer(std::string_view()))>::type value_type;
+    define(name, regexp);
+    defineTransformer(
+        name,
+        std::type_index(typeid(value_type)),
+        [transformer](std::string_view text) -> std::shared_ptr<const void> {
+            return std::make_shared<const value_type>(transformer(text));
+        }
+    );
+}
+
+/**
+ * Matches text against a Cucumber Expression without going through its
+ * regular expression. Only expressions made of text, optional text,
+ * alternatives of plain text and parameters of any type but the decimal
+ * ones have one; submatches are those the regular expression would give. The one exception is a custom type
+ * matching texts of several lengths where the expression leaves the choice
+ * open: it takes the longest, whatever its regular expression prefers.
+ * Regular expressions StaticRegexParser handles have one as well.
+ */
+class CucumberExpressionMatcher {
+public:
+    enum SegmentKind {
+        TEXT_SEGMENT,
+        OPTIONAL_SEGMENT,
+        ALTERNATION_SEGMENT,
+        INTEGER_SEGMENT,
+        WORD_SEGMENT,
+        STRING_SEGMENT,
+        ANYTHING_SEGMENT,
+        DIGITS_SEGMENT,
+        EXCLUDING_SEGMENT,
+        CUSTOM_SEGMENT
+    };
+
+    struct Segment {
+        SegmentKind kind;
+        // Unescaped text, one per alternative; the characters an excluding
+        // segment does not match; empty for parameter types
+        std::vector<std::string> texts;
+        // Capture groups of a parameter type
+        std::size_t groups;
+        // Whole text match of the regular expression of a custom type
+        std::shared_ptr<const Regex> regex;
+    };
+
+    typedef std::vector<Segment> segments_type;
+
+    explicit CucumberExpressionMatcher(segments_type segments);
+
+    /**
+     * Whether find() decides like the regular expression would for this
+     * text. Regular expression backends disagree about line breaks and
+     * other control characters, so texts containing them are left to
+     * the regular expression.
+     */
+    static bool handles(const std::string& text);
+
+    std::shared_ptr<RegexMatch> find(const std::string& text) const;
+    bool find(const std::string& text, std::vector<RegexSubmatchSpan>& submatches) const;
+
+    const segments_type& getSegments() const;
+
+private:
+    bool matchFrom(
+        segments_type::size_type segment,
+        std::size_t pos,
+        std::size_t group,
+        const std::string& text,
+        std::vector<RegexSubmatchSpan>& submatches
+    ) const;
+
+    const segments_type segments;
+    std::size_t groups;
+};
+
+/**
+ * Conversions are cached process-wide, keyed by the expression, so an
+ * expression is only parsed once however often it is converted. All
+ * member functions are thread-safe.
+ */
 class cukex {
 public:
     /**
@@ -179,6 +359,39 @@ public:
      *   -> "^I have \\{literal\\} braces$"
      */
     static std::string transform(const std::string& expression);
+
+    /**
+     * Like transform() but without compiling the resulting regular expression
+     * to validate it.
+     */
+    static std::string transformUnchecked(const std::string& expression);
+
+    /**
+     * Converts a Cucumber Expression and compiles the resulting regular
+     * expression once, for callers that need the compiled form anyway.
+     *
+     * @throws CucumberExpressionpressionException as transform() does
+     */
+    static Regex compile(const std::string& expression);
+
+    /**
+     * Lists the parameter types of an expression in order of appearance.
+     * Parameter types like {string} whose regular expression has groups of
+     * its own take more than one capture group.
+     *
+     * @throws CucumberExpressionpressionException as transformUnchecked() does
+     */
+    static std::vector<CucumberExpressionParameter> parameters(const std::string& expression);
+
+    /**
+     * Matcher running the expression without its regular expression, or
+     * null if the expression uses anything else than what
+     * CucumberExpressionMatcher supports, including custom parameter types
+     * overriding the built-in ones.
+     *
+     * @throws CucumberExpressionpressionException as transformUnchecked() does
+     */
+    static std::shared_ptr<const CucumberExpressionMatcher> matcher(const std::string& expression);
 };
 
 } // namespace cucumber::internal
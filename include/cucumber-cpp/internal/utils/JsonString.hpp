@@ -0,0 +1,34 @@
+#ifndef CUKE_JSONSTRING_HPP_
+#define CUKE_JSONSTRING_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Offset of the first byte, from the given one on, that a JSON string
+ * cannot hold as is or that starts a multi-byte UTF-8 sequence: a control
+ * character, '"', '\\' or a byte from 0x80 on. The size if there is none.
+ *
+ * Scans 32 bytes at a time with AVX2 where the processor has it, 16 with
+ * SSE2 or NEON, and a byte at a time elsewhere.
+ */
+CUCUMBER_CPP_EXPORT std::size_t findJsonSpecial(std::string_view text, std::size_t from = 0);
+
+/**
+ * Appends the text as a quoted JSON string, escaped like nlohmann::json
+ * dumps it. Runs of bytes needing no escape are copied at once.
+ *
+ * @throws std::invalid_argument if the text is not valid UTF-8
+ */
+CUCUMBER_CPP_EXPORT void appendJsonString(std::string& output, std::string_view text);
+
+}
+}
+
+#endif /* CUKE_JSONSTRING_HPP_ */
@@ -2,6 +2,8 @@
 #define CUKE_REGEX_HPP_
 
 #include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <regex>
@@ -9,11 +11,69 @@
 namespace cucumber {
 namespace internal {
 
+/**
+ * Compiled expression of the regular expression backend selected at build
+ * time through CUKE_REGEX_BACKEND (std, boost, pcre2 or re2).
+ */
+class RegexImpl;
+
+/**
+ * Thrown when the backend rejects a regular expression. It derives from
+ * std::regex_error so callers do not depend on the selected backend.
+ */
+class RegexSyntaxError : public std::regex_error {
+public:
+    RegexSyntaxError(const std::string& message);
+
+    const char* what() const noexcept override;
+
+private:
+    std::string message;
+};
+
+/**
+ * Thrown when the backend gives up matching a regular expression that
+ * backtracks too much, rather than stalling the caller.
+ */
+class RegexComplexityError : public std::regex_error {
+public:
+    RegexComplexityError(const std::string& message);
+
+    const char* what() const noexcept override;
+
+private:
+    std::string message;
+};
+
+/**
+ * Tells why backtracking may take a regular expression more than linear
+ * time in the length of the input: unbounded quantifiers nested in one
+ * another, or held by a lookaround that is then tried at every position.
+ * Empty if nothing suggests it.
+ *
+ * Backends that can choose another matching strategy, or limit the
+ * backtracking, do so for such expressions.
+ */
+std::string backtrackingHazard(const std::string& regularExpression);
+
 struct RegexSubmatch {
     std::string value;
     std::ptrdiff_t position;
 };
 
+/**
+ * Byte offsets of a submatch in the searched string. Both are
+ * std::string::npos for optional groups that did not participate.
+ */
+struct RegexSubmatchSpan {
+    std::size_t begin;
+    std::size_t end;
+
+    bool matched() const {
+        return begin != std::string::npos;
+    }
+};
+
 class RegexMatch {
 public:
     typedef std::vector<RegexSubmatch> submatches_type;
@@ -24,32 +84,67 @@ public:
     const submatches_type& getSubmatches();
 
 protected:
+    void addSubmatch(
+        const std::string& expression, std::size_t byteBegin, std::size_t byteEnd
+    );
+    void addUnmatchedSubmatch();
+
     bool regexMatched;
     submatches_type submatches;
+
+private:
+    std::ptrdiff_t utf8CodepointOffset(const std::string& expression, std::size_t byteOffset);
+
+    std::size_t cursorByteOffset = 0;
+    std::ptrdiff_t cursorCodepointOffset = 0;
 };
 
 class FindRegexMatch : public RegexMatch {
 public:
-    FindRegexMatch(const std::regex& regexImpl, const std::string& expression);
+    FindRegexMatch(const RegexImpl& regexImpl, const std::string& expression);
 };
 
 class FindAllRegexMatch : public RegexMatch {
 public:
-    FindAllRegexMatch(const std::regex& regexImpl, const std::string& expression);
+    FindAllRegexMatch(const RegexImpl& regexImpl, const std::string& expression);
 };
 
+enum RegexCompilation { COMPILE_NOW, COMPILE_ON_FIRST_USE };
+
 class Regex {
 private:
-    std::regex regexImpl;
+    struct DeferredCompilation;
+
+    // Implemented by the selected backend
+    static std::shared_ptr<const RegexImpl> compile(const std::string& expr);
+
+    const RegexImpl& impl() const;
+
+    std::shared_ptr<const RegexImpl> regexImpl;
+    std::shared_ptr<DeferredCompilation> deferredCompilation;
     const std::string regexString;
 
 public:
     Regex(std::string expr);
+    /**
+     * With COMPILE_ON_FIRST_USE syntax errors are only reported by the first
+     * find() or findAll(). Copies share the compiled expression.
+     */
+    Regex(std::string expr, RegexCompilation compilation);
+
+    bool isCompiled() const;
 
     std::shared_ptr<RegexMatch> find(const std::string& expression) const;
     std::shared_ptr<RegexMatch> findAll(const std::string& expression) const;
 
-    std::string str() const;
+    /**
+     * Searches like find() but stores the submatches as byte offsets in a
+     * caller supplied vector, which is cleared first. Reusing the vector
+     * avoids allocating results, though the backend itself may allocate.
+     */
+    bool find(const std::string& expression, std::vector<RegexSubmatchSpan>& submatches) const;
+
+    const std::string& str() const;
 };
 
 }
@@ -0,0 +1,646 @@
+#ifndef CUKE_STATICCUCUMBEREXPRESSION_HPP_
+#define CUKE_STATICCUCUMBEREXPRESSION_HPP_
+
+#include "CucumberExpression.hpp"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace cucumber {
+namespace internal {
+
+struct BuiltInParameterType {
+    std::string_view name;
+    std::string_view regexp;
+};
+
+/**
+ * The parameter types every Cucumber Expression can use, which custom types
+ * never override
+ */
+inline constexpr std::array<BuiltInParameterType, 11> BUILT_IN_PARAMETER_TYPES = {{
+    {"int", R"(-?\d+)"},
+    {"float", R"((?=.*\d.*)[-+]?\d*(?:\.(?=\d.*))?\d*(?:\d+[E][+-]?\d+)?)"},
+    {"word", R"([^\s]+)"},
+    {"string", R"xyz("([^"\\]*(\\.[^"\\]*)*)"|'([^'\\]*(\\.[^'\\]*)*)')xyz"},
+    {"bigdecimal", R"((?=.*\d.*)[-+]?\d*(?:\.(?=\d.*))?\d*(?:\d+[E][+-]?\d+)?)"},
+    {"double", R"((?=.*\d.*)[-+]?\d*(?:\.(?=\d.*))?\d*(?:\d+[E][+-]?\d+)?)"},
+    {"biginteger", R"(-?\d+)"},
+    {"byte", R"(-?\d+)"},
+    {"short", R"(-?\d+)"},
+    {"long", R"(-?\d+)"},
+    {"", ".*"} // anonymous parameter type
+}};
+
+constexpr std::size_t countCaptureGroups(const std::string_view regex) {
+    std::size_t groups = 0;
+    bool inCharacterClass = false;
+    for (std::size_t i = 0; i < regex.size(); ++i) {
+        const char c = regex[i];
+        if (c == '\\') {
+            ++i;
+        } else if (inCharacterClass) {
+            inCharacterClass = (c != ']');
+        } else if (c == '[') {
+            inCharacterClass = true;
+        } else if (c == '(' && (i + 1 == regex.size() || regex[i + 1] != '?')) {
+            ++groups;
+        }
+    }
+    return groups;
+}
+
+/**
+ * Characters that stand for themselves in a Cucumber Expression but must be
+ * escaped in a regular expression
+ */
+constexpr bool isRegexSpecialCharacter(const char c) {
+    return std::string_view(".^$|()[]{}*+?\\").find(c) != std::string_view::npos;
+}
+
+/**
+ * Parameter types like {int} or {} are never valid regular expression
+ * quantifiers, unlike {2} or {2,3}.
+ */
+constexpr bool hasParameterType(const std::string_view stepMatcher) {
+    for (std::size_t i = 0; i < stepMatcher.size(); ++i) {
+        if (stepMatcher[i] == '\\') {
+            ++i;
+        } else if (stepMatcher[i] == '{') {
+            const std::size_t close = stepMatcher.find('}', i);
+            if (close == std::string_view::npos) {
+                return false;
+            }
+            const std::string_view content = stepMatcher.substr(i + 1, close - i - 1);
+            if (content.find_first_not_of("0123456789,") != std::string_view::npos
+                || content.empty()) {
+                return true;
+            }
+            i = close;
+        }
+    }
+    return false;
+}
+
+struct StaticParameter {
+    /** In BUILT_IN_PARAMETER_TYPES */
+    std::size_t type = 0;
+    std::size_t group = 0;
+};
+
+struct StaticSegment {
+    CucumberExpressionMatcher::SegmentKind kind = CucumberExpressionMatcher::TEXT_SEGMENT;
+    std::size_t groups = 0;
+    std::size_t firstText = 0;
+    std::size_t texts = 0;
+};
+
+struct StaticText {
+    std::size_t begin = 0;
+    std::size_t length = 0;
+};
+
+/**
+ * What transforming an expression writes, counted to size its
+ * StaticTransform
+ */
+struct StaticTransformSizes {
+    /** Whether the expression is transformed at compile time */
+    bool transformed = true;
+    std::size_t regex = 0;
+    std::size_t parameters = 0;
+    std::size_t segments = 0;
+    std::size_t texts = 0;
+    std::size_t textChars = 0;
+    bool lastSegmentIsText = false;
+
+    constexpr void appendRegex(char) {
+        ++regex;
+    }
+    constexpr void addParameter(std::size_t, std::size_t) {
+        ++parameters;
+    }
+    constexpr void addSegment(const CucumberExpressionMatcher::SegmentKind kind, std::size_t) {
+        ++segments;
+        lastSegmentIsText = kind == CucumberExpressionMatcher::TEXT_SEGMENT;
+    }
+    constexpr void addText() {
+        ++texts;
+    }
+    constexpr void appendText(char) {
+        ++textChars;
+    }
+    constexpr bool isLastSegmentText() const {
+        return lastSegmentIsText;
+    }
+    constexpr void setUnmatchable() {
+    }
+    constexpr void setUntransformed() {
+        transformed = false;
+    }
+};
+
+/**
+ * Regular expression, parameters and matcher segments of a Cucumber
+ * Expression, as cukex would give them
+ */
+template<
+    std::size_t RegexLength,
+    std::size_t Parameters,
+    std::size_t Segments,
+    std::size_t Texts,
+    std::size_t TextChars>
+struct StaticTransform {
+    std::array<char, RegexLength + 1> regex{};
+    std::array<StaticParameter, Parameters> parameters{};
+    std::array<StaticSegment, Segments> segments{};
+    std::array<StaticText, Texts> texts{};
+    std::array<char, TextChars + 1> textChars{};
+    bool matchable = true;
+
+    std::size_t regexLength = 0;
+    std::size_t parameterCount = 0;
+    std::size_t segmentCount = 0;
+    std::size_t textCount = 0;
+    std::size_t textCharCount = 0;
+
+    constexpr void appendRegex(const char c) {
+        regex[regexLength++] = c;
+    }
+    constexpr void addParameter(const std::size_t type, const std::size_t group) {
+        parameters[parameterCount].type = type;
+        parameters[parameterCount++].group = group;
+    }
+    constexpr void addSegment(
+        const CucumberExpressionMatcher::SegmentKind kind, const std::size_t groups
+    ) {
+        segments[segmentCount].kind = kind;
+        segments[segmentCount].groups = groups;
+        segments[segmentCount++].firstText = textCount;
+    }
+    constexpr void addText() {
+        ++segments[segmentCount - 1].texts;
+        texts[textCount++].begin = textCharCount;
+    }
+    constexpr void appendText(const char c) {
+        ++texts[textCount - 1].length;
+        textChars[textCharCount++] = c;
+    }
+    constexpr bool isLastSegmentText() const {
+        return segmentCount != 0
+               && segments[segmentCount - 1].kind == CucumberExpressionMatcher::TEXT_SEGMENT;
+    }
+    constexpr void setUnmatchable() {
+        matchable = false;
+    }
+    constexpr void setUntransformed() {
+    }
+
+    std::string_view getRegex() const {
+        return std::string_view(regex.data(), regexLength);
+    }
+    std::string_view getText(const std::size_t text) const {
+        return std::string_view(textChars.data() + texts[text].begin, texts[text].length);
+    }
+};
+
+/**
+ * The conversion of CucumberExpressionpressionParser, evaluated at compile
+ * time with the built-in parameter types only. Malformed expressions throw,
+ * which fails the constant evaluation.
+ */
+template<std::size_t MaxTokens, typename Output>
+class StaticExpressionParser {
+public:
+    constexpr StaticExpressionParser(const std::string_view expression, Output& out) :
+        expression(expression),
+        out(out) {
+    }
+
+    constexpr void parse() {
+        validate();
+        out.appendRegex('^');
+        while (pos < expression.size()) {
+            const char current = expression[pos];
+            if (current == ' ') {
+                appendSegment();
+                out.appendRegex(current);
+                beginMatcherText();
+                out.appendText(current);
+                ++pos;
+            } else if (current == '{') {
+                appendSegment();
+                parseParameter();
+            } else if (current == '(') {
+                parseOptional();
+            } else if (current == '/') {
+                segment[tokens++] = {ALTERNATION, 0, 0};
+                segmentHasAlternation = true;
+                ++pos;
+            } else {
+                parseText();
+            }
+        }
+        appendSegment();
+        out.appendRegex('$');
+    }
+
+private:
+    enum TokenKind { TEXT, OPTIONAL, ALTERNATION };
+
+    struct Token {
+        TokenKind kind = TEXT;
+        // Still escaped as in the expression
+        std::size_t begin = 0;
+        std::size_t length = 0;
+    };
+
+    constexpr void validate() const {
+        if (expression.empty()) {
+            throw std::invalid_argument("Empty Cucumber Expression");
+        }
+        int braceDepth = 0;
+        int parenDepth = 0;
+        for (std::size_t i = 0; i < expression.size(); ++i) {
+            const char c = expression[i];
+            if (i > 0 && expression[i - 1] == '\\') {
+                continue;
+            }
+            if (c == '{') {
+                if (++braceDepth > 1) {
+                    throw std::invalid_argument("Nested parameter types are not allowed");
+                }
+            } else if (c == '}') {
+                if (--braceDepth < 0) {
+                    throw std::invalid_argument("Unexpected closing brace '}'");
+                }
+            } else if (c == '(') {
+                ++parenDepth;
+            } else if (c == ')') {
+                if (--parenDepth < 0) {
+                    throw std::invalid_argument("Unexpected closing parenthesis ')'");
+                }
+            }
+        }
+        if (braceDepth != 0) {
+            throw std::invalid_argument("Unclosed parameter type: unmatched braces");
+        }
+        if (parenDepth != 0) {
+            throw std::invalid_argument("Unclosed optional text: unmatched parentheses");
+        }
+    }
+
+    static constexpr bool isEscapable(const char c) {
+        return c == '(' || c == ')' || c == '{' || c == '}' || c == '/';
+    }
+
+    constexpr bool isEscapeAt(const std::size_t i) const {
+        return expression[i] == '\\' && i + 1 < expression.size()
+               && isEscapable(expression[i + 1]);
+    }
+
+    constexpr void parseText() {
+        const std::size_t begin = pos;
+        do {
+            pos += isEscapeAt(pos) ? 2 : 1;
+        } while (pos < expression.size()
+                 && std::string_view(" {(/", 5).find(expression[pos]) == std::string_view::npos);
+        segment[tokens++] = {TEXT, begin, pos - begin};
+    }
+
+    constexpr void parseOptional() {
+        std::size_t closePos = pos + 1;
+        while (closePos < expression.size() && expression[closePos] != ')') {
+            closePos += isEscapeAt(closePos) ? 2 : 1;
+        }
+        if (closePos >= expression.size()) {
+            throw std::invalid_argument("Unclosed optional text: missing ')'");
+        }
+        if (closePos == pos + 1) {
+            throw std::invalid_argument("Empty optional text is not allowed");
+        }
+        segment[tokens++] = {OPTIONAL, pos + 1, closePos - pos - 1};
+        pos = closePos + 1;
+    }
+
+    constexpr void parseParameter() {
+        const std::size_t closePos = expression.find('}', pos);
+        if (closePos == std::string_view::npos) {
+            throw std::invalid_argument("Unclosed parameter type: missing '}'");
+        }
+        const std::string_view name = expression.substr(pos + 1, closePos - pos - 1);
+        pos = closePos + 1;
+        std::size_t type = 0;
+        while (type < BUILT_IN_PARAMETER_TYPES.size() && BUILT_IN_PARAMETER_TYPES[type].name != name
+        ) {
+            ++type;
+        }
+        if (type == BUILT_IN_PARAMETER_TYPES.size()) {
+            // Possibly a custom type, only known at run time
+            out.setUntransformed();
+            return;
+        }
+
+        const std::string_view regexp = BUILT_IN_PARAMETER_TYPES[type].regexp;
+        const std::size_t typeGroups = 1 + countCaptureGroups(regexp);
+        out.addParameter(type, groups);
+        const CucumberExpressionMatcher::SegmentKind kind = matcherKind(regexp);
+        if (kind == CucumberExpressionMatcher::CUSTOM_SEGMENT) {
+            out.setUnmatchable();
+        } else {
+            out.addSegment(kind, typeGroups);
+        }
+        groups += typeGroups;
+        out.appendRegex('(');
+        for (const char c : regexp) {
+            out.appendRegex(c);
+        }
+        out.appendRegex(')');
+    }
+
+    /**
+     * Kind of the matcher segment of a built-in type, CUSTOM_SEGMENT if
+     * the matcher does not run it
+     */
+    static constexpr CucumberExpressionMatcher::SegmentKind matcherKind(
+        const std::string_view regexp
+    ) {
+        const auto regexpOf = [](const std::string_view name) {
+            for (const BuiltInParameterType& type : BUILT_IN_PARAMETER_TYPES) {
+                if (type.name == name) {
+                    return type.regexp;
+                }
+            }
+            return std::string_view();
+        };
+        return regexp == regexpOf("int")      ? CucumberExpressionMatcher::INTEGER_SEGMENT
+               : regexp == regexpOf("word")   ? CucumberExpressionMatcher::WORD_SEGMENT
+               : regexp == regexpOf("string") ? CucumberExpressionMatcher::STRING_SEGMENT
+               : regexp == regexpOf("")       ? CucumberExpressionMatcher::ANYTHING_SEGMENT
+                                              : CucumberExpressionMatcher::CUSTOM_SEGMENT;
+    }
+
+    constexpr void beginMatcherText() {
+        if (!out.isLastSegmentText()) {
+            out.addSegment(CucumberExpressionMatcher::TEXT_SEGMENT, 0);
+            out.addText();
+        }
+    }
+
+    /**
+     * Writes text to the regular expression, and unescaped to the current
+     * matcher text if asked to
+     */
+    constexpr void appendLiteral(const Token& token, const bool toMatcherText) {
+        const std::string_view text = expression.substr(token.begin, token.length);
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            char c = text[i];
+            if (c == '\\' && i + 1 < text.size() && isEscapable(text[i + 1])) {
+                c = text[++i];
+            }
+            if (isRegexSpecialCharacter(c)) {
+                out.appendRegex('\\');
+            }
+            out.appendRegex(c);
+            if (toMatcherText) {
+                out.appendText(c);
+            }
+        }
+    }
+
+    constexpr void appendTokens(std::size_t begin, const std::size_t end, const bool alternative) {
+        for (; begin != end; ++begin) {
+            const Token& token = segment[begin];
+            if (token.kind == OPTIONAL) {
+                out.appendRegex('(');
+                out.appendRegex('?');
+                out.appendRegex(':');
+                if (alternative) {
+                    out.setUnmatchable();
+                } else {
+                    out.addSegment(CucumberExpressionMatcher::OPTIONAL_SEGMENT, 0);
+                    out.addText();
+                }
+                appendLiteral(token, !alternative);
+                out.appendRegex(')');
+                out.appendRegex('?');
+            } else if (token.kind == TEXT) {
+                if (!alternative) {
+                    beginMatcherText();
+                }
+                appendLiteral(token, true);
+            }
+        }
+    }
+
+    constexpr void appendSegment() {
+        if (!segmentHasAlternation) {
+            appendTokens(0, tokens, false);
+        } else {
+            std::size_t alternatives = 0;
+            for (std::size_t i = 0; i < tokens; ++i) {
+                if (segment[i].kind != ALTERNATION
+                    && (i == 0 || segment[i - 1].kind == ALTERNATION)) {
+                    ++alternatives;
+                }
+            }
+            if (alternatives > 1) {
+                out.appendRegex('(');
+                out.appendRegex('?');
+                out.appendRegex(':');
+                out.addSegment(CucumberExpressionMatcher::ALTERNATION_SEGMENT, 0);
+            }
+            bool first = true;
+            std::size_t alternativeBegin = 0;
+            for (std::size_t i = 0;; ++i) {
+                if (i == tokens || segment[i].kind == ALTERNATION) {
+                    if (alternativeBegin != i) {
+                        if (!first) {
+                            out.appendRegex('|');
+                        }
+                        if (alternatives > 1) {
+                            out.addText();
+                        }
+                        appendTokens(alternativeBegin, i, alternatives > 1);
+                        first = false;
+                    }
+                    if (i == tokens) {
+                        break;
+                    }
+                    alternativeBegin = i + 1;
+                }
+            }
+            if (alternatives > 1) {
+                out.appendRegex(')');
+            }
+        }
+        tokens = 0;
+        segmentHasAlternation = false;
+    }
+
+    const std::string_view expression;
+    Output& out;
+    std::size_t pos = 0;
+    std::size_t groups = 0;
+    std::array<Token, MaxTokens> segment{};
+    std::size_t tokens = 0;
+    bool segmentHasAlternation = false;
+};
+
+/**
+ * Matcher segments of a regular expression anchored at both ends and made
+ * of literal text and of the capture groups (\d+), (-?\d+), (.*), ([^\s]+)
+ * or ([^...]*), which CucumberExpressionMatcher matches without the
+ * regular expression. Any other regular expression is not transformed.
+ */
+template<typename Output>
+class StaticRegexParser {
+public:
+    constexpr StaticRegexParser(const std::string_view regex, Output& out) :
+        regex(regex),
+        out(out) {
+    }
+
+    constexpr void parse() {
+        for (const char c : regex) {
+            out.appendRegex(c);
+        }
+        if (regex.size() < 2 || regex.front() != '^' || regex.back() != '$') {
+            out.setUntransformed();
+            return;
+        }
+        const std::size_t end = regex.size() - 1;
+        std::size_t pos = 1;
+        while (pos < end) {
+            const char c = regex[pos];
+            if (c == '(') {
+                pos = parseGroup(regex.substr(pos, end - pos), pos);
+            } else if (c == '\\' && pos + 1 < end && isEscapedLiteral(regex[pos + 1])) {
+                appendLiteral(regex[pos + 1]);
+                pos += 2;
+            } else if (c != '\\' && !isRegexSpecialCharacter(c)) {
+                appendLiteral(c);
+                ++pos;
+            } else {
+                pos = std::string_view::npos;
+            }
+            if (pos == std::string_view::npos) {
+                out.setUntransformed();
+                return;
+            }
+        }
+    }
+
+private:
+    /**
+     * Escapes standing for the character itself with every backend
+     */
+    static constexpr bool isEscapedLiteral(const char c) {
+        return isRegexSpecialCharacter(c) || c == '/' || c == '-' || c == '"' || c == '\'';
+    }
+
+    constexpr void appendLiteral(const char c) {
+        if (!out.isLastSegmentText()) {
+            out.addSegment(CucumberExpressionMatcher::TEXT_SEGMENT, 0);
+            out.addText();
+        }
+        out.appendText(c);
+    }
+
+    /**
+     * @return Where the group ends, npos if it is not one of those matched
+     *         without the regular expression
+     */
+    constexpr std::size_t parseGroup(const std::string_view group, const std::size_t pos) {
+        constexpr std::array<std::pair<std::string_view, CucumberExpressionMatcher::SegmentKind>, 4>
+            GROUPS = {{
+                {R"((\d+))", CucumberExpressionMatcher::DIGITS_SEGMENT},
+                {R"((-?\d+))", CucumberExpressionMatcher::INTEGER_SEGMENT},
+                {R"((.*))", CucumberExpressionMatcher::ANYTHING_SEGMENT},
+                {R"(([^\s]+))", CucumberExpressionMatcher::WORD_SEGMENT},
+            }};
+        for (const auto& known : GROUPS) {
+            if (group.substr(0, known.first.size()) == known.first) {
+                out.addSegment(known.second, 1);
+                return pos + known.first.size();
+            }
+        }
+        const std::string_view open = "([^";
+        const std::string_view close = "]*)";
+        const std::size_t excludedEnd = group.find(close);
+        if (group.substr(0, open.size()) != open || excludedEnd == std::string_view::npos
+            || excludedEnd == open.size()) {
+            return std::string_view::npos;
+        }
+        const std::string_view excluded = group.substr(open.size(), excludedEnd - open.size());
+        if (excluded.find_first_of("\\[]^-") != std::string_view::npos) {
+            return std::string_view::npos;
+        }
+        out.addSegment(CucumberExpressionMatcher::EXCLUDING_SEGMENT, 1);
+        out.addText();
+        for (const char c : excluded) {
+            out.appendText(c);
+        }
+        return pos + excludedEnd + close.size();
+    }
+
+    const std::string_view regex;
+    Output& out;
+};
+
+/**
+ * Sizes of the transform of a step matcher, not transformed if it is
+ * neither a Cucumber Expression with built-in parameter types only nor a
+ * regular expression StaticRegexParser handles
+ */
+template<std::size_t MaxTokens>
+constexpr StaticTransformSizes measureStaticTransform(const std::string_view stepMatcher) {
+    StaticTransformSizes sizes;
+    if (hasParameterType(stepMatcher)) {
+        StaticExpressionParser<MaxTokens, StaticTransformSizes>(stepMatcher, sizes).parse();
+    } else {
+        StaticRegexParser<StaticTransformSizes>(stepMatcher, sizes).parse();
+    }
+    return sizes;
+}
+
+/**
+ * Compile time transform of a step matcher given as a type with a static
+ * constexpr get() returning it
+ */
+template<typename StepMatcher>
+struct StaticStepMatcher {
+    static constexpr std::string_view text = StepMatcher::get();
+    static constexpr StaticTransformSizes sizes = measureStaticTransform<text.size() + 1>(text);
+
+    typedef StaticTransform<
+        sizes.regex,
+        sizes.parameters,
+        sizes.segments,
+        sizes.texts,
+        sizes.textChars>
+        transform_type;
+
+    static constexpr transform_type transformText() {
+        transform_type transform;
+        if (!sizes.transformed) {
+            return transform;
+        }
+        if (hasParameterType(text)) {
+            StaticExpressionParser<text.size() + 1, transform_type>(text, transform).parse();
+        } else {
+            StaticRegexParser<transform_type>(text, transform).parse();
+        }
+        return transform;
+    }
+
+    static constexpr transform_type transform = transformText();
+};
+
+}
+}
+
+#endif /* CUKE_STATICCUCUMBEREXPRESSION_HPP_ */
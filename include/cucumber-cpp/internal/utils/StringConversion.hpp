@@ -0,0 +1,121 @@
+#ifndef CUKE_STRINGCONVERSION_HPP_
+#define CUKE_STRINGCONVERSION_HPP_
+
+#include <cctype>
+#include <charconv>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Numbers converted with std::from_chars and std::to_chars instead of
+ * streams; bool and character types keep their stream conversions.
+ */
+template<typename T>
+struct is_chars_convertible
+    : std::integral_constant<
+          bool,
+          std::is_floating_point<T>::value
+              || (std::is_integral<T>::value && !std::is_same<T, bool>::value
+                  && !std::is_same<T, char>::value && !std::is_same<T, signed char>::value
+                  && !std::is_same<T, unsigned char>::value && !std::is_same<T, wchar_t>::value
+                  && !std::is_same<T, char16_t>::value && !std::is_same<T, char32_t>::value)> {};
+
+template<typename T, typename = void>
+struct is_stream_readable : std::false_type {};
+
+template<typename T>
+struct is_stream_readable<
+    T,
+    std::void_t<decltype(std::declval<std::istream&>() >> std::declval<T&>())>>
+    : std::true_type {};
+
+template<typename T>
+T fromStream(const std::string& s) {
+    std::istringstream stream(s);
+    T t;
+    stream >> t;
+    if (stream.fail()) {
+        throw std::invalid_argument("Cannot convert parameter");
+    }
+    return t;
+}
+
+template<typename T>
+T fromString(const std::string& s) {
+    if constexpr (is_chars_convertible<T>::value) {
+        // std::from_chars reads less than streams do: it takes on the text
+        // both agree on, everything else is left to the stream for the
+        // exact same results and errors as before
+        const char* begin = s.data();
+        const char* const end = begin + s.size();
+        while (begin != end && std::isspace(static_cast<unsigned char>(*begin))) {
+            ++begin;
+        }
+        const char* digits = begin;
+        if (begin != end && *begin == '+') {
+            digits = ++begin;
+        } else if (begin != end && *begin == '-') {
+            digits = begin + 1;
+        }
+        if (digits != end && (std::isdigit(static_cast<unsigned char>(*digits)) || *digits == '.')) {
+            T t;
+            const std::from_chars_result result = std::from_chars(begin, end, t);
+            if (result.ec == std::errc()
+                && (result.ptr == end || std::isspace(static_cast<unsigned char>(*result.ptr)))) {
+                return t;
+            }
+        }
+    }
+    if constexpr (is_stream_readable<T>::value) {
+        return fromStream<T>(s);
+    } else {
+        // Types only custom parameter type transformers convert
+        throw std::invalid_argument("Cannot convert parameter");
+    }
+}
+
+template<>
+inline std::string fromString(const std::string& s) {
+    return s;
+}
+
+/**
+ * Views the argument where the invocation keeps it, for doc strings too
+ * large to copy
+ */
+template<>
+inline std::string_view fromString(const std::string& s) {
+    return s;
+}
+
+template<typename T>
+std::string toString(T arg) {
+    if constexpr (is_chars_convertible<T>::value) {
+        char buffer[64];
+        std::to_chars_result result;
+        if constexpr (std::is_floating_point<T>::value) {
+            // Default stream formatting, that is printf's %g
+            result = std::to_chars(buffer, buffer + sizeof(buffer), arg, std::chars_format::general, 6);
+        } else {
+            result = std::to_chars(buffer, buffer + sizeof(buffer), arg);
+        }
+        return std::string(buffer, result.ptr);
+    } else {
+        std::stringstream s;
+        s << arg;
+        return s.str();
+    }
+}
+
+}
+}
+
+#endif /* CUKE_STRINGCONVERSION_HPP_ */
@@ -0,0 +1,55 @@
+#ifndef CUKE_STRINGPOOL_HPP_
+#define CUKE_STRINGPOOL_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Interned strings stored back to back in large blocks, each distinct
+ * string once. Views of them stay valid as long as the pool.
+ */
+class CUCUMBER_CPP_EXPORT StringPool {
+public:
+    /**
+     * Strings longer than a block get one of their own
+     */
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    std::string_view intern(std::string_view text);
+
+    /**
+     * Distinct strings interned
+     */
+    std::size_t size() const;
+    /**
+     * Characters they take in the blocks
+     */
+    std::size_t characters() const;
+
+private:
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    // Being filled, unlike those of long strings
+    char* block = nullptr;
+    std::size_t blockUsed = BLOCK_SIZE;
+    std::size_t stored = 0;
+    std::unordered_set<std::string_view> interned;
+};
+
+}
+}
+
+#endif /* CUKE_STRINGPOOL_HPP_ */
@@ -0,0 +1,66 @@
+#ifndef CUKE_THREADPOOL_HPP_
+#define CUKE_THREADPOOL_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Fixed size pool of worker threads executing tasks in submission order.
+ * Pending tasks are still run when the pool is destroyed.
+ */
+class CUCUMBER_CPP_EXPORT ThreadPool {
+public:
+    typedef std::function<void()> task_type;
+
+    explicit ThreadPool(std::size_t threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const;
+
+    template<typename Task>
+    std::future<std::invoke_result_t<Task>> submit(Task task);
+
+private:
+    void enqueue(task_type task);
+    void work();
+
+    std::vector<std::thread> workers;
+    std::deque<task_type> tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping = false;
+};
+
+template<typename Task>
+std::future<std::invoke_result_t<Task>> ThreadPool::submit(Task task) {
+    typedef std::packaged_task<std::invoke_result_t<Task>()> packaged_task_type;
+    // std::function needs a copyable target
+    const std::shared_ptr<packaged_task_type> packagedTask =
+        std::make_shared<packaged_task_type>(std::move(task));
+    std::future<std::invoke_result_t<Task>> result = packagedTask->get_future();
+    enqueue([packagedTask] {
+        (*packagedTask)();
+    });
+    return result;
+}
+
+}
+}
+
+#endif /* CUKE_THREADPOOL_HPP_ */
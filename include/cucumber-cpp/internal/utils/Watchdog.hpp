@@ -0,0 +1,87 @@
+#ifndef CUKE_WATCHDOG_HPP_
+#define CUKE_WATCHDOG_HPP_
+
+#include <cucumber-cpp/internal/CukeExport.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Calls back once deadlines expire, all from a single thread.
+ *
+ * Deadlines are kept in a hashed timer wheel of TICK resolution, so arming
+ * and disarming take the same time however many are armed. The thread only
+ * wakes up for the ticks that have a deadline, and not at all while none
+ * is armed. Callbacks run on that thread and should return quickly.
+ */
+class CUCUMBER_CPP_EXPORT Watchdog {
+public:
+    typedef std::chrono::steady_clock clock_type;
+    typedef std::uint64_t timer_type;
+    typedef std::function<void()> callback_type;
+
+    static constexpr std::chrono::milliseconds TICK{5};
+    static constexpr std::size_t WHEEL_SIZE = 256;
+
+    Watchdog();
+    ~Watchdog();
+
+    Watchdog(const Watchdog&) = delete;
+    Watchdog& operator=(const Watchdog&) = delete;
+
+    /**
+     * The watchdog of the process
+     */
+    static Watchdog& instance();
+
+    /**
+     * Calls back once the timeout elapsed, rounded up to the next tick
+     */
+    timer_type arm(clock_type::duration timeout, callback_type callback);
+    /**
+     * @return false if the timer already expired or was disarmed
+     */
+    bool disarm(timer_type timer);
+
+    std::size_t armed() const;
+
+private:
+    typedef std::uint64_t tick_type;
+
+    struct Timer {
+        timer_type id;
+        /** Turns of the wheel left before expiring */
+        tick_type rounds;
+        callback_type callback;
+    };
+    typedef std::vector<Timer> slot_type;
+
+    void work();
+    tick_type ticksAt(clock_type::time_point time) const;
+    /** The first tick after the last one processed that has a timer */
+    tick_type nextTick() const;
+
+    mutable std::mutex mutex;
+    std::condition_variable changed;
+    const clock_type::time_point start;
+    std::vector<slot_type> wheel;
+    tick_type processedTick = 0;
+    timer_type lastTimer = 0;
+    std::size_t armedTimers = 0;
+    bool stopping = false;
+    std::thread thread;
+};
+
+}
+}
+
+#endif /* CUKE_WATCHDOG_HPP_ */
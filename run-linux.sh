@@ -66,6 +66,12 @@ echo "unix: ${SOCK}" > examples/FeatureShowcase/features/step_definitions/cucumb
 (cd examples/FeatureShowcase; cucumber)
 wait %
 
+#
+# Execute the synthetic suite in process
+#
+
+build/examples/SyntheticSuite/SyntheticRunner build/examples/SyntheticSuite/features > /dev/null
+
 mkdir -p coverage
 gcovr build/ --html-details --output coverage/index.html --xml coverage/cobertura.xml
 
@@ -0,0 +1,103 @@
+#include "cucumber-cpp/internal/AllocationTracking.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h>
+#endif
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+/**
+ * Every block starts with its size, so that deallocations know what they
+ * free, padded to keep the rest aligned
+ */
+constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+static_assert(HEADER_SIZE >= sizeof(std::size_t), "No room for the block size");
+
+// Trivial, so that counting needs no initialization even while threads start
+thread_local AllocationCount threadCount;
+std::atomic<bool> installed(false);
+
+void* allocateCounted(std::size_t size) noexcept {
+    void* const block = std::malloc(HEADER_SIZE + (size != 0 ? size : 1));
+    if (block == nullptr) {
+        return nullptr;
+    }
+    *static_cast<std::size_t*>(block) = size;
+    ++threadCount.allocations;
+    threadCount.allocatedBytes += size;
+    if (!installed.load(std::memory_order_relaxed)) {
+        installed.store(true, std::memory_order_relaxed);
+    }
+    return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+}
+
+bool AllocationTracking::isInstalled() {
+    return installed.load(std::memory_order_relaxed);
+}
+
+AllocationCount AllocationTracking::thread() {
+    return threadCount;
+}
+
+AllocationSample AllocationTracking::sample() {
+    return AllocationSample{threadCount, peakResidentBytes()};
+}
+
+std::uint64_t AllocationTracking::peakResidentBytes() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    #if defined(__APPLE__)
+    return static_cast<std::uint64_t>(usage.ru_maxrss);
+    #else
+    // In kilobytes everywhere else
+    return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+    #endif
+#else
+    return 0;
+#endif
+}
+
+void* AllocationTracking::allocate(std::size_t size) {
+    for (;;) {
+        if (void* const pointer = allocateCounted(size)) {
+            return pointer;
+        }
+        const std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* AllocationTracking::allocate(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void AllocationTracking::deallocate(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    void* const block = static_cast<char*>(pointer) - HEADER_SIZE;
+    threadCount.freedBytes += *static_cast<std::size_t*>(block);
+    std::free(block);
+}
+
+}
+}
@@ -1,12 +1,308 @@
 #include "cucumber-cpp/internal/ContextManager.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 namespace cucumber {
 namespace internal {
 
-contexts_type ContextManager::contexts;
+namespace {
+const std::size_t MIN_BLOCK_SIZE = 4096;
 
-void ContextManager::purgeContexts() {
+std::atomic<std::ptrdiff_t> liveContextCount(0);
+
+std::size_t alignedOffset(
+    const unsigned char* block, const std::size_t offset, const std::size_t alignment
+) {
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block) + offset;
+    return offset + (alignment - address % alignment) % alignment;
+}
+
+/**
+ * Destroys the contexts handed over by arenas, in the order they were
+ */
+class ContextReaper {
+public:
+    typedef std::function<void()> job_type;
+
+    ContextReaper() :
+        thread(&ContextReaper::work, this) {
+    }
+
+    ~ContextReaper() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        changed.notify_all();
+        thread.join();
+    }
+
+    /**
+     * Waits for room under the bound first, unless nothing is pending
+     */
+    void handOver(job_type job, const std::size_t bytes, const std::size_t maxPendingBytes) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (pendingBytes != 0 && pendingBytes + bytes > maxPendingBytes) {
+            changed.wait_for(lock, std::chrono::seconds(1));
+        }
+        jobs.push_back({std::move(job), bytes});
+        pendingBytes += bytes;
+        changed.notify_all();
+    }
+
+    void waitForJobs() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!jobs.empty() || working) {
+            changed.wait_for(lock, std::chrono::seconds(1));
+        }
+    }
+
+private:
+    struct Job {
+        job_type destroy;
+        std::size_t bytes;
+    };
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            while (!stopping && jobs.empty()) {
+                changed.wait_for(lock, std::chrono::seconds(1));
+            }
+            if (jobs.empty()) {
+                return;
+            }
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+            working = true;
+            lock.unlock();
+            job.destroy();
+            job.destroy = nullptr;
+            lock.lock();
+            working = false;
+            pendingBytes -= job.bytes;
+            changed.notify_all();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<Job> jobs;
+    std::size_t pendingBytes = 0;
+    bool working = false;
+    bool stopping = false;
+    std::thread thread;
+};
+
+ContextReaper& contextReaper() {
+    static ContextReaper reaper;
+    return reaper;
+}
+
+std::atomic<std::size_t> maxPendingTeardownBytes(0);
+}
+
+ContextArena::~ContextArena() {
+    destroyContexts();
+}
+
+void* ContextArena::allocate(const std::size_t size, const std::size_t alignment) {
+    std::size_t offset =
+        blocks.empty() ? 0 : alignedOffset(blocks.back().get(), blockUsed, alignment);
+    if (blocks.empty() || offset + size > blockSize) {
+        blockSize = std::max(MIN_BLOCK_SIZE, size + alignment);
+        blocks.emplace_back(new unsigned char[blockSize]);
+        reserved += blockSize;
+        offset = alignedOffset(blocks.back().get(), 0, alignment);
+    }
+    blockUsed = offset + size;
+    return blocks.back().get() + offset;
+}
+
+void ContextArena::reset() {
+    const std::size_t maxPendingBytes = maxPendingTeardownBytes.load(std::memory_order_relaxed);
+    if (maxPendingBytes != 0 && !contexts.empty()) {
+        // Later contexts go to new blocks while these are destroyed
+        const std::shared_ptr<ContextArena> handedOver = std::make_shared<ContextArena>();
+        handedOver->contexts.swap(contexts);
+        handedOver->blocks.swap(blocks);
+        contextReaper().handOver(
+            [handedOver] {
+                handedOver->destroyContexts();
+            },
+            reserved,
+            maxPendingBytes
+        );
+        blockSize = 0;
+        blockUsed = 0;
+        reserved = 0;
+        return;
+    }
+    destroyContexts();
+    if (blocks.size() > 1) {
+        // The next scenario probably needs as much again: keep it in a single block
+        blocks.clear();
+        blockSize = reserved;
+        blocks.emplace_back(new unsigned char[blockSize]);
+    }
+    blockUsed = 0;
+}
+
+void ContextArena::destroyContexts() {
+    for (std::vector<Context>::reverse_iterator i = contexts.rbegin(); i != contexts.rend(); ++i) {
+        i->destroy(i->object);
+    }
+    countContexts(-static_cast<std::ptrdiff_t>(contexts.size()));
+    contexts.clear();
+}
+
+ContextArena::size_type ContextArena::size() const {
+    return contexts.size();
+}
+
+ContextArena::size_type ContextArena::liveContexts() {
+    return static_cast<size_type>(liveContextCount.load(std::memory_order_relaxed));
+}
+
+void ContextArena::setBackgroundTeardown(const std::size_t maxPendingBytes) {
+    if (maxPendingBytes != 0) {
+        contextReaper();
+    }
+    maxPendingTeardownBytes.store(maxPendingBytes, std::memory_order_relaxed);
+}
+
+void ContextArena::waitForTeardown() {
+    if (maxPendingTeardownBytes.load(std::memory_order_relaxed) != 0) {
+        contextReaper().waitForJobs();
+    }
+}
+
+void ContextArena::countContexts(std::ptrdiff_t change) {
+    liveContextCount.fetch_add(change, std::memory_order_relaxed);
+}
+
+void ContextSlots::clear() {
+    contexts.clear();
+    arena.reset();
+}
+
+namespace {
+thread_local ScenarioContexts* currentContexts = NULL;
+}
+
+ScenarioContexts::~ScenarioContexts() {
+    if (currentContexts == this) {
+        currentContexts = NULL;
+    }
+}
+
+ScenarioContexts& ScenarioContexts::current() {
+    if (!currentContexts) {
+        thread_local ScenarioContexts threadContexts;
+        currentContexts = &threadContexts;
+    }
+    return *currentContexts;
+}
+
+void ScenarioContexts::makeCurrent() {
+    currentContexts = this;
+}
+
+ScenarioContexts::type_id_type ScenarioContexts::nextTypeId() {
+    static std::atomic<type_id_type> typeIds(0);
+    return typeIds++;
+}
+
+void ScenarioContexts::purge() {
     contexts.clear();
+    arena.reset();
+    for (PooledContext& pooled : pooledContexts) {
+        pooled.stale = true;
+    }
+}
+
+std::shared_ptr<const ContextSnapshot> ScenarioContexts::snapshot() const {
+    std::shared_ptr<ContextSnapshot> snapshot = std::make_shared<ContextSnapshot>();
+    for (type_id_type id = 0; id < contexts.size(); ++id) {
+        const ScenarioContext& context = contexts[id];
+        if (!context.object) {
+            continue;
+        }
+        if (!context.copier) {
+            return nullptr;
+        }
+        snapshot->contexts.push_back({id, context.copier->take(context.object), context.copier});
+    }
+    // Contexts that are not shared by type cannot be found again
+    if (snapshot->contexts.size() != arena.size()) {
+        return nullptr;
+    }
+    // Nor can pooled contexts be brought back to a former state
+    for (const PooledContext& pooled : pooledContexts) {
+        if (pooled.object && !pooled.stale) {
+            return nullptr;
+        }
+    }
+    return snapshot;
+}
+
+bool ScenarioContexts::restore(const ContextSnapshot& snapshot) {
+    for (const ContextSnapshot::Context& context : snapshot.contexts) {
+        if (context.typeId < contexts.size() && contexts[context.typeId].object) {
+            return false;
+        }
+    }
+    for (const ContextSnapshot::Context& context : snapshot.contexts) {
+        if (context.typeId >= contexts.size()) {
+            contexts.resize(context.typeId + 1);
+        }
+        contexts[context.typeId].object = context.copier->restore(arena, context.copy.get());
+        contexts[context.typeId].copier = context.copier;
+    }
+    return true;
+}
+
+void ScenarioContexts::purgeFeature() {
+    featureContexts.reset();
+}
+
+void ScenarioContexts::shareFeatureContexts(const ScenarioContexts& other) {
+    featureContexts = other.featureContexts;
+}
+
+void ScenarioContexts::purgeRun() {
+    std::lock_guard<std::mutex> lock(runContextsMutex());
+    runContexts().clear();
+}
+
+std::mutex& ScenarioContexts::runContextsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+ContextSlots& ScenarioContexts::runContexts() {
+    static ContextSlots slots;
+    return slots;
+}
+
+ContextArena::size_type ScenarioContexts::size() const {
+    return arena.size();
+}
+
+ScenarioContexts& ContextManager::contexts() {
+    return ScenarioContexts::current();
+}
+
+void ContextManager::purgeContexts() {
+    contexts().purge();
 }
 
 }
@@ -0,0 +1,121 @@
+#include <cucumber-cpp/internal/utils/CpuAffinity.hpp>
+
+#include <cstdlib>
+#include <stdexcept>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+unsigned int parseCpu(const std::string& list, const std::string& text) {
+    char* end = nullptr;
+    const unsigned long cpu = std::strtoul(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0' || text.front() == '-' || text.front() == '+') {
+        throw std::invalid_argument("Invalid cpu list: " + list);
+    }
+    return static_cast<unsigned int>(cpu);
+}
+}
+
+cpu_list_type parseCpuList(const std::string& list) {
+    cpu_list_type cpus;
+    std::string::size_type begin = 0;
+    while (begin <= list.size()) {
+        std::string::size_type end = list.find(',', begin);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        const std::string range = list.substr(begin, end - begin);
+        const std::string::size_type dash = range.find('-');
+        if (dash == std::string::npos) {
+            cpus.push_back(parseCpu(list, range));
+        } else {
+            const unsigned int first = parseCpu(list, range.substr(0, dash));
+            const unsigned int last = parseCpu(list, range.substr(dash + 1));
+            if (last < first) {
+                throw std::invalid_argument("Invalid cpu list: " + list);
+            }
+            for (unsigned int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+        begin = end + 1;
+    }
+    return cpus;
+}
+
+bool pinThisThread(const cpu_list_type& cpus) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const unsigned int cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            return false;
+        }
+        CPU_SET(cpu, &set);
+    }
+    return !cpus.empty() && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+cpu_list_type threadCpus() {
+    cpu_list_type cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+        for (unsigned int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+ScopedThreadPin::ScopedThreadPin(const unsigned int cpu) :
+    previous(threadCpus()) {
+    if (!pinThisThread({cpu})) {
+        previous.clear();
+    }
+}
+
+ScopedThreadPin::~ScopedThreadPin() {
+    if (!previous.empty()) {
+        pinThisThread(previous);
+    }
+}
+
+void CpuRotation::assign(const cpu_list_type& cpus) {
+    this->cpus = cpus;
+    next = 0;
+}
+
+bool CpuRotation::empty() const {
+    return cpus.empty();
+}
+
+cpu_list_type CpuRotation::take() {
+    if (cpus.empty()) {
+        return cpu_list_type();
+    }
+    return {cpus[next.fetch_add(1) % cpus.size()]};
+}
+
+void CpuRotation::pinThisThread() {
+    const cpu_list_type cpu = take();
+    if (!cpu.empty()) {
+        internal::pinThisThread(cpu);
+    }
+}
+
+}
+}
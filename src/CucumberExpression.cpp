@@ -1,10 +1,20 @@
-#include <cucumber-cpp/internal/utils/CucumberExpression.hpp>
+#include <cucumber-cpp/internal/utils/StaticCucumberExpression.hpp>
+#include <cucumber-cpp/internal/utils/Regex.hpp>
+#include <cucumber-cpp/internal/StartupProfile.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 namespace cucumber::internal {
@@ -39,43 +49,142 @@ namespace {
  * - {} (anonymous): .*
  */
 inline std::map<std::string, std::string, std::less<>> getBuiltInParameterTypes() {
-    // Built-in parameter types mapping
-    std::map<std::string, std::string, std::less<>> PARAMETER_TYPES = {
-        {"int",         R"(-?\d+)"},
-        {"float",       R"((?=.*\d.*)[-+]?\d*(?:\.(?=\d.*))?\d*(?:\d+[E][+-]?\d+)?)"},
-        {"word",        R"([^\s]+)"},
-        {"string",      R"xyz("([^"\\]*(\\.[^"\\]*)*)"|'([^'\\]*(\\.[^'\\]*)*)')xyz"},  // because the raw string contains )", so use xyz as delimiter
-        {"bigdecimal",  R"((?=.*\d.*)[-+]?\d*(?:\.(?=\d.*))?\d*(?:\d+[E][+-]?\d+)?)"},
-        {"double",      R"((?=.*\d.*)[-+]?\d*(?:\.(?=\d.*))?\d*(?:\d+[E][+-]?\d+)?)"},
-        {"biginteger",  R"(-?\d+)"},
-        {"byte",        R"(-?\d+)"},
-        {"short",       R"(-?\d+)"},
-        {"long",        R"(-?\d+)"},
-        {"", ".*"}  // anonymous parameter type
-    };
-    return PARAMETER_TYPES;
+    std::map<std::string, std::string, std::less<>> types;
+    for (const BuiltInParameterType& type : BUILT_IN_PARAMETER_TYPES) {
+        types.emplace(type.name, type.regexp);
+    }
+    return types;
 }
 
 /**
- * getCustomParameterTypes - Load custom parameter types from external JSON file
- * 
- * Reads custom parameter type definitions from "custom_parameter_types.json" file
- * in the current working directory. Custom parameter types allow users to extend
- * Cucumber Expressions with domain-specific parameter matching patterns.
- * 
- * JSON File Format:
- * The custom_parameter_types.json file should contain a JSON array of objects,
- * where each object defines a custom parameter type with the following structure:
- * 
- * [
- *   {
- *     "name": "parameter_type_name",
- *     "regexp": "regex_pattern_for_matching"
- *   },
- *   ...
- * ]
- * 
- * Example:
+ * Regular expression of a parameter type, and its whole text match if it
+ * is a custom type
+ */
+struct ParameterTypeDefinition {
+    std::string regexp;
+    std::shared_ptr<const Regex> compiled;
+};
+
+typedef std::map<std::string, ParameterTypeDefinition, std::less<>> parameter_types_type;
+
+struct ParameterTypes {
+    // Replaced, never modified, so that parsers can keep using their copy
+    std::shared_ptr<const parameter_types_type> types;
+    // Whether custom types were defined, loaded or read from the default file
+    bool customTypesSet;
+};
+
+ParameterTypes& parameterTypes() {
+    static ParameterTypes parameterTypes = {nullptr, false};
+    return parameterTypes;
+}
+
+std::mutex& parameterTypesMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/**
+ * Converts the texts of a custom parameter type, keeping what it made of
+ * them
+ */
+struct ParameterTransformer {
+    std::type_index type;
+    std::function<std::shared_ptr<const void>(std::string_view)> transform;
+    std::unordered_map<std::string, std::shared_ptr<const void>> values;
+};
+
+/** Distinct texts kept by each transformer before they are flushed */
+const std::size_t TRANSFORMED_VALUES_CAPACITY = 10000;
+
+struct ParameterTransformers {
+    std::mutex mutex;
+    std::map<std::string, ParameterTransformer, std::less<>> byName;
+    // Spares steps the lock while no type has a transformer
+    std::atomic<bool> any{false};
+};
+
+ParameterTransformers& parameterTransformers() {
+    static ParameterTransformers transformers;
+    return transformers;
+}
+
+void removeParameterTransformers(const std::string* name) {
+    ParameterTransformers& transformers = parameterTransformers();
+    std::lock_guard<std::mutex> lock(transformers.mutex);
+    if (name) {
+        transformers.byName.erase(*name);
+    } else {
+        transformers.byName.clear();
+    }
+    transformers.any = !transformers.byName.empty();
+}
+
+/**
+ * Value the transformer found made of the text, made now if there is none
+ */
+std::shared_ptr<const void> transformText(
+    std::map<std::string, ParameterTransformer, std::less<>>::iterator transformer,
+    const std::string& text,
+    std::unique_lock<std::mutex>& lock
+) {
+    const auto kept = transformer->second.values.find(text);
+    if (kept != transformer->second.values.end()) {
+        return kept->second;
+    }
+    const std::string name = transformer->first;
+    const auto transform = transformer->second.transform;
+    lock.unlock();
+    std::shared_ptr<const void> value = transform(text);
+    lock.lock();
+    // The type may have been redefined meanwhile
+    ParameterTransformers& transformers = parameterTransformers();
+    const auto current = transformers.byName.find(name);
+    if (current != transformers.byName.end()) {
+        if (current->second.values.size() >= TRANSFORMED_VALUES_CAPACITY) {
+            current->second.values.clear();
+        }
+        current->second.values.emplace(text, value);
+    }
+    return value;
+}
+
+std::shared_ptr<const parameter_types_type> builtInParameterTypes() {
+    auto types = std::make_shared<parameter_types_type>();
+    for (const auto& type : getBuiltInParameterTypes()) {
+        types->insert(std::make_pair(type.first, ParameterTypeDefinition{type.second, nullptr}));
+    }
+    return types;
+}
+
+/**
+ * Must be called with the mutex held
+ */
+const std::shared_ptr<const parameter_types_type>& lockedParameterTypes() {
+    if (!parameterTypes().types) {
+        parameterTypes().types = builtInParameterTypes();
+    }
+    return parameterTypes().types;
+}
+
+std::shared_ptr<const parameter_types_type> currentParameterTypes() {
+    std::lock_guard<std::mutex> lock(parameterTypesMutex());
+    return lockedParameterTypes();
+}
+
+ParameterTypeDefinition compileParameterType(const std::string& name, const std::string& regexp) {
+    try {
+        return {regexp, std::make_shared<const Regex>("^(?:" + regexp + ")$")};
+    } catch (const std::regex_error& e) {
+        throw CucumberExpressionpressionException(
+            "Invalid regular expression for parameter type {" + name + "}: " + e.what()
+        );
+    }
+}
+
+/**
+ * Reads custom parameter type definitions from a JSON array of objects:
+ *
  * [
  *   {
  *     "name": "uuid",
@@ -86,350 +195,430 @@ inline std::map<std::string, std::string, std::less<>> getBuiltInParameterTypes(
  *     "regexp": "[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}"
  *   }
  * ]
+ *
+ * Built-in types are never overridden. When lenient, whatever cannot be
+ * read is skipped instead of throwing.
  */
-inline std::map<std::string, std::string, std::less<>> getCustomParameterTypes() {
-    std::map<std::string, std::string, std::less<>> PARAMETER_TYPES;
-    
-    // Try to read custom parameter types from JSON file
-    std::ifstream file("custom_parameter_types.json");
+parameter_types_type readParameterTypes(const std::string& path, const bool lenient) {
+    const ScopedStartupTiming timing(STARTUP_LOAD_PARAMETER_TYPES, path);
+    parameter_types_type types;
+    std::ifstream file(path);
     if (!file.is_open()) {
-        // File doesn't exist, return empty map
-        return PARAMETER_TYPES;
+        if (lenient) {
+            return types;
+        }
+        throw CucumberExpressionpressionException("Cannot read parameter types from " + path);
     }
-    
+
+    nlohmann::json j;
     try {
-        nlohmann::json j;
         file >> j;
-        
-        // Validate that it's an array
-        if (!j.is_array()) {
-            return PARAMETER_TYPES;
+    } catch (const std::exception& e) {
+        if (lenient) {
+            return types;
         }
-        
-        // Parse each parameter type definition
-        for (const auto& item : j) {
-            if (item.is_object() && item.contains("name") && item.contains("regexp")) {
-                std::string name = item["name"].get<std::string>();
-                std::string regexp = item["regexp"].get<std::string>();
-                PARAMETER_TYPES[name] = regexp;
+        throw CucumberExpressionpressionException(
+            "Cannot read parameter types from " + path + ": " + e.what()
+        );
+    }
+    if (!j.is_array()) {
+        if (lenient) {
+            return types;
+        }
+        throw CucumberExpressionpressionException(
+            "Parameter types in " + path + " must be an array"
+        );
+    }
+
+    const std::map<std::string, std::string, std::less<>> builtIn = getBuiltInParameterTypes();
+    for (const auto& item : j) {
+        if (!item.is_object() || !item.contains("name") || !item["name"].is_string()
+            || !item.contains("regexp") || !item["regexp"].is_string()) {
+            if (lenient) {
+                continue;
+            }
+            throw CucumberExpressionpressionException(
+                "Parameter types in " + path + " need a name and a regexp"
+            );
+        }
+        const std::string name = item["name"].get<std::string>();
+        if (builtIn.count(name)) {
+            continue;
+        }
+        try {
+            types[name] = compileParameterType(name, item["regexp"].get<std::string>());
+        } catch (const CucumberExpressionpressionException&) {
+            if (!lenient) {
+                throw;
             }
         }
-    } catch (const std::exception&) {
-        // If JSON parsing fails, return empty map
-        return PARAMETER_TYPES;
     }
-    
-    return PARAMETER_TYPES;
+    return types;
 }
 
-inline const std::map<std::string, std::string, std::less<>>& getParameterTypes() {
-    // Merge built-in and custom parameter types
-    static const std::map<std::string, std::string, std::less<>> PARAMETER_TYPES = []() {
-        auto types = getBuiltInParameterTypes();
-        auto customTypes = getCustomParameterTypes();
-        // Custom types override built-in types if there's a name conflict
-        types.insert(customTypes.begin(), customTypes.end());
-        return types;
-    }();
-    return PARAMETER_TYPES;
+/**
+ * Reads the default file the first time a type that is not built in is
+ * looked for, unless custom types were set otherwise.
+ */
+std::shared_ptr<const parameter_types_type> parameterTypesWithDefaultFile() {
+    std::lock_guard<std::mutex> lock(parameterTypesMutex());
+    if (!parameterTypes().customTypesSet) {
+        auto types = std::make_shared<parameter_types_type>(*lockedParameterTypes());
+        const parameter_types_type custom = readParameterTypes("custom_parameter_types.json", true);
+        types->insert(custom.begin(), custom.end());
+        parameterTypes().types = types;
+        parameterTypes().customTypesSet = true;
+    }
+    return parameterTypes().types;
 }
 
-void validateRegex(const std::string& regex) {
+Regex compileRegex(const std::string& regex) {
     try {
-        std::regex testRegex(regex);
+        const ScopedStartupTiming timing(STARTUP_COMPILE_REGEX, regex);
+        return Regex(regex);
     } catch (const std::regex_error& e) {
-        throw CucumberExpressionpressionException("Failed to create valid regex: " + std::string(e.what()));
+        throw CucumberExpressionpressionException(
+            "Invalid Cucumber expression: Failed to create valid regex: " + std::string(e.what())
+        );
     }
 }
+
+/**
+ * Characters that stand for themselves in a Cucumber Expression but must be
+ * escaped in a regular expression
+ */
+constexpr std::array<bool, 256> REGEX_SPECIAL_CHARACTERS = [] {
+    std::array<bool, 256> specials{};
+    for (std::size_t c = 0; c < specials.size(); ++c) {
+        specials[c] = isRegexSpecialCharacter(static_cast<char>(c));
+    }
+    return specials;
+}();
+
+/**
+ * Built-in parameter types CucumberExpressionMatcher runs itself, by
+ * regular expression so that custom types overriding them are not mistaken
+ * for them
+ */
+const std::map<std::string, CucumberExpressionMatcher::SegmentKind>& matcherParameterKinds() {
+    static const std::map<std::string, CucumberExpressionMatcher::SegmentKind> KINDS = [] {
+        const auto builtIn = getBuiltInParameterTypes();
+        return std::map<std::string, CucumberExpressionMatcher::SegmentKind>{
+            {builtIn.at("int"), CucumberExpressionMatcher::INTEGER_SEGMENT},
+            {builtIn.at("word"), CucumberExpressionMatcher::WORD_SEGMENT},
+            {builtIn.at("string"), CucumberExpressionMatcher::STRING_SEGMENT},
+            {builtIn.at(""), CucumberExpressionMatcher::ANYTHING_SEGMENT}
+        };
+    }();
+    return KINDS;
+}
 } // anonymous namespace
 
+/**
+ * Converts an expression to a regular expression in a single left-to-right
+ * pass. Whitespace and parameter types end alternations, so only the tokens
+ * read since the last of them are held back until it is known whether they
+ * hold alternatives.
+ */
 class CucumberExpressionpressionParser {
 private:
-    std::string expression;
+    struct Token {
+        enum Kind {
+            TEXT,
+            OPTIONAL,
+            ALTERNATION
+        };
+        Kind kind;
+        // Still escaped as in the expression
+        std::string_view text;
+    };
+
+    const std::string& expression;
     size_t pos = 0;
-    
+    std::vector<CucumberExpressionParameter>* parameters;
+    std::size_t groups = 0;
+    std::vector<Token> segment;
+    bool segmentHasAlternation = false;
+    std::string result;
+    CucumberExpressionMatcher::segments_type matcherSegments;
+    bool matchable = true;
+    std::shared_ptr<const parameter_types_type> types = currentParameterTypes();
+
 public:
-    explicit CucumberExpressionpressionParser(const std::string& expr) :
-        expression(expr) {}
+    explicit CucumberExpressionpressionParser(
+        const std::string& expr, std::vector<CucumberExpressionParameter>* parameters = nullptr
+    ) :
+        expression(expr),
+        parameters(parameters) {}
 
+    /**
+     * @return the regular expression, anchored at both ends
+     */
     std::string parse() {
-        std::string result;
-        
+        result.reserve(2 * expression.length() + 2);
+        result += '^';
         while (pos < expression.length()) {
-            char current = expression[pos];
-            
-            // Handle escaping - \( \) \{ \} \/
-            if (current == '\\' && pos + 1 < expression.length()) {
-                char next = expression[pos + 1];
-                if (next == '(' || next == ')' || next == '{' || next == '}' || next == '/') {
-                    parseEscaping(result);
-                    continue;
-                }
-            }
-            
-            // Handle parameter types {type}
-            if (current == '{') {
-                parseOpenBrace(result);
-                continue;
-            }
-            
-            // Handle optional text (text)
-            if (current == '(') {
-                parseOpenParenthesis(result);
-                continue;
-            }
-            
-            // Handle alternatives - if we see a /, look back to find word boundaries
-            if (current == '/') {
-                parseAlternatives(result);
-                continue;
-            }
-            
-            // Regular character - escape regex special characters if needed
-            if (std::string(".^$|()[]{}*+?\\").find(current) != std::string::npos) {
-                result += "\\";
+            const char current = expression[pos];
+            if (current == ' ') {
+                appendSegment();
                 result += current;
+                addMatcherText(std::string(1, current));
+                ++pos;
+            } else if (current == '{') {
+                appendSegment();
+                parseParameter();
+            } else if (current == '(') {
+                parseOptional();
+            } else if (current == '/') {
+                segment.push_back({Token::ALTERNATION, std::string_view()});
+                segmentHasAlternation = true;
+                ++pos;
             } else {
-                result += current;
+                parseText();
             }
-            pos++;
         }
-        
-        return result;
+        appendSegment();
+        result += '$';
+        return std::move(result);
     }
-    
-private:
-    // Collect words separated by / starting from the position before first /
-    std::vector<std::string> collectAlternativesFromHere(size_t startPos) {
-        std::vector<std::string> alternatives;
-        size_t i = startPos;
-        std::string current;
-        
-        // First, backtrack to get the word before the first /
-        while (expression[i] != ' ' && expression[i] != '{') {
-            char c = expression[i];
-            // If we hit a closing paren, include the entire parenthesized expression
-            if (c == ')') {
-                // Find the matching opening paren
-                int depth = 1;
-                current = c + current;
-                if (i == 0) break;
-                i--;
-                while (depth > 0) {
-                    char pc = expression[i];
-                    current = pc + current;
-                    if (pc == ')') depth++;
-                    if (pc == '(') depth--;
-                    if (i == 0) break;
-                    i--;
-                }
-                continue;
-            }
-            // Stop backtracking at opening paren (without including it)
-            if (c == '(') {
-                break;
-            }
-            current = c + current;
-            if (i == 0) break;
-            i--;
-        }
-        
-        // Now collect forward from startPos to get all alternatives
-        // Add the first alternative (from backtracking)
-        if (!current.empty()) {
-            alternatives.push_back(current);
-            current.clear();
-        }
-        
-        std::string allWords;
-        size_t fwdPos = startPos + 1;
-        
-        while (fwdPos < expression.length()) {
-            char c = expression[fwdPos];
-            
-            // Stop at boundaries
-            if (c == ' ' || c == '{') {
-                break;
-            }
-            
-            // If we hit '(' right after a slash (current is empty), it's outside the alternation
-            if (c == '(' && current.empty()) {
-                break;
-            }
-            
-            // If we hit '(', include everything up to the matching ')' as part of the alternative
-            if (c == '(') {
-                size_t parenEnd = expression.find(')', fwdPos);
-                if (parenEnd != std::string::npos) {
-                    // Include parentheses and contents
-                    while (fwdPos <= parenEnd) {
-                        current += expression[fwdPos];
-                        fwdPos++;
-                    }
-                    continue;
-                }
-                current += c;
-                fwdPos++;
-                continue;
-            }
-            
-            // Handle escaped slash
-            if (c == '\\' && fwdPos + 1 < expression.length() && expression[fwdPos + 1] == '/') {
-                allWords += '/';
-                fwdPos += 2;
-                continue;
-            }
-            
-            // Unescaped slash is separator
-            if (c == '/') {
-                // Save current word
-                if (!current.empty()) {
-                    alternatives.push_back(current);
-                    current.clear();
-                }
-                fwdPos++;
-                continue;
-            }
-            
-            current += c;
-            fwdPos++;
-        }
-        
-        if (!current.empty()) {
-            alternatives.push_back(current);
+
+    /**
+     * @return the matcher of the expression parsed, null if it has none
+     */
+    std::shared_ptr<const CucumberExpressionMatcher> matcher() {
+        if (!matchable) {
+            return nullptr;
         }
-        
-        pos = fwdPos;
-        return alternatives;
+        return std::make_shared<const CucumberExpressionMatcher>(std::move(matcherSegments));
     }
-    
-    std::string escapeRegexChars(const std::string& text) const {
-        std::string result;
-        for (char c : text) {
-            if (std::string(".^$|()[]{}*+?\\").find(c) != std::string::npos) {
-                result += "\\";
-            }
-            result += c;
-        }
-        return result;
+
+    /**
+     * @return the parameter types the expression was parsed with
+     */
+    const std::shared_ptr<const parameter_types_type>& parameterTypes() const {
+        return types;
     }
 
-    // Parse a single alternative text to handle optional content
-    std::string parseAlternativeText(const std::string& text) const {
-        std::string result;
-        size_t i = 0;
-        
-        while (i < text.length()) {
-            char c = text[i];
-            
-            // Handle optional text (text)
-            if (c == '(') {
-                size_t closePos = text.find(')', i);
-                if (closePos != std::string::npos) {
-                    std::string optionalContent = text.substr(i + 1, closePos - i - 1);
-                    // Validate that optional content is not empty
-                    if (optionalContent.empty()) {
-                        throw CucumberExpressionpressionException("Empty optional text is not allowed");
-                    }
-                    std::string escapedContent = escapeRegexChars(optionalContent);
-                    result += "(?:" + escapedContent + ")?";
-                    i = closePos + 1;
-                    continue;
-                }
-            }
-            
-            // Escape regex special characters
-            if (std::string(".^$|()[]{}*+?\\").find(c) != std::string::npos) {
-                result += "\\";
-            }
-            result += c;
-            i++;
-        }
-        
-        return result;
+private:
+    static bool isEscapable(const char c) {
+        return c == '(' || c == ')' || c == '{' || c == '}' || c == '/';
     }
 
-    void parseEscaping(std::string& result) {
-        char next = expression[pos + 1];
-        // Output the escaped character for regex - manually escape special chars
-        if (next == '{' || next == '}' || next == '(' || next == ')') {
-            result += "\\";
+    bool isEscapeAt(const size_t i) const {
+        return expression[i] == '\\' && i + 1 < expression.length() && isEscapable(expression[i + 1]);
+    }
+
+    void parseText() {
+        const size_t begin = pos;
+        do {
+            pos += isEscapeAt(pos) ? 2 : 1;
+        } while (pos < expression.length() && !std::strchr(" {(/", expression[pos]));
+        segment.push_back({Token::TEXT, std::string_view(expression).substr(begin, pos - begin)});
+    }
+
+    void parseOptional() {
+        size_t closePos = pos + 1;
+        while (closePos < expression.length() && expression[closePos] != ')') {
+            closePos += isEscapeAt(closePos) ? 2 : 1;
+        }
+        if (closePos >= expression.length()) {
+            throw UnclosedOptionalException(
+                "Unclosed optional text: missing ')' at position " + std::to_string(pos)
+            );
         }
-        result += next;
-        pos += 2;
+        if (closePos == pos + 1) {
+            throw CucumberExpressionpressionException(
+                "Empty optional text is not allowed at position " + std::to_string(pos)
+            );
+        }
+        segment.push_back(
+            {Token::OPTIONAL, std::string_view(expression).substr(pos + 1, closePos - pos - 1)}
+        );
+        pos = closePos + 1;
     }
 
-    void parseOpenBrace(std::string& result) {
-        size_t closePos = expression.find('}', pos);
+    void parseParameter() {
+        const size_t closePos = expression.find('}', pos);
         if (closePos == std::string::npos) {
-            throw UnclosedParameterException("Unclosed parameter type: missing '}' at position " + 
-                                   std::to_string(pos));
+            throw UnclosedParameterException(
+                "Unclosed parameter type: missing '}' at position " + std::to_string(pos)
+            );
         }
 
-        std::string paramType = expression.substr(pos + 1, closePos - pos - 1);
-
-        // Validate and convert parameter type
-        if (getParameterTypes().find(paramType) == getParameterTypes().end()) {
-            throw UnknownParameterTypeException(paramType);
+        const std::string_view paramType =
+            std::string_view(expression).substr(pos + 1, closePos - pos - 1);
+        auto type = types->find(paramType);
+        if (type == types->end()) {
+            types = parameterTypesWithDefaultFile();
+            type = types->find(paramType);
+        }
+        if (type == types->end()) {
+            throw UnknownParameterTypeException(std::string(paramType));
         }
 
-        result += "(" + getParameterTypes().at(paramType) + ")";
+        if (parameters) {
+            parameters->push_back({type->first, groups});
+        }
+        const std::size_t typeGroups = 1 + countCaptureGroups(type->second.regexp);
+        addMatcherParameter(type->second, typeGroups);
+        groups += typeGroups;
+        result += '(';
+        result += type->second.regexp;
+        result += ')';
         pos = closePos + 1;
     }
 
-    void parseOpenParenthesis(std::string& result) {
-        size_t closePos = expression.find(')', pos);
-        if (closePos == std::string::npos) {
-            throw UnclosedOptionalException("Unclosed optional text: missing ')' at position " + 
-                                   std::to_string(pos));
+    void addMatcherText(const std::string& text) {
+        if (!matcherSegments.empty()
+            && matcherSegments.back().kind == CucumberExpressionMatcher::TEXT_SEGMENT) {
+            matcherSegments.back().texts.front() += text;
+        } else {
+            matcherSegments.push_back({CucumberExpressionMatcher::TEXT_SEGMENT, {text}, 0, nullptr});
         }
+    }
 
-        std::string optionalContent = expression.substr(pos + 1, closePos - pos - 1);
-
-        // Validate that optional content is not empty
-        if (optionalContent.empty()) {
-            throw CucumberExpressionpressionException("Empty optional text is not allowed at position " + 
-                                   std::to_string(pos));
+    void addMatcherParameter(const ParameterTypeDefinition& type, const std::size_t typeGroups) {
+        if (type.compiled) {
+            matcherSegments.push_back(
+                {CucumberExpressionMatcher::CUSTOM_SEGMENT, {}, typeGroups, type.compiled}
+            );
+            return;
+        }
+        const auto& kinds = matcherParameterKinds();
+        const auto kind = kinds.find(type.regexp);
+        if (kind == kinds.end()) {
+            matchable = false;
+        } else {
+            matcherSegments.push_back({kind->second, {}, typeGroups, nullptr});
         }
+    }
 
-        // Escape optional content
-        std::string escapedContent = escapeRegexChars(optionalContent);
-        result += "(?:" + escapedContent + ")?";
-        pos = closePos + 1;
+    /**
+     * Writes text to the regular expression and returns it unescaped
+     */
+    std::string appendLiteral(const std::string_view text) {
+        std::string unescaped;
+        unescaped.reserve(text.length());
+        for (size_t i = 0; i < text.length(); ++i) {
+            char c = text[i];
+            if (c == '\\' && i + 1 < text.length() && isEscapable(text[i + 1])) {
+                c = text[++i];
+            }
+            if (REGEX_SPECIAL_CHARACTERS[static_cast<unsigned char>(c)]) {
+                result += '\\';
+            }
+            result += c;
+            unescaped += c;
+        }
+        return unescaped;
     }
 
-    void parseAlternatives(std::string& result) {
-        // Check if this is a word-level alternative (not a literal escape)
-        // Backtrack to find the word before the slash
-        size_t wordEnd = pos;
-        while (wordEnd > 0 && result.back() != ' ' && result.back() != ')' && 
-                result.back() != ')') {
-            wordEnd--;
+    /**
+     * @param alternative receives the text of the tokens if they are an
+     *        alternative, as alternatives are plain text to the matcher
+     */
+    void appendTokens(
+        std::vector<Token>::const_iterator begin,
+        const std::vector<Token>::const_iterator end,
+        std::string* alternative = nullptr
+    ) {
+        for (; begin != end; ++begin) {
+            if (begin->kind == Token::OPTIONAL) {
+                result += "(?:";
+                const std::string text = appendLiteral(begin->text);
+                result += ")?";
+                if (alternative) {
+                    matchable = false;
+                } else {
+                    matcherSegments.push_back(
+                        {CucumberExpressionMatcher::OPTIONAL_SEGMENT, {text}, 0, nullptr}
+                    );
+                }
+            } else if (begin->kind == Token::TEXT) {
+                const std::string text = appendLiteral(begin->text);
+                if (alternative) {
+                    *alternative += text;
+                } else {
+                    addMatcherText(text);
+                }
+            }
         }
-        
-        // For now, handle slash by looking ahead to collect all alternatives
-        std::vector<std::string> alternatives = collectAlternativesFromHere(pos - 1);
-        
-        if (alternatives.size() > 1) {
-            // Remove the last word from result
-            if (size_t lastSpace = result.rfind(' '); lastSpace != std::string::npos) {
-                result = result.substr(0, lastSpace + 1);
-            } else {
-                result.clear();
+    }
+
+    /**
+     * Writes the tokens read since the last whitespace or parameter type.
+     * Empty alternatives are ignored, so a single remaining one is written
+     * as plain text.
+     */
+    void appendSegment() {
+        if (!segmentHasAlternation) {
+            appendTokens(segment.begin(), segment.end());
+        } else {
+            std::size_t alternatives = 0;
+            for (auto it = segment.cbegin(); it != segment.cend(); ++it) {
+                if (it->kind != Token::ALTERNATION
+                    && (it == segment.cbegin() || std::prev(it)->kind == Token::ALTERNATION)) {
+                    ++alternatives;
+                }
+            }
+            CucumberExpressionMatcher::Segment matcherSegment = {
+                CucumberExpressionMatcher::ALTERNATION_SEGMENT, {}, 0, nullptr
+            };
+            if (alternatives > 1) {
+                result += "(?:";
+            }
+            bool first = true;
+            auto alternativeBegin = segment.cbegin();
+            for (auto it = segment.cbegin();; ++it) {
+                if (it == segment.cend() || it->kind == Token::ALTERNATION) {
+                    if (alternativeBegin != it) {
+                        if (!first) {
+                            result += '|';
+                        }
+                        if (alternatives > 1) {
+                            matcherSegment.texts.emplace_back();
+                            appendTokens(alternativeBegin, it, &matcherSegment.texts.back());
+                        } else {
+                            appendTokens(alternativeBegin, it);
+                        }
+                        first = false;
+                    }
+                    if (it == segment.cend()) {
+                        break;
+                    }
+                    alternativeBegin = std::next(it);
+                }
             }
-            
-            // Add alternatives group
-            result += "(?:";
-            for (size_t i = 0; i < alternatives.size(); ++i) {
-                if (i > 0) result += "|";
-                result += parseAlternativeText(alternatives[i]);
+            if (alternatives > 1) {
+                result += ')';
+                matcherSegments.push_back(std::move(matcherSegment));
             }
-            result += ")";
         }
+        segment.clear();
+        segmentHasAlternation = false;
     }
 };
 
-std::string cukex::transform(const std::string& expression) {
+namespace {
+
+/**
+ * Result of converting an expression, which only changes with the parameter
+ * types it was converted with
+ */
+struct Transform {
+    std::string regex;
+    std::vector<CucumberExpressionParameter> parameters;
+    std::shared_ptr<const CucumberExpressionMatcher> matcher;
+    std::shared_ptr<const parameter_types_type> parameterTypes;
+    // Whether the regular expression is known to compile
+    bool validated;
+};
+
+/**
+ * @param transform receives everything but the regular expression, which
+ *        is returned
+ */
+std::string toRegexString(const std::string& expression, Transform* transform = nullptr) {
     if (expression.empty()) {
         throw EmptyExpressionException();
     }
@@ -473,23 +662,383 @@ std::string cukex::transform(const std::string& expression) {
         throw UnclosedOptionalException("Unclosed optional text: unmatched parentheses");
     }
     
-    // Preprocess to convert alternatives
-    std::string processedExpression = expression;
-    
     // Parse and convert
     try {
-        CucumberExpressionpressionParser parser(processedExpression);
+        CucumberExpressionpressionParser parser(
+            expression, transform ? &transform->parameters : nullptr
+        );
         std::string regex = parser.parse();
-        
-        // Add anchors to ensure full match
-        regex = "^" + regex + "$";
-
-        // Validate that the result is a valid regex by trying to compile it. If invalid, throw exception.
-        validateRegex(regex);
+        if (transform) {
+            transform->matcher = parser.matcher();
+            transform->parameterTypes = parser.parameterTypes();
+        }
         return regex;
     } catch (const std::exception& e) {
         throw CucumberExpressionpressionException(std::string("Invalid Cucumber expression: ") + e.what());
     }
 }
 
+/**
+ * Expressions converted so far, shared by every thread registering steps.
+ * Invalid expressions are not kept: they throw again on every call. Steps
+ * are registered during static initialization, hence the accessor.
+ */
+std::map<std::string, Transform, std::less<>>& transforms() {
+    static std::map<std::string, Transform, std::less<>> transforms;
+    return transforms;
+}
+
+std::mutex& transformsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+Transform cachedTransform(const std::string& expression) {
+    const std::shared_ptr<const parameter_types_type> types = currentParameterTypes();
+    {
+        std::lock_guard<std::mutex> lock(transformsMutex());
+        const auto cached = transforms().find(expression);
+        // Parameter types changing while the entry was made leave it stale
+        if (cached != transforms().end() && cached->second.parameterTypes == types) {
+            return cached->second;
+        }
+    }
+    // Converted without the lock held; threads racing on the same expression get the same result
+    Transform transform = {
+        std::string(), std::vector<CucumberExpressionParameter>(), nullptr, nullptr, false
+    };
+    {
+        const ScopedStartupTiming timing(STARTUP_TRANSFORM, expression);
+        transform.regex = toRegexString(expression, &transform);
+    }
+    std::lock_guard<std::mutex> lock(transformsMutex());
+    return transforms()[expression] = transform;
+}
+
+void clearTransforms() {
+    std::lock_guard<std::mutex> lock(transformsMutex());
+    transforms().clear();
+}
+
+void setParameterTypes(std::shared_ptr<const parameter_types_type> types) {
+    {
+        std::lock_guard<std::mutex> lock(parameterTypesMutex());
+        parameterTypes().types = std::move(types);
+        parameterTypes().customTypesSet = true;
+    }
+    clearTransforms();
+}
+
+void markValidated(const std::string& expression) {
+    std::lock_guard<std::mutex> lock(transformsMutex());
+    const auto cached = transforms().find(expression);
+    if (cached != transforms().end()) {
+        cached->second.validated = true;
+    }
+}
+} // anonymous namespace
+
+std::string cukex::transform(const std::string& expression) {
+    const Transform transform = cachedTransform(expression);
+    if (!transform.validated) {
+        // Validate that the result is a valid regex by trying to compile it. If invalid, throw exception.
+        compileRegex(transform.regex);
+        markValidated(expression);
+    }
+    return transform.regex;
+}
+
+std::string cukex::transformUnchecked(const std::string& expression) {
+    return cachedTransform(expression).regex;
+}
+
+Regex cukex::compile(const std::string& expression) {
+    Regex regex = compileRegex(cachedTransform(expression).regex);
+    markValidated(expression);
+    return regex;
+}
+
+std::vector<CucumberExpressionParameter> cukex::parameters(const std::string& expression) {
+    return cachedTransform(expression).parameters;
+}
+
+std::shared_ptr<const CucumberExpressionMatcher> cukex::matcher(const std::string& expression) {
+    return cachedTransform(expression).matcher;
+}
+
+void ParameterTypeRegistry::define(const std::string& name, const std::string& regexp) {
+    if (getBuiltInParameterTypes().count(name)) {
+        throw CucumberExpressionpressionException("Parameter type {" + name + "} is built in");
+    }
+    const ParameterTypeDefinition type = compileParameterType(name, regexp);
+    {
+        std::lock_guard<std::mutex> lock(parameterTypesMutex());
+        auto types = std::make_shared<parameter_types_type>(*lockedParameterTypes());
+        (*types)[name] = type;
+        parameterTypes().types = std::move(types);
+        parameterTypes().customTypesSet = true;
+    }
+    removeParameterTransformers(&name);
+    clearTransforms();
+}
+
+void ParameterTypeRegistry::defineTransformer(
+    const std::string& name, std::type_index type, transformer_type transformer
+) {
+    ParameterTransformers& transformers = parameterTransformers();
+    std::lock_guard<std::mutex> lock(transformers.mutex);
+    transformers.byName.erase(name);
+    transformers.byName.emplace(name, ParameterTransformer{type, std::move(transformer), {}});
+    transformers.any = true;
+}
+
+std::shared_ptr<const void> ParameterTypeRegistry::transformed(
+    std::type_index type, const std::string& text
+) {
+    ParameterTransformers& transformers = parameterTransformers();
+    if (!transformers.any) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(transformers.mutex);
+    for (auto transformer = transformers.byName.begin(); transformer != transformers.byName.end();
+         ++transformer) {
+        if (transformer->second.type == type) {
+            return transformText(transformer, text, lock);
+        }
+    }
+    return nullptr;
+}
+
+void ParameterTypeRegistry::transformMatched(const std::string& name, const std::string& text) {
+    ParameterTransformers& transformers = parameterTransformers();
+    if (!transformers.any) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(transformers.mutex);
+    const auto transformer = transformers.byName.find(name);
+    if (transformer == transformers.byName.end()) {
+        return;
+    }
+    try {
+        transformText(transformer, text, lock);
+    } catch (...) {
+        // Thrown again to the step reading the parameter
+    }
+}
+
+void ParameterTypeRegistry::load(const std::string& path) {
+    auto types = std::make_shared<parameter_types_type>(*builtInParameterTypes());
+    const parameter_types_type custom = readParameterTypes(path, false);
+    types->insert(custom.begin(), custom.end());
+    setParameterTypes(std::move(types));
+    removeParameterTransformers(nullptr);
+}
+
+bool ParameterTypeRegistry::isBuiltIn(const std::string& name) {
+    return getBuiltInParameterTypes().count(name) != 0;
+}
+
+void ParameterTypeRegistry::clear() {
+    {
+        std::lock_guard<std::mutex> lock(parameterTypesMutex());
+        parameterTypes().types = builtInParameterTypes();
+        parameterTypes().customTypesSet = false;
+    }
+    removeParameterTransformers(nullptr);
+    clearTransforms();
+}
+
+namespace {
+
+bool isDigit(const char c) {
+    return c >= '0' && c <= '9';
+}
+
+bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t';
+}
+
+bool hasTextAt(const std::string& text, const std::size_t pos, const std::string& expected) {
+    return text.size() - pos >= expected.size()
+           && std::memcmp(text.data() + pos, expected.data(), expected.size()) == 0;
+}
+
+const RegexSubmatchSpan UNMATCHED = {std::string::npos, std::string::npos};
+
+class CucumberExpressionMatch : public RegexMatch {
+public:
+    CucumberExpressionMatch(const CucumberExpressionMatcher& matcher, const std::string& text) {
+        std::vector<RegexSubmatchSpan> spans;
+        regexMatched = matcher.find(text, spans);
+        for (const RegexSubmatchSpan& span : spans) {
+            if (span.matched()) {
+                addSubmatch(text, span.begin, span.end);
+            } else {
+                addUnmatchedSubmatch();
+            }
+        }
+    }
+};
+} // anonymous namespace
+
+CucumberExpressionMatcher::CucumberExpressionMatcher(segments_type segments) :
+    segments(std::move(segments)),
+    groups(0) {
+    for (const Segment& segment : this->segments) {
+        groups += segment.groups;
+    }
+}
+
+bool CucumberExpressionMatcher::handles(const std::string& text) {
+    return text.find_first_of("\n\r\v\f") == std::string::npos;
+}
+
+const CucumberExpressionMatcher::segments_type& CucumberExpressionMatcher::getSegments() const {
+    return segments;
+}
+
+std::shared_ptr<RegexMatch> CucumberExpressionMatcher::find(const std::string& text) const {
+    return std::make_shared<CucumberExpressionMatch>(*this, text);
+}
+
+bool CucumberExpressionMatcher::find(
+    const std::string& text, std::vector<RegexSubmatchSpan>& submatches
+) const {
+    submatches.assign(groups, UNMATCHED);
+    if (!matchFrom(0, 0, 0, text, submatches)) {
+        submatches.clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Backtracks in the order a regular expression engine would, trying the
+ * longest parameter first and optional text before its absence, so that
+ * the first match found is the one the regular expression gives.
+ */
+bool CucumberExpressionMatcher::matchFrom(
+    const segments_type::size_type segment,
+    const std::size_t pos,
+    const std::size_t group,
+    const std::string& text,
+    std::vector<RegexSubmatchSpan>& submatches
+) const {
+    if (segment == segments.size()) {
+        return pos == text.size();
+    }
+    const Segment& current = segments[segment];
+    const segments_type::size_type next = segment + 1;
+    switch (current.kind) {
+    case TEXT_SEGMENT:
+        return hasTextAt(text, pos, current.texts.front())
+               && matchFrom(next, pos + current.texts.front().size(), group, text, submatches);
+    case OPTIONAL_SEGMENT:
+        return (hasTextAt(text, pos, current.texts.front())
+                && matchFrom(next, pos + current.texts.front().size(), group, text, submatches))
+               || matchFrom(next, pos, group, text, submatches);
+    case ALTERNATION_SEGMENT:
+        for (const std::string& alternative : current.texts) {
+            if (hasTextAt(text, pos, alternative)
+                && matchFrom(next, pos + alternative.size(), group, text, submatches)) {
+                return true;
+            }
+        }
+        return false;
+    case STRING_SEGMENT: {
+        if (pos == text.size() || (text[pos] != '"' && text[pos] != '\'')) {
+            return false;
+        }
+        const char quote = text[pos];
+        std::size_t end = pos + 1;
+        std::size_t lastEscape = std::string::npos;
+        while (end < text.size() && text[end] != quote) {
+            if (text[end] == '\\') {
+                if (end + 1 == text.size()) {
+                    return false;
+                }
+                lastEscape = end++;
+            }
+            ++end;
+        }
+        if (end == text.size()) {
+            return false;
+        }
+        const std::size_t inner = group + (quote == '"' ? 1 : 3);
+        submatches[group] = {pos, end + 1};
+        submatches[inner] = {pos + 1, end};
+        submatches[inner + 1] = (lastEscape != std::string::npos)
+                                    ? RegexSubmatchSpan{lastEscape, end}
+                                    : UNMATCHED;
+        if (matchFrom(next, end + 1, group + current.groups, text, submatches)) {
+            return true;
+        }
+        submatches[group] = submatches[inner] = submatches[inner + 1] = UNMATCHED;
+        return false;
+    }
+    case CUSTOM_SEGMENT: {
+        std::vector<RegexSubmatchSpan> typeSubmatches;
+        for (std::size_t end = text.size();; --end) {
+            if (current.regex->find(text.substr(pos, end - pos), typeSubmatches)) {
+                submatches[group] = {pos, end};
+                for (std::size_t i = 0; i < typeSubmatches.size() && i + 1 < current.groups; ++i) {
+                    submatches[group + 1 + i] = typeSubmatches[i].matched()
+                                                    ? RegexSubmatchSpan{
+                                                          pos + typeSubmatches[i].begin,
+                                                          pos + typeSubmatches[i].end
+                                                      }
+                                                    : UNMATCHED;
+                }
+                if (matchFrom(next, end, group + current.groups, text, submatches)) {
+                    return true;
+                }
+            }
+            if (end == pos) {
+                break;
+            }
+        }
+        std::fill_n(submatches.begin() + group, current.groups, UNMATCHED);
+        return false;
+    }
+    default:
+        break;
+    }
+
+    // Parameters matching a run of characters, tried from the longest
+    std::size_t shortest = pos;
+    std::size_t end = pos;
+    if (current.kind == INTEGER_SEGMENT || current.kind == DIGITS_SEGMENT) {
+        const bool sign =
+            current.kind == INTEGER_SEGMENT && pos < text.size() && text[pos] == '-';
+        shortest = end = sign ? pos + 1 : pos;
+        while (end < text.size() && isDigit(text[end])) {
+            ++end;
+        }
+        ++shortest;
+    } else if (current.kind == WORD_SEGMENT) {
+        while (end < text.size() && !isWhitespace(text[end])) {
+            ++end;
+        }
+        ++shortest;
+    } else if (current.kind == EXCLUDING_SEGMENT) {
+        while (end < text.size()
+               && current.texts.front().find(text[end]) == std::string::npos) {
+            ++end;
+        }
+    } else {
+        end = text.size();
+    }
+    for (; end >= shortest; --end) {
+        submatches[group] = {pos, end};
+        if (matchFrom(next, end, group + 1, text, submatches)) {
+            return true;
+        }
+        if (end == shortest) {
+            break;
+        }
+    }
+    submatches[group] = UNMATCHED;
+    return false;
+}
+
 } // namespace cucumber::internal
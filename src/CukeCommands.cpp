@@ -1,89 +1,477 @@
 #include "cucumber-cpp/internal/CukeCommands.hpp"
+#include "cucumber-cpp/internal/Timings.hpp"
+#include "cucumber-cpp/internal/TraceRecorder.hpp"
 #include "cucumber-cpp/internal/hook/HookRegistrar.hpp"
 
+#include <atomic>
+#include <cctype>
+#include <exception>
+#include <mutex>
 #include <sstream>
 
 namespace cucumber {
 namespace internal {
 
-std::shared_ptr<Scenario> CukeCommands::currentScenario;
+namespace {
+/**
+ * Sessions that have begun a scenario and are not yet destroyed. BeforeAll
+ * hooks run when the first one starts and AfterAll hooks when the last one
+ * ends, so concurrent wire sessions share a single test run.
+ */
+std::size_t startedSessions = 0;
+
+std::mutex& startedSessionsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/** Scenarios begun and not yet ended, across sessions */
+std::atomic<std::size_t> scenariosRunning(0);
+
+typedef std::chrono::steady_clock clock_type;
+
+/**
+ * Escapes characters with a backslash in a single pass, looking them up in
+ * a table built at compile time
+ */
+class BackslashEscaper {
+public:
+    constexpr explicit BackslashEscaper(const char* escaped) :
+        escapes() {
+        for (; *escaped != '\0'; ++escaped) {
+            escapes[static_cast<unsigned char>(*escaped)] = true;
+        }
+    }
+
+    std::string operator()(const std::string& text) const {
+        std::string escaped;
+        escaped.reserve(text.size() + 8);
+        for (const char c : text) {
+            if (escapes[static_cast<unsigned char>(c)]) {
+                escaped.push_back('\\');
+            }
+            escaped.push_back(c);
+        }
+        return escaped;
+    }
+
+private:
+    bool escapes[256];
+};
+
+constexpr BackslashEscaper regexEscaper("|()[]{}^$*+?.\\");
+constexpr BackslashEscaper cStringEscaper("\"\\");
+
+std::string describeTimeout(
+    const char* what,
+    const clock_type::duration elapsed,
+    const ScenarioTimeouts::duration_type budget
+) {
+    std::ostringstream description;
+    description << what << " timed out after "
+                << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+                << " ms, its budget being " << budget.count() << " ms";
+    return description.str();
+}
+
+/**
+ * Everything a step run within a budget uses, kept alive by the step
+ */
+struct TimedInvocation {
+    std::shared_ptr<ScenarioContexts> contexts;
+    HookRegistrar::aroundhook_chain_type aroundStep;
+    HookRegistrar::hook_chain_type afterStep;
+    StepBenchmark benchmark;
+    const StepInfo* stepInfo;
+    std::shared_ptr<const InvokeArgs> args;
+    InvokeResult result;
+};
+
+/**
+ * Makes the session current again before running the tasks of its
+ * asynchronous step
+ */
+class SessionExecutor : public StepExecutor {
+public:
+    SessionExecutor(StepExecutor& executor, std::function<void()> makeCurrent) :
+        executor(executor),
+        makeCurrent(std::move(makeCurrent)) {
+    }
+
+    void post(task_type task) override {
+        executor.post([makeCurrent = makeCurrent, task = std::move(task)] {
+            makeCurrent();
+            task();
+        });
+    }
+
+private:
+    StepExecutor& executor;
+    const std::function<void()> makeCurrent;
+};
+}
 
 CukeCommands::CukeCommands() :
-    hasStarted(false) {
+    contexts(std::make_shared<ScenarioContexts>()),
+    hasStarted(false),
+    featureBoundariesKnown(false),
+    stepAbandoned(false) {
 }
 
 CukeCommands::~CukeCommands() {
+    makeCurrent();
+    if (currentScenario) {
+        --scenariosRunning;
+    }
     if (hasStarted) {
-        HookRegistrar::execAfterAllHooks();
+        std::lock_guard<std::mutex> lock(startedSessionsMutex());
+        if (--startedSessions == 0) {
+            HookRegistrar::execAfterAllHooks();
+            ScenarioContexts::purgeRun();
+        }
     }
 }
 
+void CukeCommands::beginFeature(const std::string& name) {
+    featureBoundariesKnown = true;
+    if (name != currentFeature) {
+        makeCurrent();
+        contexts->purgeFeature();
+        backgroundSnapshots.clear();
+        idempotentResults.clear();
+        currentFeature = name;
+    }
+}
+
+bool CukeCommands::snapshotBackground(const std::string& key) {
+    const auto inserted = backgroundSnapshots.emplace(key, nullptr);
+    if (!inserted.second || stepAbandoned) {
+        return false;
+    }
+    inserted.first->second = contexts->snapshot();
+    return inserted.first->second != nullptr;
+}
+
+bool CukeCommands::restoreBackground(const std::string& key) {
+    const auto snapshot = backgroundSnapshots.find(key);
+    if (snapshot == backgroundSnapshots.end() || !snapshot->second) {
+        return false;
+    }
+    makeCurrent();
+    return contexts->restore(*snapshot->second);
+}
+
+void CukeCommands::continueTrace(const std::string& traceParent) {
+    remoteParent = TraceContext::parse(traceParent);
+}
+
 void CukeCommands::beginScenario(const TagExpression::tag_list& tags) {
+    makeCurrent();
     if (!hasStarted) {
         hasStarted = true;
-        HookRegistrar::execBeforeAllHooks();
+        std::lock_guard<std::mutex> lock(startedSessionsMutex());
+        if (startedSessions++ == 0) {
+            HookRegistrar::execBeforeAllHooks();
+        }
     }
 
+    if (!currentScenario) {
+        ++scenariosRunning;
+    }
     currentScenario = std::make_shared<Scenario>(tags);
-    HookRegistrar::execBeforeHooks(currentScenario.get());
+    scenarioHooks = HookRegistrar::resolveHooks(currentScenario.get());
+    timeouts = ScenarioTimeouts::fromTags(tags);
+    benchmark = StepBenchmark::fromTags(tags);
+    scenarioStart = clock_type::now();
+    if (Timings::isTrackingAllocations()) {
+        scenarioAllocations = AllocationTracking::sample();
+    }
+    if (Telemetry::isEnabled()) {
+        scenarioSpan = Telemetry::startSpan("scenario", remoteParent ? &*remoteParent : nullptr);
+        if (!currentFeature.empty()) {
+            scenarioSpan->attributes.emplace_back("cucumber.feature", currentFeature);
+        }
+        for (const std::string& tag : tags) {
+            scenarioSpan->attributes.emplace_back("cucumber.tag", tag);
+        }
+    }
+    remoteParent.reset();
+    const ScopedTraceEvent trace("before", "Before hooks");
+    HookRegistrar::execHookChain(scenarioHooks.before);
 }
 
 void CukeCommands::endScenario() {
-    HookRegistrar::execAfterHooks(currentScenario.get());
-    contextManager.purgeContexts();
-    currentScenario.reset();
+    makeCurrent();
+    {
+        const ScopedTraceEvent trace("after", "After hooks");
+        HookRegistrar::execHookChain(currentHooks().after);
+    }
+    if (stepAbandoned) {
+        // Left to the step still running, which may use them
+        std::shared_ptr<ScenarioContexts> fresh = std::make_shared<ScenarioContexts>();
+        fresh->shareFeatureContexts(*contexts);
+        contexts = fresh;
+        contexts->makeCurrent();
+        stepAbandoned = false;
+    } else {
+        contexts->purge();
+    }
+    if (!featureBoundariesKnown) {
+        // The next scenario may be of another feature
+        idempotentResults.clear();
+    }
+    if (TraceRecorder::isEnabled()) {
+        std::string name = "scenario";
+        if (currentScenario) {
+            for (const std::string& tag : currentScenario->getTags()) {
+                name += ' ' + tag;
+            }
+        }
+        TraceRecorder::record("scenario", name, currentFeature, scenarioStart, clock_type::now());
+    }
+    if (currentScenario) {
+        --scenariosRunning;
+        currentScenario.reset();
+    }
+    scenarioHooks = ScenarioHooks();
+    timeouts = ScenarioTimeouts();
+    benchmark = StepBenchmark();
+    if (scenarioAllocations) {
+        Timings::recordScenarioAllocations(*scenarioAllocations);
+        scenarioAllocations.reset();
+    }
+    if (scenarioSpan) {
+        Telemetry::endSpan(*scenarioSpan);
+        scenarioSpan.reset();
+    }
+}
+
+std::size_t CukeCommands::runningScenarios() {
+    return scenariosRunning.load();
+}
+
+void CukeCommands::makeCurrent() {
+    contexts->makeCurrent();
+    timeouts.makeCurrent();
+    benchmark.makeCurrent();
+}
+
+const ScenarioHooks& CukeCommands::currentHooks() {
+    if (!currentScenario) {
+        // Outside of a scenario no tags are checked, so every hook applies
+        scenarioHooks = HookRegistrar::resolveHooks(NULL);
+    }
+    return scenarioHooks;
 }
 
 const std::string CukeCommands::snippetText(
     const std::string stepKeyword, const std::string stepName, const std::string multilineArgClass
 ) const {
-    std::stringstream text;
-    std::string stepKeywordUpperCase;
-    std::transform(
-        stepKeyword.begin(), stepKeyword.end(), std::back_inserter(stepKeywordUpperCase), ::toupper
-    );
-    std::string multilineArgComment;
+    std::string text;
+    text.reserve(stepKeyword.size() + 2 * stepName.size() + 64);
+    for (const char c : stepKeyword) {
+        text.push_back(static_cast<char>(::toupper(static_cast<unsigned char>(c))));
+    }
+    text += "(\"";
+    text += escapeCString("^" + escapeRegex(stepName) + "$");
+    text += "\") {\n";
     if (multilineArgClass == "DataTable") {
-        multilineArgComment = "    TABLE_PARAM(data_table);\n";
+        text += "    TABLE_PARAM(data_table);\n";
     } else if (multilineArgClass == "DocString") {
-        multilineArgComment = "    REGEX_PARAM(std::string, doc_string);\n";
+        text += "    REGEX_PARAM(std::string, doc_string);\n";
     }
-    text << stepKeywordUpperCase << "(\"" << escapeCString("^" + escapeRegex(stepName) + "$")
-         << "\") {\n"
-         << multilineArgComment
-         << "    pending();\n"
-         << "}\n";
-    return text.str();
+    text += "    pending();\n"
+            "}\n";
+    return text;
 }
 
 const std::string CukeCommands::escapeRegex(const std::string reg) const {
-    return regex_replace(
-        reg,
-        std::regex("[\\|\\(\\)\\[\\]\\{\\}\\^\\$\\*\\+\\?\\.\\\\]"),
-        "\\\\&",
-        std::regex_constants::match_default | std::regex_constants::format_sed
-    );
+    return regexEscaper(reg);
 }
 
 const std::string CukeCommands::escapeCString(const std::string str) const {
-    return regex_replace(
-        str,
-        std::regex("[\"\\\\]"),
-        "\\\\&",
-        std::regex_constants::match_default | std::regex_constants::format_sed
-    );
+    return cStringEscaper(str);
 }
 
 MatchResult CukeCommands::stepMatches(const std::string description) const {
     return StepManager::stepMatches(description);
 }
 
+std::vector<MatchResult> CukeCommands::outlineStepMatches(
+    const std::string& templateText, const std::vector<std::string>& descriptions
+) const {
+    return StepManager::outlineStepMatches(templateText, descriptions);
+}
+
 InvokeResult CukeCommands::invoke(step_id_type id, const InvokeArgs* pArgs) {
+    return invoke(id, pArgs, nullptr);
+}
+
+InvokeResult CukeCommands::invoke(step_id_type id, std::shared_ptr<const InvokeArgs> args) {
+    return invoke(id, args.get(), args);
+}
+
+InvokeResult CukeCommands::invoke(
+    step_id_type id, const InvokeArgs* pArgs, const std::shared_ptr<const InvokeArgs>& sharedArgs
+) {
+    const ScopedTiming timing(TIMED_INVOKE, id);
+    const ScopedAllocations allocations(id);
+    makeCurrent();
     const StepInfo* const stepInfo = StepManager::getStep(id);
-    InvokeResult result = HookRegistrar::execStepChain(currentScenario.get(), stepInfo, pArgs);
-    HookRegistrar::execAfterStepHooks(currentScenario.get());
+    const ScopedTraceEvent trace(
+        "invoke",
+        stepInfo ? stepInfo->stepDef : std::string_view("unknown step"),
+        stepInfo ? stepInfo->source : std::string_view()
+    );
+    std::optional<ScopedSpan> span;
+    if (scenarioSpan) {
+        span.emplace(stepInfo ? std::string(stepInfo->stepDef) : "step", scenarioSpan->context);
+        if (stepInfo) {
+            span->setAttribute("code.source", std::string(stepInfo->source));
+        }
+    }
+    const ScenarioHooks& hooks = currentHooks();
+    const auto memoized = (pArgs && !benchmark.isEnabled()) ? idempotentResults.find(id)
+                                                            : idempotentResults.end();
+    if (memoized != idempotentResults.end()) {
+        const auto result = memoized->second.find(pArgs->fingerprint());
+        if (result != memoized->second.end()) {
+            const ScopedTraceEvent afterStepTrace("after_step", "AfterStep hooks");
+            HookRegistrar::execHookChain(hooks.afterStep);
+            return result->second;
+        }
+    }
+    if (timeouts.step.count() > 0 || timeouts.scenario.count() > 0) {
+        InvokeResult result = invokeWithinBudget(stepInfo, hooks, pArgs, sharedArgs);
+        if (span && result.getType() == FAILURE) {
+            span->fail(result.getDescription());
+        }
+        rememberIdempotent(id, pArgs, result);
+        return result;
+    }
+    InvokeResult result;
+    {
+        // Around hooks wrap the step, their event spans both
+        std::optional<ScopedTraceEvent> aroundTrace;
+        if (!hooks.aroundStep.empty()) {
+            aroundTrace.emplace("around", "Around hooks");
+        }
+        result = HookRegistrar::execStepChain(hooks.aroundStep, stepInfo, pArgs);
+    }
+    if (span && result.getType() == FAILURE) {
+        span->fail(result.getDescription());
+    }
+    rememberIdempotent(id, pArgs, result);
+    const ScopedTraceEvent afterStepTrace("after_step", "AfterStep hooks");
+    HookRegistrar::execHookChain(hooks.afterStep);
     return result;
 }
 
+void CukeCommands::rememberIdempotent(
+    step_id_type id, const InvokeArgs* pArgs, const InvokeResult& result
+) {
+    if (result.isIdempotent() && pArgs && !benchmark.isEnabled()) {
+        idempotentResults[id].emplace(pArgs->fingerprint(), result);
+    }
+}
+
+void CukeCommands::invokeAsync(
+    step_id_type id,
+    std::shared_ptr<const InvokeArgs> args,
+    StepExecutor& executor,
+    invoke_callback_type done
+) {
+    makeCurrent();
+    const StepInfo* const stepInfo = StepManager::getStep(id);
+    const ScenarioHooks& hooks = currentHooks();
+    if (!stepInfo || !stepInfo->isAsync() || !hooks.aroundStep.empty()
+        || timeouts.step.count() > 0 || timeouts.scenario.count() > 0 || benchmark.isEnabled()) {
+        done(invoke(id, args.get()));
+        return;
+    }
+
+    // Both kept alive by the callback until the step completes
+    const std::shared_ptr<StepExecutor> sessionExecutor =
+        std::make_shared<SessionExecutor>(executor, [this] {
+            makeCurrent();
+        });
+    stepInfo->invokeStepAsync(
+        args.get(),
+        *sessionExecutor,
+        [this, args, sessionExecutor, afterStep = hooks.afterStep, done = std::move(done)](
+            const InvokeResult& result
+        ) {
+            makeCurrent();
+            try {
+                HookRegistrar::execHookChain(afterStep);
+            } catch (const std::exception& e) {
+                done(InvokeResult::failure(e.what()));
+                return;
+            } catch (...) {
+                done(InvokeResult::failure("Unknown exception"));
+                return;
+            }
+            done(result);
+        }
+    );
+}
+
+InvokeResult CukeCommands::invokeWithinBudget(
+    const StepInfo* stepInfo,
+    const ScenarioHooks& hooks,
+    const InvokeArgs* pArgs,
+    const std::shared_ptr<const InvokeArgs>& sharedArgs
+) {
+    const clock_type::time_point start = clock_type::now();
+    clock_type::duration budget = timeouts.step;
+    bool scenarioBudget = false;
+    if (timeouts.scenario.count() > 0) {
+        const clock_type::duration left = scenarioStart + timeouts.scenario - start;
+        if (left <= clock_type::duration::zero()) {
+            return InvokeResult::failure(
+                describeTimeout("Scenario", start - scenarioStart, timeouts.scenario)
+            );
+        }
+        if (budget == clock_type::duration::zero() || left < budget) {
+            budget = left;
+            scenarioBudget = true;
+        }
+    }
+
+    const std::shared_ptr<TimedInvocation> invocation = std::make_shared<TimedInvocation>();
+    invocation->contexts = contexts;
+    invocation->aroundStep = hooks.aroundStep;
+    invocation->afterStep = hooks.afterStep;
+    invocation->benchmark = benchmark;
+    invocation->stepInfo = stepInfo;
+    // The step may outlive the args it was given unless they are shared
+    invocation->args = sharedArgs;
+    if (pArgs && !sharedArgs) {
+        invocation->args = std::make_shared<const InvokeArgs>(*pArgs);
+    }
+    const bool completed = stepRunner.run(
+        [invocation] {
+            invocation->contexts->makeCurrent();
+            invocation->benchmark.makeCurrent();
+            invocation->result = HookRegistrar::execStepChain(
+                invocation->aroundStep,
+                invocation->stepInfo,
+                invocation->args.get()
+            );
+            HookRegistrar::execHookChain(invocation->afterStep);
+        },
+        budget
+    );
+    if (completed) {
+        return invocation->result;
+    }
+    stepAbandoned = true;
+    const clock_type::time_point end = clock_type::now();
+    return InvokeResult::failure(
+        scenarioBudget ? describeTimeout("Scenario", end - scenarioStart, timeouts.scenario)
+                       : describeTimeout("Step", end - start, timeouts.step)
+    );
+}
+
 }
 }
@@ -11,6 +11,11 @@ InvokeException::InvokeException(const InvokeException& rhs) :
     message(rhs.message) {
 }
 
+InvokeException& InvokeException::operator=(const InvokeException& rhs) {
+    message = rhs.message;
+    return *this;
+}
+
 const std::string InvokeException::getMessage() const {
     return message;
 }
@@ -27,6 +32,12 @@ InvokeFailureException::InvokeFailureException(const InvokeFailureException& rhs
     exceptionType(rhs.exceptionType) {
 }
 
+InvokeFailureException& InvokeFailureException::operator=(const InvokeFailureException& rhs) {
+    InvokeException::operator=(rhs);
+    exceptionType = rhs.exceptionType;
+    return *this;
+}
+
 const std::string InvokeFailureException::getExceptionType() const {
     return exceptionType;
 }
@@ -39,6 +50,11 @@ PendingStepException::PendingStepException(const PendingStepException& rhs) :
     InvokeException(rhs) {
 }
 
+PendingStepException& PendingStepException::operator=(const PendingStepException& rhs) {
+    InvokeException::operator=(rhs);
+    return *this;
+}
+
 CukeEngine::CukeEngine() {
 }
 
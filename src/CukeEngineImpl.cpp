@@ -1,27 +1,30 @@
 #include "cucumber-cpp/internal/CukeEngineImpl.hpp"
 
+#include <charconv>
+#include <limits>
+
 namespace cucumber {
 namespace internal {
 
 namespace {
 
 std::string convertId(step_id_type id) {
-    std::stringstream ss;
-    ss << id;
-    return ss.str();
+    char buffer[std::numeric_limits<step_id_type>::digits10 + 1];
+    const std::to_chars_result converted = std::to_chars(buffer, buffer + sizeof(buffer), id);
+    return std::string(buffer, converted.ptr);
 }
 
+/**
+ * Ids that are no number map to 0, which no step has
+ */
 step_id_type convertId(const std::string& stringid) {
-    std::stringstream ss(stringid);
-    step_id_type id;
-    ss >> id;
+    step_id_type id = 0;
+    std::from_chars(stringid.data(), stringid.data() + stringid.size(), id);
     return id;
 }
-}
 
-std::vector<StepMatch> CukeEngineImpl::stepMatches(const std::string& name) const {
+std::vector<StepMatch> convertMatches(const MatchResult& commandResult) {
     std::vector<StepMatch> engineResult;
-    MatchResult commandResult = cukeCommands.stepMatches(name);
     for (const SingleStepMatch& commandMatch : commandResult.getResultSet()) {
         StepMatch engineMatch;
         engineMatch.id = convertId(commandMatch.stepInfo->id);
@@ -33,59 +36,180 @@ std::vector<StepMatch> CukeEngineImpl::stepMatches(const std::string& name) cons
             engineMatchArg.position = commandMatchArg.position;
             engineMatch.args.push_back(engineMatchArg);
         }
+        // Typed custom parameters are converted ahead of the invocation
+        for (const CucumberExpressionParameter& parameter : commandMatch.stepInfo->parameters) {
+            if (parameter.group < commandMatch.submatches.size()) {
+                ParameterTypeRegistry::transformMatched(
+                    parameter.type, commandMatch.submatches[parameter.group].value
+                );
+            }
+        }
         engineResult.push_back(engineMatch);
     }
     return engineResult;
 }
 
-void CukeEngineImpl::beginScenario(const tags_type& tags) {
-    cukeCommands.beginScenario(tags);
-}
-
-void CukeEngineImpl::invokeStep(
-    const std::string& id, const invoke_args_type& args, const invoke_table_type& tableArg
+InvokeArgs convertArgs(
+    CukeEngine::invoke_args_type&& args, CukeEngine::invoke_table_type&& tableArg
 ) {
     InvokeArgs commandArgs;
     try {
-        for (const std::string& a : args) {
-            commandArgs.addArg(a);
+        for (std::string& a : args) {
+            commandArgs.addArg(std::move(a));
         }
 
         if (!tableArg.empty() && !tableArg.front().empty()) {
-            Table& commandTableArg = commandArgs.getVariableTableArg();
-            for (const auto& arg : tableArg[0]) {
-                commandTableArg.addColumn(arg);
-            }
-
-            for (std::size_t i = 1; i < tableArg.size(); ++i) {
-                Table::row_type row;
-                for (const auto& arg : tableArg[i]) {
-                    row.push_back(arg);
-                }
-                commandTableArg.addRow(row);
-            }
+            commandArgs.setTableArg(std::move(tableArg));
         }
     } catch (...) {
         throw InvokeException("Unable to decode arguments");
     }
+    return commandArgs;
+}
 
-    InvokeResult commandResult;
-    try {
-        commandResult = cukeCommands.invoke(convertId(id), &commandArgs);
-    } catch (...) {
-        throw InvokeException("Uncatched exception");
-    }
+CukeEngine::invoke_result_type convertResult(const InvokeResult& commandResult) {
     switch (commandResult.getType()) {
     case SUCCESS:
-        return;
+        break;
     case FAILURE:
-        throw InvokeFailureException(commandResult.getDescription(), "");
+        return InvokeFailureException(commandResult.getDescription(), "");
     case PENDING:
-        throw PendingStepException(commandResult.getDescription());
+        return PendingStepException(commandResult.getDescription());
+    }
+    return std::monostate();
+}
+
+/**
+ * Throws the InvokeException held, if any
+ */
+struct Thrower {
+    void operator()(std::monostate) const {
+    }
+    template<typename E>
+    void operator()(const E& e) const {
+        throw e;
+    }
+};
+}
+
+void CukeEngineImpl::setDryRun(bool dryRun) {
+    this->dryRun = dryRun;
+}
+
+bool CukeEngineImpl::isDryRun() const {
+    return dryRun;
+}
+
+std::vector<StepMatch> CukeEngineImpl::stepMatches(const std::string& name) const {
+    return convertMatches(cukeCommands.stepMatches(name));
+}
+
+std::vector<std::vector<StepMatch>> CukeEngineImpl::outlineStepMatches(
+    const std::string& templateName, const std::vector<std::string>& names
+) const {
+    std::vector<std::vector<StepMatch>> engineResult;
+    engineResult.reserve(names.size());
+    for (const MatchResult& commandResult : cukeCommands.outlineStepMatches(templateName, names)) {
+        engineResult.push_back(convertMatches(commandResult));
+    }
+    return engineResult;
+}
+
+void CukeEngineImpl::beginFeature(const std::string& name) {
+    if (dryRun) {
+        return;
+    }
+    cukeCommands.beginFeature(name);
+}
+
+bool CukeEngineImpl::snapshotBackground(const std::string& key) {
+    return !dryRun && cukeCommands.snapshotBackground(key);
+}
+
+bool CukeEngineImpl::restoreBackground(const std::string& key) {
+    return !dryRun && cukeCommands.restoreBackground(key);
+}
+
+void CukeEngineImpl::continueTrace(const std::string& traceParent) {
+    cukeCommands.continueTrace(traceParent);
+}
+
+void CukeEngineImpl::beginScenario(const tags_type& tags) {
+    if (dryRun) {
+        return;
+    }
+    cukeCommands.beginScenario(tags);
+}
+
+void CukeEngineImpl::invokeStep(
+    const std::string& id, const invoke_args_type& args, const invoke_table_type& tableArg
+) {
+    invokeStepMovingArgs(id, invoke_args_type(args), invoke_table_type(tableArg));
+}
+
+void CukeEngineImpl::invokeStepMovingArgs(
+    const std::string& id, invoke_args_type&& args, invoke_table_type&& tableArg
+) {
+    std::visit(Thrower(), tryInvokeStep(id, std::move(args), std::move(tableArg)));
+}
+
+CukeEngine::invoke_result_type CukeEngineImpl::tryInvokeStep(
+    const std::string& id, invoke_args_type&& args, invoke_table_type&& tableArg
+) {
+    if (dryRun) {
+        return std::monostate();
+    }
+    std::shared_ptr<const InvokeArgs> commandArgs;
+    try {
+        commandArgs =
+            std::make_shared<const InvokeArgs>(convertArgs(std::move(args), std::move(tableArg)));
+    } catch (const InvokeException& e) {
+        return e;
+    }
+    try {
+        return convertResult(cukeCommands.invoke(convertId(id), commandArgs));
+    } catch (...) {
+        return InvokeException("Uncatched exception");
+    }
+}
+
+void CukeEngineImpl::invokeStepAsync(
+    const std::string& id,
+    invoke_args_type&& args,
+    invoke_table_type&& tableArg,
+    StepExecutor& executor,
+    async_callback_type done
+) {
+    if (dryRun) {
+        done(std::monostate());
+        return;
+    }
+    std::shared_ptr<const InvokeArgs> commandArgs;
+    try {
+        commandArgs =
+            std::make_shared<const InvokeArgs>(convertArgs(std::move(args), std::move(tableArg)));
+    } catch (const InvokeException& e) {
+        done(e);
+        return;
+    }
+    try {
+        cukeCommands.invokeAsync(
+            convertId(id),
+            commandArgs,
+            executor,
+            [done](const InvokeResult& commandResult) {
+                done(convertResult(commandResult));
+            }
+        );
+    } catch (...) {
+        done(InvokeException("Uncatched exception"));
     }
 }
 
 void CukeEngineImpl::endScenario(const tags_type& /*tags*/) {
+    if (dryRun) {
+        return;
+    }
     cukeCommands.endScenario();
 }
 
@@ -0,0 +1,177 @@
+#include "cucumber-cpp/internal/DurationHistory.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+const char HEADER[8] = {'C', 'U', 'K', 'E', 'D', 'U', 'R', '1'};
+const std::size_t RECORD_SIZE = 1 + 8 + 8;
+
+void putUint64(char* bytes, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+std::uint64_t getUint64(const char* bytes) {
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= std::uint64_t(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * Reads the scenario history the wire coordinator kept as text: lines of
+ * a hexadecimal key and nanoseconds. False unless every line is one.
+ */
+bool readTextHistory(
+    std::istream& in,
+    std::vector<std::pair<DurationHistory::key_type, std::chrono::nanoseconds>>& durations
+) {
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        std::istringstream fields(line);
+        DurationHistory::key_type key;
+        std::chrono::nanoseconds::rep nanoseconds;
+        if (!(fields >> std::hex >> key >> std::dec >> nanoseconds) || nanoseconds < 0
+            || !(fields >> std::ws).eof()) {
+            return false;
+        }
+        durations.emplace_back(key, std::chrono::nanoseconds(nanoseconds));
+    }
+    return true;
+}
+
+void writeRecord(
+    std::ostream& out,
+    DurationHistory::Kind kind,
+    DurationHistory::key_type key,
+    std::chrono::nanoseconds duration
+) {
+    char record[RECORD_SIZE];
+    record[0] = static_cast<char>(kind);
+    putUint64(record + 1, key);
+    putUint64(record + 9, static_cast<std::uint64_t>(duration.count()));
+    out.write(record, RECORD_SIZE);
+}
+}
+
+DurationHistory::DurationHistory(const std::string& path) {
+    {
+        std::ifstream in(path, std::ios::binary);
+        char header[sizeof(HEADER)];
+        in.read(header, sizeof(header));
+        if (in.gcount() == 0) {
+            // No history yet
+        } else if (in && std::memcmp(header, HEADER, sizeof(HEADER)) == 0) {
+            char record[RECORD_SIZE];
+            while (in.read(record, RECORD_SIZE)) {
+                const Kind kind = static_cast<Kind>(record[0]);
+                const std::uint64_t nanoseconds = getUint64(record + 9);
+                if ((kind == SCENARIO || kind == STEP)
+                    && nanoseconds <= std::uint64_t(std::chrono::nanoseconds::max().count())) {
+                    learn(kind, getUint64(record + 1), std::chrono::nanoseconds(nanoseconds));
+                }
+            }
+        } else {
+            // Migrated, compacting it below, unless it is no history at all
+            in.clear();
+            in.seekg(0);
+            std::vector<std::pair<key_type, std::chrono::nanoseconds>> scenarios;
+            if (!readTextHistory(in, scenarios)) {
+                throw std::runtime_error("Not a duration history, left as it is: " + path);
+            }
+            for (const auto& scenario : scenarios) {
+                learn(SCENARIO, scenario.first, scenario.second);
+            }
+        }
+    }
+
+    // Compacted aside and renamed, so that a crash leaves the old log
+    const std::string compacted = path + ".tmp";
+    {
+        std::ofstream out(compacted, std::ios::binary | std::ios::trunc);
+        out.write(HEADER, sizeof(HEADER));
+        for (const auto& duration : durations) {
+            writeRecord(out, duration.first.first, duration.first.second, duration.second);
+        }
+        if (!out.flush()) {
+            throw std::runtime_error("Unable to write duration history " + compacted);
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(compacted, path, error);
+    if (error) {
+        throw std::runtime_error("Unable to write duration history " + path);
+    }
+    log.open(path, std::ios::binary | std::ios::app);
+    if (!log) {
+        throw std::runtime_error("Unable to write duration history " + path);
+    }
+}
+
+void DurationHistory::record(Kind kind, key_type key, std::chrono::nanoseconds duration) {
+    if (duration.count() < 0) {
+        duration = std::chrono::nanoseconds(0);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    learn(kind, key, duration);
+    if (log.is_open()) {
+        writeRecord(log, kind, key, duration);
+        log.flush();
+    }
+}
+
+std::optional<std::chrono::nanoseconds> DurationHistory::expected(Kind kind, key_type key) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto known = durations.find(std::make_pair(kind, key));
+    if (known == durations.end()) {
+        return std::nullopt;
+    }
+    return known->second;
+}
+
+std::optional<std::chrono::nanoseconds> DurationHistory::average(Kind kind) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto total = totals.find(kind);
+    if (total == totals.end() || total->second.second == 0) {
+        return std::nullopt;
+    }
+    return total->second.first / static_cast<std::chrono::nanoseconds::rep>(total->second.second);
+}
+
+DurationHistory::key_type DurationHistory::key(std::string_view text) {
+    // FNV-1a
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const char c : text) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+void DurationHistory::learn(Kind kind, key_type key, std::chrono::nanoseconds duration) {
+    std::pair<std::chrono::nanoseconds, std::size_t>& total = totals[kind];
+    const auto inserted = durations.emplace(std::make_pair(kind, key), duration);
+    if (inserted.second) {
+        total.first += duration;
+        ++total.second;
+        return;
+    }
+    const std::chrono::nanoseconds averaged = (inserted.first->second + duration) / 2;
+    total.first += averaged - inserted.first->second;
+    inserted.first->second = averaged;
+}
+
+}
+}
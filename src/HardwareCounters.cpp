@@ -0,0 +1,149 @@
+#include "cucumber-cpp/internal/HardwareCounters.hpp"
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+#if defined(__linux__)
+
+/**
+ * Group of the counters of the current thread, led by the first one that
+ * opened, so that a single read returns them all
+ */
+class ThreadCounters {
+public:
+    ThreadCounters() {
+        static const std::uint64_t configs[HARDWARE_COUNTER_COUNT] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES,
+        };
+        slots.fill(-1);
+        for (std::size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[counter];
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+                               | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            const long fd = syscall(
+                __NR_perf_event_open, &attr, 0, -1, leader(), PERF_FLAG_FD_CLOEXEC
+            );
+            if (fd >= 0) {
+                slots[counter] = static_cast<int>(members);
+                fds[members++] = static_cast<int>(fd);
+            }
+        }
+    }
+
+    ~ThreadCounters() {
+        for (std::size_t i = 0; i < members; ++i) {
+            close(fds[i]);
+        }
+    }
+
+    ThreadCounters(const ThreadCounters&) = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+    bool isOpen() const {
+        return members > 0;
+    }
+
+    std::optional<HardwareCounterSample> read() const {
+        // nr, time enabled and time running, then a value per member
+        std::uint64_t values[3 + HARDWARE_COUNTER_COUNT];
+        const std::size_t size = (3 + members) * sizeof(std::uint64_t);
+        if (!isOpen() || ::read(fds[0], values, size) != static_cast<ssize_t>(size)) {
+            return std::nullopt;
+        }
+        const std::uint64_t enabled = values[1];
+        const std::uint64_t running = values[2];
+        HardwareCounterSample sample;
+        for (std::size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+            if (slots[counter] < 0) {
+                continue;
+            }
+            const std::uint64_t value = values[3 + slots[counter]];
+            sample.values[counter] =
+                running > 0 && running < enabled
+                    ? static_cast<std::uint64_t>(double(value) * enabled / running)
+                    : value;
+        }
+        return sample;
+    }
+
+private:
+    int leader() const {
+        return members > 0 ? fds[0] : -1;
+    }
+
+    std::array<int, HARDWARE_COUNTER_COUNT> fds{};
+    /** Position of every counter among the members, -1 when it did not open */
+    std::array<int, HARDWARE_COUNTER_COUNT> slots;
+    std::size_t members = 0;
+};
+
+const ThreadCounters& threadCounters() {
+    thread_local ThreadCounters counters;
+    return counters;
+}
+
+#endif
+
+}
+
+HardwareCounterSample HardwareCounterSample::since(const HardwareCounterSample& earlier) const {
+    HardwareCounterSample counted;
+    for (std::size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+        // Scaling may leave a multiplexed counter slightly behind
+        counted.values[counter] =
+            values[counter] > earlier.values[counter] ? values[counter] - earlier.values[counter]
+                                                      : 0;
+    }
+    return counted;
+}
+
+bool HardwareCounters::isAvailable() {
+#if defined(__linux__)
+    return threadCounters().isOpen();
+#else
+    return false;
+#endif
+}
+
+std::optional<HardwareCounterSample> HardwareCounters::sample() {
+#if defined(__linux__)
+    return threadCounters().read();
+#else
+    return std::nullopt;
+#endif
+}
+
+const char* HardwareCounters::name(HardwareCounter counter) {
+    switch (counter) {
+    case COUNTED_CYCLES:
+        return "cycles";
+    case COUNTED_INSTRUCTIONS:
+        return "instructions";
+    case COUNTED_CACHE_MISSES:
+        return "cache misses";
+    case COUNTED_BRANCH_MISSES:
+        return "branch misses";
+    case HARDWARE_COUNTER_COUNT:
+        break;
+    }
+    return "unknown";
+}
+
+}
+}
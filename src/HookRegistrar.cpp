@@ -1,31 +1,72 @@
 #include <cucumber-cpp/internal/hook/HookRegistrar.hpp>
 #include <cucumber-cpp/internal/CukeCommands.hpp>
+#include <cucumber-cpp/internal/StepBenchmark.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+#include <cucumber-cpp/internal/TraceRecorder.hpp>
+#include <cucumber-cpp/internal/utils/ThreadPool.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdexcept>
 
 namespace cucumber {
 namespace internal {
 
-void Hook::invokeHook(Scenario* scenario, CallableStep*) {
+void Hook::invokeHook(Scenario* scenario, CallableStep* step) {
     if (tagsMatch(scenario)) {
-        body();
+        invokeMatchedHook(step);
     } else {
         skipHook();
     }
 }
 
+void Hook::invokeMatchedHook(CallableStep*) {
+    body();
+}
+
 void Hook::skipHook() {
 }
 
 void Hook::setTags(const std::string& csvTagNotation) {
-    tagExpression = AndTagExpression(csvTagNotation);
+    tagExpression = BooleanTagExpression::fromHookNotation(csvTagNotation);
 }
 
 bool Hook::tagsMatch(Scenario* scenario) {
-    return !scenario || tagExpression.matches(scenario->getTags());
+    return !scenario || tagExpression.matches(scenario->getTagSet());
+}
+
+namespace {
+thread_local CallableStep* currentStep = NULL;
+
+class CurrentStepScope {
+public:
+    explicit CurrentStepScope(CallableStep* step) :
+        previous(currentStep) {
+        currentStep = step;
+    }
+    ~CurrentStepScope() {
+        currentStep = previous;
+    }
+
+private:
+    CallableStep* const previous;
+};
+}
+
+CallableStep* AroundStepHook::CurrentStep::operator->() const {
+    return currentStep;
 }
 
 void AroundStepHook::invokeHook(Scenario* scenario, CallableStep* step) {
-    this->step = step;
-    Hook::invokeHook(scenario, NULL);
+    const CurrentStepScope currentStepScope(step);
+    Hook::invokeHook(scenario, step);
+}
+
+void AroundStepHook::invokeMatchedHook(CallableStep* step) {
+    const CurrentStepScope currentStepScope(step);
+    body();
 }
 
 void AroundStepHook::skipHook() {
@@ -36,6 +77,70 @@ void UnconditionalHook::invokeHook(Scenario*, CallableStep*) {
     body();
 }
 
+void UnconditionalHook::setDependencies(const std::string& csvNameNotation) {
+    std::vector<std::string> names;
+    std::string::size_type end = 0;
+    for (std::string::size_type begin = csvNameNotation.find('"'); begin != std::string::npos;
+         begin = csvNameNotation.find('"', end + 1)) {
+        end = csvNameNotation.find('"', begin + 1);
+        if (end == std::string::npos) {
+            break;
+        }
+        const std::string argument = csvNameNotation.substr(begin + 1, end - begin - 1);
+        if (argument.find_first_not_of(" \t") == std::string::npos) {
+            throw std::invalid_argument("Blank hook name in " + csvNameNotation);
+        }
+        names.push_back(argument);
+    }
+    name = names.empty() ? std::string() : names.front();
+    dependencies.assign(names.size() > 1 ? names.begin() + 1 : names.end(), names.end());
+}
+
+const std::string& UnconditionalHook::getName() const {
+    return name;
+}
+
+const std::vector<std::string>& UnconditionalHook::getDependencies() const {
+    return dependencies;
+}
+
+namespace {
+/**
+ * Hooks are few, so shifting them along costs less than a list node each
+ */
+template<typename List>
+void prepend(List& hookList, typename List::value_type hook) {
+    hookList.insert(hookList.begin(), std::move(hook));
+}
+}
+
+template<typename Chain, typename List>
+Chain HookRegistrar::matchingHooks(const List& hookList, Scenario* scenario) {
+    Chain hookChain;
+    for (const auto& hook : hookList) {
+        if (hook->tagsMatch(scenario)) {
+            hookChain.push_back(hook);
+        }
+    }
+    return hookChain;
+}
+
+ScenarioHooks HookRegistrar::resolveHooks(Scenario* scenario) {
+    ScenarioHooks hooks;
+    hooks.before = matchingHooks<hook_chain_type>(beforeHooks(), scenario);
+    hooks.aroundStep = matchingHooks<aroundhook_chain_type>(aroundStepHooks(), scenario);
+    hooks.afterStep = matchingHooks<hook_chain_type>(afterStepHooks(), scenario);
+    hooks.after = matchingHooks<hook_chain_type>(afterHooks(), scenario);
+    return hooks;
+}
+
+void HookRegistrar::execHookChain(const hook_chain_type& hookChain) {
+    const ScopedTiming timing(TIMED_HOOKS);
+    for (const std::shared_ptr<Hook>& hook : hookChain) {
+        hook->invokeMatchedHook(NULL);
+    }
+}
+
 void HookRegistrar::addBeforeHook(std::shared_ptr<BeforeHook> beforeHook) {
     beforeHooks().push_back(beforeHook);
 }
@@ -50,7 +155,7 @@ void HookRegistrar::execBeforeHooks(Scenario* scenario) {
 }
 
 void HookRegistrar::addAroundStepHook(std::shared_ptr<AroundStepHook> aroundStepHook) {
-    aroundStepHooks().push_front(aroundStepHook);
+    prepend(aroundStepHooks(), std::move(aroundStepHook));
 }
 
 HookRegistrar::aroundhook_list_type& HookRegistrar::aroundStepHooks() {
@@ -59,14 +164,16 @@ HookRegistrar::aroundhook_list_type& HookRegistrar::aroundStepHooks() {
 }
 
 InvokeResult HookRegistrar::execStepChain(
-    Scenario* scenario, const StepInfo* const stepInfo, const InvokeArgs* pArgs
+    const aroundhook_chain_type& aroundHooks,
+    const StepInfo* const stepInfo,
+    const InvokeArgs* pArgs
 ) {
-    StepCallChain scc(scenario, stepInfo, pArgs, aroundStepHooks());
+    StepCallChain scc(stepInfo, pArgs, aroundHooks);
     return scc.exec();
 }
 
 void HookRegistrar::addAfterStepHook(std::shared_ptr<AfterStepHook> afterStepHook) {
-    afterStepHooks().push_front(afterStepHook);
+    prepend(afterStepHooks(), std::move(afterStepHook));
 }
 
 HookRegistrar::hook_list_type& HookRegistrar::afterStepHooks() {
@@ -79,7 +186,7 @@ void HookRegistrar::execAfterStepHooks(Scenario* scenario) {
 }
 
 void HookRegistrar::addAfterHook(std::shared_ptr<AfterHook> afterHook) {
-    afterHooks().push_front(afterHook);
+    prepend(afterHooks(), std::move(afterHook));
 }
 
 HookRegistrar::hook_list_type& HookRegistrar::afterHooks() {
@@ -92,14 +199,186 @@ void HookRegistrar::execAfterHooks(Scenario* scenario) {
 }
 
 void HookRegistrar::execHooks(HookRegistrar::hook_list_type& hookList, Scenario* scenario) {
-    for (HookRegistrar::hook_list_type::iterator hook = hookList.begin(); hook != hookList.end();
-         ++hook) {
-        (*hook)->invokeHook(scenario, NULL);
+    const ScopedTiming timing(TIMED_HOOKS);
+    for (const std::shared_ptr<Hook>& hook : hookList) {
+        hook->invokeHook(scenario, NULL);
+    }
+}
+
+namespace {
+/**
+ * Indexes of the hooks that every hook waits for
+ */
+std::vector<std::vector<std::size_t>> hookDependencies(
+    const HookRegistrar::unconditionalhook_list_type& hookList
+) {
+    std::map<std::string, std::size_t> named;
+    for (std::size_t i = 0; i < hookList.size(); ++i) {
+        const std::string& name = hookList[i]->getName();
+        if (!name.empty() && !named.emplace(name, i).second) {
+            throw std::invalid_argument("Two hooks named " + name);
+        }
+    }
+    std::vector<std::vector<std::size_t>> dependencies(hookList.size());
+    const std::size_t none = hookList.size();
+    std::size_t lastUnnamed = none;
+    for (std::size_t i = 0; i < hookList.size(); ++i) {
+        const UnconditionalHook& hook = *hookList[i];
+        if (hook.getName().empty()) {
+            for (std::size_t before = 0; before < i; ++before) {
+                dependencies[i].push_back(before);
+            }
+            lastUnnamed = i;
+            continue;
+        }
+        if (lastUnnamed != none) {
+            dependencies[i].push_back(lastUnnamed);
+        }
+        for (const std::string& dependency : hook.getDependencies()) {
+            const auto found = named.find(dependency);
+            if (found == named.end()) {
+                throw std::invalid_argument(
+                    "Hook " + hook.getName() + " depends on unknown hook " + dependency
+                );
+            }
+            dependencies[i].push_back(found->second);
+        }
+    }
+    // Hooks left out of a topological order are part of a cycle
+    std::vector<std::size_t> waiting(hookList.size());
+    std::vector<std::vector<std::size_t>> dependents(hookList.size());
+    for (std::size_t i = 0; i < hookList.size(); ++i) {
+        waiting[i] = dependencies[i].size();
+        for (const std::size_t dependency : dependencies[i]) {
+            dependents[dependency].push_back(i);
+        }
+    }
+    std::vector<std::size_t> ready;
+    for (std::size_t i = 0; i < hookList.size(); ++i) {
+        if (waiting[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+    std::size_t ordered = 0;
+    while (!ready.empty()) {
+        const std::size_t hook = ready.back();
+        ready.pop_back();
+        ++ordered;
+        for (const std::size_t dependent : dependents[hook]) {
+            if (--waiting[dependent] == 0) {
+                ready.push_back(dependent);
+            }
+        }
+    }
+    if (ordered != hookList.size()) {
+        throw std::invalid_argument("Hook dependencies form a cycle");
+    }
+    return dependencies;
+}
+
+std::string describe(const std::exception_ptr& error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const std::exception& ex) {
+        return ex.what();
+    } catch (...) {
+        return "Unknown exception";
     }
 }
+}
+
+void HookRegistrar::execUnconditionalHooks(const unconditionalhook_list_type& hookList) {
+    const ScopedTiming timing(TIMED_HOOKS);
+    const std::vector<std::vector<std::size_t>> dependencies = hookDependencies(hookList);
+    std::size_t namedHooks = 0;
+    for (const std::shared_ptr<UnconditionalHook>& hook : hookList) {
+        namedHooks += hook->getName().empty() ? 0 : 1;
+    }
+    if (namedHooks < 2) {
+        for (const std::shared_ptr<UnconditionalHook>& hook : hookList) {
+            hook->invokeHook(NULL, NULL);
+        }
+        return;
+    }
 
-HookRegistrar::hook_list_type& HookRegistrar::beforeAllHooks() {
-    static hook_list_type beforeAllHooks;
+    std::vector<std::size_t> waiting(hookList.size());
+    std::vector<std::vector<std::size_t>> dependents(hookList.size());
+    std::vector<std::size_t> ready;
+    for (std::size_t i = 0; i < hookList.size(); ++i) {
+        waiting[i] = dependencies[i].size();
+        for (const std::size_t dependency : dependencies[i]) {
+            dependents[dependency].push_back(i);
+        }
+        if (waiting[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::vector<std::pair<std::size_t, std::exception_ptr>> done;
+    std::vector<std::exception_ptr> errors(hookList.size());
+    bool failed = false;
+    std::size_t running = 0;
+    // Destroyed first, once every hook it ran has reported
+    ThreadPool pool(namedHooks);
+    while (true) {
+        for (; !failed && !ready.empty(); ready.pop_back()) {
+            const std::size_t i = ready.back();
+            ++running;
+            pool.submit([&hookList, &mutex, &finished, &done, i] {
+                std::exception_ptr error;
+                try {
+                    hookList[i]->invokeHook(NULL, NULL);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                done.emplace_back(i, error);
+                finished.notify_one();
+            });
+        }
+        if (running == 0) {
+            break;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        while (done.empty()) {
+            finished.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        for (const std::pair<std::size_t, std::exception_ptr>& hook : done) {
+            --running;
+            if (hook.second) {
+                errors[hook.first] = hook.second;
+                failed = true;
+                continue;
+            }
+            for (const std::size_t dependent : dependents[hook.first]) {
+                if (--waiting[dependent] == 0) {
+                    ready.push_back(dependent);
+                }
+            }
+        }
+        done.clear();
+    }
+
+    std::vector<std::exception_ptr> failures;
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            failures.push_back(error);
+        }
+    }
+    if (failures.size() == 1) {
+        std::rethrow_exception(failures.front());
+    } else if (!failures.empty()) {
+        std::string message = std::to_string(failures.size()) + " hooks failed: ";
+        for (std::size_t i = 0; i < failures.size(); ++i) {
+            message += (i > 0 ? "; " : "") + describe(failures[i]);
+        }
+        throw std::runtime_error(message);
+    }
+}
+
+HookRegistrar::unconditionalhook_list_type& HookRegistrar::beforeAllHooks() {
+    static unconditionalhook_list_type beforeAllHooks;
     return beforeAllHooks;
 }
 
@@ -108,11 +387,11 @@ void HookRegistrar::addBeforeAllHook(std::shared_ptr<BeforeAllHook> beforeAllHoo
 }
 
 void HookRegistrar::execBeforeAllHooks() {
-    execHooks(beforeAllHooks(), NULL);
+    execUnconditionalHooks(beforeAllHooks());
 }
 
-HookRegistrar::hook_list_type& HookRegistrar::afterAllHooks() {
-    static hook_list_type afterAllHooks;
+HookRegistrar::unconditionalhook_list_type& HookRegistrar::afterAllHooks() {
+    static unconditionalhook_list_type afterAllHooks;
     return afterAllHooks;
 }
 
@@ -121,16 +400,16 @@ void HookRegistrar::addAfterAllHook(std::shared_ptr<AfterAllHook> afterAllHook)
 }
 
 void HookRegistrar::execAfterAllHooks() {
-    execHooks(afterAllHooks(), NULL);
+    execUnconditionalHooks(afterAllHooks());
+    Timings::afterAll();
+    TraceRecorder::afterAll();
 }
 
 StepCallChain::StepCallChain(
-    Scenario* scenario,
     const StepInfo* const stepInfo,
     const InvokeArgs* pStepArgs,
-    HookRegistrar::aroundhook_list_type& aroundHooks
+    const HookRegistrar::aroundhook_chain_type& aroundHooks
 ) :
-    scenario(scenario),
     stepInfo(stepInfo),
     pStepArgs(pStepArgs) {
     nextHook = aroundHooks.begin();
@@ -138,33 +417,40 @@ StepCallChain::StepCallChain(
 }
 
 InvokeResult StepCallChain::exec() {
-    execNext();
+    call();
     return result;
 }
 
-void StepCallChain::execNext() {
+void StepCallChain::call() {
     if (nextHook == hookEnd) {
         execStep();
     } else {
-        HookRegistrar::aroundhook_list_type::iterator currentHook = nextHook++;
-        CallableStepChain callableStepChain(this);
-        (*currentHook)->invokeHook(scenario, &callableStepChain);
+        (*nextHook++)->invokeMatchedHook(this);
     }
 }
 
 void StepCallChain::execStep() {
     if (stepInfo) {
-        result = stepInfo->invokeStep(pStepArgs);
+        // Within Around hooks, counting the step body alone
+        const ScopedHardwareCounters counters(stepInfo->id);
+        const StepBenchmark& benchmark = StepBenchmark::current();
+        if (!benchmark.isEnabled()) {
+            result = stepInfo->invokeStep(pStepArgs);
+            return;
+        }
+        const step_id_type id = stepInfo->id;
+        result = benchmark.run(
+            [this] {
+                return stepInfo->invokeStep(pStepArgs);
+            },
+            [id](StepBenchmark::duration_type elapsed) {
+                if (Timings::isEnabled()) {
+                    Timings::recordBenchmark(elapsed, id);
+                }
+            }
+        );
     }
 }
 
-CallableStepChain::CallableStepChain(StepCallChain* scc) :
-    scc(scc) {
-}
-
-void CallableStepChain::call() {
-    scc->execNext();
-}
-
 }
 }
@@ -0,0 +1,121 @@
+#include "cucumber-cpp/internal/ImpactRecord.hpp"
+
+#include <filesystem>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+/**
+ * "file:line" without the line
+ */
+std::string fileOf(const std::string& location) {
+    return location.substr(0, location.rfind(':'));
+}
+
+bool endsWith(const std::filesystem::path& path, const std::filesystem::path& suffix) {
+    std::filesystem::path::iterator component = path.end();
+    for (std::filesystem::path::iterator suffixComponent = suffix.end();
+         suffixComponent != suffix.begin();) {
+        if (component == path.begin() || *--suffixComponent != *--component) {
+            return false;
+        }
+    }
+    return !suffix.empty();
+}
+
+/**
+ * Whether one path is the other with more directories in front
+ */
+bool sameFile(const std::string& a, const std::string& b) {
+    const std::filesystem::path pathA = std::filesystem::path(a).lexically_normal();
+    const std::filesystem::path pathB = std::filesystem::path(b).lexically_normal();
+    return endsWith(pathA, pathB) || endsWith(pathB, pathA);
+}
+}
+
+const ImpactRecord::scenarios_type& ImpactRecord::scenarios() const {
+    return recorded;
+}
+
+void ImpactRecord::record(const PickledScenario& scenario, const ScenarioResult& result) {
+    Scenario& recording = recorded[scenario.location];
+    recording.passed = result.status == RUN_PASSED;
+    recording.sources.clear();
+    for (const StepResult& step : result.steps) {
+        if (!step.source.empty()) {
+            recording.sources.insert(step.source);
+        }
+    }
+}
+
+void ImpactRecord::keep(const PickledScenario& scenario, const ImpactRecord& previous) {
+    const scenarios_type::const_iterator kept = previous.recorded.find(scenario.location);
+    if (kept != previous.recorded.end()) {
+        recorded.insert(*kept);
+    }
+}
+
+bool ImpactRecord::affects(
+    const PickledScenario& scenario, const std::vector<std::string>& changedFiles
+) const {
+    const scenarios_type::const_iterator known = recorded.find(scenario.location);
+    if (known == recorded.end() || !known->second.passed) {
+        return true;
+    }
+    const std::string featureFile = fileOf(scenario.location);
+    for (const std::string& changed : changedFiles) {
+        if (sameFile(changed, featureFile)) {
+            return true;
+        }
+        const std::string changedName = std::filesystem::path(changed).filename().string();
+        for (const std::string& source : known->second.sources) {
+            if (fileOf(source) == changedName) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ImpactRecord::load(std::istream& in) {
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string status;
+        std::string location;
+        if (!std::getline(fields, status, '\t') || !std::getline(fields, location, '\t')
+            || (status != "passed" && status != "failed") || location.empty()) {
+            throw std::runtime_error("Malformed impact record line: " + line);
+        }
+        Scenario& scenario = recorded[location];
+        scenario.passed = status == "passed";
+        scenario.sources.clear();
+        std::string source;
+        while (std::getline(fields, source, '\t')) {
+            scenario.sources.insert(source);
+        }
+    }
+}
+
+void ImpactRecord::save(std::ostream& out) const {
+    for (const scenarios_type::value_type& scenario : recorded) {
+        out << (scenario.second.passed ? "passed" : "failed") << '\t' << scenario.first;
+        for (const std::string& source : scenario.second.sources) {
+            out << '\t' << source;
+        }
+        out << '\n';
+    }
+    out.flush();
+}
+
+}
+}
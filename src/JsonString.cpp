@@ -0,0 +1,245 @@
+#include "cucumber-cpp/internal/utils/JsonString.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CUKE_JSON_SSE2
+    #include <immintrin.h>
+    #if defined(__AVX2__)
+        #define CUKE_JSON_AVX2
+    #elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        // Compiled for AVX2 alone, used where the processor has it
+        #define CUKE_JSON_AVX2
+        #define CUKE_JSON_AVX2_TARGET __attribute__((target("avx2")))
+        #define CUKE_JSON_AVX2_DETECTED
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define CUKE_JSON_NEON
+    #include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+#ifndef CUKE_JSON_AVX2_TARGET
+    #define CUKE_JSON_AVX2_TARGET
+#endif
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+bool isJsonSpecial(unsigned char c) {
+    return c < 0x20 || c == '"' || c == '\\' || c >= 0x80;
+}
+
+std::size_t scanBytes(const char* data, std::size_t i, std::size_t size) {
+    for (; i < size; ++i) {
+        if (isJsonSpecial(static_cast<unsigned char>(data[i]))) {
+            return i;
+        }
+    }
+    return size;
+}
+
+#if defined(CUKE_JSON_SSE2)
+
+unsigned lowestSetBit(unsigned mask) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long bit;
+    _BitScanForward(&bit, mask);
+    return bit;
+    #else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+    #endif
+}
+
+/**
+ * Bytes compared as signed: from 0x80 on they are negative, so below 0x20
+ * along with the control characters
+ */
+std::size_t scanSse2(const char* data, std::size_t i, std::size_t size) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i space = _mm_set1_epi8(0x20);
+    for (; i + 16 <= size; i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)),
+            _mm_cmplt_epi8(block, space)
+        );
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+        if (mask != 0) {
+            return i + lowestSetBit(mask);
+        }
+    }
+    return scanBytes(data, i, size);
+}
+
+#endif
+
+#if defined(CUKE_JSON_AVX2)
+
+CUKE_JSON_AVX2_TARGET std::size_t scanAvx2(const char* data, std::size_t i, std::size_t size) {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i space = _mm256_set1_epi8(0x20);
+    for (; i + 32 <= size; i += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i special = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash)),
+            _mm256_cmpgt_epi8(space, block)
+        );
+        const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(special));
+        if (mask != 0) {
+            return i + lowestSetBit(mask);
+        }
+    }
+    return scanSse2(data, i, size);
+}
+
+bool hasAvx2() {
+    #if defined(CUKE_JSON_AVX2_DETECTED)
+    static const bool detected = __builtin_cpu_supports("avx2");
+    return detected;
+    #else
+    return true;
+    #endif
+}
+
+#endif
+
+#if defined(CUKE_JSON_NEON)
+
+std::size_t scanNeon(const char* data, std::size_t i, std::size_t size) {
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t space = vdupq_n_u8(0x20);
+    const uint8x16_t ascii = vdupq_n_u8(0x7F);
+    for (; i + 16 <= size; i += 16) {
+        const uint8x16_t block = vld1q_u8(reinterpret_cast<const std::uint8_t*>(data + i));
+        const uint8x16_t special = vorrq_u8(
+            vorrq_u8(vceqq_u8(block, quote), vceqq_u8(block, backslash)),
+            vorrq_u8(vcltq_u8(block, space), vcgtq_u8(block, ascii))
+        );
+        if (vmaxvq_u8(special) != 0) {
+            return scanBytes(data, i, i + 16);
+        }
+    }
+    return scanBytes(data, i, size);
+}
+
+#endif
+
+/**
+ * Length of the valid UTF-8 sequence starting at the offset
+ */
+std::size_t utf8SequenceLength(std::string_view text, std::size_t i) {
+    const unsigned char lead = static_cast<unsigned char>(text[i]);
+    std::size_t length;
+    unsigned char min = 0x80, max = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        if (lead == 0xE0) {
+            min = 0xA0;
+        } else if (lead == 0xED) {
+            max = 0x9F;
+        }
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        if (lead == 0xF0) {
+            min = 0x90;
+        } else if (lead == 0xF4) {
+            max = 0x8F;
+        }
+    } else {
+        throw std::invalid_argument("Invalid UTF-8 at byte " + std::to_string(i));
+    }
+    if (i + length > text.size()) {
+        throw std::invalid_argument("Truncated UTF-8 at byte " + std::to_string(i));
+    }
+    for (std::size_t j = 1; j < length; ++j) {
+        const unsigned char c = static_cast<unsigned char>(text[i + j]);
+        if (c < min || c > max) {
+            throw std::invalid_argument("Invalid UTF-8 at byte " + std::to_string(i + j));
+        }
+        min = 0x80;
+        max = 0xBF;
+    }
+    return length;
+}
+
+}
+
+std::size_t findJsonSpecial(std::string_view text, std::size_t from) {
+#if defined(CUKE_JSON_AVX2)
+    if (hasAvx2()) {
+        return scanAvx2(text.data(), from, text.size());
+    }
+#endif
+#if defined(CUKE_JSON_SSE2)
+    return scanSse2(text.data(), from, text.size());
+#elif defined(CUKE_JSON_NEON)
+    return scanNeon(text.data(), from, text.size());
+#else
+    return scanBytes(text.data(), from, text.size());
+#endif
+}
+
+void appendJsonString(std::string& output, std::string_view text) {
+    static const char hex[] = "0123456789abcdef";
+    output += '"';
+    std::size_t unescaped = 0;
+    std::size_t i = findJsonSpecial(text);
+    while (i < text.size()) {
+        const unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x80) {
+            i += utf8SequenceLength(text, i);
+            // Sequences following each other are validated without a scan
+            if (i >= text.size() || static_cast<unsigned char>(text[i]) < 0x80) {
+                i = findJsonSpecial(text, i);
+            }
+            continue;
+        }
+        output.append(text.data() + unescaped, i - unescaped);
+        switch (c) {
+        case '"':
+            output += "\\\"";
+            break;
+        case '\\':
+            output += "\\\\";
+            break;
+        case '\b':
+            output += "\\b";
+            break;
+        case '\f':
+            output += "\\f";
+            break;
+        case '\n':
+            output += "\\n";
+            break;
+        case '\r':
+            output += "\\r";
+            break;
+        case '\t':
+            output += "\\t";
+            break;
+        default:
+            output += "\\u00";
+            output += hex[c >> 4];
+            output += hex[c & 0xF];
+        }
+        unescaped = i + 1;
+        i = findJsonSpecial(text, unescaped);
+    }
+    output.append(text.data() + unescaped, text.size() - unescaped);
+    output += '"';
+}
+
+}
+}
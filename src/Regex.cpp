@@ -1,13 +1,122 @@
 #include <cucumber-cpp/internal/utils/Regex.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
 
 namespace cucumber {
 namespace internal {
 
-Regex::Regex(std::string regularExpression) :
-    regexImpl(regularExpression),
-    regexString(regularExpression) {
+RegexSyntaxError::RegexSyntaxError(const std::string& message) :
+    std::regex_error(std::regex_constants::error_badrepeat),
+    message(message) {
+}
+
+const char* RegexSyntaxError::what() const noexcept {
+    return message.c_str();
+}
+
+RegexComplexityError::RegexComplexityError(const std::string& message) :
+    std::regex_error(std::regex_constants::error_complexity),
+    message(message) {
+}
+
+const char* RegexComplexityError::what() const noexcept {
+    return message.c_str();
+}
+
+namespace {
+struct Group {
+    std::size_t offset;
+    bool lookaround;
+    // Of the enclosing group, up to this one
+    bool enclosingHoldsUnboundedQuantifier;
+};
+
+/**
+ * Length of the quantifier at the position, 0 if there is none
+ */
+std::size_t quantifierLength(const std::string& regex, std::size_t i, bool& unbounded) {
+    if (i >= regex.size()) {
+        return 0;
+    }
+    std::size_t length = 0;
+    if (regex[i] == '*' || regex[i] == '+') {
+        unbounded = true;
+        length = 1;
+    } else if (regex[i] == '?') {
+        unbounded = false;
+        length = 1;
+    } else if (regex[i] == '{') {
+        const std::size_t close = regex.find('}', i);
+        if (close == std::string::npos
+            || regex.find_first_not_of("0123456789,", i + 1) != close) {
+            // Taken literally
+            return 0;
+        }
+        unbounded = regex[close - 1] == ',';
+        length = close - i + 1;
+    } else {
+        return 0;
+    }
+    // Lazy quantifiers backtrack all the same
+    return i + length < regex.size() && regex[i + length] == '?' ? length + 1 : length;
+}
+}
+
+std::string backtrackingHazard(const std::string& regex) {
+    std::vector<Group> groups;
+    bool holdsUnboundedQuantifier = false;
+    for (std::size_t i = 0; i < regex.size();) {
+        bool quantifiedUnbounded = false;
+        if (regex[i] == '\\') {
+            i += 2;
+        } else if (regex[i] == '[') {
+            std::size_t close = i + 1;
+            while (close < regex.size() && regex[close] != ']') {
+                close += regex[close] == '\\' ? 2 : 1;
+            }
+            i = close + 1;
+        } else if (regex[i] == '(') {
+            const bool lookaround = regex.compare(i, 3, "(?=") == 0
+                                    || regex.compare(i, 3, "(?!") == 0
+                                    || regex.compare(i, 4, "(?<=") == 0
+                                    || regex.compare(i, 4, "(?<!") == 0;
+            groups.push_back(Group{i, lookaround, holdsUnboundedQuantifier});
+            holdsUnboundedQuantifier = false;
+            ++i;
+            continue;
+        } else if (regex[i] == ')' && !groups.empty()) {
+            const Group group = groups.back();
+            groups.pop_back();
+            if (group.lookaround && holdsUnboundedQuantifier) {
+                return "unbounded quantifier in the lookaround at offset "
+                       + std::to_string(group.offset);
+            }
+            const bool groupHoldsUnboundedQuantifier = holdsUnboundedQuantifier;
+            holdsUnboundedQuantifier = group.enclosingHoldsUnboundedQuantifier;
+            ++i;
+            const std::size_t length = quantifierLength(regex, i, quantifiedUnbounded);
+            if (length > 0 && quantifiedUnbounded && groupHoldsUnboundedQuantifier) {
+                return "nested unbounded quantifiers in the group at offset "
+                       + std::to_string(group.offset);
+            }
+            i += length;
+            holdsUnboundedQuantifier = holdsUnboundedQuantifier || groupHoldsUnboundedQuantifier
+                                       || (length > 0 && quantifiedUnbounded);
+            continue;
+        } else {
+            ++i;
+        }
+        const std::size_t length = quantifierLength(regex, i, quantifiedUnbounded);
+        i += length;
+        holdsUnboundedQuantifier = holdsUnboundedQuantifier || (length > 0 && quantifiedUnbounded);
+    }
+    return "";
 }
 
 bool RegexMatch::matches() {
@@ -18,59 +127,105 @@ const RegexMatch::submatches_type& RegexMatch::getSubmatches() {
     return submatches;
 }
 
-std::string Regex::str() const {
-    return regexString;
+namespace {
+bool isUtf8ContinuationByte(unsigned char c) {
+    return (c & 0xc0) == 0x80;
 }
 
-std::shared_ptr<RegexMatch> Regex::find(const std::string& expression) const {
-    return std::make_shared<FindRegexMatch>(regexImpl, expression);
+/**
+ * Counts the UTF-8 continuation bytes (10xxxxxx) in a range, eight bytes at
+ * a time: a byte is one if its top bit is set and the next one is not.
+ */
+std::size_t countUtf8ContinuationBytes(const char* begin, const char* end) {
+    const std::uint64_t highBits = 0x8080808080808080ULL;
+    std::size_t count = 0;
+    for (; end - begin >= 8; begin += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, begin, sizeof(word));
+        if ((word & highBits) != 0) {
+            count += std::bitset<64>(word & ~(word << 1) & highBits).count();
+        }
+    }
+    return count + std::count_if(begin, end, [](char c) {
+        return isUtf8ContinuationByte(static_cast<unsigned char>(c));
+    });
 }
+} // namespace
 
-namespace {
-bool isUtf8CodeUnitStartOfCodepoint(unsigned int i) {
-    return (i & 0xc0) != 0x80;
+std::ptrdiff_t RegexMatch::utf8CodepointOffset(
+    const std::string& expression, std::size_t byteOffset
+) {
+    // Submatches mostly come in increasing order, so only the bytes between
+    // the previous submatch and this one are scanned
+    const char* const data = expression.data();
+    const std::size_t from = std::min(cursorByteOffset, byteOffset);
+    const std::size_t to = std::max(cursorByteOffset, byteOffset);
+    const std::ptrdiff_t codepoints =
+        (to - from) - countUtf8ContinuationBytes(data + from, data + to);
+    cursorCodepointOffset += byteOffset >= cursorByteOffset ? codepoints : -codepoints;
+    cursorByteOffset = byteOffset;
+    return cursorCodepointOffset;
 }
 
-std::ptrdiff_t utf8CodepointOffset(
-    const std::string& expression, const std::string::const_iterator& it
+void RegexMatch::addSubmatch(
+    const std::string& expression, std::size_t byteBegin, std::size_t byteEnd
 ) {
-    return count_if(expression.begin(), it, &isUtf8CodeUnitStartOfCodepoint);
+    RegexSubmatch s = {
+        expression.substr(byteBegin, byteEnd - byteBegin),
+        utf8CodepointOffset(expression, byteBegin)
+    };
+    submatches.push_back(s);
 }
-} // namespace
 
-FindRegexMatch::FindRegexMatch(const std::regex& regexImpl, const std::string& expression) {
-    std::smatch matchResults;
-    regexMatched = std::regex_search(expression, matchResults, regexImpl);
-    if (regexMatched) {
-        std::smatch::const_iterator i = matchResults.begin();
-        if (i != matchResults.end())
-            // Skip capture group 0 which is the whole match, not a user marked sub-expression
-            ++i;
-        for (; i != matchResults.end(); ++i) {
-            if (i->matched) {
-                RegexSubmatch s = {*i, utf8CodepointOffset(expression, i->first)};
-                submatches.push_back(s);
-            } else {
-                submatches.push_back(RegexSubmatch());
-            }
-        }
-    }
+void RegexMatch::addUnmatchedSubmatch() {
+    submatches.push_back(RegexSubmatch());
 }
 
-std::shared_ptr<RegexMatch> Regex::findAll(const std::string& expression) const {
-    return std::make_shared<FindAllRegexMatch>(regexImpl, expression);
+struct Regex::DeferredCompilation {
+    std::once_flag once;
+    std::atomic<bool> compiled{false};
+    std::shared_ptr<const RegexImpl> regexImpl;
+};
+
+Regex::Regex(std::string regularExpression) :
+    regexImpl(compile(regularExpression)),
+    regexString(regularExpression) {
 }
 
-FindAllRegexMatch::FindAllRegexMatch(const std::regex& regexImpl, const std::string& expression) {
-    std::sregex_token_iterator i(
-        expression.begin(), expression.end(), regexImpl, 1, std::regex_constants::match_continuous
-    );
-    const std::sregex_token_iterator end;
-    for (; i != end; ++i) {
-        RegexSubmatch s = {*i, -1};
-        submatches.push_back(s);
+Regex::Regex(std::string regularExpression, RegexCompilation compilation) :
+    regexImpl(compilation == COMPILE_NOW ? compile(regularExpression) : nullptr),
+    deferredCompilation(
+        compilation == COMPILE_NOW ? nullptr : std::make_shared<DeferredCompilation>()
+    ),
+    regexString(regularExpression) {
+}
+
+const RegexImpl& Regex::impl() const {
+    if (regexImpl) {
+        return *regexImpl;
     }
-    regexMatched = !submatches.empty();
+    // A failed compilation leaves the flag unset so the error is raised again on every use
+    std::call_once(deferredCompilation->once, [this] {
+        deferredCompilation->regexImpl = compile(regexString);
+        deferredCompilation->compiled = true;
+    });
+    return *deferredCompilation->regexImpl;
+}
+
+bool Regex::isCompiled() const {
+    return regexImpl || deferredCompilation->compiled;
+}
+
+const std::string& Regex::str() const {
+    return regexString;
+}
+
+std::shared_ptr<RegexMatch> Regex::find(const std::string& expression) const {
+    return std::make_shared<FindRegexMatch>(impl(), expression);
+}
+
+std::shared_ptr<RegexMatch> Regex::findAll(const std::string& expression) const {
+    return std::make_shared<FindAllRegexMatch>(impl(), expression);
 }
 
 }
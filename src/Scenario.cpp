@@ -4,12 +4,17 @@ namespace cucumber {
 namespace internal {
 
 Scenario::Scenario(const TagExpression::tag_list& tags) :
-    tags(tags) {
+    tags(tags),
+    tagSet(tags) {
 }
 
 const TagExpression::tag_list& Scenario::getTags() {
     return tags;
 }
 
+const TagSet& Scenario::getTagSet() {
+    return tagSet;
+}
+
 }
 }
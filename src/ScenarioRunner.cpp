@@ -0,0 +1,700 @@
+#include "cucumber-cpp/internal/ScenarioRunner.hpp"
+#include "cucumber-cpp/internal/CukeEngineImpl.hpp"
+#include "cucumber-cpp/internal/step/StepExecutor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+typedef std::deque<std::size_t> scenario_indexes_type;
+/**
+ * Matches of every distinct step text, viewing into the scenarios. Left
+ * empty where matching failed, so that the step reports it when it runs.
+ */
+typedef std::unordered_map<std::string_view, std::optional<std::vector<StepMatch>>>
+    match_table_type;
+
+/**
+ * Step texts matched together: the expansions of an outline step, or a
+ * single text without a template
+ */
+struct MatchGroup {
+    std::string_view templateText;
+    std::vector<match_table_type::value_type*> entries;
+};
+
+void matchGroup(const CukeEngine& engine, const MatchGroup& group) {
+    if (group.entries.size() == 1) {
+        match_table_type::value_type& entry = *group.entries.front();
+        entry.second = engine.stepMatches(std::string(entry.first));
+        return;
+    }
+    std::vector<std::string> texts;
+    texts.reserve(group.entries.size());
+    for (const match_table_type::value_type* entry : group.entries) {
+        texts.emplace_back(entry->first);
+    }
+    std::vector<std::vector<StepMatch>> matches =
+        engine.outlineStepMatches(std::string(group.templateText), texts);
+    for (std::size_t i = 0; i < group.entries.size(); ++i) {
+        group.entries[i]->second = std::move(matches[i]);
+    }
+}
+
+struct Lane {
+    std::mutex mutex;
+    // Only ever run by this lane, in order
+    scenario_indexes_type serialScenarios;
+    // Taken from the front by this lane, stolen from the back by the others
+    scenario_indexes_type scenarios;
+};
+
+bool nextScenario(std::vector<Lane>& lanes, const std::size_t lane, std::size_t& index) {
+    {
+        Lane& own = lanes[lane];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        scenario_indexes_type& queue =
+            own.serialScenarios.empty() ? own.scenarios : own.serialScenarios;
+        if (!queue.empty()) {
+            index = queue.front();
+            queue.pop_front();
+            return true;
+        }
+    }
+    for (std::size_t i = 1; i < lanes.size(); ++i) {
+        Lane& victim = lanes[(lane + i) % lanes.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.scenarios.empty()) {
+            index = victim.scenarios.back();
+            victim.scenarios.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * The feature file of the scenario, from its location
+ */
+std::string featureOf(const PickledScenario& scenario) {
+    return scenario.location.substr(0, scenario.location.rfind(':'));
+}
+
+DurationHistory::key_type scenarioKey(const PickledScenario& scenario) {
+    return DurationHistory::key(scenario.name + '\n' + scenario.location);
+}
+
+/**
+ * From the duration the scenario took before, else from those of its step
+ * definitions, else the average scenario
+ */
+std::chrono::nanoseconds expectedDuration(
+    const DurationHistory& history,
+    const PickledScenario& scenario,
+    const match_table_type& matchTable
+) {
+    if (const std::optional<std::chrono::nanoseconds> known =
+            history.expected(DurationHistory::SCENARIO, scenarioKey(scenario))) {
+        return *known;
+    }
+    std::chrono::nanoseconds steps{0};
+    bool knownSteps = false;
+    for (const PickledStep& step : scenario.steps) {
+        const std::optional<std::vector<StepMatch>>& matches = matchTable.at(step.text);
+        if (!matches || matches->size() != 1) {
+            continue;
+        }
+        if (const std::optional<std::chrono::nanoseconds> known = history.expected(
+                DurationHistory::STEP, DurationHistory::key(matches->front().regexp)
+            )) {
+            steps += *known;
+            knownSteps = true;
+        }
+    }
+    if (knownSteps) {
+        return steps;
+    }
+    return history.average(DurationHistory::SCENARIO).value_or(std::chrono::nanoseconds(0));
+}
+
+/**
+ * Result of a step from the outcome of its invocation
+ */
+StepResult invokedStepResult(
+    const CukeEngine::invoke_result_type& outcome, const std::string& source
+) {
+    StepResult result;
+    result.status = RUN_PASSED;
+    result.source = source;
+    if (const PendingStepException* const pending = std::get_if<PendingStepException>(&outcome)) {
+        result.status = RUN_PENDING;
+        result.message = pending->getMessage();
+    } else if (const InvokeFailureException* const failure =
+                   std::get_if<InvokeFailureException>(&outcome)) {
+        result.status = RUN_FAILED;
+        result.message = failure->getMessage();
+        result.exceptionType = failure->getExceptionType();
+    } else if (const InvokeException* const error = std::get_if<InvokeException>(&outcome)) {
+        result.status = RUN_FAILED;
+        result.message = error->getMessage();
+    }
+    return result;
+}
+
+void failScenario(ScenarioResult& result, const std::string& message) {
+    if (result.status == RUN_PASSED) {
+        result.status = RUN_FAILED;
+        result.message = message;
+    }
+}
+
+/**
+ * Scenarios that did not pass so far, telling the lanes which ones to skip
+ */
+class Failures {
+public:
+    Failures(const ParallelScenarioRunner::FailFast failFast, const std::string& serialTag) :
+        failFast(failFast),
+        serialTag(serialTag) {
+    }
+
+    bool skips(const PickledScenario& scenario) const {
+        if (failFast == ParallelScenarioRunner::RUN_ALL || !any.load()) {
+            return false;
+        }
+        if (failFast == ParallelScenarioRunner::SKIP_ALL_AFTER_FAILURE) {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const std::string& tag : scenario.tags) {
+            if (tags.count(tag)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void add(const PickledScenario& scenario) {
+        if (failFast == ParallelScenarioRunner::RUN_ALL) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Only tells how scenarios are scheduled
+            for (const std::string& tag : scenario.tags) {
+                if (tag != serialTag) {
+                    tags.insert(tag);
+                }
+            }
+        }
+        any.store(true);
+    }
+
+private:
+    const ParallelScenarioRunner::FailFast failFast;
+    const std::string& serialTag;
+    std::atomic<bool> any{false};
+    mutable std::mutex mutex;
+    std::set<std::string> tags;
+};
+
+/**
+ * A scenario in flight on a lane, with the engine it runs on
+ */
+struct ScenarioSlot {
+    explicit ScenarioSlot(CukeEngine* engine) :
+        engine(engine) {
+    }
+
+    CukeEngine* engine;
+    const PickledScenario* scenario = nullptr;
+    ScenarioResult* result = nullptr;
+    std::size_t step = 0;
+    std::chrono::steady_clock::time_point started;
+    /**
+     * Set while the step is being invoked, to tell whether it completed
+     * before its invocation returned
+     */
+    bool invoking = false;
+    bool completedInline = false;
+    CukeEngine::invoke_result_type stepOutcome;
+    /**
+     * Of the Background contexts to snapshot once its steps have passed,
+     * empty if there is nothing to snapshot
+     */
+    std::string snapshotKey;
+};
+
+/**
+ * Runs the scenarios of a lane one step at a time, going on with another
+ * scenario whenever a step waits asynchronously. Everything runs on the
+ * thread of the lane, asynchronous steps completing through its executor.
+ */
+class LaneRunner {
+public:
+    LaneRunner(
+        std::vector<Lane>& lanes,
+        const std::size_t lane,
+        std::vector<ScenarioSlot>& slots,
+        const match_table_type& matchTable,
+        const ParallelScenarioRunner::scenarios_type& scenarios,
+        ParallelScenarioRunner::results_type& results,
+        Failures& failures,
+        DurationHistory* durationHistory,
+        const bool backgroundSnapshots
+    ) :
+        lanes(lanes),
+        lane(lane),
+        slots(slots),
+        matchTable(matchTable),
+        scenarios(scenarios),
+        results(results),
+        failures(failures),
+        durationHistory(durationHistory),
+        backgroundSnapshots(backgroundSnapshots) {
+    }
+
+    void run() {
+        bool more = true;
+        for (;;) {
+            for (ScenarioSlot& slot : slots) {
+                // Serial scenarios come first and run one after the other
+                while (more && !slot.scenario && (running == 0 || !hasSerialScenarios())) {
+                    std::size_t index;
+                    more = nextScenario(lanes, lane, index);
+                    if (more && failures.skips(scenarios[index])) {
+                        skip(index);
+                    } else if (more) {
+                        begin(slot, index);
+                    }
+                }
+            }
+            if (running == 0) {
+                return;
+            }
+            executor.runOne();
+        }
+    }
+
+private:
+    bool hasSerialScenarios() {
+        Lane& own = lanes[lane];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        return !own.serialScenarios.empty();
+    }
+
+    void skip(const std::size_t index) {
+        ScenarioResult& result = results[index];
+        result.status = RUN_SKIPPED;
+        result.message = "Skipped after an earlier failure";
+        result.steps.resize(scenarios[index].steps.size());
+    }
+
+    void begin(ScenarioSlot& slot, const std::size_t index) {
+        slot.scenario = &scenarios[index];
+        slot.result = &results[index];
+        slot.result->steps.resize(slot.scenario->steps.size());
+        slot.step = 0;
+        slot.started = std::chrono::steady_clock::now();
+        ++running;
+        try {
+            slot.engine->beginFeature(featureOf(*slot.scenario));
+            slot.engine->beginScenario(slot.scenario->tags);
+            if (backgroundSnapshots && slot.scenario->backgroundSteps > 0) {
+                restoreBackground(slot);
+            }
+        } catch (const std::exception& e) {
+            failScenario(*slot.result, e.what());
+        } catch (...) {
+            failScenario(*slot.result, "Unknown exception");
+        }
+        advance(slot);
+    }
+
+    /**
+     * Skips the Background steps if a former scenario left a snapshot of
+     * their contexts, otherwise has one taken once they passed
+     */
+    void restoreBackground(ScenarioSlot& slot) {
+        const PickledScenario& scenario = *slot.scenario;
+        std::string key = featureOf(scenario);
+        for (std::size_t i = 0; i < scenario.backgroundSteps; ++i) {
+            key += '\n';
+            key += scenario.steps[i].text;
+        }
+        if (!slot.engine->restoreBackground(key)) {
+            slot.snapshotKey = std::move(key);
+            return;
+        }
+        for (; slot.step < scenario.backgroundSteps; ++slot.step) {
+            StepResult& stepResult = slot.result->steps[slot.step];
+            stepResult.status = RUN_PASSED;
+            const std::optional<std::vector<StepMatch>>& matches =
+                matchTable.at(scenario.steps[slot.step].text);
+            if (matches && matches->size() == 1) {
+                stepResult.source = matches->front().source;
+            }
+        }
+    }
+
+    /**
+     * Invokes the steps of the scenario until one waits asynchronously,
+     * ending the scenario once none is left to run
+     */
+    void advance(ScenarioSlot& slot) {
+        ScenarioResult& result = *slot.result;
+        try {
+            // Steps after the first one that does not pass are skipped
+            while (slot.step < slot.scenario->steps.size() && result.status == RUN_PASSED) {
+                if (!invokeStep(slot)) {
+                    return;
+                }
+                completeStep(slot);
+            }
+        } catch (const std::exception& e) {
+            failScenario(result, e.what());
+        } catch (...) {
+            failScenario(result, "Unknown exception");
+        }
+        end(slot);
+    }
+
+    /**
+     * @return false if the step goes on asynchronously, the scenario then
+     *         advancing once it completes
+     */
+    bool invokeStep(ScenarioSlot& slot) {
+        const PickledStep& step = slot.scenario->steps[slot.step];
+        StepResult& stepResult = slot.result->steps[slot.step];
+        slot.stepOutcome = std::monostate();
+        const std::optional<std::vector<StepMatch>>& prematched = matchTable.at(step.text);
+        const std::vector<StepMatch> matches =
+            prematched ? *prematched : slot.engine->stepMatches(step.text);
+        if (matches.empty()) {
+            stepResult.status = RUN_UNDEFINED;
+            stepResult.message = "Undefined step: " + step.text;
+            return true;
+        }
+        if (matches.size() > 1) {
+            stepResult.status = RUN_AMBIGUOUS;
+            stepResult.message = "Ambiguous step: " + step.text;
+            return true;
+        }
+
+        stepResult.source = matches.front().source;
+
+        CukeEngine::invoke_args_type args;
+        args.reserve(matches.front().args.size() + 1);
+        for (const StepMatchArg& arg : matches.front().args) {
+            args.push_back(arg.value);
+        }
+        if (step.hasDocString) {
+            args.push_back(step.decodeDocString());
+        }
+        slot.invoking = true;
+        slot.completedInline = false;
+        slot.engine->invokeStepAsync(
+            matches.front().id,
+            std::move(args),
+            step.decodeTable(),
+            executor,
+            [this, &slot](CukeEngine::invoke_result_type outcome) {
+                slot.stepOutcome = std::move(outcome);
+                if (slot.invoking) {
+                    slot.completedInline = true;
+                } else {
+                    executor.post([this, &slot] {
+                        resume(slot);
+                    });
+                }
+            }
+        );
+        slot.invoking = false;
+        if (slot.completedInline) {
+            stepResult = invokedStepResult(slot.stepOutcome, stepResult.source);
+        }
+        return slot.completedInline;
+    }
+
+    void resume(ScenarioSlot& slot) {
+        try {
+            StepResult& stepResult = slot.result->steps[slot.step];
+            stepResult = invokedStepResult(slot.stepOutcome, stepResult.source);
+            completeStep(slot);
+        } catch (const std::exception& e) {
+            failScenario(*slot.result, e.what());
+        } catch (...) {
+            failScenario(*slot.result, "Unknown exception");
+        }
+        advance(slot);
+    }
+
+    void completeStep(ScenarioSlot& slot) {
+        const StepResult& stepResult = slot.result->steps[slot.step++];
+        slot.result->status = stepResult.status;
+        slot.result->message = stepResult.message;
+        if (!slot.snapshotKey.empty() && slot.step == slot.scenario->backgroundSteps) {
+            if (stepResult.status == RUN_PASSED) {
+                slot.engine->snapshotBackground(slot.snapshotKey);
+            }
+            slot.snapshotKey.clear();
+        }
+    }
+
+    void end(ScenarioSlot& slot) {
+        // Always ended, so that the contexts of the scenario are purged
+        try {
+            slot.engine->endScenario(slot.scenario->tags);
+        } catch (const std::exception& e) {
+            failScenario(*slot.result, e.what());
+        } catch (...) {
+            failScenario(*slot.result, "Unknown exception");
+        }
+        if (slot.result->status != RUN_PASSED) {
+            failures.add(*slot.scenario);
+        }
+        if (durationHistory) {
+            durationHistory->record(
+                DurationHistory::SCENARIO,
+                scenarioKey(*slot.scenario),
+                std::chrono::steady_clock::now() - slot.started
+            );
+        }
+        slot.scenario = nullptr;
+        slot.result = nullptr;
+        slot.snapshotKey.clear();
+        --running;
+    }
+
+    std::vector<Lane>& lanes;
+    const std::size_t lane;
+    std::vector<ScenarioSlot>& slots;
+    const match_table_type& matchTable;
+    const ParallelScenarioRunner::scenarios_type& scenarios;
+    ParallelScenarioRunner::results_type& results;
+    Failures& failures;
+    DurationHistory* const durationHistory;
+    const bool backgroundSnapshots;
+    QueuedStepExecutor executor;
+    std::size_t running = 0;
+};
+
+/**
+ * Runs the work for every lane, lane 0 on the calling thread, and rethrows
+ * the first exception once all are done. Lanes are pinned to the cpus in
+ * turn, if any.
+ */
+template<typename Work>
+void runLanes(const std::size_t lanes, const cpu_list_type& cpus, const Work& work) {
+    std::vector<std::exception_ptr> errors(lanes);
+    const auto guardedWork = [&work, &errors, &cpus](const std::size_t lane) {
+        try {
+            std::optional<ScopedThreadPin> pin;
+            if (!cpus.empty()) {
+                pin.emplace(cpus[lane % cpus.size()]);
+            }
+            work(lane);
+        } catch (...) {
+            errors[lane] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t lane = 1; lane < lanes; ++lane) {
+        threads.emplace_back(guardedWork, lane);
+    }
+    guardedWork(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+bool hasTag(const PickledScenario& scenario, const std::string& tag) {
+    return std::find(scenario.tags.begin(), scenario.tags.end(), tag) != scenario.tags.end();
+}
+
+}
+
+bool PickledStep::hasTable() const {
+    return rawArgument.kind == RawStepArgument::DATA_TABLE || !table.empty();
+}
+
+std::string PickledStep::decodeDocString() const {
+    return rawArgument.kind == RawStepArgument::DOC_STRING ? rawArgument.decodeDocString()
+                                                           : docString;
+}
+
+CukeEngine::invoke_table_type PickledStep::decodeTable() const {
+    return rawArgument.kind == RawStepArgument::DATA_TABLE ? rawArgument.decodeTable() : table;
+}
+
+ParallelScenarioRunner::ParallelScenarioRunner(std::size_t lanes) :
+    lanes(lanes != 0 ? lanes : std::max(1u, std::thread::hardware_concurrency())),
+    scenariosPerLane(1),
+    serialTag("serial"),
+    failFast(RUN_ALL),
+    engineFactory([] {
+        return std::unique_ptr<CukeEngine>(new CukeEngineImpl);
+    }),
+    durationHistory(nullptr),
+    backgroundSnapshots(false) {
+}
+
+std::size_t ParallelScenarioRunner::getLanes() const {
+    return lanes;
+}
+
+std::size_t ParallelScenarioRunner::getScenariosPerLane() const {
+    return scenariosPerLane;
+}
+
+void ParallelScenarioRunner::setScenariosPerLane(const std::size_t scenarios) {
+    scenariosPerLane = std::max<std::size_t>(1, scenarios);
+}
+
+void ParallelScenarioRunner::setSerialTag(const std::string& tag) {
+    serialTag = tag;
+}
+
+void ParallelScenarioRunner::setFailFast(const FailFast failFast) {
+    this->failFast = failFast;
+}
+
+void ParallelScenarioRunner::setEngineFactory(const engine_factory_type& engineFactory) {
+    this->engineFactory = engineFactory;
+}
+
+void ParallelScenarioRunner::setDurationHistory(DurationHistory* history) {
+    durationHistory = history;
+}
+
+void ParallelScenarioRunner::setBackgroundSnapshots(const bool enabled) {
+    backgroundSnapshots = enabled;
+}
+
+void ParallelScenarioRunner::setCpus(const cpu_list_type& cpus) {
+    this->cpus = cpus;
+}
+
+ParallelScenarioRunner::results_type ParallelScenarioRunner::run(const scenarios_type& scenarios
+) const {
+    results_type results(scenarios.size());
+    std::vector<Lane> queues(std::max<std::size_t>(1, std::min(lanes, scenarios.size())));
+
+    scenario_indexes_type ordinary;
+    for (std::size_t i = 0; i < scenarios.size(); ++i) {
+        if (!serialTag.empty() && hasTag(scenarios[i], serialTag)) {
+            queues.front().serialScenarios.push_back(i);
+        } else {
+            ordinary.push_back(i);
+        }
+    }
+    // All engines outlive every lane: the AfterAll hooks run once the last
+    // engine that began a scenario is gone, and must not run before all
+    // lanes are done
+    std::vector<std::unique_ptr<CukeEngine>> engines;
+    std::vector<std::vector<ScenarioSlot>> slots(queues.size());
+    for (std::size_t lane = 0; lane < queues.size(); ++lane) {
+        for (std::size_t slot = 0; slot < scenariosPerLane; ++slot) {
+            engines.push_back(engineFactory());
+            slots[lane].emplace_back(engines.back().get());
+        }
+    }
+
+    // Every distinct step text is matched once, spread over the lanes,
+    // before any scenario starts. The expansions of an outline step are
+    // matched together.
+    match_table_type matchTable;
+    std::vector<MatchGroup> groups;
+    std::unordered_map<std::string_view, std::size_t> outlineGroups;
+    for (const PickledScenario& scenario : scenarios) {
+        for (const PickledStep& step : scenario.steps) {
+            const auto inserted = matchTable.emplace(step.text, std::nullopt);
+            if (!inserted.second) {
+                continue;
+            }
+            std::size_t group = groups.size();
+            if (!step.templateText.empty()) {
+                group = outlineGroups.emplace(step.templateText, group).first->second;
+            }
+            if (group == groups.size()) {
+                groups.push_back(MatchGroup{step.templateText, {}});
+            }
+            groups[group].entries.push_back(&*inserted.first);
+        }
+    }
+    runLanes(queues.size(), cpus, [&](const std::size_t lane) {
+        for (std::size_t i = lane; i < groups.size(); i += queues.size()) {
+            try {
+                matchGroup(*slots[lane].front().engine, groups[i]);
+            } catch (...) {
+                // Matched again by the steps, which then fail
+            }
+        }
+    });
+
+    if (durationHistory) {
+        // Longest first, dealt out in turn: every lane starts on long
+        // scenarios and steals short ones from the back of the others
+        std::vector<std::chrono::nanoseconds> expected(scenarios.size());
+        for (const std::size_t i : ordinary) {
+            expected[i] = expectedDuration(*durationHistory, scenarios[i], matchTable);
+        }
+        std::stable_sort(
+            ordinary.begin(),
+            ordinary.end(),
+            [&expected](const std::size_t a, const std::size_t b) {
+                return expected[a] > expected[b];
+            }
+        );
+        for (std::size_t i = 0; i < ordinary.size(); ++i) {
+            queues[i % queues.size()].scenarios.push_back(ordinary[i]);
+        }
+    } else {
+        // Consecutive shares, so that lanes start on scenarios far apart
+        for (std::size_t lane = 0; lane < queues.size(); ++lane) {
+            const std::size_t begin = ordinary.size() * lane / queues.size();
+            const std::size_t end = ordinary.size() * (lane + 1) / queues.size();
+            queues[lane].scenarios.assign(ordinary.begin() + begin, ordinary.begin() + end);
+        }
+    }
+
+    Failures failures(failFast, serialTag);
+    runLanes(queues.size(), cpus, [&](const std::size_t lane) {
+        LaneRunner(
+            queues,
+            lane,
+            slots[lane],
+            matchTable,
+            scenarios,
+            results,
+            failures,
+            durationHistory,
+            backgroundSnapshots
+        )
+            .run();
+    });
+    return results;
+}
+
+}
+}
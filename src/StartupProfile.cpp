@@ -0,0 +1,175 @@
+#include "cucumber-cpp/internal/StartupProfile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+// Static initializers record before main, hence the accessors
+struct Profile {
+    std::mutex mutex;
+    std::vector<StartupEntry> entries;
+};
+
+Profile& profile() {
+    static Profile profile;
+    return profile;
+}
+
+std::atomic<bool>& recordingStartup() {
+    static std::atomic<bool> recording(true);
+    return recording;
+}
+
+const char* operationName(const StartupOperation operation) {
+    switch (operation) {
+    case STARTUP_REGISTER_STEP:
+        return "register steps";
+    case STARTUP_TRANSFORM:
+        return "transform expressions";
+    case STARTUP_COMPILE_REGEX:
+        return "compile regexes";
+    case STARTUP_LOAD_PARAMETER_TYPES:
+        return "load parameter types";
+    case STARTUP_OPERATION_COUNT:
+        break;
+    }
+    return "unknown";
+}
+
+double millis(const std::chrono::steady_clock::duration elapsed) {
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+struct Total {
+    std::size_t count = 0;
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+
+    void add(const std::chrono::steady_clock::duration by) {
+        ++count;
+        elapsed += by;
+    }
+};
+
+void reportLine(std::ostream& out, const std::string& name, const Total& total) {
+    out << std::setw(8) << total.count << std::setw(12) << millis(total.elapsed) << "  " << name
+        << "\n";
+}
+
+/**
+ * The file of a "file:line" source
+ */
+std::string sourceFile(const std::string& source) {
+    return source.substr(0, source.find_last_of(':'));
+}
+
+}
+
+void StartupProfile::record(
+    StartupOperation operation,
+    const std::string& subject,
+    const std::string& source,
+    std::chrono::steady_clock::duration elapsed
+) {
+    if (!isRecording()) {
+        return;
+    }
+    Profile& startup = profile();
+    std::lock_guard<std::mutex> lock(startup.mutex);
+    startup.entries.push_back({operation, subject, source, elapsed});
+}
+
+void StartupProfile::finish() {
+    recordingStartup().store(false, std::memory_order_relaxed);
+}
+
+bool StartupProfile::isRecording() {
+    return recordingStartup().load(std::memory_order_relaxed);
+}
+
+std::vector<StartupEntry> StartupProfile::entries() {
+    Profile& startup = profile();
+    std::lock_guard<std::mutex> lock(startup.mutex);
+    return startup.entries;
+}
+
+void StartupProfile::report(std::ostream& out, std::size_t slowest) {
+    std::vector<StartupEntry> recorded = entries();
+
+    std::array<Total, STARTUP_OPERATION_COUNT> operations;
+    std::map<std::string, Total> files;
+    for (const StartupEntry& entry : recorded) {
+        operations[entry.operation].add(entry.elapsed);
+        if (entry.operation == STARTUP_REGISTER_STEP) {
+            files[sourceFile(entry.source)].add(entry.elapsed);
+        }
+    }
+    std::vector<std::pair<std::string, Total>> byFile(files.begin(), files.end());
+    std::stable_sort(
+        byFile.begin(),
+        byFile.end(),
+        [](const std::pair<std::string, Total>& a, const std::pair<std::string, Total>& b) {
+            return a.second.elapsed > b.second.elapsed;
+        }
+    );
+    std::stable_sort(
+        recorded.begin(),
+        recorded.end(),
+        [](const StartupEntry& a, const StartupEntry& b) { return a.elapsed > b.elapsed; }
+    );
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision(3);
+    out << std::fixed << "Startup in milliseconds\n"
+        << std::setw(8) << "count" << std::setw(12) << "total" << "\n";
+    for (std::size_t i = 0; i < STARTUP_OPERATION_COUNT; ++i) {
+        reportLine(out, operationName(static_cast<StartupOperation>(i)), operations[i]);
+    }
+    for (const std::pair<std::string, Total>& file : byFile) {
+        reportLine(out, file.first, file.second);
+    }
+    out << "Slowest\n";
+    for (std::size_t i = 0; i < std::min(slowest, recorded.size()); ++i) {
+        const StartupEntry& entry = recorded[i];
+        out << std::setw(20) << millis(entry.elapsed) << "  " << operationName(entry.operation)
+            << ": " << entry.subject;
+        if (!entry.source.empty()) {
+            out << " (" << entry.source << ")";
+        }
+        out << "\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+    out.flush();
+}
+
+ScopedStartupTiming::ScopedStartupTiming(
+    StartupOperation operation, const std::string& subject, const std::string& source
+) :
+    operation(operation),
+    recording(StartupProfile::isRecording()),
+    subject(recording ? subject : std::string()),
+    source(recording ? source : std::string()) {
+    if (recording) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedStartupTiming::~ScopedStartupTiming() {
+    if (recording) {
+        StartupProfile::record(
+            operation, subject, source, std::chrono::steady_clock::now() - start
+        );
+    }
+}
+
+}
+}
@@ -0,0 +1,241 @@
+#include <cucumber-cpp/internal/StepBenchmark.hpp>
+#include <cucumber-cpp/internal/step/StepManager.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+thread_local StepBenchmark* currentBenchmark = NULL;
+
+const std::string BENCHMARK_TAG = "benchmark(";
+
+/**
+ * Arguments of a "benchmark(<key>=<value>,...)" tag, with or without its
+ * '@', false for other tags
+ */
+bool tagArguments(const std::string& tag, std::vector<std::pair<std::string, std::string>>& args) {
+    const std::size_t start = !tag.empty() && tag[0] == '@' ? 1 : 0;
+    if (tag.compare(start, BENCHMARK_TAG.size(), BENCHMARK_TAG) != 0 || tag.back() != ')') {
+        return false;
+    }
+    std::istringstream list(
+        tag.substr(start + BENCHMARK_TAG.size(), tag.size() - 1 - start - BENCHMARK_TAG.size())
+    );
+    std::string arg;
+    while (std::getline(list, arg, ',')) {
+        const std::size_t equals = arg.find('=');
+        if (equals == std::string::npos) {
+            throw std::invalid_argument("Malformed benchmark argument: " + arg);
+        }
+        args.emplace_back(arg.substr(0, equals), arg.substr(equals + 1));
+    }
+    return true;
+}
+
+std::size_t parseCount(const std::string& key, const std::string& value) {
+    std::size_t end = 0;
+    unsigned long long count = 0;
+    try {
+        if (!value.empty() && std::isdigit(static_cast<unsigned char>(value[0]))) {
+            count = std::stoull(value, &end);
+        }
+    } catch (const std::out_of_range&) {
+        end = 0;
+    }
+    if (end == 0 || end != value.size()) {
+        throw std::invalid_argument("Malformed benchmark " + key + ": " + value);
+    }
+    return static_cast<std::size_t>(count);
+}
+
+std::string describe(StepBenchmark::duration_type duration) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1)
+        << std::chrono::duration<double, std::micro>(duration).count() << "us";
+    return out.str();
+}
+
+/**
+ * Nearest rank of the sorted samples
+ */
+StepBenchmark::duration_type percentile(
+    const std::vector<StepBenchmark::duration_type>& sorted, double percent
+) {
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(percent / 100 * sorted.size()));
+    return sorted[std::max<std::size_t>(rank, 1) - 1];
+}
+
+}
+
+StepBenchmark::~StepBenchmark() {
+    if (currentBenchmark == this) {
+        currentBenchmark = NULL;
+    }
+}
+
+StepBenchmark StepBenchmark::fromTags(const std::vector<std::string>& tags) {
+    StepBenchmark benchmark;
+    bool warmupGiven = false;
+    for (const std::string& tag : tags) {
+        std::vector<std::pair<std::string, std::string>> args;
+        if (!tagArguments(tag, args)) {
+            continue;
+        }
+        for (const std::pair<std::string, std::string>& arg : args) {
+            if (arg.first == "iterations") {
+                benchmark.iterations = parseCount(arg.first, arg.second);
+            } else if (arg.first == "warmup") {
+                benchmark.warmup = parseCount(arg.first, arg.second);
+                warmupGiven = true;
+            } else if (arg.first == "mean") {
+                benchmark.mean = parseDuration(arg.second);
+            } else if (arg.first == "p50") {
+                benchmark.p50 = parseDuration(arg.second);
+            } else if (arg.first == "p90") {
+                benchmark.p90 = parseDuration(arg.second);
+            } else if (arg.first == "p99") {
+                benchmark.p99 = parseDuration(arg.second);
+            } else if (arg.first == "max") {
+                benchmark.max = parseDuration(arg.second);
+            } else {
+                throw std::invalid_argument("Unknown benchmark argument: " + arg.first);
+            }
+        }
+        if (benchmark.iterations == 0) {
+            throw std::invalid_argument("Benchmark without iterations: " + tag);
+        }
+    }
+    if (!warmupGiven) {
+        benchmark.warmup = benchmark.iterations / 10;
+    }
+    return benchmark;
+}
+
+StepBenchmark::duration_type StepBenchmark::parseDuration(const std::string& duration) {
+    std::size_t end = 0;
+    long long count = -1;
+    try {
+        if (!duration.empty() && std::isdigit(static_cast<unsigned char>(duration[0]))) {
+            count = std::stoll(duration, &end);
+        }
+    } catch (const std::out_of_range&) {
+    }
+    const std::string unit = duration.substr(end);
+    if (count >= 0 && unit == "ns") {
+        return duration_type(count);
+    } else if (count >= 0 && unit == "us") {
+        return std::chrono::microseconds(count);
+    } else if (count >= 0 && unit == "ms") {
+        return std::chrono::milliseconds(count);
+    } else if (count >= 0 && unit == "s") {
+        return std::chrono::seconds(count);
+    }
+    throw std::invalid_argument("Malformed benchmark duration: " + duration);
+}
+
+StepBenchmark::Statistics StepBenchmark::statistics(std::vector<duration_type> samples) {
+    Statistics statistics;
+    statistics.iterations = samples.size();
+    if (samples.empty()) {
+        return statistics;
+    }
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (const duration_type sample : samples) {
+        sum += sample.count();
+    }
+    const double mean = sum / samples.size();
+    double squares = 0;
+    for (const duration_type sample : samples) {
+        squares += (sample.count() - mean) * (sample.count() - mean);
+    }
+    statistics.mean = duration_type(std::llround(mean));
+    statistics.stddev = duration_type(std::llround(std::sqrt(squares / samples.size())));
+    statistics.min = samples.front();
+    statistics.p50 = percentile(samples, 50);
+    statistics.p90 = percentile(samples, 90);
+    statistics.p99 = percentile(samples, 99);
+    statistics.max = samples.back();
+    return statistics;
+}
+
+bool StepBenchmark::isEnabled() const {
+    return iterations > 0;
+}
+
+InvokeResult StepBenchmark::run(
+    const std::function<InvokeResult()>& step,
+    const std::function<void(duration_type)>& measured
+) const {
+    if (!isEnabled()) {
+        return step();
+    }
+    for (std::size_t i = 0; i < warmup; ++i) {
+        InvokeResult result = step();
+        if (!result.isSuccess()) {
+            return result;
+        }
+    }
+    std::vector<duration_type> samples;
+    samples.reserve(iterations);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        InvokeResult result = step();
+        const duration_type elapsed = std::chrono::steady_clock::now() - start;
+        if (!result.isSuccess()) {
+            return result;
+        }
+        samples.push_back(elapsed);
+        if (measured) {
+            measured(elapsed);
+        }
+    }
+
+    const Statistics measuredStatistics = statistics(std::move(samples));
+    const std::pair<const char*, std::pair<duration_type, duration_type>> limits[] = {
+        {"mean", {mean, measuredStatistics.mean}},
+        {"p50", {p50, measuredStatistics.p50}},
+        {"p90", {p90, measuredStatistics.p90}},
+        {"p99", {p99, measuredStatistics.p99}},
+        {"max", {max, measuredStatistics.max}},
+    };
+    for (const auto& limit : limits) {
+        const duration_type allowed = limit.second.first;
+        const duration_type actual = limit.second.second;
+        if (allowed.count() > 0 && actual > allowed) {
+            return InvokeResult::failure(
+                "Benchmark " + std::string(limit.first) + " of " + describe(actual)
+                + " exceeds " + describe(allowed) + " over " + std::to_string(iterations)
+                + " iterations (mean " + describe(measuredStatistics.mean) + ", stddev "
+                + describe(measuredStatistics.stddev) + ", min " + describe(measuredStatistics.min)
+                + ", p50 " + describe(measuredStatistics.p50) + ", p90 "
+                + describe(measuredStatistics.p90) + ", p99 " + describe(measuredStatistics.p99)
+                + ", max " + describe(measuredStatistics.max) + ")"
+            );
+        }
+    }
+    return InvokeResult::success();
+}
+
+StepBenchmark& StepBenchmark::current() {
+    if (!currentBenchmark) {
+        thread_local StepBenchmark threadBenchmark;
+        currentBenchmark = &threadBenchmark;
+    }
+    return *currentBenchmark;
+}
+
+void StepBenchmark::makeCurrent() {
+    currentBenchmark = this;
+}
+
+}
+}
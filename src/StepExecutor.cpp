@@ -0,0 +1,36 @@
+#include <cucumber-cpp/internal/step/StepExecutor.hpp>
+
+#include <chrono>
+
+namespace cucumber {
+namespace internal {
+
+void QueuedStepExecutor::post(task_type task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    posted.notify_one();
+}
+
+void QueuedStepExecutor::runOne() {
+    task_type task;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (tasks.empty()) {
+            posted.wait_for(lock, std::chrono::seconds(1));
+        }
+        task = std::move(tasks.front());
+        tasks.pop_front();
+    }
+    task();
+}
+
+void QueuedStepExecutor::runUntil(const std::function<bool()>& done) {
+    while (!done()) {
+        runOne();
+    }
+}
+
+}
+}
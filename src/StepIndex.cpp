@@ -0,0 +1,514 @@
+#include <cucumber-cpp/internal/step/StepIndex.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+bool isRegexMetaCharacter(const char c) {
+    return std::strchr(".[]()*+?{}|^$\\", c) != NULL;
+}
+
+bool isOptionalQuantifier(const char c) {
+    return c == '*' || c == '?' || c == '{';
+}
+
+/**
+ * Whether the quantifier at i lets the atom before it appear zero times: *, ?,
+ * {0}, {0,} or {0,m}
+ */
+bool isZeroMinimumQuantifier(const std::string& regex, std::string::size_type i) {
+    if (regex[i] != '{') {
+        return regex[i] == '*' || regex[i] == '?';
+    }
+    while (++i < regex.size() && regex[i] == '0') {
+    }
+    return i == regex.size() || !std::isdigit(static_cast<unsigned char>(regex[i]));
+}
+
+std::string::size_type skipBraceQuantifier(const std::string& regex, std::string::size_type i) {
+    const std::string::size_type end = regex.find('}', i);
+    return end == std::string::npos ? regex.size() : end + 1;
+}
+
+bool isEscapedLiteral(const std::string& regex, const std::string::size_type i) {
+    // Only escaped punctuation stands for itself: \d, \w, \b, \1... do not
+    return i < regex.size() && !std::isalnum(static_cast<unsigned char>(regex[i]));
+}
+
+std::string::size_type skipGroupOrCharacterClass(
+    const std::string& regex, std::string::size_type i
+) {
+    int depth = 0;
+    bool inCharacterClass = false;
+    for (; i < regex.size(); ++i) {
+        const char c = regex[i];
+        if (c == '\\') {
+            ++i;
+        } else if (inCharacterClass) {
+            inCharacterClass = (c != ']');
+        } else if (c == '[') {
+            inCharacterClass = true;
+        } else if (c == '(') {
+            ++depth;
+        } else if (c == ')') {
+            --depth;
+        }
+        if (depth == 0 && !inCharacterClass) {
+            return i + 1;
+        }
+    }
+    return i;
+}
+
+bool hasTopLevelAlternation(const std::string& regex) {
+    int depth = 0;
+    bool inCharacterClass = false;
+    for (std::string::size_type i = 0; i < regex.size(); ++i) {
+        const char c = regex[i];
+        if (c == '\\') {
+            ++i;
+        } else if (inCharacterClass) {
+            inCharacterClass = (c != ']');
+        } else if (c == '[') {
+            inCharacterClass = true;
+        } else if (c == '(') {
+            ++depth;
+        } else if (c == ')') {
+            --depth;
+        } else if (c == '|' && depth == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+RegexLiteralPrefix extractLiteralPrefix(const std::string& regex) {
+    RegexLiteralPrefix prefix;
+    std::string::size_type i = 0;
+    prefix.anchored = !regex.empty() && regex[0] == '^';
+    if (prefix.anchored) {
+        ++i;
+    }
+    if (hasTopLevelAlternation(regex)) {
+        return prefix;
+    }
+
+    while (i < regex.size()) {
+        char literal = regex[i];
+        std::string::size_type next = i + 1;
+        if (literal == '\\') {
+            if (!isEscapedLiteral(regex, next)) {
+                break;
+            }
+            literal = regex[next++];
+        } else if (isRegexMetaCharacter(literal)) {
+            break;
+        }
+
+        if (next < regex.size() && isOptionalQuantifier(regex[next])) {
+            break;
+        }
+        prefix.text += literal;
+        if (next < regex.size() && regex[next] == '+') {
+            break;
+        }
+        i = next;
+    }
+    return prefix;
+}
+
+std::vector<std::string> extractRequiredLiterals(const std::string& regex) {
+    std::vector<std::string> literals;
+    if (hasTopLevelAlternation(regex)) {
+        return literals;
+    }
+
+    std::string current;
+    const auto endLiteral = [&literals, &current]() {
+        if (!current.empty()
+            && std::find(literals.begin(), literals.end(), current) == literals.end()) {
+            literals.push_back(current);
+        }
+        current.clear();
+    };
+
+    std::string::size_type i = 0;
+    while (i < regex.size()) {
+        char literal = regex[i];
+        std::string::size_type next = i + 1;
+        if (literal == '(' || literal == '[') {
+            endLiteral();
+            i = skipGroupOrCharacterClass(regex, i);
+            continue;
+        } else if (literal == '\\') {
+            if (!isEscapedLiteral(regex, next)) {
+                endLiteral();
+                i = next + 1;
+                continue;
+            }
+            literal = regex[next++];
+        } else if (literal == '{') {
+            // The digits of the quantifier are no literals of the text
+            endLiteral();
+            i = skipBraceQuantifier(regex, i);
+            continue;
+        } else if (isRegexMetaCharacter(literal)) {
+            endLiteral();
+            i = next;
+            continue;
+        }
+
+        if (next < regex.size() && isZeroMinimumQuantifier(regex, next)) {
+            endLiteral();
+        } else {
+            current += literal;
+            if (next < regex.size() && (regex[next] == '+' || regex[next] == '{')) {
+                endLiteral();
+            }
+        }
+        i = next;
+    }
+    endLiteral();
+    return literals;
+}
+
+LiteralAutomaton::LiteralAutomaton() :
+    nodes(1),
+    inserted(0),
+    built(false) {
+}
+
+LiteralAutomaton::literal_id_type LiteralAutomaton::add(const std::string& literal) {
+    literals.push_back(literal);
+    built = false;
+    return literals.size() - 1;
+}
+
+LiteralAutomaton::literal_id_type LiteralAutomaton::size() const {
+    return literals.size();
+}
+
+void LiteralAutomaton::build() const {
+    nodes[0].fail = 0;
+    for (literal_id_type id = inserted; id < literals.size(); ++id) {
+        std::size_t node = 0;
+        for (const char c : literals[id]) {
+            const auto next = nodes[node].next.find(c);
+            if (next != nodes[node].next.end()) {
+                node = next->second;
+            } else {
+                nodes.push_back(Node());
+                nodes[node].next[c] = nodes.size() - 1;
+                node = nodes.size() - 1;
+            }
+        }
+        nodes[node].terminal.push_back(id);
+    }
+    inserted = literals.size();
+
+    // Breadth-first traversal, so that failure links always point to nodes already done
+    nodes[0].output = nodes[0].terminal;
+    std::vector<std::size_t> queue;
+    for (const auto& child : nodes[0].next) {
+        nodes[child.second].fail = 0;
+        nodes[child.second].output = nodes[child.second].terminal;
+        queue.push_back(child.second);
+    }
+    for (std::vector<std::size_t>::size_type head = 0; head < queue.size(); ++head) {
+        const std::size_t node = queue[head];
+        for (const auto& child : nodes[node].next) {
+            std::size_t fail = nodes[node].fail;
+            while (fail != 0 && nodes[fail].next.count(child.first) == 0) {
+                fail = nodes[fail].fail;
+            }
+            const auto failNext = nodes[fail].next.find(child.first);
+            nodes[child.second].fail =
+                (failNext != nodes[fail].next.end() && failNext->second != child.second)
+                    ? failNext->second
+                    : 0;
+            const std::vector<literal_id_type>& inherited = nodes[nodes[child.second].fail].output;
+            nodes[child.second].output = nodes[child.second].terminal;
+            nodes[child.second].output.insert(
+                nodes[child.second].output.end(), inherited.begin(), inherited.end()
+            );
+            queue.push_back(child.second);
+        }
+    }
+    built = true;
+}
+
+void LiteralAutomaton::prepare() const {
+    if (!built) {
+        build();
+    }
+}
+
+std::vector<bool> LiteralAutomaton::find(const std::string& text) const {
+    std::vector<bool> found;
+    find(text, found);
+    return found;
+}
+
+void LiteralAutomaton::find(const std::string& text, std::vector<bool>& found) const {
+    prepare();
+    found.assign(literals.size(), false);
+    std::size_t node = 0;
+    for (const char c : text) {
+        auto next = nodes[node].next.find(c);
+        while (node != 0 && next == nodes[node].next.end()) {
+            node = nodes[node].fail;
+            next = nodes[node].next.find(c);
+        }
+        node = (next != nodes[node].next.end()) ? next->second : 0;
+        for (const literal_id_type id : nodes[node].output) {
+            found[id] = true;
+        }
+    }
+}
+
+StepIndex::TrieNode::TrieNode(const TrieNode& other) :
+    ids(other.ids) {
+    for (const auto& child : other.children) {
+        children[child.first].reset(new TrieNode(*child.second));
+    }
+}
+
+StepIndex::TrieNode& StepIndex::TrieNode::operator=(const TrieNode& other) {
+    if (this != &other) {
+        TrieNode copy(other);
+        children = std::move(copy.children);
+        ids = std::move(copy.ids);
+    }
+    return *this;
+}
+
+StepIndex::StepIndex(StepIndexMode mode) :
+    mode(mode) {
+}
+
+StepIndexMode StepIndex::getMode() const {
+    return mode;
+}
+
+void StepIndex::add(step_id_type id, const std::string& regex) {
+    const std::vector<std::string> literals =
+        mode == MULTI_PATTERN_INDEX ? extractRequiredLiterals(regex) : std::vector<std::string>();
+    add(id, extractLiteralPrefix(regex), literals);
+}
+
+void StepIndex::add(
+    step_id_type id, const RegexLiteralPrefix& prefix, const std::vector<std::string>& literals
+) {
+    prefixes.push_back(std::make_pair(id, prefix));
+    analysed = false;
+    if (mode == MULTI_PATTERN_INDEX) {
+        RequiredLiterals required = {id, prefix, {}};
+        for (const std::string& literal : literals) {
+            const auto known = automatonLiterals.find(literal);
+            if (known != automatonLiterals.end()) {
+                required.literals.push_back(known->second);
+            } else {
+                const LiteralAutomaton::literal_id_type literalId = automaton.add(literal);
+                automatonLiterals.insert(std::make_pair(literal, literalId));
+                required.literals.push_back(literalId);
+            }
+        }
+        requiredLiterals.push_back(required);
+        return;
+    }
+
+    if (!prefix.anchored) {
+        unanchoredPrefixes.push_back(std::make_pair(id, prefix.text));
+        return;
+    }
+
+    TrieNode* node = &anchoredPrefixes;
+    for (const char c : prefix.text) {
+        std::unique_ptr<TrieNode>& child = node->children[c];
+        if (!child) {
+            child.reset(new TrieNode);
+        }
+        node = child.get();
+    }
+    node->ids.push_back(id);
+}
+
+void StepIndex::clear() {
+    anchoredPrefixes.children.clear();
+    anchoredPrefixes.ids.clear();
+    unanchoredPrefixes.clear();
+    automaton = LiteralAutomaton();
+    automatonLiterals.clear();
+    requiredLiterals.clear();
+    prefixes.clear();
+    analysed = false;
+}
+
+void StepIndex::prepare() const {
+    automaton.prepare();
+    if (!analysed) {
+        analyseAmbiguity();
+        analysed = true;
+    }
+}
+
+bool StepIndex::isUnambiguous(step_id_type id) const {
+    return analysed && id < unambiguous.size() && unambiguous[id];
+}
+
+void StepIndex::analyseAmbiguity() const {
+    unambiguous.assign(unambiguous.size(), false);
+    std::vector<const std::pair<step_id_type, RegexLiteralPrefix>*> anchored;
+    for (const std::pair<step_id_type, RegexLiteralPrefix>& prefix : prefixes) {
+        // Might match wherever any other step does
+        if (!prefix.second.anchored || prefix.second.text.empty()) {
+            return;
+        }
+        anchored.push_back(&prefix);
+    }
+    std::sort(anchored.begin(), anchored.end(), [](const auto* a, const auto* b) {
+        return a->second.text < b->second.text;
+    });
+
+    // Sorted, the prefixes of a prefix come before it: those still on the
+    // stack once the others are popped
+    std::vector<bool> overlapping(anchored.size(), false);
+    std::vector<std::size_t> stack;
+    for (std::size_t i = 0; i < anchored.size(); ++i) {
+        const std::string& text = anchored[i]->second.text;
+        while (!stack.empty()) {
+            const std::string& outer = anchored[stack.back()]->second.text;
+            if (text.compare(0, outer.size(), outer) == 0) {
+                break;
+            }
+            stack.pop_back();
+        }
+        if (!stack.empty()) {
+            overlapping[i] = true;
+            overlapping[stack.back()] = true;
+        }
+        stack.push_back(i);
+    }
+
+    for (std::size_t i = 0; i < anchored.size(); ++i) {
+        const step_id_type id = anchored[i]->first;
+        if (id >= unambiguous.size()) {
+            unambiguous.resize(id + 1, false);
+        }
+        unambiguous[id] = !overlapping[i];
+    }
+}
+
+StepIndex::candidates_type StepIndex::candidates(const std::string& stepDescription) const {
+    StepIndexLookup lookup;
+    candidates(stepDescription, lookup);
+    return std::move(lookup.candidates);
+}
+
+void StepIndex::candidates(const std::string& stepDescription, StepIndexLookup& lookup) const {
+    lookup.candidates.clear();
+    if (mode == MULTI_PATTERN_INDEX) {
+        automatonCandidates(stepDescription, lookup);
+    } else {
+        prefixCandidates(stepDescription, lookup);
+    }
+    std::sort(lookup.candidates.begin(), lookup.candidates.end());
+}
+
+StepIndex::candidates_type StepIndex::prefixedCandidates(const std::string& descriptionPrefix
+) const {
+    candidates_type result;
+    // Unanchored literals may be anywhere in the rest of the description
+    if (mode == MULTI_PATTERN_INDEX) {
+        for (const RequiredLiterals& required : requiredLiterals) {
+            const std::string& prefix = required.prefix.text;
+            const std::size_t common = std::min(prefix.size(), descriptionPrefix.size());
+            if (!required.prefix.anchored
+                || prefix.compare(0, common, descriptionPrefix, 0, common) == 0) {
+                result.push_back(required.id);
+            }
+        }
+    } else {
+        const TrieNode* node = &anchoredPrefixes;
+        result.insert(result.end(), node->ids.begin(), node->ids.end());
+        for (const char c : descriptionPrefix) {
+            const auto child = node->children.find(c);
+            if (child == node->children.end()) {
+                node = nullptr;
+                break;
+            }
+            node = child->second.get();
+            result.insert(result.end(), node->ids.begin(), node->ids.end());
+        }
+        // Longer prefixes can still follow the given text
+        if (node != nullptr) {
+            for (const auto& child : node->children) {
+                subtreeCandidates(*child.second, result);
+            }
+        }
+        for (const auto& unanchored : unanchoredPrefixes) {
+            result.push_back(unanchored.first);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void StepIndex::subtreeCandidates(const TrieNode& node, candidates_type& result) {
+    result.insert(result.end(), node.ids.begin(), node.ids.end());
+    for (const auto& child : node.children) {
+        subtreeCandidates(*child.second, result);
+    }
+}
+
+void StepIndex::automatonCandidates(
+    const std::string& stepDescription, StepIndexLookup& lookup
+) const {
+    automaton.find(stepDescription, lookup.literalsFound);
+    for (const RequiredLiterals& required : requiredLiterals) {
+        if (required.prefix.anchored
+            && stepDescription.compare(0, required.prefix.text.size(), required.prefix.text) != 0) {
+            continue;
+        }
+        bool allFound = true;
+        for (const LiteralAutomaton::literal_id_type literal : required.literals) {
+            allFound = allFound && lookup.literalsFound[literal];
+        }
+        if (allFound) {
+            lookup.candidates.push_back(required.id);
+        }
+    }
+}
+
+void StepIndex::prefixCandidates(
+    const std::string& stepDescription, StepIndexLookup& lookup
+) const {
+    candidates_type& result = lookup.candidates;
+
+    const TrieNode* node = &anchoredPrefixes;
+    result.insert(result.end(), node->ids.begin(), node->ids.end());
+    for (const char c : stepDescription) {
+        const auto child = node->children.find(c);
+        if (child == node->children.end()) {
+            break;
+        }
+        node = child->second.get();
+        result.insert(result.end(), node->ids.begin(), node->ids.end());
+    }
+
+    for (const auto& unanchored : unanchoredPrefixes) {
+        if (stepDescription.find(unanchored.second) != std::string::npos) {
+            result.push_back(unanchored.first);
+        }
+    }
+}
+
+}
+}
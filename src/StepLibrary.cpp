@@ -0,0 +1,65 @@
+#include "cucumber-cpp/internal/step/StepLibrary.hpp"
+#include "cucumber-cpp/internal/step/StepManager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <dlfcn.h>
+#endif
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+std::mutex librariesMutex;
+std::vector<std::string> libraries;
+std::atomic<bool> loadableByClients(false);
+
+void openLibrary(const std::string& path) {
+#if defined(_WIN32)
+    if (::LoadLibraryA(path.c_str()) == NULL) {
+        throw std::runtime_error(
+            "Cannot load " + path + ": error " + std::to_string(::GetLastError())
+        );
+    }
+#else
+    // Global, so that libraries loaded later resolve against it
+    if (::dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL) == NULL) {
+        throw std::runtime_error(::dlerror());
+    }
+#endif
+}
+}
+
+std::size_t StepLibraries::load(const std::string& path) {
+    std::lock_guard<std::mutex> lock(librariesMutex);
+    if (std::find(libraries.begin(), libraries.end(), path) != libraries.end()) {
+        return 0;
+    }
+    const std::size_t stepsBefore = StepManager::getSteps().size();
+    openLibrary(path);
+    libraries.push_back(path);
+    return StepManager::getSteps().size() - stepsBefore;
+}
+
+std::vector<std::string> StepLibraries::loaded() {
+    std::lock_guard<std::mutex> lock(librariesMutex);
+    return libraries;
+}
+
+void StepLibraries::setLoadableByClients(const bool loadable) {
+    loadableByClients = loadable;
+}
+
+bool StepLibraries::isLoadableByClients() {
+    return loadableByClients;
+}
+
+}
+}
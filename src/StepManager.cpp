@@ -1,15 +1,33 @@
 #include "cucumber-cpp/internal/step/StepManager.hpp"
-#include "cucumber-cpp/internal/utils/CucumberExpression.hpp"
-
+#include "cucumber-cpp/internal/step/StepIndex.hpp"
+#include "cucumber-cpp/internal/step/StepSnapshot.hpp"
+#include "cucumber-cpp/internal/Timings.hpp"
+#include "cucumber-cpp/internal/TraceRecorder.hpp"
+#include "cucumber-cpp/internal/utils/StaticCucumberExpression.hpp"
+#include "cucumber-cpp/internal/utils/StringPool.hpp"
+#include "cucumber-cpp/internal/utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace cucumber {
 namespace internal {
 
 namespace {
 
-std::string transformCucumberExpression(const std::string& expression) {
+template<typename Result>
+Result convertCucumberExpression(
+    const std::string& expression, Result (*conversion)(const std::string&)
+) {
     try {
-        return cukex::transform(expression);
+        return conversion(expression);
     } catch (const std::exception& ex) {
         std::cout << "Error: '" << expression
                     << "' is neither a valid Regular Expression nor a Cucumber Expression." << std::endl;
@@ -17,45 +35,261 @@ std::string transformCucumberExpression(const std::string& expression) {
     }
 }
 
-std::string getRegexString(const std::string& stepMatcher) {
-    std::string regexStr;
+/**
+ * Compiles the step matcher exactly once: as a regular expression if it is
+ * one, otherwise as the regular expression of its Cucumber Expression.
+ * Parameter types are looked for first, as some regex backends take {int}
+ * for literal text.
+ */
+Regex compileStepMatcher(const std::string& stepMatcher) {
+    if (hasParameterType(stepMatcher)) {
+        return convertCucumberExpression(stepMatcher, &cukex::compile);
+    }
     try {
-        std::regex testRegex(stepMatcher);
-        regexStr = stepMatcher;
+        const ScopedStartupTiming timing(STARTUP_COMPILE_REGEX, stepMatcher);
+        return Regex(stepMatcher);
     } catch (const std::regex_error& e) {
-        regexStr = transformCucumberExpression(stepMatcher);
+        return convertCucumberExpression(stepMatcher, &cukex::compile);
+    }
+}
+
+/**
+ * Like compileStepMatcher but leaves the compilation to the first match,
+ * which is why it cannot fall back on a regular expression being invalid.
+ */
+Regex deferStepMatcher(const std::string& stepMatcher) {
+    if (hasParameterType(stepMatcher)) {
+        return Regex(
+            convertCucumberExpression(stepMatcher, &cukex::transformUnchecked),
+            COMPILE_ON_FIRST_USE
+        );
+    }
+    return Regex(stepMatcher, COMPILE_ON_FIRST_USE);
+}
+
+/**
+ * Guards the draft of the next registry and its publication
+ */
+std::mutex& registrationMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Bumped with every change of the draft, ahead of the published version
+std::atomic<std::uint64_t> draftVersion(1);
+std::uint64_t publishedVersion = 0;
+
+/**
+ * Guards the match cache against concurrent sessions, which only share the
+ * lock while they look it up
+ */
+std::shared_mutex& matchCacheMutex() {
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
+/**
+ * Guards the hot ranks while first match only is enabled
+ */
+std::mutex& rankingMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::atomic<std::uint64_t> stepMatchesCalls(0);
+std::atomic<std::uint64_t> stepMatchesCacheHits(0);
+std::atomic<std::uint64_t> stepMatchesGeneration(0);
+
+// Workers in addition to the thread calling stepMatches
+std::unique_ptr<ThreadPool>& matchingPool() {
+    static std::unique_ptr<ThreadPool> pool;
+    return pool;
+}
+
+std::atomic<bool>& lazyCompilation() {
+#ifdef CUKE_LAZY_STEP_COMPILATION
+    static std::atomic<bool> lazy(true);
+#else
+    static std::atomic<bool> lazy(false);
+#endif
+    return lazy;
+}
+
+std::atomic<bool>& instanceReuse() {
+#ifdef CUKE_REUSE_STEP_INSTANCES
+    static std::atomic<bool> reuse(true);
+#else
+    static std::atomic<bool> reuse(false);
+#endif
+    return reuse;
+}
+
+// Step definitions are never freed, so neither are their strings
+StringPool& stepStrings() {
+    static StringPool* const pool = new StringPool;
+    return *pool;
+}
+
+std::atomic<bool>& firstMatchOnly() {
+    static std::atomic<bool> firstMatch(false);
+    return firstMatch;
+}
+
+// Matches counted since the step definitions were last ranked
+std::atomic<std::uint64_t> matchesSinceRanking(0);
+
+std::shared_ptr<const std::vector<std::uint32_t>>& hotRanks() {
+    static std::shared_ptr<const std::vector<std::uint32_t>> ranks;
+    return ranks;
+}
+
+/**
+ * Ids beyond the ranks, of steps registered since, come last in id order
+ */
+void sortByRank(std::vector<step_id_type>& ids, const std::vector<std::uint32_t>& ranks) {
+    const auto rank = [&ranks](step_id_type id) {
+        return id < ranks.size() ? ranks[id] : ranks.size() + id;
+    };
+    std::sort(ids.begin(), ids.end(), [&rank](step_id_type a, step_id_type b) {
+        return rank(a) < rank(b);
+    });
+}
+
+const StepSnapshotEntry* findInSnapshot(
+    const std::shared_ptr<const StepSnapshot>& snapshot, const std::string& stepMatcher
+) {
+    return snapshot ? snapshot->find(stepMatcher) : nullptr;
+}
+
+Regex stepMatcherRegex(const std::string& stepMatcher, const StepSnapshotEntry* snapshot) {
+    if (snapshot) {
+        // Known to compile, so nothing is lost by compiling it later
+        return Regex(snapshot->regex, COMPILE_ON_FIRST_USE);
     }
-    return regexStr;
+    return lazyCompilation().load(std::memory_order_relaxed) ? deferStepMatcher(stepMatcher)
+                                                             : compileStepMatcher(stepMatcher);
+}
+
+std::shared_ptr<const CucumberExpressionMatcher> snapshotMatcher(const StepSnapshotEntry& snapshot
+) {
+    return snapshot.hasMatcher ? std::make_shared<CucumberExpressionMatcher>(snapshot.segments)
+                               : nullptr;
 }
 }
 
 StepInfo::StepInfo(const std::string& stepMatcher, const std::string source) :
-    regex(getRegexString(stepMatcher)),
-    source(source),
-    stepDef(stepMatcher) {
+    // The snapshot is kept alive until the delegated constructor returns
+    StepInfo(stepMatcher, source, findInSnapshot(StepSnapshot::loaded(), stepMatcher)) {
+}
+
+StepInfo::StepInfo(
+    const std::string& stepMatcher, const std::string& source, const StepSnapshotEntry* snapshot
+) :
+    regex(stepMatcherRegex(stepMatcher, snapshot)),
+    source(stepStrings().intern(source)),
+    stepDef(stepStrings().intern(stepMatcher)),
+    // Regular expressions are used as they are, Cucumber Expressions never are
+    parameters(
+        snapshot                     ? snapshot->parameters
+        : regex.str() != stepMatcher ? cukex::parameters(stepMatcher)
+                                     : std::vector<CucumberExpressionParameter>()
+    ),
+    matchCount(0),
+    matcher(
+        snapshot                     ? snapshotMatcher(*snapshot)
+        : regex.str() != stepMatcher ? cukex::matcher(stepMatcher)
+                                     : nullptr
+    ) {
     static step_id_type currentId = 0;
     id = ++currentId;
 }
 
+StepInfo::argument_indexes_type StepInfo::bindArguments(
+    const std::vector<StepArgumentKind>& arguments
+) const {
+    argument_indexes_type indexes;
+    if (regex.str() == stepDef) {
+        return indexes;
+    }
+    if (arguments.size() > parameters.size()) {
+        throw std::invalid_argument(
+            "Step \"" + std::string(stepDef) + "\" takes " + std::to_string(arguments.size())
+            + " arguments but has only " + std::to_string(parameters.size()) + " parameters"
+        );
+    }
+    for (std::vector<StepArgumentKind>::size_type i = 0; i < arguments.size(); ++i) {
+        const std::string& type = parameters[i].type;
+        if (arguments[i] == INTEGRAL_ARGUMENT
+            && (type == "float" || type == "double" || type == "bigdecimal")) {
+            throw std::invalid_argument(
+                "Step \"" + std::string(stepDef) + "\" reads its {" + type + "} parameter "
+                + std::to_string(i + 1) + " into an integer"
+            );
+        }
+        indexes.push_back(parameters[i].group);
+    }
+    return indexes;
+}
+
 SingleStepMatch StepInfo::matches(const std::string& stepDescription) const {
+    if (matcher && CucumberExpressionMatcher::handles(stepDescription)) {
+        return singleStepMatch(*matcher->find(stepDescription));
+    }
+    try {
+        return singleStepMatch(*regex.find(stepDescription));
+    } catch (const RegexComplexityError& e) {
+        throw complexityError(e);
+    }
+}
+
+bool StepInfo::matches(
+    const std::string& stepDescription, std::vector<RegexSubmatchSpan>& submatches
+) const {
+    if (matcher && CucumberExpressionMatcher::handles(stepDescription)) {
+        return matcher->find(stepDescription, submatches);
+    }
+    try {
+        return regex.find(stepDescription, submatches);
+    } catch (const RegexComplexityError& e) {
+        throw complexityError(e);
+    }
+}
+
+SingleStepMatch StepInfo::singleStepMatch(RegexMatch& regexMatch) const {
     SingleStepMatch stepMatch;
-    std::shared_ptr<RegexMatch> regexMatch(regex.find(stepDescription));
-    if (regexMatch->matches()) {
-        stepMatch.stepInfo = shared_from_this();
-        stepMatch.submatches = regexMatch->getSubmatches();
+    if (regexMatch.matches()) {
+        stepMatch.stepInfo = this;
+        stepMatch.submatches = regexMatch.getSubmatches();
     }
     return stepMatch;
 }
 
+RegexComplexityError StepInfo::complexityError(const RegexComplexityError& e) const {
+    return RegexComplexityError(
+        "Gave up matching step definition " + std::string(stepDef) + " ("
+        + std::string(source) + "): " + e.what()
+    );
+}
+
+bool StepInfo::isAsync() const {
+    return false;
+}
+
+void StepInfo::invokeStepAsync(
+    const InvokeArgs* pArgs, StepExecutor& /*executor*/, invoke_callback_type done
+) const {
+    done(invokeStep(pArgs));
+}
+
 SingleStepMatch::operator const void*() const {
-    return stepInfo.get();
+    return stepInfo;
 }
 
 MatchResult::operator bool() const {
     return !resultSet.empty();
 }
 
-const MatchResult::match_results_type& MatchResult::getResultSet() {
+const MatchResult::match_results_type& MatchResult::getResultSet() const {
     return resultSet;
 }
 
@@ -63,50 +297,121 @@ void MatchResult::addMatch(SingleStepMatch match) {
     resultSet.push_back(match);
 }
 
-void InvokeArgs::addArg(const std::string arg) {
-    args.push_back(arg);
+void StepMatchBuffer::clear() {
+    matches.clear();
+    submatches.clear();
+}
+
+const StepMatchBuffer::matches_type& StepMatchBuffer::getMatches() const {
+    return matches;
+}
+
+const RegexSubmatchSpan& StepMatchBuffer::getSubmatch(
+    const Match& match, submatches_type::size_type i
+) const {
+    return submatches[match.firstSubmatch + i];
+}
+
+void InvokeArgs::addArg(std::string arg) {
+    args.push_back(std::move(arg));
+}
+
+void InvokeArgs::setTableArg(raw_table_type&& table) {
+    for (raw_table_type::size_type i = 1; i < table.size(); ++i) {
+        if (table[i].size() != table.front().size()) {
+            throw std::range_error("Row size does not match the table column size");
+        }
+    }
+    rawTableArg = std::move(table);
+    tableArg = Table();
 }
 
 const Table& InvokeArgs::getTableArg() const {
+    buildTableArg();
     return tableArg;
 }
 
 Table& InvokeArgs::getVariableTableArg() {
+    buildTableArg();
     return tableArg;
 }
 
-InvokeResult::InvokeResult(const InvokeResultType type, const char* description) :
-    type(type) {
-    if (description) {
-        this->description = description;
+std::string InvokeArgs::fingerprint() const {
+    std::string key;
+    const auto append = [&key](const std::string& field) {
+        key += std::to_string(field.size());
+        key += ':';
+        key += field;
     };
+    for (const std::string& arg : args) {
+        append(arg);
+    }
+    key += '|';
+    if (!rawTableArg.empty()) {
+        for (const args_type& row : rawTableArg) {
+            for (const std::string& cell : row) {
+                append(cell);
+            }
+            key += ';';
+        }
+    } else if (!tableArg.getColumns().empty()) {
+        for (const std::string& column : tableArg.getColumns()) {
+            append(column);
+        }
+        key += ';';
+        for (const Table::RowView row : tableArg.rows()) {
+            for (const std::string& cell : row) {
+                append(cell);
+            }
+            key += ';';
+        }
+    }
+    return key;
 }
 
-InvokeResult::InvokeResult() :
-    type(FAILURE) {
+void InvokeArgs::buildTableArg() const {
+    if (rawTableArg.empty()) {
+        return;
+    }
+    raw_table_type table;
+    table.swap(rawTableArg);
+    for (std::string& column : table.front()) {
+        tableArg.addColumn(std::move(column));
+    }
+    tableArg.reserveRows(table.size() - 1);
+    for (raw_table_type::size_type i = 1; i < table.size(); ++i) {
+        tableArg.addRow(std::move(table[i]));
+    }
+}
+
+InvokeResult::InvokeResult(const InvokeResultType type, const char* description) :
+    type(type),
+    description(
+        description && *description ? std::make_shared<const std::string>(description) : nullptr
+    ) {
 }
 
-InvokeResult::InvokeResult(const InvokeResult& ir) :
-    type(ir.type),
-    description(ir.description) {
+InvokeResult::InvokeResult(const InvokeResultType type, std::string&& description) :
+    type(type),
+    description(
+        description.empty() ? nullptr : std::make_shared<const std::string>(std::move(description))
+    ) {
 }
 
-InvokeResult& InvokeResult::operator=(const InvokeResult& rhs) {
-    this->type = rhs.type;
-    this->description = rhs.description;
-    return *this;
+InvokeResult::InvokeResult() :
+    type(FAILURE) {
 }
 
 InvokeResult InvokeResult::success() {
-    return InvokeResult(SUCCESS, 0);
+    return InvokeResult(SUCCESS, nullptr);
 }
 
 InvokeResult InvokeResult::failure(const char* description) {
     return InvokeResult(FAILURE, description);
 }
 
-InvokeResult InvokeResult::failure(const std::string& description) {
-    return InvokeResult(FAILURE, description.c_str());
+InvokeResult InvokeResult::failure(std::string description) {
+    return InvokeResult(FAILURE, std::move(description));
 }
 
 InvokeResult InvokeResult::pending(const char* description) {
@@ -126,31 +431,461 @@ InvokeResultType InvokeResult::getType() const {
 }
 
 const std::string& InvokeResult::getDescription() const {
-    return description;
+    static const std::string noDescription;
+    return description ? *description : noDescription;
+}
+
+bool InvokeResult::isIdempotent() const {
+    return idempotent;
+}
+
+void InvokeResult::setIdempotent() {
+    idempotent = true;
 }
 
+struct StepManager::Registry {
+    steps_type steps;
+    StepIndex index;
+};
+
 step_id_type StepManager::addStep(std::shared_ptr<StepInfo> stepInfo) {
-    return steps().insert(std::make_pair(stepInfo->id, stepInfo)).first->first;
+    const step_id_type id = stepInfo->id;
+    const std::shared_ptr<const StepSnapshot> snapshot = StepSnapshot::loaded();
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    insertStep(std::move(stepInfo), snapshot.get());
+    draftChanged();
+    return id;
+}
+
+void StepManager::addSteps(const std::vector<std::shared_ptr<StepInfo>>& stepInfos) {
+    step_id_type lastId = 0;
+    for (const std::shared_ptr<StepInfo>& stepInfo : stepInfos) {
+        lastId = std::max(lastId, stepInfo->id);
+    }
+    const std::shared_ptr<const StepSnapshot> snapshot = StepSnapshot::loaded();
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    if (lastId >= steps().size()) {
+        steps().resize(lastId + 1);
+    }
+    for (const std::shared_ptr<StepInfo>& stepInfo : stepInfos) {
+        insertStep(stepInfo, snapshot.get());
+    }
+    draftChanged();
+}
+
+void StepManager::draftChanged() {
+    draftVersion.fetch_add(1, std::memory_order_release);
+    std::lock_guard<std::shared_mutex> lock(matchCacheMutex());
+    matchCache().clear();
+    stepMatchesGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<const StepManager::Registry> StepManager::registry() {
+    static std::shared_ptr<const Registry> published;
+    thread_local std::shared_ptr<const Registry> cached;
+    thread_local std::uint64_t cachedVersion = 0;
+    if (cachedVersion != draftVersion.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(registrationMutex());
+        const std::uint64_t version = draftVersion.load(std::memory_order_relaxed);
+        if (publishedVersion != version) {
+            // Prepared first so that later copies keep the built automaton
+            stepIndex().prepare();
+            std::shared_ptr<Registry> next = std::make_shared<Registry>();
+            next->steps = steps();
+            next->index = stepIndex();
+            published = std::move(next);
+            publishedVersion = version;
+        }
+        cached = published;
+        cachedVersion = publishedVersion;
+    }
+    return cached;
+}
+
+const StepManager::steps_type& StepManager::registeredSteps(const Registry& registry) {
+    return registry.steps;
+}
+
+void StepManager::clearRegistry() {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    steps().clear();
+    stepIndex() = StepIndex();
+    draftChanged();
+}
+
+void StepManager::insertStep(std::shared_ptr<StepInfo> stepInfo, const StepSnapshot* snapshot) {
+    steps_type& registered = steps();
+    if (stepInfo->id >= registered.size()) {
+        registered.resize(stepInfo->id + 1);
+    }
+    // The first step registered with an id keeps it
+    if (registered[stepInfo->id]) {
+        return;
+    }
+    const StepSnapshotEntry* const entry =
+        snapshot ? snapshot->find(std::string(stepInfo->stepDef)) : nullptr;
+    if (entry && entry->regex == stepInfo->regex.str()) {
+        stepIndex().add(stepInfo->id, entry->prefix, entry->requiredLiterals);
+    } else {
+        stepIndex().add(stepInfo->id, stepInfo->regex.str());
+    }
+    registered[stepInfo->id] = std::move(stepInfo);
 }
 
 MatchResult StepManager::stepMatches(const std::string& stepDescription) {
+    const ScopedTiming timing(TIMED_STEP_MATCHES);
+    const ScopedTraceEvent trace("step_matches", stepDescription);
+    stepMatchesCalls.fetch_add(1, std::memory_order_relaxed);
+    match_cache_type& cache = matchCache();
+    std::uint64_t generation = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(matchCacheMutex());
+        const match_cache_type::const_iterator cached = cache.find(stepDescription);
+        if (cached != cache.end()) {
+            stepMatchesCacheHits.fetch_add(1, std::memory_order_relaxed);
+            return cached->second;
+        }
+        generation = stepMatchesGeneration.load(std::memory_order_relaxed);
+    }
+
+    typedef std::vector<step_id_type>::const_iterator candidate_iterator;
+    const std::shared_ptr<const Registry> current = registry();
+    const Registry& searched = *current;
+    std::vector<step_id_type> candidates = searched.index.candidates(stepDescription);
+    const std::shared_ptr<const std::vector<std::uint32_t>> order = matchOrder(searched);
+    if (order) {
+        sortByRank(candidates, *order);
+    }
+    const auto matchSlice = [&stepDescription, &searched](
+                                candidate_iterator begin, candidate_iterator end
+                            ) {
+        MatchResult sliceResult;
+        for (; begin != end; ++begin) {
+            SingleStepMatch currentMatch = searched.steps[*begin]->matches(stepDescription);
+            if (currentMatch) {
+                sliceResult.addMatch(currentMatch);
+                if (countMatch(searched, *begin)) {
+                    break;
+                }
+            }
+        }
+        return sliceResult;
+    };
+
     MatchResult matchResult;
-    for (steps_type::iterator iter = steps().begin(); iter != steps().end(); ++iter) {
-        const std::shared_ptr<const StepInfo>& stepInfo = iter->second;
-        SingleStepMatch currentMatch = stepInfo->matches(stepDescription);
-        if (currentMatch) {
-            matchResult.addMatch(currentMatch);
+    const std::unique_ptr<ThreadPool>& pool = matchingPool();
+    if (!pool || candidates.size() < PARALLEL_MATCH_MIN_CANDIDATES) {
+        matchResult = matchSlice(candidates.begin(), candidates.end());
+    } else {
+        // Slice i goes to a worker, the last one is matched on this thread
+        const std::size_t slices = pool->size() + 1;
+        const std::size_t sliceSize = (candidates.size() + slices - 1) / slices;
+        std::vector<std::future<MatchResult>> sliceResults;
+        candidate_iterator begin = candidates.begin();
+        while (static_cast<std::size_t>(candidates.end() - begin) > sliceSize) {
+            const candidate_iterator end = begin + sliceSize;
+            sliceResults.push_back(pool->submit([&matchSlice, begin, end] {
+                return matchSlice(begin, end);
+            }));
+            begin = end;
+        }
+        MatchResult lastSlice;
+        std::exception_ptr error;
+        try {
+            lastSlice = matchSlice(begin, candidates.end());
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // Workers refer to this frame so they must finish before anything is rethrown
+        for (std::future<MatchResult>& sliceResult : sliceResults) {
+            sliceResult.wait();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        const bool firstMatch = isFirstMatchOnly();
+        for (std::future<MatchResult>& sliceResult : sliceResults) {
+            MatchResult slice = sliceResult.get();
+            for (const SingleStepMatch& match : slice.getResultSet()) {
+                if (!firstMatch || !matchResult) {
+                    matchResult.addMatch(match);
+                }
+            }
+        }
+        for (const SingleStepMatch& match : lastSlice.getResultSet()) {
+            if (!firstMatch || !matchResult) {
+                matchResult.addMatch(match);
+            }
         }
     }
+
+    std::lock_guard<std::shared_mutex> lock(matchCacheMutex());
+    // Left out if a registration made it stale in the meantime
+    if (stepMatchesGeneration.load(std::memory_order_relaxed) == generation) {
+        if (cache.size() >= MATCH_CACHE_CAPACITY) {
+            cache.clear();
+        }
+        cache.insert(std::make_pair(stepDescription, matchResult));
+    }
     return matchResult;
 }
 
+void StepManager::stepMatches(const std::string& stepDescription, StepMatchBuffer& buffer) {
+    buffer.clear();
+    const std::shared_ptr<const Registry> current = registry();
+    current->index.candidates(stepDescription, buffer.lookup);
+    const std::shared_ptr<const std::vector<std::uint32_t>> order = matchOrder(*current);
+    if (order) {
+        sortByRank(buffer.lookup.candidates, *order);
+    }
+    for (const step_id_type id : buffer.lookup.candidates) {
+        const StepInfo& stepInfo = *current->steps[id];
+        if (stepInfo.matches(stepDescription, buffer.stepSubmatches)) {
+            const StepMatchBuffer::Match match = {
+                &stepInfo, buffer.submatches.size(), buffer.stepSubmatches.size()
+            };
+            buffer.matches.push_back(match);
+            buffer.submatches.insert(
+                buffer.submatches.end(),
+                buffer.stepSubmatches.begin(),
+                buffer.stepSubmatches.end()
+            );
+            if (countMatch(*current, id)) {
+                break;
+            }
+        }
+    }
+}
+
+std::vector<MatchResult> StepManager::outlineStepMatches(
+    const std::string& templateText, const std::vector<std::string>& rowDescriptions
+) {
+    std::vector<MatchResult> results;
+    results.reserve(rowDescriptions.size());
+    const std::string descriptionPrefix = templateText.substr(0, templateText.find('<'));
+    if (descriptionPrefix.empty()) {
+        for (const std::string& rowDescription : rowDescriptions) {
+            results.push_back(stepMatches(rowDescription));
+        }
+        return results;
+    }
+
+    const std::shared_ptr<const Registry> current = registry();
+    std::vector<step_id_type> candidates = current->index.prefixedCandidates(descriptionPrefix);
+    const std::shared_ptr<const std::vector<std::uint32_t>> order = matchOrder(*current);
+    if (order) {
+        sortByRank(candidates, *order);
+    }
+    for (const std::string& rowDescription : rowDescriptions) {
+        MatchResult rowResult;
+        for (const step_id_type id : candidates) {
+            SingleStepMatch currentMatch = current->steps[id]->matches(rowDescription);
+            if (currentMatch) {
+                rowResult.addMatch(currentMatch);
+                if (countMatch(*current, id)) {
+                    break;
+                }
+            }
+        }
+        results.push_back(std::move(rowResult));
+    }
+    return results;
+}
+
+std::vector<StepAmbiguity> StepManager::ambiguousSteps() {
+    const std::shared_ptr<const Registry> current = registry();
+    const auto matchesWhole = [](const StepInfo& stepInfo, const std::string& text) {
+        try {
+            return static_cast<bool>(stepInfo.matches(text));
+        } catch (...) {
+            // Reported when matched
+            return false;
+        }
+    };
+
+    std::vector<StepAmbiguity> found;
+    std::set<std::pair<step_id_type, step_id_type>> reported;
+    const auto report = [&found, &reported](
+                            const StepInfo* a, const StepInfo* b, const std::string& example
+                        ) {
+        const StepInfo* const first = a->id < b->id ? a : b;
+        const StepInfo* const second = first == a ? b : a;
+        if (reported.insert(std::make_pair(first->id, second->id)).second) {
+            found.push_back(StepAmbiguity{first, second, example});
+        }
+    };
+    std::unordered_map<std::string, const StepInfo*> patterns;
+    for (const auto& step : current->steps) {
+        if (step) {
+            const auto samePattern = patterns.emplace(step->regex.str(), step.get());
+            if (!samePattern.second) {
+                report(samePattern.first->second, step.get(), "");
+            }
+        }
+    }
+    for (const auto& step : current->steps) {
+        if (!step || current->index.isUnambiguous(step->id)) {
+            continue;
+        }
+        const std::string example = extractLiteralPrefix(step->regex.str()).text;
+        if (!matchesWhole(*step, example)) {
+            continue;
+        }
+        for (const step_id_type id : current->index.candidates(example)) {
+            if (id != step->id && matchesWhole(*current->steps[id], example)) {
+                report(step.get(), current->steps[id].get(), example);
+            }
+        }
+    }
+    return found;
+}
+
+bool StepManager::reportAmbiguousSteps(std::ostream& out) {
+    const std::vector<StepAmbiguity> ambiguities = ambiguousSteps();
+    for (const StepAmbiguity& ambiguity : ambiguities) {
+        out << "Ambiguous step definitions " << ambiguity.first->stepDef << " ("
+            << ambiguity.first->source << ") and " << ambiguity.second->stepDef << " ("
+            << ambiguity.second->source << ")";
+        if (ambiguity.example.empty()) {
+            out << ", with the same pattern\n";
+        } else {
+            out << ", both matching \"" << ambiguity.example << "\"\n";
+        }
+    }
+    out.flush();
+    return !ambiguities.empty();
+}
+
+bool StepManager::reportBacktrackingHazards(std::ostream& out) {
+    bool reported = false;
+    for (const auto& step : registry()->steps) {
+        // Those of Cucumber Expressions are known
+        if (!step || step->stepDef != step->regex.str()) {
+            continue;
+        }
+        const std::string hazard = backtrackingHazard(std::string(step->stepDef));
+        if (!hazard.empty()) {
+            out << "Step definition " << step->stepDef << " (" << step->source
+                << ") may backtrack at length on long steps: " << hazard << "\n";
+            reported = true;
+        }
+    }
+    out.flush();
+    return reported;
+}
+
+void StepManager::setIndexMode(StepIndexMode mode) {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    stepIndex() = StepIndex(mode);
+    for (const auto& step : steps()) {
+        if (step) {
+            stepIndex().add(step->id, step->regex.str());
+        }
+    }
+    draftChanged();
+}
+
+void StepManager::setLazyCompilation(bool lazy) {
+    lazyCompilation().store(lazy, std::memory_order_relaxed);
+}
+
+bool StepManager::isLazyCompilation() {
+    return lazyCompilation().load(std::memory_order_relaxed);
+}
+
+void StepManager::setInstanceReuse(bool reuse) {
+    instanceReuse().store(reuse, std::memory_order_relaxed);
+}
+
+bool StepManager::isInstanceReuse() {
+    return instanceReuse().load(std::memory_order_relaxed);
+}
+
+void StepManager::setFirstMatchOnly(bool firstMatch) {
+    {
+        std::lock_guard<std::mutex> lock(rankingMutex());
+        firstMatchOnly().store(firstMatch, std::memory_order_relaxed);
+        hotRanks().reset();
+    }
+    std::lock_guard<std::shared_mutex> lock(matchCacheMutex());
+    matchCache().clear();
+    stepMatchesGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool StepManager::isFirstMatchOnly() {
+    return firstMatchOnly().load(std::memory_order_relaxed);
+}
+
+bool StepManager::countMatch(const Registry& registry, step_id_type id) {
+    registry.steps[id]->matchCount.fetch_add(1, std::memory_order_relaxed);
+    if (!isFirstMatchOnly()) {
+        return registry.index.isUnambiguous(id);
+    }
+    matchesSinceRanking.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+std::shared_ptr<const std::vector<std::uint32_t>> StepManager::matchOrder(const Registry& registry
+) {
+    if (!isFirstMatchOnly()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(rankingMutex());
+    if (!hotRanks() || matchesSinceRanking.load(std::memory_order_relaxed) >= HOT_ORDER_PERIOD) {
+        const steps_type& steps = registry.steps;
+        std::vector<step_id_type> order;
+        for (const auto& step : steps) {
+            if (step) {
+                order.push_back(step->id);
+            }
+        }
+        std::stable_sort(order.begin(), order.end(), [&steps](step_id_type a, step_id_type b) {
+            return steps[a]->matchCount.load(std::memory_order_relaxed)
+                   > steps[b]->matchCount.load(std::memory_order_relaxed);
+        });
+        auto ranks = std::make_shared<std::vector<std::uint32_t>>(steps.size(), 0);
+        for (std::uint32_t rank = 0; rank < order.size(); ++rank) {
+            (*ranks)[order[rank]] = rank;
+        }
+        hotRanks() = std::move(ranks);
+        matchesSinceRanking.store(0, std::memory_order_relaxed);
+    }
+    return hotRanks();
+}
+
+void StepManager::setMatchingThreads(std::size_t threads) {
+    matchingPool().reset(threads > 1 ? new ThreadPool(threads - 1) : nullptr);
+}
+
+StepManager::MatchCounters StepManager::matchCounters() {
+    const MatchCounters counters = {
+        stepMatchesCalls.load(std::memory_order_relaxed),
+        stepMatchesCacheHits.load(std::memory_order_relaxed)
+    };
+    return counters;
+}
+
+std::uint64_t StepManager::matchGeneration() {
+    return stepMatchesGeneration.load(std::memory_order_relaxed);
+}
+
 const StepInfo* StepManager::getStep(step_id_type id) {
-    const steps_type::const_iterator step = steps().find(id);
-    if (step == steps().end()) {
+    // Outlives the registry, as its draft keeps every step
+    const std::shared_ptr<const Registry> current = registry();
+    if (id >= current->steps.size()) {
         return NULL;
     }
-    return step->second.get();
+    return current->steps[id].get();
+}
+
+std::vector<const StepInfo*> StepManager::getSteps() {
+    std::vector<const StepInfo*> registered;
+    for (const auto& step : registry()->steps) {
+        if (step) {
+            registered.push_back(step.get());
+        }
+    }
+    return registered;
 }
 
 /**
@@ -162,17 +897,64 @@ StepManager::steps_type& StepManager::steps() {
     return steps;
 }
 
+StepIndex& StepManager::stepIndex() {
+    static StepIndex stepIndex;
+    return stepIndex;
+}
+
+StepManager::match_cache_type& StepManager::matchCache() {
+    static match_cache_type matchCache;
+    return matchCache;
+}
+
+InvokeResult BasicStep::invoke(
+    const InvokeArgs* pArgs, const StepInfo::argument_indexes_type& argumentIndexes
+) {
+    this->argumentIndexes = &argumentIndexes;
+    InvokeResult result = invoke(pArgs);
+    this->argumentIndexes = nullptr;
+    return result;
+}
+
+InvokeArgs::size_type BasicStep::argumentIndex(std::size_t argument) const {
+    if (argumentIndexes && argument < argumentIndexes->size()) {
+        return (*argumentIndexes)[argument];
+    }
+    return argument;
+}
+
 InvokeResult BasicStep::invoke(const InvokeArgs* pArgs) {
+    prepareInvoke(pArgs, argumentIndexes);
+    try {
+        return completedResult(invokeStepBody());
+    } catch (...) {
+        return currentExceptionResult();
+    }
+}
+
+void BasicStep::prepareInvoke(
+    const InvokeArgs* pArgs, const StepInfo::argument_indexes_type* argumentIndexes
+) {
     this->pArgs = pArgs;
+    this->argumentIndexes = argumentIndexes;
     currentArgIndex = 0;
     currentResult = InvokeResult::success();
+    idempotentInvocation = false;
+}
+
+InvokeResult BasicStep::completedResult(InvokeResult returnedResult) const {
+    if (currentResult.isPending()) {
+        return currentResult;
+    }
+    if (idempotentInvocation && returnedResult.isSuccess()) {
+        returnedResult.setIdempotent();
+    }
+    return returnedResult;
+}
+
+InvokeResult BasicStep::currentExceptionResult() {
     try {
-        InvokeResult returnedResult = invokeStepBody();
-        if (currentResult.isPending()) {
-            return currentResult;
-        } else {
-            return returnedResult;
-        }
+        throw;
     } catch (const std::exception& ex) {
         return InvokeResult::failure(ex.what());
     } catch (const std::string& ex) {
@@ -193,6 +975,10 @@ void BasicStep::pending(const char* description) {
     currentResult = InvokeResult::pending(description);
 }
 
+void BasicStep::idempotent() {
+    idempotentInvocation = true;
+}
+
 const InvokeArgs* BasicStep::getArgs() {
     return pArgs;
 }
@@ -0,0 +1,306 @@
+#include "cucumber-cpp/internal/step/StepSnapshot.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+const int FORMAT = 1;
+
+/**
+ * Whether what registering the step derived can be reused by another
+ * process: custom parameter types may be defined differently there
+ */
+bool isReusable(const StepInfo& step) {
+    for (const CucumberExpressionParameter& parameter : step.parameters) {
+        if (!ParameterTypeRegistry::isBuiltIn(parameter.type)) {
+            return false;
+        }
+    }
+    if (!step.regex.isCompiled()) {
+        try {
+            Regex(step.regex.str());
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string toHex(const std::uint64_t value) {
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(value));
+    return hex;
+}
+
+std::uint64_t fromHex(const std::string& hex) {
+    std::size_t end = 0;
+    const unsigned long long value = std::stoull(hex, &end, 16);
+    if (end != hex.size()) {
+        throw std::invalid_argument(hex);
+    }
+    return value;
+}
+
+nlohmann::json toJson(const std::string& stepMatcher, const StepSnapshotEntry& entry) {
+    nlohmann::json parameters = nlohmann::json::array();
+    for (const CucumberExpressionParameter& parameter : entry.parameters) {
+        parameters.push_back({parameter.type, parameter.group});
+    }
+    nlohmann::json step = {
+        {"matcher", stepMatcher},
+        {"regex", entry.regex},
+        {"parameters", parameters},
+        {"prefix", entry.prefix.text},
+        {"anchored", entry.prefix.anchored},
+        {"literals", entry.requiredLiterals}
+    };
+    if (entry.hasMatcher) {
+        nlohmann::json segments = nlohmann::json::array();
+        for (const CucumberExpressionMatcher::Segment& segment : entry.segments) {
+            segments.push_back({static_cast<int>(segment.kind), segment.groups, segment.texts});
+        }
+        step["segments"] = segments;
+    }
+    return step;
+}
+
+StepSnapshotEntry fromJson(const nlohmann::json& step) {
+    StepSnapshotEntry entry;
+    step.at("regex").get_to(entry.regex);
+    for (const nlohmann::json& parameter : step.at("parameters")) {
+        entry.parameters.push_back(
+            {parameter.at(0).get<std::string>(), parameter.at(1).get<std::size_t>()}
+        );
+    }
+    step.at("prefix").get_to(entry.prefix.text);
+    step.at("anchored").get_to(entry.prefix.anchored);
+    step.at("literals").get_to(entry.requiredLiterals);
+    const nlohmann::json::const_iterator segments = step.find("segments");
+    if (segments != step.end()) {
+        entry.hasMatcher = true;
+        for (const nlohmann::json& segment : *segments) {
+            const int kind = segment.at(0).get<int>();
+            if (kind < CucumberExpressionMatcher::TEXT_SEGMENT
+                || kind >= CucumberExpressionMatcher::CUSTOM_SEGMENT) {
+                throw std::invalid_argument("segment kind");
+            }
+            entry.segments.push_back(
+                {static_cast<CucumberExpressionMatcher::SegmentKind>(kind),
+                 segment.at(2).get<std::vector<std::string>>(),
+                 segment.at(1).get<std::size_t>(),
+                 nullptr}
+            );
+        }
+    }
+    return entry;
+}
+
+struct LoadedSnapshot {
+    std::mutex mutex;
+    bool environmentRead = false;
+    std::shared_ptr<const StepSnapshot> snapshot;
+};
+
+// Steps register in static initializers, hence the accessor
+LoadedSnapshot& loadedSnapshot() {
+    static LoadedSnapshot loaded;
+    return loaded;
+}
+
+const char* snapshotPath() {
+    const char* const path = std::getenv(StepSnapshot::ENVIRONMENT_VARIABLE);
+    return path && *path ? path : nullptr;
+}
+
+/**
+ * A missing, malformed or foreign snapshot is no snapshot: refresh()
+ * replaces it
+ */
+std::shared_ptr<const StepSnapshot> readEnvironmentSnapshot() {
+    const char* const path = snapshotPath();
+    if (!path) {
+        return nullptr;
+    }
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return nullptr;
+    }
+    try {
+        std::shared_ptr<const StepSnapshot> snapshot =
+            std::make_shared<StepSnapshot>(StepSnapshot::read(in));
+        if (snapshot->isCurrentVersion()) {
+            return snapshot;
+        }
+    } catch (const std::runtime_error&) {
+    }
+    return nullptr;
+}
+
+}
+
+StepSnapshot::StepSnapshot() :
+    version(CUKE_STEP_SNAPSHOT_VERSION),
+    hash(0) {
+}
+
+StepSnapshot StepSnapshot::capture() {
+    StepSnapshot snapshot;
+    snapshot.hash = registrationHash();
+    for (const StepInfo* step : StepManager::getSteps()) {
+        if (!isReusable(*step)) {
+            continue;
+        }
+        const std::string stepDef(step->stepDef);
+        const std::shared_ptr<const CucumberExpressionMatcher> matcher =
+            step->regex.str() != stepDef ? cukex::matcher(stepDef) : nullptr;
+        StepSnapshotEntry entry;
+        entry.regex = step->regex.str();
+        entry.parameters = step->parameters;
+        entry.hasMatcher = matcher != nullptr;
+        if (matcher) {
+            entry.segments = matcher->getSegments();
+        }
+        entry.prefix = extractLiteralPrefix(entry.regex);
+        entry.requiredLiterals = extractRequiredLiterals(entry.regex);
+        snapshot.entries[stepDef] = std::move(entry);
+    }
+    return snapshot;
+}
+
+StepSnapshot StepSnapshot::read(std::istream& in) {
+    StepSnapshot snapshot;
+    try {
+        const nlohmann::json json = nlohmann::json::parse(in);
+        if (json.at("format").get<int>() != FORMAT) {
+            throw std::runtime_error("Unknown step snapshot format");
+        }
+        json.at("version").get_to(snapshot.version);
+        snapshot.hash = fromHex(json.at("hash").get<std::string>());
+        for (const nlohmann::json& step : json.at("steps")) {
+            snapshot.entries[step.at("matcher").get<std::string>()] = fromJson(step);
+        }
+    } catch (const std::runtime_error&) {
+        throw;
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("Malformed step snapshot: ") + e.what());
+    }
+    return snapshot;
+}
+
+void StepSnapshot::write(std::ostream& out) const {
+    // Sorted, so that the same steps always give the same file
+    std::vector<entries_type::const_pointer> sorted;
+    for (const entries_type::value_type& entry : entries) {
+        sorted.push_back(&entry);
+    }
+    std::sort(
+        sorted.begin(),
+        sorted.end(),
+        [](entries_type::const_pointer a, entries_type::const_pointer b) {
+            return a->first < b->first;
+        }
+    );
+    nlohmann::json steps = nlohmann::json::array();
+    for (entries_type::const_pointer entry : sorted) {
+        steps.push_back(toJson(entry->first, entry->second));
+    }
+    const nlohmann::json json = {
+        {"format", FORMAT}, {"version", version}, {"hash", toHex(hash)}, {"steps", steps}
+    };
+    out << json.dump() << '\n';
+}
+
+const StepSnapshotEntry* StepSnapshot::find(const std::string& stepMatcher) const {
+    const entries_type::const_iterator found = entries.find(stepMatcher);
+    return found != entries.end() ? &found->second : nullptr;
+}
+
+const StepSnapshot::entries_type& StepSnapshot::getEntries() const {
+    return entries;
+}
+
+bool StepSnapshot::isCurrentVersion() const {
+    return version == CUKE_STEP_SNAPSHOT_VERSION;
+}
+
+bool StepSnapshot::isCurrent() const {
+    return isCurrentVersion() && hash == registrationHash();
+}
+
+std::uint64_t StepSnapshot::registrationHash() {
+    std::vector<std::string> matchers;
+    for (const StepInfo* step : StepManager::getSteps()) {
+        matchers.emplace_back(step->stepDef);
+    }
+    std::sort(matchers.begin(), matchers.end());
+    // FNV-1a
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const std::string& matcher : matchers) {
+        for (const char c : matcher) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+        hash = (hash ^ 0xffu) * 1099511628211ull;
+    }
+    return hash;
+}
+
+void StepSnapshot::load(std::shared_ptr<const StepSnapshot> snapshot) {
+    LoadedSnapshot& loaded = loadedSnapshot();
+    std::lock_guard<std::mutex> lock(loaded.mutex);
+    loaded.environmentRead = true;
+    loaded.snapshot = std::move(snapshot);
+}
+
+std::shared_ptr<const StepSnapshot> StepSnapshot::loaded() {
+    LoadedSnapshot& loaded = loadedSnapshot();
+    std::lock_guard<std::mutex> lock(loaded.mutex);
+    if (!loaded.environmentRead) {
+        loaded.environmentRead = true;
+        loaded.snapshot = readEnvironmentSnapshot();
+    }
+    return loaded.snapshot;
+}
+
+bool StepSnapshot::refresh() {
+    const char* const path = snapshotPath();
+    if (!path) {
+        return false;
+    }
+    const std::shared_ptr<const StepSnapshot> snapshot = loaded();
+    if (snapshot && snapshot->isCurrent()) {
+        return false;
+    }
+    // Written aside and renamed, as concurrent processes may read or refresh it
+    const std::string written = std::string(path) + "." + toHex(std::random_device()()) + ".tmp";
+    {
+        std::ofstream out(written, std::ios::binary);
+        capture().write(out);
+        if (!out.flush()) {
+            std::remove(written.c_str());
+            throw std::runtime_error("Unable to write step snapshot " + written);
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(written, path, error);
+    if (error) {
+        std::remove(written.c_str());
+        throw std::runtime_error("Unable to replace step snapshot " + std::string(path));
+    }
+    return true;
+}
+
+}
+}
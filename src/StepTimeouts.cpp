@@ -0,0 +1,189 @@
+#include <cucumber-cpp/internal/StepTimeouts.hpp>
+#include <cucumber-cpp/internal/utils/Watchdog.hpp>
+
+#include <cctype>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+thread_local ScenarioTimeouts* currentTimeouts = NULL;
+
+const std::string STEP_TIMEOUT_TAG = "timeout(";
+const std::string SCENARIO_TIMEOUT_TAG = "scenario_timeout(";
+
+/**
+ * Duration of a "<name>(<duration>)" tag, with or without its '@'
+ */
+bool tagDuration(
+    const std::string& tag, const std::string& name, ScenarioTimeouts::duration_type& duration
+) {
+    const std::size_t start = !tag.empty() && tag[0] == '@' ? 1 : 0;
+    if (tag.compare(start, name.size(), name) != 0 || tag.back() != ')') {
+        return false;
+    }
+    const std::size_t begin = start + name.size();
+    duration = ScenarioTimeouts::parseDuration(tag.substr(begin, tag.size() - 1 - begin));
+    return true;
+}
+
+}
+
+ScenarioTimeouts::~ScenarioTimeouts() {
+    if (currentTimeouts == this) {
+        currentTimeouts = NULL;
+    }
+}
+
+ScenarioTimeouts ScenarioTimeouts::fromTags(const std::vector<std::string>& tags) {
+    ScenarioTimeouts timeouts;
+    for (const std::string& tag : tags) {
+        if (!tagDuration(tag, STEP_TIMEOUT_TAG, timeouts.step)) {
+            tagDuration(tag, SCENARIO_TIMEOUT_TAG, timeouts.scenario);
+        }
+    }
+    return timeouts;
+}
+
+ScenarioTimeouts::duration_type ScenarioTimeouts::parseDuration(const std::string& duration) {
+    std::size_t end = 0;
+    long long count = -1;
+    try {
+        if (!duration.empty() && std::isdigit(static_cast<unsigned char>(duration[0]))) {
+            count = std::stoll(duration, &end);
+        }
+    } catch (const std::out_of_range&) {
+    }
+    const std::string unit = duration.substr(end);
+    if (count >= 0 && unit == "ms") {
+        return duration_type(count);
+    } else if (count >= 0 && unit == "s") {
+        return std::chrono::seconds(count);
+    } else if (count >= 0 && unit == "min") {
+        return std::chrono::minutes(count);
+    }
+    throw std::invalid_argument("Malformed timeout: " + duration);
+}
+
+ScenarioTimeouts& ScenarioTimeouts::current() {
+    if (!currentTimeouts) {
+        thread_local ScenarioTimeouts threadTimeouts;
+        currentTimeouts = &threadTimeouts;
+    }
+    return *currentTimeouts;
+}
+
+void ScenarioTimeouts::makeCurrent() {
+    currentTimeouts = this;
+}
+
+/**
+ * State shared by the runner and its thread, which keeps it once detached
+ */
+struct TimedStepRunner::Worker {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::thread thread;
+    TimedStepRunner::step_type step;
+    std::exception_ptr error;
+    bool done = false;
+    bool expired = false;
+    bool stopping = false;
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            while (!stopping && !step) {
+                changed.wait_for(lock, std::chrono::seconds(1));
+            }
+            if (!step) {
+                return;
+            }
+            TimedStepRunner::step_type running;
+            std::swap(running, step);
+            lock.unlock();
+            std::exception_ptr thrown;
+            try {
+                running();
+            } catch (...) {
+                thrown = std::current_exception();
+            }
+            // Destroys what the step was given here, before it is reported done
+            running = nullptr;
+            lock.lock();
+            error = thrown;
+            done = true;
+            changed.notify_all();
+        }
+    }
+};
+
+TimedStepRunner::~TimedStepRunner() {
+    if (worker) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->stopping = true;
+        }
+        worker->changed.notify_all();
+        worker->thread.join();
+    }
+}
+
+bool TimedStepRunner::run(step_type step, const std::chrono::nanoseconds budget) {
+    if (!worker) {
+        worker = std::make_shared<Worker>();
+        // The thread holds on to the worker, in case it outlives the runner
+        worker->thread = std::thread([worker = worker] {
+            worker->work();
+        });
+    }
+    std::shared_ptr<Worker> running = worker;
+    std::unique_lock<std::mutex> lock(running->mutex);
+    running->step = std::move(step);
+    running->done = false;
+    running->expired = false;
+    running->error = nullptr;
+    running->changed.notify_all();
+    lock.unlock();
+
+    const Watchdog::timer_type timer = Watchdog::instance().arm(budget, [running] {
+        std::lock_guard<std::mutex> lock(running->mutex);
+        running->expired = true;
+        running->changed.notify_all();
+    });
+    lock.lock();
+    while (!running->done && !running->expired) {
+        running->changed.wait_for(lock, std::chrono::seconds(1));
+    }
+    if (!running->done) {
+        // Left to finish on its own, if ever
+        running->stopping = true;
+        running->thread.detach();
+        worker.reset();
+        return false;
+    }
+    lock.unlock();
+    Watchdog::instance().disarm(timer);
+    if (running->error) {
+        std::rethrow_exception(running->error);
+    }
+    return true;
+}
+
+}
+
+void setStepTimeout(const std::chrono::milliseconds timeout) {
+    internal::ScenarioTimeouts::current().step = timeout;
+}
+
+void setScenarioTimeout(const std::chrono::milliseconds timeout) {
+    internal::ScenarioTimeouts::current().scenario = timeout;
+}
+
+}
@@ -0,0 +1,46 @@
+#include "cucumber-cpp/internal/utils/StringPool.hpp"
+
+#include <cstring>
+
+namespace cucumber {
+namespace internal {
+
+std::string_view StringPool::intern(std::string_view text) {
+    if (text.empty()) {
+        return std::string_view();
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto found = interned.find(text);
+    if (found != interned.end()) {
+        return *found;
+    }
+    char* storage;
+    if (text.size() > BLOCK_SIZE) {
+        blocks.push_back(std::make_unique<char[]>(text.size()));
+        storage = blocks.back().get();
+    } else {
+        if (BLOCK_SIZE - blockUsed < text.size()) {
+            blocks.push_back(std::make_unique<char[]>(BLOCK_SIZE));
+            block = blocks.back().get();
+            blockUsed = 0;
+        }
+        storage = block + blockUsed;
+        blockUsed += text.size();
+    }
+    std::memcpy(storage, text.data(), text.size());
+    stored += text.size();
+    return *interned.insert(std::string_view(storage, text.size())).first;
+}
+
+std::size_t StringPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return interned.size();
+}
+
+std::size_t StringPool::characters() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stored;
+}
+
+}
+}
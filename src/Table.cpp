@@ -1,37 +1,90 @@
 #include <cucumber-cpp/internal/Table.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 namespace cucumber {
 namespace internal {
 
-void Table::addColumn(const std::string column) {
-    if (rows.empty()) {
-        columns.push_back(column);
+void Table::addColumn(std::string column) {
+    if (cells.empty()) {
+        columns.push_back(std::move(column));
     } else {
         throw std::runtime_error("Cannot alter columns after rows have been added");
     }
 }
 
 void Table::addRow(const row_type& row) {
+    addRow(row_type(row));
+}
+
+void Table::addRow(row_type&& row) {
     const basic_type::size_type colSize = columns.size();
     if (colSize == 0) {
         throw std::runtime_error("No column defined yet");
     } else if (colSize != row.size()) {
         throw std::range_error("Row size does not match the table column size");
     } else {
-        rows.push_back(buildHashRow(row));
+        row_type added(std::move(row));
+        cells.insert(
+            cells.end(),
+            std::make_move_iterator(added.begin()),
+            std::make_move_iterator(added.end())
+        );
+        caches.typedColumns.clear();
     }
 }
 
-Table::hash_row_type Table::buildHashRow(const row_type& row) {
-    hash_row_type hashRow;
-    for (columns_type::size_type i = 0; i < columns.size(); ++i) {
-        hashRow[columns[i]] = row[i];
-    }
-    return hashRow;
+void Table::reserveRows(size_type count) {
+    cells.reserve(cells.size() + count * columns.size());
 }
 
 const Table::hashes_type& Table::hashes() const {
-    return rows;
+    std::lock_guard<std::mutex> lock(caches.mutex);
+    hashes_type& hashRows = caches.hashRows;
+    // Only the rows added since the last call still need to be built
+    hashRows.reserve(rowCount());
+    while (hashRows.size() < rowCount()) {
+        const size_type row = hashRows.size();
+        hash_row_type hashRow;
+        for (columns_type::size_type i = 0; i < columns.size(); ++i) {
+            hashRow[columns[i]] = cells[row * columns.size() + i];
+        }
+        hashRows.push_back(std::move(hashRow));
+    }
+    return hashRows;
+}
+
+Table::RowRange Table::rows() const {
+    const size_type columnCount = columns.size();
+    return {RowIterator(cells.begin(), columnCount), RowIterator(cells.end(), columnCount)};
+}
+
+const Table::columns_type& Table::getColumns() const {
+    return columns;
+}
+
+Table::size_type Table::rowCount() const {
+    return columns.empty() ? 0 : cells.size() / columns.size();
+}
+
+const std::string& Table::cell(size_type row, size_type column) const {
+    if (row >= rowCount() || column >= columns.size()) {
+        throw std::out_of_range("No such table cell");
+    }
+    return cells[row * columns.size() + column];
+}
+
+const std::string& Table::cell(size_type row, const std::string& column) const {
+    return cell(row, columnIndex(column));
+}
+
+Table::size_type Table::columnIndex(const std::string& column) const {
+    const columns_type::const_iterator found = std::find(columns.begin(), columns.end(), column);
+    if (found == columns.end()) {
+        throw std::out_of_range("No such table column: " + column);
+    }
+    return found - columns.begin();
 }
 
 }
@@ -1,9 +1,74 @@
 #include <cucumber-cpp/internal/hook/Tag.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
 
 namespace cucumber {
 namespace internal {
 
+namespace {
+typedef std::unordered_map<std::string, tag_id_type> tag_ids_type;
+
+tag_ids_type& tagIds() {
+    static tag_ids_type ids;
+    return ids;
+}
+
+std::mutex& tagIdsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+}
+
+TagSet::TagSet(const tag_list& tags) {
+    std::lock_guard<std::mutex> lock(tagIdsMutex());
+    const tag_ids_type& ids = tagIds();
+    for (const std::string& tag : tags) {
+        const tag_ids_type::const_iterator id = ids.find(tag);
+        if (id != ids.end()) {
+            insert(id->second);
+        }
+    }
+}
+
+tag_id_type TagSet::intern(const std::string& tag) {
+    std::lock_guard<std::mutex> lock(tagIdsMutex());
+    tag_ids_type& ids = tagIds();
+    return ids.insert(std::make_pair(tag, ids.size())).first->second;
+}
+
+void TagSet::insert(const tag_id_type id) {
+    const std::size_t bits = std::numeric_limits<word_type>::digits;
+    if (id / bits >= words.size()) {
+        words.resize(id / bits + 1);
+    }
+    words[id / bits] |= word_type(1) << (id % bits);
+}
+
+bool TagSet::contains(const tag_id_type id) const {
+    const std::size_t bits = std::numeric_limits<word_type>::digits;
+    return id / bits < words.size() && (words[id / bits] >> (id % bits)) & 1;
+}
+
+bool TagSet::intersects(const TagSet& other) const {
+    const std::size_t size = std::min(words.size(), other.words.size());
+    for (std::size_t i = 0; i < size; ++i) {
+        if (words[i] & other.words[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TagExpression::matches(const tag_list& tags) const {
+    return matches(TagSet(tags));
+}
+
 Regex& AndTagExpression::csvTagNotationRegex() {
     static Regex r("\\s*\"([^\"]+)\"\\s*(?:,|$)");
     return r;
@@ -20,7 +85,7 @@ AndTagExpression::AndTagExpression(const std::string& csvTagNotation) {
     }
 }
 
-bool AndTagExpression::matches(const tag_list& tags) const {
+bool AndTagExpression::matches(const TagSet& tags) const {
     bool match = true;
     for (or_expressions_type::const_iterator i = orExpressions.begin();
          i != orExpressions.end() && match;
@@ -38,28 +103,188 @@ Regex& OrTagExpression::csvTagNotationRegex() {
 OrTagExpression::OrTagExpression(const std::string& csvTagNotation) {
     const std::shared_ptr<RegexMatch> match(csvTagNotationRegex().findAll(csvTagNotation));
     const RegexMatch::submatches_type submatches = match->getSubmatches();
-    orTags.reserve(submatches.size());
     for (RegexMatch::submatches_type::const_iterator i = submatches.begin(); i != submatches.end();
          ++i) {
-        orTags.push_back(i->value);
+        orTags.insert(TagSet::intern(i->value));
     }
 }
 
-bool OrTagExpression::matches(const tag_list& tags) const {
-    for (tag_list::const_iterator i = orTags.begin(); i != orTags.end(); ++i) {
-        if (orTagMatchesTagList(*i, tags))
-            return true;
+bool OrTagExpression::matches(const TagSet& tags) const {
+    return orTags.intersects(tags);
+}
+
+
+namespace {
+/**
+ * Recursive descent over "or" (lowest precedence), "and" and "not",
+ * emitting postfix code. Tokens are "(", ")", operator keywords and
+ * "@" prefixed tags; everything else is an error.
+ */
+template<typename Program, typename Opcode>
+class TagExpressionCompiler {
+public:
+    TagExpressionCompiler(const std::string& expression, Program& program) :
+        expression(expression),
+        program(program),
+        position(0),
+        depth(0) {
     }
-    return false;
+
+    void compile() {
+        nextToken();
+        if (token.empty()) {
+            return;
+        }
+        orExpression();
+        if (!token.empty()) {
+            fail("unexpected '" + token + "'");
+        }
+    }
+
+private:
+    void orExpression() {
+        andExpression();
+        while (token == "or") {
+            nextToken();
+            andExpression();
+            emit(Opcode::OR);
+        }
+    }
+
+    void andExpression() {
+        unaryExpression();
+        while (token == "and") {
+            nextToken();
+            unaryExpression();
+            emit(Opcode::AND);
+        }
+    }
+
+    void unaryExpression() {
+        if (token == "not") {
+            nextToken();
+            unaryExpression();
+            emit(Opcode::NOT);
+        } else if (token == "(") {
+            nextToken();
+            orExpression();
+            if (token != ")") {
+                fail("missing ')'");
+            }
+            nextToken();
+        } else if (token.size() > 1 && token[0] == '@') {
+            emit(Opcode::PUSH_TAG, TagSet::intern(token.substr(1)));
+            nextToken();
+        } else {
+            fail(token.empty() ? "unexpected end" : "unexpected '" + token + "'");
+        }
+    }
+
+    void emit(const Opcode opcode, const tag_id_type tag = 0) {
+        // Operands are pushed and operators pop two and push one
+        depth += (opcode == Opcode::PUSH_TAG) ? 1 : (opcode == Opcode::NOT) ? 0 : -1;
+        if (depth > std::numeric_limits<std::uint64_t>::digits) {
+            fail("nested too deeply");
+        }
+        program.push_back({opcode, tag});
+    }
+
+    void nextToken() {
+        while (position < expression.size()
+               && std::isspace(static_cast<unsigned char>(expression[position]))) {
+            ++position;
+        }
+        const std::string::size_type start = position;
+        if (position < expression.size()
+            && (expression[position] == '(' || expression[position] == ')')) {
+            ++position;
+        } else {
+            while (position < expression.size()
+                   && !std::isspace(static_cast<unsigned char>(expression[position]))
+                   && expression[position] != '(' && expression[position] != ')') {
+                ++position;
+            }
+        }
+        token = expression.substr(start, position - start);
+    }
+
+    [[noreturn]] void fail(const std::string& reason) const {
+        throw std::invalid_argument("Invalid tag expression \"" + expression + "\": " + reason);
+    }
+
+    const std::string& expression;
+    Program& program;
+    std::string::size_type position;
+    int depth;
+    std::string token;
+};
+
+/**
+ * Turns a legacy "@a,@b" list of alternatives into "@a or @b". Tag
+ * expressions have no commas, so anything else is returned unchanged.
+ */
+std::string fromLegacyTagList(const std::string& tags) {
+    std::string expression;
+    std::string::size_type begin = 0;
+    for (std::string::size_type comma = tags.find(','); comma != std::string::npos;
+         comma = tags.find(',', begin)) {
+        expression += tags.substr(begin, comma - begin) + " or ";
+        begin = comma + 1;
+    }
+    return expression + tags.substr(begin);
 }
 
-bool OrTagExpression::orTagMatchesTagList(const std::string& currentOrTag, const tag_list& tags)
-    const {
-    for (tag_list::const_iterator i = tags.begin(); i != tags.end(); ++i) {
-        if (*i == currentOrTag)
-            return true;
+bool isBlank(const std::string& text) {
+    return std::all_of(text.begin(), text.end(), [](const char c) {
+        return std::isspace(static_cast<unsigned char>(c)) != 0;
+    });
+}
+}
+
+BooleanTagExpression::BooleanTagExpression(const std::string& expression) {
+    TagExpressionCompiler<program_type, Opcode>(expression, program).compile();
+}
+
+BooleanTagExpression BooleanTagExpression::fromHookNotation(const std::string& csvTagNotation) {
+    std::string expression;
+    std::string::size_type end = 0;
+    for (std::string::size_type begin = csvTagNotation.find('"'); begin != std::string::npos;
+         begin = csvTagNotation.find('"', end + 1)) {
+        end = csvTagNotation.find('"', begin + 1);
+        if (end == std::string::npos) {
+            break;
+        }
+        const std::string argument = csvTagNotation.substr(begin + 1, end - begin - 1);
+        if (!isBlank(argument)) {
+            expression += (expression.empty() ? "(" : " and (") + fromLegacyTagList(argument) + ")";
+        }
     }
-    return false;
+    return BooleanTagExpression(expression);
+}
+
+bool BooleanTagExpression::matches(const TagSet& tags) const {
+    if (program.empty()) {
+        return true;
+    }
+    // Bit 0 is the top of the stack
+    std::uint64_t stack = 0;
+    for (const Instruction& instruction : program) {
+        switch (instruction.opcode) {
+        case PUSH_TAG:
+            stack = (stack << 1) | std::uint64_t(tags.contains(instruction.tag));
+            break;
+        case NOT:
+            stack ^= 1;
+            break;
+        case AND:
+            stack = (stack >> 1) & (~std::uint64_t(1) | stack);
+            break;
+        case OR:
+            stack = (stack >> 1) | (stack & 1);
+            break;
+        }
+    }
+    return stack & 1;
 }
 
 }
@@ -0,0 +1,288 @@
+#include "cucumber-cpp/internal/Telemetry.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <random>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+using nlohmann::json;
+
+bool isLowerHex(const std::string& text) {
+    return text.find_first_not_of("0123456789abcdef") == std::string::npos;
+}
+
+bool isZero(const std::string& id) {
+    return id.find_first_not_of('0') == std::string::npos;
+}
+
+std::string randomId(std::size_t digits) {
+    static const char hex[] = "0123456789abcdef";
+    thread_local std::mt19937_64 generator([] {
+        std::random_device device;
+        return (std::uint64_t(device()) << 32) ^ device();
+    }());
+    std::string id;
+    do {
+        id.clear();
+        while (id.size() < digits) {
+            std::uint64_t bits = generator();
+            for (int i = 0; i < 16 && id.size() < digits; ++i, bits >>= 4) {
+                id.push_back(hex[bits & 0xf]);
+            }
+        }
+    } while (isZero(id));
+    return id;
+}
+
+std::string unixNanoseconds(std::chrono::system_clock::time_point time) {
+    return std::to_string(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count()
+    );
+}
+
+json stringAttribute(const std::string& key, const std::string& value) {
+    return {{"key", key}, {"value", {{"stringValue", value}}}};
+}
+
+std::atomic<BatchSpanProcessor*>& processor() {
+    static std::atomic<BatchSpanProcessor*> processor(nullptr);
+    return processor;
+}
+
+thread_local const TraceContext* currentContext = nullptr;
+
+}
+
+std::optional<TraceContext> TraceContext::parse(const std::string& traceParent) {
+    // version-traceid-spanid-flags, later versions possibly adding fields
+    if (traceParent.size() < 55 || traceParent[2] != '-' || traceParent[35] != '-'
+        || traceParent[52] != '-' || (traceParent.size() > 55 && traceParent[55] != '-')) {
+        return std::nullopt;
+    }
+    const std::string version = traceParent.substr(0, 2);
+    TraceContext context;
+    context.traceId = traceParent.substr(3, 32);
+    context.spanId = traceParent.substr(36, 16);
+    const std::string flags = traceParent.substr(53, 2);
+    if (!isLowerHex(version) || version == "ff" || (version == "00" && traceParent.size() != 55)
+        || !isLowerHex(context.traceId) || !isLowerHex(context.spanId) || !isLowerHex(flags)
+        || isZero(context.traceId) || isZero(context.spanId)) {
+        return std::nullopt;
+    }
+    context.sampled = (std::stoi(flags, nullptr, 16) & 1) != 0;
+    return context;
+}
+
+std::string TraceContext::traceParent() const {
+    return "00-" + traceId + "-" + spanId + (sampled ? "-01" : "-00");
+}
+
+OtlpJsonExporter::OtlpJsonExporter(post_type post, std::string serviceName) :
+    post(std::move(post)),
+    serviceName(std::move(serviceName)) {
+}
+
+void OtlpJsonExporter::exportSpans(const std::vector<Span>& spans) {
+    post(encode(spans, serviceName));
+}
+
+std::string OtlpJsonExporter::encode(
+    const std::vector<Span>& spans, const std::string& serviceName
+) {
+    json jsonSpans = json::array();
+    for (const Span& span : spans) {
+        json attributes = json::array();
+        for (const Span::attributes_type::value_type& attribute : span.attributes) {
+            attributes.push_back(stringAttribute(attribute.first, attribute.second));
+        }
+        json jsonSpan = {
+            {"traceId", span.context.traceId},
+            {"spanId", span.context.spanId},
+            {"name", span.name},
+            // SPAN_KIND_INTERNAL
+            {"kind", 1},
+            {"startTimeUnixNano", unixNanoseconds(span.start)},
+            {"endTimeUnixNano", unixNanoseconds(span.end)},
+            {"attributes", attributes},
+        };
+        if (!span.parentSpanId.empty()) {
+            jsonSpan["parentSpanId"] = span.parentSpanId;
+        }
+        if (span.failed) {
+            // STATUS_CODE_ERROR
+            jsonSpan["status"] = {{"code", 2}, {"message", span.statusMessage}};
+        }
+        jsonSpans.push_back(std::move(jsonSpan));
+    }
+    const json request = {
+        {"resourceSpans",
+         {{{"resource", {{"attributes", {stringAttribute("service.name", serviceName)}}}},
+           {"scopeSpans", {{{"scope", {{"name", "cucumber-cpp"}}}, {"spans", jsonSpans}}}}}}}
+    };
+    return request.dump(-1, ' ', false, json::error_handler_t::replace);
+}
+
+BatchSpanProcessor::BatchSpanProcessor(
+    std::unique_ptr<SpanExporter> exporter,
+    std::size_t maxQueueSize,
+    std::size_t maxBatchSize,
+    std::chrono::milliseconds scheduleDelay
+) :
+    exporter(std::move(exporter)),
+    maxQueueSize(maxQueueSize),
+    maxBatchSize(std::max<std::size_t>(1, maxBatchSize)),
+    scheduleDelay(scheduleDelay),
+    queued(0),
+    done(0),
+    dropped(0),
+    failedExports(0),
+    flushing(false),
+    stopping(false),
+    thread(&BatchSpanProcessor::run, this) {
+}
+
+BatchSpanProcessor::~BatchSpanProcessor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_one();
+    thread.join();
+}
+
+void BatchSpanProcessor::onEnd(Span span) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (queue.size() >= maxQueueSize) {
+        ++dropped;
+        return;
+    }
+    queue.push_back(std::move(span));
+    ++queued;
+    if (queue.size() == maxBatchSize) {
+        wakeUp.notify_one();
+    }
+}
+
+void BatchSpanProcessor::forceFlush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    const std::uint64_t target = queued;
+    while (done < target) {
+        flushing = true;
+        wakeUp.notify_one();
+        exported.wait_for(lock, scheduleDelay);
+    }
+}
+
+std::uint64_t BatchSpanProcessor::getDropped() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return dropped;
+}
+
+std::uint64_t BatchSpanProcessor::getFailedExports() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return failedExports;
+}
+
+std::vector<Span> BatchSpanProcessor::takeBatch() {
+    const std::size_t size = std::min(queue.size(), maxBatchSize);
+    std::vector<Span> batch(
+        std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.begin() + size)
+    );
+    queue.erase(queue.begin(), queue.begin() + size);
+    return batch;
+}
+
+void BatchSpanProcessor::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        const std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::now() + scheduleDelay;
+        // Woken early by full batches, flushes and shutdown
+        while (!stopping && !flushing && queue.size() < maxBatchSize
+               && std::chrono::steady_clock::now() < deadline) {
+            wakeUp.wait_for(lock, deadline - std::chrono::steady_clock::now());
+        }
+        if (queue.empty()) {
+            flushing = false;
+            if (stopping) {
+                return;
+            }
+            continue;
+        }
+        const std::vector<Span> batch = takeBatch();
+        lock.unlock();
+        bool failed = false;
+        try {
+            exporter->exportSpans(batch);
+        } catch (...) {
+            failed = true;
+        }
+        lock.lock();
+        done += batch.size();
+        if (failed) {
+            ++failedExports;
+        }
+        exported.notify_all();
+    }
+}
+
+void Telemetry::setProcessor(BatchSpanProcessor* spanProcessor) {
+    processor().store(spanProcessor, std::memory_order_release);
+}
+
+bool Telemetry::isEnabled() {
+    return processor().load(std::memory_order_acquire) != nullptr;
+}
+
+Span Telemetry::startSpan(const std::string& name, const TraceContext* parent) {
+    Span span;
+    span.context.traceId = parent ? parent->traceId : randomId(32);
+    span.context.spanId = randomId(16);
+    span.context.sampled = parent ? parent->sampled : true;
+    span.parentSpanId = parent ? parent->spanId : std::string();
+    span.name = name;
+    span.start = std::chrono::system_clock::now();
+    return span;
+}
+
+void Telemetry::endSpan(Span& span) {
+    span.end = std::chrono::system_clock::now();
+    BatchSpanProcessor* const spanProcessor = processor().load(std::memory_order_acquire);
+    if (spanProcessor && span.context.sampled) {
+        spanProcessor->onEnd(std::move(span));
+    }
+}
+
+std::string Telemetry::currentTraceParent() {
+    return currentContext ? currentContext->traceParent() : std::string();
+}
+
+ScopedSpan::ScopedSpan(const std::string& name, const TraceContext& parent) :
+    span(Telemetry::startSpan(name, &parent)),
+    previous(currentContext) {
+    currentContext = &span.context;
+}
+
+ScopedSpan::~ScopedSpan() {
+    currentContext = previous;
+    Telemetry::endSpan(span);
+}
+
+void ScopedSpan::setAttribute(const std::string& key, const std::string& value) {
+    span.attributes.emplace_back(key, value);
+}
+
+void ScopedSpan::fail(const std::string& message) {
+    span.failed = true;
+    span.statusMessage = message;
+}
+
+}
+}
@@ -0,0 +1,57 @@
+#include <cucumber-cpp/internal/utils/ThreadPool.hpp>
+
+#include <chrono>
+
+namespace cucumber {
+namespace internal {
+
+ThreadPool::ThreadPool(std::size_t threads) {
+    workers.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::size() const {
+    return workers.size();
+}
+
+void ThreadPool::enqueue(task_type task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    available.notify_one();
+}
+
+void ThreadPool::work() {
+    for (;;) {
+        task_type task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!stopping && tasks.empty()) {
+                available.wait_for(lock, std::chrono::seconds(1));
+            }
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+}
+}
@@ -0,0 +1,628 @@
+#include "cucumber-cpp/internal/Timings.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace cucumber {
+namespace internal {
+
+LatencyHistogram::LatencyHistogram() :
+    count(0),
+    total(0),
+    max(0) {
+    for (std::atomic<std::uint32_t>& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& other) :
+    LatencyHistogram() {
+    add(other);
+}
+
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& other) {
+    if (this != &other) {
+        for (std::atomic<std::uint32_t>& bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+        add(other);
+    }
+    return *this;
+}
+
+namespace {
+// Only the recording thread writes, so loading and storing is enough
+template<typename T>
+void increase(std::atomic<T>& value, T by) {
+    value.store(value.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+}
+}
+
+void LatencyHistogram::record(value_type nanoseconds) {
+    increase(buckets[bucketIndex(nanoseconds)], std::uint32_t(1));
+    increase(count, std::uint64_t(1));
+    increase(total, nanoseconds);
+    if (nanoseconds > max.load(std::memory_order_relaxed)) {
+        max.store(nanoseconds, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::add(const LatencyHistogram& other) {
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        increase(buckets[i], other.buckets[i].load(std::memory_order_relaxed));
+    }
+    increase(count, other.count.load(std::memory_order_relaxed));
+    increase(total, other.total.load(std::memory_order_relaxed));
+    max.store(
+        std::max(max.load(std::memory_order_relaxed), other.max.load(std::memory_order_relaxed)),
+        std::memory_order_relaxed
+    );
+}
+
+std::uint64_t LatencyHistogram::getCount() const {
+    return count.load(std::memory_order_relaxed);
+}
+
+LatencyHistogram::value_type LatencyHistogram::getTotal() const {
+    return total.load(std::memory_order_relaxed);
+}
+
+LatencyHistogram::value_type LatencyHistogram::getMax() const {
+    return max.load(std::memory_order_relaxed);
+}
+
+LatencyHistogram::value_type LatencyHistogram::percentile(double percent) const {
+    std::uint64_t recorded = 0;
+    for (const std::atomic<std::uint32_t>& bucket : buckets) {
+        recorded += bucket.load(std::memory_order_relaxed);
+    }
+    if (recorded == 0) {
+        return 0;
+    }
+    const std::uint64_t rank = std::max<std::uint64_t>(
+        1,
+        static_cast<std::uint64_t>(std::ceil(std::min(percent, 100.0) / 100.0 * recorded))
+    );
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucketUpperValue(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+/*
+ * Values below SUB_BUCKET_COUNT have a bucket each. Above, every power of
+ * two range is split into SUB_BUCKET_COUNT buckets of equal width.
+ */
+std::size_t LatencyHistogram::bucketIndex(value_type nanoseconds) {
+    const value_type value = std::min(nanoseconds, (value_type(1) << MAX_VALUE_BITS) - 1);
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<std::size_t>(value);
+    }
+    unsigned exponent = 0;
+    for (value_type rest = value >> 1; rest != 0; rest >>= 1) {
+        ++exponent;
+    }
+    const unsigned shift = exponent - SUB_BUCKET_BITS;
+    return (shift + 1) * SUB_BUCKET_COUNT + static_cast<std::size_t>(value >> shift)
+         - SUB_BUCKET_COUNT;
+}
+
+LatencyHistogram::value_type LatencyHistogram::bucketUpperValue(std::size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    const unsigned shift = static_cast<unsigned>(index / SUB_BUCKET_COUNT) - 1;
+    const value_type lowest = value_type(SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT) << shift;
+    return lowest + (value_type(1) << shift) - 1;
+}
+
+void AllocationHistograms::add(const AllocationHistograms& other) {
+    allocations.add(other.allocations);
+    bytes.add(other.bytes);
+    retainedBytes.add(other.retainedBytes);
+    peakResidentGrowth.add(other.peakResidentGrowth);
+}
+
+void HardwareCounterHistograms::add(const HardwareCounterHistograms& other) {
+    for (std::size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+        counters[counter].add(other.counters[counter]);
+    }
+}
+
+namespace {
+
+struct TimingTable {
+    typedef std::unordered_map<step_id_type, std::unique_ptr<LatencyHistogram>> steps_type;
+    typedef std::unordered_map<step_id_type, std::unique_ptr<AllocationHistograms>>
+        step_allocations_type;
+    typedef std::unordered_map<step_id_type, std::unique_ptr<HardwareCounterHistograms>>
+        step_counters_type;
+
+    std::array<LatencyHistogram, TIMED_OPERATION_COUNT> operations;
+    steps_type steps;
+    steps_type benchmarks;
+    AllocationHistograms scenarioAllocations;
+    step_allocations_type stepAllocations;
+    step_counters_type stepCounters;
+};
+
+void merge(TimingSnapshot& snapshot, const TimingTable& table) {
+    for (std::size_t i = 0; i < TIMED_OPERATION_COUNT; ++i) {
+        snapshot.operations[i].add(table.operations[i]);
+    }
+    for (const TimingTable::steps_type::value_type& step : table.steps) {
+        snapshot.steps[step.first].add(*step.second);
+    }
+    for (const TimingTable::steps_type::value_type& step : table.benchmarks) {
+        snapshot.benchmarks[step.first].add(*step.second);
+    }
+    snapshot.scenarioAllocations.add(table.scenarioAllocations);
+    for (const TimingTable::step_allocations_type::value_type& step : table.stepAllocations) {
+        snapshot.stepAllocations[step.first].add(*step.second);
+    }
+    for (const TimingTable::step_counters_type::value_type& step : table.stepCounters) {
+        snapshot.stepCounters[step.first].add(*step.second);
+    }
+}
+
+void recordAllocations(
+    AllocationHistograms& histograms, const AllocationSample& since, const AllocationSample& now
+) {
+    const std::uint64_t allocated = now.count.allocatedBytes - since.count.allocatedBytes;
+    const std::uint64_t freed = now.count.freedBytes - since.count.freedBytes;
+    histograms.allocations.record(now.count.allocations - since.count.allocations);
+    histograms.bytes.record(allocated);
+    histograms.retainedBytes.record(allocated > freed ? allocated - freed : 0);
+    histograms.peakResidentGrowth.record(now.peakResidentBytes - since.peakResidentBytes);
+}
+
+class ThreadTimings;
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadTimings*> threads;
+    /** Timings of the threads that ended */
+    TimingSnapshot ended;
+};
+
+Registry& registry() {
+    static Registry registry;
+    return registry;
+}
+
+/**
+ * Timings of the current thread. Lookups and recording take no lock, only
+ * adding a step definition does, as snapshots must not see the table
+ * rehash.
+ */
+class ThreadTimings {
+public:
+    ThreadTimings() {
+        Registry& timingsRegistry = registry();
+        std::lock_guard<std::mutex> lock(timingsRegistry.mutex);
+        timingsRegistry.threads.push_back(this);
+    }
+
+    ~ThreadTimings() {
+        Registry& timingsRegistry = registry();
+        std::lock_guard<std::mutex> lock(timingsRegistry.mutex);
+        merge(timingsRegistry.ended, table);
+        timingsRegistry.threads.erase(
+            std::find(timingsRegistry.threads.begin(), timingsRegistry.threads.end(), this)
+        );
+    }
+
+    ThreadTimings(const ThreadTimings&) = delete;
+    ThreadTimings& operator=(const ThreadTimings&) = delete;
+
+    void record(
+        TimedOperation operation, LatencyHistogram::value_type nanoseconds, step_id_type stepId
+    ) {
+        table.operations[operation].record(nanoseconds);
+        if (operation == TIMED_INVOKE) {
+            stepHistogram(table.steps, stepId).record(nanoseconds);
+        }
+    }
+
+    void recordBenchmark(LatencyHistogram::value_type nanoseconds, step_id_type stepId) {
+        stepHistogram(table.benchmarks, stepId).record(nanoseconds);
+    }
+
+    void recordScenarioAllocations(const AllocationSample& since, const AllocationSample& now) {
+        recordAllocations(table.scenarioAllocations, since, now);
+    }
+
+    void recordStepAllocations(
+        const AllocationSample& since, const AllocationSample& now, step_id_type stepId
+    ) {
+        recordAllocations(stepAllocations(stepId), since, now);
+    }
+
+    void recordStepCounters(const HardwareCounterSample& counted, step_id_type stepId) {
+        HardwareCounterHistograms& histograms = stepCounters(stepId);
+        for (std::size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter) {
+            histograms.counters[counter].record(counted.values[counter]);
+        }
+    }
+
+    void addTo(TimingSnapshot& snapshot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        merge(snapshot, table);
+    }
+
+private:
+    LatencyHistogram& stepHistogram(TimingTable::steps_type& steps, step_id_type stepId) {
+        const TimingTable::steps_type::const_iterator found = steps.find(stepId);
+        if (found != steps.end()) {
+            return *found->second;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        return *steps.emplace(stepId, std::make_unique<LatencyHistogram>()).first->second;
+    }
+
+    AllocationHistograms& stepAllocations(step_id_type stepId) {
+        const TimingTable::step_allocations_type::const_iterator found =
+            table.stepAllocations.find(stepId);
+        if (found != table.stepAllocations.end()) {
+            return *found->second;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        return *table.stepAllocations.emplace(stepId, std::make_unique<AllocationHistograms>())
+                    .first->second;
+    }
+
+    HardwareCounterHistograms& stepCounters(step_id_type stepId) {
+        const TimingTable::step_counters_type::const_iterator found =
+            table.stepCounters.find(stepId);
+        if (found != table.stepCounters.end()) {
+            return *found->second;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        return *table.stepCounters.emplace(stepId, std::make_unique<HardwareCounterHistograms>())
+                    .first->second;
+    }
+
+    std::mutex mutex;
+    TimingTable table;
+};
+
+ThreadTimings& threadTimings() {
+    thread_local ThreadTimings timings;
+    return timings;
+}
+
+std::atomic<bool>& enabledTimings() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+}
+
+std::atomic<bool>& trackedAllocations() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+}
+
+std::atomic<bool>& countedHardware() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+}
+
+std::atomic<std::ostream*>& afterAllReport() {
+    static std::atomic<std::ostream*> out(nullptr);
+    return out;
+}
+
+std::atomic<DurationHistory*>& durationHistory() {
+    static std::atomic<DurationHistory*> history(nullptr);
+    return history;
+}
+
+void reportLine(std::ostream& out, const std::string& name, const LatencyHistogram& histogram) {
+    const auto micros = [](LatencyHistogram::value_type nanoseconds) {
+        return nanoseconds / 1000.0;
+    };
+    out << std::setw(12) << histogram.getCount() << std::setw(12)
+        << micros(histogram.percentile(50)) << std::setw(12) << micros(histogram.percentile(99))
+        << std::setw(12) << micros(histogram.getMax()) << std::setw(14)
+        << micros(histogram.getTotal()) << "  " << name << "\n";
+}
+
+void reportAllocationLine(
+    std::ostream& out, const std::string& name, const AllocationHistograms& histograms
+) {
+    const auto kilobytes = [](LatencyHistogram::value_type bytes) {
+        return bytes / 1024.0;
+    };
+    out << std::setw(12) << histograms.bytes.getCount() << std::setw(12)
+        << histograms.allocations.percentile(50) << std::setw(12)
+        << histograms.allocations.getMax() << std::setw(12)
+        << kilobytes(histograms.bytes.percentile(50)) << std::setw(12)
+        << kilobytes(histograms.bytes.getMax()) << std::setw(14)
+        << kilobytes(histograms.retainedBytes.getTotal()) << std::setw(14)
+        << kilobytes(histograms.peakResidentGrowth.getTotal()) << "  " << name << "\n";
+}
+
+void reportCounterLine(
+    std::ostream& out, const std::string& name, const HardwareCounterHistograms& histograms
+) {
+    const LatencyHistogram& cycles = histograms.counters[COUNTED_CYCLES];
+    const LatencyHistogram& instructions = histograms.counters[COUNTED_INSTRUCTIONS];
+    out << std::setw(12) << cycles.getCount() << std::setw(14) << cycles.percentile(50)
+        << std::setw(14) << instructions.percentile(50) << std::setw(8)
+        << (cycles.getTotal() > 0 ? double(instructions.getTotal()) / cycles.getTotal() : 0.0)
+        << std::setw(14) << histograms.counters[COUNTED_CACHE_MISSES].percentile(50)
+        << std::setw(14) << histograms.counters[COUNTED_BRANCH_MISSES].percentile(50) << "  "
+        << name << "\n";
+}
+
+std::string stepName(step_id_type stepId) {
+    const StepInfo* const stepInfo = StepManager::getStep(stepId);
+    return stepInfo ? std::string(stepInfo->stepDef) + " (" + std::string(stepInfo->source) + ")"
+                    : "step " + std::to_string(stepId);
+}
+
+const char* operationName(const TimedOperation operation) {
+    switch (operation) {
+    case TIMED_INVOKE:
+        return "invoke";
+    case TIMED_STEP_MATCHES:
+        return "step_matches";
+    case TIMED_HOOKS:
+        return "hooks";
+    case TIMED_WIRE_REQUESTS:
+        return "wire requests";
+    case TIMED_OPERATION_COUNT:
+        break;
+    }
+    return "unknown";
+}
+
+}
+
+void Timings::setEnabled(bool enabled) {
+    enabledTimings().store(enabled, std::memory_order_relaxed);
+}
+
+bool Timings::isEnabled() {
+    return enabledTimings().load(std::memory_order_relaxed);
+}
+
+void Timings::record(
+    TimedOperation operation, std::chrono::steady_clock::duration elapsed, step_id_type stepId
+) {
+    typedef std::chrono::nanoseconds::rep rep_type;
+    const rep_type nanoseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    threadTimings().record(
+        operation,
+        static_cast<LatencyHistogram::value_type>(std::max<rep_type>(0, nanoseconds)),
+        stepId
+    );
+}
+
+void Timings::recordBenchmark(std::chrono::nanoseconds elapsed, step_id_type stepId) {
+    threadTimings().recordBenchmark(
+        static_cast<LatencyHistogram::value_type>(std::max<std::int64_t>(0, elapsed.count())),
+        stepId
+    );
+}
+
+void Timings::setAllocationTracking(bool enabled) {
+    trackedAllocations().store(enabled, std::memory_order_relaxed);
+}
+
+bool Timings::isTrackingAllocations() {
+    return trackedAllocations().load(std::memory_order_relaxed)
+           && AllocationTracking::isInstalled();
+}
+
+// Sampled first, recording allocating the histograms of new step definitions
+void Timings::recordScenarioAllocations(const AllocationSample& since) {
+    const AllocationSample now = AllocationTracking::sample();
+    threadTimings().recordScenarioAllocations(since, now);
+}
+
+void Timings::recordStepAllocations(const AllocationSample& since, step_id_type stepId) {
+    const AllocationSample now = AllocationTracking::sample();
+    threadTimings().recordStepAllocations(since, now, stepId);
+}
+
+void Timings::setHardwareCounters(bool enabled) {
+    countedHardware().store(enabled, std::memory_order_relaxed);
+}
+
+bool Timings::isCountingHardware() {
+    return countedHardware().load(std::memory_order_relaxed);
+}
+
+void Timings::recordStepCounters(const HardwareCounterSample& counted, step_id_type stepId) {
+    threadTimings().recordStepCounters(counted, stepId);
+}
+
+TimingSnapshot Timings::snapshot() {
+    Registry& timingsRegistry = registry();
+    std::lock_guard<std::mutex> lock(timingsRegistry.mutex);
+    TimingSnapshot snapshot = timingsRegistry.ended;
+    for (ThreadTimings* thread : timingsRegistry.threads) {
+        thread->addTo(snapshot);
+    }
+    return snapshot;
+}
+
+void Timings::report(std::ostream& out) {
+    const TimingSnapshot timings = snapshot();
+    std::vector<TimingSnapshot::steps_type::const_iterator> steps;
+    for (TimingSnapshot::steps_type::const_iterator step = timings.steps.begin();
+         step != timings.steps.end();
+         ++step) {
+        steps.push_back(step);
+    }
+    std::stable_sort(
+        steps.begin(),
+        steps.end(),
+        [](TimingSnapshot::steps_type::const_iterator a,
+           TimingSnapshot::steps_type::const_iterator b) {
+            return a->second.getTotal() > b->second.getTotal();
+        }
+    );
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision(1);
+    out << std::fixed << "Timings in microseconds\n"
+        << std::setw(12) << "count" << std::setw(12) << "p50" << std::setw(12) << "p99"
+        << std::setw(12) << "max" << std::setw(14) << "total" << "\n";
+    for (std::size_t i = 0; i < TIMED_OPERATION_COUNT; ++i) {
+        reportLine(out, operationName(static_cast<TimedOperation>(i)), timings.operations[i]);
+    }
+    for (TimingSnapshot::steps_type::const_iterator step : steps) {
+        reportLine(out, stepName(step->first), step->second);
+    }
+    if (!timings.benchmarks.empty()) {
+        out << "Benchmarked iterations in microseconds\n";
+        for (const TimingSnapshot::steps_type::value_type& step : timings.benchmarks) {
+            reportLine(out, stepName(step.first), step.second);
+        }
+    }
+    if (timings.scenarioAllocations.bytes.getCount() > 0 || !timings.stepAllocations.empty()) {
+        std::vector<TimingSnapshot::step_allocations_type::const_iterator> stepAllocations;
+        for (TimingSnapshot::step_allocations_type::const_iterator step =
+                 timings.stepAllocations.begin();
+             step != timings.stepAllocations.end();
+             ++step) {
+            stepAllocations.push_back(step);
+        }
+        std::stable_sort(
+            stepAllocations.begin(),
+            stepAllocations.end(),
+            [](TimingSnapshot::step_allocations_type::const_iterator a,
+               TimingSnapshot::step_allocations_type::const_iterator b) {
+                return a->second.retainedBytes.getTotal() > b->second.retainedBytes.getTotal();
+            }
+        );
+        out << "Allocations, sizes in kilobytes\n"
+            << std::setw(12) << "count" << std::setw(12) << "allocs p50" << std::setw(12)
+            << "allocs max" << std::setw(12) << "size p50" << std::setw(12) << "size max"
+            << std::setw(14) << "retained" << std::setw(14) << "peak rss" << "\n";
+        reportAllocationLine(out, "scenarios", timings.scenarioAllocations);
+        for (TimingSnapshot::step_allocations_type::const_iterator step : stepAllocations) {
+            reportAllocationLine(out, stepName(step->first), step->second);
+        }
+    }
+    if (!timings.stepCounters.empty()) {
+        std::vector<TimingSnapshot::step_counters_type::const_iterator> stepCounters;
+        for (TimingSnapshot::step_counters_type::const_iterator step =
+                 timings.stepCounters.begin();
+             step != timings.stepCounters.end();
+             ++step) {
+            stepCounters.push_back(step);
+        }
+        std::stable_sort(
+            stepCounters.begin(),
+            stepCounters.end(),
+            [](TimingSnapshot::step_counters_type::const_iterator a,
+               TimingSnapshot::step_counters_type::const_iterator b) {
+                return a->second.counters[COUNTED_CYCLES].getTotal()
+                       > b->second.counters[COUNTED_CYCLES].getTotal();
+            }
+        );
+        out << "Hardware counters, medians per invocation\n"
+            << std::setw(12) << "count" << std::setw(14) << "cycles" << std::setw(14)
+            << "instructions" << std::setw(8) << "ipc" << std::setw(14) << "cache misses"
+            << std::setw(14) << "branch misses" << "\n";
+        for (TimingSnapshot::step_counters_type::const_iterator step : stepCounters) {
+            reportCounterLine(out, stepName(step->first), step->second);
+        }
+    }
+    out.flags(flags);
+    out.precision(precision);
+    out.flush();
+}
+
+void Timings::setAfterAllReport(std::ostream* out) {
+    afterAllReport().store(out, std::memory_order_relaxed);
+}
+
+void Timings::setDurationHistory(DurationHistory* history) {
+    durationHistory().store(history, std::memory_order_relaxed);
+}
+
+void Timings::afterAll() {
+    std::ostream* const out = afterAllReport().load(std::memory_order_relaxed);
+    if (out && isEnabled()) {
+        report(*out);
+    }
+    DurationHistory* const history = durationHistory().load(std::memory_order_relaxed);
+    if (history && isEnabled()) {
+        for (const TimingSnapshot::steps_type::value_type& step : snapshot().steps) {
+            const StepInfo* const stepInfo = StepManager::getStep(step.first);
+            if (stepInfo && step.second.getCount() > 0) {
+                history->record(
+                    DurationHistory::STEP,
+                    DurationHistory::key(stepInfo->stepDef),
+                    std::chrono::nanoseconds(step.second.getTotal() / step.second.getCount())
+                );
+            }
+        }
+    }
+}
+
+ScopedTiming::ScopedTiming(TimedOperation operation, step_id_type stepId) :
+    operation(operation),
+    stepId(stepId),
+    enabled(Timings::isEnabled()) {
+    if (enabled) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedTiming::~ScopedTiming() {
+    if (enabled) {
+        Timings::record(operation, std::chrono::steady_clock::now() - start, stepId);
+    }
+}
+
+ScopedAllocations::ScopedAllocations(step_id_type stepId) :
+    stepId(stepId),
+    enabled(Timings::isTrackingAllocations()),
+    start() {
+    if (enabled) {
+        start = AllocationTracking::sample();
+    }
+}
+
+ScopedAllocations::~ScopedAllocations() {
+    if (enabled) {
+        Timings::recordStepAllocations(start, stepId);
+    }
+}
+
+ScopedHardwareCounters::ScopedHardwareCounters(step_id_type stepId) :
+    stepId(stepId) {
+    if (Timings::isCountingHardware()) {
+        start = HardwareCounters::sample();
+    }
+}
+
+// Sampled first, recording allocating the histograms of new step definitions
+ScopedHardwareCounters::~ScopedHardwareCounters() {
+    if (start) {
+        if (const std::optional<HardwareCounterSample> now = HardwareCounters::sample()) {
+            Timings::recordStepCounters(now->since(*start), stepId);
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,213 @@
+#include "cucumber-cpp/internal/TraceRecorder.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+
+#if defined(_WIN32)
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+class ThreadTrace;
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadTrace*> threads;
+    /** Events of the threads that ended */
+    std::vector<TraceEvent> ended;
+    std::uint32_t lastThread = 0;
+    std::string afterAllFile;
+};
+
+Registry& registry() {
+    static Registry registry;
+    return registry;
+}
+
+/**
+ * Events of the current thread. Only snapshots contend for the lock.
+ */
+class ThreadTrace {
+public:
+    ThreadTrace() {
+        Registry& traceRegistry = registry();
+        std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+        thread = ++traceRegistry.lastThread;
+        traceRegistry.threads.push_back(this);
+    }
+
+    ~ThreadTrace() {
+        Registry& traceRegistry = registry();
+        std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+        traceRegistry.ended.insert(traceRegistry.ended.end(), events.begin(), events.end());
+        traceRegistry.threads.erase(
+            std::find(traceRegistry.threads.begin(), traceRegistry.threads.end(), this)
+        );
+    }
+
+    ThreadTrace(const ThreadTrace&) = delete;
+    ThreadTrace& operator=(const ThreadTrace&) = delete;
+
+    void record(TraceEvent event) {
+        event.thread = thread;
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(std::move(event));
+    }
+
+    void addTo(std::vector<TraceEvent>& snapshot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        snapshot.insert(snapshot.end(), events.begin(), events.end());
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::uint32_t thread;
+};
+
+ThreadTrace& threadTrace() {
+    thread_local ThreadTrace trace;
+    return trace;
+}
+
+std::atomic<bool>& enabledTrace() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+}
+
+long processId() {
+#if defined(_WIN32)
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+double microseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+std::string jsonString(const std::string& text) {
+    return nlohmann::json(text).dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+}
+
+void TraceRecorder::setEnabled(bool enabled) {
+    enabledTrace().store(enabled, std::memory_order_relaxed);
+}
+
+bool TraceRecorder::isEnabled() {
+    return enabledTrace().load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::record(
+    const char* category,
+    std::string_view name,
+    std::string_view source,
+    std::chrono::steady_clock::time_point begin,
+    std::chrono::steady_clock::time_point end
+) {
+    threadTrace().record(
+        TraceEvent{category, std::string(name), std::string(source), begin, end - begin, 0}
+    );
+}
+
+std::vector<TraceEvent> TraceRecorder::events() {
+    std::vector<TraceEvent> events;
+    {
+        Registry& traceRegistry = registry();
+        std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+        events = traceRegistry.ended;
+        for (ThreadTrace* thread : traceRegistry.threads) {
+            thread->addTo(events);
+        }
+    }
+    std::stable_sort(
+        events.begin(),
+        events.end(),
+        [](const TraceEvent& a, const TraceEvent& b) {
+            return a.begin < b.begin;
+        }
+    );
+    return events;
+}
+
+void TraceRecorder::write(std::ostream& out) {
+    const std::vector<TraceEvent> recorded = events();
+    const long pid = processId();
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision(3);
+    out << std::fixed << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+        << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":" << pid
+        << ",\"tid\":0,\"args\":{\"name\":\"cucumber-cpp\"}}";
+    for (const TraceEvent& event : recorded) {
+        out << ",\n{\"ph\":\"X\",\"cat\":\"" << event.category
+            << "\",\"name\":" << jsonString(event.name) << ",\"pid\":" << pid
+            << ",\"tid\":" << event.thread
+            << ",\"ts\":" << microseconds(event.begin.time_since_epoch())
+            << ",\"dur\":" << microseconds(event.duration);
+        if (!event.source.empty()) {
+            out << ",\"args\":{\"source\":" << jsonString(event.source) << "}";
+        }
+        out << "}";
+    }
+    out << "\n]}\n";
+    out.flags(flags);
+    out.precision(precision);
+    out.flush();
+}
+
+void TraceRecorder::setAfterAllFile(const std::string& path) {
+    Registry& traceRegistry = registry();
+    std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+    traceRegistry.afterAllFile = path;
+}
+
+void TraceRecorder::afterAll() {
+    std::string path;
+    {
+        Registry& traceRegistry = registry();
+        std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+        path = traceRegistry.afterAllFile;
+    }
+    if (path.empty() || !isEnabled()) {
+        return;
+    }
+    std::ofstream out(path);
+    if (out) {
+        write(out);
+    }
+}
+
+ScopedTraceEvent::ScopedTraceEvent(
+    const char* category, std::string_view name, std::string_view source
+) :
+    category(category),
+    name(name),
+    source(source),
+    enabled(TraceRecorder::isEnabled()) {
+    if (enabled) {
+        begin = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedTraceEvent::~ScopedTraceEvent() {
+    if (enabled) {
+        TraceRecorder::record(category, name, source, begin, std::chrono::steady_clock::now());
+    }
+}
+
+}
+}
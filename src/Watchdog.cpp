@@ -0,0 +1,125 @@
+#include <cucumber-cpp/internal/utils/Watchdog.hpp>
+
+#include <algorithm>
+
+namespace cucumber {
+namespace internal {
+
+constexpr std::chrono::milliseconds Watchdog::TICK;
+constexpr std::size_t Watchdog::WHEEL_SIZE;
+
+Watchdog::Watchdog() :
+    start(clock_type::now()),
+    wheel(WHEEL_SIZE) {
+    thread = std::thread(&Watchdog::work, this);
+}
+
+Watchdog::~Watchdog() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_one();
+    thread.join();
+}
+
+Watchdog& Watchdog::instance() {
+    static Watchdog watchdog;
+    return watchdog;
+}
+
+Watchdog::timer_type Watchdog::arm(const clock_type::duration timeout, callback_type callback) {
+    timer_type id;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const clock_type::time_point now = clock_type::now();
+        if (armedTimers == 0) {
+            // Nothing to expire in the ticks left behind while idle
+            processedTick = std::max(processedTick, ticksAt(now));
+        }
+        // Rounded up, and at least the tick after the last one processed
+        const tick_type due = std::max(
+            ticksAt(now + timeout + TICK - clock_type::duration(1)), processedTick + 1
+        );
+        const std::size_t slot = due % WHEEL_SIZE;
+        id = ++lastTimer * WHEEL_SIZE + slot;
+        wheel[slot].push_back({id, (due - processedTick - 1) / WHEEL_SIZE, std::move(callback)});
+        ++armedTimers;
+    }
+    changed.notify_one();
+    return id;
+}
+
+bool Watchdog::disarm(const timer_type timer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Timers are numbered after their slot
+    slot_type& slot = wheel[timer % WHEEL_SIZE];
+    const slot_type::iterator found =
+        std::find_if(slot.begin(), slot.end(), [timer](const Timer& armed) {
+            return armed.id == timer;
+        });
+    if (found == slot.end()) {
+        return false;
+    }
+    slot.erase(found);
+    --armedTimers;
+    return true;
+}
+
+std::size_t Watchdog::armed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return armedTimers;
+}
+
+Watchdog::tick_type Watchdog::ticksAt(const clock_type::time_point time) const {
+    return static_cast<tick_type>((time - start) / TICK);
+}
+
+Watchdog::tick_type Watchdog::nextTick() const {
+    for (tick_type tick = processedTick + 1; tick <= processedTick + WHEEL_SIZE; ++tick) {
+        if (!wheel[tick % WHEEL_SIZE].empty()) {
+            return tick;
+        }
+    }
+    return processedTick + WHEEL_SIZE;
+}
+
+void Watchdog::work() {
+    std::unique_lock<std::mutex> lock(mutex);
+    std::vector<callback_type> expired;
+    while (!stopping) {
+        if (armedTimers == 0) {
+            changed.wait_for(lock, std::chrono::seconds(1));
+            continue;
+        }
+        const tick_type next = nextTick();
+        if (ticksAt(clock_type::now()) < next) {
+            // Woken up early when a timer is armed or disarmed
+            changed.wait_until(lock, start + next * TICK);
+            continue;
+        }
+        const tick_type now = ticksAt(clock_type::now());
+        while (processedTick < now) {
+            slot_type& slot = wheel[++processedTick % WHEEL_SIZE];
+            for (slot_type::iterator timer = slot.begin(); timer != slot.end();) {
+                if (timer->rounds > 0) {
+                    --timer->rounds;
+                    ++timer;
+                } else {
+                    expired.push_back(std::move(timer->callback));
+                    timer = slot.erase(timer);
+                    --armedTimers;
+                }
+            }
+        }
+        lock.unlock();
+        for (const callback_type& callback : expired) {
+            callback();
+        }
+        expired.clear();
+        lock.lock();
+    }
+}
+
+}
+}
@@ -0,0 +1,119 @@
+#include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+
+#include <zstd.h>
+
+#include <memory>
+#include <string>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+const char UNCOMPRESSED = 0;
+const char COMPRESSED = 1;
+
+// Fast rather than small: messages are compressed on every round trip
+const int COMPRESSION_LEVEL = 1;
+
+struct CompressionContextDeleter {
+    void operator()(ZSTD_CCtx* context) const {
+        ZSTD_freeCCtx(context);
+    }
+};
+
+struct DecompressionContextDeleter {
+    void operator()(ZSTD_DCtx* context) const {
+        ZSTD_freeDCtx(context);
+    }
+};
+
+ZSTD_CCtx* compressionContext() {
+    thread_local const std::unique_ptr<ZSTD_CCtx, CompressionContextDeleter> context(
+        ZSTD_createCCtx()
+    );
+    return context.get();
+}
+
+ZSTD_DCtx* decompressionContext() {
+    thread_local const std::unique_ptr<ZSTD_DCtx, DecompressionContextDeleter> context(
+        ZSTD_createDCtx()
+    );
+    return context.get();
+}
+}
+
+CompressingWireMessageCodec::CompressingWireMessageCodec(
+    const WireMessageCodec& codec, std::size_t threshold
+) :
+    codec(codec),
+    threshold(threshold) {
+}
+
+std::shared_ptr<WireCommand> CompressingWireMessageCodec::decode(const std::string& request
+) const {
+    return codec.decode(decompress(request));
+}
+
+const std::string CompressingWireMessageCodec::encode(const WireResponse& response) const {
+    return compress(codec.encode(response), threshold);
+}
+
+std::string CompressingWireMessageCodec::compress(
+    const std::string& message, std::size_t threshold
+) {
+    if (message.size() >= threshold) {
+        std::string compressed(1 + ZSTD_compressBound(message.size()), COMPRESSED);
+        const std::size_t size = ZSTD_compressCCtx(
+            compressionContext(),
+            &compressed[1],
+            compressed.size() - 1,
+            message.data(),
+            message.size(),
+            COMPRESSION_LEVEL
+        );
+        if (!ZSTD_isError(size) && size < message.size()) {
+            compressed.resize(1 + size);
+            return compressed;
+        }
+    }
+    std::string uncompressed;
+    uncompressed.reserve(1 + message.size());
+    uncompressed += UNCOMPRESSED;
+    uncompressed += message;
+    return uncompressed;
+}
+
+std::string CompressingWireMessageCodec::decompress(const std::string& message) {
+    if (message.empty()) {
+        throw WireMessageCodecException("Missing compression flag");
+    }
+    if (message[0] == UNCOMPRESSED) {
+        return message.substr(1);
+    }
+    if (message[0] != COMPRESSED) {
+        throw WireMessageCodecException("Unknown compression flag");
+    }
+    const unsigned long long size = ZSTD_getFrameContentSize(&message[1], message.size() - 1);
+    if (size == ZSTD_CONTENTSIZE_ERROR || size == ZSTD_CONTENTSIZE_UNKNOWN) {
+        throw WireMessageCodecException("Malformed compressed message");
+    }
+    if (size > MAX_MESSAGE_SIZE) {
+        throw WireMessageCodecException("Compressed message too long");
+    }
+    std::string decompressed(static_cast<std::size_t>(size), '\0');
+    const std::size_t decompressedSize = ZSTD_decompressDCtx(
+        decompressionContext(),
+        &decompressed[0],
+        decompressed.size(),
+        &message[1],
+        message.size() - 1
+    );
+    if (ZSTD_isError(decompressedSize) || decompressedSize != decompressed.size()) {
+        throw WireMessageCodecException("Malformed compressed message");
+    }
+    return decompressed;
+}
+
+}
+}
@@ -0,0 +1,498 @@
+#include <cucumber-cpp/internal/connectors/wire/SharedMemoryServer.hpp>
+
+#if defined(__linux__)
+
+    #include <algorithm>
+    #include <atomic>
+    #include <cerrno>
+    #include <climits>
+    #include <cstdint>
+    #include <cstring>
+    #include <limits>
+    #include <new>
+    #include <stdexcept>
+    #include <system_error>
+
+    #include <fcntl.h>
+    #include <linux/futex.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+    #include <unistd.h>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+typedef std::atomic<std::uint32_t> futex_type;
+static_assert(
+    sizeof(futex_type) == sizeof(std::uint32_t) && futex_type::is_always_lock_free,
+    "Futexes are plain 32 bit words"
+);
+
+const std::uint32_t MAGIC = 0x43554b45;
+
+/**
+ * States of a segment. A disconnected client is forgotten, and the segment
+ * idle again, once the server has reset the ring buffers.
+ */
+enum : std::uint32_t { IDLE, CONNECTED, DISCONNECTED, SHUT_DOWN };
+
+/**
+ * Checks before sleeping, so that the response to a step taking
+ * microseconds is picked up without a system call
+ */
+const int SPINS = 4000;
+
+/**
+ * Sleeps are cut short now and then, in case a wake up went astray
+ */
+const long WAIT_TIMEOUT_NS = 100 * 1000 * 1000;
+
+struct alignas(64) RingControl {
+    std::atomic<std::uint64_t> written;
+    std::atomic<std::uint64_t> read;
+    /** Bumped whenever bytes are written */
+    futex_type dataSignal;
+    /** Bumped whenever bytes are read */
+    futex_type spaceSignal;
+    futex_type readerWaiting;
+    futex_type writerWaiting;
+};
+
+struct SegmentHeader {
+    std::atomic<std::uint32_t> magic;
+    std::uint32_t capacity;
+    futex_type state;
+    /**
+     * Process of the connected client, 0 until it is known. The server
+     * takes a client whose process is gone for disconnected, as a client
+     * crashing never says so. Both are to run in the same pid namespace.
+     */
+    std::atomic<std::int32_t> clientPid;
+    RingControl requests;
+    RingControl responses;
+};
+
+std::size_t segmentSize(const std::size_t capacity) {
+    return sizeof(SegmentHeader) + 2 * capacity;
+}
+
+void futexWait(futex_type& word, const std::uint32_t expected) {
+    const timespec timeout = {0, WAIT_TIMEOUT_NS};
+    syscall(
+        SYS_futex,
+        reinterpret_cast<std::uint32_t*>(&word),
+        FUTEX_WAIT,
+        expected,
+        &timeout,
+        nullptr,
+        0
+    );
+}
+
+void futexWake(futex_type& word) {
+    syscall(
+        SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0
+    );
+}
+
+void cpuRelax() {
+    #if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+    #endif
+}
+
+bool isRunning(const std::int32_t pid) {
+    return pid == 0 || ::kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+std::system_error systemError(const std::string& what) {
+    return std::system_error(errno, std::generic_category(), what);
+}
+
+/**
+ * One way byte stream between the server and its client. Reads and writes
+ * give up once the peer is gone, reads only once nothing is left to read.
+ */
+class Ring {
+public:
+    /**
+     * @param peerPid process of the peer, checked while waiting for it, or
+     *        nullptr to rely on the state alone
+     */
+    Ring(
+        RingControl& control,
+        char* data,
+        const std::size_t capacity,
+        futex_type& state,
+        const std::atomic<std::int32_t>* peerPid
+    ) :
+        control(control),
+        data(data),
+        capacity(capacity),
+        state(state),
+        peerPid(peerPid) {
+    }
+
+    bool writeMessage(const std::string& message) {
+        if (message.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("Message too long for shared memory");
+        }
+        const std::uint32_t length = static_cast<std::uint32_t>(message.size());
+        return write(reinterpret_cast<const char*>(&length), sizeof(length))
+               && write(message.data(), message.size());
+    }
+
+    /**
+     * Fails on a message longer than the maximum length as on the peer
+     * being gone, without reading it
+     */
+    bool readMessage(std::string& message, const std::size_t maxLength) {
+        std::uint32_t length;
+        if (!read(reinterpret_cast<char*>(&length), sizeof(length)) || length > maxLength) {
+            return false;
+        }
+        message.resize(length);
+        return read(&message[0], length);
+    }
+
+    /**
+     * Drops what was not read. Positions keep growing, so that a peer still
+     * waiting on them does not take earlier bytes for new ones.
+     */
+    void discard() {
+        control.read.store(control.written.load());
+    }
+
+    /**
+     * Wakes up both sides, to notice that the state changed
+     */
+    void wake() {
+        control.dataSignal.fetch_add(1);
+        futexWake(control.dataSignal);
+        control.spaceSignal.fetch_add(1);
+        futexWake(control.spaceSignal);
+    }
+
+private:
+    bool write(const char* bytes, std::size_t size) {
+        while (size > 0) {
+            const std::uint64_t written = control.written.load(std::memory_order_relaxed);
+            std::size_t space = 0;
+            const bool ready = waitUntil(control.spaceSignal, control.writerWaiting, [&] {
+                space = capacity - static_cast<std::size_t>(written - control.read.load());
+                return space > 0;
+            });
+            if (!ready || state.load() != CONNECTED) {
+                return false;
+            }
+            const std::size_t offset = static_cast<std::size_t>(written % capacity);
+            const std::size_t chunk = std::min({size, space, capacity - offset});
+            std::memcpy(data + offset, bytes, chunk);
+            control.written.store(written + chunk);
+            signal(control.dataSignal, control.readerWaiting);
+            bytes += chunk;
+            size -= chunk;
+        }
+        return true;
+    }
+
+    bool read(char* bytes, std::size_t size) {
+        while (size > 0) {
+            const std::uint64_t read = control.read.load(std::memory_order_relaxed);
+            std::size_t available = 0;
+            const bool ready = waitUntil(control.dataSignal, control.readerWaiting, [&] {
+                available = static_cast<std::size_t>(control.written.load() - read);
+                return available > 0;
+            });
+            if (!ready) {
+                return false;
+            }
+            const std::size_t offset = static_cast<std::size_t>(read % capacity);
+            const std::size_t chunk = std::min({size, available, capacity - offset});
+            std::memcpy(bytes, data + offset, chunk);
+            control.read.store(read + chunk);
+            signal(control.spaceSignal, control.writerWaiting);
+            bytes += chunk;
+            size -= chunk;
+        }
+        return true;
+    }
+
+    /**
+     * Spins, then sleeps on the signal until ready, returning false if the
+     * peer is gone first. The peer sees the waiting flag before it could
+     * miss the sleeper, or the sleeper sees the signal bumped.
+     */
+    template<typename Ready>
+    bool waitUntil(futex_type& signal, futex_type& waiting, Ready ready) {
+        for (int spin = 0; spin < SPINS; ++spin) {
+            if (ready()) {
+                return true;
+            }
+            cpuRelax();
+        }
+        for (;;) {
+            const std::uint32_t seen = signal.load();
+            if (ready()) {
+                return true;
+            }
+            if (state.load() != CONNECTED || (peerPid && !isRunning(peerPid->load()))) {
+                return false;
+            }
+            waiting.store(1);
+            if (!ready()) {
+                futexWait(signal, seen);
+            }
+            waiting.store(0);
+        }
+    }
+
+    static void signal(futex_type& signal, futex_type& waiting) {
+        signal.fetch_add(1);
+        if (waiting.load()) {
+            futexWake(signal);
+        }
+    }
+
+    RingControl& control;
+    char* const data;
+    const std::size_t capacity;
+    futex_type& state;
+    const std::atomic<std::int32_t>* const peerPid;
+};
+
+}
+
+/**
+ * Mapping of a segment, with the requests going from the client to the
+ * server and the responses back
+ */
+class SharedMemorySegment {
+public:
+    /**
+     * Creates the segment
+     */
+    SharedMemorySegment(const std::string& name, const std::size_t capacity) {
+        if (capacity == 0 || capacity > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::invalid_argument("Invalid shared memory capacity");
+        }
+        const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw systemError("Unable to create shared memory " + name);
+        }
+        size = segmentSize(capacity);
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            const std::system_error error = systemError("Unable to size shared memory " + name);
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw error;
+        }
+        try {
+            map(fd, name);
+        } catch (...) {
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+        new (mapping) SegmentHeader();
+        header().capacity = static_cast<std::uint32_t>(capacity);
+        initRings(&header().clientPid);
+        header().magic.store(MAGIC);
+    }
+
+    /**
+     * Opens the segment a server created
+     */
+    explicit SharedMemorySegment(const std::string& name) {
+        const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            throw systemError("Unable to open shared memory " + name);
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            const std::system_error error = systemError("Unable to open shared memory " + name);
+            ::close(fd);
+            throw error;
+        }
+        size = static_cast<std::size_t>(status.st_size);
+        if (size < sizeof(SegmentHeader)) {
+            ::close(fd);
+            throw std::runtime_error("Not a wire server segment: " + name);
+        }
+        map(fd, name);
+        if (header().magic.load() != MAGIC || segmentSize(header().capacity) != size) {
+            ::munmap(mapping, size);
+            throw std::runtime_error("Not a wire server segment: " + name);
+        }
+        initRings(nullptr);
+    }
+
+    ~SharedMemorySegment() {
+        ::munmap(mapping, size);
+    }
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+    SegmentHeader& header() {
+        return *static_cast<SegmentHeader*>(mapping);
+    }
+
+    /**
+     * Changes the state, waking up whoever waits for either side
+     */
+    void setState(const std::uint32_t state) {
+        header().state.store(state);
+        futexWake(header().state);
+        requests->wake();
+        responses->wake();
+    }
+
+    std::unique_ptr<Ring> requests;
+    std::unique_ptr<Ring> responses;
+
+private:
+    void map(const int fd, const std::string& name) {
+        mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            throw systemError("Unable to map shared memory " + name);
+        }
+    }
+
+    void initRings(const std::atomic<std::int32_t>* peerPid) {
+        SegmentHeader& shared = header();
+        char* const data = static_cast<char*>(mapping) + sizeof(SegmentHeader);
+        requests.reset(new Ring(shared.requests, data, shared.capacity, shared.state, peerPid));
+        responses.reset(new Ring(
+            shared.responses, data + shared.capacity, shared.capacity, shared.state, peerPid
+        ));
+    }
+
+    void* mapping;
+    std::size_t size;
+};
+
+const std::size_t SharedMemoryServer::DEFAULT_CAPACITY;
+
+SharedMemoryServer::SharedMemoryServer(const ProtocolHandler* protocolHandler) :
+    protocolHandler(protocolHandler),
+    maxMessageLength(16 * 1024 * 1024) {
+}
+
+SharedMemoryServer::~SharedMemoryServer() {
+    if (!segment) {
+        return;
+    }
+    segment->setState(SHUT_DOWN);
+    ::shm_unlink(name.c_str());
+}
+
+void SharedMemoryServer::listen(const std::string& name, const std::size_t capacity) {
+    if (segment) {
+        throw std::system_error(std::make_error_code(std::errc::already_connected));
+    }
+    // A segment outlives a server that crashed
+    ::shm_unlink(name.c_str());
+    segment.reset(new SharedMemorySegment(name, capacity));
+    this->name = name;
+}
+
+const std::string& SharedMemoryServer::listenName() const {
+    return name;
+}
+
+void SharedMemoryServer::setMaxMessageLength(const std::size_t length) {
+    maxMessageLength = length;
+}
+
+void SharedMemoryServer::acceptOnce() {
+    serve(*protocolHandler);
+}
+
+void SharedMemoryServer::acceptSessions(
+    const session_factory_type& newSession, const std::size_t maxSessions
+) {
+    for (std::size_t sessions = 0; maxSessions == 0 || sessions < maxSessions; ++sessions) {
+        const std::unique_ptr<const ProtocolHandler> handler = newSession();
+        serve(*handler);
+    }
+}
+
+void SharedMemoryServer::serve(const ProtocolHandler& handler) {
+    if (!segment) {
+        throw std::system_error(std::make_error_code(std::errc::not_connected));
+    }
+    futex_type& state = segment->header().state;
+    for (std::uint32_t seen = state.load(); seen == IDLE; seen = state.load()) {
+        futexWait(state, seen);
+    }
+    std::string request;
+    while (segment->requests->readMessage(request, maxMessageLength)) {
+        if (!segment->responses->writeMessage(handler.handle(request))) {
+            break;
+        }
+    }
+    // Tells a client still there that the session is over
+    segment->setState(DISCONNECTED);
+    segment->requests->discard();
+    segment->responses->discard();
+    segment->header().clientPid.store(0);
+    segment->setState(IDLE);
+}
+
+SharedMemoryClient::SharedMemoryClient(const std::string& name) :
+    segment(new SharedMemorySegment(name)) {
+    futex_type& state = segment->header().state;
+    for (;;) {
+        std::uint32_t seen = IDLE;
+        if (state.compare_exchange_strong(seen, CONNECTED)) {
+            segment->header().clientPid.store(static_cast<std::int32_t>(::getpid()));
+            futexWake(state);
+            return;
+        }
+        if (seen == CONNECTED) {
+            throw std::runtime_error("Shared memory server busy with another client: " + name);
+        }
+        if (seen == SHUT_DOWN) {
+            throw std::runtime_error("Shared memory server gone: " + name);
+        }
+        // Waits for the server to be done with the previous client
+        futexWait(state, seen);
+    }
+}
+
+SharedMemoryClient::~SharedMemoryClient() {
+    std::uint32_t connected = CONNECTED;
+    if (segment->header().state.compare_exchange_strong(connected, DISCONNECTED)) {
+        segment->setState(DISCONNECTED);
+    }
+}
+
+void SharedMemoryClient::send(const std::string& message) {
+    if (!segment->requests->writeMessage(message)) {
+        throw std::runtime_error("Shared memory server gone");
+    }
+}
+
+std::string SharedMemoryClient::receive() {
+    std::string response;
+    if (!segment->responses->readMessage(response, std::numeric_limits<std::uint32_t>::max())) {
+        throw std::runtime_error("Shared memory server gone");
+    }
+    return response;
+}
+
+std::string SharedMemoryClient::request(const std::string& message) {
+    send(message);
+    return receive();
+}
+
+}
+}
+
+#endif
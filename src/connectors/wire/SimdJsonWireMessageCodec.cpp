@@ -0,0 +1,181 @@
+#include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+#include <cucumber-cpp/internal/connectors/wire/WireProtocolCommands.hpp>
+
+#include <simdjson.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+using simdjson::ondemand::json_type;
+typedef simdjson::ondemand::value json_value;
+
+/**
+ * Thrown on anything left to JsonWireMessageCodec
+ */
+struct UnsupportedRequest {};
+
+std::string_view stringOf(json_value value) {
+    if (value.type() != json_type::string) {
+        throw UnsupportedRequest();
+    }
+    return value.get_string();
+}
+
+CukeEngine::tags_type scenarioTags(json_value* args) {
+    CukeEngine::tags_type tags;
+    if (args == nullptr || args->is_null()) {
+        return tags;
+    }
+    bool found = false;
+    for (simdjson::ondemand::field field : args->get_object()) {
+        const std::string_view key = field.unescaped_key();
+        if (key == "tags") {
+            for (json_value tag : field.value().get_array()) {
+                tags.emplace_back(stringOf(tag));
+            }
+            found = true;
+        } else if (key == "traceparent") {
+            // Left to JsonWireMessageCodec, which passes it on
+            throw UnsupportedRequest();
+        }
+    }
+    if (!found) {
+        throw UnsupportedRequest();
+    }
+    return tags;
+}
+
+std::shared_ptr<WireCommand> decodeStepMatches(json_value args) {
+    std::string nameToMatch;
+    bool found = false;
+    for (simdjson::ondemand::field field : args.get_object()) {
+        if (field.unescaped_key().value() == "name_to_match") {
+            nameToMatch = stringOf(field.value());
+            found = true;
+        }
+    }
+    if (!found) {
+        throw UnsupportedRequest();
+    }
+    return WireRequestScratch::make<StepMatchesCommand>(nameToMatch);
+}
+
+void decodeTableArg(json_value jsonTableArg, CukeEngine::invoke_table_type& tableArg) {
+    // Uneven rows and cells other than strings are left to the DOM decoder
+    if (!tableArg.empty()) {
+        throw UnsupportedRequest();
+    }
+    for (json_value jsonRow : jsonTableArg.get_array()) {
+        if (jsonRow.type() != json_type::array) {
+            throw UnsupportedRequest();
+        }
+        CukeEngine::invoke_args_type row;
+        if (!tableArg.empty()) {
+            row.reserve(tableArg.front().size());
+        }
+        for (json_value cell : jsonRow.get_array()) {
+            row.emplace_back(stringOf(cell));
+        }
+        if (!tableArg.empty() && row.size() != tableArg.front().size()) {
+            throw UnsupportedRequest();
+        }
+        tableArg.push_back(std::move(row));
+    }
+}
+
+std::shared_ptr<WireCommand> decodeInvoke(json_value args) {
+    std::string id;
+    CukeEngine::invoke_args_type invokeArgs;
+    CukeEngine::invoke_table_type tableArg;
+    bool foundId = false, foundArgs = false;
+    for (simdjson::ondemand::field field : args.get_object()) {
+        const std::string_view key = field.unescaped_key();
+        if (key == "id") {
+            id = stringOf(field.value());
+            foundId = true;
+        } else if (key == "args") {
+            for (json_value arg : field.value().get_array()) {
+                const json_type type = arg.type();
+                if (type == json_type::string) {
+                    invokeArgs.emplace_back(arg.get_string().value());
+                } else if (type == json_type::array) {
+                    decodeTableArg(arg, tableArg);
+                }
+            }
+            foundArgs = true;
+        }
+    }
+    if (!foundId || !foundArgs) {
+        throw UnsupportedRequest();
+    }
+    return WireRequestScratch::make<InvokeCommand>(
+        std::move(id), std::move(invokeArgs), std::move(tableArg)
+    );
+}
+
+std::shared_ptr<WireCommand> decodeCommand(std::string_view command, json_value* args) {
+    if (command == "begin_scenario") {
+        return WireRequestScratch::make<BeginScenarioCommand>(scenarioTags(args));
+    }
+    if (command == "end_scenario") {
+        return WireRequestScratch::make<EndScenarioCommand>(scenarioTags(args));
+    }
+    if (args == nullptr) {
+        throw UnsupportedRequest();
+    }
+    if (command == "step_matches") {
+        return decodeStepMatches(*args);
+    }
+    if (command == "invoke") {
+        return decodeInvoke(*args);
+    }
+    throw UnsupportedRequest();
+}
+
+std::shared_ptr<WireCommand> decodeRequest(const std::string& request) {
+    thread_local simdjson::ondemand::parser parser;
+    thread_local simdjson::padded_string paddedRequest;
+    // Lines read into a string usually leave room enough for the padding
+    simdjson::padded_string_view input;
+    if (request.capacity() - request.size() >= simdjson::SIMDJSON_PADDING) {
+        input = simdjson::padded_string_view(request.data(), request.size(), request.capacity());
+    } else {
+        paddedRequest = simdjson::padded_string(request);
+        input = paddedRequest;
+    }
+    simdjson::ondemand::document message = parser.iterate(input);
+    std::string_view command;
+    std::shared_ptr<WireCommand> decoded;
+    std::size_t index = 0;
+    for (json_value element : message.get_array()) {
+        if (index == 0) {
+            command = stringOf(element);
+        } else if (index == 1) {
+            decoded = decodeCommand(command, &element);
+        }
+        ++index;
+    }
+    if (index == 0 || !message.at_end()) {
+        throw UnsupportedRequest();
+    }
+    return decoded ? decoded : decodeCommand(command, nullptr);
+}
+}
+
+std::shared_ptr<WireCommand> SimdJsonWireMessageCodec::decode(const std::string& request) const {
+    try {
+        return decodeRequest(request);
+    } catch (const UnsupportedRequest&) {
+    } catch (const simdjson::simdjson_error&) {
+    }
+    return JsonWireMessageCodec::decode(request);
+}
+
+}
+}
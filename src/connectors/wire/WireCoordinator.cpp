@@ -0,0 +1,229 @@
+#include <cucumber-cpp/internal/connectors/wire/WireCoordinator.hpp>
+#include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+// FNV-1a
+const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+const std::uint64_t FNV_PRIME = 1099511628211ull;
+
+std::uint64_t hashStrings(std::uint64_t hash, const std::vector<std::string>& strings) {
+    for (const std::string& string : strings) {
+        for (const char c : string) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * FNV_PRIME;
+        }
+        hash = (hash ^ 0xffu) * FNV_PRIME;
+    }
+    return hash;
+}
+
+std::string encodeFailure(const std::string& message) {
+    return JsonWireMessageCodec().encode(FailureResponse(message));
+}
+}
+
+constexpr std::chrono::nanoseconds WireCoordinator::DEFAULT_DURATION;
+
+WireCoordinator::WireCoordinator(
+    const std::vector<std::string>& workers, DurationHistory* history
+) :
+    addresses(workers),
+    history(history ? *history : ownHistory),
+    load(workers.size()) {
+    if (workers.empty()) {
+        throw std::invalid_argument("No workers to coordinate");
+    }
+}
+
+const std::vector<std::string>& WireCoordinator::workers() const {
+    return addresses;
+}
+
+WireCoordinator::worker_type WireCoordinator::beginScenario(scenario_key_type scenario) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const worker_type worker = leastLoadedLocked();
+    const std::chrono::nanoseconds expected = expectedDurationLocked(scenario);
+    load[worker].expectedWork += expected;
+    ++load[worker].scenarios;
+    running.emplace(std::make_pair(worker, scenario), expected);
+    return worker;
+}
+
+void WireCoordinator::endScenario(
+    worker_type worker, scenario_key_type scenario, std::chrono::nanoseconds duration
+) {
+    std::lock_guard<std::mutex> lock(mutex);
+    releaseLocked(worker, scenario);
+    history.record(DurationHistory::SCENARIO, scenario, duration);
+}
+
+void WireCoordinator::abandonScenario(worker_type worker, scenario_key_type scenario) {
+    std::lock_guard<std::mutex> lock(mutex);
+    releaseLocked(worker, scenario);
+}
+
+void WireCoordinator::releaseLocked(worker_type worker, scenario_key_type scenario) {
+    const running_type::iterator began = running.find(std::make_pair(worker, scenario));
+    if (began == running.end()) {
+        throw std::logic_error("Scenario not running on this worker");
+    }
+    load[worker].expectedWork -= began->second;
+    --load[worker].scenarios;
+    running.erase(began);
+}
+
+WireCoordinator::worker_type WireCoordinator::leastLoaded() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return leastLoadedLocked();
+}
+
+WireCoordinator::worker_type WireCoordinator::leastLoadedLocked() const {
+    worker_type least = 0;
+    for (worker_type worker = 1; worker < load.size(); ++worker) {
+        if (load[worker].expectedWork < load[least].expectedWork
+            || (load[worker].expectedWork == load[least].expectedWork
+                && load[worker].scenarios < load[least].scenarios)) {
+            least = worker;
+        }
+    }
+    return least;
+}
+
+std::chrono::nanoseconds WireCoordinator::expectedDuration(scenario_key_type scenario) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return expectedDurationLocked(scenario);
+}
+
+std::chrono::nanoseconds WireCoordinator::expectedDurationLocked(scenario_key_type scenario
+) const {
+    if (const std::optional<std::chrono::nanoseconds> known =
+            history.expected(DurationHistory::SCENARIO, scenario)) {
+        return *known;
+    }
+    return history.average(DurationHistory::SCENARIO).value_or(DEFAULT_DURATION);
+}
+
+WireCoordinator::scenario_key_type WireCoordinator::scenarioKey(
+    const std::vector<std::string>& tags, const std::vector<std::string>& stepNames
+) {
+    std::uint64_t hash = hashStrings(FNV_OFFSET_BASIS, tags);
+    hash = (hash ^ 0xfeu) * FNV_PRIME;
+    return hashStrings(hash, stepNames);
+}
+
+CoordinatingProtocolHandler::CoordinatingProtocolHandler(
+    WireCoordinator& coordinator, connector_type connect
+) :
+    coordinator(coordinator),
+    connect(std::move(connect)),
+    inScenario(false),
+    scenarioWorker(0),
+    scenario(0) {
+}
+
+CoordinatingProtocolHandler::~CoordinatingProtocolHandler() {
+    if (inScenario) {
+        coordinator.abandonScenario(scenarioWorker, scenario);
+    }
+}
+
+std::string CoordinatingProtocolHandler::handle(const std::string& request) const {
+    try {
+        return forward(request);
+    } catch (const std::exception& e) {
+        return encodeFailure(e.what());
+    }
+}
+
+std::string CoordinatingProtocolHandler::forward(const std::string& request) const {
+    const json message = json::parse(request, nullptr, false);
+    std::string command;
+    if (message.is_array() && !message.empty() && message[0].is_string()) {
+        command = message[0].get<std::string>();
+    }
+    const json* const arguments =
+        message.is_array() && message.size() > 1 && message[1].is_object() ? &message[1]
+                                                                          : nullptr;
+
+    if (command == "negotiate_codec") {
+        // Requests are read as JSON to follow scenarios
+        std::string codecName;
+        if (arguments && arguments->contains("codec") && (*arguments)["codec"].is_string()) {
+            codecName = (*arguments)["codec"].get<std::string>();
+        }
+        if (codecName != "json") {
+            return encodeFailure("Unsupported codec: " + codecName);
+        }
+    }
+
+    // A run_scenario request carries a whole scenario
+    const bool scenarioStarts = command == "begin_scenario" || command == "run_scenario";
+    const bool scenarioEnds = command == "end_scenario" || command == "run_scenario";
+    if (scenarioStarts && !inScenario) {
+        std::vector<std::string> tags;
+        if (arguments && arguments->contains("tags") && (*arguments)["tags"].is_array()) {
+            for (const json& tag : (*arguments)["tags"]) {
+                if (tag.is_string()) {
+                    tags.push_back(tag.get<std::string>());
+                }
+            }
+        }
+        scenario = WireCoordinator::scenarioKey(tags, matchedNames);
+        matchedNames.clear();
+        scenarioWorker = coordinator.beginScenario(scenario);
+        inScenario = true;
+        scenarioStart = std::chrono::steady_clock::now();
+    }
+    if (!inScenario) {
+        if (command == "step_matches" && arguments && arguments->contains("name_to_match")
+            && (*arguments)["name_to_match"].is_string()) {
+            matchedNames.push_back((*arguments)["name_to_match"].get<std::string>());
+        }
+        return forwardTo(coordinator.leastLoaded(), request);
+    }
+
+    std::string response;
+    try {
+        response = forwardTo(scenarioWorker, request);
+    } catch (...) {
+        // The rest of the scenario could only fail too
+        inScenario = false;
+        coordinator.abandonScenario(scenarioWorker, scenario);
+        throw;
+    }
+    if (scenarioEnds) {
+        inScenario = false;
+        coordinator.endScenario(
+            scenarioWorker, scenario, std::chrono::steady_clock::now() - scenarioStart
+        );
+    }
+    return response;
+}
+
+std::string CoordinatingProtocolHandler::forwardTo(
+    WireCoordinator::worker_type worker, const std::string& request
+) const {
+    std::unique_ptr<WireWorkerConnection>& connection = connections[worker];
+    if (!connection) {
+        connection = connect(coordinator.workers()[worker]);
+    }
+    try {
+        return connection->request(request);
+    } catch (...) {
+        // Reconnects on the next request
+        connection.reset();
+        throw;
+    }
+}
+
+}
+}
@@ -1,11 +1,20 @@
 #include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
 #include <cucumber-cpp/internal/connectors/wire/WireProtocolCommands.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+#include <cucumber-cpp/internal/step/StepManager.hpp>
+#include <cucumber-cpp/internal/utils/JsonString.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <memory_resource>
 #include <string>
 #include <sstream>
+#include <stdexcept>
 
 using json = nlohmann::json;
 
@@ -61,6 +70,32 @@ void StepMatchesResponse::accept(WireResponseVisitor& visitor) const {
     visitor.visit(*this);
 }
 
+StepMatchesBatchResponse::StepMatchesBatchResponse(
+    const std::vector<std::vector<StepMatch>>& matchingSteps
+) :
+    matchingSteps(matchingSteps) {
+}
+
+const std::vector<std::vector<StepMatch>>& StepMatchesBatchResponse::getMatchingSteps() const {
+    return matchingSteps;
+}
+
+void StepMatchesBatchResponse::accept(WireResponseVisitor& visitor) const {
+    visitor.visit(*this);
+}
+
+RunScenarioResponse::RunScenarioResponse(const step_results_type& stepResults) :
+    stepResults(stepResults) {
+}
+
+const RunScenarioResponse::step_results_type& RunScenarioResponse::getStepResults() const {
+    return stepResults;
+}
+
+void RunScenarioResponse::accept(WireResponseVisitor& visitor) const {
+    visitor.visit(*this);
+}
+
 SnippetTextResponse::SnippetTextResponse(const std::string& stepSnippet) :
     stepSnippet(stepSnippet) {
 }
@@ -73,6 +108,18 @@ void SnippetTextResponse::accept(WireResponseVisitor& visitor) const {
     visitor.visit(*this);
 }
 
+StatsResponse::StatsResponse(const WireStats& stats) :
+    stats(stats) {
+}
+
+const WireStats& StatsResponse::getStats() const {
+    return stats;
+}
+
+void StatsResponse::accept(WireResponseVisitor& visitor) const {
+    visitor.visit(*this);
+}
+
 /*
  * Command decoders
  */
@@ -91,17 +138,46 @@ CukeEngine::tags_type getScenarioTags(const json& jsonArgs) {
     return tags;
 }
 
+std::string getTraceParent(const json& jsonArgs) {
+    return jsonArgs.is_object() ? jsonArgs.value("traceparent", std::string()) : std::string();
+}
+
 std::shared_ptr<WireCommand> BeginScenarioDecoder(const json& jsonArgs) {
-    return std::make_shared<BeginScenarioCommand>(getScenarioTags(jsonArgs));
+    return WireRequestScratch::make<BeginScenarioCommand>(
+        getScenarioTags(jsonArgs), getTraceParent(jsonArgs)
+    );
 }
 
 std::shared_ptr<WireCommand> EndScenarioDecoder(const json& jsonArgs) {
-    return std::make_shared<EndScenarioCommand>(getScenarioTags(jsonArgs));
+    return WireRequestScratch::make<EndScenarioCommand>(getScenarioTags(jsonArgs));
+}
+
+std::shared_ptr<WireCommand> BeginFeatureDecoder(const json& jsonArgs) {
+    const std::string& name = jsonArgs.at("name");
+    return WireRequestScratch::make<BeginFeatureCommand>(name);
 }
 
 std::shared_ptr<WireCommand> StepMatchesDecoder(const json& jsonArgs) {
     const std::string& nameToMatch = jsonArgs.at("name_to_match");
-    return std::make_shared<StepMatchesCommand>(nameToMatch);
+    return WireRequestScratch::make<StepMatchesCommand>(nameToMatch);
+}
+
+std::shared_ptr<WireCommand> LoadLibraryDecoder(const json& jsonArgs) {
+    const std::string& path = jsonArgs.at("path");
+    return WireRequestScratch::make<LoadLibraryCommand>(path);
+}
+
+std::shared_ptr<WireCommand> NegotiateCodecDecoder(const json& jsonArgs) {
+    const std::string& codecName = jsonArgs.at("codec");
+    return WireRequestScratch::make<NegotiateCodecCommand>(codecName);
+}
+
+std::shared_ptr<WireCommand> StepMatchesBatchDecoder(const json& jsonArgs) {
+    std::vector<std::string> namesToMatch;
+    for (const auto& name : jsonArgs.at("names")) {
+        namesToMatch.push_back(name.get<std::string>());
+    }
+    return WireRequestScratch::make<StepMatchesBatchCommand>(namesToMatch);
 }
 
 void fillTableArg(const json& jsonTableArg, CukeEngine::invoke_table_type& tableArg) {
@@ -144,9 +220,198 @@ std::shared_ptr<WireCommand> InvokeDecoder(const json& jsonArgs) {
 
     CukeEngine::invoke_args_type args;
     CukeEngine::invoke_table_type tableArg;
-    const std::string& id = invokeParams.at("id");
+    std::string id = invokeParams.at("id");
     fillInvokeArgs(invokeParams, args, tableArg);
-    return std::make_shared<InvokeCommand>(id, args, tableArg);
+    return WireRequestScratch::make<InvokeCommand>(
+        std::move(id), std::move(args), std::move(tableArg)
+    );
+}
+
+/**
+ * Decodes invoke messages straight from the parser events, moving the
+ * strings into the step arguments without building a DOM first.
+ *
+ * It gives up on any other message and on anything unusual in an invoke
+ * message, leaving those to the DOM decoders.
+ */
+class InvokeSaxDecoder : public nlohmann::json_sax<json> {
+public:
+    std::shared_ptr<WireCommand> command() {
+        return WireRequestScratch::make<InvokeCommand>(
+            std::move(id), std::move(args), std::move(tableArg)
+        );
+    }
+
+    bool null() override {
+        return state == IN_ARGS;
+    }
+
+    bool boolean(bool /*val*/) override {
+        return state == IN_ARGS;
+    }
+
+    bool number_integer(number_integer_t /*val*/) override {
+        return state == IN_ARGS;
+    }
+
+    bool number_unsigned(number_unsigned_t /*val*/) override {
+        return state == IN_ARGS;
+    }
+
+    bool number_float(number_float_t /*val*/, const string_t& /*s*/) override {
+        return state == IN_ARGS;
+    }
+
+    bool string(string_t& val) override {
+        switch (state) {
+        case EXPECT_COMMAND:
+            state = EXPECT_PARAMS;
+            return val == "invoke";
+        case EXPECT_ID:
+            id = std::move(val);
+            state = IN_PARAMS;
+            return true;
+        case IN_ARGS:
+            args.push_back(std::move(val));
+            return true;
+        case IN_ROW:
+            tableArg.back().push_back(std::move(val));
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool binary(binary_t& /*val*/) override {
+        return false;
+    }
+
+    bool start_object(std::size_t /*elements*/) override {
+        if (state != EXPECT_PARAMS) {
+            return false;
+        }
+        state = IN_PARAMS;
+        return true;
+    }
+
+    bool key(string_t& val) override {
+        if (state != IN_PARAMS) {
+            return false;
+        }
+        if (val == "id" && !hasId) {
+            hasId = true;
+            state = EXPECT_ID;
+            return true;
+        }
+        if (val == "args" && !hasArgs) {
+            hasArgs = true;
+            state = EXPECT_ARGS;
+            return true;
+        }
+        return false;
+    }
+
+    bool end_object() override {
+        if (state != IN_PARAMS || !hasId || !hasArgs) {
+            return false;
+        }
+        state = AFTER_PARAMS;
+        return true;
+    }
+
+    bool start_array(std::size_t /*elements*/) override {
+        switch (state) {
+        case BEFORE_COMMAND:
+            state = EXPECT_COMMAND;
+            return true;
+        case EXPECT_ARGS:
+            state = IN_ARGS;
+            return true;
+        case IN_ARGS:
+            state = IN_TABLE;
+            return !hasTable;
+        case IN_TABLE:
+            tableArg.emplace_back();
+            state = IN_ROW;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool end_array() override {
+        switch (state) {
+        case IN_ROW:
+            // Like fillTableArg, rows not as wide as the first one are left empty
+            if (tableArg.back().size() != tableArg.front().size()) {
+                tableArg.back().clear();
+            }
+            state = IN_TABLE;
+            return true;
+        case IN_TABLE:
+            hasTable = true;
+            state = IN_ARGS;
+            return true;
+        case IN_ARGS:
+            state = IN_PARAMS;
+            return true;
+        case AFTER_PARAMS:
+            state = DONE;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool parse_error(
+        std::size_t /*position*/, const std::string& /*lastToken*/, const json::exception& /*ex*/
+    ) override {
+        return false;
+    }
+
+private:
+    enum State {
+        BEFORE_COMMAND,
+        EXPECT_COMMAND,
+        EXPECT_PARAMS,
+        IN_PARAMS,
+        EXPECT_ID,
+        EXPECT_ARGS,
+        IN_ARGS,
+        IN_TABLE,
+        IN_ROW,
+        AFTER_PARAMS,
+        DONE
+    };
+
+    State state = BEFORE_COMMAND;
+    bool hasId = false;
+    bool hasArgs = false;
+    bool hasTable = false;
+    std::string id;
+    CukeEngine::invoke_args_type args;
+    CukeEngine::invoke_table_type tableArg;
+};
+
+std::shared_ptr<WireCommand> RunScenarioDecoder(const json& jsonArgs) {
+    RunScenarioCommand::steps_type steps;
+    for (const auto& jsonStep : jsonArgs.at("steps")) {
+        RunScenarioCommand::Step step;
+        step.id = jsonStep.at("id").get<std::string>();
+        fillInvokeArgs(jsonStep, step.args, step.tableArg);
+        steps.push_back(std::move(step));
+    }
+    CukeEngine::tags_type tags;
+    if (jsonArgs.contains("tags")) {
+        tags = getScenarioTags(jsonArgs);
+    }
+    return WireRequestScratch::make<RunScenarioCommand>(
+        tags, std::move(steps), getTraceParent(jsonArgs)
+    );
+}
+
+std::shared_ptr<WireCommand> StatsDecoder(const json& /*jsonArgs*/) {
+    return WireRequestScratch::make<StatsCommand>();
 }
 
 std::shared_ptr<WireCommand> SnippetTextDecoder(const json& jsonArgs) {
@@ -154,94 +419,289 @@ std::shared_ptr<WireCommand> SnippetTextDecoder(const json& jsonArgs) {
     const std::string& stepKeyword = snippetTextArgs.at("step_keyword");
     const std::string& stepName = snippetTextArgs.at("step_name");
     const std::string& multilineArgClass = snippetTextArgs.at("multiline_arg_class");
-    return std::make_shared<SnippetTextCommand>(stepKeyword, stepName, multilineArgClass);
+    return WireRequestScratch::make<SnippetTextCommand>(stepKeyword, stepName, multilineArgClass);
 }
 }
 
 static const std::map<std::string, CommandDecoder> commandDecodersMap = {
+    {"begin_feature", BeginFeatureDecoder},
     {"begin_scenario", BeginScenarioDecoder},
     {"end_scenario", EndScenarioDecoder},
     {"step_matches", StepMatchesDecoder},
+    {"step_matches_batch", StepMatchesBatchDecoder},
     {"invoke", InvokeDecoder},
+    {"run_scenario", RunScenarioDecoder},
     {"snippet_text", SnippetTextDecoder},
+    {"negotiate_codec", NegotiateCodecDecoder},
+    {"load_library", LoadLibraryDecoder},
+    {"stats", StatsDecoder},
 };
 
+namespace {
+std::shared_ptr<WireCommand> decodeCommand(const json& jsonRequest) {
+    const auto& jsonCommand = jsonRequest.at(0);
+
+    const auto& commandDecoder = commandDecodersMap.find(jsonCommand.get<std::string>());
+    if (commandDecoder != commandDecodersMap.end() && commandDecoder->second) {
+        json jsonArgs;
+        if (jsonRequest.size() > 1) {
+            jsonArgs = jsonRequest.at(1);
+        }
+        return commandDecoder->second(jsonArgs);
+    }
+    return WireRequestScratch::make<FailingCommand>();
+}
+}
+
 std::shared_ptr<WireCommand> JsonWireMessageCodec::decode(const std::string& request) const {
     try {
-        json jsonRequest = json::parse(request);
-        const auto& jsonCommand = jsonRequest.at(0);
-
-        const auto& commandDecoder = commandDecodersMap.find(jsonCommand.get<std::string>());
-        if (commandDecoder != commandDecodersMap.end() && commandDecoder->second) {
-            json jsonArgs;
-            if (jsonRequest.size() > 1) {
-                jsonArgs = jsonRequest.at(1);
-            }
-            return commandDecoder->second(jsonArgs);
+        InvokeSaxDecoder invokeDecoder;
+        if (json::sax_parse(request, &invokeDecoder)) {
+            return invokeDecoder.command();
+        }
+
+        return decodeCommand(json::parse(request));
+    } catch (...) {
+        // LOG Error decoding wire protocol command
+    }
+    return WireRequestScratch::make<FailingCommand>();
+}
+
+std::shared_ptr<WireCommand> MessagePackWireMessageCodec::decode(const std::string& request
+) const {
+    try {
+        InvokeSaxDecoder invokeDecoder;
+        if (json::sax_parse(request, &invokeDecoder, json::input_format_t::msgpack)) {
+            return invokeDecoder.command();
         }
+
+        return decodeCommand(json::from_msgpack(request));
     } catch (...) {
         // LOG Error decoding wire protocol command
     }
-    return std::make_shared<FailingCommand>();
+    return WireRequestScratch::make<FailingCommand>();
 }
 
 namespace {
 
+/**
+ * Writes the JSON of every response straight into the output string,
+ * producing the same bytes as dumping the equivalent nlohmann::json.
+ */
 class WireResponseEncoder : public WireResponseVisitor {
 private:
-    json jsonOutput = json::array();
+    std::string output;
 
-    void success(const json* detail = nullptr) {
-        output("success", detail);
+    static const char* const SUCCESS;
+    static const char* const FAIL;
+    static const char* const SKIPPED;
+
+    void string(const std::string& s) {
+        try {
+            appendJsonString(output, s);
+        } catch (const std::invalid_argument&) {
+            throw WireMessageCodecException("Invalid UTF-8 in wire protocol response");
+        }
     }
 
-    void fail(const json* detail = nullptr) {
-        output("fail", detail);
+    void number(std::int64_t value) {
+        char digits[24];
+        const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        output.append(digits, result.ptr);
     }
 
-    void output(const std::string& responseType, const json* detail = nullptr) {
-        jsonOutput.push_back(responseType);
-        if (detail == nullptr || detail->is_null()) {
-            return;
+    void number(std::uint64_t value) {
+        char digits[24];
+        const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        output.append(digits, result.ptr);
+    }
+
+    void latency(const WireStats::Latency& latency) {
+        output += "{\"count\":";
+        number(latency.count);
+        output += ",\"max_ns\":";
+        number(latency.maxNanoseconds);
+        output += ",\"p50_ns\":";
+        number(latency.p50Nanoseconds);
+        output += ",\"p99_ns\":";
+        number(latency.p99Nanoseconds);
+        output += ",\"total_ns\":";
+        number(latency.totalNanoseconds);
+        output += '}';
+    }
+
+    void stepMatches(const std::vector<StepMatch>& matchingSteps) {
+        // Keys in alphabetical order, like nlohmann::json objects dump them
+        output += '[';
+        for (std::vector<StepMatch>::size_type i = 0; i < matchingSteps.size(); ++i) {
+            const StepMatch& m = matchingSteps[i];
+            if (i > 0) {
+                output += ',';
+            }
+            output += "{\"args\":[";
+            for (std::vector<StepMatchArg>::size_type j = 0; j < m.args.size(); ++j) {
+                if (j > 0) {
+                    output += ',';
+                }
+                output += "{\"pos\":";
+                number(static_cast<std::int64_t>(m.args[j].position));
+                output += ",\"val\":";
+                string(m.args[j].value);
+                output += '}';
+            }
+            output += "],\"id\":";
+            string(m.id);
+            if (!m.regexp.empty()) {
+                output += ",\"regexp\":";
+                string(m.regexp);
+            }
+            if (!m.source.empty()) {
+                output += ",\"source\":";
+                string(m.source);
+            }
+            output += '}';
         }
-        jsonOutput.push_back(*detail);
+        output += ']';
     }
 
 public:
     std::string encode(const WireResponse& response) {
-        jsonOutput.clear();
+        output.clear();
         response.accept(*this);
-        return jsonOutput.dump();
+        return std::move(output);
     }
 
     void visit(const SuccessResponse& /*response*/) override {
-        success();
+        output += SUCCESS;
     }
 
     void visit(const FailureResponse& response) override {
-        json detailObject;
-        if (!response.getMessage().empty()) {
-            detailObject["message"] = response.getMessage();
+        if (response.getMessage().empty() && response.getExceptionType().empty()) {
+            output += FAIL;
+            return;
         }
+        output += "[\"fail\",{";
         if (!response.getExceptionType().empty()) {
-            detailObject["exception"] = response.getExceptionType();
+            output += "\"exception\":";
+            string(response.getExceptionType());
         }
-        if (detailObject.empty()) {
-            fail();
-        } else {
-            const json detail(detailObject);
-            fail(&detail);
+        if (!response.getMessage().empty()) {
+            if (!response.getExceptionType().empty()) {
+                output += ',';
+            }
+            output += "\"message\":";
+            string(response.getMessage());
         }
+        output += "}]";
     }
 
     void visit(const PendingResponse& response) override {
-        json jsonReponse(response.getMessage());
-        output("pending", &jsonReponse);
+        output += "[\"pending\",";
+        string(response.getMessage());
+        output += ']';
     }
 
     void visit(const StepMatchesResponse& response) override {
+        output += "[\"success\",";
+        stepMatches(response.getMatchingSteps());
+        output += ']';
+    }
+
+    void visit(const StepMatchesBatchResponse& response) override {
+        output += "[\"success\",[";
+        const std::vector<std::vector<StepMatch>>& batch = response.getMatchingSteps();
+        for (std::vector<std::vector<StepMatch>>::size_type i = 0; i < batch.size(); ++i) {
+            if (i > 0) {
+                output += ',';
+            }
+            stepMatches(batch[i]);
+        }
+        output += "]]";
+    }
+
+    void visit(const RunScenarioResponse& response) override {
+        output += "[\"success\",[";
+        const RunScenarioResponse::step_results_type& stepResults = response.getStepResults();
+        for (RunScenarioResponse::step_results_type::size_type i = 0; i < stepResults.size();
+             ++i) {
+            if (i > 0) {
+                output += ',';
+            }
+            if (stepResults[i]) {
+                stepResults[i]->accept(*this);
+            } else {
+                output += SKIPPED;
+            }
+        }
+        output += "]]";
+    }
+
+    void visit(const SnippetTextResponse& response) override {
+        output += "[\"success\",";
+        string(response.getStepSnippet());
+        output += ']';
+    }
+
+    void visit(const StatsResponse& response) override {
+        const WireStats& stats = response.getStats();
+        output += "[\"success\",{\"bytes_decoded\":";
+        number(stats.bytesDecoded);
+        output += ",\"bytes_encoded\":";
+        number(stats.bytesEncoded);
+        output += ",\"contexts\":";
+        number(stats.contexts);
+        output += ",\"hooks\":";
+        latency(stats.hooks);
+        output += ",\"invoke\":{";
+        for (WireStats::invocations_type::const_iterator invocation = stats.invocations.begin();
+             invocation != stats.invocations.end();
+             ++invocation) {
+            if (invocation != stats.invocations.begin()) {
+                output += ',';
+            }
+            string(invocation->first);
+            output += ':';
+            latency(invocation->second);
+        }
+        output += "},\"requests\":";
+        latency(stats.requests);
+        output += ",\"step_matches\":{\"cache_hits\":";
+        number(stats.stepMatchesCacheHits);
+        output += ",\"count\":";
+        number(stats.stepMatches);
+        output += "},\"timings\":";
+        output += stats.timed ? "\"enabled\"" : "\"disabled\"";
+        output += "}]";
+    }
+};
+
+const char* const WireResponseEncoder::SUCCESS = "[\"success\"]";
+const char* const WireResponseEncoder::FAIL = "[\"fail\"]";
+const char* const WireResponseEncoder::SKIPPED = "[\"skipped\"]";
+
+}
+
+namespace {
+
+/**
+ * Builds the JSON value of a response, for the codecs serializing it to
+ * something else than JSON text.
+ */
+class WireResponseJsonBuilder : public WireResponseVisitor {
+private:
+    json jsonOutput = json::array();
+
+    void output(const std::string& responseType, const json* detail = nullptr) {
+        jsonOutput.push_back(responseType);
+        if (detail == nullptr || detail->is_null()) {
+            return;
+        }
+        jsonOutput.push_back(*detail);
+    }
+
+    static json stepMatches(const std::vector<StepMatch>& matchingSteps) {
         json jsonMatches = json::array();
-        for (const StepMatch& m : response.getMatchingSteps()) {
+        for (const StepMatch& m : matchingSteps) {
             json jsonM;
             jsonM["id"] = m.id;
             json jsonArgs = json::array();
@@ -260,16 +720,108 @@ public:
             }
             jsonMatches.push_back(jsonM);
         }
-        json jsonReponse(jsonMatches);
+        return jsonMatches;
+    }
+
+    static json latency(const WireStats::Latency& latency) {
+        json jsonLatency;
+        jsonLatency["count"] = latency.count;
+        jsonLatency["total_ns"] = latency.totalNanoseconds;
+        jsonLatency["p50_ns"] = latency.p50Nanoseconds;
+        jsonLatency["p99_ns"] = latency.p99Nanoseconds;
+        jsonLatency["max_ns"] = latency.maxNanoseconds;
+        return jsonLatency;
+    }
+
+public:
+    json build(const WireResponse& response) {
+        jsonOutput.clear();
+        response.accept(*this);
+        return std::move(jsonOutput);
+    }
+
+    void visit(const SuccessResponse& /*response*/) override {
+        output("success");
+    }
+
+    void visit(const FailureResponse& response) override {
+        json detailObject;
+        if (!response.getMessage().empty()) {
+            detailObject["message"] = response.getMessage();
+        }
+        if (!response.getExceptionType().empty()) {
+            detailObject["exception"] = response.getExceptionType();
+        }
+        output("fail", &detailObject);
+    }
+
+    void visit(const PendingResponse& response) override {
+        json jsonReponse(response.getMessage());
+        output("pending", &jsonReponse);
+    }
+
+    void visit(const StepMatchesResponse& response) override {
+        json jsonReponse(stepMatches(response.getMatchingSteps()));
+        output("success", &jsonReponse);
+    }
+
+    void visit(const StepMatchesBatchResponse& response) override {
+        json jsonReponse = json::array();
+        for (const std::vector<StepMatch>& matchingSteps : response.getMatchingSteps()) {
+            jsonReponse.push_back(stepMatches(matchingSteps));
+        }
+        output("success", &jsonReponse);
+    }
+
+    void visit(const RunScenarioResponse& response) override {
+        json jsonReponse = json::array();
+        for (const std::shared_ptr<const WireResponse>& stepResult : response.getStepResults()) {
+            if (stepResult) {
+                jsonReponse.push_back(WireResponseJsonBuilder().build(*stepResult));
+            } else {
+                jsonReponse.push_back(json::array({"skipped"}));
+            }
+        }
         output("success", &jsonReponse);
     }
 
     void visit(const SnippetTextResponse& response) override {
         json jsonReponse(response.getStepSnippet());
-        success(&jsonReponse);
+        output("success", &jsonReponse);
+    }
+
+    void visit(const StatsResponse& response) override {
+        const WireStats& stats = response.getStats();
+        json jsonReponse;
+        jsonReponse["step_matches"] = {
+            {"count", stats.stepMatches}, {"cache_hits", stats.stepMatchesCacheHits}
+        };
+        jsonReponse["invoke"] = json::object();
+        for (const WireStats::invocations_type::value_type& invocation : stats.invocations) {
+            jsonReponse["invoke"][invocation.first] = latency(invocation.second);
+        }
+        jsonReponse["hooks"] = latency(stats.hooks);
+        jsonReponse["requests"] = latency(stats.requests);
+        jsonReponse["bytes_decoded"] = stats.bytesDecoded;
+        jsonReponse["bytes_encoded"] = stats.bytesEncoded;
+        jsonReponse["contexts"] = stats.contexts;
+        jsonReponse["timings"] = stats.timed ? "enabled" : "disabled";
+        output("success", &jsonReponse);
     }
 };
 
+const MessagePackWireMessageCodec& messagePackCodec() {
+    static const MessagePackWireMessageCodec codec;
+    return codec;
+}
+
+#if defined(CUKE_ENABLE_ZSTD)
+const CompressingWireMessageCodec& compressedMessagePackCodec() {
+    static const CompressingWireMessageCodec codec(messagePackCodec());
+    return codec;
+}
+#endif
+
 }
 
 const std::string JsonWireMessageCodec::encode(const WireResponse& response) const {
@@ -281,24 +833,228 @@ const std::string JsonWireMessageCodec::encode(const WireResponse& response) con
     }
 }
 
+const std::string MessagePackWireMessageCodec::encode(const WireResponse& response) const {
+    try {
+        WireResponseJsonBuilder builder;
+        std::string encoded;
+        json::to_msgpack(builder.build(response), encoded);
+        return encoded;
+    } catch (...) {
+        throw WireMessageCodecException("Error decoding wire protocol response");
+    }
+}
+
+namespace {
+/**
+ * Buffer of the request scratch of a thread, the heap taking over once
+ * a request outgrows it
+ */
+struct RequestScratchBuffer {
+    static const std::size_t SIZE = 16 * 1024;
+
+    alignas(std::max_align_t) unsigned char buffer[SIZE];
+    std::pmr::monotonic_buffer_resource resource{buffer, SIZE};
+    unsigned int depth = 0;
+};
+
+thread_local RequestScratchBuffer requestScratch;
+}
+
+WireRequestScratch::WireRequestScratch() {
+    ++requestScratch.depth;
+}
+
+WireRequestScratch::~WireRequestScratch() {
+    // Objects of outer requests, when handling nested ones, stay alive
+    if (--requestScratch.depth == 0) {
+        requestScratch.resource.release();
+    }
+}
+
+std::pmr::memory_resource* WireRequestScratch::resource() {
+    if (requestScratch.depth == 0) {
+        return std::pmr::new_delete_resource();
+    }
+    return &requestScratch.resource;
+}
+
+namespace {
+std::atomic<std::uint64_t> decodedBytes(0);
+std::atomic<std::uint64_t> encodedBytes(0);
+
+class DecodedWireRequest : public PreparedRequest {
+public:
+    DecodedWireRequest(const WireMessageCodec* codec, std::shared_ptr<const WireCommand> command) :
+        codec(codec),
+        command(std::move(command)) {
+    }
+
+    /** Codec the command was decoded with */
+    const WireMessageCodec* const codec;
+    const std::shared_ptr<const WireCommand> command;
+};
+
+class CachedWireResponse : public PreparedRequest {
+public:
+    CachedWireResponse(std::string response, std::uint64_t generation) :
+        response(std::move(response)),
+        generation(generation) {
+    }
+
+    const std::string response;
+    /** Match generation the response was cached under */
+    const std::uint64_t generation;
+};
+}
+
 WireProtocolHandler::WireProtocolHandler(const WireMessageCodec& codec, CukeEngine& engine) :
     codec(codec),
-    engine(engine) {
+    engine(engine),
+    activeCodec(&codec),
+    stepMatchesGeneration(StepManager::matchGeneration()) {
 }
 
 std::string WireProtocolHandler::handle(const std::string& request) const {
+    return handlePrepared(request, nullptr);
+}
+
+std::shared_ptr<const PreparedRequest> WireProtocolHandler::prepare(const std::string& request
+) const {
+    // Only negotiations change the codec, and nothing is prepared after them
+    const WireMessageCodec* const codec = activeCodec;
+    const std::uint64_t generation = StepManager::matchGeneration();
     std::string response;
+    if (findStepMatches(request, &response)) {
+        return std::make_shared<CachedWireResponse>(std::move(response), generation);
+    }
+    std::shared_ptr<const WireCommand> command;
+    try {
+        command = codec->decode(request);
+    } catch (...) {
+        return nullptr;
+    }
+    if (dynamic_cast<const NegotiateCodecCommand*>(command.get())) {
+        return nullptr;
+    }
+    return std::make_shared<DecodedWireRequest>(codec, std::move(command));
+}
+
+std::string WireProtocolHandler::handlePrepared(
+    const std::string& request, const PreparedRequest* prepared
+) const {
+    const ScopedTiming timing(TIMED_WIRE_REQUESTS);
+    const WireRequestScratch scratch;
+    decodedBytes.fetch_add(request.size(), std::memory_order_relaxed);
     // LOG request
+    const CachedWireResponse* const cached = dynamic_cast<const CachedWireResponse*>(prepared);
+    std::string response;
+    if (cached && cached->generation == StepManager::matchGeneration()) {
+        response = cached->response;
+    } else if (!findStepMatches(request, &response)) {
+        response = respond(request, prepared);
+    }
+    // LOG response
+    encodedBytes.fetch_add(response.size(), std::memory_order_relaxed);
+    return response;
+}
+
+bool WireProtocolHandler::findStepMatches(const std::string& request, std::string* response)
+    const {
+    std::lock_guard<std::mutex> lock(stepMatchesMutex);
+    const std::uint64_t generation = StepManager::matchGeneration();
+    if (generation != stepMatchesGeneration) {
+        stepMatchesResponses.clear();
+        stepMatchesGeneration = generation;
+    }
+    const response_cache_type::const_iterator cached = stepMatchesResponses.find(request);
+    if (cached == stepMatchesResponses.end()) {
+        return false;
+    }
+    if (response) {
+        *response = cached->second;
+    }
+    return true;
+}
+
+std::string WireProtocolHandler::respond(
+    const std::string& request, const PreparedRequest* prepared
+) const {
     try {
-        std::shared_ptr<const WireCommand> command = codec.decode(request);
+        const DecodedWireRequest* const decoded = dynamic_cast<const DecodedWireRequest*>(prepared);
+        std::shared_ptr<const WireCommand> command;
+        if (decoded && decoded->codec == activeCodec) {
+            command = decoded->command;
+        } else {
+            command = activeCodec->decode(request);
+        }
+        const NegotiateCodecCommand* negotiation
+            = dynamic_cast<const NegotiateCodecCommand*>(command.get());
+        if (negotiation) {
+            return negotiateCodec(negotiation->getCodecName());
+        }
+        // Steps registered while matching make the response stale
+        const std::uint64_t generation = StepManager::matchGeneration();
         std::shared_ptr<const WireResponse> wireResponse = command->run(engine);
-        response = codec.encode(*wireResponse);
+        std::string response = activeCodec->encode(*wireResponse);
+        if (dynamic_cast<const StepMatchesCommand*>(command.get())) {
+            std::lock_guard<std::mutex> lock(stepMatchesMutex);
+            if (generation != stepMatchesGeneration
+                || generation != StepManager::matchGeneration()) {
+                return response;
+            }
+            if (stepMatchesResponses.size() >= STEP_MATCHES_CACHE_CAPACITY) {
+                stepMatchesResponses.clear();
+            }
+            stepMatchesResponses.emplace(request, response);
+        }
+        return response;
     } catch (...) {
-        response = "[\"fail\"]";
+        return encodeFailure();
     }
-    // LOG response
+}
+
+bool WireProtocolHandler::usesBinaryFrames() const {
+    return activeCodec != &codec;
+}
+
+std::uint64_t WireProtocolHandler::bytesDecoded() {
+    return decodedBytes.load(std::memory_order_relaxed);
+}
+
+std::uint64_t WireProtocolHandler::bytesEncoded() {
+    return encodedBytes.load(std::memory_order_relaxed);
+}
+
+std::string WireProtocolHandler::negotiateCodec(const std::string& codecName) const {
+    // Framing cannot switch back to lines, so binary connections stay binary
+    const WireMessageCodec* requested = nullptr;
+    if (codecName == "msgpack") {
+        requested = &messagePackCodec();
+#if defined(CUKE_ENABLE_ZSTD)
+    } else if (codecName == "msgpack+zstd") {
+        requested = &compressedMessagePackCodec();
+#endif
+    } else if (codecName == "json" && !usesBinaryFrames()) {
+        requested = &codec;
+    }
+    if (!requested) {
+        return activeCodec->encode(FailureResponse("Unsupported codec: " + codecName));
+    }
+    // The success is still encoded with the codec the request came in
+    const std::string response = activeCodec->encode(SuccessResponse());
+    activeCodec = requested;
+    std::lock_guard<std::mutex> lock(stepMatchesMutex);
+    stepMatchesResponses.clear();
     return response;
 }
 
+std::string WireProtocolHandler::encodeFailure() const {
+    try {
+        return activeCodec->encode(FailureResponse());
+    } catch (...) {
+        return "[\"fail\"]";
+    }
+}
+
 } // namespace internal
 } // namespace cucumber
@@ -1,19 +1,38 @@
 #include <cucumber-cpp/internal/connectors/wire/WireProtocolCommands.hpp>
+#include <cucumber-cpp/internal/ContextManager.hpp>
+#include <cucumber-cpp/internal/CukeCommands.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+#include <cucumber-cpp/internal/step/StepLibrary.hpp>
+
+#include <string>
+#include <variant>
 
 namespace cucumber {
 namespace internal {
 
-ScenarioCommand::ScenarioCommand(const CukeEngine::tags_type& tags) :
-    tags(tags) {
+ScenarioCommand::ScenarioCommand(
+    const CukeEngine::tags_type& tags, const std::string& traceParent
+) :
+    tags(tags),
+    traceParent(traceParent) {
 }
 
-BeginScenarioCommand::BeginScenarioCommand(const CukeEngine::tags_type& tags) :
-    ScenarioCommand(tags) {
+void ScenarioCommand::beginScenario(CukeEngine& engine) const {
+    if (!traceParent.empty()) {
+        engine.continueTrace(traceParent);
+    }
+    engine.beginScenario(tags);
+}
+
+BeginScenarioCommand::BeginScenarioCommand(
+    const CukeEngine::tags_type& tags, const std::string& traceParent
+) :
+    ScenarioCommand(tags, traceParent) {
 }
 
 std::shared_ptr<WireResponse> BeginScenarioCommand::run(CukeEngine& engine) const {
-    engine.beginScenario(tags);
-    return std::make_shared<SuccessResponse>();
+    beginScenario(engine);
+    return WireRequestScratch::make<SuccessResponse>();
 }
 
 EndScenarioCommand::EndScenarioCommand(const CukeEngine::tags_type& tags) :
@@ -22,7 +41,16 @@ EndScenarioCommand::EndScenarioCommand(const CukeEngine::tags_type& tags) :
 
 std::shared_ptr<WireResponse> EndScenarioCommand::run(CukeEngine& engine) const {
     engine.endScenario(tags);
-    return std::make_shared<SuccessResponse>();
+    return WireRequestScratch::make<SuccessResponse>();
+}
+
+BeginFeatureCommand::BeginFeatureCommand(const std::string& name) :
+    name(name) {
+}
+
+std::shared_ptr<WireResponse> BeginFeatureCommand::run(CukeEngine& engine) const {
+    engine.beginFeature(name);
+    return WireRequestScratch::make<SuccessResponse>();
 }
 
 StepMatchesCommand::StepMatchesCommand(const std::string& stepName) :
@@ -31,7 +59,20 @@ StepMatchesCommand::StepMatchesCommand(const std::string& stepName) :
 
 std::shared_ptr<WireResponse> StepMatchesCommand::run(CukeEngine& engine) const {
     std::vector<StepMatch> matchingSteps = engine.stepMatches(stepName);
-    return std::make_shared<StepMatchesResponse>(matchingSteps);
+    return WireRequestScratch::make<StepMatchesResponse>(matchingSteps);
+}
+
+StepMatchesBatchCommand::StepMatchesBatchCommand(const std::vector<std::string>& stepNames) :
+    stepNames(stepNames) {
+}
+
+std::shared_ptr<WireResponse> StepMatchesBatchCommand::run(CukeEngine& engine) const {
+    std::vector<std::vector<StepMatch>> matchingSteps;
+    matchingSteps.reserve(stepNames.size());
+    for (const std::string& stepName : stepNames) {
+        matchingSteps.push_back(engine.stepMatches(stepName));
+    }
+    return WireRequestScratch::make<StepMatchesBatchResponse>(matchingSteps);
 }
 
 InvokeCommand::InvokeCommand(
@@ -41,20 +82,86 @@ InvokeCommand::InvokeCommand(
 ) :
     stepId(stepId),
     args(args),
-    tableArg(tableArg) {
+    tableArg(tableArg),
+    movingArgs(false) {
 }
 
-std::shared_ptr<WireResponse> InvokeCommand::run(CukeEngine& engine) const {
+InvokeCommand::InvokeCommand(
+    std::string&& stepId,
+    CukeEngine::invoke_args_type&& args,
+    CukeEngine::invoke_table_type&& tableArg
+) :
+    stepId(std::move(stepId)),
+    args(std::move(args)),
+    tableArg(std::move(tableArg)),
+    movingArgs(true) {
+}
+
+namespace {
+std::shared_ptr<WireResponse> invokeStep(
+    CukeEngine& engine,
+    const std::string& stepId,
+    CukeEngine::invoke_args_type&& args,
+    CukeEngine::invoke_table_type&& tableArg
+) {
+    CukeEngine::invoke_result_type outcome;
     try {
-        engine.invokeStep(stepId, args, tableArg);
-        return std::make_shared<SuccessResponse>();
-    } catch (const InvokeFailureException& e) {
-        return std::make_shared<FailureResponse>(e.getMessage(), e.getExceptionType());
-    } catch (const PendingStepException& e) {
-        return std::make_shared<PendingResponse>(e.getMessage());
+        outcome = engine.tryInvokeStep(stepId, std::move(args), std::move(tableArg));
     } catch (...) {
-        return std::make_shared<FailureResponse>();
+        return WireRequestScratch::make<FailureResponse>();
     }
+    if (const InvokeFailureException* const failure =
+            std::get_if<InvokeFailureException>(&outcome)) {
+        return WireRequestScratch::make<FailureResponse>(
+            failure->getMessage(), failure->getExceptionType()
+        );
+    }
+    if (const PendingStepException* const pending = std::get_if<PendingStepException>(&outcome)) {
+        return WireRequestScratch::make<PendingResponse>(pending->getMessage());
+    }
+    if (std::holds_alternative<InvokeException>(outcome)) {
+        return WireRequestScratch::make<FailureResponse>();
+    }
+    return WireRequestScratch::make<SuccessResponse>();
+}
+}
+
+std::shared_ptr<WireResponse> InvokeCommand::run(CukeEngine& engine) const {
+    if (movingArgs) {
+        return invokeStep(engine, stepId, std::move(args), std::move(tableArg));
+    }
+    return invokeStep(
+        engine,
+        stepId,
+        CukeEngine::invoke_args_type(args),
+        CukeEngine::invoke_table_type(tableArg)
+    );
+}
+
+RunScenarioCommand::RunScenarioCommand(
+    const CukeEngine::tags_type& tags, steps_type&& steps, const std::string& traceParent
+) :
+    ScenarioCommand(tags, traceParent),
+    steps(std::move(steps)) {
+}
+
+std::shared_ptr<WireResponse> RunScenarioCommand::run(CukeEngine& engine) const {
+    RunScenarioResponse::step_results_type stepResults;
+    stepResults.reserve(steps.size());
+    beginScenario(engine);
+    bool passing = true;
+    for (Step& step : steps) {
+        if (!passing) {
+            stepResults.push_back(nullptr);
+            continue;
+        }
+        std::shared_ptr<const WireResponse> result =
+            invokeStep(engine, step.id, std::move(step.args), std::move(step.tableArg));
+        passing = dynamic_cast<const SuccessResponse*>(result.get()) != nullptr;
+        stepResults.push_back(std::move(result));
+    }
+    engine.endScenario(tags);
+    return WireRequestScratch::make<RunScenarioResponse>(stepResults);
 }
 
 SnippetTextCommand::SnippetTextCommand(
@@ -66,13 +173,80 @@ SnippetTextCommand::SnippetTextCommand(
 }
 
 std::shared_ptr<WireResponse> SnippetTextCommand::run(CukeEngine& engine) const {
-    return std::make_shared<SnippetTextResponse>(
+    return WireRequestScratch::make<SnippetTextResponse>(
         engine.snippetText(keyword, name, multilineArgClass)
     );
 }
 
+namespace {
+WireStats::Latency latencyOf(const LatencyHistogram& histogram) {
+    WireStats::Latency latency;
+    latency.count = histogram.getCount();
+    latency.totalNanoseconds = histogram.getTotal();
+    latency.p50Nanoseconds = histogram.percentile(50);
+    latency.p99Nanoseconds = histogram.percentile(99);
+    latency.maxNanoseconds = histogram.getMax();
+    return latency;
+}
+}
+
+std::shared_ptr<WireResponse> StatsCommand::run(CukeEngine& /*engine*/) const {
+    const StepManager::MatchCounters matchCounters = StepManager::matchCounters();
+    const TimingSnapshot timings = Timings::snapshot();
+    WireStats stats;
+    stats.stepMatches = matchCounters.calls;
+    stats.stepMatchesCacheHits = matchCounters.cacheHits;
+    stats.bytesDecoded = WireProtocolHandler::bytesDecoded();
+    stats.bytesEncoded = WireProtocolHandler::bytesEncoded();
+    stats.contexts = ContextArena::liveContexts();
+    stats.timed = Timings::isEnabled();
+    stats.hooks = latencyOf(timings.operations[TIMED_HOOKS]);
+    stats.requests = latencyOf(timings.operations[TIMED_WIRE_REQUESTS]);
+    for (const TimingSnapshot::steps_type::value_type& step : timings.steps) {
+        stats.invocations[std::to_string(step.first)] = latencyOf(step.second);
+    }
+    return WireRequestScratch::make<StatsResponse>(stats);
+}
+
+LoadLibraryCommand::LoadLibraryCommand(const std::string& path) :
+    path(path) {
+}
+
+std::shared_ptr<WireResponse> LoadLibraryCommand::run(CukeEngine& /*engine*/) const {
+    if (!StepLibraries::isLoadableByClients()) {
+        return WireRequestScratch::make<FailureResponse>(
+            "Cannot load " + path + ": loading libraries is not allowed"
+        );
+    }
+    if (CukeCommands::runningScenarios() != 0) {
+        return WireRequestScratch::make<FailureResponse>(
+            "Cannot load " + path + " while scenarios run"
+        );
+    }
+    try {
+        StepLibraries::load(path);
+    } catch (const std::exception& e) {
+        return WireRequestScratch::make<FailureResponse>(e.what());
+    }
+    return WireRequestScratch::make<SuccessResponse>();
+}
+
+NegotiateCodecCommand::NegotiateCodecCommand(const std::string& codecName) :
+    codecName(codecName) {
+}
+
+const std::string& NegotiateCodecCommand::getCodecName() const {
+    return codecName;
+}
+
+std::shared_ptr<WireResponse> NegotiateCodecCommand::run(CukeEngine& /*engine*/) const {
+    return WireRequestScratch::make<FailureResponse>(
+        "Codec negotiation needs a wire protocol handler"
+    );
+}
+
 std::shared_ptr<WireResponse> FailingCommand::run(CukeEngine& /*engine*/) const {
-    return std::make_shared<FailureResponse>();
+    return WireRequestScratch::make<FailureResponse>();
 }
 
 }
@@ -1,12 +1,59 @@
 #include <cucumber-cpp/internal/connectors/wire/WireServer.hpp>
+#include <cucumber-cpp/internal/utils/ThreadPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <exception>
 #include <filesystem>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <set>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
 
 namespace cucumber {
 namespace internal {
 
 SocketServer::SocketServer(const ProtocolHandler* protocolHandler) :
     protocolHandler(protocolHandler),
-    ios() {
+    ios(),
+    coalesceWrites(false),
+    pipelineRequests(false),
+    maxFrameLength(16 * 1024 * 1024),
+    errorLog(nullptr) {
+}
+
+void SocketServer::setWriteCoalescing(bool coalesce) {
+    coalesceWrites = coalesce;
+}
+
+void SocketServer::setRequestPipelining(bool pipeline) {
+    pipelineRequests = pipeline;
+}
+
+void SocketServer::setMaxFrameLength(std::size_t length) {
+    maxFrameLength = length;
+}
+
+void SocketServer::setErrorLog(std::ostream* log) {
+    errorLog = log;
+}
+
+void SocketServer::setExecutionCpus(const cpu_list_type& cpus) {
+    executionCpus.assign(cpus);
+}
+
+void SocketServer::setIoCpus(const cpu_list_type& cpus) {
+    ioCpus.assign(cpus);
 }
 
 template<typename Protocol>
@@ -18,22 +65,797 @@ void SocketServer::doListen(
     acceptor.open(endpoint.protocol());
     acceptor.set_option(typename Protocol::acceptor::reuse_address(true));
     acceptor.bind(endpoint);
-    acceptor.listen(1);
+    acceptor.listen(asio::socket_base::max_listen_connections);
+}
+
+namespace {
+const std::size_t FRAME_HEADER_SIZE = 4;
+
+std::size_t frameLength(const unsigned char* header) {
+    return (std::size_t(header[0]) << 24) | (std::size_t(header[1]) << 16)
+           | (std::size_t(header[2]) << 8) | std::size_t(header[3]);
+}
+
+std::size_t frameLength(const asio::streambuf& input) {
+    unsigned char header[FRAME_HEADER_SIZE];
+    asio::buffer_copy(asio::buffer(header), input.data());
+    return frameLength(header);
+}
+
+/**
+ * Whether a frame of that length may be read, reporting it to the log
+ * otherwise, if any
+ */
+bool isAcceptedFrameLength(std::size_t length, std::size_t maxLength, std::ostream* log) {
+    if (length <= maxLength) {
+        return true;
+    }
+    if (log) {
+        *log << "Frame of " << length << " bytes longer than the maximum of " << maxLength
+             << ", closing the connection" << std::endl;
+    }
+    return false;
+}
+
+void appendFrame(std::string& output, const std::string& message) {
+    const std::size_t length = message.size();
+    output += static_cast<char>((length >> 24) & 0xFF);
+    output += static_cast<char>((length >> 16) & 0xFF);
+    output += static_cast<char>((length >> 8) & 0xFF);
+    output += static_cast<char>(length & 0xFF);
+    output += message;
+}
+
+/**
+ * Requests of a pipelined connection read ahead of the one being handled
+ */
+const std::uint64_t MAX_REQUESTS_AHEAD = 16;
+
+/**
+ * Connection served with asynchronous line reads and response writes. It
+ * keeps itself alive through the shared pointers held by pending handlers.
+ *
+ * Given an execution thread, requests are handled there, the next ones
+ * being read and prepared meanwhile.
+ */
+template<typename Stream>
+class AsyncSession : public std::enable_shared_from_this<AsyncSession<Stream>> {
+public:
+    AsyncSession(
+        Stream stream,
+        std::shared_ptr<const ProtocolHandler> handler,
+        bool coalesceWrites,
+        std::size_t maxFrameLength,
+        std::ostream* errorLog,
+        ThreadPool* execution = nullptr
+    ) :
+        stream(std::move(stream)),
+        handler(std::move(handler)),
+        coalesceWrites(coalesceWrites),
+        maxFrameLength(maxFrameLength),
+        errorLog(errorLog),
+        execution(execution) {
+    }
+
+    void start() {
+        readRequest();
+    }
+
+private:
+    void readRequest() {
+        const auto self = this->shared_from_this();
+        asio::async_read_until(
+            stream,
+            input,
+            '\n',
+            [self](const std::error_code& error, std::size_t length) {
+                self->onRequest(error, length);
+            }
+        );
+    }
+
+    void onRequest(const std::error_code& error, std::size_t length) {
+        if (error && (error != asio::error::eof || input.size() == 0)) {
+            return;
+        }
+        // At the end of the stream a request may lack its newline, like with getline
+        const std::size_t requestLength = error ? input.size() : length - 1;
+        const auto data = asio::buffers_begin(input.data());
+        request.assign(data, data + requestLength);
+        input.consume(error ? requestLength : length);
+        if (execution) {
+            dispatch(false, static_cast<bool>(error));
+            return;
+        }
+
+        try {
+            response = handler->handle(request);
+            response += '\n';
+            while (coalesceWrites && !handler->usesBinaryFrames() && nextBufferedRequest()) {
+                response += handler->handle(request);
+                response += '\n';
+            }
+        } catch (...) {
+            fail(std::current_exception());
+            return;
+        }
+        writeResponse(static_cast<bool>(error));
+    }
+
+    /**
+     * Closes the connection of a request that could not be handled, the
+     * sessions sharing the io_context going on
+     */
+    void fail(const std::exception_ptr& error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            if (errorLog) {
+                *errorLog << e.what() << std::endl;
+            }
+        } catch (...) {
+        }
+        std::error_code ignored;
+        stream.lowest_layer().close(ignored);
+    }
+
+    void writeResponse(bool lastRequest) {
+        const auto self = this->shared_from_this();
+        asio::async_write(
+            stream,
+            asio::buffer(response),
+            [self, lastRequest](const std::error_code& error, std::size_t) {
+                if (error || lastRequest) {
+                    return;
+                }
+                if (self->handler->usesBinaryFrames()) {
+                    self->readFrameHeader();
+                } else {
+                    self->readRequest();
+                }
+            }
+        );
+    }
+
+    void readFrameHeader() {
+        readAtLeast(FRAME_HEADER_SIZE, [](AsyncSession& session) {
+            session.onFrameHeader();
+        });
+    }
+
+    void onFrameHeader() {
+        const std::size_t length = frameLength(input);
+        if (!isAcceptedFrameLength(length, maxFrameLength, errorLog)) {
+            std::error_code ignored;
+            stream.lowest_layer().close(ignored);
+            return;
+        }
+        input.consume(FRAME_HEADER_SIZE);
+        readAtLeast(length, [length](AsyncSession& session) {
+            session.onFrame(length);
+        });
+    }
+
+    void onFrame(std::size_t length) {
+        const auto data = asio::buffers_begin(input.data());
+        request.assign(data, data + length);
+        input.consume(length);
+        if (execution) {
+            dispatch(true, false);
+            return;
+        }
+
+        response.clear();
+        try {
+            appendFrame(response, handler->handle(request));
+            while (coalesceWrites && nextBufferedFrame()) {
+                appendFrame(response, handler->handle(request));
+            }
+        } catch (...) {
+            fail(std::current_exception());
+            return;
+        }
+        writeResponse(false);
+    }
+
+    template<typename Continuation>
+    void readAtLeast(std::size_t size, Continuation continuation) {
+        if (input.size() >= size) {
+            continuation(*this);
+            return;
+        }
+        const auto self = this->shared_from_this();
+        asio::async_read(
+            stream,
+            input,
+            asio::transfer_exactly(size - input.size()),
+            [self, continuation](const std::error_code& error, std::size_t) {
+                if (!error) {
+                    continuation(*self);
+                }
+            }
+        );
+    }
+
+    void readNext() {
+        if (handler->usesBinaryFrames()) {
+            readFrameHeader();
+        } else {
+            readRequest();
+        }
+    }
+
+    /**
+     * Hands the request over to the execution thread, going on reading
+     * unless the request has to be handled first
+     */
+    void dispatch(bool binary, bool lastRequest) {
+        const std::shared_ptr<const PreparedRequest> prepared = handler->prepare(request);
+        const std::uint64_t sequence = requested++;
+        const auto self = this->shared_from_this();
+        // Keeps the I/O going until the response is posted back
+        const auto work = std::make_shared<asio::executor_work_guard<executor_type>>(
+            stream.get_executor()
+        );
+        execution->submit([self, sequence, binary, request = request, prepared, work] {
+            std::string response;
+            std::exception_ptr error;
+            try {
+                response = self->handler->handlePrepared(request, prepared.get());
+            } catch (...) {
+                error = std::current_exception();
+            }
+            asio::post(
+                self->stream.get_executor(),
+                [self, sequence, binary, response = std::move(response), error]() mutable {
+                    if (error) {
+                        self->fail(error);
+                        return;
+                    }
+                    self->onHandled(sequence, binary, std::move(response));
+                }
+            );
+        });
+        if (lastRequest) {
+            return;
+        }
+        waitingForBarrier = !prepared;
+        if (waitingForBarrier || requested - handledRequests >= MAX_REQUESTS_AHEAD) {
+            readingPaused = true;
+        } else {
+            readNext();
+        }
+    }
+
+    void onHandled(std::uint64_t sequence, bool binary, std::string handledResponse) {
+        std::string& framed = handled[sequence];
+        if (binary) {
+            appendFrame(framed, handledResponse);
+        } else {
+            framed = std::move(handledResponse);
+            framed += '\n';
+        }
+        ++handledRequests;
+        writeHandled();
+        const bool allHandled = handledRequests == requested;
+        if (readingPaused
+            && (allHandled
+                || (!waitingForBarrier && requested - handledRequests < MAX_REQUESTS_AHEAD))) {
+            readingPaused = false;
+            waitingForBarrier = false;
+            readNext();
+        }
+    }
+
+    /**
+     * Writes the responses handled in sequence, unless a write is pending
+     */
+    void writeHandled() {
+        if (writing) {
+            return;
+        }
+        response.clear();
+        typename std::map<std::uint64_t, std::string>::iterator next = handled.begin();
+        while (next != handled.end() && next->first == answered
+               && (response.empty() || coalesceWrites)) {
+            response += next->second;
+            ++answered;
+            next = handled.erase(next);
+        }
+        if (response.empty()) {
+            return;
+        }
+        writing = true;
+        const auto self = this->shared_from_this();
+        asio::async_write(
+            stream,
+            asio::buffer(response),
+            [self](const std::error_code& error, std::size_t) {
+                self->writing = false;
+                if (!error) {
+                    self->writeHandled();
+                }
+            }
+        );
+    }
+
+    bool nextBufferedFrame() {
+        if (input.size() < FRAME_HEADER_SIZE) {
+            return false;
+        }
+        const std::size_t length = frameLength(input);
+        // Left to onFrameHeader() if too long
+        if (length > maxFrameLength || input.size() < FRAME_HEADER_SIZE + length) {
+            return false;
+        }
+        input.consume(FRAME_HEADER_SIZE);
+        const auto data = asio::buffers_begin(input.data());
+        request.assign(data, data + length);
+        input.consume(length);
+        return true;
+    }
+
+    bool nextBufferedRequest() {
+        const auto begin = asio::buffers_begin(input.data());
+        const auto end = asio::buffers_end(input.data());
+        const auto newline = std::find(begin, end, '\n');
+        if (newline == end) {
+            return false;
+        }
+        request.assign(begin, newline);
+        input.consume(newline - begin + 1);
+        return true;
+    }
+
+    typedef typename Stream::executor_type executor_type;
+
+    Stream stream;
+    const std::shared_ptr<const ProtocolHandler> handler;
+    const bool coalesceWrites;
+    const std::size_t maxFrameLength;
+    std::ostream* const errorLog;
+    ThreadPool* const execution;
+    asio::streambuf input;
+    std::string request;
+    std::string response;
+
+    // Pipelined requests, numbered in the order they were read
+    std::uint64_t requested = 0;
+    std::uint64_t handledRequests = 0;
+    std::uint64_t answered = 0;
+    /** Responses not written yet, by request number */
+    std::map<std::uint64_t, std::string> handled;
+    bool readingPaused = false;
+    /** Set when the last request read cannot be prepared ahead */
+    bool waitingForBarrier = false;
+    bool writing = false;
+};
+
+/**
+ * Accepts connections until the io_context stops, or until the last one
+ * of remainingSessions unless 0, starting a session on each of them
+ */
+template<typename Protocol>
+void acceptAsync(
+    asio::basic_socket_acceptor<Protocol>& acceptor,
+    const std::function<void(typename Protocol::socket)>& startSession,
+    std::size_t remainingSessions
+) {
+    acceptor.async_accept([&acceptor, &startSession, remainingSessions](
+                              const std::error_code& error, typename Protocol::socket socket
+                          ) {
+        if (error) {
+            return;
+        }
+        startSession(std::move(socket));
+        if (remainingSessions != 1) {
+            acceptAsync(
+                acceptor, startSession, remainingSessions == 0 ? 0 : remainingSessions - 1
+            );
+        }
+    });
+}
+
+/**
+ * Serves a connection with pipelined requests until it is closed, doing
+ * its I/O on the calling thread
+ */
+template<typename Stream>
+void servePipelined(
+    asio::io_context& ios,
+    Stream stream,
+    std::shared_ptr<const ProtocolHandler> handler,
+    bool coalesceWrites,
+    std::size_t maxFrameLength,
+    std::ostream* errorLog,
+    CpuRotation& executionCpus,
+    CpuRotation& ioCpus
+) {
+    ioCpus.pinThisThread();
+    ThreadPool execution(1);
+    execution.submit([&executionCpus] {
+        executionCpus.pinThisThread();
+    });
+    std::make_shared<AsyncSession<Stream>>(
+        std::move(stream),
+        std::move(handler),
+        coalesceWrites,
+        maxFrameLength,
+        errorLog,
+        &execution
+    )
+        ->start();
+    ios.restart();
+    ios.run();
+}
+
+/**
+ * Threads of the sessions served at once. Those that have ended are joined
+ * before another one starts, so that serving without a session limit keeps
+ * no more threads than there are connections open.
+ */
+class SessionThreads {
+public:
+    SessionThreads() = default;
+    SessionThreads(const SessionThreads&) = delete;
+    SessionThreads& operator=(const SessionThreads&) = delete;
+
+    ~SessionThreads() {
+        joinAll();
+    }
+
+    /**
+     * Serves the stream on a thread of its own, calling session with it
+     */
+    template<typename Session, typename Stream>
+    void start(Session session, Stream stream) {
+        joinEnded();
+        const std::shared_ptr<std::atomic<bool>> ended = std::make_shared<std::atomic<bool>>(false);
+        std::thread thread(
+            [session, ended](Stream stream) {
+                session(std::move(stream));
+                *ended = true;
+            },
+            std::move(stream)
+        );
+        threads.push_back(SessionThread{std::move(thread), ended});
+    }
+
+    void joinAll() {
+        for (SessionThread& session : threads) {
+            session.thread.join();
+        }
+        threads.clear();
+    }
+
+private:
+    void joinEnded() {
+        std::vector<SessionThread>::iterator session = threads.begin();
+        while (session != threads.end()) {
+            if (*session->ended) {
+                session->thread.join();
+                session = threads.erase(session);
+            } else {
+                ++session;
+            }
+        }
+    }
+
+    struct SessionThread {
+        std::thread thread;
+        std::shared_ptr<std::atomic<bool>> ended;
+    };
+
+    std::vector<SessionThread> threads;
+};
+
+/**
+ * Like getline, but flushes pending output before it could block waiting
+ * for more input.
+ */
+bool readRequest(std::iostream& stream, std::string& request) {
+    std::streambuf& buffer = *stream.rdbuf();
+    request.clear();
+    for (;;) {
+        if (buffer.in_avail() <= 0) {
+            stream.flush();
+        }
+        const std::streambuf::int_type c = buffer.sbumpc();
+        if (std::streambuf::traits_type::eq_int_type(c, std::streambuf::traits_type::eof())) {
+            stream.setstate(std::ios::eofbit);
+            return !request.empty();
+        }
+        if (std::streambuf::traits_type::to_char_type(c) == '\n') {
+            return true;
+        }
+        request += std::streambuf::traits_type::to_char_type(c);
+    }
+}
+
+/**
+ * Reads exactly size bytes, flushing pending output first if fewer are
+ * buffered already.
+ */
+bool readBytes(std::iostream& stream, char* bytes, std::size_t size) {
+    if (stream.rdbuf()->in_avail() < static_cast<std::streamsize>(size)) {
+        stream.flush();
+    }
+    stream.read(bytes, size);
+    return static_cast<std::size_t>(stream.gcount()) == size;
+}
+
+bool readFrame(
+    std::iostream& stream, std::string& request, std::size_t maxLength, std::ostream* log
+) {
+    unsigned char header[FRAME_HEADER_SIZE];
+    if (!readBytes(stream, reinterpret_cast<char*>(header), FRAME_HEADER_SIZE)) {
+        return false;
+    }
+    const std::size_t length = frameLength(header);
+    if (!isAcceptedFrameLength(length, maxLength, log)) {
+        return false;
+    }
+    request.resize(length);
+    return readBytes(stream, &request[0], request.size());
+}
+
+/**
+ * Stream buffer over an asio stream that has no iostream of its own, for
+ * SocketServer::processStream()
+ */
+template<typename Stream>
+class AsioStreamBuffer : public std::streambuf {
+public:
+    explicit AsioStreamBuffer(Stream& stream) :
+        stream(stream) {
+        setg(input, input, input);
+        setp(output, output + sizeof(output));
+    }
+
+protected:
+    int_type underflow() override {
+        std::error_code error;
+        const std::size_t size = stream.read_some(asio::buffer(input), error);
+        if (error) {
+            return traits_type::eof();
+        }
+        setg(input, input, input + size);
+        return traits_type::to_int_type(input[0]);
+    }
+
+    int_type overflow(int_type c) override {
+        if (sync() != 0) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    int sync() override {
+        std::error_code error;
+        asio::write(stream, asio::buffer(pbase(), pptr() - pbase()), error);
+        setp(output, output + sizeof(output));
+        return error ? -1 : 0;
+    }
+
+private:
+    Stream& stream;
+    // The largest TLS record, and the buffers of named pipes
+    char input[16 * 1024];
+    char output[16 * 1024];
+};
+
+#if defined(CUKE_ENABLE_TLS)
+/**
+ * Sessions are resumable for as long as a typical device lab working day
+ */
+const long TLS_SESSION_TIMEOUT_SECONDS = 12 * 60 * 60;
+#endif
 }
 
 template<typename Protocol>
 void SocketServer::doAcceptOnce(asio::basic_socket_acceptor<Protocol>& acceptor) {
     typename Protocol::socket socket(ios);
     acceptor.accept(socket);
+    if (pipelineRequests) {
+        // Not owned by the session
+        const std::shared_ptr<const ProtocolHandler> handler(
+            protocolHandler, [](const ProtocolHandler*) {}
+        );
+        servePipelined(
+            ios,
+            std::move(socket),
+            handler,
+            coalesceWrites,
+            maxFrameLength,
+            errorLog,
+            executionCpus,
+            ioCpus
+        );
+        return;
+    }
     typename Protocol::iostream stream(std::move(socket));
-    processStream(stream);
+    processStream(stream, *protocolHandler);
+}
+
+template<typename Protocol>
+void SocketServer::doAcceptSessions(
+    asio::basic_socket_acceptor<Protocol>& acceptor,
+    const session_factory_type& newSession,
+    std::size_t maxSessions
+) {
+    SessionThreads sessions;
+    for (std::size_t accepted = 0; maxSessions == 0 || accepted < maxSessions; ++accepted) {
+        // Pipelined sessions do the I/O of their connection on their own thread
+        const std::shared_ptr<asio::io_context> sessionIos =
+            pipelineRequests ? std::make_shared<asio::io_context>() : nullptr;
+        typename Protocol::socket socket(sessionIos ? *sessionIos : ios);
+        acceptor.accept(socket);
+        std::shared_ptr<const ProtocolHandler> handler(newSession());
+        sessions.start([this, handler, sessionIos](typename Protocol::socket socket) {
+            if (sessionIos) {
+                servePipelined(
+                    *sessionIos,
+                    std::move(socket),
+                    handler,
+                    coalesceWrites,
+                    maxFrameLength,
+                    errorLog,
+                    executionCpus,
+                    ioCpus
+                );
+                return;
+            }
+            executionCpus.pinThisThread();
+            typename Protocol::iostream stream(std::move(socket));
+            processStream(stream, *handler);
+        }, std::move(socket));
+    }
+    sessions.joinAll();
+}
+
+template<typename Protocol>
+void SocketServer::doServeAsync(
+    asio::basic_socket_acceptor<Protocol>& acceptor,
+    const session_factory_type& newSession,
+    std::size_t maxSessions
+) {
+    // Sessions take turns on the execution thread, like they do without one
+    std::unique_ptr<ThreadPool> execution;
+    if (pipelineRequests) {
+        execution.reset(new ThreadPool(1));
+        execution->submit([this] {
+            executionCpus.pinThisThread();
+        });
+        ioCpus.pinThisThread();
+    } else {
+        executionCpus.pinThisThread();
+    }
+    const std::function<void(typename Protocol::socket)> startSession =
+        [this, &newSession, &execution](typename Protocol::socket socket) {
+            std::make_shared<AsyncSession<typename Protocol::socket>>(
+                std::move(socket),
+                newSession(),
+                coalesceWrites,
+                maxFrameLength,
+                errorLog,
+                execution.get()
+            )
+                ->start();
+        };
+    acceptAsync(acceptor, startSession, maxSessions);
+    ios.restart();
+    ios.run();
+}
+
+#if !defined(_WIN32)
+namespace {
+/**
+ * Runs the work in a child process, which exits once done instead of
+ * returning, telling the log why it failed if any
+ *
+ * @return the process id of the child
+ */
+pid_t forkWorker(
+    asio::io_context& ios, const std::function<void()>& work, std::ostream* errorLog
+) {
+    // Output still buffered would be written by both processes
+    std::cout.flush();
+    std::clog.flush();
+    ios.notify_fork(asio::io_context::fork_prepare);
+    const pid_t pid = fork();
+    if (pid < 0) {
+        throw std::system_error(errno, std::generic_category(), "Unable to fork a worker");
+    }
+    if (pid > 0) {
+        ios.notify_fork(asio::io_context::fork_parent);
+        return pid;
+    }
+    int status = 0;
+    try {
+        ios.notify_fork(asio::io_context::fork_child);
+        work();
+    } catch (const std::exception& e) {
+        if (errorLog) {
+            *errorLog << e.what() << std::endl;
+        }
+        status = 1;
+    } catch (...) {
+        status = 1;
+    }
+    std::cout.flush();
+    std::clog.flush();
+    // Static destructors and exit handlers are the business of the parent
+    _exit(status);
 }
+}
+
+void SocketServer::acceptForked(
+    const session_factory_type& newSession, std::size_t workers, std::size_t maxSessions
+) {
+    const std::function<void()> serve = [this, &newSession, maxSessions] {
+        for (std::size_t sessions = 0; maxSessions == 0 || sessions < maxSessions; ++sessions) {
+            const std::unique_ptr<const ProtocolHandler> handler = newSession();
+            protocolHandler = handler.get();
+            acceptOnce();
+        }
+    };
+    // Each worker is pinned as a whole, the threads it starts inheriting its cpu
+    const std::function<std::function<void()>()> pinnedServe = [this, &serve] {
+        const cpu_list_type cpu = executionCpus.take();
+        return [this, &serve, cpu] {
+            pinThisThread(cpu);
+            executionCpus.assign(cpu_list_type());
+            ioCpus.assign(cpu_list_type());
+            serve();
+        };
+    };
+    std::set<pid_t> running;
+    for (std::size_t i = 0; i < workers; ++i) {
+        running.insert(forkWorker(ios, pinnedServe(), errorLog));
+    }
+    while (!running.empty()) {
+        int status = 0;
+        const pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "Unable to wait for workers");
+        }
+        if (running.erase(pid) > 0 && maxSessions == 0 && WIFSIGNALED(status)) {
+            running.insert(forkWorker(ios, pinnedServe(), errorLog));
+        }
+    }
+}
+#endif
 
-void SocketServer::processStream(std::iostream& stream) {
+void SocketServer::processStream(std::iostream& stream, const ProtocolHandler& handler) {
     std::string request;
-    while (getline(stream, request)) {
-        stream << protocolHandler->handle(request) << std::endl << std::flush;
+    if (!coalesceWrites) {
+        while (!handler.usesBinaryFrames() && getline(stream, request)) {
+            stream << handler.handle(request) << std::endl << std::flush;
+        }
+    } else {
+        while (!handler.usesBinaryFrames() && readRequest(stream, request)) {
+            stream << handler.handle(request) << '\n';
+        }
     }
+    if (handler.usesBinaryFrames()) {
+        std::string response;
+        while (readFrame(stream, request, maxFrameLength, errorLog)) {
+            response.clear();
+            appendFrame(response, handler.handle(request));
+            stream.write(response.data(), response.size());
+            if (!coalesceWrites) {
+                stream.flush();
+            }
+        }
+    }
+    stream.flush();
 }
 
 TCPSocketServer::TCPSocketServer(const ProtocolHandler* protocolHandler) :
@@ -58,6 +880,166 @@ void TCPSocketServer::acceptOnce() {
     doAcceptOnce(acceptor);
 }
 
+void TCPSocketServer::acceptSessions(
+    const session_factory_type& newSession, std::size_t maxSessions
+) {
+    doAcceptSessions(acceptor, newSession, maxSessions);
+}
+
+void TCPSocketServer::serveAsync(const session_factory_type& newSession, std::size_t maxSessions) {
+    doServeAsync(acceptor, newSession, maxSessions);
+}
+
+#if defined(CUKE_ENABLE_TLS)
+asio::ssl::context TLSSocketServer::makeContext(
+    const std::string& certificateChainFile, const std::string& privateKeyFile
+) {
+    asio::ssl::context context(asio::ssl::context::tls_server);
+    context.set_options(
+        asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2
+        | asio::ssl::context::no_sslv3 | asio::ssl::context::no_tlsv1
+        | asio::ssl::context::no_tlsv1_1 | asio::ssl::context::single_dh_use
+    );
+    context.use_certificate_chain_file(certificateChainFile);
+    context.use_private_key_file(privateKeyFile, asio::ssl::context::pem);
+    // Session IDs for TLS 1.2 clients, tickets for the others
+    SSL_CTX* const native = context.native_handle();
+    static const unsigned char sessionIdContext[] = "cucumber-cpp";
+    SSL_CTX_set_session_id_context(native, sessionIdContext, sizeof(sessionIdContext) - 1);
+    SSL_CTX_set_session_cache_mode(native, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_set_timeout(native, TLS_SESSION_TIMEOUT_SECONDS);
+    return context;
+}
+
+TLSSocketServer::TLSSocketServer(
+    const ProtocolHandler* protocolHandler, asio::ssl::context context
+) :
+    SocketServer(protocolHandler),
+    context(std::move(context)),
+    acceptor(ios) {
+}
+
+void TLSSocketServer::listen(const port_type port) {
+    listen(asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port));
+}
+
+void TLSSocketServer::listen(const asio::ip::tcp::endpoint endpoint) {
+    doListen(acceptor, endpoint);
+    acceptor.set_option(asio::ip::tcp::no_delay(true));
+}
+
+asio::ip::tcp::endpoint TLSSocketServer::listenEndpoint() const {
+    return acceptor.local_endpoint();
+}
+
+void TLSSocketServer::acceptOnce() {
+    // Not owned by the session
+    const std::shared_ptr<const ProtocolHandler> handler(
+        protocolHandler, [](const ProtocolHandler*) {}
+    );
+    for (;;) {
+        asio::ip::tcp::socket socket(ios);
+        acceptor.accept(socket);
+        if (serve(ios, std::move(socket), handler)) {
+            return;
+        }
+    }
+}
+
+void TLSSocketServer::acceptSessions(
+    const session_factory_type& newSession, std::size_t maxSessions
+) {
+    SessionThreads sessions;
+    for (std::size_t accepted = 0; maxSessions == 0 || accepted < maxSessions; ++accepted) {
+        // Handshakes happen on the session threads, not to hold up accepting
+        const std::shared_ptr<asio::io_context> sessionIos = std::make_shared<asio::io_context>();
+        asio::ip::tcp::socket socket(*sessionIos);
+        acceptor.accept(socket);
+        std::shared_ptr<const ProtocolHandler> handler(newSession());
+        sessions.start([this, handler, sessionIos](asio::ip::tcp::socket socket) {
+            if (!pipelineRequests) {
+                executionCpus.pinThisThread();
+            }
+            serve(*sessionIos, std::move(socket), handler);
+        }, std::move(socket));
+    }
+    sessions.joinAll();
+}
+
+void TLSSocketServer::serveAsync(const session_factory_type& newSession, std::size_t maxSessions) {
+    std::unique_ptr<ThreadPool> execution;
+    if (pipelineRequests) {
+        execution.reset(new ThreadPool(1));
+        execution->submit([this] {
+            executionCpus.pinThisThread();
+        });
+        ioCpus.pinThisThread();
+    } else {
+        executionCpus.pinThisThread();
+    }
+    const std::function<void(asio::ip::tcp::socket)> startSession =
+        [this, &newSession, &execution](asio::ip::tcp::socket socket) {
+            std::error_code error;
+            socket.set_option(asio::socket_base::keep_alive(true), error);
+            const std::shared_ptr<stream_type> stream =
+                std::make_shared<stream_type>(std::move(socket), context);
+            const std::shared_ptr<const ProtocolHandler> handler(newSession());
+            stream->async_handshake(
+                stream_type::server,
+                [this, stream, handler, &execution](const std::error_code& error) {
+                    if (error) {
+                        return;
+                    }
+                    std::make_shared<AsyncSession<stream_type>>(
+                        std::move(*stream),
+                        handler,
+                        coalesceWrites,
+                        maxFrameLength,
+                        errorLog,
+                        execution.get()
+                    )
+                        ->start();
+                }
+            );
+        };
+    acceptAsync(acceptor, startSession, maxSessions);
+    ios.restart();
+    ios.run();
+}
+
+bool TLSSocketServer::serve(
+    asio::io_context& streamIos,
+    asio::ip::tcp::socket socket,
+    std::shared_ptr<const ProtocolHandler> handler
+) {
+    std::error_code error;
+    socket.set_option(asio::socket_base::keep_alive(true), error);
+    stream_type stream(std::move(socket), context);
+    stream.handshake(stream_type::server, error);
+    if (error) {
+        return false;
+    }
+    if (pipelineRequests) {
+        servePipelined(
+            streamIos,
+            std::move(stream),
+            std::move(handler),
+            coalesceWrites,
+            maxFrameLength,
+            errorLog,
+            executionCpus,
+            ioCpus
+        );
+        return true;
+    }
+    AsioStreamBuffer<stream_type> buffer(stream);
+    std::iostream iostream(&buffer);
+    processStream(iostream, *handler);
+    stream.shutdown(error);
+    return true;
+}
+#endif
+
 #if defined(ASIO_HAS_LOCAL_SOCKETS)
 UnixSocketServer::UnixSocketServer(const ProtocolHandler* protocolHandler) :
     SocketServer(protocolHandler),
@@ -79,6 +1061,18 @@ void UnixSocketServer::acceptOnce() {
     doAcceptOnce(acceptor);
 }
 
+void UnixSocketServer::acceptSessions(
+    const session_factory_type& newSession, std::size_t maxSessions
+) {
+    doAcceptSessions(acceptor, newSession, maxSessions);
+}
+
+void UnixSocketServer::serveAsync(
+    const session_factory_type& newSession, std::size_t maxSessions
+) {
+    doServeAsync(acceptor, newSession, maxSessions);
+}
+
 UnixSocketServer::~UnixSocketServer() {
     if (!acceptor.is_open())
         return;
@@ -89,5 +1083,234 @@ UnixSocketServer::~UnixSocketServer() {
 }
 #endif
 
+#if defined(ASIO_HAS_WINDOWS_STREAM_HANDLE)
+namespace {
+const char PIPE_PREFIX[] = "\\\\.\\pipe\\";
+const DWORD PIPE_BUFFER_SIZE = 64 * 1024;
+
+std::system_error lastError(const std::string& what) {
+    return std::system_error(static_cast<int>(GetLastError()), std::system_category(), what);
+}
+
+HANDLE createPipeInstance(const std::string& name, bool first) {
+    const HANDLE pipe = CreateNamedPipeA(
+        name.c_str(),
+        PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED | (first ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0),
+        PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+        PIPE_UNLIMITED_INSTANCES,
+        PIPE_BUFFER_SIZE,
+        PIPE_BUFFER_SIZE,
+        0,
+        nullptr
+    );
+    if (pipe == INVALID_HANDLE_VALUE) {
+        throw lastError("Unable to create the named pipe " + name);
+    }
+    return pipe;
+}
+
+HANDLE createEvent() {
+    const HANDLE event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (!event) {
+        throw lastError("Unable to create an event");
+    }
+    return event;
+}
+
+/**
+ * Overlapped ConnectNamedPipe of a pipe instance, signalling the event
+ * once a client connected
+ */
+class PendingConnection {
+public:
+    PendingConnection(asio::io_context& ios, HANDLE pipe) :
+        pipe(pipe),
+        event(ios, createEvent()),
+        overlapped() {
+        overlapped.hEvent = event.native_handle();
+    }
+
+    PendingConnection(const PendingConnection&) = delete;
+    PendingConnection& operator=(const PendingConnection&) = delete;
+
+    /**
+     * @return true if a client connected already, false once the event is
+     *         to be waited for
+     */
+    bool start() {
+        if (ConnectNamedPipe(pipe, &overlapped)) {
+            return true;
+        }
+        switch (GetLastError()) {
+        case ERROR_PIPE_CONNECTED:
+            return true;
+        case ERROR_IO_PENDING:
+            return false;
+        default:
+            throw lastError("Unable to wait for a client of the named pipe");
+        }
+    }
+
+    void complete() {
+        DWORD transferred = 0;
+        if (!GetOverlappedResult(pipe, &overlapped, &transferred, TRUE)) {
+            throw lastError("Unable to connect a client to the named pipe");
+        }
+    }
+
+    const HANDLE pipe;
+    asio::windows::object_handle event;
+
+private:
+    OVERLAPPED overlapped;
+};
+}
+
+NamedPipeServer::NamedPipeServer(const ProtocolHandler* protocolHandler) :
+    SocketServer(protocolHandler),
+    pending(INVALID_HANDLE_VALUE) {
+}
+
+void NamedPipeServer::listen(const std::string& pipeName) {
+    const std::string fullName =
+        pipeName.compare(0, 2, "\\\\") == 0 ? pipeName : PIPE_PREFIX + pipeName;
+    pending = createPipeInstance(fullName, true);
+    name = fullName;
+}
+
+const std::string& NamedPipeServer::listenName() const {
+    return name;
+}
+
+void NamedPipeServer::acceptOnce() {
+    // Not owned by the session
+    const std::shared_ptr<const ProtocolHandler> handler(
+        protocolHandler, [](const ProtocolHandler*) {}
+    );
+    serve(ios, accept(ios), handler);
+}
+
+void NamedPipeServer::acceptSessions(
+    const session_factory_type& newSession, std::size_t maxSessions
+) {
+    SessionThreads sessions;
+    for (std::size_t accepted = 0; maxSessions == 0 || accepted < maxSessions; ++accepted) {
+        // Every session does the I/O of its pipe on its own thread
+        const std::shared_ptr<asio::io_context> sessionIos = std::make_shared<asio::io_context>();
+        stream_type pipe = accept(*sessionIos);
+        std::shared_ptr<const ProtocolHandler> handler(newSession());
+        sessions.start([this, handler, sessionIos](stream_type pipe) {
+            serve(*sessionIos, std::move(pipe), handler);
+        }, std::move(pipe));
+    }
+    sessions.joinAll();
+}
+
+void NamedPipeServer::serveAsync(
+    const session_factory_type& newSession, std::size_t maxSessions
+) {
+    // Sessions take turns on the execution thread, like they do without one
+    std::unique_ptr<ThreadPool> execution;
+    if (pipelineRequests) {
+        execution.reset(new ThreadPool(1));
+        execution->submit([this] {
+            executionCpus.pinThisThread();
+        });
+        ioCpus.pinThisThread();
+    } else {
+        executionCpus.pinThisThread();
+    }
+    const std::function<void(stream_type)> startSession =
+        [this, &newSession, &execution](stream_type pipe) {
+            std::make_shared<AsyncSession<stream_type>>(
+                std::move(pipe),
+                newSession(),
+                coalesceWrites,
+                maxFrameLength,
+                errorLog,
+                execution.get()
+            )
+                ->start();
+        };
+    acceptAsync(startSession, maxSessions);
+    ios.restart();
+    ios.run();
+}
+
+NamedPipeServer::~NamedPipeServer() {
+    if (pending != INVALID_HANDLE_VALUE) {
+        CloseHandle(pending);
+    }
+}
+
+NamedPipeServer::stream_type NamedPipeServer::accept(asio::io_context& streamIos) {
+    PendingConnection connection(ios, pending);
+    if (!connection.start()) {
+        connection.event.wait();
+        connection.complete();
+    }
+    return takeConnected(streamIos);
+}
+
+NamedPipeServer::stream_type NamedPipeServer::takeConnected(asio::io_context& streamIos) {
+    stream_type pipe(streamIos, pending);
+    pending = INVALID_HANDLE_VALUE;
+    pending = createPipeInstance(name, false);
+    return pipe;
+}
+
+void NamedPipeServer::acceptAsync(
+    const std::function<void(stream_type)>& startSession, std::size_t remainingSessions
+) {
+    const std::shared_ptr<PendingConnection> connection =
+        std::make_shared<PendingConnection>(ios, pending);
+    const std::function<void(const std::error_code&)> onConnected =
+        [this, &startSession, remainingSessions, connection](const std::error_code& error) {
+            if (error) {
+                return;
+            }
+            connection->complete();
+            startSession(takeConnected(ios));
+            if (remainingSessions != 1) {
+                acceptAsync(startSession, remainingSessions == 0 ? 0 : remainingSessions - 1);
+            }
+        };
+    if (connection->start()) {
+        asio::post(ios, [onConnected] {
+            onConnected(std::error_code());
+        });
+    } else {
+        connection->event.async_wait(onConnected);
+    }
+}
+
+void NamedPipeServer::serve(
+    asio::io_context& streamIos, stream_type pipe, std::shared_ptr<const ProtocolHandler> handler
+) {
+    if (pipelineRequests) {
+        servePipelined(
+            streamIos,
+            std::move(pipe),
+            std::move(handler),
+            coalesceWrites,
+            maxFrameLength,
+            errorLog,
+            executionCpus,
+            ioCpus
+        );
+        return;
+    }
+    executionCpus.pinThisThread();
+    {
+        AsioStreamBuffer<stream_type> buffer(pipe);
+        std::iostream stream(&buffer);
+        processStream(stream, *handler);
+    }
+    // Lets the client read the last responses before the pipe closes
+    FlushFileBuffers(pipe.native_handle());
+    DisconnectNamedPipe(pipe.native_handle());
+}
+#endif
+
 }
 }
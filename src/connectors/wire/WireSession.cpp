@@ -0,0 +1,51 @@
+#include <cucumber-cpp/internal/connectors/wire/WireSession.hpp>
+#include <cucumber-cpp/internal/CukeEngineImpl.hpp>
+#include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+class WireSession : public ProtocolHandler {
+public:
+    explicit WireSession(bool dryRun) :
+        protocolHandler(wireCodec, cukeEngine) {
+        cukeEngine.setDryRun(dryRun);
+    }
+
+    std::string handle(const std::string& request) const override {
+        return protocolHandler.handle(request);
+    }
+
+    std::shared_ptr<const PreparedRequest> prepare(const std::string& request) const override {
+        return protocolHandler.prepare(request);
+    }
+
+    std::string handlePrepared(const std::string& request, const PreparedRequest* prepared)
+        const override {
+        return protocolHandler.handlePrepared(request, prepared);
+    }
+
+    bool usesBinaryFrames() const override {
+        return protocolHandler.usesBinaryFrames();
+    }
+
+private:
+    CukeEngineImpl cukeEngine;
+#if defined(CUKE_ENABLE_SIMDJSON)
+    SimdJsonWireMessageCodec wireCodec;
+#else
+    JsonWireMessageCodec wireCodec;
+#endif
+    WireProtocolHandler protocolHandler;
+};
+
+}
+
+std::unique_ptr<const ProtocolHandler> newWireSession(bool dryRun) {
+    return std::unique_ptr<const ProtocolHandler>(new WireSession(dryRun));
+}
+
+}
+}
@@ -0,0 +1,137 @@
+#include <cucumber-cpp/internal/connectors/wire/WireTranscript.hpp>
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+namespace cucumber {
+namespace internal {
+
+WireTranscriptWriter::WireTranscriptWriter(std::ostream& out) :
+    out(out),
+    sessions(0),
+    start(std::chrono::steady_clock::now()) {
+}
+
+WireTranscriptEntry::session_type WireTranscriptWriter::newSession() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ++sessions;
+}
+
+void WireTranscriptWriter::write(
+    WireTranscriptEntry::session_type session,
+    WireTranscriptEntry::Direction direction,
+    const std::string& message
+) {
+    const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+    std::lock_guard<std::mutex> lock(mutex);
+    out << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << ' ' << session
+        << ' ' << static_cast<char>(direction) << ' ' << message.size() << ' ' << message << '\n';
+    // Keep what was recorded when the server is killed
+    out.flush();
+}
+
+WireTranscriptReader::WireTranscriptReader(std::istream& in) :
+    in(in) {
+}
+
+bool WireTranscriptReader::next(WireTranscriptEntry& entry) {
+    char direction;
+    std::size_t length;
+    if (!(in >> entry.microseconds)) {
+        if (in.eof()) {
+            return false;
+        }
+        throw std::runtime_error("Malformed wire transcript entry");
+    }
+    if (!(in >> entry.session >> direction >> length) || in.get() != ' '
+        || (direction != WireTranscriptEntry::REQUEST
+            && direction != WireTranscriptEntry::RESPONSE)) {
+        throw std::runtime_error("Malformed wire transcript entry");
+    }
+    entry.direction = static_cast<WireTranscriptEntry::Direction>(direction);
+    entry.message.resize(length);
+    if (length != 0 && !in.read(&entry.message[0], length)) {
+        throw std::runtime_error("Truncated wire transcript entry");
+    }
+    if (in.get() != '\n') {
+        throw std::runtime_error("Malformed wire transcript entry");
+    }
+    return true;
+}
+
+RecordingProtocolHandler::RecordingProtocolHandler(
+    std::unique_ptr<const ProtocolHandler> handler, WireTranscriptWriter& transcript
+) :
+    handler(std::move(handler)),
+    transcript(transcript),
+    session(transcript.newSession()) {
+}
+
+std::string RecordingProtocolHandler::handle(const std::string& request) const {
+    return handlePrepared(request, nullptr);
+}
+
+std::shared_ptr<const PreparedRequest> RecordingProtocolHandler::prepare(
+    const std::string& request
+) const {
+    return handler->prepare(request);
+}
+
+std::string RecordingProtocolHandler::handlePrepared(
+    const std::string& request, const PreparedRequest* prepared
+) const {
+    transcript.write(session, WireTranscriptEntry::REQUEST, request);
+    const std::string response = handler->handlePrepared(request, prepared);
+    transcript.write(session, WireTranscriptEntry::RESPONSE, response);
+    return response;
+}
+
+bool RecordingProtocolHandler::usesBinaryFrames() const {
+    return handler->usesBinaryFrames();
+}
+
+WireTranscriptReplayer::WireTranscriptReplayer(session_factory_type newSession) :
+    newSession(std::move(newSession)) {
+}
+
+WireTranscriptReplayer::Result WireTranscriptReplayer::replay(
+    std::istream& transcript, std::ostream* mismatches
+) const {
+    struct Session {
+        std::unique_ptr<const ProtocolHandler> handler;
+        std::string request;
+        std::string response;
+    };
+    std::map<WireTranscriptEntry::session_type, Session> sessions;
+
+    Result result;
+    WireTranscriptReader reader(transcript);
+    WireTranscriptEntry entry;
+    while (reader.next(entry)) {
+        Session& session = sessions[entry.session];
+        if (entry.direction == WireTranscriptEntry::REQUEST) {
+            if (!session.handler) {
+                session.handler = newSession();
+            }
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            session.response = session.handler->handle(entry.message);
+            result.elapsed += std::chrono::steady_clock::now() - start;
+            session.request = std::move(entry.message);
+            ++result.requests;
+        } else if (entry.message != session.response) {
+            ++result.mismatches;
+            if (mismatches) {
+                *mismatches << "Session " << entry.session << " request " << session.request
+                            << "\n  recorded " << entry.message << "\n  replayed "
+                            << session.response << "\n";
+            }
+        }
+    }
+    return result;
+}
+
+}
+}
@@ -1,8 +1,12 @@
 #include <cucumber-cpp/internal/drivers/BoostDriver.hpp>
 
+#include <exception>
 #include <sstream>
 
 #include <boost/function.hpp>
+#include <boost/test/execution_monitor.hpp>
+#include <boost/test/results_collector.hpp>
+#include <boost/test/results_reporter.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_log_formatter.hpp>
 #include <mutex>
@@ -18,13 +22,27 @@ namespace {
 
 test_case* testCase = 0;
 boost::function<void()> currentTestBody;
+// Rethrown once the framework returns, as it would report it as a success
+std::exception_ptr currentException;
+// Not set when the framework interrupts the step on a signal or a timeout
+bool currentTestBodyCompleted = false;
 
 void exec_test_body() {
     if (currentTestBody) {
-        currentTestBody();
+        try {
+            currentTestBody();
+        } catch (const ::boost::execution_aborted&) {
+            // Failed critical check, already logged
+        } catch (...) {
+            currentException = std::current_exception();
+        }
     }
+    currentTestBodyCompleted = true;
 }
 
+bool lightweightExecution = false;
+bool lightweightObservers = false;
+
 bool boost_test_init() {
     testCase = BOOST_TEST_CASE(&exec_test_body);
     framework::master_test_suite().add(testCase);
@@ -52,8 +70,9 @@ public:
         override{};
     void test_unit_skipped(std::ostream&, test_unit const& /*tu*/) override{};
 
-    void log_exception_start(std::ostream&, log_checkpoint_data const&, execution_exception const&)
-        override{};
+    void log_exception_start(
+        std::ostream&, log_checkpoint_data const&, execution_exception const& ex
+    ) override;
     void log_exception_finish(std::ostream&) override{};
 
     void log_entry_start(std::ostream&, log_entry_data const&, log_entry_types /*let*/) override{};
@@ -87,6 +106,15 @@ void CukeBoostLogInterceptor::log_entry_value(std::ostream&, lazy_ostream const&
     description << value;
 }
 
+/*
+ * Signals and timeouts: exceptions thrown by the step are rethrown instead
+ */
+void CukeBoostLogInterceptor::log_exception_start(
+    std::ostream&, log_checkpoint_data const&, execution_exception const& ex
+) {
+    description << ex.what();
+}
+
 const InvokeResult CukeBoostLogInterceptor::getResult() const {
     std::string d = description.str();
     if (d.empty()) {
@@ -100,9 +128,46 @@ const InvokeResult BoostStep::invokeStepBody() {
     static std::once_flag initialized;
     std::call_once(initialized, BoostStep::initBoostTest);
 
+    applyExecutionMode();
+
     logInterceptor->reset();
+    currentTestBodyCompleted = false;
     runWithMasterSuite();
-    return logInterceptor->getResult();
+    if (currentException) {
+        std::exception_ptr exception;
+        std::swap(exception, currentException);
+        std::rethrow_exception(exception);
+    }
+    const InvokeResult result = logInterceptor->getResult();
+    if (!currentTestBodyCompleted && result.isSuccess()) {
+        // Not logged in lightweight execution
+        return InvokeResult::failure("Step aborted by Boost.Test");
+    }
+    return result;
+}
+
+void BoostStep::setLightweightExecution(const bool lightweight) {
+    lightweightExecution = lightweight;
+}
+
+bool BoostStep::isLightweightExecution() {
+    return lightweightExecution;
+}
+
+void BoostStep::applyExecutionMode() {
+    if (lightweightObservers == lightweightExecution) {
+        return;
+    }
+    lightweightObservers = lightweightExecution;
+    if (lightweightObservers) {
+        framework::deregister_observer(results_collector);
+        framework::deregister_observer(unit_test_log);
+        results_reporter::set_level(NO_REPORT);
+    } else {
+        framework::register_observer(results_collector);
+        framework::register_observer(unit_test_log);
+        results_reporter::set_level(CONFIRMATION_REPORT);
+    }
 }
 
 void BoostStep::initBoostTest() {
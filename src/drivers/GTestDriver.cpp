@@ -1,16 +1,52 @@
 #include <cucumber-cpp/internal/drivers/GTestDriver.hpp>
 
+#include <mutex>
+#include <sstream>
+
 #include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
 
 namespace cucumber {
 namespace internal {
 
-bool GTestStep::initialized(false);
+namespace {
+
+std::atomic<bool> collectingFailures(false);
+
+/**
+ * Same text as the exception thrown on failure
+ */
+std::string describeFailures(const ::testing::TestPartResultArray& results) {
+    std::ostringstream description;
+    for (int i = 0; i < results.size(); ++i) {
+        const ::testing::TestPartResult& result = results.GetTestPartResult(i);
+        if (!result.failed()) {
+            continue;
+        }
+        if (description.tellp() > 0) {
+            description << "\n";
+        }
+        description << (result.file_name() ? result.file_name() : "unknown file");
+        if (result.line_number() >= 0) {
+            description << ":" << result.line_number();
+        }
+        description << ": Failure\n" << result.message();
+    }
+    return description.str();
+}
+
+}
+
+std::atomic<bool> GTestStep::initialized(false);
 
 const InvokeResult GTestStep::invokeStepBody() {
-    if (!initialized) {
+    static std::once_flag initialization;
+    std::call_once(initialization, [this] {
         initGTest();
         initFlags();
+    });
+    if (collectingFailures) {
+        return invokeCollectingFailures();
     }
     try {
         body();
@@ -21,6 +57,32 @@ const InvokeResult GTestStep::invokeStepBody() {
     }
 }
 
+const InvokeResult GTestStep::invokeCollectingFailures() {
+    ::testing::TestPartResultArray results;
+    {
+        const ::testing::ScopedFakeTestPartResultReporter reporter(
+            ::testing::ScopedFakeTestPartResultReporter::INTERCEPT_ONLY_CURRENT_THREAD, &results
+        );
+        body();
+    }
+    const std::string failures = describeFailures(results);
+    if (failures.empty()) {
+        return InvokeResult::success();
+    }
+    return InvokeResult::failure(failures);
+}
+
+void GTestStep::setCollectingFailures(const bool collecting) {
+    collectingFailures = collecting;
+    if (initialized) {
+        ::testing::GTEST_FLAG(throw_on_failure) = !collecting;
+    }
+}
+
+bool GTestStep::isCollectingFailures() {
+    return collectingFailures;
+}
+
 void GTestStep::initGTest() {
     int fake_argc = 1;
     char* fake_argv[1];
@@ -30,8 +92,8 @@ void GTestStep::initGTest() {
 }
 
 void GTestStep::initFlags() {
-    ::testing::GTEST_FLAG(throw_on_failure) = true;  // let cucumber-cpp drive
-    ::testing::GTEST_FLAG(break_on_failure) = false; // turn off debugger breakpoints
+    ::testing::GTEST_FLAG(throw_on_failure) = !collectingFailures; // let cucumber-cpp drive
+    ::testing::GTEST_FLAG(break_on_failure) = false;               // turn off debugger breakpoints
     ::testing::GTEST_FLAG(catch_exceptions) = true;
 }
 
@@ -4,9 +4,61 @@
 #include <QTemporaryFile>
 #include <QTextStream>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace cucumber {
 namespace internal {
 
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+/**
+ * Anonymous file in memory, which QTest writes to through its path in
+ * /proc. Created once, as QTest truncates it when opening it.
+ */
+class MemoryFileWrapper {
+public:
+    MemoryFileWrapper() :
+        fd(memfd_create("cucumber-cpp-qtest", MFD_CLOEXEC)) {
+    }
+
+    ~MemoryFileWrapper() {
+        if (exists()) {
+            close(fd);
+        }
+    }
+
+    MemoryFileWrapper(const MemoryFileWrapper&) = delete;
+    MemoryFileWrapper& operator=(const MemoryFileWrapper&) = delete;
+
+    bool exists() const {
+        return fd >= 0;
+    }
+
+    QString name() const {
+        return QStringLiteral("/proc/self/fd/%1").arg(fd);
+    }
+
+    QString read() const {
+        QByteArray content;
+        char buffer[4096];
+        for (off_t offset = 0;;) {
+            const ssize_t count = pread(fd, buffer, sizeof(buffer), offset);
+            if (count <= 0) {
+                break;
+            }
+            content.append(buffer, static_cast<int>(count));
+            offset += count;
+        }
+        return QString::fromLocal8Bit(content);
+    }
+
+private:
+    const int fd;
+};
+#endif
+
 /**
  * Wraps the QTemporaryFile for Windows.
  *
@@ -46,13 +98,11 @@ private:
     }
 };
 
-const InvokeResult QtTestStep::invokeStepBody() {
-    const TemporaryFileWrapper file{};
-    if (!file.exists()) {
-        return InvokeResult::failure("Unable to open temporary file needed for this test");
-    }
+namespace {
 
-    QtTestObject testObject{this};
+template<typename File>
+const InvokeResult runWithLogFile(QtTestStep* step, const File& file) {
+    QtTestObject testObject{step};
     const QStringList args{"test", "-o", file.name() + ",tap"};
     const int returnValue = QTest::qExec(&testObject, args);
 
@@ -63,5 +113,22 @@ const InvokeResult QtTestStep::invokeStepBody() {
     }
 }
 
+}
+
+const InvokeResult QtTestStep::invokeStepBody() {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    // Steps run one at a time, each QTest run truncating the log
+    static const MemoryFileWrapper memoryFile{};
+    if (memoryFile.exists()) {
+        return runWithLogFile(this, memoryFile);
+    }
+#endif
+    const TemporaryFileWrapper file{};
+    if (!file.exists()) {
+        return InvokeResult::failure("Unable to open temporary file needed for this test");
+    }
+    return runWithLogFile(this, file);
+}
+
 }
 }
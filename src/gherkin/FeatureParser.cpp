@@ -0,0 +1,629 @@
+#include "cucumber-cpp/internal/gherkin/FeatureParser.hpp"
+#include "cucumber-cpp/internal/gherkin/FeatureSource.hpp"
+#include "cucumber-cpp/internal/utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+typedef CukeEngine::tags_type tags_type;
+typedef CukeEngine::invoke_table_type table_type;
+typedef std::vector<std::string> row_type;
+typedef std::vector<PickledStep> steps_type;
+
+struct ExamplesBlock {
+    tags_type tags;
+    bool hasHeader = false;
+    row_type header;
+    std::string_view headerSource;
+    table_type rows;
+    std::vector<std::string_view> rowSources;
+    std::vector<std::size_t> rowLines;
+};
+
+struct ScenarioDefinition {
+    std::string name;
+    std::size_t line = 0;
+    bool outline = false;
+    tags_type tags;
+    steps_type steps;
+    std::vector<ExamplesBlock> examples;
+};
+
+bool isSpace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && isSpace(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && isSpace(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+bool startsWith(const std::string_view text, const std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+/**
+ * Strips the keyword from a header line such as "Scenario: name"
+ */
+bool headerName(std::string_view line, const std::string_view keyword, std::string& name) {
+    if (!startsWith(line, keyword)) {
+        return false;
+    }
+    name = std::string(trim(line.substr(keyword.size())));
+    return true;
+}
+
+std::string substitute(const std::string_view text, const row_type& header, const row_type& row) {
+    std::string result;
+    result.reserve(text.size());
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        const std::size_t open = text.find('<', pos);
+        const std::size_t close =
+            open == std::string_view::npos ? open : text.find('>', open + 1);
+        if (close == std::string_view::npos) {
+            break;
+        }
+        result.append(text.substr(pos, open - pos));
+        const std::string_view placeholder = text.substr(open + 1, close - open - 1);
+        std::size_t column = 0;
+        while (column < header.size() && header[column] != placeholder) {
+            ++column;
+        }
+        if (column < header.size()) {
+            result += row[column];
+        } else {
+            result.append(text.substr(open, close - open + 1));
+        }
+        pos = close + 1;
+    }
+    result.append(text.substr(pos));
+    return result;
+}
+
+/**
+ * Calls the function with every line, without its line terminator
+ */
+template<typename Function>
+void forEachLine(std::string_view lines, Function function) {
+    while (!lines.empty()) {
+        std::size_t end = lines.find('\n');
+        std::string_view line = lines.substr(0, end);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        function(line);
+        lines.remove_prefix(end == std::string_view::npos ? lines.size() : end + 1);
+    }
+}
+
+/**
+ * Number of cells of a trimmed table row, without decoding them
+ */
+std::size_t countCells(const std::string_view row) {
+    std::size_t separators = 0;
+    for (std::size_t i = 0; i < row.size(); ++i) {
+        if (row[i] == '\\') {
+            ++i;
+        } else if (row[i] == '|') {
+            ++separators;
+        }
+    }
+    return separators - 1;
+}
+
+/**
+ * Decodes the cells of a trimmed table row
+ */
+row_type splitRow(const std::string_view row) {
+    row_type cells;
+    std::string cell;
+    for (std::size_t i = 1; i < row.size(); ++i) {
+        const char c = row[i];
+        if (c == '\\' && i + 1 < row.size()) {
+            const char escaped = row[++i];
+            if (escaped == 'n') {
+                cell += '\n';
+            } else if (escaped == '|' || escaped == '\\') {
+                cell += escaped;
+            } else {
+                cell += '\\';
+                cell += escaped;
+            }
+        } else if (c == '|') {
+            cells.emplace_back(trim(cell));
+            cell.clear();
+        } else {
+            cell += c;
+        }
+    }
+    return cells;
+}
+
+bool isTableRow(const std::string_view line) {
+    return line.size() >= 2 && line.front() == '|' && line.back() == '|';
+}
+
+PickledStep substitute(
+    const PickledStep& step,
+    const row_type& header,
+    const row_type& row,
+    const std::string_view headerSource,
+    const std::string_view rowSource
+) {
+    PickledStep result;
+    result.keyword = step.keyword;
+    result.text = substitute(step.text, header, row);
+    result.templateText = step.text;
+    result.hasDocString = step.hasDocString;
+    result.rawArgument = step.rawArgument;
+    if (result.rawArgument.kind != RawStepArgument::NONE) {
+        result.rawArgument.exampleHeader = headerSource;
+        result.rawArgument.exampleRow = rowSource;
+    }
+    return result;
+}
+
+class Parser {
+public:
+    Parser(
+        const std::shared_ptr<const FeatureSource>& featureSource,
+        FeatureParser::pickles_type& pickles
+    ) :
+        featureSource(featureSource),
+        source(featureSource->getText()),
+        uri(featureSource->getUri()),
+        pickles(pickles) {
+    }
+
+    void parse() {
+        // UTF-8 byte order mark
+        if (startsWith(source, "\xEF\xBB\xBF")) {
+            pos = 3;
+        }
+        std::string_view line;
+        while (nextLine(line)) {
+            parseLine(line);
+        }
+        requireNoPendingTags();
+        finishScenario();
+    }
+
+private:
+    enum Section { NONE, FEATURE, BACKGROUND, SCENARIO, EXAMPLES };
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw FeatureParseException(uri, lineNumber, message);
+    }
+
+    bool nextLine(std::string_view& line) {
+        if (pos >= source.size()) {
+            return false;
+        }
+        std::size_t end = source.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = source.size();
+        }
+        line = source.substr(pos, end - pos);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        pos = end + 1;
+        ++lineNumber;
+        return true;
+    }
+
+    void parseLine(const std::string_view rawLine) {
+        const std::string_view line = trim(rawLine);
+        std::string name;
+        if (line.empty() || line.front() == '#') {
+            return;
+        } else if (line.front() == '@') {
+            parseTags(line);
+        } else if (line.front() == '|') {
+            parseTableRow(rawLine, line);
+        } else if (startsWith(line, "\"\"\"") || startsWith(line, "```")) {
+            parseDocString(rawLine, line);
+        } else if (headerName(line, "Feature:", name)) {
+            if (section != NONE) {
+                fail("A file can contain only one Feature");
+            }
+            featureTags = takeTags();
+            section = FEATURE;
+        } else if (headerName(line, "Rule:", name)) {
+            requireFeature();
+            finishScenario();
+            ruleTags = takeTags();
+            ruleBackground.clear();
+            inRule = true;
+            section = FEATURE;
+            steps = nullptr;
+        } else if (headerName(line, "Background:", name)) {
+            requireFeature();
+            requireNoPendingTags();
+            finishScenario();
+            steps = inRule ? &ruleBackground : &featureBackground;
+            steps->clear();
+            section = BACKGROUND;
+        } else if (headerName(line, "Scenario Outline:", name)
+                   || headerName(line, "Scenario Template:", name)) {
+            beginScenario(name, true);
+        } else if (headerName(line, "Scenario:", name) || headerName(line, "Example:", name)) {
+            beginScenario(name, false);
+        } else if (headerName(line, "Examples:", name) || headerName(line, "Scenarios:", name)) {
+            if (!hasScenario) {
+                fail("Examples must belong to a Scenario Outline");
+            }
+            scenario.examples.emplace_back();
+            scenario.examples.back().tags = takeTags();
+            section = EXAMPLES;
+            steps = nullptr;
+        } else if (!parseStep(line)) {
+            parseDescription(line);
+        }
+    }
+
+    void parseTags(std::string_view line) {
+        while (!line.empty()) {
+            std::size_t end = 0;
+            while (end < line.size() && !isSpace(line[end])) {
+                ++end;
+            }
+            const std::string_view tag = line.substr(0, end);
+            if (tag.front() == '#') {
+                break;
+            }
+            if (tag.front() != '@' || tag.size() == 1) {
+                fail("Invalid tag: " + std::string(tag));
+            }
+            pendingTags.emplace_back(tag.substr(1));
+            line = trim(line.substr(end));
+        }
+    }
+
+    void parseTableRow(const std::string_view rawLine, const std::string_view line) {
+        requireNoPendingTags();
+        if (!isTableRow(line)) {
+            fail("A table row must end with '|'");
+        }
+
+        if (section == EXAMPLES) {
+            ExamplesBlock& examples = scenario.examples.back();
+            row_type row = splitRow(line);
+            if (!examples.hasHeader) {
+                examples.header = std::move(row);
+                examples.headerSource = line;
+                examples.hasHeader = true;
+                return;
+            }
+            if (row.size() != examples.header.size()) {
+                fail("Inconsistent cell count within the table");
+            }
+            examples.rows.push_back(std::move(row));
+            examples.rowSources.push_back(line);
+            examples.rowLines.push_back(lineNumber);
+            return;
+        }
+
+        if (steps == nullptr || steps->empty()) {
+            fail("A table must follow a step or Examples");
+        }
+        // Step tables are only checked here, and decoded when the step runs
+        RawStepArgument& argument = steps->back().rawArgument;
+        const std::size_t columns = countCells(line);
+        if (argument.kind == RawStepArgument::NONE) {
+            argument.kind = RawStepArgument::DATA_TABLE;
+            argument.lines = rawLine.substr(0, 0);
+            tableColumns = columns;
+        } else if (argument.kind != RawStepArgument::DATA_TABLE) {
+            fail("A step can have only one doc string or table");
+        } else if (columns != tableColumns) {
+            fail("Inconsistent cell count within the table");
+        }
+        extendToCurrentLine(argument.lines);
+    }
+
+    void parseDocString(const std::string_view rawLine, const std::string_view line) {
+        requireNoPendingTags();
+        if (steps == nullptr || steps->empty()) {
+            fail("A doc string must follow a step");
+        }
+        PickledStep& step = steps->back();
+        if (step.rawArgument.kind != RawStepArgument::NONE) {
+            fail("A step can have only one doc string or table");
+        }
+        const std::string_view delimiter = line.substr(0, 3);
+        const std::size_t openingLine = lineNumber;
+        const char* const begin = source.data() + std::min(pos, source.size());
+
+        std::string_view contentLine;
+        while (nextLine(contentLine)) {
+            if (trim(contentLine) == delimiter) {
+                step.hasDocString = true;
+                step.rawArgument.kind = RawStepArgument::DOC_STRING;
+                step.rawArgument.lines = std::string_view(begin, contentLine.data() - begin);
+                step.rawArgument.delimiter = delimiter[0];
+                step.rawArgument.indent = rawLine.find(delimiter);
+                return;
+            }
+        }
+        lineNumber = openingLine;
+        fail("Unterminated doc string");
+    }
+
+    /**
+     * Makes the lines end after the line last read
+     */
+    void extendToCurrentLine(std::string_view& lines) const {
+        const char* const end = source.data() + std::min(pos, source.size());
+        lines = std::string_view(lines.data(), end - lines.data());
+    }
+
+    bool parseStep(const std::string_view line) {
+        static const char* const keywords[] = {"Given ", "When ", "Then ", "And ", "But ", "* "};
+        for (const char* const keyword : keywords) {
+            if (!startsWith(line, keyword)) {
+                continue;
+            }
+            requireNoPendingTags();
+            if (steps == nullptr) {
+                fail("Steps must belong to a Scenario or Background");
+            }
+            const std::string_view primary = trim(keyword);
+            if (primary == "Given" || primary == "When" || primary == "Then") {
+                lastKeyword = std::string(primary);
+            } else if (steps->empty()) {
+                lastKeyword = "Given";
+            }
+            PickledStep step;
+            step.keyword = lastKeyword;
+            step.text = std::string(trim(line.substr(std::char_traits<char>::length(keyword))));
+            steps->push_back(std::move(step));
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Free text is allowed below a header, before its steps or rows
+     */
+    void parseDescription(const std::string_view line) {
+        requireNoPendingTags();
+        const bool belowHeader = section == FEATURE
+                                 || ((section == BACKGROUND || section == SCENARIO)
+                                     && steps->empty())
+                                 || (section == EXAMPLES && !scenario.examples.back().hasHeader);
+        if (!belowHeader) {
+            fail("Unexpected line: " + std::string(line));
+        }
+    }
+
+    void beginScenario(const std::string& name, const bool outline) {
+        requireFeature();
+        finishScenario();
+        scenario = ScenarioDefinition();
+        scenario.name = name;
+        scenario.line = lineNumber;
+        scenario.outline = outline;
+        scenario.tags = takeTags();
+        hasScenario = true;
+        steps = &scenario.steps;
+        lastKeyword = "Given";
+        section = SCENARIO;
+    }
+
+    void finishScenario() {
+        if (!hasScenario) {
+            return;
+        }
+        hasScenario = false;
+
+        tags_type tags = featureTags;
+        steps_type background = featureBackground;
+        if (inRule) {
+            tags.insert(tags.end(), ruleTags.begin(), ruleTags.end());
+            background.insert(background.end(), ruleBackground.begin(), ruleBackground.end());
+        }
+        tags.insert(tags.end(), scenario.tags.begin(), scenario.tags.end());
+
+        // An outline without examples has nothing to run
+        if (scenario.examples.empty() && !scenario.outline) {
+            PickledScenario& pickle = addPickle(scenario.name, scenario.line, tags);
+            pickle.steps = background;
+            pickle.backgroundSteps = background.size();
+            pickle.steps.insert(pickle.steps.end(), scenario.steps.begin(), scenario.steps.end());
+        }
+        for (const ExamplesBlock& examples : scenario.examples) {
+            for (std::size_t i = 0; i < examples.rows.size(); ++i) {
+                const row_type& row = examples.rows[i];
+                PickledScenario& pickle = addPickle(
+                    substitute(scenario.name, examples.header, row), examples.rowLines[i], tags
+                );
+                pickle.tags.insert(pickle.tags.end(), examples.tags.begin(), examples.tags.end());
+                pickle.steps = background;
+                pickle.backgroundSteps = background.size();
+                for (const PickledStep& step : scenario.steps) {
+                    pickle.steps.push_back(substitute(
+                        step, examples.header, row, examples.headerSource, examples.rowSources[i]
+                    ));
+                }
+            }
+        }
+    }
+
+    PickledScenario& addPickle(std::string name, const std::size_t line, const tags_type& tags) {
+        pickles.emplace_back();
+        PickledScenario& pickle = pickles.back();
+        pickle.name = std::move(name);
+        pickle.location = uri + ":" + std::to_string(line);
+        pickle.tags = tags;
+        pickle.source = featureSource;
+        return pickle;
+    }
+
+    tags_type takeTags() {
+        tags_type tags;
+        tags.swap(pendingTags);
+        return tags;
+    }
+
+    void requireFeature() const {
+        if (section == NONE) {
+            fail("Expected a Feature");
+        }
+    }
+
+    void requireNoPendingTags() const {
+        if (!pendingTags.empty()) {
+            fail("Tags must precede a Feature, Rule, Scenario or Examples");
+        }
+    }
+
+    const std::shared_ptr<const FeatureSource> featureSource;
+    const std::string_view source;
+    const std::string& uri;
+    FeatureParser::pickles_type& pickles;
+
+    std::size_t pos = 0;
+    std::size_t lineNumber = 0;
+    Section section = NONE;
+    tags_type pendingTags;
+    tags_type featureTags;
+    tags_type ruleTags;
+    bool inRule = false;
+    steps_type featureBackground;
+    steps_type ruleBackground;
+    ScenarioDefinition scenario;
+    bool hasScenario = false;
+    // Where steps go, null outside of scenarios and backgrounds
+    steps_type* steps = nullptr;
+    std::string lastKeyword;
+    // Cell count of the step table being read
+    std::size_t tableColumns = 0;
+};
+
+}
+
+FeatureParseException::FeatureParseException(
+    const std::string& uri, std::size_t line, const std::string& message
+) :
+    std::runtime_error(
+        (line != 0 ? uri + ":" + std::to_string(line) : uri) + ": " + message
+    ),
+    uri(uri),
+    line(line) {
+}
+
+const std::string& FeatureParseException::getUri() const {
+    return uri;
+}
+
+std::size_t FeatureParseException::getLine() const {
+    return line;
+}
+
+std::string RawStepArgument::decodeDocString() const {
+    const char escapedDelimiter[] = {'\\', delimiter, '\\', delimiter, '\\', delimiter, '\0'};
+    std::string docString;
+    docString.reserve(lines.size());
+    bool first = true;
+    forEachLine(lines, [&](std::string_view line) {
+        // Strip the indentation of the opening delimiter, whitespace only
+        std::size_t strip = 0;
+        while (strip < indent && strip < line.size() && isSpace(line[strip])) {
+            ++strip;
+        }
+        line.remove_prefix(strip);
+        if (!first) {
+            docString += '\n';
+        }
+        first = false;
+        std::size_t start = 0;
+        std::size_t escape;
+        while ((escape = line.find(escapedDelimiter, start)) != std::string_view::npos) {
+            docString.append(line.substr(start, escape - start));
+            docString.append(3, delimiter);
+            start = escape + 6;
+        }
+        docString.append(line.substr(start));
+    });
+    if (exampleHeader.empty()) {
+        return docString;
+    }
+    return substitute(docString, splitRow(exampleHeader), splitRow(exampleRow));
+}
+
+CukeEngine::invoke_table_type RawStepArgument::decodeTable() const {
+    CukeEngine::invoke_table_type table;
+    const bool substituting = !exampleHeader.empty();
+    const row_type header = substituting ? splitRow(exampleHeader) : row_type();
+    const row_type row = substituting ? splitRow(exampleRow) : row_type();
+    forEachLine(lines, [&](const std::string_view rawLine) {
+        // Blank lines and comments may be interleaved with the rows
+        const std::string_view line = trim(rawLine);
+        if (!isTableRow(line)) {
+            return;
+        }
+        table.push_back(splitRow(line));
+        if (substituting) {
+            for (std::string& cell : table.back()) {
+                cell = substitute(cell, header, row);
+            }
+        }
+    });
+    return table;
+}
+
+FeatureParser::pickles_type FeatureParser::parse(std::string_view source, const std::string& uri)
+    const {
+    return parse(FeatureSource::fromString(std::string(source), uri));
+}
+
+FeatureParser::pickles_type FeatureParser::parse(const std::shared_ptr<const FeatureSource>& source
+) const {
+    pickles_type pickles;
+    Parser(source, pickles).parse();
+    return pickles;
+}
+
+FeatureParser::pickles_type FeatureParser::parseFile(const std::string& path) const {
+    return parse(FeatureSource::fromFile(path));
+}
+
+FeatureParser::pickles_type
+FeatureParser::parseFiles(const std::vector<std::string>& paths, std::size_t threads) const {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    ThreadPool pool(std::min(threads, std::max<std::size_t>(1, paths.size())));
+    std::vector<std::future<pickles_type>> parsed;
+    parsed.reserve(paths.size());
+    for (const std::string& path : paths) {
+        parsed.push_back(pool.submit([this, &path] {
+            return parseFile(path);
+        }));
+    }
+
+    pickles_type pickles;
+    for (std::future<pickles_type>& file : parsed) {
+        pickles_type filePickles = file.get();
+        std::move(filePickles.begin(), filePickles.end(), std::back_inserter(pickles));
+    }
+    return pickles;
+}
+
+}
+}
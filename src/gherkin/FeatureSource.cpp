@@ -0,0 +1,109 @@
+#include "cucumber-cpp/internal/gherkin/FeatureSource.hpp"
+#include "cucumber-cpp/internal/gherkin/FeatureParser.hpp"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #define CUKE_MAP_FEATURE_FILES 0
+    #include <fstream>
+    #include <sstream>
+#else
+    #define CUKE_MAP_FEATURE_FILES 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+
+class StringFeatureSource : public FeatureSource {
+public:
+    StringFeatureSource(std::string content, std::string uri) :
+        FeatureSource(std::move(uri)),
+        content(std::move(content)) {
+        text = this->content;
+    }
+
+private:
+    const std::string content;
+};
+
+#if CUKE_MAP_FEATURE_FILES
+class MappedFeatureSource : public FeatureSource {
+public:
+    explicit MappedFeatureSource(const std::string& path) :
+        FeatureSource(path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw FeatureParseException(path, 0, "Unable to read feature file");
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            ::close(fd);
+            throw FeatureParseException(path, 0, "Unable to read feature file");
+        }
+        size = static_cast<std::size_t>(status.st_size);
+        // Empty files cannot be mapped, and have nothing to view into
+        if (size != 0) {
+            mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            throw FeatureParseException(path, 0, "Unable to map feature file");
+        }
+        if (mapping != nullptr) {
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+            text = std::string_view(static_cast<const char*>(mapping), size);
+        }
+    }
+
+    ~MappedFeatureSource() override {
+        if (mapping != nullptr) {
+            ::munmap(mapping, size);
+        }
+    }
+
+private:
+    void* mapping = nullptr;
+    std::size_t size = 0;
+};
+#endif
+
+}
+
+FeatureSource::FeatureSource(std::string uri) :
+    uri(std::move(uri)) {
+}
+
+const std::string& FeatureSource::getUri() const {
+    return uri;
+}
+
+std::string_view FeatureSource::getText() const {
+    return text;
+}
+
+std::shared_ptr<const FeatureSource> FeatureSource::fromString(std::string text, std::string uri) {
+    return std::make_shared<StringFeatureSource>(std::move(text), std::move(uri));
+}
+
+std::shared_ptr<const FeatureSource> FeatureSource::fromFile(const std::string& path) {
+#if CUKE_MAP_FEATURE_FILES
+    return std::make_shared<MappedFeatureSource>(path);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw FeatureParseException(path, 0, "Unable to read feature file");
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    return fromString(content.str(), path);
+#endif
+}
+
+}
+}
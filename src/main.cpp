@@ -1,24 +1,172 @@
-#include <cucumber-cpp/internal/CukeEngineImpl.hpp>
+#include <cucumber-cpp/internal/ContextManager.hpp>
 #include <cucumber-cpp/internal/CukeExport.hpp>
+#include <cucumber-cpp/internal/DurationHistory.hpp>
+#include <cucumber-cpp/internal/StartupProfile.hpp>
+#include <cucumber-cpp/internal/Telemetry.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+#include <cucumber-cpp/internal/TraceRecorder.hpp>
+#include <cucumber-cpp/internal/connectors/wire/SharedMemoryServer.hpp>
+#include <cucumber-cpp/internal/connectors/wire/WireCoordinator.hpp>
 #include <cucumber-cpp/internal/connectors/wire/WireServer.hpp>
+#include <cucumber-cpp/internal/connectors/wire/WireSession.hpp>
 #include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+#include <cucumber-cpp/internal/connectors/wire/WireTranscript.hpp>
+#include <cucumber-cpp/internal/step/StepLibrary.hpp>
+#include <cucumber-cpp/internal/step/StepSnapshot.hpp>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <vector>
 #include <tclap/CmdLine.h>
 
 namespace {
 
+using namespace ::cucumber::internal;
+
+/**
+ * Connection to a worker listening on "host:port"
+ */
+class TCPWorkerConnection : public WireWorkerConnection {
+public:
+    explicit TCPWorkerConnection(const std::string& address) :
+        address(address) {
+        const std::string::size_type colon = address.rfind(':');
+        if (colon == std::string::npos) {
+            throw std::runtime_error("Worker address without port: " + address);
+        }
+        stream.connect(address.substr(0, colon), address.substr(colon + 1));
+        if (!stream) {
+            throw std::runtime_error("Unable to connect to worker " + address);
+        }
+    }
+
+    std::string request(const std::string& line) override {
+        std::string response;
+        if (!(stream << line << std::endl) || !std::getline(stream, response)) {
+            throw std::runtime_error("Lost connection to worker " + address);
+        }
+        return response;
+    }
+
+private:
+    const std::string address;
+    asio::ip::tcp::iostream stream;
+};
+
+/**
+ * Posts OTLP/HTTP JSON requests to a collector listening on "host:port"
+ */
+void postSpans(const std::string& address, const std::string& body) {
+    const std::string::size_type colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        throw std::runtime_error("OTLP endpoint without port: " + address);
+    }
+    const std::string host = address.substr(0, colon);
+    asio::ip::tcp::iostream stream(host, address.substr(colon + 1));
+    stream << "POST /v1/traces HTTP/1.1\r\n"
+           << "Host: " << host << "\r\n"
+           << "Content-Type: application/json\r\n"
+           << "Content-Length: " << body.size() << "\r\n"
+           << "Connection: close\r\n\r\n"
+           << body << std::flush;
+    std::string version;
+    int status = 0;
+    if (!(stream >> version >> status) || status < 200 || status >= 300) {
+        throw std::runtime_error("Spans refused by " + address);
+    }
+}
+
+/**
+ * Stops emitting spans before exporting the ones left
+ */
+void stopTelemetry(BatchSpanProcessor* processor) {
+    Telemetry::setProcessor(nullptr);
+    delete processor;
+}
+
 void acceptWireProtocol(
-    const std::string& host, int port, const std::string& unixPath, bool verbose
+    const std::string& host,
+    int port,
+    const std::string& unixPath,
+    const std::string& pipeName,
+    const std::string& shmName,
+    const std::string& tlsCertificate,
+    const std::string& tlsKey,
+    bool verbose,
+    bool multiSession,
+    bool async,
+    std::size_t forkedWorkers,
+    bool coalesceWrites,
+    bool pipelineRequests,
+    std::size_t maxFrameLength,
+    const cpu_list_type& executionCpus,
+    const cpu_list_type& ioCpus,
+    const std::string& recordPath,
+    const std::vector<std::string>& workers,
+    const std::string& historyPath,
+    bool dryRun
 ) {
-    using namespace ::cucumber::internal;
-    CukeEngineImpl cukeEngine;
-    JsonWireMessageCodec wireCodec;
-    WireProtocolHandler protocolHandler(wireCodec, cukeEngine);
+    std::ofstream record;
+    std::unique_ptr<DurationHistory> history;
+    if (!historyPath.empty()) {
+        history.reset(new DurationHistory(historyPath));
+        Timings::setDurationHistory(history.get());
+    }
+    std::unique_ptr<WireTranscriptWriter> transcript;
+    std::unique_ptr<WireCoordinator> coordinator;
+    SocketServer::session_factory_type newSession = [dryRun] {
+        return newWireSession(dryRun);
+    };
+    if (!workers.empty()) {
+        coordinator.reset(new WireCoordinator(workers, history.get()));
+        newSession = [&coordinator] {
+            return std::unique_ptr<const ProtocolHandler>(new CoordinatingProtocolHandler(
+                *coordinator,
+                [](const std::string& address) {
+                    return std::unique_ptr<WireWorkerConnection>(new TCPWorkerConnection(address));
+                }
+            ));
+        };
+    }
+    if (!recordPath.empty()) {
+        record.open(recordPath, std::ios::binary);
+        if (!record) {
+            throw std::runtime_error("Unable to write transcript " + recordPath);
+        }
+        transcript.reset(new WireTranscriptWriter(record));
+        newSession = [&transcript, recordedSession = newSession] {
+            return std::unique_ptr<const ProtocolHandler>(
+                new RecordingProtocolHandler(recordedSession(), *transcript)
+            );
+        };
+    }
+    const std::unique_ptr<const ProtocolHandler> protocolHandler = newSession();
+#if defined(__linux__)
+    if (!shmName.empty()) {
+        SharedMemoryServer shmServer(protocolHandler.get());
+        shmServer.listen(shmName);
+        if (maxFrameLength > 0) {
+            shmServer.setMaxMessageLength(maxFrameLength);
+        }
+        if (verbose)
+            std::clog << "Listening on shared memory " << shmServer.listenName() << std::endl;
+        // Clients take turns on a segment
+        if (async || multiSession) {
+            shmServer.acceptSessions(newSession);
+        } else {
+            shmServer.acceptOnce();
+        }
+        return;
+    }
+#else
+    static_cast<void>(shmName);
+#endif
     std::unique_ptr<SocketServer> server;
 #if defined(ASIO_HAS_LOCAL_SOCKETS)
     if (!unixPath.empty()) {
-        UnixSocketServer* const unixServer = new UnixSocketServer(&protocolHandler);
+        UnixSocketServer* const unixServer = new UnixSocketServer(protocolHandler.get());
         server.reset(unixServer);
         unixServer->listen(unixPath);
         if (verbose)
@@ -27,20 +175,87 @@ void acceptWireProtocol(
 #else
     // Prevent warning about unused parameter
     static_cast<void>(unixPath);
+#endif
+#if defined(ASIO_HAS_WINDOWS_STREAM_HANDLE)
+    if (!pipeName.empty()) {
+        NamedPipeServer* const pipeServer = new NamedPipeServer(protocolHandler.get());
+        server.reset(pipeServer);
+        pipeServer->listen(pipeName);
+        if (verbose)
+            std::clog << "Listening on named pipe " << pipeServer->listenName() << std::endl;
+    } else
+#else
+    static_cast<void>(pipeName);
+#endif
+#if defined(CUKE_ENABLE_TLS)
+    if (!tlsCertificate.empty()) {
+        TLSSocketServer* const tlsServer = new TLSSocketServer(
+            protocolHandler.get(), TLSSocketServer::makeContext(tlsCertificate, tlsKey)
+        );
+        server.reset(tlsServer);
+        tlsServer->listen(asio::ip::tcp::endpoint(asio::ip::make_address(host), port));
+        if (verbose)
+            std::clog << "Listening with TLS on " << tlsServer->listenEndpoint() << std::endl;
+    } else
+#else
+    static_cast<void>(tlsCertificate);
+    static_cast<void>(tlsKey);
 #endif
     {
-        TCPSocketServer* const tcpServer = new TCPSocketServer(&protocolHandler);
+        TCPSocketServer* const tcpServer = new TCPSocketServer(protocolHandler.get());
         server.reset(tcpServer);
         tcpServer->listen(asio::ip::tcp::endpoint(asio::ip::make_address(host), port));
         if (verbose)
             std::clog << "Listening on " << tcpServer->listenEndpoint() << std::endl;
     }
-    server->acceptOnce();
+    server->setWriteCoalescing(coalesceWrites);
+    server->setRequestPipelining(pipelineRequests);
+    if (maxFrameLength > 0) {
+        server->setMaxFrameLength(maxFrameLength);
+    }
+    if (verbose) {
+        server->setErrorLog(&std::clog);
+    }
+    server->setExecutionCpus(executionCpus);
+    server->setIoCpus(ioCpus);
+#if !defined(_WIN32)
+    if (forkedWorkers > 0) {
+        server->acceptForked(newSession, forkedWorkers);
+        return;
+    }
+#else
+    static_cast<void>(forkedWorkers);
+#endif
+    if (async) {
+        server->serveAsync(newSession);
+    } else if (multiSession) {
+        server->acceptSessions(newSession);
+    } else {
+        server->acceptOnce();
+    }
+}
+
+int replayWireTranscript(const std::string& replayPath) {
+    std::ifstream transcript(replayPath, std::ios::binary);
+    if (!transcript) {
+        throw std::runtime_error("Unable to read transcript " + replayPath);
+    }
+    const WireTranscriptReplayer replayer([] {
+        return newWireSession(false);
+    });
+    const WireTranscriptReplayer::Result result = replayer.replay(transcript, &std::clog);
+    std::clog << result.requests << " requests replayed in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(result.elapsed).count()
+              << " us, " << result.mismatches << " responses differ from the transcript"
+              << std::endl;
+    return result.mismatches == 0 ? 0 : 1;
 }
 
 }
 
 int CUCUMBER_CPP_EXPORT main(int argc, char** argv) {
+    // Step definitions registered in static initializers, before main
+    StartupProfile::finish();
     TCLAP::CmdLine cmd("C++ Cucumber wireserver", ' ', CUKE_VERSION);
 
     TCLAP::SwitchArg verboseArg("v", "verbose", "Verbose output", cmd, false);
@@ -57,6 +272,211 @@ int CUCUMBER_CPP_EXPORT main(int argc, char** argv) {
         "int"
     );
     cmd.add(portArg);
+    TCLAP::SwitchArg multiSessionArg(
+        "m",
+        "multi-session",
+        "Keep accepting connections, serving concurrent sessions until terminated",
+        cmd,
+        false
+    );
+    TCLAP::SwitchArg asyncArg(
+        "a",
+        "async",
+        "Like --multi-session, but multiplex all connections on a single thread",
+        cmd,
+        false
+    );
+#if !defined(_WIN32)
+    TCLAP::ValueArg<int> forkArg(
+        "",
+        "fork",
+        "Fork this many worker processes once the step definitions are registered, each serving "
+        "one session at a time in isolation from the others",
+        false,
+        0,
+        "int"
+    );
+    cmd.add(forkArg);
+#endif
+    TCLAP::SwitchArg coalesceWritesArg(
+        "c",
+        "coalesce-writes",
+        "Write the responses to pipelined requests together instead of one by one",
+        cmd,
+        false
+    );
+    TCLAP::SwitchArg pipelineArg(
+        "",
+        "pipeline",
+        "Read and decode the next requests while a step runs",
+        cmd,
+        false
+    );
+    TCLAP::ValueArg<int> maxFrameArg(
+        "",
+        "max-frame",
+        "Close the connections announcing binary frames, or shared memory requests, longer than "
+        "this many megabytes (default 16)",
+        false,
+        0,
+        "megabytes"
+    );
+    cmd.add(maxFrameArg);
+    TCLAP::ValueArg<std::string> cpusArg(
+        "",
+        "cpus",
+        "Pin the threads running steps, or forked workers, to the cpus of the list in turn, as "
+        "0-3,8",
+        false,
+        "",
+        "list"
+    );
+    cmd.add(cpusArg);
+    TCLAP::ValueArg<std::string> ioCpusArg(
+        "",
+        "io-cpus",
+        "With --pipeline, pin the threads reading and writing the sessions to the cpus of the list "
+        "in turn",
+        false,
+        "",
+        "list"
+    );
+    cmd.add(ioCpusArg);
+    TCLAP::ValueArg<std::string> recordArg(
+        "",
+        "record",
+        "Record the requests and responses of every session, with timestamps, to a transcript",
+        false,
+        "",
+        "file"
+    );
+    cmd.add(recordArg);
+    TCLAP::ValueArg<std::string> replayArg(
+        "",
+        "replay",
+        "Replay the requests of a transcript without listening, and compare the responses",
+        false,
+        "",
+        "file"
+    );
+    cmd.add(replayArg);
+    TCLAP::MultiArg<std::string> workerArg(
+        "",
+        "worker",
+        "Coordinate workers instead of running steps: give each scenario to the worker, a "
+        "wireserver with --multi-session, expected to be done first (repeatable)",
+        false,
+        "host:port"
+    );
+    cmd.add(workerArg);
+    TCLAP::ValueArg<std::string> historyArg(
+        "",
+        "history",
+        "Durations of step definitions, and of scenarios when coordinating, learned from and "
+        "added to",
+        false,
+        "",
+        "file"
+    );
+    cmd.add(historyArg);
+    TCLAP::MultiArg<std::string> loadArg(
+        "",
+        "load",
+        "Shared library of step definitions to load before serving (repeatable)",
+        false,
+        "library"
+    );
+    cmd.add(loadArg);
+    TCLAP::SwitchArg allowLoadLibraryArg(
+        "",
+        "allow-load-library",
+        "Let clients load shared libraries of step definitions with load_library requests, "
+        "between scenarios. Any client can then load any library the server can read.",
+        cmd,
+        false
+    );
+    TCLAP::SwitchArg dryRunArg(
+        "",
+        "dry-run",
+        "Only match steps: begin and end no scenario, run no hook and invoke no step",
+        cmd,
+        false
+    );
+    TCLAP::SwitchArg firstMatchArg(
+        "",
+        "first-match",
+        "Match no step definition past the first one matching a step, unless some were found "
+        "ambiguous",
+        cmd,
+        false
+    );
+    TCLAP::ValueArg<int> backgroundTeardownArg(
+        "",
+        "background-teardown",
+        "Destroy the contexts of ended scenarios on a thread of their own, holding up scenarios "
+        "only while more than this many megabytes of them are still to be destroyed",
+        false,
+        0,
+        "megabytes"
+    );
+    cmd.add(backgroundTeardownArg);
+    TCLAP::SwitchArg timingsArg(
+        "",
+        "timings",
+        "Report latency percentiles of every step definition once the AfterAll hooks ran",
+        cmd,
+        false
+    );
+    TCLAP::SwitchArg statsArg(
+        "",
+        "stats",
+        "Record the latencies stats requests report, as --timings does without reporting them",
+        cmd,
+        false
+    );
+    TCLAP::SwitchArg allocationsArg(
+        "",
+        "allocations",
+        "Count the allocations of every scenario and step definition as well, reported with the "
+        "timings, if the step definitions use CUKE_TRACK_ALLOCATIONS()",
+        cmd,
+        false
+    );
+    TCLAP::SwitchArg perfCountersArg(
+        "",
+        "perf-counters",
+        "Count the cycles, instructions, cache misses and branch misses of every step definition "
+        "as well, reported with the timings, on Linux",
+        cmd,
+        false
+    );
+    TCLAP::ValueArg<std::string> traceArg(
+        "",
+        "trace",
+        "Write a timeline of the scenarios, hooks and steps of every session to a file once the "
+        "AfterAll hooks ran, in the Chrome Trace Event format",
+        false,
+        "",
+        "file"
+    );
+    cmd.add(traceArg);
+    TCLAP::ValueArg<std::string> otlpArg(
+        "",
+        "otlp-endpoint",
+        "Export a span for every scenario and step to the OpenTelemetry collector listening on "
+        "host:port for OTLP/HTTP, continuing the traces of begin_scenario traceparents",
+        false,
+        "",
+        "address"
+    );
+    cmd.add(otlpArg);
+    TCLAP::SwitchArg startupReportArg(
+        "",
+        "startup-report",
+        "Report the slowest step registrations, expression transforms and regex compilations",
+        cmd,
+        false
+    );
 
 #if defined(ASIO_HAS_LOCAL_SOCKETS)
     TCLAP::ValueArg<std::string> unixArg(
@@ -69,6 +489,50 @@ int CUCUMBER_CPP_EXPORT main(int argc, char** argv) {
     );
     cmd.add(unixArg);
 #endif
+#if defined(ASIO_HAS_WINDOWS_STREAM_HANDLE)
+    TCLAP::ValueArg<std::string> pipeArg(
+        "",
+        "pipe",
+        "Named pipe of wireserver, like cucumber-cpp for \\\\.\\pipe\\cucumber-cpp, for a client "
+        "on the same host (disables listening on port)",
+        false,
+        "",
+        "string"
+    );
+    cmd.add(pipeArg);
+#endif
+#if defined(__linux__)
+    TCLAP::ValueArg<std::string> shmArg(
+        "",
+        "shm",
+        "Shared memory segment of wireserver, like /cucumber-cpp, for a client on the same host "
+        "(disables listening on port)",
+        false,
+        "",
+        "string"
+    );
+    cmd.add(shmArg);
+#endif
+#if defined(CUKE_ENABLE_TLS)
+    TCLAP::ValueArg<std::string> tlsCertArg(
+        "",
+        "tls-cert",
+        "Certificate chain of wireserver in PEM format, to serve TLS on the listening port",
+        false,
+        "",
+        "file"
+    );
+    cmd.add(tlsCertArg);
+    TCLAP::ValueArg<std::string> tlsKeyArg(
+        "",
+        "tls-key",
+        "Private key of wireserver in PEM format, if not in the --tls-cert file",
+        false,
+        "",
+        "file"
+    );
+    cmd.add(tlsKeyArg);
+#endif
 
     cmd.parse(argc, argv);
 
@@ -78,11 +542,144 @@ int CUCUMBER_CPP_EXPORT main(int argc, char** argv) {
 #if defined(ASIO_HAS_LOCAL_SOCKETS)
     unixPath = unixArg.getValue();
 #endif
+    std::string pipeName;
+#if defined(ASIO_HAS_WINDOWS_STREAM_HANDLE)
+    pipeName = pipeArg.getValue();
+#endif
+    std::string shmName;
+#if defined(__linux__)
+    shmName = shmArg.getValue();
+#endif
+    std::string tlsCertificate;
+    std::string tlsKey;
+#if defined(CUKE_ENABLE_TLS)
+    tlsCertificate = tlsCertArg.getValue();
+    tlsKey = tlsKeyArg.getValue().empty() ? tlsCertificate : tlsKeyArg.getValue();
+#endif
 
     bool verbose = verboseArg.getValue();
+    bool multiSession = multiSessionArg.getValue();
+    bool async = asyncArg.getValue();
+    std::size_t forkedWorkers = 0;
+#if !defined(_WIN32)
+    forkedWorkers = static_cast<std::size_t>(std::max(forkArg.getValue(), 0));
+#endif
+    bool coalesceWrites = coalesceWritesArg.getValue();
+    bool pipelineRequests = pipelineArg.getValue();
+    std::size_t maxFrameLength =
+        static_cast<std::size_t>(std::max(maxFrameArg.getValue(), 0)) * 1024 * 1024;
+    cpu_list_type executionCpus;
+    cpu_list_type ioCpus;
+    try {
+        if (!cpusArg.getValue().empty()) {
+            executionCpus = parseCpuList(cpusArg.getValue());
+        }
+        if (!ioCpusArg.getValue().empty()) {
+            ioCpus = parseCpuList(ioCpusArg.getValue());
+        }
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        exit(1);
+    }
+    if (backgroundTeardownArg.getValue() > 0) {
+        ContextArena::setBackgroundTeardown(
+            static_cast<std::size_t>(backgroundTeardownArg.getValue()) * 1024 * 1024
+        );
+    }
+    Timings::setEnabled(
+        timingsArg.getValue() || statsArg.getValue() || !historyArg.getValue().empty()
+    );
+    if (timingsArg.getValue()) {
+        Timings::setAfterAllReport(&std::clog);
+    }
+    // Exports the spans left once the sessions are over
+    std::unique_ptr<BatchSpanProcessor, void (*)(BatchSpanProcessor*)> spanProcessor(
+        nullptr, stopTelemetry
+    );
+    if (!otlpArg.getValue().empty()) {
+        const std::string endpoint = otlpArg.getValue();
+        spanProcessor.reset(new BatchSpanProcessor(std::make_unique<OtlpJsonExporter>(
+            [endpoint](const std::string& body) {
+                postSpans(endpoint, body);
+            }
+        )));
+        Telemetry::setProcessor(spanProcessor.get());
+    }
+    if (!traceArg.getValue().empty()) {
+        TraceRecorder::setEnabled(true);
+        TraceRecorder::setAfterAllFile(traceArg.getValue());
+    }
+    if (allocationsArg.getValue()) {
+        Timings::setAllocationTracking(true);
+        if (!AllocationTracking::isInstalled()) {
+            std::cerr << "Allocations are not counted without CUKE_TRACK_ALLOCATIONS()"
+                      << std::endl;
+        }
+    }
+    if (perfCountersArg.getValue()) {
+        Timings::setHardwareCounters(true);
+        if (!HardwareCounters::isAvailable()) {
+            std::cerr << "Hardware counters are not available, perf_event_open was refused"
+                      << std::endl;
+        }
+    }
+    StepLibraries::setLoadableByClients(allowLoadLibraryArg.getValue());
+    for (const std::string& library : loadArg.getValue()) {
+        try {
+            const std::size_t steps = StepLibraries::load(library);
+            if (verbose) {
+                std::clog << "Loaded " << steps << " steps from " << library << std::endl;
+            }
+        } catch (std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            exit(1);
+        }
+    }
+    if (startupReportArg.getValue()) {
+        StartupProfile::report(std::clog);
+    }
+    try {
+        if (StepSnapshot::refresh() && verbose) {
+            std::clog << "Step snapshot written" << std::endl;
+        }
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    }
+    StepManager::reportBacktrackingHazards(std::cerr);
+    if (StepManager::reportAmbiguousSteps(std::cerr)) {
+        if (firstMatchArg.getValue()) {
+            std::cerr << "Matching every step definition, some being ambiguous" << std::endl;
+        }
+    } else {
+        StepManager::setFirstMatchOnly(firstMatchArg.getValue());
+    }
 
     try {
-        acceptWireProtocol(listenHost, port, unixPath, verbose);
+        if (!replayArg.getValue().empty()) {
+            return replayWireTranscript(replayArg.getValue());
+        }
+        acceptWireProtocol(
+            listenHost,
+            port,
+            unixPath,
+            pipeName,
+            shmName,
+            tlsCertificate,
+            tlsKey,
+            verbose,
+            multiSession,
+            async,
+            forkedWorkers,
+            coalesceWrites,
+            pipelineRequests,
+            maxFrameLength,
+            executionCpus,
+            ioCpus,
+            recordArg.getValue(),
+            workerArg.getValue(),
+            historyArg.getValue(),
+            dryRunArg.getValue()
+        );
     } catch (std::exception& e) {
         std::cerr << e.what() << std::endl;
         exit(1);
@@ -0,0 +1,98 @@
+#include <cucumber-cpp/internal/utils/Regex.hpp>
+
+#include <boost/regex.hpp>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+boost::regex compile(const std::string& regularExpression) {
+    try {
+        return boost::regex(regularExpression, boost::regex::ECMAScript);
+    } catch (const boost::regex_error& e) {
+        throw RegexSyntaxError(e.what());
+    }
+}
+
+/**
+ * Boost gives up matching after a number of backtracking steps that grows
+ * with the input
+ */
+bool search(const std::string& expression, boost::smatch& matchResults, const boost::regex& regex) {
+    try {
+        return boost::regex_search(expression, matchResults, regex);
+    } catch (const boost::regex_error& e) {
+        if (e.code() == boost::regex_constants::error_complexity
+            || e.code() == boost::regex_constants::error_stack) {
+            throw RegexComplexityError(e.what());
+        }
+        throw;
+    }
+}
+}
+
+class RegexImpl {
+public:
+    RegexImpl(const std::string& regularExpression) :
+        regex(compile(regularExpression)) {
+    }
+
+    const boost::regex regex;
+};
+
+std::shared_ptr<const RegexImpl> Regex::compile(const std::string& regularExpression) {
+    return std::make_shared<const RegexImpl>(regularExpression);
+}
+
+FindRegexMatch::FindRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    boost::smatch matchResults;
+    regexMatched = search(expression, matchResults, regexImpl.regex);
+    if (regexMatched) {
+        // Skip capture group 0 which is the whole match, not a user marked sub-expression
+        for (std::size_t i = 1; i < matchResults.size(); ++i) {
+            if (matchResults[i].matched) {
+                addSubmatch(
+                    expression,
+                    matchResults.position(i),
+                    matchResults.position(i) + matchResults.length(i)
+                );
+            } else {
+                addUnmatchedSubmatch();
+            }
+        }
+    }
+}
+
+FindAllRegexMatch::FindAllRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    boost::sregex_token_iterator i(
+        expression.begin(), expression.end(), regexImpl.regex, 1, boost::match_continuous
+    );
+    const boost::sregex_token_iterator end;
+    for (; i != end; ++i) {
+        RegexSubmatch s = {*i, -1};
+        submatches.push_back(s);
+    }
+    regexMatched = !submatches.empty();
+}
+bool Regex::find(
+    const std::string& expression, std::vector<RegexSubmatchSpan>& submatches
+) const {
+    // Keeps its capacity between searches of a thread
+    thread_local boost::smatch matchResults;
+    submatches.clear();
+    if (!search(expression, matchResults, impl().regex)) {
+        return false;
+    }
+    for (std::size_t i = 1; i < matchResults.size(); ++i) {
+        if (matchResults[i].matched) {
+            const std::size_t begin = matchResults.position(i);
+            submatches.push_back({begin, begin + matchResults.length(i)});
+        } else {
+            submatches.push_back({std::string::npos, std::string::npos});
+        }
+    }
+    return true;
+}
+
+}
+}
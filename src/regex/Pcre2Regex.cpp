@@ -0,0 +1,182 @@
+#include <cucumber-cpp/internal/utils/Regex.hpp>
+
+#include <pcre2.h>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+pcre2_code* compile(const std::string& regularExpression) {
+    int errorCode;
+    PCRE2_SIZE errorOffset;
+    // ECMAScript only lets '$' match at the very end of the subject
+    pcre2_code* code = pcre2_compile(
+        reinterpret_cast<PCRE2_SPTR>(regularExpression.data()),
+        regularExpression.size(),
+        PCRE2_DOLLAR_ENDONLY,
+        &errorCode,
+        &errorOffset,
+        nullptr
+    );
+    if (code == nullptr) {
+        PCRE2_UCHAR message[256];
+        pcre2_get_error_message(errorCode, message, sizeof(message));
+        throw RegexSyntaxError(reinterpret_cast<const char*>(message));
+    }
+    // JIT support is optional: the interpreter is used when it is unavailable
+    pcre2_jit_compile(code, PCRE2_JIT_COMPLETE);
+    return code;
+}
+
+// Backtracking steps after which a match gives up, a tenth of the PCRE2 default
+const uint32_t MATCH_LIMIT = 1000000;
+
+pcre2_match_context* matchContext() {
+    static pcre2_match_context* const context = [] {
+        pcre2_match_context* created = pcre2_match_context_create(nullptr);
+        pcre2_set_match_limit(created, MATCH_LIMIT);
+        return created;
+    }();
+    return context;
+}
+
+bool isComplexityError(int rc) {
+    return rc == PCRE2_ERROR_MATCHLIMIT || rc == PCRE2_ERROR_DEPTHLIMIT
+           || rc == PCRE2_ERROR_HEAPLIMIT || rc == PCRE2_ERROR_JIT_STACKLIMIT;
+}
+}
+
+class RegexImpl {
+public:
+    RegexImpl(const std::string& regularExpression) :
+        code(compile(regularExpression)) {
+    }
+
+    ~RegexImpl() {
+        pcre2_code_free(code);
+    }
+
+    RegexImpl(const RegexImpl&) = delete;
+    RegexImpl& operator=(const RegexImpl&) = delete;
+
+    /**
+     * Matches at the given byte offset and returns the ovector, or nullptr
+     * if the expression did not match. The match data is owned by the caller.
+     *
+     * @throws RegexComplexityError if matching gave up
+     */
+    PCRE2_SIZE* match(
+        pcre2_match_data* matchData,
+        const std::string& subject,
+        PCRE2_SIZE offset,
+        uint32_t options
+    ) const {
+        const int rc = pcre2_match(
+            code,
+            reinterpret_cast<PCRE2_SPTR>(subject.data()),
+            subject.size(),
+            offset,
+            options,
+            matchData,
+            matchContext()
+        );
+        if (isComplexityError(rc)) {
+            PCRE2_UCHAR message[256];
+            pcre2_get_error_message(rc, message, sizeof(message));
+            throw RegexComplexityError(reinterpret_cast<const char*>(message));
+        }
+        return rc < 0 ? nullptr : pcre2_get_ovector_pointer(matchData);
+    }
+
+    pcre2_code* const code;
+};
+
+namespace {
+struct MatchData {
+    MatchData(const RegexImpl& regexImpl) :
+        data(pcre2_match_data_create_from_pattern(regexImpl.code, nullptr)) {
+    }
+
+    ~MatchData() {
+        pcre2_match_data_free(data);
+    }
+
+    MatchData(const MatchData&) = delete;
+    MatchData& operator=(const MatchData&) = delete;
+
+    pcre2_match_data* const data;
+};
+}
+
+std::shared_ptr<const RegexImpl> Regex::compile(const std::string& regularExpression) {
+    return std::make_shared<const RegexImpl>(regularExpression);
+}
+
+FindRegexMatch::FindRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    MatchData matchData(regexImpl);
+    const PCRE2_SIZE* ovector = regexImpl.match(matchData.data, expression, 0, 0);
+    regexMatched = ovector != nullptr;
+    if (regexMatched) {
+        uint32_t groups;
+        pcre2_pattern_info(regexImpl.code, PCRE2_INFO_CAPTURECOUNT, &groups);
+        // Skip capture group 0 which is the whole match, not a user marked sub-expression
+        for (uint32_t i = 1; i <= groups; ++i) {
+            if (ovector[2 * i] == PCRE2_UNSET) {
+                addUnmatchedSubmatch();
+            } else {
+                addSubmatch(expression, ovector[2 * i], ovector[2 * i + 1]);
+            }
+        }
+    }
+}
+
+FindAllRegexMatch::FindAllRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    MatchData matchData(regexImpl);
+    PCRE2_SIZE offset = 0;
+    while (offset < expression.size()) {
+        const PCRE2_SIZE* ovector =
+            regexImpl.match(matchData.data, expression, offset, PCRE2_ANCHORED);
+        if (ovector == nullptr || ovector[1] == offset) {
+            break;
+        }
+        const std::string token = ovector[2] == PCRE2_UNSET
+                                      ? std::string()
+                                      : expression.substr(ovector[2], ovector[3] - ovector[2]);
+        RegexSubmatch s = {token, -1};
+        submatches.push_back(s);
+        offset = ovector[1];
+    }
+    regexMatched = !submatches.empty();
+}
+bool Regex::find(
+    const std::string& expression, std::vector<RegexSubmatchSpan>& submatches
+) const {
+    const RegexImpl& regexImpl = impl();
+    uint32_t groups;
+    pcre2_pattern_info(regexImpl.code, PCRE2_INFO_CAPTURECOUNT, &groups);
+
+    // Shared by all expressions searched on a thread, grown when too small
+    thread_local std::unique_ptr<pcre2_match_data, void (*)(pcre2_match_data*)> matchData(
+        nullptr, &pcre2_match_data_free
+    );
+    if (!matchData || pcre2_get_ovector_count(matchData.get()) <= groups) {
+        matchData.reset(pcre2_match_data_create(groups + 1, nullptr));
+    }
+
+    submatches.clear();
+    const PCRE2_SIZE* ovector = regexImpl.match(matchData.get(), expression, 0, 0);
+    if (ovector == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 1; i <= groups; ++i) {
+        if (ovector[2 * i] == PCRE2_UNSET) {
+            submatches.push_back({std::string::npos, std::string::npos});
+        } else {
+            submatches.push_back({ovector[2 * i], ovector[2 * i + 1]});
+        }
+    }
+    return true;
+}
+
+}
+}
@@ -0,0 +1,176 @@
+#include <cucumber-cpp/internal/utils/Regex.hpp>
+
+#include <re2/re2.h>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+RE2::Options re2Options() {
+    RE2::Options options;
+    // Byte semantics keep submatch offsets identical to the std backend
+    options.set_encoding(RE2::Options::EncodingLatin1);
+    options.set_log_errors(false);
+    return options;
+}
+
+std::regex compileFallback(const std::string& regularExpression) {
+#ifdef __GLIBCXX__
+    // libstdc++ matches in polynomial time when asked to, keeping the
+    // submatches ECMAScript picks, but without backreferences
+    if (!backtrackingHazard(regularExpression).empty()) {
+        try {
+            return std::regex(
+                regularExpression, std::regex::ECMAScript | std::regex_constants::__polynomial
+            );
+        } catch (const std::regex_error&) {
+        }
+    }
+#endif
+    return std::regex(regularExpression);
+}
+}
+
+/**
+ * RE2 does not support lookaround or backreferences. Expressions using them
+ * are compiled with std::regex instead so every step definition keeps working.
+ */
+class RegexImpl {
+public:
+    RegexImpl(const std::string& regularExpression) :
+        re2(new RE2(regularExpression, re2Options())) {
+        if (!re2->ok()) {
+            re2.reset();
+            try {
+                fallback.reset(new std::regex(compileFallback(regularExpression)));
+            } catch (const std::regex_error& e) {
+                throw RegexSyntaxError(e.what());
+            }
+        }
+    }
+
+    std::unique_ptr<RE2> re2;
+    std::unique_ptr<std::regex> fallback;
+};
+
+std::shared_ptr<const RegexImpl> Regex::compile(const std::string& regularExpression) {
+    return std::make_shared<const RegexImpl>(regularExpression);
+}
+
+FindRegexMatch::FindRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    if (regexImpl.fallback) {
+        std::smatch matchResults;
+        regexMatched = std::regex_search(expression, matchResults, *regexImpl.fallback);
+        for (std::size_t i = 1; regexMatched && i < matchResults.size(); ++i) {
+            if (matchResults[i].matched) {
+                addSubmatch(
+                    expression,
+                    matchResults.position(i),
+                    matchResults.position(i) + matchResults.length(i)
+                );
+            } else {
+                addUnmatchedSubmatch();
+            }
+        }
+        return;
+    }
+
+    const RE2& re2 = *regexImpl.re2;
+    // Group 0 is the whole match, not a user marked sub-expression
+    std::vector<re2::StringPiece> groups(re2.NumberOfCapturingGroups() + 1);
+    regexMatched = re2.Match(
+        expression, 0, expression.size(), RE2::UNANCHORED, groups.data(), groups.size()
+    );
+    for (std::size_t i = 1; regexMatched && i < groups.size(); ++i) {
+        if (groups[i].data() == nullptr) {
+            addUnmatchedSubmatch();
+        } else {
+            const std::size_t begin = groups[i].data() - expression.data();
+            addSubmatch(expression, begin, begin + groups[i].size());
+        }
+    }
+}
+
+FindAllRegexMatch::FindAllRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    if (regexImpl.fallback) {
+        std::sregex_token_iterator i(
+            expression.begin(),
+            expression.end(),
+            *regexImpl.fallback,
+            1,
+            std::regex_constants::match_continuous
+        );
+        const std::sregex_token_iterator end;
+        for (; i != end; ++i) {
+            RegexSubmatch s = {*i, -1};
+            submatches.push_back(s);
+        }
+        regexMatched = !submatches.empty();
+        return;
+    }
+
+    const RE2& re2 = *regexImpl.re2;
+    std::vector<re2::StringPiece> groups(std::max(re2.NumberOfCapturingGroups() + 1, 2));
+    std::size_t offset = 0;
+    while (offset < expression.size()
+           && re2.Match(
+               expression,
+               offset,
+               expression.size(),
+               RE2::ANCHOR_START,
+               groups.data(),
+               groups.size()
+           )) {
+        const std::size_t end = groups[0].data() - expression.data() + groups[0].size();
+        if (end == offset) {
+            break;
+        }
+        RegexSubmatch s = {std::string(groups[1].data(), groups[1].size()), -1};
+        submatches.push_back(s);
+        offset = end;
+    }
+    regexMatched = !submatches.empty();
+}
+bool Regex::find(
+    const std::string& expression, std::vector<RegexSubmatchSpan>& submatches
+) const {
+    const RegexImpl& regexImpl = impl();
+    submatches.clear();
+    if (regexImpl.fallback) {
+        thread_local std::smatch matchResults;
+        if (!std::regex_search(expression, matchResults, *regexImpl.fallback)) {
+            return false;
+        }
+        for (std::size_t i = 1; i < matchResults.size(); ++i) {
+            if (matchResults[i].matched) {
+                const std::size_t begin = matchResults.position(i);
+                submatches.push_back({begin, begin + matchResults.length(i)});
+            } else {
+                submatches.push_back({std::string::npos, std::string::npos});
+            }
+        }
+        return true;
+    }
+
+    const RE2& re2 = *regexImpl.re2;
+    // Keeps its capacity between searches of a thread
+    thread_local std::vector<re2::StringPiece> groups;
+    groups.resize(re2.NumberOfCapturingGroups() + 1);
+    if (!re2.Match(
+            expression, 0, expression.size(), RE2::UNANCHORED, groups.data(), groups.size()
+        )) {
+        return false;
+    }
+    for (std::size_t i = 1; i < groups.size(); ++i) {
+        if (groups[i].data() == nullptr) {
+            submatches.push_back({std::string::npos, std::string::npos});
+        } else {
+            const std::size_t begin = groups[i].data() - expression.data();
+            submatches.push_back({begin, begin + groups[i].size()});
+        }
+    }
+    return true;
+}
+
+}
+}
@@ -0,0 +1,92 @@
+#include <cucumber-cpp/internal/utils/Regex.hpp>
+
+namespace cucumber {
+namespace internal {
+
+namespace {
+std::regex compile(const std::string& regularExpression) {
+#ifdef __GLIBCXX__
+    // libstdc++ matches in polynomial time when asked to, keeping the
+    // submatches ECMAScript picks, but without backreferences
+    if (!backtrackingHazard(regularExpression).empty()) {
+        try {
+            return std::regex(
+                regularExpression, std::regex::ECMAScript | std::regex_constants::__polynomial
+            );
+        } catch (const std::regex_error&) {
+        }
+    }
+#endif
+    return std::regex(regularExpression);
+}
+}
+
+class RegexImpl {
+public:
+    RegexImpl(const std::string& regularExpression) :
+        regex(compile(regularExpression)) {
+    }
+
+    const std::regex regex;
+};
+
+std::shared_ptr<const RegexImpl> Regex::compile(const std::string& regularExpression) {
+    return std::make_shared<const RegexImpl>(regularExpression);
+}
+
+FindRegexMatch::FindRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    std::smatch matchResults;
+    regexMatched = std::regex_search(expression, matchResults, regexImpl.regex);
+    if (regexMatched) {
+        // Skip capture group 0 which is the whole match, not a user marked sub-expression
+        for (std::size_t i = 1; i < matchResults.size(); ++i) {
+            if (matchResults[i].matched) {
+                addSubmatch(
+                    expression,
+                    matchResults.position(i),
+                    matchResults.position(i) + matchResults.length(i)
+                );
+            } else {
+                addUnmatchedSubmatch();
+            }
+        }
+    }
+}
+
+FindAllRegexMatch::FindAllRegexMatch(const RegexImpl& regexImpl, const std::string& expression) {
+    std::sregex_token_iterator i(
+        expression.begin(),
+        expression.end(),
+        regexImpl.regex,
+        1,
+        std::regex_constants::match_continuous
+    );
+    const std::sregex_token_iterator end;
+    for (; i != end; ++i) {
+        RegexSubmatch s = {*i, -1};
+        submatches.push_back(s);
+    }
+    regexMatched = !submatches.empty();
+}
+bool Regex::find(
+    const std::string& expression, std::vector<RegexSubmatchSpan>& submatches
+) const {
+    // Keeps its capacity between searches of a thread
+    thread_local std::smatch matchResults;
+    submatches.clear();
+    if (!std::regex_search(expression, matchResults, impl().regex)) {
+        return false;
+    }
+    for (std::size_t i = 1; i < matchResults.size(); ++i) {
+        if (matchResults[i].matched) {
+            const std::size_t begin = matchResults.position(i);
+            submatches.push_back({begin, begin + matchResults.length(i)});
+        } else {
+            submatches.push_back({std::string::npos, std::string::npos});
+        }
+    }
+    return true;
+}
+
+}
+}
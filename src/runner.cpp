@@ -0,0 +1,409 @@
+#include <cucumber-cpp/internal/CukeEngineImpl.hpp>
+#include <cucumber-cpp/internal/CukeExport.hpp>
+#include <cucumber-cpp/internal/ImpactRecord.hpp>
+#include <cucumber-cpp/internal/ScenarioRunner.hpp>
+#include <cucumber-cpp/internal/StartupProfile.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+#include <cucumber-cpp/internal/TraceRecorder.hpp>
+#include <cucumber-cpp/internal/gherkin/FeatureParser.hpp>
+#include <cucumber-cpp/internal/hook/Tag.hpp>
+#include <cucumber-cpp/internal/step/StepSnapshot.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace ::cucumber::internal;
+
+struct Options {
+    std::size_t jobs = 0;
+    std::string tags;
+    bool verbose = false;
+    bool timings = false;
+    bool allocations = false;
+    bool perfCounters = false;
+    bool dryRun = false;
+    bool firstMatch = false;
+    bool startupReport = false;
+    bool snapshotBackground = false;
+    cpu_list_type cpus;
+    std::string durations;
+    std::string trace;
+    std::string impact;
+    std::string changed;
+    ParallelScenarioRunner::FailFast failFast = ParallelScenarioRunner::RUN_ALL;
+    std::vector<std::string> paths;
+};
+
+void usage(std::ostream& out, const char* program) {
+    out << "Usage: " << program << " [options] <feature file or directory>...\n"
+        << "\n"
+        << "Runs Gherkin features in process against the linked step definitions.\n"
+        << "\n"
+        << "  -j, --jobs <n>      Scenarios run at once, 0 for one per hardware thread (default)\n"
+        << "  -t, --tags <expr>   Only run scenarios matching the tag expression\n"
+        << "  -v, --verbose       Report every scenario, not only those that did not pass\n"
+        << "      --dry-run       Only match the steps, running no hook and invoking no step\n"
+        << "      --first-match   Match no step definition past the first one matching a step,\n"
+        << "                      unless some were found ambiguous\n"
+        << "      --timings       Report latency percentiles of every step definition\n"
+        << "      --allocations   Report the allocations of scenarios and step definitions as\n"
+        << "                      well, counted by CUKE_TRACK_ALLOCATIONS() in the step binary\n"
+        << "      --perf-counters Report the cycles, instructions, cache misses and branch\n"
+        << "                      misses of step definitions as well, Linux only\n"
+        << "      --fail-fast     Skip the remaining scenarios once one did not pass\n"
+        << "      --fail-fast-tags\n"
+        << "                      Only skip those sharing a tag with it\n"
+        << "      --impact <file> Keep the step definitions every scenario invoked in the file\n"
+        << "      --changed <file>\n"
+        << "                      Only run the scenarios the changed files listed in the file,\n"
+        << "                      one per line, - for stdin, may affect according to --impact:\n"
+        << "                      those that failed, are new or use a changed file\n"
+        << "      --durations <file>\n"
+        << "                      Start the longest scenarios first, as they took in earlier\n"
+        << "                      runs, and keep how long they took in the file\n"
+        << "      --trace <file>  Write a timeline of the scenarios, hooks and steps of every\n"
+        << "                      job to the file, for chrome://tracing or Perfetto\n"
+        << "      --snapshot-background\n"
+        << "                      Run Background steps once per feature, later scenarios\n"
+        << "                      starting from copies of the contexts they left\n"
+        << "      --cpus <list>   Pin each job to a cpu of the list in turn, as 0-3,8\n"
+        << "      --startup-report\n"
+        << "                      Report the slowest step registrations before running\n"
+        << "  -h, --help          Show this help\n";
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if ((arg == "-j" || arg == "--jobs") && hasValue) {
+            char* end;
+            options.jobs = std::strtoul(argv[++i], &end, 10);
+            if (*end != '\0') {
+                std::cerr << "Invalid number of jobs: " << argv[i] << std::endl;
+                return false;
+            }
+        } else if ((arg == "-t" || arg == "--tags") && hasValue) {
+            options.tags = argv[++i];
+        } else if (arg == "-v" || arg == "--verbose") {
+            options.verbose = true;
+        } else if (arg == "--dry-run") {
+            options.dryRun = true;
+        } else if (arg == "--first-match") {
+            options.firstMatch = true;
+        } else if (arg == "--timings") {
+            options.timings = true;
+        } else if (arg == "--allocations") {
+            options.timings = true;
+            options.allocations = true;
+        } else if (arg == "--perf-counters") {
+            options.timings = true;
+            options.perfCounters = true;
+        } else if (arg == "--fail-fast") {
+            options.failFast = ParallelScenarioRunner::SKIP_ALL_AFTER_FAILURE;
+        } else if (arg == "--fail-fast-tags") {
+            options.failFast = ParallelScenarioRunner::SKIP_SHARED_TAGS_AFTER_FAILURE;
+        } else if (arg == "--impact" && hasValue) {
+            options.impact = argv[++i];
+        } else if (arg == "--changed" && hasValue) {
+            options.changed = argv[++i];
+        } else if (arg == "--durations" && hasValue) {
+            options.durations = argv[++i];
+        } else if (arg == "--trace" && hasValue) {
+            options.trace = argv[++i];
+        } else if (arg == "--snapshot-background") {
+            options.snapshotBackground = true;
+        } else if (arg == "--cpus" && hasValue) {
+            try {
+                options.cpus = parseCpuList(argv[++i]);
+            } catch (const std::invalid_argument& e) {
+                std::cerr << e.what() << std::endl;
+                return false;
+            }
+        } else if (arg == "--startup-report") {
+            options.startupReport = true;
+        } else if (arg == "-h" || arg == "--help") {
+            usage(std::cout, argv[0]);
+            std::exit(0);
+        } else if (!arg.empty() && arg.front() == '-') {
+            std::cerr << "Unknown or incomplete option: " << arg << std::endl;
+            return false;
+        } else {
+            options.paths.push_back(arg);
+        }
+    }
+    return !options.paths.empty();
+}
+
+/**
+ * Directories stand for the feature files below them, in path order
+ */
+std::vector<std::string> featureFiles(const std::vector<std::string>& paths) {
+    std::vector<std::string> files;
+    for (const std::string& path : paths) {
+        if (!std::filesystem::is_directory(path)) {
+            files.push_back(path);
+            continue;
+        }
+        std::vector<std::string> found;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".feature") {
+                found.push_back(entry.path().string());
+            }
+        }
+        std::sort(found.begin(), found.end());
+        files.insert(files.end(), found.begin(), found.end());
+    }
+    return files;
+}
+
+const char* statusName(const RunStatus status) {
+    switch (status) {
+    case RUN_PASSED:
+        return "passed";
+    case RUN_FAILED:
+        return "failed";
+    case RUN_PENDING:
+        return "pending";
+    case RUN_UNDEFINED:
+        return "undefined";
+    case RUN_AMBIGUOUS:
+        return "ambiguous";
+    case RUN_SKIPPED:
+        return "skipped";
+    }
+    return "unknown";
+}
+
+void printCounts(const char* what, std::size_t total, const std::vector<std::size_t>& counts) {
+    std::cout << total << " " << what;
+    const char* separator = " (";
+    for (std::size_t status = 0; status < counts.size(); ++status) {
+        if (counts[status] != 0) {
+            std::cout << separator << counts[status] << " "
+                      << statusName(static_cast<RunStatus>(status));
+            separator = ", ";
+        }
+    }
+    std::cout << (total != 0 ? ")" : "") << std::endl;
+}
+
+void printSnippets(
+    const ParallelScenarioRunner::scenarios_type& scenarios,
+    const ParallelScenarioRunner::results_type& results
+) {
+    std::vector<SnippetStep> undefinedSteps;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        for (std::size_t j = 0; j < results[i].steps.size(); ++j) {
+            if (results[i].steps[j].status != RUN_UNDEFINED) {
+                continue;
+            }
+            const PickledStep& step = scenarios[i].steps[j];
+            undefinedSteps.push_back(SnippetStep{
+                step.keyword,
+                step.text,
+                step.hasDocString ? "DocString" : (step.hasTable() ? "DataTable" : "")
+            });
+        }
+    }
+    if (undefinedSteps.empty()) {
+        return;
+    }
+    std::cout << "\nYou can implement undefined steps with these snippets:\n\n";
+    for (const std::string& snippet : CukeEngineImpl().snippetTexts(undefinedSteps)) {
+        std::cout << snippet << "\n";
+    }
+}
+
+/**
+ * One path per line, from stdin for "-"
+ */
+std::vector<std::string> readChangedFiles(const std::string& listPath) {
+    std::ifstream file;
+    if (listPath != "-") {
+        file.open(listPath);
+        if (!file) {
+            throw std::runtime_error("Unable to read changed files from " + listPath);
+        }
+    }
+    std::istream& in = listPath == "-" ? std::cin : file;
+    std::vector<std::string> changedFiles;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty()) {
+            changedFiles.push_back(line);
+        }
+    }
+    return changedFiles;
+}
+
+int runFeatures(const Options& options) {
+    ParallelScenarioRunner::scenarios_type scenarios =
+        FeatureParser().parseFiles(featureFiles(options.paths), options.jobs);
+    if (!options.tags.empty()) {
+        const BooleanTagExpression tagExpression(options.tags);
+        scenarios.erase(
+            std::remove_if(
+                scenarios.begin(),
+                scenarios.end(),
+                [&tagExpression](const PickledScenario& scenario) {
+                    return !tagExpression.matches(scenario.tags);
+                }
+            ),
+            scenarios.end()
+        );
+    }
+
+    ImpactRecord previousImpact;
+    if (!options.impact.empty()) {
+        std::ifstream in(options.impact);
+        if (in) {
+            previousImpact.load(in);
+        }
+    }
+    ParallelScenarioRunner::scenarios_type unaffected;
+    if (!options.changed.empty()) {
+        const std::vector<std::string> changedFiles = readChangedFiles(options.changed);
+        const ParallelScenarioRunner::scenarios_type::iterator firstUnaffected =
+            std::stable_partition(
+                scenarios.begin(),
+                scenarios.end(),
+                [&previousImpact, &changedFiles](const PickledScenario& scenario) {
+                    return previousImpact.affects(scenario, changedFiles);
+                }
+            );
+        unaffected.assign(
+            std::make_move_iterator(firstUnaffected), std::make_move_iterator(scenarios.end())
+        );
+        scenarios.erase(firstUnaffected, scenarios.end());
+    }
+
+    // Step durations come from the timings
+    Timings::setEnabled(options.timings || !options.durations.empty());
+    Timings::setAllocationTracking(options.allocations);
+    Timings::setHardwareCounters(options.perfCounters);
+    TraceRecorder::setEnabled(!options.trace.empty());
+    TraceRecorder::setAfterAllFile(options.trace);
+    if (options.allocations && !AllocationTracking::isInstalled()) {
+        std::cerr << "Allocations are not counted without CUKE_TRACK_ALLOCATIONS()" << std::endl;
+    }
+    if (options.perfCounters && !HardwareCounters::isAvailable()) {
+        std::cerr << "Hardware counters are not available, perf_event_open was refused"
+                  << std::endl;
+    }
+    ParallelScenarioRunner runner(options.jobs);
+    runner.setFailFast(options.failFast);
+    runner.setBackgroundSnapshots(options.snapshotBackground);
+    runner.setCpus(options.cpus);
+    if (options.dryRun) {
+        runner.setEngineFactory([] {
+            std::unique_ptr<CukeEngineImpl> engine(new CukeEngineImpl);
+            engine->setDryRun(true);
+            return std::unique_ptr<CukeEngine>(std::move(engine));
+        });
+    }
+    std::unique_ptr<DurationHistory> durations;
+    if (!options.durations.empty()) {
+        durations.reset(new DurationHistory(options.durations));
+        runner.setDurationHistory(durations.get());
+        Timings::setDurationHistory(durations.get());
+    }
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+    Timings::setDurationHistory(nullptr);
+
+    if (!options.impact.empty()) {
+        // Scenarios left out keep what they invoked when they last ran
+        ImpactRecord impact;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            impact.record(scenarios[i], results[i]);
+        }
+        for (const PickledScenario& scenario : unaffected) {
+            impact.keep(scenario, previousImpact);
+        }
+        std::ofstream out(options.impact, std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Unable to write impact record " + options.impact);
+        }
+        impact.save(out);
+    }
+
+    std::vector<std::size_t> scenarioCounts(RUN_SKIPPED + 1);
+    std::vector<std::size_t> stepCounts(RUN_SKIPPED + 1);
+    std::size_t steps = 0;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const ScenarioResult& result = results[i];
+        ++scenarioCounts[result.status];
+        for (const StepResult& step : result.steps) {
+            ++stepCounts[step.status];
+        }
+        steps += result.steps.size();
+        if (options.verbose || result.status != RUN_PASSED) {
+            std::cout << scenarios[i].location << " " << scenarios[i].name << ": "
+                      << statusName(result.status) << std::endl;
+            if (!result.message.empty()) {
+                std::cout << "  " << result.message << std::endl;
+            }
+        }
+    }
+    printSnippets(scenarios, results);
+    std::cout << std::endl;
+    if (!unaffected.empty()) {
+        std::cout << unaffected.size() << " scenarios left out, unaffected by the changes"
+                  << std::endl;
+    }
+    printCounts("scenarios", results.size(), scenarioCounts);
+    printCounts("steps", steps, stepCounts);
+    if (options.timings) {
+        std::cout << std::endl;
+        Timings::report(std::cout);
+    }
+
+    return scenarioCounts[RUN_PASSED] == results.size() ? 0 : 1;
+}
+
+}
+
+int CUCUMBER_CPP_EXPORT main(int argc, char** argv) {
+    StartupProfile::finish();
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage(std::cerr, argv[0]);
+        return 2;
+    }
+    if (options.startupReport) {
+        StartupProfile::report(std::cout);
+        std::cout << std::endl;
+    }
+    try {
+        StepSnapshot::refresh();
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    }
+    StepManager::reportBacktrackingHazards(std::cerr);
+    if (StepManager::reportAmbiguousSteps(std::cerr)) {
+        if (options.firstMatch) {
+            std::cerr << "Matching every step definition, some being ambiguous" << std::endl;
+        }
+    } else {
+        StepManager::setFirstMatchOnly(options.firstMatch);
+    }
+
+    try {
+        return runFeatures(options);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,107 @@
+#include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+
+#include <gmock/gmock.h>
+#include <nlohmann/json.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace cucumber::internal;
+using namespace testing;
+
+namespace {
+
+class MockCukeEngine : public CukeEngine {
+public:
+    MOCK_METHOD(std::vector<StepMatch>, stepMatches, (const std::string& name), (const, override));
+    MOCK_METHOD(void, endScenario, (const tags_type& tags), (override));
+    MOCK_METHOD(
+        void,
+        invokeStep,
+        (const std::string& id, const invoke_args_type& args, const invoke_table_type& tableArg),
+        (override)
+    );
+    MOCK_METHOD(void, beginScenario, (const tags_type& tags), (override));
+    MOCK_METHOD(
+        std::string,
+        snippetText,
+        (const std::string& keyword, const std::string& name, const std::string& multilineArgClass),
+        (const, override)
+    );
+};
+
+std::string randomBytes(std::size_t size) {
+    std::mt19937 random(42);
+    std::string bytes(size, '\0');
+    for (char& byte : bytes) {
+        byte = static_cast<char>(random());
+    }
+    return bytes;
+}
+}
+
+TEST(CompressingWireMessageCodecTest, leavesShortMessagesAsTheyAre) {
+    const std::string compressed = CompressingWireMessageCodec::compress("short");
+
+    EXPECT_EQ(std::string("\0short", 6), compressed);
+    EXPECT_EQ("short", CompressingWireMessageCodec::decompress(compressed));
+}
+
+TEST(CompressingWireMessageCodecTest, compressesLongMessages) {
+    const std::string message(10000, 'x');
+
+    const std::string compressed = CompressingWireMessageCodec::compress(message);
+
+    EXPECT_EQ('\1', compressed[0]);
+    EXPECT_LT(compressed.size(), 100);
+    EXPECT_EQ(message, CompressingWireMessageCodec::decompress(compressed));
+}
+
+TEST(CompressingWireMessageCodecTest, leavesIncompressibleMessagesAsTheyAre) {
+    const std::string message = randomBytes(10000);
+
+    const std::string compressed = CompressingWireMessageCodec::compress(message);
+
+    EXPECT_EQ('\0', compressed[0]);
+    EXPECT_EQ(message, CompressingWireMessageCodec::decompress(compressed));
+}
+
+TEST(CompressingWireMessageCodecTest, rejectsMalformedMessages) {
+    EXPECT_THROW(CompressingWireMessageCodec::decompress(""), WireMessageCodecException);
+    EXPECT_THROW(CompressingWireMessageCodec::decompress("\2x"), WireMessageCodecException);
+    EXPECT_THROW(
+        CompressingWireMessageCodec::decompress(std::string("\1garbage", 8)),
+        WireMessageCodecException
+    );
+    std::string truncated = CompressingWireMessageCodec::compress(std::string(10000, 'x'));
+    truncated.pop_back();
+    EXPECT_THROW(CompressingWireMessageCodec::decompress(truncated), WireMessageCodecException);
+}
+
+TEST(CompressingWireMessageCodecTest, isNegotiatedForMessagePack) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+    StepMatch match;
+    match.id = "1";
+    match.regexp = "^a step with a long regular expression$";
+    const std::vector<StepMatch> matches(100, match);
+    EXPECT_CALL(engine, stepMatches("x")).WillOnce(Return(matches));
+
+    EXPECT_EQ(
+        handler.handle(R"json(["negotiate_codec", {"codec": "msgpack+zstd"}])json"),
+        "[\"success\"]"
+    );
+    ASSERT_TRUE(handler.usesBinaryFrames());
+
+    // ["step_matches", {"name_to_match": "x"}]
+    const std::string response = handler.handle(
+        CompressingWireMessageCodec::compress("\x92\xacstep_matches\x81\xadname_to_match\xa1x")
+    );
+    ASSERT_EQ('\1', response[0]);
+    const nlohmann::json decoded =
+        nlohmann::json::from_msgpack(CompressingWireMessageCodec::decompress(response));
+    EXPECT_EQ("success", decoded[0]);
+    EXPECT_EQ(100, decoded[1].size());
+}
@@ -2,6 +2,8 @@
 
 #include "utils/ContextManagerTestDouble.hpp"
 
+#include <thread>
+
 using namespace std;
 using namespace cucumber::internal;
 
@@ -59,3 +61,124 @@ TEST_F(ContextHandlingTest, contextsArePurgedExplicitlyOnly) {
     contextManager.purgeContexts();
     ASSERT_EQ(0, contextManager.countContexts());
 }
+
+TEST_F(ContextHandlingTest, purgedContextsAreCreatedAgain) {
+    ::cucumber::ScenarioScope<Context1> context1_a;
+    context1_a->i = 42;
+    contextManager.purgeContexts();
+    ::cucumber::ScenarioScope<Context1> context1_b;
+    ASSERT_EQ(1, contextManager.countContexts());
+    ASSERT_EQ(0, context1_b->i);
+}
+
+namespace {
+struct PooledContext {
+    PooledContext() :
+        i(0),
+        resets(0) {
+        ++constructions;
+    }
+    void reset() {
+        i = 0;
+        ++resets;
+    }
+    int i;
+    int resets;
+    static int constructions;
+};
+int PooledContext::constructions = 0;
+
+struct AssignedPooledContext {
+    int i = 0;
+};
+}
+
+TEST_F(ContextHandlingTest, pooledContextsAreSharedWithinAScenario) {
+    ::cucumber::PooledScenarioScope<PooledContext> context_a;
+    ::cucumber::PooledScenarioScope<PooledContext> context_b;
+    context_a->i = 42;
+    ASSERT_EQ(42, context_b->i);
+    ASSERT_EQ(0, contextManager.countContexts());
+}
+
+TEST_F(ContextHandlingTest, pooledContextsAreResetInPlaceForTheNextScenario) {
+    ::cucumber::PooledScenarioScope<PooledContext> context_a;
+    context_a->i = 42;
+    const int resets = context_a->resets;
+    const int constructions = PooledContext::constructions;
+    contextManager.purgeContexts();
+
+    ::cucumber::PooledScenarioScope<PooledContext> context_b;
+    ::cucumber::PooledScenarioScope<PooledContext> context_c;
+    ASSERT_EQ(context_a.get(), context_b.get());
+    ASSERT_EQ(0, context_b->i);
+    ASSERT_EQ(resets + 1, context_c->resets);
+    ASSERT_EQ(constructions, PooledContext::constructions);
+}
+
+TEST_F(ContextHandlingTest, pooledContextsWithoutResetAreAssignedANewInstance) {
+    ::cucumber::PooledScenarioScope<AssignedPooledContext> context_a;
+    context_a->i = 42;
+    contextManager.purgeContexts();
+    ::cucumber::PooledScenarioScope<AssignedPooledContext> context_b;
+    ASSERT_EQ(0, context_b->i);
+}
+
+TEST_F(ContextHandlingTest, contextsAreSeparatePerSession) {
+    ScenarioContexts firstSession;
+    ScenarioContexts secondSession;
+
+    firstSession.makeCurrent();
+    ::cucumber::ScenarioScope<Context1> first;
+    first->i = 1;
+    secondSession.makeCurrent();
+    ::cucumber::ScenarioScope<Context1> second;
+    second->i = 2;
+
+    firstSession.makeCurrent();
+    ASSERT_EQ(1, ::cucumber::ScenarioScope<Context1>()->i);
+    firstSession.purge();
+    secondSession.makeCurrent();
+    ASSERT_EQ(2, ::cucumber::ScenarioScope<Context1>()->i);
+}
+
+TEST_F(ContextHandlingTest, threadsWithoutSessionHaveTheirOwnContexts) {
+    ::cucumber::ScenarioScope<Context1> context;
+    Context1* otherThreadContext = NULL;
+    std::thread otherThread([&otherThreadContext] {
+        otherThreadContext = ::cucumber::ScenarioScope<Context1>().get();
+    });
+    otherThread.join();
+    ASSERT_NE(context.get(), otherThreadContext);
+    ASSERT_EQ(1, contextManager.countContexts());
+}
+
+TEST_F(ContextHandlingTest, featureContextsOutliveTheScenariosOfTheirFeature) {
+    ::cucumber::FeatureScope<Context1> context_a;
+    context_a->i = 42;
+    contextManager.purgeContexts();
+    ::cucumber::FeatureScope<Context1> context_b;
+    ASSERT_EQ(context_a.get(), context_b.get());
+    ASSERT_EQ(42, context_b->i);
+
+    ScenarioContexts::current().purgeFeature();
+    ASSERT_EQ(0, ::cucumber::FeatureScope<Context1>()->i);
+    ScenarioContexts::current().purgeFeature();
+}
+
+TEST_F(ContextHandlingTest, runContextsAreSharedBySessionsUntilTheRunEnds) {
+    ScenarioContexts firstSession;
+    ScenarioContexts secondSession;
+
+    firstSession.makeCurrent();
+    ::cucumber::RunScope<Context1> first;
+    first->i = 1;
+    firstSession.purge();
+    firstSession.purgeFeature();
+    secondSession.makeCurrent();
+    ASSERT_EQ(1, ::cucumber::RunScope<Context1>()->i);
+
+    ScenarioContexts::purgeRun();
+    ASSERT_EQ(0, ::cucumber::RunScope<Context1>()->i);
+    ScenarioContexts::purgeRun();
+}
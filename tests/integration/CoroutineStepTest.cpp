@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/ScenarioRunner.hpp>
+#include <cucumber-cpp/internal/CukeEngineImpl.hpp>
+#include <cucumber-cpp/internal/step/CoroutineStep.hpp>
+#include <cucumber-cpp/internal/step/StepMacros.hpp>
+#include <cucumber-cpp/internal/drivers/GenericDriver.hpp>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace cucumber::internal;
+
+namespace {
+
+struct Counter {
+    int value = 0;
+};
+
+PickledScenario scenario(const std::vector<std::string>& steps) {
+    PickledScenario pickled;
+    for (const std::string& text : steps) {
+        PickledStep step;
+        step.text = text;
+        pickled.steps.push_back(step);
+    }
+    return pickled;
+}
+
+void invokeStep(CukeEngine& engine, const std::string& text) {
+    const std::vector<StepMatch> matches = engine.stepMatches(text);
+    ASSERT_EQ(1, matches.size());
+    CukeEngine::invoke_args_type args;
+    for (const StepMatchArg& arg : matches.front().args) {
+        args.push_back(arg.value);
+    }
+    engine.invokeStep(matches.front().id, args, CukeEngine::invoke_table_type());
+}
+
+cucumber::StepTask failAfterWaiting() {
+    co_await cucumber::resumeAfter(std::chrono::milliseconds(1));
+    throw std::runtime_error("failed after waiting");
+}
+}
+
+CO_GIVEN("^the counter is set to (\\d+) after (\\d+) ms$", (const int value, const int delay)) {
+    co_await cucumber::resumeAfter(std::chrono::milliseconds(delay));
+    cucumber::ScenarioScope<Counter> counter;
+    counter->value = value;
+}
+
+CO_WHEN("^the counter is incremented on another thread$") {
+    std::thread worker;
+    co_await cucumber::resumeWhen([&worker](std::function<void()> resume) {
+        worker = std::thread(std::move(resume));
+    });
+    worker.join();
+    cucumber::ScenarioScope<Counter> counter;
+    ++counter->value;
+}
+
+CO_WHEN("^a helper coroutine fails$") {
+    co_await failAfterWaiting();
+}
+
+CO_THEN("^the coroutine step is pending$") {
+    pending("later");
+    co_return;
+}
+
+THEN("^the counter is (\\d+)$") {
+    REGEX_PARAM(int, expected);
+    cucumber::ScenarioScope<Counter> counter;
+    if (counter->value != expected) {
+        throw std::runtime_error("counter is " + std::to_string(counter->value));
+    }
+}
+
+TEST(CoroutineStepTest, waitsForTheBodyWhenInvokedAsAnyOtherStep) {
+    CukeEngineImpl engine;
+    engine.beginScenario({});
+    invokeStep(engine, "the counter is set to 41 after 10 ms");
+    invokeStep(engine, "the counter is incremented on another thread");
+    invokeStep(engine, "the counter is 42");
+    EXPECT_THROW(invokeStep(engine, "a helper coroutine fails"), InvokeFailureException);
+    EXPECT_THROW(invokeStep(engine, "the coroutine step is pending"), PendingStepException);
+    engine.endScenario({});
+}
+
+TEST(CoroutineStepTest, reportsTheOutcomeOfAsynchronousBodies) {
+    const ParallelScenarioRunner::scenarios_type scenarios = {
+        scenario(
+            {"the counter is set to 1 after 10 ms",
+             "the counter is incremented on another thread",
+             "the counter is 2"}
+        ),
+        scenario({"a helper coroutine fails", "the counter is 0"}),
+        scenario({"the coroutine step is pending"}),
+    };
+
+    ParallelScenarioRunner runner(1);
+    runner.setScenariosPerLane(3);
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    EXPECT_EQ(RUN_PASSED, results[0].status) << results[0].message;
+    EXPECT_EQ(RUN_FAILED, results[1].status);
+    EXPECT_EQ("failed after waiting", results[1].message);
+    EXPECT_EQ(RUN_SKIPPED, results[1].steps[1].status);
+    EXPECT_EQ(RUN_PENDING, results[2].status);
+    EXPECT_EQ("later", results[2].message);
+}
+
+TEST(CoroutineStepTest, interleavesWaitingScenariosOnALane) {
+    ParallelScenarioRunner::scenarios_type scenarios;
+    for (int i = 0; i < 8; ++i) {
+        const std::string value = std::to_string(i);
+        scenarios.push_back(scenario(
+            {"the counter is set to " + value + " after 200 ms", "the counter is " + value}
+        ));
+    }
+
+    ParallelScenarioRunner runner(1);
+    runner.setScenariosPerLane(8);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+    const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+    for (const ScenarioResult& result : results) {
+        EXPECT_EQ(RUN_PASSED, result.status) << result.message;
+    }
+    // One after the other they would take 1600 ms
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+}
@@ -0,0 +1,437 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/ScenarioRunner.hpp>
+#include <cucumber-cpp/internal/CukeEngineImpl.hpp>
+#include <cucumber-cpp/internal/hook/HookMacros.hpp>
+#include <cucumber-cpp/internal/step/StepMacros.hpp>
+#include <cucumber-cpp/internal/drivers/GenericDriver.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace cucumber::internal;
+
+namespace {
+
+struct Counter {
+    int value = 0;
+};
+
+std::atomic<int> beforeAllRuns(0);
+
+std::atomic<int> simulatorBuilds(0);
+
+struct Simulator {
+    int speed = 0;
+
+    Simulator snapshot() const {
+        return *this;
+    }
+};
+
+std::mutex serialThreadsMutex;
+std::map<std::thread::id, int> serialThreads;
+
+PickledStep step(const std::string& text) {
+    PickledStep pickled;
+    pickled.text = text;
+    return pickled;
+}
+
+PickledScenario scenario(
+    const std::vector<std::string>& steps, const CukeEngine::tags_type& tags = {}
+) {
+    PickledScenario pickled;
+    pickled.tags = tags;
+    for (const std::string& text : steps) {
+        pickled.steps.push_back(step(text));
+    }
+    return pickled;
+}
+
+/**
+ * Engine that records the threads running serial scenarios and forwards
+ * to a CukeEngineImpl
+ */
+class RecordingEngine : public CukeEngineImpl {
+public:
+    void beginScenario(const tags_type& tags) override {
+        if (std::find(tags.begin(), tags.end(), "serial") != tags.end()) {
+            std::lock_guard<std::mutex> lock(serialThreadsMutex);
+            ++serialThreads[std::this_thread::get_id()];
+        }
+        CukeEngineImpl::beginScenario(tags);
+    }
+};
+
+
+/**
+ * Engine that counts how often every step text is matched
+ */
+class MatchCountingEngine : public CukeEngineImpl {
+public:
+    std::vector<StepMatch> stepMatches(const std::string& name) const override {
+        {
+            std::lock_guard<std::mutex> lock(matchCountsMutex);
+            ++matchCounts[name];
+        }
+        return CukeEngineImpl::stepMatches(name);
+    }
+
+    std::vector<std::vector<StepMatch>> outlineStepMatches(
+        const std::string& templateName, const std::vector<std::string>& names
+    ) const override {
+        {
+            std::lock_guard<std::mutex> lock(matchCountsMutex);
+            ++matchCounts[templateName];
+        }
+        return CukeEngineImpl::outlineStepMatches(templateName, names);
+    }
+
+    static std::mutex matchCountsMutex;
+    static std::map<std::string, int> matchCounts;
+};
+
+std::mutex MatchCountingEngine::matchCountsMutex;
+std::map<std::string, int> MatchCountingEngine::matchCounts;
+
+/**
+ * Engine that records the last tag of every scenario it begins
+ */
+class OrderRecordingEngine : public CukeEngineImpl {
+public:
+    void beginScenario(const tags_type& tags) override {
+        begun.push_back(tags.back());
+        CukeEngineImpl::beginScenario(tags);
+    }
+
+    static std::vector<std::string> begun;
+};
+
+std::vector<std::string> OrderRecordingEngine::begun;
+
+PickledScenario namedScenario(const std::string& name, const std::vector<std::string>& steps) {
+    PickledScenario pickled = scenario(steps, {name});
+    pickled.name = name;
+    pickled.location = "timed.feature:1";
+    return pickled;
+}
+}
+
+BEFORE_ALL() {
+    ++beforeAllRuns;
+}
+
+GIVEN("^the counter is (\\d+)$") {
+    REGEX_PARAM(int, value);
+    cucumber::ScenarioScope<Counter> counter;
+    counter->value = value;
+}
+
+WHEN("^the counter is incremented$") {
+    cucumber::ScenarioScope<Counter> counter;
+    ++counter->value;
+}
+
+THEN("^the counter is now (\\d+)$") {
+    REGEX_PARAM(int, expected);
+    cucumber::ScenarioScope<Counter> counter;
+    if (counter->value != expected) {
+        throw std::runtime_error("counter is " + std::to_string(counter->value));
+    }
+}
+
+GIVEN("^a simulator at speed (\\d+)$") {
+    REGEX_PARAM(int, speed);
+    cucumber::ScenarioScope<Simulator> simulator;
+    simulator->speed = speed;
+    ++simulatorBuilds;
+}
+
+WHEN("^the simulator speeds up$") {
+    cucumber::ScenarioScope<Simulator> simulator;
+    ++simulator->speed;
+}
+
+THEN("^the simulator is at speed (\\d+)$") {
+    REGEX_PARAM(int, expected);
+    cucumber::ScenarioScope<Simulator> simulator;
+    if (simulator->speed != expected) {
+        throw std::runtime_error("speed is " + std::to_string(simulator->speed));
+    }
+}
+
+THEN("^the step is pending$") {
+    pending("not yet");
+}
+
+THEN("^an ambiguous (\\w+)$") {
+}
+
+THEN("^an (\\w+) step$") {
+}
+
+TEST(ScenarioRunnerTest, runsScenariosInParallelAndKeepsTheirOrder) {
+    ParallelScenarioRunner::scenarios_type scenarios;
+    for (int i = 0; i < 200; ++i) {
+        const std::string value = std::to_string(i);
+        scenarios.push_back(scenario(
+            {"the counter is " + value,
+             "the counter is incremented",
+             "the counter is now " + std::to_string(i + 1)}
+        ));
+    }
+
+    const int beforeAllRunsSoFar = beforeAllRuns;
+    const ParallelScenarioRunner::results_type results = ParallelScenarioRunner(4).run(scenarios);
+
+    ASSERT_EQ(scenarios.size(), results.size());
+    for (const ScenarioResult& result : results) {
+        EXPECT_EQ(RUN_PASSED, result.status) << result.message;
+        ASSERT_EQ(3, result.steps.size());
+    }
+    EXPECT_EQ(beforeAllRunsSoFar + 1, beforeAllRuns);
+}
+
+TEST(ScenarioRunnerTest, reportsTheFirstStepThatDoesNotPass) {
+    const ParallelScenarioRunner::scenarios_type scenarios = {
+        scenario({"the counter is 1", "the counter is now 2", "the counter is incremented"}),
+        scenario({"the step is pending", "the counter is incremented"}),
+        scenario({"no such step"}),
+        scenario({"an ambiguous step"}),
+    };
+
+    const ParallelScenarioRunner::results_type results = ParallelScenarioRunner(2).run(scenarios);
+
+    EXPECT_EQ(RUN_FAILED, results[0].status);
+    EXPECT_EQ("counter is 1", results[0].message);
+    EXPECT_EQ(RUN_PASSED, results[0].steps[0].status);
+    EXPECT_EQ(RUN_FAILED, results[0].steps[1].status);
+    EXPECT_EQ(RUN_SKIPPED, results[0].steps[2].status);
+    EXPECT_EQ(0, results[0].steps[1].source.find("ScenarioRunnerTest.cpp:"));
+    EXPECT_EQ("", results[0].steps[2].source);
+
+    EXPECT_EQ(RUN_PENDING, results[1].status);
+    EXPECT_EQ("not yet", results[1].message);
+    EXPECT_EQ(RUN_SKIPPED, results[1].steps[1].status);
+
+    EXPECT_EQ(RUN_UNDEFINED, results[2].status);
+    EXPECT_EQ("", results[2].steps[0].source);
+    EXPECT_EQ(RUN_AMBIGUOUS, results[3].status);
+}
+
+TEST(ScenarioRunnerTest, runsSerialScenariosOnASingleLane) {
+    ParallelScenarioRunner::scenarios_type scenarios;
+    for (int i = 0; i < 40; ++i) {
+        scenarios.push_back(scenario({"the counter is incremented"}, {"x"}));
+        scenarios.push_back(scenario({"the counter is incremented"}, {"serial"}));
+    }
+    serialThreads.clear();
+    ParallelScenarioRunner runner(4);
+    runner.setEngineFactory([] {
+        return std::unique_ptr<CukeEngine>(new RecordingEngine);
+    });
+
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    for (const ScenarioResult& result : results) {
+        EXPECT_EQ(RUN_PASSED, result.status) << result.message;
+    }
+    ASSERT_EQ(1, serialThreads.size());
+    EXPECT_EQ(40, serialThreads.begin()->second);
+}
+
+TEST(ScenarioRunnerTest, startsTheScenariosExpectedToTakeLongestFirst) {
+    const ParallelScenarioRunner::scenarios_type scenarios = {
+        namedScenario("short", {"the counter is incremented"}),
+        namedScenario("unknown", {"the counter is 1"}),
+        namedScenario("long", {"the counter is incremented"}),
+        namedScenario("steps", {"the counter is incremented", "the counter is incremented"}),
+    };
+    DurationHistory history;
+    const auto key = [](const std::string& name) {
+        return DurationHistory::key(name + "\ntimed.feature:1");
+    };
+    history.record(DurationHistory::SCENARIO, key("short"), std::chrono::seconds(1));
+    history.record(DurationHistory::SCENARIO, key("long"), std::chrono::seconds(9));
+    history.record(
+        DurationHistory::STEP,
+        DurationHistory::key("^the counter is incremented$"),
+        std::chrono::seconds(3)
+    );
+    OrderRecordingEngine::begun.clear();
+    ParallelScenarioRunner runner(1);
+    runner.setDurationHistory(&history);
+    runner.setEngineFactory([] {
+        return std::unique_ptr<CukeEngine>(new OrderRecordingEngine);
+    });
+
+    runner.run(scenarios);
+
+    // Unknown ones take the average scenario
+    EXPECT_EQ(
+        std::vector<std::string>({"long", "steps", "unknown", "short"}), OrderRecordingEngine::begun
+    );
+    EXPECT_TRUE(history.expected(DurationHistory::SCENARIO, key("unknown")));
+    EXPECT_GT(std::chrono::seconds(1), *history.expected(DurationHistory::SCENARIO, key("steps")));
+}
+
+TEST(ScenarioRunnerTest, matchesEveryDistinctStepTextOnce) {
+    ParallelScenarioRunner::scenarios_type scenarios;
+    for (int i = 0; i < 100; ++i) {
+        scenarios.push_back(scenario(
+            {"the counter is " + std::to_string(i % 5),
+             "the counter is incremented",
+             "no such step"}
+        ));
+    }
+    MatchCountingEngine::matchCounts.clear();
+    ParallelScenarioRunner runner(4);
+    runner.setEngineFactory([] {
+        return std::unique_ptr<CukeEngine>(new MatchCountingEngine);
+    });
+
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    for (const ScenarioResult& result : results) {
+        EXPECT_EQ(RUN_UNDEFINED, result.status) << result.message;
+    }
+    EXPECT_EQ(7, MatchCountingEngine::matchCounts.size());
+    for (const auto& matchCount : MatchCountingEngine::matchCounts) {
+        EXPECT_EQ(1, matchCount.second) << matchCount.first;
+    }
+}
+
+TEST(ScenarioRunnerTest, matchesTheExpansionsOfAnOutlineStepTogether) {
+    ParallelScenarioRunner::scenarios_type scenarios;
+    for (int i = 0; i < 50; ++i) {
+        PickledScenario expanded = scenario(
+            {"the counter is " + std::to_string(i),
+             "the counter is incremented",
+             "the counter is now " + std::to_string(i + 1)}
+        );
+        expanded.steps[0].templateText = "the counter is <start>";
+        expanded.steps[2].templateText = "the counter is now <end>";
+        scenarios.push_back(expanded);
+    }
+    MatchCountingEngine::matchCounts.clear();
+    ParallelScenarioRunner runner(3);
+    runner.setEngineFactory([] {
+        return std::unique_ptr<CukeEngine>(new MatchCountingEngine);
+    });
+
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    for (const ScenarioResult& result : results) {
+        EXPECT_EQ(RUN_PASSED, result.status) << result.message;
+    }
+    EXPECT_EQ(
+        (std::map<std::string, int>{
+            {"the counter is <start>", 1},
+            {"the counter is incremented", 1},
+            {"the counter is now <end>", 1},
+        }),
+        MatchCountingEngine::matchCounts
+    );
+}
+
+TEST(ScenarioRunnerTest, skipsTheRemainingScenariosOnceOneFailed) {
+    const ParallelScenarioRunner::scenarios_type scenarios = {
+        scenario({"the counter is incremented"}, {"first"}),
+        scenario({"the counter is now 2"}, {"failing"}),
+        scenario({"the counter is incremented"}, {"skipped"}),
+    };
+    OrderRecordingEngine::begun.clear();
+    ParallelScenarioRunner runner(1);
+    runner.setFailFast(ParallelScenarioRunner::SKIP_ALL_AFTER_FAILURE);
+    runner.setEngineFactory([] {
+        return std::unique_ptr<CukeEngine>(new OrderRecordingEngine);
+    });
+
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    EXPECT_EQ(std::vector<std::string>({"first", "failing"}), OrderRecordingEngine::begun);
+    EXPECT_EQ(RUN_FAILED, results[1].status);
+    EXPECT_EQ(RUN_SKIPPED, results[2].status);
+    EXPECT_EQ("Skipped after an earlier failure", results[2].message);
+    ASSERT_EQ(1, results[2].steps.size());
+    EXPECT_EQ(RUN_SKIPPED, results[2].steps[0].status);
+}
+
+TEST(ScenarioRunnerTest, skipsTheScenariosSharingATagWithOneThatFailed) {
+    const ParallelScenarioRunner::scenarios_type scenarios = {
+        scenario({"no such step"}, {"login", "serial", "undefined"}),
+        scenario({"the counter is incremented"}, {"serial", "other"}),
+        scenario({"the counter is incremented"}, {"login", "skipped"}),
+    };
+    OrderRecordingEngine::begun.clear();
+    ParallelScenarioRunner runner(1);
+    runner.setFailFast(ParallelScenarioRunner::SKIP_SHARED_TAGS_AFTER_FAILURE);
+    runner.setEngineFactory([] {
+        return std::unique_ptr<CukeEngine>(new OrderRecordingEngine);
+    });
+
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    // The serial tag is not shared as such
+    EXPECT_EQ(std::vector<std::string>({"undefined", "other"}), OrderRecordingEngine::begun);
+    EXPECT_EQ(RUN_PASSED, results[1].status);
+    EXPECT_EQ(RUN_SKIPPED, results[2].status);
+}
+
+TEST(ScenarioRunnerTest, onlyMatchesStepsOnADryRun) {
+    const ParallelScenarioRunner::scenarios_type scenarios = {
+        scenario({"the counter is now 2"}),
+        scenario({"no such step"}),
+    };
+    const int beforeAllRunsSoFar = beforeAllRuns;
+    ParallelScenarioRunner runner(2);
+    runner.setEngineFactory([] {
+        std::unique_ptr<CukeEngineImpl> engine(new CukeEngineImpl);
+        engine->setDryRun(true);
+        return std::unique_ptr<CukeEngine>(std::move(engine));
+    });
+
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    EXPECT_EQ(RUN_PASSED, results[0].status) << results[0].message;
+    EXPECT_EQ(RUN_UNDEFINED, results[1].status);
+    EXPECT_EQ(beforeAllRunsSoFar, beforeAllRuns);
+}
+
+TEST(ScenarioRunnerTest, runsNothingWithoutScenarios) {
+    EXPECT_TRUE(ParallelScenarioRunner(3).run({}).empty());
+}
+
+TEST(ScenarioRunnerTest, runsTheBackgroundOnceAndRestoresItsContexts) {
+    ParallelScenarioRunner::scenarios_type scenarios;
+    for (int i = 0; i < 5; ++i) {
+        PickledScenario pickled = scenario(
+            {"a simulator at speed 3", "the simulator speeds up", "the simulator is at speed 4"}
+        );
+        pickled.location = "simulator.feature:" + std::to_string(i + 3);
+        pickled.backgroundSteps = 1;
+        scenarios.push_back(pickled);
+    }
+    // Not a snapshot of the Background, which already ran further
+    scenarios.push_back(scenario({"a simulator at speed 3", "the simulator is at speed 3"}));
+    scenarios.back().location = "other.feature:3";
+    scenarios.back().backgroundSteps = 1;
+
+    const int buildsSoFar = simulatorBuilds;
+    ParallelScenarioRunner runner(1);
+    runner.setBackgroundSnapshots(true);
+    const ParallelScenarioRunner::results_type results = runner.run(scenarios);
+
+    for (const ScenarioResult& result : results) {
+        EXPECT_EQ(RUN_PASSED, result.status) << result.message;
+        EXPECT_EQ(RUN_PASSED, result.steps[0].status);
+        EXPECT_EQ(0, result.steps[0].source.find("ScenarioRunnerTest.cpp:"));
+    }
+    EXPECT_EQ(buildsSoFar + 2, simulatorBuilds);
+}
@@ -0,0 +1,163 @@
+#include <cucumber-cpp/internal/connectors/wire/SharedMemoryServer.hpp>
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace cucumber::internal;
+using namespace testing;
+
+namespace {
+
+const auto THREAD_TEST_TIMEOUT = std::chrono::milliseconds(4000);
+
+class MockProtocolHandler : public ProtocolHandler {
+public:
+    MOCK_METHOD(std::string, handle, (const std::string& request), (const, override));
+};
+
+class EchoProtocolHandler : public ProtocolHandler {
+public:
+    std::string handle(const std::string& request) const override {
+        return "echo " + request;
+    }
+};
+
+std::string uniqueName() {
+    static int segments = 0;
+    return "/cucumber-cpp-test-" + std::to_string(::getpid()) + "-" + std::to_string(++segments);
+}
+}
+
+class SharedMemoryServerTest : public Test {
+protected:
+    StrictMock<MockProtocolHandler> protocolHandler;
+    std::unique_ptr<SharedMemoryServer> server;
+    std::string name = uniqueName();
+
+    void SetUp() override {
+        server.reset(new SharedMemoryServer(&protocolHandler));
+        // Small enough for messages to wrap around
+        server->listen(name, 64);
+    }
+};
+
+TEST_F(SharedMemoryServerTest, exchangesMessagesUntilTheClientDisconnects) {
+    const std::string longRequest(1000, 'r');
+    const std::string longResponse(5000, 'R');
+    {
+        InSequence s;
+        EXPECT_CALL(protocolHandler, handle("12")).WillOnce(Return("A"));
+        EXPECT_CALL(protocolHandler, handle(longRequest)).WillOnce(Return(longResponse));
+        EXPECT_CALL(protocolHandler, handle("")).WillOnce(Return(""));
+    }
+    std::future<void> serverThread =
+        std::async(std::launch::async, &SharedMemoryServer::acceptOnce, server.get());
+    {
+        SharedMemoryClient client(name);
+        EXPECT_EQ("A", client.request("12"));
+        EXPECT_EQ(longResponse, client.request(longRequest));
+        EXPECT_EQ("", client.request(""));
+    }
+    EXPECT_EQ(std::future_status::ready, serverThread.wait_for(THREAD_TEST_TIMEOUT));
+}
+
+TEST_F(SharedMemoryServerTest, answersPipelinedRequestsInOrder) {
+    EXPECT_CALL(protocolHandler, handle(_)).WillRepeatedly(ReturnArg<0>());
+    std::future<void> serverThread =
+        std::async(std::launch::async, &SharedMemoryServer::acceptOnce, server.get());
+    {
+        SharedMemoryClient client(name);
+        for (int i = 0; i < 3; ++i) {
+            client.send(std::to_string(i));
+        }
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(std::to_string(i), client.receive());
+        }
+    }
+    EXPECT_EQ(std::future_status::ready, serverThread.wait_for(THREAD_TEST_TIMEOUT));
+}
+
+TEST_F(SharedMemoryServerTest, servesOneClientAtATime) {
+    EXPECT_CALL(protocolHandler, handle(_)).Times(0);
+    std::future<void> serverThread = std::async(std::launch::async, [this] {
+        server->acceptSessions(
+            [] {
+                return std::unique_ptr<const ProtocolHandler>(new EchoProtocolHandler());
+            },
+            2
+        );
+    });
+    {
+        SharedMemoryClient client(name);
+        EXPECT_THROW(SharedMemoryClient other(name), std::runtime_error);
+        EXPECT_EQ("echo 1", client.request("1"));
+    }
+    {
+        SharedMemoryClient client(name);
+        EXPECT_EQ("echo 2", client.request("2"));
+    }
+    EXPECT_EQ(std::future_status::ready, serverThread.wait_for(THREAD_TEST_TIMEOUT));
+}
+
+TEST_F(SharedMemoryServerTest, clientFailsOnceTheServerIsGone) {
+    SharedMemoryClient client(name);
+    server.reset();
+
+    EXPECT_THROW(client.request("X"), std::runtime_error);
+    EXPECT_THROW(SharedMemoryClient other(name), std::system_error);
+}
+
+TEST_F(SharedMemoryServerTest, takesAClientWhoseProcessIsGoneForDisconnected) {
+    const pid_t child = ::fork();
+    ASSERT_NE(-1, child);
+    if (child == 0) {
+        // Crashes, without disconnecting
+        SharedMemoryClient client(name);
+        ::_exit(0);
+    }
+    ASSERT_EQ(child, ::waitpid(child, nullptr, 0));
+
+    EXPECT_CALL(protocolHandler, handle(_)).Times(0);
+    std::future<void> serverThread = std::async(std::launch::async, [this] {
+        server->acceptSessions(
+            [] {
+                return std::unique_ptr<const ProtocolHandler>(new EchoProtocolHandler());
+            },
+            2
+        );
+    });
+    std::unique_ptr<SharedMemoryClient> client;
+    const auto deadline = std::chrono::steady_clock::now() + THREAD_TEST_TIMEOUT;
+    while (!client && std::chrono::steady_clock::now() < deadline) {
+        try {
+            client.reset(new SharedMemoryClient(name));
+        } catch (const std::runtime_error&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    ASSERT_NE(nullptr, client);
+    EXPECT_EQ("echo 1", client->request("1"));
+    client.reset();
+    EXPECT_EQ(std::future_status::ready, serverThread.wait_for(THREAD_TEST_TIMEOUT));
+}
+
+TEST_F(SharedMemoryServerTest, endsTheSessionOfARequestTooLong) {
+    EXPECT_CALL(protocolHandler, handle("short")).WillOnce(Return("A"));
+    server->setMaxMessageLength(16);
+    std::future<void> serverThread =
+        std::async(std::launch::async, &SharedMemoryServer::acceptOnce, server.get());
+    SharedMemoryClient client(name);
+    EXPECT_EQ("A", client.request("short"));
+
+    EXPECT_THROW(client.request(std::string(17, 'r')), std::runtime_error);
+    EXPECT_EQ(std::future_status::ready, serverThread.wait_for(THREAD_TEST_TIMEOUT));
+}
@@ -0,0 +1,106 @@
+#include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+using namespace cucumber::internal;
+using namespace testing;
+
+namespace {
+
+class MockCukeEngine : public CukeEngine {
+public:
+    MOCK_METHOD(std::vector<StepMatch>, stepMatches, (const std::string& name), (const, override));
+    MOCK_METHOD(void, endScenario, (const tags_type& tags), (override));
+    MOCK_METHOD(
+        void,
+        invokeStep,
+        (const std::string& id, const invoke_args_type& args, const invoke_table_type& tableArg),
+        (override)
+    );
+    MOCK_METHOD(void, beginScenario, (const tags_type& tags), (override));
+    MOCK_METHOD(
+        std::string,
+        snippetText,
+        (const std::string& keyword, const std::string& name, const std::string& multilineArgClass),
+        (const, override)
+    );
+};
+}
+
+class SimdJsonWireMessageCodecTest : public Test {
+protected:
+    const SimdJsonWireMessageCodec codec;
+    MockCukeEngine engine;
+
+    std::string run(const std::string& request) {
+        return codec.encode(*codec.decode(request)->run(engine));
+    }
+};
+
+TEST_F(SimdJsonWireMessageCodecTest, decodesScenarioBoundaries) {
+    {
+        InSequence s;
+        EXPECT_CALL(engine, beginScenario(ElementsAre("@a", "@b")));
+        EXPECT_CALL(engine, endScenario(ElementsAre()));
+        EXPECT_CALL(engine, endScenario(ElementsAre()));
+    }
+
+    EXPECT_EQ(run(R"json(["begin_scenario", {"tags": ["@a", "@b"]}])json"), "[\"success\"]");
+    EXPECT_EQ(run(R"json(["end_scenario"])json"), "[\"success\"]");
+    EXPECT_EQ(run(R"json(["end_scenario", null])json"), "[\"success\"]");
+}
+
+TEST_F(SimdJsonWireMessageCodecTest, decodesStepMatches) {
+    EXPECT_CALL(engine, stepMatches("name \"to\" match"))
+        .WillOnce(Return(std::vector<StepMatch>()));
+
+    std::string request = R"json(["step_matches", {"name_to_match": "name \"to\" match"}])json";
+    // With room for the padding after the request, as lines read usually have
+    request.reserve(request.size() + 64);
+    EXPECT_EQ(run(request), "[\"success\",[]]");
+}
+
+TEST_F(SimdJsonWireMessageCodecTest, decodesInvokeWithTableArgs) {
+    EXPECT_CALL(
+        engine,
+        invokeStep(
+            "42",
+            ElementsAre("p1", "p2"),
+            ElementsAre(ElementsAre("col1", "col2"), ElementsAre("r1c1", "r1c2"))
+        )
+    );
+
+    std::string request =
+        R"json(["invoke", {"args": ["p1", [["col1", "col2"], ["r1c1", "r1c2"]], null, "p2"], )json"
+        R"json("id": "42"}])json";
+    // Without room for the padding after the request
+    request.shrink_to_fit();
+    EXPECT_EQ(run(request), "[\"success\"]");
+}
+
+TEST_F(SimdJsonWireMessageCodecTest, leavesUnusualRequestsToTheJsonCodec) {
+    EXPECT_CALL(
+        engine,
+        invokeStep("42", ElementsAre(), ElementsAre(ElementsAre("col1", "col2"), ElementsAre()))
+    );
+    EXPECT_CALL(engine, snippetText("Given", "a step", "")).WillOnce(Return("GIVEN(...)"));
+
+    EXPECT_EQ(
+        run(R"json(["invoke", {"id": "42", "args": [[["col1", "col2"], ["r1c1"]]]}])json"),
+        "[\"success\"]"
+    );
+    EXPECT_EQ(
+        run(R"json(["snippet_text", {"step_keyword": "Given", "step_name": "a step", )json"
+            R"json("multiline_arg_class": ""}])json"),
+        "[\"success\",\"GIVEN(...)\"]"
+    );
+    EXPECT_EQ(run(R"json(["invoke", {"id": "42", "args": [[["a", 1]]]}])json"), "[\"fail\"]");
+    EXPECT_EQ(run(R"json(["invoke", {"id": "42"}])json"), "[\"fail\"]");
+    EXPECT_EQ(run(R"json(["step_matches"])json"), "[\"fail\"]");
+    EXPECT_EQ(run(R"json(["end_scenario"] trailing)json"), "[\"fail\"]");
+    EXPECT_EQ(run("rubbish"), "[\"fail\"]");
+    EXPECT_EQ(run(""), "[\"fail\"]");
+}
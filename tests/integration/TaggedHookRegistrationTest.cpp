@@ -13,6 +13,10 @@ BEFORE("@a,@b") {
     beforeHookCallMarker << "C";
 }
 
+BEFORE("@c and not (@a or @b)") {
+    beforeHookCallMarker << "M";
+}
+
 AROUND_STEP("@a") {
     afterAroundStepHookCallMarker << "D";
     step->call();
@@ -77,3 +81,24 @@ TEST_F(HookRegistrationTest, andTagsAreEnforced) {
     EXPECT_EQ("GHI", sort(afterStepHookCallMarker.str()));
     EXPECT_EQ("JKL", sort(afterHookCallMarker.str()));
 }
+
+TEST_F(HookRegistrationTest, taggedStepHooksAreInvokedForEveryStepOfTheScenario) {
+    const TagExpression::tag_list tags = {"b"};
+    beginScenario(tags);
+    invokeStep();
+    invokeStep();
+    endScenario();
+    EXPECT_EQ("FF", afterAroundStepHookCallMarker.str());
+    EXPECT_EQ("II", afterStepHookCallMarker.str());
+    EXPECT_EQ("L", afterHookCallMarker.str());
+}
+
+TEST_F(HookRegistrationTest, booleanTagExpressionsAreEnforced) {
+    beginScenario({"c"});
+    endScenario();
+    EXPECT_EQ("M", beforeHookCallMarker.str());
+    clearHookCallMarkers();
+    beginScenario({"c", "b"});
+    endScenario();
+    EXPECT_EQ("C", beforeHookCallMarker.str());
+}
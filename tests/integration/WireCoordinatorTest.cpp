@@ -0,0 +1,190 @@
+#include <cucumber-cpp/internal/connectors/wire/WireCoordinator.hpp>
+
+#include <gmock/gmock.h>
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace cucumber::internal;
+using namespace testing;
+
+namespace {
+
+const WireCoordinator::scenario_key_type LONG_SCENARIO = 1;
+const WireCoordinator::scenario_key_type SHORT_SCENARIO = 2;
+
+std::chrono::nanoseconds seconds(int count) {
+    return std::chrono::seconds(count);
+}
+
+/**
+ * Answers every request with the address of the worker and the request
+ */
+class FakeWorkerConnection : public WireWorkerConnection {
+public:
+    FakeWorkerConnection(const std::string& address, std::vector<std::string>& requests) :
+        address(address),
+        requests(requests) {
+    }
+
+    std::string request(const std::string& line) override {
+        if (line == "crash") {
+            throw std::runtime_error(address + " crashed");
+        }
+        requests.push_back(address + " " + line);
+        return address;
+    }
+
+private:
+    const std::string address;
+    std::vector<std::string>& requests;
+};
+}
+
+class WireCoordinatorTest : public Test {
+protected:
+    DurationHistory history;
+    WireCoordinator coordinator{{"a:1", "b:2"}, &history};
+
+    void SetUp() override {
+        history.record(DurationHistory::SCENARIO, LONG_SCENARIO, seconds(10));
+        history.record(DurationHistory::SCENARIO, SHORT_SCENARIO, seconds(1));
+    }
+};
+
+TEST_F(WireCoordinatorTest, givesScenariosToTheWorkerExpectedToBeDoneFirst) {
+    EXPECT_EQ(0, coordinator.beginScenario(LONG_SCENARIO));
+    EXPECT_EQ(1, coordinator.beginScenario(SHORT_SCENARIO));
+    // Another 9 short ones fit in the time the long one takes, ties going to fewer scenarios
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(1, coordinator.beginScenario(SHORT_SCENARIO));
+    }
+    EXPECT_EQ(0, coordinator.beginScenario(SHORT_SCENARIO));
+
+    coordinator.endScenario(0, LONG_SCENARIO, seconds(10));
+    EXPECT_EQ(0, coordinator.leastLoaded());
+}
+
+TEST_F(WireCoordinatorTest, expectsUnknownScenariosToTakeTheAverageDuration) {
+    EXPECT_EQ(seconds(10), coordinator.expectedDuration(LONG_SCENARIO));
+    EXPECT_EQ(std::chrono::milliseconds(5500), coordinator.expectedDuration(3));
+
+    EXPECT_EQ(WireCoordinator::DEFAULT_DURATION, WireCoordinator({"a:1"}).expectedDuration(3));
+}
+
+TEST_F(WireCoordinatorTest, recordsDurationsInTheHistory) {
+    coordinator.endScenario(coordinator.beginScenario(SHORT_SCENARIO), SHORT_SCENARIO, seconds(3));
+
+    EXPECT_EQ(seconds(2), coordinator.expectedDuration(SHORT_SCENARIO));
+    EXPECT_EQ(seconds(2), history.expected(DurationHistory::SCENARIO, SHORT_SCENARIO));
+}
+
+TEST_F(WireCoordinatorTest, forgetsTheWorkOfAbandonedScenarios) {
+    const WireCoordinator::worker_type worker = coordinator.beginScenario(LONG_SCENARIO);
+    coordinator.abandonScenario(worker, LONG_SCENARIO);
+
+    EXPECT_EQ(worker, coordinator.beginScenario(LONG_SCENARIO));
+    EXPECT_THROW(coordinator.abandonScenario(1, LONG_SCENARIO), std::logic_error);
+}
+
+TEST(WireCoordinatorWorkersTest, needsWorkers) {
+    EXPECT_THROW(WireCoordinator(std::vector<std::string>()), std::invalid_argument);
+}
+
+TEST(WireCoordinatorKeyTest, recognisesScenariosByTagsAndSteps) {
+    const WireCoordinator::scenario_key_type key =
+        WireCoordinator::scenarioKey({"@slow"}, {"a step", "another step"});
+
+    EXPECT_EQ(key, WireCoordinator::scenarioKey({"@slow"}, {"a step", "another step"}));
+    EXPECT_NE(key, WireCoordinator::scenarioKey({}, {"a step", "another step"}));
+    EXPECT_NE(key, WireCoordinator::scenarioKey({"@slow"}, {"a stepanother step"}));
+    EXPECT_NE(key, WireCoordinator::scenarioKey({"@slow", "a step"}, {"another step"}));
+}
+
+class CoordinatingProtocolHandlerTest : public WireCoordinatorTest {
+protected:
+    std::vector<std::string> requests;
+    std::map<std::string, int> connections;
+
+    std::unique_ptr<CoordinatingProtocolHandler> newHandler() {
+        return std::unique_ptr<CoordinatingProtocolHandler>(new CoordinatingProtocolHandler(
+            coordinator,
+            [this](const std::string& address) {
+                ++connections[address];
+                return std::unique_ptr<WireWorkerConnection>(
+                    new FakeWorkerConnection(address, requests)
+                );
+            }
+        ));
+    }
+};
+
+TEST_F(CoordinatingProtocolHandlerTest, forwardsEachScenarioToTheWorkerPickedForIt) {
+    const std::unique_ptr<CoordinatingProtocolHandler> busy = newHandler();
+    const std::unique_ptr<CoordinatingProtocolHandler> handler = newHandler();
+    EXPECT_EQ("a:1", busy->handle(R"(["begin_scenario"])"));
+
+    EXPECT_EQ("b:2", handler->handle(R"(["step_matches",{"name_to_match":"x"}])"));
+    EXPECT_EQ("b:2", handler->handle(R"(["begin_scenario",{"tags":["@t"]}])"));
+    // Now the least loaded
+    EXPECT_EQ("a:1", busy->handle(R"(["end_scenario"])"));
+    EXPECT_EQ("b:2", handler->handle(R"(["invoke",{"id":"1","args":[]}])"));
+    EXPECT_EQ("b:2", handler->handle(R"(["end_scenario"])"));
+
+    EXPECT_THAT(
+        requests,
+        ElementsAre(
+            R"(a:1 ["begin_scenario"])",
+            R"(b:2 ["step_matches",{"name_to_match":"x"}])",
+            R"(b:2 ["begin_scenario",{"tags":["@t"]}])",
+            R"(a:1 ["end_scenario"])",
+            R"(b:2 ["invoke",{"id":"1","args":[]}])",
+            R"(b:2 ["end_scenario"])"
+        )
+    );
+    EXPECT_EQ(1, connections["b:2"]);
+    EXPECT_TRUE(
+        history.expected(DurationHistory::SCENARIO, WireCoordinator::scenarioKey({"@t"}, {"x"}))
+    );
+}
+
+TEST_F(CoordinatingProtocolHandlerTest, keepsClientsOnJson) {
+    const std::unique_ptr<CoordinatingProtocolHandler> handler = newHandler();
+
+    EXPECT_EQ(
+        handler->handle(R"(["negotiate_codec",{"codec":"msgpack"}])"),
+        R"(["fail",{"message":"Unsupported codec: msgpack"}])"
+    );
+    EXPECT_FALSE(handler->usesBinaryFrames());
+    EXPECT_THAT(requests, IsEmpty());
+}
+
+TEST_F(CoordinatingProtocolHandlerTest, reportsWorkerFailuresAndReconnects) {
+    const std::unique_ptr<CoordinatingProtocolHandler> handler = newHandler();
+    EXPECT_EQ("a:1", handler->handle(R"(["begin_scenario"])"));
+
+    EXPECT_EQ(handler->handle("crash"), R"(["fail",{"message":"a:1 crashed"}])");
+
+    // The scenario was abandoned
+    EXPECT_EQ(0, coordinator.leastLoaded());
+    EXPECT_EQ("a:1", handler->handle(R"(["begin_scenario"])"));
+    EXPECT_EQ(2, connections["a:1"]);
+}
+
+TEST_F(CoordinatingProtocolHandlerTest, takesRunScenarioRequestsForWholeScenarios) {
+    const std::unique_ptr<CoordinatingProtocolHandler> busy = newHandler();
+    const std::unique_ptr<CoordinatingProtocolHandler> handler = newHandler();
+    EXPECT_EQ("a:1", busy->handle(R"(["begin_scenario"])"));
+    EXPECT_EQ("b:2", handler->handle(R"(["step_matches",{"name_to_match":"x"}])"));
+
+    EXPECT_EQ("b:2", handler->handle(R"(["run_scenario",{"tags":["@t"],"steps":[]}])"));
+
+    // Ended with the request
+    EXPECT_EQ(1, coordinator.leastLoaded());
+    EXPECT_TRUE(
+        history.expected(DurationHistory::SCENARIO, WireCoordinator::scenarioKey({"@t"}, {"x"}))
+    );
+}
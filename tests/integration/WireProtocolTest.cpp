@@ -1,7 +1,11 @@
+#include <cucumber-cpp/internal/CukeCommands.hpp>
 #include <cucumber-cpp/internal/connectors/wire/WireProtocol.hpp>
 #include <cucumber-cpp/internal/connectors/wire/WireProtocolCommands.hpp>
+#include <cucumber-cpp/internal/step/StepLibrary.hpp>
+#include <cucumber-cpp/internal/step/StepManager.hpp>
 
 #include <gmock/gmock.h>
+#include <nlohmann/json.hpp>
 
 #include <typeinfo>
 
@@ -19,6 +23,7 @@ public:
         (const std::string& id, const invoke_args_type& args, const invoke_table_type& tableArg),
         (override)
     );
+    MOCK_METHOD(void, beginFeature, (const std::string& name), (override));
     MOCK_METHOD(void, beginScenario, (const tags_type& tags), (override));
     MOCK_METHOD(
         std::string,
@@ -76,6 +81,35 @@ TEST_F(WireMessageCodecTest, handlesStepMatchesMessage) {
         .run(engine);
 }
 
+TEST_F(WireMessageCodecTest, handlesStepMatchesBatchMessage) {
+    MockCukeEngine engine;
+    {
+        InSequence s;
+        EXPECT_CALL(engine, stepMatches("first name")).WillOnce(Return(std::vector<StepMatch>(0)));
+        EXPECT_CALL(engine, stepMatches("second name"))
+            .WillOnce(Return(std::vector<StepMatch>(0)));
+    }
+
+    decode(R"json([
+        "step_matches_batch", {
+            "names": ["first name", "second name"]
+        }
+    ])json")
+        .run(engine);
+}
+
+TEST_F(WireMessageCodecTest, handlesBeginFeatureMessage) {
+    MockCukeEngine engine;
+    EXPECT_CALL(engine, beginFeature("features/a.feature")).Times(1);
+
+    decode(R"json([
+        "begin_feature", {
+            "name": "features/a.feature"
+        }
+    ])json")
+        .run(engine);
+}
+
 TEST_F(WireMessageCodecTest, handlesBeginScenarioMessageWithoutArgument) {
     MockCukeEngine engine;
     EXPECT_CALL(engine, beginScenario(ElementsAre())).Times(1);
@@ -182,6 +216,45 @@ TEST_F(WireMessageCodecTest, handlesInvokeMessageWithNullArg) {
         .run(engine);
 }
 
+TEST_F(WireMessageCodecTest, handlesInvokeMessageWithUnevenTableRows) {
+    MockCukeEngine engine;
+    EXPECT_CALL(
+        engine,
+        invokeStep(
+            "42",
+            ElementsAre("p1", "p2"),
+            ElementsAre(ElementsAre("col1", "col2"), ElementsAre(), ElementsAre("r2c1", "r2c2"))
+        )
+    )
+        .Times(1);
+
+    decode(R"json([
+        "invoke", {
+            "args": [
+                "p1",
+                [
+                    ["col1", "col2"],
+                    ["r1c1"],
+                    ["r2c1", "r2c2"]
+                ],
+                "p2"
+            ],
+            "id": "42"
+        }
+    ])json")
+        .run(engine);
+}
+
+TEST_F(WireMessageCodecTest, failsOnInvokeMessageWithMalformedTable) {
+    MockCukeEngine engine;
+
+    EXPECT_EQ(
+        encode(*decode(R"json(["invoke", {"id": "42", "args": [[["a", 1]]]}])json").run(engine)),
+        "[\"fail\"]"
+    );
+    EXPECT_EQ(encode(*decode(R"json(["invoke", {"id": "42"}])json").run(engine)), "[\"fail\"]");
+}
+
 TEST_F(WireMessageCodecTest, handlesEndScenarioMessageWithoutArgument) {
     MockCukeEngine engine;
     EXPECT_CALL(engine, endScenario(ElementsAre())).Times(1);
@@ -233,6 +306,71 @@ TEST_F(WireMessageCodecTest, handlesSnippetTextMessage) {
         .run(engine);
 }
 
+TEST_F(WireMessageCodecTest, handlesRunScenarioMessage) {
+    MockCukeEngine engine;
+    {
+        InSequence s;
+        EXPECT_CALL(engine, beginScenario(ElementsAre("@a")));
+        EXPECT_CALL(engine, invokeStep("1", ElementsAre("x"), ElementsAre(ElementsAre("c"))));
+        EXPECT_CALL(engine, invokeStep("2", IsEmpty(), IsEmpty()));
+        EXPECT_CALL(engine, endScenario(ElementsAre("@a")));
+    }
+
+    const std::shared_ptr<WireResponse> response = decode(R"json([
+        "run_scenario", {
+            "tags": ["@a"],
+            "steps": [
+                {"id": "1", "args": ["x", [["c"]]]},
+                {"id": "2", "args": []}
+            ]
+        }
+    ])json")
+                                                       .run(engine);
+    EXPECT_EQ(encode(*response), R"(["success",[["success"],["success"]]])");
+}
+
+TEST_F(WireMessageCodecTest, handlesStatsMessage) {
+    MockCukeEngine engine;
+    const std::shared_ptr<WireResponse> response = decode("[\"stats\"]").run(engine);
+    EXPECT_PTRTYPE(StatsResponse, response.get());
+    EXPECT_THAT(encode(*response), HasSubstr("\"timings\":\"disabled\""));
+}
+
+TEST_F(WireMessageCodecTest, handlesLoadLibraryMessage) {
+    MockCukeEngine engine;
+    StepLibraries::setLoadableByClients(true);
+    const std::shared_ptr<WireResponse> response =
+        decode(R"json(["load_library", {"path": "no/such/library.so"}])json").run(engine);
+    StepLibraries::setLoadableByClients(false);
+    const FailureResponse* const failure = dynamic_cast<const FailureResponse*>(response.get());
+    ASSERT_NE(nullptr, failure);
+    EXPECT_THAT(failure->getMessage(), HasSubstr("no/such/library.so"));
+}
+
+TEST_F(WireMessageCodecTest, refusesLoadLibraryMessageUnlessAllowed) {
+    MockCukeEngine engine;
+    const std::shared_ptr<WireResponse> response =
+        decode(R"json(["load_library", {"path": "no/such/library.so"}])json").run(engine);
+    const FailureResponse* const failure = dynamic_cast<const FailureResponse*>(response.get());
+    ASSERT_NE(nullptr, failure);
+    EXPECT_THAT(failure->getMessage(), HasSubstr("not allowed"));
+}
+
+TEST_F(WireMessageCodecTest, refusesLoadLibraryMessageWhileScenariosRun) {
+    MockCukeEngine engine;
+    CukeCommands commands;
+    StepLibraries::setLoadableByClients(true);
+    commands.beginScenario();
+    const std::shared_ptr<WireResponse> response =
+        decode(R"json(["load_library", {"path": "no/such/library.so"}])json").run(engine);
+    commands.endScenario();
+    StepLibraries::setLoadableByClients(false);
+    const FailureResponse* const failure = dynamic_cast<const FailureResponse*>(response.get());
+    ASSERT_NE(nullptr, failure);
+    EXPECT_THAT(failure->getMessage(), HasSubstr("while scenarios run"));
+    EXPECT_EQ(0u, CukeCommands::runningScenarios());
+}
+
 /*
  * Response encoding
  */
@@ -302,11 +440,76 @@ TEST_F(WireMessageCodecTest, handlesStepMatchesResponse) {
     // clang-format on
 }
 
+TEST_F(WireMessageCodecTest, handlesStepMatchesBatchResponse) {
+    std::vector<std::vector<StepMatch>> matches(2);
+    StepMatch sm;
+    sm.id = "1234";
+    matches[1].push_back(sm);
+    StepMatchesBatchResponse response(matches);
+
+    EXPECT_THAT(
+        codec.encode(response), StrEq("[\"success\",[[],[{\"args\":[],\"id\":\"1234\"}]]]")
+    );
+}
+
+TEST_F(WireMessageCodecTest, handlesRunScenarioResponse) {
+    RunScenarioResponse::step_results_type stepResults;
+    stepResults.push_back(std::make_shared<SuccessResponse>());
+    stepResults.push_back(std::make_shared<FailureResponse>("M"));
+    stepResults.push_back(nullptr);
+    RunScenarioResponse response(stepResults);
+
+    EXPECT_THAT(
+        codec.encode(response),
+        StrEq("[\"success\",[[\"success\"],[\"fail\",{\"message\":\"M\"}],[\"skipped\"]]]")
+    );
+    EXPECT_EQ(
+        codec.encode(response),
+        nlohmann::json::from_msgpack(MessagePackWireMessageCodec().encode(response)).dump()
+    );
+}
+
 TEST_F(WireMessageCodecTest, handlesSnippetTextResponse) {
     SnippetTextResponse response("GIVEN(...)");
     EXPECT_THAT(codec.encode(response), StrEq("[\"success\",\"GIVEN(...)\"]"));
 }
 
+TEST_F(WireMessageCodecTest, handlesStatsResponse) {
+    WireStats stats;
+    stats.stepMatches = 10;
+    stats.stepMatchesCacheHits = 7;
+    stats.bytesDecoded = 300;
+    stats.bytesEncoded = 200;
+    stats.contexts = 2;
+    stats.hooks.count = 4;
+    stats.hooks.totalNanoseconds = 4000;
+    stats.invocations["12"].count = 1;
+    stats.invocations["12"].maxNanoseconds = 5;
+    stats.timed = true;
+    StatsResponse response(stats);
+
+    // clang-format off
+    EXPECT_THAT(codec.encode(response), StrEq(
+        "[\"success\",{"
+            "\"bytes_decoded\":300,"
+            "\"bytes_encoded\":200,"
+            "\"contexts\":2,"
+            "\"hooks\":{\"count\":4,\"max_ns\":0,\"p50_ns\":0,\"p99_ns\":0,\"total_ns\":4000},"
+            "\"invoke\":{"
+                "\"12\":{\"count\":1,\"max_ns\":5,\"p50_ns\":0,\"p99_ns\":0,\"total_ns\":0}"
+            "},"
+            "\"requests\":{\"count\":0,\"max_ns\":0,\"p50_ns\":0,\"p99_ns\":0,\"total_ns\":0},"
+            "\"step_matches\":{\"cache_hits\":7,\"count\":10},"
+            "\"timings\":\"enabled\""
+        "}]")
+    );
+    // clang-format on
+    EXPECT_EQ(
+        codec.encode(response),
+        nlohmann::json::from_msgpack(MessagePackWireMessageCodec().encode(response)).dump()
+    );
+}
+
 TEST_F(WireMessageCodecTest, encodesResponseUsingRawUtf8) {
     std::vector<StepMatch> matches;
     StepMatch sm1;
@@ -339,10 +542,193 @@ TEST_F(WireMessageCodecTest, encodesResponseUsingRawUtf8) {
     // clang-format on
 }
 
+TEST_F(WireMessageCodecTest, escapesSpecialCharactersInResponse) {
+    PendingResponse response("\"quoted\"\\\b\f\n\r\t\x01\x1f/");
+    EXPECT_THAT(
+        codec.encode(response),
+        StrEq("[\"pending\",\"\\\"quoted\\\"\\\\\\b\\f\\n\\r\\t\\u0001\\u001f/\"]")
+    );
+}
+
+TEST_F(WireMessageCodecTest, rejectsInvalidUtf8InResponse) {
+    EXPECT_THROW(codec.encode(PendingResponse("\xc3")), WireMessageCodecException);
+    EXPECT_THROW(codec.encode(PendingResponse("\xc0\xafoverlong")), WireMessageCodecException);
+    EXPECT_THROW(codec.encode(PendingResponse("\xed\xa0\x80surrogate")), WireMessageCodecException);
+}
+
+TEST(MessagePackWireMessageCodecTest, decodesAndEncodesMessagePack) {
+    const MessagePackWireMessageCodec codec;
+    MockCukeEngine engine;
+    EXPECT_CALL(engine, stepMatches("x")).WillOnce(Return(std::vector<StepMatch>(0)));
+
+    // ["step_matches", {"name_to_match": "x"}] => ["success", []]
+    const std::string request = "\x92\xacstep_matches\x81\xadname_to_match\xa1x";
+    EXPECT_EQ(codec.encode(*codec.decode(request)->run(engine)), "\x92\xa7success\x90");
+}
+
+TEST(WireProtocolHandlerTest, negotiatesMessagePackCodec) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+    ASSERT_FALSE(handler.usesBinaryFrames());
+
+    EXPECT_EQ(handler.handle(R"json(["negotiate_codec", {"codec": "msgpack"}])json"), "[\"success\"]");
+
+    EXPECT_TRUE(handler.usesBinaryFrames());
+    EXPECT_EQ(handler.handle("\x91\xa7unknown"), "\x91\xa4" "fail");
+}
+
+TEST(WireProtocolHandlerTest, countsTheBytesDecodedAndEncoded) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+    const std::uint64_t decoded = WireProtocolHandler::bytesDecoded();
+    const std::uint64_t encoded = WireProtocolHandler::bytesEncoded();
+
+    EXPECT_EQ(handler.handle("[\"unknown\"]"), "[\"fail\"]");
+
+    EXPECT_EQ(decoded + 11, WireProtocolHandler::bytesDecoded());
+    EXPECT_EQ(encoded + 8, WireProtocolHandler::bytesEncoded());
+}
+
+TEST(WireProtocolHandlerTest, refusesUnsupportedCodec) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+
+    EXPECT_EQ(
+        handler.handle(R"json(["negotiate_codec", {"codec": "xml"}])json"),
+        R"json(["fail",{"message":"Unsupported codec: xml"}])json"
+    );
+    EXPECT_FALSE(handler.usesBinaryFrames());
+}
+
+TEST(WireProtocolHandlerTest, handlesRequestsPreparedAhead) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+    EXPECT_CALL(engine, beginScenario(_)).Times(1);
+
+    const std::shared_ptr<const PreparedRequest> prepared =
+        handler.prepare(R"json(["begin_scenario"])json");
+    ASSERT_NE(nullptr, prepared);
+    EXPECT_EQ(nullptr, handler.prepare(R"json(["negotiate_codec", {"codec": "msgpack"}])json"));
+
+    // The request is not decoded again
+    EXPECT_EQ(handler.handlePrepared("", prepared.get()), "[\"success\"]");
+}
+
+TEST(WireProtocolHandlerTest, answersRepeatedStepMatchesFromItsCache) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+    const std::string request = R"json(["step_matches", {"name_to_match": "x"}])json";
+    EXPECT_CALL(engine, stepMatches("x")).Times(2).WillRepeatedly(Return(std::vector<StepMatch>()));
+
+    EXPECT_EQ(handler.handle(request), "[\"success\",[]]");
+    const std::shared_ptr<const PreparedRequest> prepared = handler.prepare(request);
+    EXPECT_NE(nullptr, prepared);
+    EXPECT_EQ(handler.handlePrepared(request, prepared.get()), "[\"success\",[]]");
+    EXPECT_EQ(handler.handle(request), "[\"success\",[]]");
+
+    // Matching settings changing flush the cache
+    StepManager::setFirstMatchOnly(false);
+    EXPECT_EQ(handler.handle(request), "[\"success\",[]]");
+}
+
+TEST(WireProtocolHandlerTest, preparesRepeatedStepMatchesAheadOfHandlingThem) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+    const std::string request = R"json(["step_matches", {"name_to_match": "x"}])json";
+    EXPECT_CALL(engine, stepMatches("x")).Times(2).WillRepeatedly(Return(std::vector<StepMatch>()));
+
+    // Read ahead as a pipelined session does, every request being prepared before it is handled
+    EXPECT_EQ(handler.handle(request), "[\"success\",[]]");
+    std::vector<std::shared_ptr<const PreparedRequest>> pipeline;
+    for (int i = 0; i < 3; ++i) {
+        pipeline.push_back(handler.prepare(request));
+        EXPECT_NE(nullptr, pipeline.back());
+    }
+    for (const std::shared_ptr<const PreparedRequest>& prepared : pipeline) {
+        EXPECT_EQ(handler.handlePrepared(request, prepared.get()), "[\"success\",[]]");
+    }
+
+    // Responses prepared before matching changed are not used
+    const std::shared_ptr<const PreparedRequest> stale = handler.prepare(request);
+    StepManager::setFirstMatchOnly(false);
+    EXPECT_EQ(handler.handlePrepared(request, stale.get()), "[\"success\",[]]");
+}
+
+TEST(WireProtocolHandlerTest, cachesNoStepMatchesFoundBeforeMatchingChanged) {
+    const JsonWireMessageCodec codec;
+    MockCukeEngine engine;
+    const WireProtocolHandler handler(codec, engine);
+    const std::string request = R"json(["step_matches", {"name_to_match": "x"}])json";
+    EXPECT_CALL(engine, stepMatches("x"))
+        .Times(2)
+        .WillOnce(InvokeWithoutArgs([&handler, &request] {
+            // Settings change while matching, then another request looks up the cache
+            StepManager::setFirstMatchOnly(false);
+            handler.prepare(request);
+            return std::vector<StepMatch>();
+        }))
+        .WillOnce(Return(std::vector<StepMatch>()));
+
+    EXPECT_EQ(handler.handle(request), "[\"success\",[]]");
+    EXPECT_EQ(handler.handle(request), "[\"success\",[]]");
+}
+
+TEST(WireRequestScratchTest, keepsTheScratchUntilTheOutermostRequestEnds) {
+    EXPECT_EQ(WireRequestScratch::resource(), std::pmr::new_delete_resource());
+    {
+        const WireRequestScratch request;
+        std::pmr::memory_resource* const scratch = WireRequestScratch::resource();
+        EXPECT_NE(scratch, std::pmr::new_delete_resource());
+        const std::shared_ptr<PendingResponse> response =
+            WireRequestScratch::make<PendingResponse>("outer");
+        {
+            const WireRequestScratch nestedRequest;
+            EXPECT_EQ(WireRequestScratch::resource(), scratch);
+        }
+        EXPECT_EQ(response->getMessage(), "outer");
+    }
+    EXPECT_EQ(WireRequestScratch::resource(), std::pmr::new_delete_resource());
+}
+
 /*
  * Command response
  */
 
+class ArgsKeepingCukeEngine : public MockCukeEngine {
+public:
+    void invokeStepMovingArgs(
+        const std::string& /*id*/, invoke_args_type&& args, invoke_table_type&& tableArg
+    ) override {
+        keptArgs = std::move(args);
+        keptTableArg = std::move(tableArg);
+    }
+
+    invoke_args_type keptArgs;
+    invoke_table_type keptTableArg;
+};
+
+TEST(WireCommandsTest, invokeMovesArgumentsIntoTheEngine) {
+    ArgsKeepingCukeEngine engine;
+    CukeEngine::invoke_args_type args(1, std::string(1024, 'a'));
+    const char* const argData = args[0].data();
+    CukeEngine::invoke_table_type tableArg(1, CukeEngine::invoke_args_type(1, "column"));
+    InvokeCommand invokeCommand("x", std::move(args), std::move(tableArg));
+    EXPECT_CALL(engine, invokeStep(_, _, _)).Times(0);
+
+    std::shared_ptr<const WireResponse> response(invokeCommand.run(engine));
+
+    EXPECT_PTRTYPE(SuccessResponse, response.get());
+    ASSERT_THAT(engine.keptArgs, SizeIs(1));
+    EXPECT_EQ(argData, engine.keptArgs[0].data());
+    EXPECT_THAT(engine.keptTableArg, ElementsAre(ElementsAre("column")));
+}
+
 TEST(WireCommandsTest, succesfulInvokeReturnsSuccess) {
     MockCukeEngine engine;
     InvokeCommand invokeCommand(
@@ -380,6 +766,29 @@ TEST(WireCommandsTest, throwingPendingStepReturnsPending) {
     // TODO Test S
 }
 
+class OutcomeReturningCukeEngine : public MockCukeEngine {
+public:
+    invoke_result_type tryInvokeStep(
+        const std::string& /*id*/, invoke_args_type&& /*args*/, invoke_table_type&& /*tableArg*/
+    ) override {
+        return InvokeFailureException("A", "B");
+    }
+};
+
+TEST(WireCommandsTest, returnedFailureInvokeReturnsFailure) {
+    OutcomeReturningCukeEngine engine;
+    InvokeCommand invokeCommand(
+        "x", CukeEngine::invoke_args_type(), CukeEngine::invoke_table_type()
+    );
+    EXPECT_CALL(engine, invokeStep(_, _, _)).Times(0);
+
+    std::shared_ptr<const WireResponse> response(invokeCommand.run(engine));
+    const FailureResponse* const failure = dynamic_cast<const FailureResponse*>(response.get());
+    ASSERT_NE(nullptr, failure);
+    EXPECT_EQ("A", failure->getMessage());
+    EXPECT_EQ("B", failure->getExceptionType());
+}
+
 TEST(WireCommandsTest, throwingAnythingInvokeReturnsFailure) {
     MockCukeEngine engine;
     InvokeCommand invokeCommand(
@@ -391,3 +800,26 @@ TEST(WireCommandsTest, throwingAnythingInvokeReturnsFailure) {
     EXPECT_PTRTYPE(FailureResponse, response.get());
     // TODO Test empty
 }
+
+TEST(WireCommandsTest, runScenarioSkipsTheStepsAfterAFailure) {
+    MockCukeEngine engine;
+    RunScenarioCommand::steps_type steps(3);
+    steps[0].id = "1";
+    steps[1].id = "2";
+    steps[2].id = "3";
+    RunScenarioCommand runScenarioCommand(CukeEngine::tags_type(), std::move(steps));
+    EXPECT_CALL(engine, beginScenario(_)).Times(1);
+    EXPECT_CALL(engine, invokeStep("1", _, _)).Times(1);
+    EXPECT_CALL(engine, invokeStep("2", _, _)).WillOnce(Throw(PendingStepException("S")));
+    EXPECT_CALL(engine, invokeStep("3", _, _)).Times(0);
+    EXPECT_CALL(engine, endScenario(_)).Times(1);
+
+    std::shared_ptr<const WireResponse> response(runScenarioCommand.run(engine));
+    const RunScenarioResponse* const results =
+        dynamic_cast<const RunScenarioResponse*>(response.get());
+    ASSERT_NE(nullptr, results);
+    ASSERT_THAT(results->getStepResults(), SizeIs(3));
+    EXPECT_PTRTYPE(SuccessResponse, results->getStepResults()[0].get());
+    EXPECT_PTRTYPE(PendingResponse, results->getStepResults()[1].get());
+    EXPECT_EQ(nullptr, results->getStepResults()[2]);
+}
@@ -0,0 +1,78 @@
+#include <cucumber-cpp/internal/connectors/wire/WireSession.hpp>
+
+#include "../utils/StepManagerTestDouble.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+
+using namespace cucumber::internal;
+
+namespace {
+
+class StepInfoBlocking : public StepInfo {
+public:
+    StepInfoBlocking(
+        const std::string& stepMatcher,
+        std::promise<void>& started,
+        std::shared_future<void> released
+    ) :
+        StepInfo(stepMatcher, ""),
+        started(started),
+        released(released) {
+    }
+
+    InvokeResult invokeStep(const InvokeArgs*) const override {
+        started.set_value();
+        released.wait_for(std::chrono::seconds(10));
+        return InvokeResult::success();
+    }
+
+private:
+    std::promise<void>& started;
+    const std::shared_future<void> released;
+};
+
+}
+
+class WireSessionTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        StepManagerTestDouble::clearSteps();
+    }
+};
+
+TEST_F(WireSessionTest, preparesARequestWhileHandlingAnother) {
+    std::promise<void> started;
+    std::promise<void> release;
+    const step_id_type id = StepManager::addStep(
+        std::make_shared<StepInfoBlocking>("blocks", started, release.get_future().share())
+    );
+    StepManagerTestDouble::addStepDefinition("matches");
+    const std::unique_ptr<const ProtocolHandler> session = newWireSession(false);
+    ASSERT_EQ("[\"success\"]", session->handle("[\"begin_scenario\"]"));
+
+    std::string invokeResponse;
+    std::thread handling([&] {
+        invokeResponse = session->handle(
+            "[\"invoke\",{\"id\":\"" + std::to_string(id) + "\",\"args\":[]}]"
+        );
+    });
+    EXPECT_EQ(
+        std::future_status::ready, started.get_future().wait_for(std::chrono::seconds(10))
+    );
+    const std::string request = "[\"step_matches\",{\"name_to_match\":\"matches\"}]";
+    const std::shared_ptr<const PreparedRequest> prepared = session->prepare(request);
+    release.set_value();
+    handling.join();
+
+    ASSERT_NE(nullptr, prepared);
+    EXPECT_EQ("[\"success\"]", invokeResponse);
+    EXPECT_NE(
+        std::string::npos, session->handlePrepared(request, prepared.get()).find("\"matches\"")
+    );
+    EXPECT_EQ("[\"success\"]", session->handle("[\"end_scenario\"]"));
+}
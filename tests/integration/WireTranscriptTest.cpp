@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/connectors/wire/WireTranscript.hpp>
+
+#include <sstream>
+#include <stdexcept>
+
+using namespace cucumber::internal;
+
+namespace {
+
+/**
+ * Answers every request with its length, prefixed by a per session counter
+ */
+class CountingProtocolHandler : public ProtocolHandler {
+public:
+    std::string handle(const std::string& request) const override {
+        return std::to_string(++requests) + ":" + std::to_string(request.size());
+    }
+
+private:
+    mutable int requests = 0;
+};
+
+std::unique_ptr<const ProtocolHandler> newCountingSession() {
+    return std::unique_ptr<const ProtocolHandler>(new CountingProtocolHandler());
+}
+
+}
+
+TEST(WireTranscriptTest, readsWhatWasWrittenIncludingLineBreaks) {
+    std::stringstream transcript;
+    WireTranscriptWriter writer(transcript);
+    const WireTranscriptEntry::session_type session = writer.newSession();
+    EXPECT_EQ(1u, session);
+    EXPECT_EQ(2u, writer.newSession());
+    writer.write(session, WireTranscriptEntry::REQUEST, "[\"begin_scenario\"]");
+    writer.write(2, WireTranscriptEntry::RESPONSE, std::string("a\nb\0c", 5));
+    writer.write(session, WireTranscriptEntry::RESPONSE, "");
+
+    WireTranscriptReader reader(transcript);
+    WireTranscriptEntry entry;
+    ASSERT_TRUE(reader.next(entry));
+    EXPECT_EQ(1u, entry.session);
+    EXPECT_EQ(WireTranscriptEntry::REQUEST, entry.direction);
+    EXPECT_EQ("[\"begin_scenario\"]", entry.message);
+    const std::uint64_t first = entry.microseconds;
+    ASSERT_TRUE(reader.next(entry));
+    EXPECT_EQ(2u, entry.session);
+    EXPECT_EQ(WireTranscriptEntry::RESPONSE, entry.direction);
+    EXPECT_EQ(std::string("a\nb\0c", 5), entry.message);
+    EXPECT_LE(first, entry.microseconds);
+    ASSERT_TRUE(reader.next(entry));
+    EXPECT_EQ("", entry.message);
+    EXPECT_FALSE(reader.next(entry));
+}
+
+TEST(WireTranscriptTest, failsOnMalformedTranscripts) {
+    for (const char* malformed : {"x", "1 1 ? 1 a\n", "1 1 > 5 abc\n", "1 1 > 1 ab\n"}) {
+        std::istringstream transcript(malformed);
+        WireTranscriptReader reader(transcript);
+        WireTranscriptEntry entry;
+        EXPECT_THROW(reader.next(entry), std::runtime_error) << malformed;
+    }
+}
+
+TEST(WireTranscriptTest, recordsRequestsAndResponsesOfEverySession) {
+    std::stringstream transcript;
+    WireTranscriptWriter writer(transcript);
+    RecordingProtocolHandler first(newCountingSession(), writer);
+    RecordingProtocolHandler second(newCountingSession(), writer);
+    EXPECT_EQ("1:3", first.handle("abc"));
+    EXPECT_EQ("1:1", second.handle("x"));
+    EXPECT_EQ("2:0", first.handle(""));
+    EXPECT_FALSE(first.usesBinaryFrames());
+
+    WireTranscriptReader reader(transcript);
+    WireTranscriptEntry entry;
+    std::vector<std::string> recorded;
+    while (reader.next(entry)) {
+        recorded.push_back(
+            std::to_string(entry.session) + static_cast<char>(entry.direction) + entry.message
+        );
+    }
+    EXPECT_EQ(
+        std::vector<std::string>({"1>abc", "1<1:3", "2>x", "2<1:1", "1>", "1<2:0"}), recorded
+    );
+}
+
+TEST(WireTranscriptTest, replaysSessionsComparingTheirResponses) {
+    std::stringstream transcript;
+    {
+        WireTranscriptWriter writer(transcript);
+        RecordingProtocolHandler first(newCountingSession(), writer);
+        RecordingProtocolHandler second(newCountingSession(), writer);
+        first.handle("abc");
+        second.handle("x");
+        first.handle("de");
+    }
+    const std::string recorded = transcript.str();
+
+    std::istringstream replayed(recorded);
+    WireTranscriptReplayer::Result result =
+        WireTranscriptReplayer(newCountingSession).replay(replayed);
+    EXPECT_EQ(3u, result.requests);
+    EXPECT_EQ(0u, result.mismatches);
+
+    std::string altered = recorded;
+    altered.replace(altered.find("1:3"), 3, "9:9");
+    std::istringstream alteredTranscript(altered);
+    std::ostringstream mismatches;
+    result = WireTranscriptReplayer(newCountingSession).replay(alteredTranscript, &mismatches);
+    EXPECT_EQ(3u, result.requests);
+    EXPECT_EQ(1u, result.mismatches);
+    EXPECT_NE(std::string::npos, mismatches.str().find("request abc"));
+    EXPECT_NE(std::string::npos, mismatches.str().find("recorded 9:9"));
+}
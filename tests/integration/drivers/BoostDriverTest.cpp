@@ -16,6 +16,14 @@ THEN(FAIL_MATCHER) {
     BOOST_CHECK(false);
 }
 
+THEN("^a throwing step$") {
+    throw std::runtime_error("thrown by the step");
+}
+
+THEN("^a failing critical check$") {
+    BOOST_REQUIRE(false);
+}
+
 THEN(PENDING_MATCHER_1) {
     pending();
 }
@@ -50,6 +58,13 @@ public:
     void runAllTests() override {
         stepInvocationInitsBoostTest();
         DriverTest::runAllTests();
+        exceptionsAreFailures();
+
+        std::cout << "= Lightweight execution =" << std::endl;
+        BoostStep::setLightweightExecution(true);
+        DriverTest::runAllTests();
+        exceptionsAreFailures();
+        BoostStep::setLightweightExecution(false);
     }
 
 private:
@@ -63,6 +78,26 @@ private:
         step.invokeStepBody();
         expectTrue("Framework is initialized after the first test", framework::is_initialized());
     }
+
+    void exceptionsAreFailures() {
+        std::cout << "= Exceptions =" << std::endl;
+        cukeCommands.beginScenario();
+        InvokeResult result = cukeCommands.invoke(
+            StepManagerTestDouble::getStepId("^a throwing step$"), &NO_INVOKE_ARGS
+        );
+        expectFalse("Throwing step", result.isSuccess() || result.isPending());
+        expectEqual(
+            "Throwing step has its message",
+            std::string("thrown by the step"),
+            result.getDescription()
+        );
+        result = cukeCommands.invoke(
+            StepManagerTestDouble::getStepId("^a failing critical check$"), &NO_INVOKE_ARGS
+        );
+        expectFalse("Failing critical check", result.isSuccess() || result.isPending());
+        expectFalse("Failing critical check has a message", result.getDescription().empty());
+        cukeCommands.endScenario();
+    }
 };
 
 int main() {
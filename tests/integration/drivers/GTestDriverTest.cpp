@@ -15,6 +15,11 @@ THEN(FAIL_MATCHER) {
     ASSERT_TRUE(false);
 }
 
+THEN("^two failed expectations$") {
+    EXPECT_EQ(1, 2);
+    EXPECT_EQ(3, 4);
+}
+
 THEN(PENDING_MATCHER_1) {
     pending();
 }
@@ -43,6 +48,12 @@ public:
     void runAllTests() override {
         stepInvocationInitsGTest();
         DriverTest::runAllTests();
+
+        std::cout << "= Collecting failures =" << std::endl;
+        GTestStep::setCollectingFailures(true);
+        DriverTest::runAllTests();
+        failedExpectationsAreCollected();
+        GTestStep::setCollectingFailures(false);
     }
 
 private:
@@ -55,6 +66,22 @@ private:
         framework.invokeStepBody();
         expectTrue("Framework is initialized after the first test", framework.isInitialized());
     }
+
+    void failedExpectationsAreCollected() {
+        cukeCommands.beginScenario();
+        const InvokeResult result = cukeCommands.invoke(
+            StepManagerTestDouble::getStepId("^two failed expectations$"), &NO_INVOKE_ARGS
+        );
+        expectFalse("Step with failed expectations", result.isSuccess() || result.isPending());
+        const std::string& description = result.getDescription();
+        const std::string::size_type first = description.find("Failure");
+        expectTrue(
+            "Both failures are described",
+            first != std::string::npos
+                && description.find("Failure", first + 1) != std::string::npos
+        );
+        cukeCommands.endScenario();
+    }
 };
 
 int main() {
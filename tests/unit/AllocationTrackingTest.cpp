@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/AllocationTracking.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+
+#include <sstream>
+
+using namespace cucumber::internal;
+
+CUKE_TRACK_ALLOCATIONS();
+
+TEST(AllocationTrackingTest, countsTheAllocationsOfTheThread) {
+    EXPECT_TRUE(AllocationTracking::isInstalled());
+
+    const AllocationCount before = AllocationTracking::thread();
+    // Calls of the operators themselves, which unlike new expressions are never elided
+    void* const block = ::operator new(1000);
+    const AllocationCount allocated = AllocationTracking::thread();
+    EXPECT_EQ(before.allocations + 1, allocated.allocations);
+    EXPECT_EQ(before.allocatedBytes + 1000, allocated.allocatedBytes);
+    EXPECT_EQ(before.freedBytes, allocated.freedBytes);
+
+    ::operator delete(block);
+    EXPECT_EQ(allocated.freedBytes + 1000, AllocationTracking::thread().freedBytes);
+    EXPECT_GT(AllocationTracking::peakResidentBytes(), 0);
+}
+
+TEST(AllocationTrackingTest, recordsTheBytesStepsAndScenariosRetain) {
+    const step_id_type stepId = 434343;
+    Timings::setAllocationTracking(true);
+    const AllocationSample scenarioStart = AllocationTracking::sample();
+    void* retained = nullptr;
+    {
+        const ScopedAllocations allocations(stepId);
+        retained = ::operator new(4096);
+        ::operator delete(::operator new(100));
+    }
+    Timings::recordScenarioAllocations(scenarioStart);
+    Timings::setAllocationTracking(false);
+    {
+        const ScopedAllocations allocations(stepId);
+    }
+
+    const TimingSnapshot snapshot = Timings::snapshot();
+    ASSERT_EQ(1, snapshot.stepAllocations.count(stepId));
+    const AllocationHistograms& step = snapshot.stepAllocations.at(stepId);
+    EXPECT_EQ(1, step.bytes.getCount());
+    EXPECT_EQ(2, step.allocations.getTotal());
+    EXPECT_EQ(4196, step.bytes.getTotal());
+    EXPECT_EQ(4096, step.retainedBytes.getTotal());
+    EXPECT_GE(snapshot.scenarioAllocations.retainedBytes.getTotal(), 4096);
+
+    std::ostringstream report;
+    Timings::report(report);
+    EXPECT_NE(std::string::npos, report.str().find("Allocations"));
+    EXPECT_NE(std::string::npos, report.str().find("step 434343"));
+    ::operator delete(retained);
+}
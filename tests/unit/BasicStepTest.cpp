@@ -33,3 +33,15 @@ TEST(BasicStepTest, handlesPendingSteps) {
     ASSERT_TRUE(result.isPending());
     ASSERT_STREQ(PENDING_STEP_DESCRIPTION, result.getDescription().c_str());
 }
+
+TEST(BasicStepTest, invokeResultsKeepTheirDescriptionWhenCopiedOrMoved) {
+    EXPECT_EQ("", InvokeResult::success().getDescription());
+    EXPECT_EQ("", InvokeResult::pending(nullptr).getDescription());
+
+    const InvokeResult failure = InvokeResult::failure(std::string("failed"));
+    InvokeResult copy = failure;
+    const InvokeResult moved = std::move(copy);
+    EXPECT_EQ(FAILURE, moved.getType());
+    EXPECT_EQ("failed", moved.getDescription());
+    EXPECT_EQ("failed", failure.getDescription());
+}
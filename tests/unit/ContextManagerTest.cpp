@@ -2,7 +2,10 @@
 
 #include "utils/ContextManagerTestDouble.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <string>
 
 using namespace cucumber::internal;
 
@@ -25,29 +28,95 @@ class Context1 {};
 class Context2 {};
 
 TEST_F(ContextManagerTest, createsValidContextPointers) {
-    std::weak_ptr<Context1> ctx1 = contextManager.addContext<Context1>();
+    Context1* ctx1 = contextManager.addContext<Context1>();
     ASSERT_EQ(1, contextManager.countContexts());
-    ASSERT_FALSE(ctx1.expired());
-    std::weak_ptr<Context2> ctx2 = contextManager.addContext<Context2>();
+    ASSERT_TRUE(ctx1 != NULL);
+    Context2* ctx2 = contextManager.addContext<Context2>();
     ASSERT_EQ(2, contextManager.countContexts());
-    ASSERT_FALSE(ctx2.expired());
+    ASSERT_TRUE(ctx2 != NULL);
 }
 
 TEST_F(ContextManagerTest, allowsCreatingTheSameContextTypeTwice) {
-    std::weak_ptr<Context1> ctx1 = contextManager.addContext<Context1>();
+    Context1* ctx1 = contextManager.addContext<Context1>();
     ASSERT_EQ(1, contextManager.countContexts());
-    ASSERT_FALSE(ctx1.expired());
-    std::weak_ptr<Context1> ctx2 = contextManager.addContext<Context1>();
+    Context1* ctx2 = contextManager.addContext<Context1>();
     ASSERT_EQ(2, contextManager.countContexts());
-    ASSERT_FALSE(ctx2.expired());
-    ASSERT_NE(ctx1.lock(), ctx2.lock());
+    ASSERT_NE(ctx1, ctx2);
 }
 
 TEST_F(ContextManagerTest, purgesContexts) {
-    std::weak_ptr<Context1> ctx1 = contextManager.addContext<Context1>();
+    contextManager.addContext<Context1>();
     ASSERT_EQ(1, contextManager.countContexts());
-    ASSERT_FALSE(ctx1.expired());
     contextManager.purgeContexts();
     ASSERT_EQ(0, contextManager.countContexts());
-    ASSERT_TRUE(ctx1.expired());
+}
+
+namespace {
+std::string destroyed;
+
+template<char Name>
+struct DestroyedContext {
+    ~DestroyedContext() {
+        destroyed += Name;
+    }
+};
+
+struct alignas(64) OverAlignedContext {
+    char data[100];
+};
+
+struct ThrowingContext {
+    ThrowingContext() {
+        throw std::runtime_error("context");
+    }
+};
+}
+
+TEST_F(ContextManagerTest, destroysContextsInReverseOrderOfCreation) {
+    destroyed.clear();
+    contextManager.addContext<DestroyedContext<'a'>>();
+    contextManager.addContext<DestroyedContext<'b'>>();
+    contextManager.addContext<DestroyedContext<'c'>>();
+    EXPECT_EQ("", destroyed);
+    contextManager.purgeContexts();
+    EXPECT_EQ("cba", destroyed);
+}
+
+TEST_F(ContextManagerTest, alignsContextsAcrossBlocks) {
+    for (int i = 0; i < 200; ++i) {
+        const OverAlignedContext* context = contextManager.addContext<OverAlignedContext>();
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(context) % alignof(OverAlignedContext));
+    }
+    EXPECT_EQ(200, contextManager.countContexts());
+}
+
+TEST_F(ContextManagerTest, contextsThatFailToConstructAreNotKept) {
+    EXPECT_THROW(contextManager.addContext<ThrowingContext>(), std::runtime_error);
+    EXPECT_EQ(0, contextManager.countContexts());
+}
+
+TEST_F(ContextManagerTest, countsTheContextsAliveInTheProcess) {
+    const ContextArena::size_type alive = ContextArena::liveContexts();
+    contextManager.addContext<Context1>();
+    contextManager.addContext<Context2>();
+    EXPECT_EQ(alive + 2, ContextArena::liveContexts());
+    EXPECT_THROW(contextManager.addContext<ThrowingContext>(), std::runtime_error);
+    EXPECT_EQ(alive + 2, ContextArena::liveContexts());
+    contextManager.purgeContexts();
+    EXPECT_EQ(alive, ContextArena::liveContexts());
+}
+
+TEST_F(ContextManagerTest, destroysPurgedContextsInTheBackgroundWhenAsked) {
+    destroyed.clear();
+    ContextArena::setBackgroundTeardown(1024 * 1024);
+    contextManager.addContext<DestroyedContext<'a'>>();
+    contextManager.addContext<DestroyedContext<'b'>>();
+    contextManager.purgeContexts();
+    EXPECT_EQ(0, contextManager.countContexts());
+    contextManager.addContext<DestroyedContext<'c'>>();
+    contextManager.purgeContexts();
+
+    ContextArena::waitForTeardown();
+    EXPECT_EQ("bac", destroyed);
+    ContextArena::setBackgroundTeardown(0);
 }
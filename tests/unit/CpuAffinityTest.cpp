@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/utils/CpuAffinity.hpp>
+
+#include <stdexcept>
+
+using namespace cucumber::internal;
+
+TEST(CpuAffinityTest, parsesCpusAndRanges) {
+    EXPECT_EQ(cpu_list_type({0, 1, 2, 3, 8}), parseCpuList("0-3,8"));
+    EXPECT_EQ(cpu_list_type({5}), parseCpuList("5"));
+    EXPECT_EQ(cpu_list_type({2, 10, 11}), parseCpuList("2,10-11"));
+}
+
+TEST(CpuAffinityTest, rejectsMalformedLists) {
+    EXPECT_THROW(parseCpuList(""), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("1,"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("a"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("1-2-3"), std::invalid_argument);
+}
+
+TEST(CpuAffinityTest, handsCpusOutInTurn) {
+    CpuRotation rotation;
+    EXPECT_TRUE(rotation.empty());
+    EXPECT_TRUE(rotation.take().empty());
+
+    rotation.assign({4, 6});
+    EXPECT_EQ(cpu_list_type({4}), rotation.take());
+    EXPECT_EQ(cpu_list_type({6}), rotation.take());
+    EXPECT_EQ(cpu_list_type({4}), rotation.take());
+}
+
+#if defined(__linux__)
+TEST(CpuAffinityTest, restoresTheCpusOfThreadsPinnedInScope) {
+    const cpu_list_type allowed = threadCpus();
+    ASSERT_FALSE(allowed.empty());
+    {
+        ScopedThreadPin pin(allowed.back());
+        EXPECT_EQ(cpu_list_type({allowed.back()}), threadCpus());
+    }
+    EXPECT_EQ(allowed, threadCpus());
+}
+#endif
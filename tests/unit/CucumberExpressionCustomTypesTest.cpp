@@ -4,20 +4,29 @@
 #include <regex>
 #include <filesystem>
 
+#include "utils/TemporaryPath.hpp"
+
 using namespace cucumber::internal;
 
 class CucumberExpressionCustomTypesTest : public ::testing::Test {
 protected:
     std::string testJsonFile = "custom_parameter_types.json";
+    std::filesystem::path workingDirectory;
+    std::filesystem::path previousWorkingDirectory;
     
     void SetUp() override {
-        // Clean up any existing test file
-        std::filesystem::remove(testJsonFile);
+        // The default file is read from the working directory, one per test
+        workingDirectory = temporaryTestPath("");
+        std::filesystem::create_directories(workingDirectory);
+        previousWorkingDirectory = std::filesystem::current_path();
+        std::filesystem::current_path(workingDirectory);
+        ParameterTypeRegistry::clear();
     }
     
     void TearDown() override {
-        // Clean up test file after each test
-        std::filesystem::remove(testJsonFile);
+        std::filesystem::current_path(previousWorkingDirectory);
+        std::filesystem::remove_all(workingDirectory);
+        ParameterTypeRegistry::clear();
     }
     
     void CreateCustomTypesFile(const std::string& content) {
@@ -91,12 +100,13 @@ TEST_F(CucumberExpressionCustomTypesTest, ValidCustomTypesFile) {
         }
     ])");
     
-    // Note: We need to force reload by restarting the process
-    // For now, this test documents the expected behavior
-    // In a real scenario, the file should be created before the process starts
-    
-    // This test will fail in the current run because getParameterTypes() is static
-    // But documents the expected usage
+    // Read when {color} is first looked for
+    TestExpression(
+        "I have a {color} ball",
+        {"I have a red ball", "I have a blue ball"},
+        {"I have a orange ball"}
+    );
+    TestExpression("The person is {gender}", {"The person is male"}, {"The person is other"});
 }
 
 // Test with empty JSON array
@@ -189,3 +199,79 @@ TEST_F(CucumberExpressionCustomTypesTest, DISABLED_IntegrationTest_CustomGenderT
         {"The person is other", "The person is"}
     );
 }
+
+// Test defining custom types programmatically
+TEST_F(CucumberExpressionCustomTypesTest, DefinedTypes) {
+    ParameterTypeRegistry::define("color", "red|blue");
+    TestExpression("I have a {color} ball", {"I have a blue ball"}, {"I have a green ball"});
+
+    // Conversions made before a change are not reused
+    ParameterTypeRegistry::define("color", "green");
+    TestExpression("I have a {color} ball", {"I have a green ball"}, {"I have a blue ball"});
+
+    ParameterTypeRegistry::clear();
+    EXPECT_THROW(cukex::transform("I have a {color} ball"), CucumberExpressionpressionException);
+}
+
+// Test that defining invalid custom types throws
+TEST_F(CucumberExpressionCustomTypesTest, InvalidDefinedTypesThrow) {
+    EXPECT_THROW(ParameterTypeRegistry::define("int", "\\d+"), CucumberExpressionpressionException);
+    EXPECT_THROW(ParameterTypeRegistry::define("color", "red("), CucumberExpressionpressionException);
+}
+
+// Test loading custom types from a given file
+TEST_F(CucumberExpressionCustomTypesTest, LoadedTypes) {
+    CreateCustomTypesFile(R"([{"name": "gender", "regexp": "male|female"}])");
+    ParameterTypeRegistry::load(testJsonFile);
+    TestExpression("The person is {gender}", {"The person is female"}, {"The person is other"});
+
+    CreateCustomTypesFile(R"([{"name": "color"}])");
+    EXPECT_THROW(ParameterTypeRegistry::load(testJsonFile), CucumberExpressionpressionException);
+    EXPECT_THROW(
+        ParameterTypeRegistry::load("missing_parameter_types.json"),
+        CucumberExpressionpressionException
+    );
+    // Failed loads leave the types unchanged
+    TestExpression("The person is {gender}", {"The person is male"}, {});
+}
+
+// Test that custom types are matched without the regular expression of the expression
+TEST_F(CucumberExpressionCustomTypesTest, MatcherRunsCustomTypes) {
+    ParameterTypeRegistry::define("pair", "(a)(b)?");
+    const std::shared_ptr<const CucumberExpressionMatcher> matcher =
+        cukex::matcher("pairs {pair} {int}");
+    ASSERT_TRUE(matcher);
+
+    std::shared_ptr<RegexMatch> match = matcher->find("pairs ab 12");
+    ASSERT_TRUE(match->matches());
+    ASSERT_EQ(4, match->getSubmatches().size());
+    EXPECT_EQ("ab", match->getSubmatches()[0].value);
+    EXPECT_EQ("a", match->getSubmatches()[1].value);
+    EXPECT_EQ("b", match->getSubmatches()[2].value);
+    EXPECT_EQ("12", match->getSubmatches()[3].value);
+}
+
+// Test that transformers convert each distinct text once
+TEST_F(CucumberExpressionCustomTypesTest, TransformedTypes) {
+    int transformations = 0;
+    ParameterTypeRegistry::define("length", "\\d+ cm", [&transformations](std::string_view text) {
+        ++transformations;
+        return std::stoi(std::string(text.substr(0, text.find(' '))));
+    });
+
+    ParameterTypeRegistry::transformMatched("length", "12 cm");
+    EXPECT_EQ(1, transformations);
+    ASSERT_TRUE(ParameterTypeRegistry::transformed<int>("12 cm"));
+    EXPECT_EQ(12, *ParameterTypeRegistry::transformed<int>("12 cm"));
+    EXPECT_EQ(1, transformations);
+    EXPECT_EQ(3, *ParameterTypeRegistry::transformed<int>("3 cm"));
+    EXPECT_EQ(2, transformations);
+    EXPECT_FALSE(ParameterTypeRegistry::transformed<long>("12 cm"));
+
+    // Errors are left to the steps reading the parameter
+    ParameterTypeRegistry::transformMatched("length", "x cm");
+    EXPECT_THROW(ParameterTypeRegistry::transformed<int>("x cm"), std::invalid_argument);
+
+    ParameterTypeRegistry::define("length", "\\d+ cm");
+    EXPECT_FALSE(ParameterTypeRegistry::transformed<int>("12 cm"));
+}
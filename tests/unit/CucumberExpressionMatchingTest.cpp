@@ -305,3 +305,47 @@ TEST_F(CucumberExpressionMatchingTest, TextCaseSensitive) {
 TEST_F(CucumberExpressionMatchingTest, WordParameterMatchesNonWhitespace) {
     TestMatches("{word}", "hello-world");
 }
+
+// ============================================================================
+// Matching Without Regular Expressions
+// ============================================================================
+
+namespace {
+void ExpectSameAsRegex(const std::string& expression, const std::string& text) {
+    const std::shared_ptr<const CucumberExpressionMatcher> matcher = cukex::matcher(expression);
+    ASSERT_TRUE(matcher) << "Expression '" << expression << "' should have a matcher";
+
+    std::shared_ptr<RegexMatch> expected = cukex::compile(expression).find(text);
+    std::shared_ptr<RegexMatch> actual = matcher->find(text);
+    ASSERT_EQ(expected->matches(), actual->matches())
+        << "Expression '" << expression << "' on '" << text << "'";
+    ASSERT_EQ(expected->getSubmatches().size(), actual->getSubmatches().size());
+    for (std::size_t i = 0; i < expected->getSubmatches().size(); ++i) {
+        EXPECT_EQ(expected->getSubmatches()[i].value, actual->getSubmatches()[i].value);
+        EXPECT_EQ(expected->getSubmatches()[i].position, actual->getSubmatches()[i].position);
+    }
+}
+}
+
+TEST_F(CucumberExpressionMatchingTest, MatcherAgreesWithRegex) {
+    ExpectSameAsRegex("I have {int} cucumber(s)", "I have 42 cucumbers");
+    ExpectSameAsRegex("I have {int} cucumber(s)", "I have -1 cucumber");
+    ExpectSameAsRegex("I have {int} cucumber(s)", "I have 4.2 cucumbers");
+    // Parameters give back characters to the text following them
+    ExpectSameAsRegex("{int}0 {word}s", "100 cats");
+    ExpectSameAsRegex("{word}{word}", "abc");
+    ExpectSameAsRegex("I say {string} to {}", "I say \"hi \\\"there\\\"\" to 'you'");
+    ExpectSameAsRegex("I say {string} to {}", "I say 'héllo' to you");
+    ExpectSameAsRegex("I say {string}", "I say \"unterminated");
+    ExpectSameAsRegex("a/b/cd {}", "cd ");
+    ExpectSameAsRegex("a/b/cd {}", "ab x");
+}
+
+TEST_F(CucumberExpressionMatchingTest, MatcherOnlyForSupportedExpressions) {
+    EXPECT_TRUE(cukex::matcher("there is/are {int} flight(s)"));
+    EXPECT_FALSE(cukex::matcher("I weigh {float} kg"));
+    EXPECT_FALSE(cukex::matcher("cat/dog(s)"));
+
+    EXPECT_TRUE(CucumberExpressionMatcher::handles("I have 42 cucumbers\t"));
+    EXPECT_FALSE(CucumberExpressionMatcher::handles("I have 42\ncucumbers"));
+}
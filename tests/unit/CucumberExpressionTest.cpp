@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <cucumber-cpp/internal/utils/CucumberExpression.hpp>
 #include <regex>
+#include <thread>
 
 using namespace cucumber::internal;
 
@@ -261,3 +262,56 @@ TEST_F(CucumberExpressionpressionTest, SpecialCharactersInLiterals) {
         {"test string: value", "test string: [value"}
     );
 }
+
+// Test compiling an expression directly to a Regex
+TEST_F(CucumberExpressionpressionTest, CompileMatchesTransform) {
+    const std::string expression = "I have {int} cucumber(s)";
+    Regex regex = cukex::compile(expression);
+
+    EXPECT_EQ(cukex::transform(expression), regex.str());
+    std::shared_ptr<RegexMatch> match(regex.find("I have 42 cucumbers"));
+    ASSERT_TRUE(match->matches());
+    ASSERT_EQ(1, match->getSubmatches().size());
+    EXPECT_EQ("42", match->getSubmatches()[0].value);
+
+    EXPECT_THROW(cukex::compile("I have {"), CucumberExpressionpressionException);
+}
+
+// Test listing parameters with the capture group of each
+TEST_F(CucumberExpressionpressionTest, ParametersSkipGroupsOfParameterTypes) {
+    const std::vector<CucumberExpressionParameter> parameters =
+        cukex::parameters("I say {string} {int} times");
+
+    ASSERT_EQ(2, parameters.size());
+    EXPECT_EQ("string", parameters[0].type);
+    EXPECT_EQ(0, parameters[0].group);
+    EXPECT_EQ("int", parameters[1].type);
+    EXPECT_EQ(5, parameters[1].group);
+
+    EXPECT_TRUE(cukex::parameters("I have cucumbers").empty());
+}
+
+// Test that cached conversions agree across threads and calls
+TEST_F(CucumberExpressionpressionTest, CachedTransformsAgreeAcrossThreads) {
+    const std::string expression = "there is/are {int} {word} flight(s)";
+    const std::string expected = cukex::transformUnchecked(expression);
+
+    std::vector<std::string> regexes(4);
+    std::vector<std::thread> threads;
+    for (std::vector<std::string>::size_type i = 0; i < regexes.size(); ++i) {
+        threads.emplace_back([&regexes, &expression, i] {
+            regexes[i] = cukex::transform(expression);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const std::string& regex : regexes) {
+        EXPECT_EQ(expected, regex);
+    }
+    EXPECT_EQ(2, cukex::parameters(expression).size());
+
+    // Invalid expressions are not cached
+    EXPECT_THROW(cukex::transform("I have {"), CucumberExpressionpressionException);
+    EXPECT_THROW(cukex::transform("I have {"), CucumberExpressionpressionException);
+}
@@ -76,6 +76,14 @@ TEST_F(CucumberExpressionTransformationTest, AlternationWithOptional) {
     TestTransformation("a/b(c)", "^(?:a|b(?:c)?)$");
 }
 
+// Test: Parameter types and optional text with whitespace delimit alternatives
+TEST_F(CucumberExpressionTransformationTest, AlternationNextToParameterAndOptional) {
+    TestTransformation("{int}s/es", "^(-?\\d+)(?:s|es)$");
+    TestTransformation("(a b)c/d", "^(?:(?:a b)?c|d)$");
+    TestTransformation("and\\/or/nor", "^(?:and/or|nor)$");
+    TestTransformation("too /many", "^too many$");
+}
+
 // Test: Regex special characters escaping
 // From: testdata/cucumber-expression/transformation/escape-regex-characters.yaml
 // Note: The `{}` in the expression is interpreted as a parameter type (anonymous), generating (.*)
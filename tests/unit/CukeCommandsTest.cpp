@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cucumber-cpp/internal/CukeEngineImpl.hpp>
 #include <cucumber-cpp/internal/step/StepMacros.hpp>
 #include "utils/CukeCommandsFixture.hpp"
 
@@ -99,6 +100,85 @@ TEST_F(CukeCommandsTest, invokeHandlesParametersWithFuncArgs) {
     runStepBodyTest<CheckAllParametersWithFuncArgs>();
 }
 
+class CheckArgumentsAfterStringParameter : public GenericStep {
+public:
+    void bodyWithArgs(const std::string& quoted, const int times) {
+        EXPECT_EQ("\"hello\"", quoted);
+        EXPECT_EQ(3, times);
+    }
+
+    void body() override {
+        return invokeWithArgs(*this, &CheckArgumentsAfterStringParameter::bodyWithArgs);
+    }
+};
+
+class IntegerArgumentForFloatParameter : public GenericStep {
+public:
+    void bodyWithArgs(const int) {
+    }
+
+    void body() override {
+        return invokeWithArgs(*this, &IntegerArgumentForFloatParameter::bodyWithArgs);
+    }
+};
+
+TEST_F(CukeCommandsTest, invokeBindsFuncArgsToCucumberExpressionParameters) {
+    addStepToManager<CheckArgumentsAfterStringParameter>("I say {string} {int} times");
+    MatchResult result = stepMatches("I say \"hello\" 3 times");
+    ASSERT_EQ(1, result.getResultSet().size());
+
+    InvokeArgs args;
+    for (const RegexSubmatch& submatch : result.getResultSet().at(0).submatches) {
+        args.addArg(submatch.value);
+    }
+    // The real test is in TestClass::bodyWithArgs()
+    invoke(stepId, &args);
+}
+
+struct Dimensions {
+    int width, height;
+};
+
+class CheckTransformedArguments : public GenericStep {
+public:
+    void bodyWithArgs(const Dimensions& dimensions) {
+        EXPECT_EQ(3, dimensions.width);
+        EXPECT_EQ(4, dimensions.height);
+    }
+
+    void body() override {
+        return invokeWithArgs(*this, &CheckTransformedArguments::bodyWithArgs);
+    }
+};
+
+TEST_F(CukeCommandsTest, invokePassesTransformedCustomParameters) {
+    ParameterTypeRegistry::define("dimensions", "\\d+x\\d+", [](std::string_view text) {
+        const std::string::size_type x = text.find('x');
+        return Dimensions{
+            std::stoi(std::string(text.substr(0, x))), std::stoi(std::string(text.substr(x + 1)))
+        };
+    });
+    addStepToManager<CheckTransformedArguments>("a {dimensions} box");
+
+    InvokeArgs args;
+    args.addArg("3x4");
+    // The real test is in TestClass::bodyWithArgs()
+    EXPECT_EQ(SUCCESS, invoke(stepId, &args).getType());
+    ParameterTypeRegistry::clear();
+}
+
+TEST_F(CukeCommandsTest, rejectsFuncArgsNotMatchingCucumberExpressionParameters) {
+    EXPECT_THROW(
+        addStepToManager<CheckArgumentsAfterStringParameter>("I say {string}"),
+        std::invalid_argument
+    );
+    EXPECT_THROW(
+        addStepToManager<IntegerArgumentForFloatParameter>("I weigh {float} kg"),
+        std::invalid_argument
+    );
+    EXPECT_NO_THROW(addStepToManager<IntegerArgumentForFloatParameter>("I am (\\d+\\.\\d+) m"));
+}
+
 TEST_F(CukeCommandsTest, matchesCorrectly) {
     addStepWithMatcher(STATIC_MATCHER);
     MatchResult result = stepMatches(STATIC_MATCHER);
@@ -115,6 +195,44 @@ TEST_F(CukeCommandsTest, invokeHandlesParametersWithMacro) {
     runStepBodyTest<CheckAllParametersWithMacro>();
 }
 
+class ConstructionCountingStep : public GenericStep {
+public:
+    static int constructions;
+
+    ConstructionCountingStep() {
+        ++constructions;
+    }
+
+    void body() override {
+        REGEX_PARAM(string, outcome);
+        if (outcome == "pending") {
+            pending("later");
+        }
+    }
+};
+
+int ConstructionCountingStep::constructions = 0;
+
+TEST_F(CukeCommandsTest, reusesStepInstancesWhenAsked) {
+    addStepToManager<ConstructionCountingStep>(STATIC_MATCHER);
+    InvokeArgs pendingArgs;
+    pendingArgs.addArg("pending");
+    InvokeArgs passingArgs;
+    passingArgs.addArg("passing");
+    ConstructionCountingStep::constructions = 0;
+
+    EXPECT_TRUE(invoke(stepId, &passingArgs).isSuccess());
+    EXPECT_TRUE(invoke(stepId, &passingArgs).isSuccess());
+    EXPECT_EQ(2, ConstructionCountingStep::constructions);
+
+    cucumber::internal::StepManager::setInstanceReuse(true);
+    EXPECT_TRUE(invoke(stepId, &pendingArgs).isPending());
+    EXPECT_TRUE(invoke(stepId, &passingArgs).isSuccess());
+    EXPECT_TRUE(invoke(stepId, &passingArgs).isSuccess());
+    cucumber::internal::StepManager::setInstanceReuse(false);
+    EXPECT_EQ(3, ConstructionCountingStep::constructions);
+}
+
 TEST_F(CukeCommandsTest, producesSnippetsEscapingTitle) {
     EXPECT_EQ(
         "THEN(\"^x\\\\|y\\\"z$\") {\n"
@@ -124,6 +242,28 @@ TEST_F(CukeCommandsTest, producesSnippetsEscapingTitle) {
     );
 }
 
+TEST_F(CukeCommandsTest, producesSnippetsForMultilineArguments) {
+    EXPECT_EQ(
+        "WHEN(\"^a \\\\(table\\\\)$\") {\n"
+        "    TABLE_PARAM(data_table);\n"
+        "    pending();\n"
+        "}\n",
+        snippetText("When", "a (table)", "DataTable")
+    );
+}
+
+TEST(CukeEngineSnippetsTest, producesASnippetPerDistinctStepName) {
+    const std::vector<std::string> snippets = CukeEngineImpl().snippetTexts({
+        {"Given", "b", ""},
+        {"When", "a", ""},
+        {"Then", "b", "DocString"},
+    });
+
+    ASSERT_EQ(2, snippets.size());
+    EXPECT_EQ("GIVEN(\"^b$\") {\n    pending();\n}\n", snippets[0]);
+    EXPECT_EQ("WHEN(\"^a$\") {\n    pending();\n}\n", snippets[1]);
+}
+
 TEST_F(CukeCommandsTest, escapesCaractersInRegexes) {
     //  abc|()[]{}^$*+?.\def  <=  abc\|\(\)\[\]\{\}\^\$\*\+\?\.\\def
     EXPECT_EQ(
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/DurationHistory.hpp>
+
+#include "utils/TemporaryPath.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace cucumber::internal;
+
+namespace {
+
+std::chrono::nanoseconds seconds(int count) {
+    return std::chrono::seconds(count);
+}
+
+}
+
+class DurationHistoryFileTest : public ::testing::Test {
+protected:
+    const std::string path = temporaryTestPath(".log").string();
+
+    void SetUp() override {
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST(DurationHistoryTest, averagesDurationsWithEarlierOnes) {
+    DurationHistory history;
+    EXPECT_FALSE(history.expected(DurationHistory::SCENARIO, 1));
+    EXPECT_FALSE(history.average(DurationHistory::SCENARIO));
+
+    history.record(DurationHistory::SCENARIO, 1, seconds(1));
+    history.record(DurationHistory::SCENARIO, 1, seconds(3));
+    history.record(DurationHistory::SCENARIO, 2, seconds(6));
+    history.record(DurationHistory::STEP, 1, seconds(10));
+
+    EXPECT_EQ(seconds(2), history.expected(DurationHistory::SCENARIO, 1));
+    EXPECT_EQ(seconds(4), history.average(DurationHistory::SCENARIO));
+    EXPECT_EQ(seconds(10), history.expected(DurationHistory::STEP, 1));
+}
+
+TEST(DurationHistoryTest, keysAreStableHashesOfText) {
+    EXPECT_EQ(14695981039346656037ull, DurationHistory::key(""));
+    EXPECT_EQ(DurationHistory::key("a step"), DurationHistory::key("a step"));
+    EXPECT_NE(DurationHistory::key("a step"), DurationHistory::key("another step"));
+}
+
+TEST_F(DurationHistoryFileTest, keepsDurationsBetweenRuns) {
+    {
+        DurationHistory history(path);
+        history.record(DurationHistory::SCENARIO, 1, seconds(1));
+        history.record(DurationHistory::SCENARIO, 1, seconds(3));
+        history.record(DurationHistory::STEP, 7, seconds(5));
+    }
+    {
+        DurationHistory history(path);
+        EXPECT_EQ(seconds(2), history.expected(DurationHistory::SCENARIO, 1));
+        EXPECT_EQ(seconds(5), history.expected(DurationHistory::STEP, 7));
+        history.record(DurationHistory::STEP, 7, seconds(1));
+    }
+    // Compacted to a record per duration when opened
+    EXPECT_EQ(8 + 3 * 17, std::filesystem::file_size(path));
+
+    DurationHistory history(path);
+    EXPECT_EQ(seconds(3), history.expected(DurationHistory::STEP, 7));
+    EXPECT_EQ(8 + 2 * 17, std::filesystem::file_size(path));
+}
+
+TEST_F(DurationHistoryFileTest, dropsRecordsCutShort) {
+    {
+        DurationHistory history(path);
+        history.record(DurationHistory::SCENARIO, 1, seconds(1));
+    }
+    std::ofstream(path, std::ios::binary | std::ios::app) << "\x01partial";
+
+    DurationHistory history(path);
+    EXPECT_EQ(seconds(1), history.expected(DurationHistory::SCENARIO, 1));
+    EXPECT_EQ(8 + 17, std::filesystem::file_size(path));
+}
+
+TEST_F(DurationHistoryFileTest, convertsTextScenarioHistories) {
+    std::ofstream(path, std::ios::binary) << "00000000000000ff 2000000000\n"
+                                             "0000000000000001 5\n";
+
+    {
+        DurationHistory history(path);
+        EXPECT_EQ(seconds(2), history.expected(DurationHistory::SCENARIO, 0xff));
+        EXPECT_EQ(std::chrono::nanoseconds(5), history.expected(DurationHistory::SCENARIO, 1));
+    }
+    EXPECT_EQ(8 + 2 * 17, std::filesystem::file_size(path));
+}
+
+TEST_F(DurationHistoryFileTest, leavesOtherFilesUntouched) {
+    std::ofstream(path, std::ios::binary) << "not a duration history";
+
+    EXPECT_THROW(DurationHistory history(path), std::runtime_error);
+    std::ifstream in(path, std::ios::binary);
+    std::string content;
+    std::getline(in, content);
+    EXPECT_EQ("not a duration history", content);
+}
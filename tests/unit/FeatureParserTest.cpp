@@ -0,0 +1,295 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/gherkin/FeatureParser.hpp>
+
+#include "utils/TemporaryPath.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace cucumber::internal;
+
+namespace {
+
+FeatureParser::pickles_type parse(const std::string& source) {
+    return FeatureParser().parse(source, "test.feature");
+}
+
+std::vector<std::string> stepTexts(const PickledScenario& scenario) {
+    std::vector<std::string> texts;
+    for (const PickledStep& step : scenario.steps) {
+        texts.push_back(step.text);
+    }
+    return texts;
+}
+
+}
+
+TEST(FeatureParserTest, compilesEveryScenarioOfAFeature) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: Calculator\n"
+        "  Some description\n"
+        "\n"
+        "  Scenario: Addition\n"
+        "    Given a calculator\n"
+        "    When I add 1 and 2\n"
+        "    Then the result is 3\n"
+        "\n"
+        "  # A comment\n"
+        "  Example: Nothing\n"
+        "    * a calculator\n"
+    );
+    ASSERT_EQ(2, pickles.size());
+    EXPECT_EQ("Addition", pickles[0].name);
+    EXPECT_EQ("test.feature:4", pickles[0].location);
+    EXPECT_EQ(
+        std::vector<std::string>({"a calculator", "I add 1 and 2", "the result is 3"}),
+        stepTexts(pickles[0])
+    );
+    EXPECT_EQ("When", pickles[0].steps[1].keyword);
+    EXPECT_EQ("Nothing", pickles[1].name);
+    EXPECT_EQ("Given", pickles[1].steps[0].keyword);
+}
+
+TEST(FeatureParserTest, andAndButTakeThePrecedingKeyword) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: F\n"
+        "  Scenario: S\n"
+        "    Given a\n"
+        "    And b\n"
+        "    Then c\n"
+        "    But d\n"
+    );
+    ASSERT_EQ(1, pickles.size());
+    EXPECT_EQ("Given", pickles[0].steps[1].keyword);
+    EXPECT_EQ("Then", pickles[0].steps[3].keyword);
+}
+
+TEST(FeatureParserTest, inheritsTagsWithoutTheirAtSign) {
+    const FeatureParser::pickles_type pickles = parse(
+        "@feature\n"
+        "Feature: F\n"
+        "  @first @second # comment\n"
+        "  Scenario: S\n"
+        "    Given a\n"
+    );
+    ASSERT_EQ(1, pickles.size());
+    EXPECT_EQ(CukeEngine::tags_type({"feature", "first", "second"}), pickles[0].tags);
+}
+
+TEST(FeatureParserTest, prependsTheBackgroundOfFeatureAndRule) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: F\n"
+        "  Background:\n"
+        "    Given feature background\n"
+        "  Scenario: Outside\n"
+        "    Given outside\n"
+        "  @rule\n"
+        "  Rule: R\n"
+        "    Background:\n"
+        "      Given rule background\n"
+        "    Scenario: Inside\n"
+        "      Given inside\n"
+    );
+    ASSERT_EQ(2, pickles.size());
+    EXPECT_EQ(
+        std::vector<std::string>({"feature background", "outside"}), stepTexts(pickles[0])
+    );
+    EXPECT_EQ(1, pickles[0].backgroundSteps);
+    EXPECT_TRUE(pickles[0].tags.empty());
+    EXPECT_EQ(
+        std::vector<std::string>({"feature background", "rule background", "inside"}),
+        stepTexts(pickles[1])
+    );
+    EXPECT_EQ(2, pickles[1].backgroundSteps);
+    EXPECT_EQ(CukeEngine::tags_type({"rule"}), pickles[1].tags);
+}
+
+TEST(FeatureParserTest, readsDataTables) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: F\n"
+        "  Scenario: S\n"
+        "    Given a table\n"
+        "      | x  | y      |\n"
+        "      | 1  | a\\|b  |\n"
+        "      |    | \\\\\\n |\n"
+    );
+    ASSERT_EQ(1, pickles.size());
+    const CukeEngine::invoke_table_type table = pickles[0].steps[0].decodeTable();
+    ASSERT_EQ(3, table.size());
+    EXPECT_EQ(std::vector<std::string>({"x", "y"}), table[0]);
+    EXPECT_EQ(std::vector<std::string>({"1", "a|b"}), table[1]);
+    EXPECT_EQ(std::vector<std::string>({"", "\\\n"}), table[2]);
+    EXPECT_FALSE(pickles[0].steps[0].hasDocString);
+}
+
+TEST(FeatureParserTest, readsDocStringsWithoutTheirIndentation) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: F\n"
+        "  Scenario: S\n"
+        "    Given a doc string\n"
+        "      \"\"\"json\n"
+        "      {\n"
+        "        \"a\": \\\"\\\"\\\"\n"
+        "      }\n"
+        "      \"\"\"\n"
+        "    And another\n"
+        "      ```\n"
+        "      # not a comment\n"
+        "      ```\n"
+    );
+    ASSERT_EQ(1, pickles.size());
+    ASSERT_EQ(2, pickles[0].steps.size());
+    EXPECT_TRUE(pickles[0].steps[0].hasDocString);
+    EXPECT_EQ("{\n  \"a\": \"\"\"\n}", pickles[0].steps[0].decodeDocString());
+    EXPECT_EQ("# not a comment", pickles[0].steps[1].decodeDocString());
+}
+
+TEST(FeatureParserTest, decodesStepArgumentsOnlyWhenAsked) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: F\n"
+        "  Scenario: S\n"
+        "    Given a table\n"
+        "      | a |\n"
+        "      # between rows\n"
+        "      | b |\n"
+        "    And a doc string\n"
+        "      \"\"\"\n"
+        "      text\n"
+        "      \"\"\"\n"
+    );
+    ASSERT_EQ(1, pickles.size());
+    const PickledStep& tableStep = pickles[0].steps[0];
+    EXPECT_EQ(RawStepArgument::DATA_TABLE, tableStep.rawArgument.kind);
+    EXPECT_TRUE(tableStep.table.empty());
+    EXPECT_TRUE(tableStep.hasTable());
+    EXPECT_EQ(CukeEngine::invoke_table_type({{"a"}, {"b"}}), tableStep.decodeTable());
+
+    const PickledStep& docStringStep = pickles[0].steps[1];
+    EXPECT_EQ(RawStepArgument::DOC_STRING, docStringStep.rawArgument.kind);
+    EXPECT_TRUE(docStringStep.docString.empty());
+    EXPECT_FALSE(docStringStep.hasTable());
+    EXPECT_EQ("text", docStringStep.decodeDocString());
+}
+
+TEST(FeatureParserTest, expandsOutlinesIntoOneScenarioPerExampleRow) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: F\n"
+        "  Background:\n"
+        "    Given a calculator\n"
+        "  @outline\n"
+        "  Scenario Outline: Add <a> and <b>\n"
+        "    When I add <a> and <b>\n"
+        "    Then the result is <sum> and <unknown>\n"
+        "      | <sum> |\n"
+        "\n"
+        "    @small\n"
+        "    Examples: Small\n"
+        "      | a | b | sum |\n"
+        "      | 1 | 2 | 3   |\n"
+        "      | 2 | 2 | 4   |\n"
+        "\n"
+        "    Scenarios:\n"
+        "      | a  | b  | sum |\n"
+        "      | 10 | 20 | 30  |\n"
+    );
+    ASSERT_EQ(3, pickles.size());
+    EXPECT_EQ("Add 1 and 2", pickles[0].name);
+    EXPECT_EQ("test.feature:13", pickles[0].location);
+    EXPECT_EQ(CukeEngine::tags_type({"outline", "small"}), pickles[0].tags);
+    EXPECT_EQ(
+        std::vector<std::string>(
+            {"a calculator", "I add 1 and 2", "the result is 3 and <unknown>"}
+        ),
+        stepTexts(pickles[0])
+    );
+    EXPECT_EQ(std::vector<std::string>({"3"}), pickles[0].steps[2].decodeTable()[0]);
+    EXPECT_EQ("Add 2 and 2", pickles[1].name);
+    EXPECT_EQ("Add 10 and 20", pickles[2].name);
+    EXPECT_EQ(CukeEngine::tags_type({"outline"}), pickles[2].tags);
+    EXPECT_EQ("I add 10 and 20", pickles[2].steps[1].text);
+    EXPECT_EQ("I add <a> and <b>", pickles[2].steps[1].templateText);
+    EXPECT_TRUE(pickles[2].steps[0].templateText.empty());
+}
+
+TEST(FeatureParserTest, compilesNothingForAnOutlineWithoutExamples) {
+    const FeatureParser::pickles_type pickles = parse(
+        "Feature: F\n"
+        "  Scenario Outline: O\n"
+        "    Given <a>\n"
+    );
+    EXPECT_TRUE(pickles.empty());
+}
+
+TEST(FeatureParserTest, reportsTheLineOfMalformedGherkin) {
+    try {
+        parse(
+            "Feature: F\n"
+            "  Scenario: S\n"
+            "    Given a\n"
+            "      | a | b |\n"
+            "      | 1 |\n"
+        );
+        FAIL() << "Expected a FeatureParseException";
+    } catch (const FeatureParseException& e) {
+        EXPECT_EQ("test.feature", e.getUri());
+        EXPECT_EQ(5, e.getLine());
+    }
+    EXPECT_THROW(parse("Given a\n"), FeatureParseException);
+    EXPECT_THROW(parse("Feature: F\n  Given a\n"), FeatureParseException);
+    EXPECT_THROW(
+        parse("Feature: F\n  Scenario: S\n    Given a\n      \"\"\"\n      text\n"),
+        FeatureParseException
+    );
+}
+
+TEST(FeatureParserTest, parsesMappedFiles) {
+    const std::string path = temporaryTestPath(".feature").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "Feature: F\r\n"
+                "  Scenario: S\r\n"
+                "    Given a table\r\n"
+                "      | a | b |\r\n";
+    }
+    FeatureParser::pickles_type pickles = FeatureParser().parseFile(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(1, pickles.size());
+    EXPECT_EQ(path + ":2", pickles[0].location);
+    EXPECT_EQ("a table", pickles[0].steps[0].text);
+    EXPECT_EQ(CukeEngine::invoke_table_type({{"a", "b"}}), pickles[0].steps[0].decodeTable());
+}
+
+TEST(FeatureParserTest, parsesFilesInParallelKeepingTheirOrder) {
+    std::vector<std::string> paths;
+    for (int i = 0; i < 8; ++i) {
+        paths.push_back(temporaryTestPath("." + std::to_string(i) + ".feature").string());
+        std::ofstream file(paths.back(), std::ios::binary);
+        file << "Feature: F\n"
+                "  Scenario Outline: <n>\n"
+                "    Given <n>\n"
+                "    Examples:\n"
+                "      | n |\n"
+                "      | "
+             << i << "a |\n      | " << i << "b |\n";
+    }
+    const FeatureParser::pickles_type pickles = FeatureParser().parseFiles(paths, 3);
+    for (const std::string& path : paths) {
+        std::remove(path.c_str());
+    }
+
+    ASSERT_EQ(16, pickles.size());
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(std::to_string(i) + "a", pickles[2 * i].name);
+        EXPECT_EQ(std::to_string(i) + "b", pickles[2 * i + 1].name);
+    }
+    EXPECT_THROW(
+        FeatureParser().parseFiles({paths.front(), "does/not/exist.feature"}, 2),
+        FeatureParseException
+    );
+}
+
+TEST(FeatureParserTest, failsForFilesThatCannotBeRead) {
+    EXPECT_THROW(FeatureParser().parseFile("does/not/exist.feature"), FeatureParseException);
+}
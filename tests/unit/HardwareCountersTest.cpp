@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/HardwareCounters.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+
+#include <sstream>
+
+using namespace cucumber::internal;
+
+namespace {
+HardwareCounterSample counted(std::uint64_t cycles, std::uint64_t instructions) {
+    HardwareCounterSample sample;
+    sample.values[COUNTED_CYCLES] = cycles;
+    sample.values[COUNTED_INSTRUCTIONS] = instructions;
+    sample.values[COUNTED_CACHE_MISSES] = 3;
+    sample.values[COUNTED_BRANCH_MISSES] = 5;
+    return sample;
+}
+}
+
+TEST(HardwareCountersTest, subtractsEarlierSamples) {
+    const HardwareCounterSample earlier = counted(100, 300);
+    HardwareCounterSample later = counted(150, 200);
+    later.values[COUNTED_BRANCH_MISSES] = 9;
+
+    const HardwareCounterSample delta = later.since(earlier);
+    EXPECT_EQ(50, delta.values[COUNTED_CYCLES]);
+    // Never below 0, as multiplexed counters are scaled
+    EXPECT_EQ(0, delta.values[COUNTED_INSTRUCTIONS]);
+    EXPECT_EQ(0, delta.values[COUNTED_CACHE_MISSES]);
+    EXPECT_EQ(4, delta.values[COUNTED_BRANCH_MISSES]);
+}
+
+TEST(HardwareCountersTest, recordsAndReportsTheCountsOfSteps) {
+    const step_id_type stepId = 565656;
+    Timings::recordStepCounters(counted(1000, 2000), stepId);
+    Timings::recordStepCounters(counted(1000, 2000), stepId);
+
+    const TimingSnapshot snapshot = Timings::snapshot();
+    ASSERT_EQ(1, snapshot.stepCounters.count(stepId));
+    const HardwareCounterHistograms& step = snapshot.stepCounters.at(stepId);
+    EXPECT_EQ(2, step.counters[COUNTED_CYCLES].getCount());
+    EXPECT_EQ(4000, step.counters[COUNTED_INSTRUCTIONS].getTotal());
+    EXPECT_EQ(10, step.counters[COUNTED_BRANCH_MISSES].getTotal());
+
+    std::ostringstream report;
+    Timings::report(report);
+    EXPECT_NE(std::string::npos, report.str().find("Hardware counters"));
+    EXPECT_NE(std::string::npos, report.str().find("step 565656"));
+}
+
+TEST(HardwareCountersTest, countsStepsOnlyWhenEnabled) {
+    const step_id_type stepId = 575757;
+    {
+        const ScopedHardwareCounters counters(stepId);
+    }
+    EXPECT_EQ(0, Timings::snapshot().stepCounters.count(stepId));
+
+    if (!HardwareCounters::isAvailable()) {
+        GTEST_SKIP() << "perf_event_open refused";
+    }
+    Timings::setHardwareCounters(true);
+    volatile std::uint64_t sum = 0;
+    {
+        const ScopedHardwareCounters counters(stepId);
+        for (std::uint64_t i = 0; i < 100000; ++i) {
+            sum = sum + i;
+        }
+    }
+    Timings::setHardwareCounters(false);
+
+    const TimingSnapshot snapshot = Timings::snapshot();
+    ASSERT_EQ(1, snapshot.stepCounters.count(stepId));
+    EXPECT_GT(
+        snapshot.stepCounters.at(stepId).counters[COUNTED_INSTRUCTIONS].getTotal(), 100000
+    );
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include "utils/CukeCommandsFixture.hpp"
+
+#include <stdexcept>
+
+using namespace cucumber::internal;
+
+namespace {
+int invocations = 0;
+
+InvokeArgs argsOf(const std::string& arg, InvokeArgs::raw_table_type table = {}) {
+    InvokeArgs args;
+    args.addArg(arg);
+    if (!table.empty()) {
+        args.setTableArg(std::move(table));
+    }
+    return args;
+}
+}
+
+class ChecksumStep : public GenericStep {
+    void body() override {
+        ++invocations;
+        idempotent();
+    }
+};
+
+class FlakyChecksumStep : public GenericStep {
+    void body() override {
+        idempotent();
+        if (++invocations == 1) {
+            throw std::runtime_error("checksum mismatch");
+        }
+    }
+};
+
+class CountingStep : public GenericStep {
+    void body() override {
+        ++invocations;
+    }
+};
+
+class IdempotentStepTest : public CukeCommandsFixture {
+protected:
+    void SetUp() override {
+        invocations = 0;
+    }
+
+    InvokeResult invokeStep(const InvokeArgs& args) {
+        beginScenario();
+        const InvokeResult result = invoke(stepId, &args);
+        endScenario();
+        return result;
+    }
+};
+
+TEST(InvokeArgsTest, fingerprintsArgsAndTables) {
+    const InvokeArgs::raw_table_type table = {{"file", "sum"}, {"a.bin", "1f"}};
+    const InvokeArgs withTable = argsOf("x", table);
+    const std::string fingerprint = withTable.fingerprint();
+    withTable.getTableArg();
+    EXPECT_EQ(fingerprint, withTable.fingerprint());
+
+    EXPECT_EQ(argsOf("x").fingerprint(), argsOf("x").fingerprint());
+    EXPECT_NE(argsOf("x").fingerprint(), fingerprint);
+    EXPECT_NE(argsOf("x").fingerprint(), argsOf("y").fingerprint());
+    EXPECT_NE(fingerprint, argsOf("x", {{"file", "sum"}, {"a.bin", "2f"}}).fingerprint());
+    InvokeArgs split;
+    split.addArg("a");
+    split.addArg("b");
+    InvokeArgs joined;
+    joined.addArg("ab");
+    EXPECT_NE(split.fingerprint(), joined.fingerprint());
+}
+
+TEST_F(IdempotentStepTest, reusesResultsWithinTheFeature) {
+    addStepToManager<ChecksumStep>(STATIC_MATCHER);
+    beginFeature("artifacts.feature");
+    EXPECT_TRUE(invokeStep(argsOf("a.bin")).isSuccess());
+    EXPECT_TRUE(invokeStep(argsOf("a.bin")).isSuccess());
+    EXPECT_EQ(1, invocations);
+
+    EXPECT_TRUE(invokeStep(argsOf("b.bin")).isSuccess());
+    EXPECT_TRUE(invokeStep(argsOf("a.bin", {{"sum"}, {"1f"}})).isSuccess());
+    EXPECT_EQ(3, invocations);
+
+    beginFeature("other.feature");
+    EXPECT_TRUE(invokeStep(argsOf("a.bin")).isSuccess());
+    EXPECT_EQ(4, invocations);
+}
+
+TEST_F(IdempotentStepTest, reusesResultsWithinTheScenarioWithoutFeatures) {
+    addStepToManager<ChecksumStep>(STATIC_MATCHER);
+    const InvokeArgs args = argsOf("a.bin");
+
+    // Scenarios of two features, which begin_feature does not tell apart
+    for (int feature = 0; feature < 2; ++feature) {
+        beginScenario();
+        EXPECT_TRUE(invoke(stepId, &args).isSuccess());
+        EXPECT_TRUE(invoke(stepId, &args).isSuccess());
+        endScenario();
+    }
+    EXPECT_EQ(2, invocations);
+}
+
+TEST_F(IdempotentStepTest, runsFailedAndUnmarkedStepsAgain) {
+    addStepToManager<FlakyChecksumStep>(STATIC_MATCHER);
+    beginFeature("artifacts.feature");
+    EXPECT_FALSE(invokeStep(argsOf("a.bin")).isSuccess());
+    EXPECT_TRUE(invokeStep(argsOf("a.bin")).isSuccess());
+    EXPECT_TRUE(invokeStep(argsOf("a.bin")).isSuccess());
+    EXPECT_EQ(2, invocations);
+
+    StepManagerTestDouble::clearSteps();
+    addStepToManager<CountingStep>(STATIC_MATCHER);
+    invocations = 0;
+    beginFeature("other.feature");
+    invokeStep(argsOf("a.bin"));
+    invokeStep(argsOf("a.bin"));
+    EXPECT_EQ(2, invocations);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/ImpactRecord.hpp>
+
+#include <sstream>
+#include <stdexcept>
+
+using namespace cucumber::internal;
+
+namespace {
+
+PickledScenario scenarioAt(const std::string& location) {
+    PickledScenario scenario;
+    scenario.location = location;
+    return scenario;
+}
+
+ScenarioResult resultInvoking(const std::vector<std::string>& sources, RunStatus status) {
+    ScenarioResult result;
+    result.status = status;
+    for (const std::string& source : sources) {
+        StepResult step;
+        step.status = RUN_PASSED;
+        step.source = source;
+        result.steps.push_back(step);
+    }
+    // Not invoked
+    result.steps.push_back(StepResult());
+    return result;
+}
+
+}
+
+class ImpactRecordTest : public ::testing::Test {
+protected:
+    const PickledScenario login = scenarioAt("features/login.feature:3");
+    const PickledScenario logout = scenarioAt("features/login.feature:9");
+    const PickledScenario search = scenarioAt("features/search.feature:3");
+    ImpactRecord record;
+
+    void SetUp() override {
+        record.record(
+            login, resultInvoking({"LoginSteps.cpp:12", "CommonSteps.cpp:4"}, RUN_PASSED)
+        );
+        record.record(search, resultInvoking({"SearchSteps.cpp:7"}, RUN_FAILED));
+    }
+};
+
+TEST_F(ImpactRecordTest, recordsTheStepDefinitionsInvoked) {
+    ASSERT_EQ(2, record.scenarios().size());
+    const ImpactRecord::Scenario& recorded = record.scenarios().at(login.location);
+    EXPECT_TRUE(recorded.passed);
+    EXPECT_EQ(std::set<std::string>({"CommonSteps.cpp:4", "LoginSteps.cpp:12"}), recorded.sources);
+}
+
+TEST_F(ImpactRecordTest, affectsScenariosUsingAChangedStepDefinitionFile) {
+    EXPECT_FALSE(record.affects(login, {}));
+    EXPECT_FALSE(record.affects(login, {"src/SearchSteps.cpp", "README.md"}));
+    EXPECT_TRUE(record.affects(login, {"src/steps/CommonSteps.cpp"}));
+}
+
+TEST_F(ImpactRecordTest, affectsScenariosOfAChangedFeatureFile) {
+    EXPECT_TRUE(record.affects(login, {"project/features/login.feature"}));
+    EXPECT_TRUE(record.affects(login, {"./features/../features/login.feature"}));
+    EXPECT_FALSE(record.affects(login, {"features/other/login.feature"}));
+}
+
+TEST_F(ImpactRecordTest, affectsScenariosThatFailedOrAreNew) {
+    EXPECT_TRUE(record.affects(search, {}));
+    EXPECT_TRUE(record.affects(logout, {}));
+}
+
+TEST_F(ImpactRecordTest, keepsScenariosThatDidNotRun) {
+    ImpactRecord next;
+    next.record(search, resultInvoking({"SearchSteps.cpp:7"}, RUN_PASSED));
+    next.keep(search, record);
+    next.keep(login, record);
+    next.keep(logout, record);
+
+    ASSERT_EQ(2, next.scenarios().size());
+    EXPECT_TRUE(next.scenarios().at(search.location).passed);
+    EXPECT_EQ(2, next.scenarios().at(login.location).sources.size());
+}
+
+TEST_F(ImpactRecordTest, savesAndLoadsTheRecord) {
+    std::stringstream saved;
+    record.save(saved);
+    EXPECT_EQ(
+        "passed\tfeatures/login.feature:3\tCommonSteps.cpp:4\tLoginSteps.cpp:12\n"
+        "failed\tfeatures/search.feature:3\tSearchSteps.cpp:7\n",
+        saved.str()
+    );
+
+    ImpactRecord loaded;
+    loaded.load(saved);
+    EXPECT_FALSE(loaded.affects(login, {}));
+    EXPECT_TRUE(loaded.affects(search, {}));
+    EXPECT_TRUE(loaded.affects(login, {"LoginSteps.cpp"}));
+
+    std::istringstream malformed("maybe\tfeatures/login.feature:3\n");
+    EXPECT_THROW(loaded.load(malformed), std::runtime_error);
+}
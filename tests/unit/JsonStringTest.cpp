@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/utils/JsonString.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <stdexcept>
+#include <string>
+
+using namespace cucumber::internal;
+
+namespace {
+std::string jsonString(const std::string& text) {
+    std::string output;
+    appendJsonString(output, text);
+    return output;
+}
+}
+
+TEST(JsonStringTest, findsSpecialBytesAtEveryOffsetOfABlock) {
+    for (std::size_t size = 0; size <= 70; ++size) {
+        const std::string plain(size, 'x');
+        EXPECT_EQ(size, findJsonSpecial(plain));
+        for (std::size_t at = 0; at < size; ++at) {
+            for (const char special : {'"', '\\', '\n', '\x1f', '\x80', '\xff'}) {
+                std::string text = plain;
+                text[at] = special;
+                EXPECT_EQ(at, findJsonSpecial(text)) << "size " << size << ", at " << at;
+                EXPECT_EQ(size, findJsonSpecial(text, at + 1));
+            }
+        }
+    }
+    EXPECT_EQ(3, findJsonSpecial(" ~\x7f"));
+}
+
+TEST(JsonStringTest, escapesLikeNlohmannJson) {
+    const std::string texts[] = {
+        "",
+        "plain text needing no escape, longer than a single block of bytes",
+        "\"quoted\" and back\\slashed",
+        "tab\tnew line\ncarriage return\rbackspace\bform feed\f",
+        std::string("null \0 and unit separator \x1f", 27),
+        "caf\xc3\xa9, \xe2\x82\xac and \xf0\x9f\xa5\x92 \xc3\xa9\xc3\xa9 \"after\"",
+        std::string(100, 'x') + "\n\xc3\xa9\xc3\xa9" + std::string(100, 'y'),
+    };
+    for (const std::string& text : texts) {
+        EXPECT_EQ(nlohmann::json(text).dump(), jsonString(text));
+    }
+    const std::string assertion = "Expected: " + std::string(5000, 'a') + "\n  Actual: \"b\"";
+    EXPECT_EQ(nlohmann::json(assertion).dump(), jsonString(assertion));
+}
+
+TEST(JsonStringTest, rejectsInvalidUtf8) {
+    EXPECT_THROW(jsonString("\xff"), std::invalid_argument);
+    EXPECT_THROW(jsonString("truncated \xe2\x82"), std::invalid_argument);
+    EXPECT_THROW(jsonString("overlong \xc0\xaf"), std::invalid_argument);
+    EXPECT_THROW(jsonString("surrogate \xed\xa0\x80"), std::invalid_argument);
+    EXPECT_THROW(jsonString("\xc3\xa9\xc3"), std::invalid_argument);
+}
@@ -93,3 +93,94 @@ TEST(RegexTest, findAllHasToMatchTheEntireInput) {
     EXPECT_EQ(0, match->getSubmatches().size());
 }
 */
+
+TEST(RegexTest, rejectsInvalidRegexWithRegexError) {
+    EXPECT_THROW(Regex("(unbalanced"), std::regex_error);
+}
+
+TEST(RegexTest, copiesShareTheCompiledRegex) {
+    const Regex original("^(\\w+) (\\w+)$");
+    const Regex copy(original);
+
+    std::shared_ptr<RegexMatch> match(copy.find("hello world"));
+    ASSERT_TRUE(match->matches());
+    ASSERT_EQ(2, match->getSubmatches().size());
+    EXPECT_EQ("world", match->getSubmatches()[1].value);
+    EXPECT_EQ(6, match->getSubmatches()[1].position);
+    EXPECT_EQ(original.str(), copy.str());
+}
+
+TEST(RegexTest, defersCompilationToFirstUse) {
+    const Regex deferred("^(\\d+)$", COMPILE_ON_FIRST_USE);
+    const Regex copy(deferred);
+    EXPECT_FALSE(deferred.isCompiled());
+
+    std::shared_ptr<RegexMatch> match(copy.find("42"));
+    EXPECT_TRUE(match->matches());
+    EXPECT_TRUE(deferred.isCompiled());
+
+    const Regex invalid("(unbalanced", COMPILE_ON_FIRST_USE);
+    EXPECT_THROW(invalid.find("unbalanced"), std::regex_error);
+    EXPECT_FALSE(invalid.isCompiled());
+}
+
+TEST(RegexTest, findsSubmatchSpansIntoReusedVector) {
+    const Regex sum("^(\\d+)\\+(\\d+)(?:\\+(\\d+))?=(\\d+)$");
+    std::vector<RegexSubmatchSpan> submatches;
+
+    ASSERT_TRUE(sum.find("42+27=69", submatches));
+    ASSERT_EQ(4, submatches.size());
+    EXPECT_EQ(0, submatches[0].begin);
+    EXPECT_EQ(2, submatches[0].end);
+    EXPECT_FALSE(submatches[2].matched());
+    EXPECT_EQ(6, submatches[3].begin);
+    EXPECT_EQ(8, submatches[3].end);
+
+    EXPECT_FALSE(sum.find("1+2=3 ", submatches));
+    EXPECT_TRUE(submatches.empty());
+}
+
+TEST(RegexTest, findReportsCodepointPositionsOfSubmatchesOutOfOrder) {
+    Regex groups("^(\\S+) (?=\\S+ (\\S+)$)(\\S+) (\\S+)$");
+    std::shared_ptr<RegexMatch> match(groups.find("äöüäöüäöü カラオケ機カラオケ機 ascii"));
+
+    ASSERT_TRUE(match->matches());
+    ASSERT_EQ(4, match->getSubmatches().size());
+    EXPECT_EQ(0, match->getSubmatches()[0].position);
+    EXPECT_EQ(21, match->getSubmatches()[1].position);
+    EXPECT_EQ(10, match->getSubmatches()[2].position);
+    EXPECT_EQ(21, match->getSubmatches()[3].position);
+}
+
+TEST(RegexTest, findsNoBacktrackingHazardInLinearExpressions) {
+    EXPECT_EQ("", backtrackingHazard("^I have (\\d+) cucumbers in my (.*)$"));
+    EXPECT_EQ("", backtrackingHazard("^(?:\\d+[E][+-]?\\d+)?(a|b)*$"));
+    EXPECT_EQ("", backtrackingHazard("^(\\d{2,3})+[(*]+$"));
+}
+
+TEST(RegexTest, findsNestedUnboundedQuantifiers) {
+    EXPECT_EQ(
+        "nested unbounded quantifiers in the group at offset 1", backtrackingHazard("^(a+)+$")
+    );
+    EXPECT_EQ(
+        "nested unbounded quantifiers in the group at offset 0",
+        backtrackingHazard("(?:x(\\w*)){1,}y")
+    );
+}
+
+TEST(RegexTest, findsUnboundedQuantifiersInLookarounds) {
+    EXPECT_EQ(
+        "unbounded quantifier in the lookaround at offset 1",
+        backtrackingHazard("((?=.*\\d.*)[-+]?\\d*(?:\\.(?=\\d.*))?\\d*)")
+    );
+}
+
+TEST(RegexTest, matchesExpressionsProneToBacktrackingOnLongInputs) {
+    Regex decimal("^I have ((?=.*\\d.*)[-+]?\\d*(?:\\.(?=\\d.*))?\\d*) cucumbers$");
+    const std::string digits(1000, '1');
+
+    std::vector<RegexSubmatchSpan> submatches;
+    EXPECT_FALSE(decimal.find("I have " + digits + " cucumbers!", submatches));
+    ASSERT_TRUE(decimal.find("I have " + digits + ".5 cucumbers", submatches));
+    EXPECT_EQ(1002, submatches[0].end - submatches[0].begin);
+}
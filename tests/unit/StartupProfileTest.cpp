@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/StartupProfile.hpp>
+#include <cucumber-cpp/internal/step/StepManager.hpp>
+#include <cucumber-cpp/internal/drivers/GenericDriver.hpp>
+
+#include <sstream>
+
+using namespace cucumber::internal;
+
+namespace {
+
+class StartupStep : public GenericStep {
+public:
+    void body() override {
+    }
+};
+
+std::size_t countEntries(StartupOperation operation, const std::string& subject) {
+    std::size_t count = 0;
+    for (const StartupEntry& entry : StartupProfile::entries()) {
+        if (entry.operation == operation && entry.subject == subject) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+}
+
+TEST(StartupProfileTest, recordsRegistrationsUntilFinished) {
+    ASSERT_TRUE(StartupProfile::isRecording());
+    const int line = __LINE__;
+    registerStep<StartupStep>("^a startup step (\\d+)$", __FILE__, line);
+    registerStep<StartupStep>("a startup {word}", "dir/other_steps.cpp", 3);
+
+    std::vector<StartupEntry> registrations;
+    for (const StartupEntry& entry : StartupProfile::entries()) {
+        if (entry.operation == STARTUP_REGISTER_STEP
+            && entry.subject.find("startup") != std::string::npos) {
+            registrations.push_back(entry);
+        }
+    }
+    ASSERT_EQ(2, registrations.size());
+    EXPECT_EQ("StartupProfileTest.cpp:" + std::to_string(line), registrations[0].source);
+    EXPECT_EQ("other_steps.cpp:3", registrations[1].source);
+    EXPECT_EQ(1, countEntries(STARTUP_COMPILE_REGEX, "^a startup step (\\d+)$"));
+    EXPECT_EQ(1, countEntries(STARTUP_TRANSFORM, "a startup {word}"));
+
+    std::ostringstream report;
+    StartupProfile::report(report, 100);
+    EXPECT_NE(std::string::npos, report.str().find("  StartupProfileTest.cpp\n"));
+    EXPECT_NE(std::string::npos, report.str().find("  other_steps.cpp\n"));
+    EXPECT_NE(
+        std::string::npos,
+        report.str().find("register steps: a startup {word} (other_steps.cpp:3)")
+    );
+
+    StartupProfile::finish();
+    EXPECT_FALSE(StartupProfile::isRecording());
+    const std::size_t recorded = StartupProfile::entries().size();
+    registerStep<StartupStep>("^another startup step$", __FILE__, __LINE__);
+    EXPECT_EQ(recorded, StartupProfile::entries().size());
+}
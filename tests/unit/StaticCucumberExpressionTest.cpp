@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/step/StaticStep.hpp>
+#include <cucumber-cpp/internal/drivers/GenericDriver.hpp>
+
+using namespace cucumber::internal;
+
+namespace {
+
+#define STATIC_STEP_MATCHER(step_matcher)                               \
+    [] {                                                                \
+        struct StepMatcher {                                            \
+            static constexpr const char* get() { return step_matcher; } \
+        };                                                              \
+        return StepMatcher();                                           \
+    }()
+
+class StaticStep : public GenericStep {
+public:
+    void body() override {
+    }
+};
+
+template<typename StepMatcher>
+bool isTransformed(StepMatcher) {
+    return StaticStepMatcher<StepMatcher>::sizes.transformed;
+}
+
+/**
+ * Expects the step registered with the regular expression transformed at
+ * compile time to match like the regular expression
+ */
+template<typename StepMatcher>
+void expectRegexMatches(StepMatcher stepMatcher, const std::vector<std::string>& descriptions) {
+    SCOPED_TRACE(StepMatcher::get());
+    ASSERT_TRUE(isTransformed(stepMatcher));
+    const StepInfo* const step =
+        StepManager::getStep(registerStaticStep<StaticStep>(stepMatcher, __FILE__, __LINE__));
+    const Regex regex(StepMatcher::get());
+    for (const std::string& description : descriptions) {
+        SCOPED_TRACE(description);
+        const std::shared_ptr<RegexMatch> expected = regex.find(description);
+        const SingleStepMatch match = step->matches(description);
+        ASSERT_EQ(expected->matches(), static_cast<bool>(match));
+        if (match) {
+            const RegexMatch::submatches_type& submatches = expected->getSubmatches();
+            ASSERT_EQ(submatches.size(), match.submatches.size());
+            for (std::size_t i = 0; i < submatches.size(); ++i) {
+                EXPECT_EQ(submatches[i].value, match.submatches[i].value);
+                EXPECT_EQ(submatches[i].position, match.submatches[i].position);
+            }
+        }
+    }
+}
+
+template<typename StepMatcher>
+void expectRuntimeTransform(StepMatcher) {
+    typedef StaticStepMatcher<StepMatcher> static_matcher;
+    const std::string expression = StepMatcher::get();
+    SCOPED_TRACE(expression);
+    ASSERT_TRUE(static_matcher::sizes.transformed);
+    const StepSnapshotEntry entry = toStepSnapshotEntry(static_matcher::transform);
+
+    EXPECT_EQ(cukex::transform(expression), entry.regex);
+    const std::vector<CucumberExpressionParameter> parameters = cukex::parameters(expression);
+    ASSERT_EQ(parameters.size(), entry.parameters.size());
+    for (std::size_t i = 0; i < parameters.size(); ++i) {
+        EXPECT_EQ(parameters[i].type, entry.parameters[i].type);
+        EXPECT_EQ(parameters[i].group, entry.parameters[i].group);
+    }
+    const std::shared_ptr<const CucumberExpressionMatcher> matcher = cukex::matcher(expression);
+    ASSERT_EQ(matcher != nullptr, entry.hasMatcher);
+    if (matcher) {
+        const CucumberExpressionMatcher::segments_type& segments = matcher->getSegments();
+        ASSERT_EQ(segments.size(), entry.segments.size());
+        for (std::size_t i = 0; i < segments.size(); ++i) {
+            EXPECT_EQ(segments[i].kind, entry.segments[i].kind);
+            EXPECT_EQ(segments[i].texts, entry.segments[i].texts);
+            EXPECT_EQ(segments[i].groups, entry.segments[i].groups);
+        }
+    }
+}
+
+}
+
+static_assert(measureStaticTransform<32>("I have {int} cuke(s)").parameters == 1);
+
+TEST(StaticCucumberExpressionTest, transformsAsAtRunTime) {
+    expectRuntimeTransform(STATIC_STEP_MATCHER("I have {int} cukes"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("{word} and {string} and {}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("I pay {float} or {double} {bigdecimal}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("{biginteger} {byte} {short} {long}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("I have {int} cucumber(s) in my belly"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("I eat/drink/consume {int} thing(s)"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("a/b(c) {int}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("/alone {int}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("trailing/ {int}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("escaped \\(text\\) \\{int\\} \\/ {int}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("regex chars .^$|*+?[] {int}"));
+    expectRuntimeTransform(STATIC_STEP_MATCHER("{int}{int}  {word}"));
+}
+
+TEST(StaticCucumberExpressionTest, matchesRegularExpressionsWithoutThem) {
+    expectRegexMatches(
+        STATIC_STEP_MATCHER("^I have (\\d+) cukes in my (.*)$"),
+        {"I have 42 cukes in my belly", "I have -1 cukes in my belly", "I have 42 cukes in my "}
+    );
+    expectRegexMatches(
+        STATIC_STEP_MATCHER("^I owe (-?\\d+) \\$ to ([^\\s]+)$"),
+        {"I owe -3 $ to Bob", "I owe 3 $ to Bob and Alice", "I owe 3 to Bob"}
+    );
+    expectRegexMatches(
+        STATIC_STEP_MATCHER("^I type \"([^\"]*)\" and \"([^\"]*)\"$"),
+        {"I type \"\" and \"b\"", "I type \"a\" and \"b\" and \"c\"", "I type \"a and b\""}
+    );
+    expectRegexMatches(STATIC_STEP_MATCHER("^(.*)(\\d+)$"), {"abc123", "123", "abc"});
+}
+
+TEST(StaticCucumberExpressionTest, leavesOtherStepMatchersToRunTime) {
+    EXPECT_FALSE(isTransformed(STATIC_STEP_MATCHER("^a regex (\\d+)?$")));
+    EXPECT_FALSE(isTransformed(STATIC_STEP_MATCHER("^a (\\w+) regex$")));
+    EXPECT_FALSE(isTransformed(STATIC_STEP_MATCHER("an unanchored regex (\\d+)")));
+    EXPECT_FALSE(isTransformed(STATIC_STEP_MATCHER("^a{2,3}$")));
+    EXPECT_FALSE(isTransformed(STATIC_STEP_MATCHER("a {staticcolor}")));
+}
+
+TEST(StaticCucumberExpressionTest, rejectsMalformedExpressions) {
+    // Thrown at compile time too, where they fail the build
+    EXPECT_THROW(measureStaticTransform<16>("{int} {word"), std::invalid_argument);
+    EXPECT_THROW(measureStaticTransform<16>("{int}}"), std::invalid_argument);
+    EXPECT_THROW(measureStaticTransform<16>("{{int}}"), std::invalid_argument);
+    EXPECT_THROW(measureStaticTransform<16>("() {int}"), std::invalid_argument);
+    EXPECT_THROW(measureStaticTransform<16>("(a {int}"), std::invalid_argument);
+}
+
+TEST(StaticCucumberExpressionTest, registersStepsTransformedAtCompileTime) {
+    const StepInfo* const step = StepManager::getStep(registerStaticStep<StaticStep>(
+        STATIC_STEP_MATCHER("a static {int} and {word} step(s)"), __FILE__, __LINE__
+    ));
+    EXPECT_EQ(cukex::transform("a static {int} and {word} step(s)"), step->regex.str());
+    const SingleStepMatch match = step->matches("a static 42 and cukes step");
+    ASSERT_TRUE(match);
+    ASSERT_EQ(2, match.submatches.size());
+    EXPECT_EQ("42", match.submatches[0].value);
+    EXPECT_EQ("cukes", match.submatches[1].value);
+    EXPECT_FALSE(step->matches("a static step"));
+
+    ParameterTypeRegistry::define("staticcolor", "red|blue");
+    const StepInfo* const custom = StepManager::getStep(registerStaticStep<StaticStep>(
+        STATIC_STEP_MATCHER("a static {staticcolor} step"), __FILE__, __LINE__
+    ));
+    EXPECT_TRUE(custom->matches("a static red step"));
+    ParameterTypeRegistry::clear();
+}
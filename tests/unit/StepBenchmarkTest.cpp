@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "utils/CukeCommandsFixture.hpp"
+
+#include <cucumber-cpp/internal/StepBenchmark.hpp>
+#include <cucumber-cpp/internal/Timings.hpp>
+
+#include <stdexcept>
+#include <thread>
+
+using namespace cucumber::internal;
+
+namespace {
+int invocations = 0;
+}
+
+class CountingStep : public GenericStep {
+    void body() override {
+        ++invocations;
+    }
+};
+
+class SleepingStep : public GenericStep {
+    void body() override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+};
+
+class FailingStep : public GenericStep {
+    void body() override {
+        ++invocations;
+        throw std::runtime_error("failed in the benchmark");
+    }
+};
+
+class StepBenchmarkTest : public CukeCommandsFixture {
+protected:
+    const InvokeArgs noArgs;
+
+    void SetUp() override {
+        invocations = 0;
+    }
+
+    InvokeResult invokeStep() {
+        return invoke(stepId, &noArgs);
+    }
+};
+
+TEST(StepBenchmarkSettingsTest, readsIterationsAndLimitsFromTags) {
+    const StepBenchmark benchmark =
+        StepBenchmark::fromTags({"wip", "@benchmark(iterations=200,warmup=5,p99=2ms,mean=500us)"});
+    EXPECT_TRUE(benchmark.isEnabled());
+    EXPECT_EQ(200, benchmark.iterations);
+    EXPECT_EQ(5, benchmark.warmup);
+    EXPECT_EQ(std::chrono::milliseconds(2), benchmark.p99);
+    EXPECT_EQ(std::chrono::microseconds(500), benchmark.mean);
+    EXPECT_EQ(0, benchmark.max.count());
+
+    EXPECT_EQ(10, StepBenchmark::fromTags({"benchmark(iterations=100)"}).warmup);
+    EXPECT_FALSE(StepBenchmark::fromTags({"wip"}).isEnabled());
+}
+
+TEST(StepBenchmarkSettingsTest, rejectsMalformedTags) {
+    EXPECT_EQ(std::chrono::nanoseconds(250), StepBenchmark::parseDuration("250ns"));
+    EXPECT_EQ(std::chrono::seconds(1), StepBenchmark::parseDuration("1s"));
+    EXPECT_THROW(StepBenchmark::parseDuration("1min"), std::invalid_argument);
+    EXPECT_THROW(StepBenchmark::fromTags({"benchmark(p99=2ms)"}), std::invalid_argument);
+    EXPECT_THROW(StepBenchmark::fromTags({"benchmark(iterations=ten)"}), std::invalid_argument);
+    EXPECT_THROW(
+        StepBenchmark::fromTags({"benchmark(iterations=9,p95=1ms)"}), std::invalid_argument
+    );
+    EXPECT_THROW(StepBenchmark::fromTags({"benchmark(iterations)"}), std::invalid_argument);
+}
+
+TEST(StepBenchmarkSettingsTest, computesStatistics) {
+    std::vector<StepBenchmark::duration_type> samples;
+    for (int i = 100; i >= 1; --i) {
+        samples.emplace_back(i);
+    }
+    const StepBenchmark::Statistics statistics = StepBenchmark::statistics(samples);
+    EXPECT_EQ(100, statistics.iterations);
+    EXPECT_EQ(std::chrono::nanoseconds(51), statistics.mean);
+    EXPECT_EQ(std::chrono::nanoseconds(29), statistics.stddev);
+    EXPECT_EQ(std::chrono::nanoseconds(1), statistics.min);
+    EXPECT_EQ(std::chrono::nanoseconds(50), statistics.p50);
+    EXPECT_EQ(std::chrono::nanoseconds(90), statistics.p90);
+    EXPECT_EQ(std::chrono::nanoseconds(99), statistics.p99);
+    EXPECT_EQ(std::chrono::nanoseconds(100), statistics.max);
+}
+
+TEST_F(StepBenchmarkTest, benchmarkedStepsRunTheirIterationsAfterWarmingUp) {
+    addStepToManager<CountingStep>(STATIC_MATCHER);
+    Timings::setEnabled(true);
+    beginScenario({"benchmark(iterations=20,warmup=3)"});
+    EXPECT_TRUE(invokeStep().isSuccess());
+    endScenario();
+    Timings::setEnabled(false);
+    EXPECT_EQ(23, invocations);
+    EXPECT_EQ(20, Timings::snapshot().benchmarks.at(stepId).getCount());
+
+    beginScenario();
+    EXPECT_TRUE(invokeStep().isSuccess());
+    endScenario();
+    EXPECT_EQ(24, invocations);
+}
+
+TEST_F(StepBenchmarkTest, benchmarkedStepsFailOverTheirLimits) {
+    addStepToManager<SleepingStep>(STATIC_MATCHER);
+    beginScenario({"benchmark(iterations=3,warmup=0,p50=1ms)"});
+    const InvokeResult result = invokeStep();
+    EXPECT_EQ(FAILURE, result.getType());
+    EXPECT_NE(std::string::npos, result.getDescription().find("Benchmark p50 of"));
+    EXPECT_NE(std::string::npos, result.getDescription().find("over 3 iterations"));
+    endScenario();
+}
+
+TEST_F(StepBenchmarkTest, benchmarksStopAtTheFirstFailure) {
+    addStepToManager<FailingStep>(STATIC_MATCHER);
+    beginScenario({"benchmark(iterations=10)"});
+    const InvokeResult result = invokeStep();
+    EXPECT_EQ("failed in the benchmark", result.getDescription());
+    EXPECT_EQ(1, invocations);
+    endScenario();
+}
@@ -73,12 +73,12 @@ static const InvokeArgs NO_INVOKE_ARGS;
 
 class StepCallChainTest : public ::testing::Test {
 protected:
-    HookRegistrar::aroundhook_list_type aroundHooks;
+    HookRegistrar::aroundhook_chain_type aroundHooks;
     std::stringstream markers;
 
     InvokeResult execStep(const InvokeResult& result) {
         const FakeStepInfo step(&markers, result);
-        StepCallChain scc(0, &step, &NO_INVOKE_ARGS, aroundHooks);
+        StepCallChain scc(&step, &NO_INVOKE_ARGS, aroundHooks);
         return scc.exec();
     }
 
@@ -92,7 +92,7 @@ protected:
 };
 
 TEST_F(StepCallChainTest, failsIfNoStep) {
-    StepCallChain scc(0, NULL, &NO_INVOKE_ARGS, aroundHooks);
+    StepCallChain scc(NULL, &NO_INVOKE_ARGS, aroundHooks);
     EXPECT_FALSE(scc.exec().isSuccess());
     EXPECT_EQ("", markers.str());
 }
@@ -130,7 +130,7 @@ TEST_F(StepCallChainTest, aroundHooksAreInvokedInTheCorrectOrder) {
 
 TEST_F(StepCallChainTest, argsArePassedToTheStep) {
     const FakeStepInfo step(&markers, InvokeResult::success());
-    StepCallChain scc(0, &step, &NO_INVOKE_ARGS, aroundHooks);
+    StepCallChain scc(&step, &NO_INVOKE_ARGS, aroundHooks);
 
     EXPECT_NE(&NO_INVOKE_ARGS, step.getLatestArgsPassed());
     scc.exec();
@@ -152,3 +152,11 @@ TEST_F(StepCallChainTest, aroundHooksCanStopTheCallChain) {
 
     EXPECT_EQ("B1B2A2A1", markers.str());
 }
+
+TEST_F(StepCallChainTest, longChainsOfAroundHooksRunTheStepOnce) {
+    std::shared_ptr<MarkingAroundStepHook> hook(std::make_shared<MarkingAroundStepHook>());
+    aroundHooks.assign(1000, hook);
+
+    EXPECT_TRUE(execStep(InvokeResult::success()).isSuccess());
+    EXPECT_EQ("S", markers.str());
+}
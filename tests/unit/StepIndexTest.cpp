@@ -0,0 +1,195 @@
+#include <gmock/gmock.h>
+
+#include <cucumber-cpp/internal/step/StepIndex.hpp>
+
+using namespace cucumber::internal;
+using namespace testing;
+
+namespace {
+
+std::string prefixOf(const std::string& regex) {
+    return extractLiteralPrefix(regex).text;
+}
+
+}
+
+TEST(StepIndexTest, extractsLiteralPrefixOfAnchoredRegexes) {
+    EXPECT_TRUE(extractLiteralPrefix("^I have (\\d+) cucumbers$").anchored);
+    EXPECT_EQ("I have ", prefixOf("^I have (\\d+) cucumbers$"));
+    EXPECT_EQ("the user", prefixOf("^the user$"));
+    EXPECT_EQ("", prefixOf("^(\\w+) is logged in$"));
+}
+
+TEST(StepIndexTest, extractsLiteralPrefixOfUnanchoredRegexes) {
+    EXPECT_FALSE(extractLiteralPrefix("a matcher").anchored);
+    EXPECT_EQ("a matcher", prefixOf("a matcher"));
+    EXPECT_EQ("match the ", prefixOf("match the (\\w+) param"));
+}
+
+TEST(StepIndexTest, stopsAtCharactersMadeOptionalByQuantifiers) {
+    EXPECT_EQ("cucumber", prefixOf("^cucumbers?$"));
+    EXPECT_EQ("cucumber", prefixOf("^cucumbers*$"));
+    EXPECT_EQ("cucumber", prefixOf("^cucumbers{0,1}$"));
+    EXPECT_EQ("cucumbers", prefixOf("^cucumbers+ now$"));
+}
+
+TEST(StepIndexTest, keepsEscapedPunctuationButNotCharacterClasses) {
+    EXPECT_EQ("1.5 (or more) ", prefixOf("^1\\.5 \\(or more\\) (\\d+)$"));
+    EXPECT_EQ("number ", prefixOf("^number \\d+$"));
+    EXPECT_EQ("x", prefixOf("^x\\b"));
+}
+
+TEST(StepIndexTest, ignoresPrefixOfTopLevelAlternations) {
+    EXPECT_EQ("", prefixOf("^I have|I had$"));
+    EXPECT_EQ("I ", prefixOf("^I (?:have|had)$"));
+    EXPECT_EQ("a ", prefixOf("^a [|] b$"));
+}
+
+TEST(StepIndexTest, returnsCandidatesWhosePrefixFits) {
+    StepIndex index;
+    index.add(1, "^I have (\\d+) cucumbers$");
+    index.add(2, "^I have a (\\w+)$");
+    index.add(3, "^the user logs in$");
+    index.add(4, "^(.*)$");
+    index.add(5, "logs in");
+
+    EXPECT_THAT(index.candidates("I have 42 cucumbers"), ElementsAre(1, 4));
+    EXPECT_THAT(index.candidates("I have a cucumber"), ElementsAre(1, 2, 4));
+    EXPECT_THAT(index.candidates("the user logs in"), ElementsAre(3, 4, 5));
+    EXPECT_THAT(index.candidates("I"), ElementsAre(4));
+}
+
+TEST(StepIndexTest, returnsCandidatesForDescriptionsStartingWithAPrefix) {
+    StepIndex index;
+    index.add(1, "^I have (\\d+) cucumbers$");
+    index.add(2, "^I have a (\\w+)$");
+    index.add(3, "^the user logs in$");
+    index.add(4, "^(.*)$");
+    index.add(5, "logs in");
+    index.add(6, "^I$");
+
+    EXPECT_THAT(index.prefixedCandidates("I have "), ElementsAre(1, 2, 4, 5, 6));
+    EXPECT_THAT(index.prefixedCandidates("I have 4"), ElementsAre(1, 4, 5, 6));
+    EXPECT_THAT(index.prefixedCandidates("the "), ElementsAre(3, 4, 5));
+    EXPECT_THAT(index.prefixedCandidates(""), ElementsAre(1, 2, 3, 4, 5, 6));
+}
+
+TEST(StepIndexTest, returnsCandidatesInIdOrder) {
+    StepIndex index;
+    index.add(7, "^a (.*)$");
+    index.add(3, "^a b$");
+    index.add(5, "^(.*)$");
+    index.add(1, "b");
+
+    EXPECT_THAT(index.candidates("a b"), ElementsAre(1, 3, 5, 7));
+}
+
+TEST(StepIndexTest, hasNoCandidatesOnceCleared) {
+    StepIndex index;
+    index.add(1, "^a b$");
+    index.add(2, "a b");
+    index.clear();
+
+    EXPECT_THAT(index.candidates("a b"), IsEmpty());
+}
+
+TEST(StepIndexTest, extractsRequiredLiteralsOutsideOfGroups) {
+    EXPECT_THAT(
+        extractRequiredLiterals("^I have (\\d+) cucumbers in my (\\w+)$"),
+        ElementsAre("I have ", " cucumbers in my ")
+    );
+    EXPECT_THAT(
+        extractRequiredLiterals("there (?:is|are) (-?\\d+) flight(?:s)?$"),
+        ElementsAre("there ", " ", " flight")
+    );
+    EXPECT_THAT(extractRequiredLiterals("^a [xyz]+ b\\d c$"), ElementsAre("a ", " b", " c"));
+    EXPECT_THAT(
+        extractRequiredLiterals("^cucumbers? and tomatoes$"),
+        ElementsAre("cucumber", " and tomatoes")
+    );
+    EXPECT_THAT(extractRequiredLiterals("^a|b$"), IsEmpty());
+}
+
+TEST(StepIndexTest, skipsTheBoundsOfBraceQuantifiers) {
+    EXPECT_THAT(extractRequiredLiterals("^the year is \\d{4}$"), ElementsAre("the year is "));
+    EXPECT_THAT(extractRequiredLiterals("^a{2,3} bb{0,1}c{0}d$"), ElementsAre("a", " b", "d"));
+}
+
+TEST(StepIndexTest, returnsCandidatesOfStepsWithBraceQuantifiers) {
+    StepIndex index(MULTI_PATTERN_INDEX);
+    index.add(1, "^the year is \\d{4}$");
+
+    EXPECT_THAT(index.candidates("the year is 2023"), ElementsAre(1));
+}
+
+TEST(StepIndexTest, automatonFindsAllLiteralsInOnePass) {
+    LiteralAutomaton automaton;
+    automaton.add("he");
+    automaton.add("she");
+    automaton.add("his");
+    automaton.add("hers");
+
+    EXPECT_THAT(automaton.find("ushers"), ElementsAre(true, true, false, true));
+    EXPECT_THAT(automaton.find("this"), ElementsAre(false, false, true, false));
+    EXPECT_THAT(automaton.find(""), ElementsAre(false, false, false, false));
+
+    automaton.add("us");
+    EXPECT_THAT(automaton.find("ushers"), ElementsAre(true, true, false, true, true));
+}
+
+TEST(StepIndexTest, automatonTakesLiteralsAddedOnceBuilt) {
+    LiteralAutomaton automaton;
+    automaton.add("hers");
+    EXPECT_THAT(automaton.find("she"), ElementsAre(false));
+
+    // Ending inside and in front of literals already in the trie
+    automaton.add("he");
+    automaton.add("sh");
+    EXPECT_THAT(automaton.find("ushers"), ElementsAre(true, true, true));
+    EXPECT_THAT(automaton.find("she"), ElementsAre(false, true, true));
+}
+
+TEST(StepIndexTest, returnsCandidatesContainingAllRequiredLiterals) {
+    StepIndex index(MULTI_PATTERN_INDEX);
+    index.add(1, "^I have (\\d+) cucumbers in my (\\w+)$");
+    index.add(2, "cucumbers in my belly");
+    index.add(3, "^the user logs in$");
+    index.add(4, "^(.*)$");
+    index.add(5, "^in my (\\w+)$");
+
+    EXPECT_EQ(MULTI_PATTERN_INDEX, index.getMode());
+    EXPECT_THAT(index.candidates("I have 42 cucumbers in my belly"), ElementsAre(1, 2, 4));
+    EXPECT_THAT(index.candidates("I have 42 cucumbers in my"), ElementsAre(4));
+    EXPECT_THAT(index.candidates("the user logs in"), ElementsAre(3, 4));
+    EXPECT_THAT(index.candidates("in my belly"), ElementsAre(4, 5));
+
+    EXPECT_THAT(index.prefixedCandidates("I have "), ElementsAre(1, 2, 4));
+    EXPECT_THAT(index.prefixedCandidates("in "), ElementsAre(2, 4, 5));
+}
+
+TEST(StepIndexTest, knowsStepsWhosePrefixNoOtherOneStartsOrContinues) {
+    StepIndex index;
+    index.add(1, "^I have (\\d+) cucumbers$");
+    index.add(2, "^I have a (\\w+)$");
+    index.add(3, "^the user logs in$");
+    index.add(4, "^the user logs out$");
+    index.add(5, "^I have$");
+    index.prepare();
+
+    EXPECT_FALSE(index.isUnambiguous(1));
+    EXPECT_FALSE(index.isUnambiguous(2));
+    EXPECT_TRUE(index.isUnambiguous(3));
+    EXPECT_TRUE(index.isUnambiguous(4));
+    EXPECT_FALSE(index.isUnambiguous(5));
+    EXPECT_FALSE(index.isUnambiguous(6));
+}
+
+TEST(StepIndexTest, knowsNoStepUnambiguousNextToUnanchoredOnes) {
+    StepIndex index;
+    index.add(1, "^the user logs in$");
+    index.add(2, "logs out");
+    index.prepare();
+
+    EXPECT_FALSE(index.isUnambiguous(1));
+    EXPECT_FALSE(index.isUnambiguous(2));
+}
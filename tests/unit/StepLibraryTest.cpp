@@ -0,0 +1,19 @@
+#include <gmock/gmock.h>
+
+#include <cucumber-cpp/internal/step/StepLibrary.hpp>
+
+#include <stdexcept>
+
+using namespace cucumber::internal;
+using namespace testing;
+
+TEST(StepLibraryTest, loadsEachLibraryOnce) {
+    EXPECT_EQ(0, StepLibraries::load(STEP_LIBRARY_FIXTURE));
+    EXPECT_EQ(0, StepLibraries::load(STEP_LIBRARY_FIXTURE));
+    EXPECT_THAT(StepLibraries::loaded(), ElementsAre(STEP_LIBRARY_FIXTURE));
+}
+
+TEST(StepLibraryTest, failsForLibrariesThatCannotBeLoaded) {
+    EXPECT_THROW(StepLibraries::load("no/such/library.so"), std::runtime_error);
+    EXPECT_THAT(StepLibraries::loaded(), Not(Contains("no/such/library.so")));
+}
@@ -2,7 +2,10 @@
 
 #include "utils/StepManagerTestDouble.hpp"
 
+#include <atomic>
 #include <map>
+#include <sstream>
+#include <thread>
 
 using namespace std;
 using namespace cucumber::internal;
@@ -19,6 +22,7 @@ protected:
     const static char* no_match;
     const static char* a_third_matcher;
     const map<std::ptrdiff_t, string> no_params;
+    const bool lazyCompilationDefault = StepManager::isLazyCompilation();
 
     int getUniqueMatchIdOrZeroFor(const string& stepMatch) {
         MatchResult::match_results_type resultSet = getResultSetFor(stepMatch);
@@ -67,6 +71,8 @@ private:
     }
     void TearDown() override {
         StepManager::clearSteps();
+        StepManager::setLazyCompilation(lazyCompilationDefault);
+        StepManager::setFirstMatchOnly(false);
     }
 };
 
@@ -91,6 +97,28 @@ TEST_F(StepManagerTest, holdsConflictingSteps) {
     ASSERT_EQ(3, StepManager::count());
 }
 
+TEST_F(StepManagerTest, looksUpStepsById) {
+    const step_id_type id = StepManager::addStepDefinition(a_matcher);
+    ASSERT_TRUE(StepManager::getStep(id) != NULL);
+    EXPECT_EQ(id, StepManager::getStep(id)->id);
+    EXPECT_TRUE(StepManager::getStep(0) == NULL);
+    EXPECT_TRUE(StepManager::getStep(id + 1) == NULL);
+}
+
+TEST_F(StepManagerTest, registersStepsInBulk) {
+    const std::vector<std::shared_ptr<StepInfo>> stepInfos = {
+        std::make_shared<StepInfoNoOp>(a_matcher, ""),
+        std::make_shared<StepInfoNoOp>(another_matcher, ""),
+        std::make_shared<StepInfoNoOp>(a_matcher, "")
+    };
+    EXPECT_FALSE(matchesAtLeastOnce(a_matcher));
+    StepManager::addSteps(stepInfos);
+    ASSERT_EQ(3, StepManager::count());
+    EXPECT_EQ(stepInfos[1].get(), StepManager::getStep(stepInfos[1]->id));
+    EXPECT_EQ(2, countMatches(a_matcher));
+    EXPECT_EQ(stepInfos[1]->id, getUniqueMatchIdOrZeroFor(another_matcher));
+}
+
 TEST_F(StepManagerTest, matchesStepsWithNonRegExMatchers) {
     EXPECT_FALSE(matchesAtLeastOnce(no_match));
     step_id_type aMatcherIndex = StepManager::addStepDefinition(a_matcher);
@@ -134,3 +162,303 @@ TEST_F(StepManagerTest, matchesStepsWithNonAsciiMatchers) {
     EXPECT_FALSE(matchesAtLeastOnce("огурец"));
     EXPECT_FALSE(matchesAtLeastOnce("黄瓜"));
 }
+
+TEST_F(StepManagerTest, cachesMatchResults) {
+    step_id_type aMatcherIndex = StepManager::addStepDefinition(a_matcher);
+    EXPECT_EQ(0, StepManager::cachedMatchCount());
+    EXPECT_EQ(aMatcherIndex, getUniqueMatchIdOrZeroFor(a_matcher));
+    EXPECT_EQ(aMatcherIndex, getUniqueMatchIdOrZeroFor(a_matcher));
+    EXPECT_FALSE(matchesAtLeastOnce(no_match));
+    EXPECT_EQ(2, StepManager::cachedMatchCount());
+}
+
+TEST_F(StepManagerTest, cachedMatchesKeepExtractedParams) {
+    StepManager::addStepDefinition("match the (\\w+) param");
+    EXPECT_TRUE(extractedParamsAre("match the first param", {{10, "first"}}));
+    EXPECT_TRUE(extractedParamsAre("match the first param", {{10, "first"}}));
+    EXPECT_TRUE(extractedParamsAre("match the second param", {{10, "second"}}));
+}
+
+TEST_F(StepManagerTest, invalidatesCachedMatchesWhenStepsAreAdded) {
+    StepManager::addStepDefinition(another_matcher);
+    EXPECT_FALSE(matchesAtLeastOnce(a_matcher));
+    step_id_type aMatcherIndex = StepManager::addStepDefinition(a_matcher);
+    EXPECT_EQ(0, StepManager::cachedMatchCount());
+    EXPECT_EQ(aMatcherIndex, getUniqueMatchIdOrZeroFor(a_matcher));
+    StepManager::addStepDefinition(a_matcher);
+    EXPECT_EQ(2, countMatches(a_matcher));
+}
+
+TEST_F(StepManagerTest, matchesStepsWithMultiPatternIndex) {
+    StepManager::addStepDefinition("match the (\\w+) param");
+    StepManager::setIndexMode(MULTI_PATTERN_INDEX);
+    step_id_type aMatcherIndex = StepManager::addStepDefinition(a_matcher);
+    StepManager::addStepDefinition(another_matcher);
+
+    EXPECT_EQ(aMatcherIndex, getUniqueMatchIdOrZeroFor(a_matcher));
+    EXPECT_TRUE(extractedParamsAre("match the first param", {{10, "first"}}));
+    EXPECT_FALSE(matchesAtLeastOnce(no_match));
+}
+
+TEST_F(StepManagerTest, compilesLazyStepsOnFirstMatch) {
+    StepManager::setLazyCompilation(true);
+    step_id_type regexId = StepManager::addStepDefinition("match the (\\w+) param");
+    step_id_type cukexId = StepManager::addStepDefinition("I have {int} cucumber(s)");
+    EXPECT_FALSE(StepManager::getStep(regexId)->regex.isCompiled());
+    EXPECT_FALSE(StepManager::getStep(cukexId)->regex.isCompiled());
+
+    EXPECT_TRUE(extractedParamsAre("match the first param", {{10, "first"}}));
+    EXPECT_TRUE(StepManager::getStep(regexId)->regex.isCompiled());
+    EXPECT_FALSE(StepManager::getStep(cukexId)->regex.isCompiled());
+    EXPECT_TRUE(extractedParamsAre("I have 42 cucumbers", {{7, "42"}}));
+}
+
+TEST_F(StepManagerTest, reportsInvalidLazyStepsWhenMatching) {
+    StepManager::setLazyCompilation(true);
+    StepManager::addStepDefinition("unbalanced (");
+    EXPECT_THROW(StepManager::stepMatches("unbalanced ("), std::regex_error);
+}
+
+TEST_F(StepManagerTest, matchesInParallelInRegistrationOrder) {
+    StepManager::setMatchingThreads(4);
+    std::vector<step_id_type> expectedIds;
+    for (std::size_t i = 0; i < 2 * StepManager::PARALLEL_MATCH_MIN_CANDIDATES; ++i) {
+        const step_id_type id = StepManager::addStepDefinition(".*matcher " + to_string(i % 3));
+        if (i % 3 == 1) {
+            expectedIds.push_back(id);
+        }
+    }
+
+    const MatchResult::match_results_type resultSet =
+        StepManager::stepMatches("a matcher 1").getResultSet();
+    StepManager::setMatchingThreads(1);
+
+    ASSERT_EQ(expectedIds.size(), resultSet.size());
+    for (std::size_t i = 0; i < resultSet.size(); ++i) {
+        EXPECT_EQ(expectedIds[i], resultSet[i].stepInfo->id);
+    }
+}
+
+TEST_F(StepManagerTest, matchesWhileStepsAreRegistered) {
+    const int aMatcherId = StepManager::addStepDefinition(a_matcher);
+    std::atomic<bool> registering(true);
+    std::vector<std::thread> sessions;
+    std::atomic<std::size_t> mismatches(0);
+    for (int session = 0; session < 4; ++session) {
+        sessions.emplace_back([&] {
+            while (registering.load()) {
+                if (getUniqueMatchIdOrZeroFor(a_matcher) != aMatcherId) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; ++i) {
+        StepManager::addStepDefinition("step " + to_string(i) + " registered");
+    }
+    registering.store(false);
+    for (std::thread& session : sessions) {
+        session.join();
+    }
+
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_EQ(201, StepManager::count());
+    EXPECT_TRUE(matchesOnce("step 199 registered"));
+}
+
+TEST_F(StepManagerTest, matchesIntoReusableBuffer) {
+    step_id_type paramStepId = StepManager::addStepDefinition("match the (\\w+) param(s)?");
+    StepManager::addStepDefinition(a_matcher);
+    StepMatchBuffer buffer;
+
+    StepManager::stepMatches("match the first param", buffer);
+    ASSERT_EQ(1, buffer.getMatches().size());
+    const StepMatchBuffer::Match& match = buffer.getMatches().front();
+    EXPECT_EQ(paramStepId, match.stepInfo->id);
+    ASSERT_EQ(2, match.submatchCount);
+    EXPECT_EQ(10, buffer.getSubmatch(match, 0).begin);
+    EXPECT_EQ(15, buffer.getSubmatch(match, 0).end);
+    EXPECT_FALSE(buffer.getSubmatch(match, 1).matched());
+
+    StepManager::stepMatches(no_match, buffer);
+    EXPECT_TRUE(buffer.getMatches().empty());
+}
+
+TEST_F(StepManagerTest, matchesOutlineRowsLikeSeparateSteps) {
+    const step_id_type cucumbersId = StepManager::addStepDefinition("^I have (\\d+) cucumbers$");
+    const step_id_type anyId = StepManager::addStepDefinition("^I have (.+)$");
+    StepManager::addStepDefinition("^the user logs in$");
+    StepManager::addStepDefinition("^I have$");
+
+    const std::vector<std::string> rows = {"I have 3 cucumbers", "I have a cat", "I have"};
+    const std::vector<MatchResult> results =
+        StepManager::outlineStepMatches("I have <what>", rows);
+
+    ASSERT_EQ(rows.size(), results.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const MatchResult::match_results_type expected =
+            StepManager::stepMatches(rows[i]).getResultSet();
+        const MatchResult::match_results_type& actual = results[i].getResultSet();
+        ASSERT_EQ(expected.size(), actual.size()) << rows[i];
+        for (std::size_t j = 0; j < expected.size(); ++j) {
+            EXPECT_EQ(expected[j].stepInfo->id, actual[j].stepInfo->id);
+            EXPECT_EQ(expected[j].submatches.size(), actual[j].submatches.size());
+        }
+    }
+    ASSERT_EQ(2, results[0].getResultSet().size());
+    EXPECT_EQ(cucumbersId, results[0].getResultSet()[0].stepInfo->id);
+    EXPECT_EQ("3", results[0].getResultSet()[0].submatches[0].value);
+    EXPECT_EQ(anyId, results[1].getResultSet()[0].stepInfo->id);
+    EXPECT_EQ("a cat", results[1].getResultSet()[0].submatches[0].value);
+}
+
+TEST_F(StepManagerTest, matchesOutlineRowsStartingWithAPlaceholder) {
+    const step_id_type id = StepManager::addStepDefinition("^(\\w+) logs in$");
+
+    const std::vector<MatchResult> results =
+        StepManager::outlineStepMatches("<user> logs in", {"alice logs in", "bob logs out"});
+
+    ASSERT_EQ(2, results.size());
+    ASSERT_EQ(1, results[0].getResultSet().size());
+    EXPECT_EQ(id, results[0].getResultSet()[0].stepInfo->id);
+    EXPECT_TRUE(results[1].getResultSet().empty());
+}
+
+TEST_F(StepManagerTest, findsAmbiguousStepsWhenRegistered) {
+    const step_id_type cucumbers = StepManager::addStepDefinition("^I have cucumbers$");
+    const step_id_type anything = StepManager::addStepDefinition("^I have (.*)$");
+    const step_id_type logsIn = StepManager::addStepDefinition("^the user logs in$");
+    StepManager::addStepDefinition("^the user logs out$");
+    const step_id_type logsInAgain = StepManager::addStepDefinition("^the user logs in$");
+
+    const std::vector<StepAmbiguity> ambiguities = StepManager::ambiguousSteps();
+    ASSERT_EQ(2, ambiguities.size());
+    EXPECT_EQ(logsIn, ambiguities[0].first->id);
+    EXPECT_EQ(logsInAgain, ambiguities[0].second->id);
+    EXPECT_EQ("", ambiguities[0].example);
+    EXPECT_EQ(cucumbers, ambiguities[1].first->id);
+    EXPECT_EQ(anything, ambiguities[1].second->id);
+    EXPECT_EQ("I have cucumbers", ambiguities[1].example);
+
+    EXPECT_EQ(2, countMatches("I have cucumbers"));
+    EXPECT_TRUE(matchesOnce("the user logs out"));
+}
+
+TEST_F(StepManagerTest, stopsAtTheFirstMatchWhenAskedTo) {
+    const step_id_type first = StepManager::addStepDefinition("^I have (\\d+) cucumbers$");
+    StepManager::addStepDefinition("^I have (.*)$");
+    StepManager::setFirstMatchOnly(true);
+
+    EXPECT_EQ(first, getUniqueMatchIdOrZeroFor("I have 3 cucumbers"));
+    EXPECT_TRUE(matchesOnce("I have a cucumber"));
+
+    StepMatchBuffer buffer;
+    StepManager::stepMatches("I have 3 cucumbers", buffer);
+    EXPECT_EQ(1, buffer.getMatches().size());
+
+    const std::vector<MatchResult> results =
+        StepManager::outlineStepMatches("I have <count> cucumbers", {"I have 3 cucumbers"});
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(1, results[0].getResultSet().size());
+}
+
+TEST_F(StepManagerTest, triesTheMostMatchedStepsFirst) {
+    const step_id_type anyThings = StepManager::addStepDefinition("^I have (\\d+) (\\w+)$");
+    const step_id_type cucumbers = StepManager::addStepDefinition("^I have (.*) cucumbers$");
+    StepManager::setFirstMatchOnly(true);
+    EXPECT_EQ(anyThings, getUniqueMatchIdOrZeroFor("I have 3 cucumbers"));
+
+    StepMatchBuffer buffer;
+    for (std::uint64_t i = 0; i < StepManager::HOT_ORDER_PERIOD; ++i) {
+        StepManager::stepMatches("I have many cucumbers", buffer);
+    }
+    EXPECT_EQ(StepManager::HOT_ORDER_PERIOD, StepManager::getStep(cucumbers)->matchCount);
+
+    StepManager::stepMatches("I have 4 cucumbers", buffer);
+    ASSERT_EQ(1, buffer.getMatches().size());
+    EXPECT_EQ(cucumbers, buffer.getMatches().front().stepInfo->id);
+}
+
+TEST_F(StepManagerTest, reportsStepsProneToBacktracking) {
+    StepManager::addStepDefinition("^I have (\\d+) cucumbers$");
+    StepManager::addStepDefinition("^I have {float} cucumbers$");
+    std::ostringstream report;
+    EXPECT_FALSE(StepManager::reportBacktrackingHazards(report));
+
+    StepManager::addStepDefinition("^I have ((?:\\d+,?)+) cucumbers$");
+    EXPECT_TRUE(StepManager::reportBacktrackingHazards(report));
+    EXPECT_EQ(
+        "Step definition ^I have ((?:\\d+,?)+) cucumbers$ () may backtrack at length on long "
+        "steps: nested unbounded quantifiers in the group at offset 9\n",
+        report.str()
+    );
+}
+
+template<typename T>
+class StringConversionTest : public ::testing::Test {};
+
+typedef ::testing::Types<int, unsigned int, long long, unsigned short, float, double>
+    NumberTypes;
+TYPED_TEST_SUITE(StringConversionTest, NumberTypes);
+
+TYPED_TEST(StringConversionTest, convertsNumbersLikeStreams) {
+    const char* const inputs[] = {
+        "0", "42", "-17", "+5", " 8", "9 ", "12abc", "007", "1.5", "-2.25", ".5", "1e3", "1.5e",
+        "0x10", "-0", "+-1", "", "abc", "inf", "nan", "99999999999999999999"
+    };
+    for (const char* const input : inputs) {
+        TypeParam expected{};
+        bool streamFails = false;
+        try {
+            expected = fromStream<TypeParam>(input);
+        } catch (const std::invalid_argument&) {
+            streamFails = true;
+        }
+        if (streamFails) {
+            EXPECT_THROW(fromString<TypeParam>(input), std::invalid_argument) << input;
+        } else {
+            EXPECT_EQ(expected, fromString<TypeParam>(input)) << input;
+        }
+    }
+}
+
+TYPED_TEST(StringConversionTest, formatsNumbersLikeStreams) {
+    const TypeParam values[] = {
+        TypeParam(0), TypeParam(42), TypeParam(1.0 / 3), std::numeric_limits<TypeParam>::max(),
+        std::numeric_limits<TypeParam>::lowest()
+    };
+    for (const TypeParam value : values) {
+        std::stringstream expected;
+        expected << value;
+        EXPECT_EQ(expected.str(), toString(value));
+    }
+}
+
+TEST(InvokeArgsTest, viewsArgumentsWhereTheyAreKept) {
+    InvokeArgs args;
+    args.addArg(std::string(1000, 'x'));
+
+    const std::string_view docString = args.getInvokeArg<std::string_view>(0);
+
+    EXPECT_EQ(std::string(1000, 'x'), docString);
+    EXPECT_EQ(docString.data(), args.getInvokeArg<std::string_view>(0).data());
+}
+
+TEST(InvokeArgsTest, buildsTheTableWhenFirstAskedFor) {
+    InvokeArgs args;
+    args.setTableArg({{"C1", "C2"}, {"R11", "R12"}, {"R21", "R22"}});
+
+    const Table& table = args.getTableArg();
+
+    EXPECT_EQ(Table::columns_type({"C1", "C2"}), table.getColumns());
+    EXPECT_EQ(2, table.rowCount());
+    EXPECT_EQ("R21", table.cell(1, "C1"));
+    EXPECT_EQ(&table, &args.getTableArg());
+    EXPECT_EQ(2, args.getTableArg().rowCount());
+}
+
+TEST(InvokeArgsTest, rejectsTablesWithUnevenRowsUpFront) {
+    InvokeArgs args;
+
+    EXPECT_THROW(args.setTableArg({{"C1", "C2"}, {"R11"}}), std::range_error);
+}
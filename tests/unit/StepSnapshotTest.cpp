@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/step/StepSnapshot.hpp>
+#include <cucumber-cpp/internal/drivers/GenericDriver.hpp>
+
+#include <sstream>
+
+using namespace cucumber::internal;
+
+namespace {
+
+class SnapshotStep : public GenericStep {
+public:
+    void body() override {
+    }
+};
+
+const StepInfo* registerSnapshotStep(const std::string& stepMatcher) {
+    return StepManager::getStep(registerStep<SnapshotStep>(stepMatcher, __FILE__, __LINE__));
+}
+
+}
+
+TEST(StepSnapshotTest, capturesStepsWithoutCustomParameterTypes) {
+    registerSnapshotStep("a captured {int} and {string}");
+    registerSnapshotStep("^a captured regex (\\d+)$");
+    ParameterTypeRegistry::define("snapshotcolor", "red|blue");
+    registerSnapshotStep("a captured {snapshotcolor}");
+    ParameterTypeRegistry::clear();
+
+    const StepSnapshot snapshot = StepSnapshot::capture();
+    EXPECT_TRUE(snapshot.isCurrent());
+    EXPECT_EQ(nullptr, snapshot.find("a captured {snapshotcolor}"));
+
+    const StepSnapshotEntry* const expression = snapshot.find("a captured {int} and {string}");
+    ASSERT_NE(nullptr, expression);
+    EXPECT_EQ(cukex::transform("a captured {int} and {string}"), expression->regex);
+    ASSERT_EQ(2, expression->parameters.size());
+    EXPECT_EQ("string", expression->parameters[1].type);
+    EXPECT_TRUE(expression->hasMatcher);
+    EXPECT_EQ(CucumberExpressionMatcher::TEXT_SEGMENT, expression->segments[0].kind);
+    EXPECT_EQ("a captured ", expression->prefix.text);
+    EXPECT_TRUE(expression->prefix.anchored);
+
+    const StepSnapshotEntry* const regex = snapshot.find("^a captured regex (\\d+)$");
+    ASSERT_NE(nullptr, regex);
+    EXPECT_EQ("^a captured regex (\\d+)$", regex->regex);
+    EXPECT_TRUE(regex->parameters.empty());
+    EXPECT_FALSE(regex->hasMatcher);
+    EXPECT_EQ(std::vector<std::string>({"a captured regex "}), regex->requiredLiterals);
+
+    registerSnapshotStep("registered after the capture");
+    EXPECT_FALSE(snapshot.isCurrent());
+}
+
+TEST(StepSnapshotTest, readsWhatItWrote) {
+    registerSnapshotStep("a written {word} (or not)");
+    registerSnapshotStep("^a written regex$");
+    const StepSnapshot captured = StepSnapshot::capture();
+    std::stringstream file;
+    captured.write(file);
+
+    const StepSnapshot read = StepSnapshot::read(file);
+    EXPECT_TRUE(read.isCurrent());
+    ASSERT_EQ(captured.getEntries().size(), read.getEntries().size());
+    const StepSnapshotEntry* const written = captured.find("a written {word} (or not)");
+    const StepSnapshotEntry* const entry = read.find("a written {word} (or not)");
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(written->regex, entry->regex);
+    EXPECT_EQ(written->parameters[0].group, entry->parameters[0].group);
+    ASSERT_EQ(written->segments.size(), entry->segments.size());
+    EXPECT_EQ(written->segments[2].kind, entry->segments[2].kind);
+    EXPECT_EQ(written->segments[2].texts, entry->segments[2].texts);
+    EXPECT_EQ(written->requiredLiterals, entry->requiredLiterals);
+
+    std::istringstream malformed("{\"format\": 1, \"steps\": []}");
+    EXPECT_THROW(StepSnapshot::read(malformed), std::runtime_error);
+}
+
+TEST(StepSnapshotTest, registersStepsFromTheLoadedSnapshot) {
+    // Not what transforming the expression gives, to tell where it came from
+    std::istringstream file(
+        "{\"format\": 1, \"version\": \"other\", \"hash\": \"0000000000000001\", \"steps\": [{"
+        "\"matcher\": \"from the snapshot {int}\", \"regex\": \"^from the snapshot (\\\\d+)$\", "
+        "\"parameters\": [[\"int\", 1]], \"prefix\": \"from the \", \"anchored\": true, "
+        "\"literals\": []}]}"
+    );
+    const std::shared_ptr<const StepSnapshot> snapshot =
+        std::make_shared<StepSnapshot>(StepSnapshot::read(file));
+    EXPECT_FALSE(snapshot->isCurrentVersion());
+    StepSnapshot::load(snapshot);
+    const StepInfo* const step = registerSnapshotStep("from the snapshot {int}");
+    StepSnapshot::load(nullptr);
+
+    EXPECT_EQ("^from the snapshot (\\d+)$", step->regex.str());
+    EXPECT_FALSE(step->regex.isCompiled());
+    EXPECT_EQ(1, step->parameters.size());
+    EXPECT_TRUE(static_cast<bool>(StepManager::stepMatches("from the snapshot 12")));
+    EXPECT_TRUE(step->regex.isCompiled());
+    EXPECT_FALSE(static_cast<bool>(StepManager::stepMatches("from the snapshot -1")));
+
+    const StepInfo* const other = registerSnapshotStep("not from the snapshot {int}");
+    EXPECT_TRUE(other->regex.isCompiled());
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include "utils/CukeCommandsFixture.hpp"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace cucumber::internal;
+
+namespace {
+std::atomic<bool> released(false);
+std::atomic<bool> finished(false);
+}
+
+class HangingStep : public GenericStep {
+    void body() override {
+        while (!released) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        finished = true;
+    }
+};
+
+class ThrowingStep : public GenericStep {
+    void body() override {
+        throw std::runtime_error("thrown by the step");
+    }
+};
+
+class StepTimeoutsTest : public CukeCommandsFixture {
+protected:
+    const InvokeArgs noArgs;
+
+    void SetUp() override {
+        released = false;
+        finished = false;
+    }
+
+    void TearDown() override {
+        released = true;
+        CukeCommandsFixture::TearDown();
+    }
+
+    InvokeResult invokeStep() {
+        return invoke(stepId, &noArgs);
+    }
+
+    static void waitUntilFinished() {
+        released = true;
+        while (!finished) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST(ScenarioTimeoutsTest, readsBudgetsFromTags) {
+    const ScenarioTimeouts timeouts =
+        ScenarioTimeouts::fromTags({"wip", "timeout(500ms)", "@scenario_timeout(2min)"});
+    EXPECT_EQ(std::chrono::milliseconds(500), timeouts.step);
+    EXPECT_EQ(std::chrono::minutes(2), timeouts.scenario);
+
+    const ScenarioTimeouts none = ScenarioTimeouts::fromTags({"wip"});
+    EXPECT_EQ(0, none.step.count());
+    EXPECT_EQ(0, none.scenario.count());
+}
+
+TEST(ScenarioTimeoutsTest, parsesDurations) {
+    EXPECT_EQ(std::chrono::milliseconds(250), ScenarioTimeouts::parseDuration("250ms"));
+    EXPECT_EQ(std::chrono::seconds(3), ScenarioTimeouts::parseDuration("3s"));
+    EXPECT_EQ(std::chrono::minutes(1), ScenarioTimeouts::parseDuration("1min"));
+    EXPECT_THROW(ScenarioTimeouts::parseDuration("3"), std::invalid_argument);
+    EXPECT_THROW(ScenarioTimeouts::parseDuration("-3s"), std::invalid_argument);
+    EXPECT_THROW(ScenarioTimeouts::parseDuration("3h"), std::invalid_argument);
+    EXPECT_THROW(ScenarioTimeouts::fromTags({"timeout(soon)"}), std::invalid_argument);
+}
+
+TEST_F(StepTimeoutsTest, stepsWithinTheirBudgetSucceed) {
+    addStepToManager<EmptyStep>(STATIC_MATCHER);
+    beginScenario({"timeout(5s)"});
+    EXPECT_TRUE(invokeStep().isSuccess());
+    EXPECT_TRUE(invokeStep().isSuccess());
+    endScenario();
+}
+
+TEST_F(StepTimeoutsTest, stepsOverrunningTheirBudgetFail) {
+    addStepToManager<HangingStep>(STATIC_MATCHER);
+    beginScenario({"timeout(20ms)"});
+    const InvokeResult result = invokeStep();
+    EXPECT_EQ(FAILURE, result.getType());
+    EXPECT_NE(std::string::npos, result.getDescription().find("Step timed out"));
+    endScenario();
+    waitUntilFinished();
+
+    addStepToManager<EmptyStep>(STATIC_MATCHER);
+    beginScenario({"timeout(5s)"});
+    EXPECT_TRUE(invokeStep().isSuccess());
+    endScenario();
+}
+
+TEST_F(StepTimeoutsTest, stepsOverrunningTheirBudgetShareTheirArgs) {
+    addStepToManager<HangingStep>(STATIC_MATCHER);
+    beginScenario({"timeout(20ms)"});
+    const std::shared_ptr<const InvokeArgs> args = std::make_shared<const InvokeArgs>();
+    EXPECT_EQ(FAILURE, invoke(stepId, args).getType());
+    // Kept by the step still running instead of a copy
+    EXPECT_LT(1, args.use_count());
+    endScenario();
+    waitUntilFinished();
+}
+
+TEST_F(StepTimeoutsTest, stepsFailOnceTheScenarioBudgetIsSpent) {
+    addStepToManager<HangingStep>(STATIC_MATCHER);
+    beginScenario({"scenario_timeout(20ms)"});
+    const InvokeResult result = invokeStep();
+    EXPECT_NE(std::string::npos, result.getDescription().find("Scenario timed out"));
+    EXPECT_NE(std::string::npos, invokeStep().getDescription().find("Scenario timed out"));
+    endScenario();
+    waitUntilFinished();
+}
+
+TEST_F(StepTimeoutsTest, stepFailuresAreReportedWithinTheirBudget) {
+    addStepToManager<ThrowingStep>(STATIC_MATCHER);
+    beginScenario({"timeout(5s)"});
+    const InvokeResult result = invokeStep();
+    EXPECT_EQ(FAILURE, result.getType());
+    EXPECT_EQ("thrown by the step", result.getDescription());
+    endScenario();
+}
+
+TEST_F(StepTimeoutsTest, budgetsCanBeSetByHooks) {
+    addStepToManager<HangingStep>(STATIC_MATCHER);
+    beginScenario();
+    cucumber::setStepTimeout(std::chrono::milliseconds(20));
+    EXPECT_EQ(FAILURE, invokeStep().getType());
+    endScenario();
+    waitUntilFinished();
+}
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/utils/StringPool.hpp>
+
+#include <string>
+
+using namespace cucumber::internal;
+
+TEST(StringPoolTest, storesEachDistinctStringOnce) {
+    StringPool pool;
+    std::string text = "Steps.cpp:12";
+    const std::string_view interned = pool.intern(text);
+    text = "overwritten";
+
+    EXPECT_EQ("Steps.cpp:12", interned);
+    EXPECT_EQ(interned.data(), pool.intern("Steps.cpp:12").data());
+    EXPECT_NE(interned.data(), pool.intern("Steps.cpp:13").data());
+    EXPECT_EQ(2, pool.size());
+    EXPECT_EQ(24, pool.characters());
+}
+
+TEST(StringPoolTest, storesStringsBackToBack) {
+    StringPool pool;
+    const std::string_view first = pool.intern("first");
+    const std::string_view second = pool.intern("second");
+
+    EXPECT_EQ(first.data() + first.size(), second.data());
+}
+
+TEST(StringPoolTest, keepsLongStringsApart) {
+    StringPool pool;
+    const std::string_view first = pool.intern("first");
+    const std::string_view longer = pool.intern(std::string(StringPool::BLOCK_SIZE + 1, 'x'));
+    const std::string_view second = pool.intern("second");
+
+    EXPECT_EQ(StringPool::BLOCK_SIZE + 1, longer.size());
+    EXPECT_EQ(first.data() + first.size(), second.data());
+    EXPECT_TRUE(pool.intern("").empty());
+}
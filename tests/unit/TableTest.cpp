@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <cucumber-cpp/internal/Table.hpp>
+
+#include <thread>
+
 using namespace cucumber::internal;
 
 TEST(TableTest, forbidsRowsNotMatchingTableColumnsSize) {
@@ -64,3 +67,159 @@ TEST(TableTest, addedRowsMatchColumnDefinition) {
     EXPECT_EQ("R32", hashes[2]["C2"]);
     EXPECT_EQ("R43", hashes[3]["C3"]);
 }
+
+TEST(TableTest, cellsAreAccessibleByRowAndColumn) {
+    Table t;
+    t.addColumn("C1");
+    t.addColumn("C2");
+    t.addRow({"R11", "R12"});
+    t.addRow({"R21", "R22"});
+
+    EXPECT_EQ(2, t.rowCount());
+    EXPECT_EQ(Table::columns_type({"C1", "C2"}), t.getColumns());
+    EXPECT_EQ("R12", t.cell(0, 1));
+    EXPECT_EQ("R21", t.cell(1, "C1"));
+    EXPECT_EQ(1, t.columnIndex("C2"));
+
+    EXPECT_THROW(t.cell(2, 0), std::out_of_range);
+    EXPECT_THROW(t.cell(0, 2), std::out_of_range);
+    EXPECT_THROW(t.cell(0, "C3"), std::out_of_range);
+}
+
+TEST(TableTest, hashesIncludeRowsAddedAfterTheyWereBuilt) {
+    Table t;
+    t.addColumn("C1");
+    t.addRow({"R1"});
+    ASSERT_EQ(1, t.hashes().size());
+
+    t.addRow({"R2"});
+
+    ASSERT_EQ(2, t.hashes().size());
+    EXPECT_EQ("R2", t.hashes()[1].at("C1"));
+}
+
+TEST(TableTest, hashesAreBuiltOnceForThreadsAskingAtOnce) {
+    Table t;
+    t.addColumn("C1");
+    for (int row = 0; row < 1000; ++row) {
+        t.addRow({std::to_string(row)});
+    }
+
+    std::vector<const Table::hashes_type*> built(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < built.size(); ++i) {
+        threads.emplace_back([&t, &built, i] {
+            built[i] = &t.hashes();
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const Table::hashes_type* hashes : built) {
+        EXPECT_EQ(&t.hashes(), hashes);
+    }
+    ASSERT_EQ(1000, t.hashes().size());
+    EXPECT_EQ("999", t.hashes()[999].at("C1"));
+}
+
+TEST(TableTest, copiesBuildHashesOfTheirOwn) {
+    Table t;
+    t.addColumn("C1");
+    t.addRow({"R1"});
+    ASSERT_EQ(1, t.hashes().size());
+
+    Table copy(t);
+    copy.addRow({"R2"});
+    t = copy;
+
+    ASSERT_EQ(2, t.hashes().size());
+    EXPECT_NE(&copy.hashes(), &t.hashes());
+    EXPECT_TRUE(std::is_nothrow_move_constructible<Table>::value);
+}
+
+TEST(TableTest, convertsNumericColumnsOnce) {
+    Table t;
+    t.addColumn("name");
+    t.addColumn("price");
+    t.addRow({"apple", "1.5"});
+    t.addRow({"pear", "-2"});
+
+    const std::vector<double>& prices = t.column<double>("price");
+
+    EXPECT_EQ(std::vector<double>({1.5, -2.0}), prices);
+    EXPECT_EQ(&prices, &t.column<double>("price"));
+    EXPECT_THROW(t.column<int>("name"), std::invalid_argument);
+    EXPECT_THROW(t.column<double>("name"), std::invalid_argument);
+    EXPECT_THROW(t.column<double>("weight"), std::out_of_range);
+}
+
+TEST(TableTest, convertsCellsAsStepArgumentsAreConverted) {
+    Table t;
+    t.addColumn("count");
+    t.addRow({"+5"});
+    t.addRow({" 5"});
+    t.addRow({"1.5"});
+
+    std::vector<int> arguments;
+    for (const Table::RowView& row : t.rows()) {
+        arguments.push_back(fromString<int>(row[0]));
+    }
+    EXPECT_EQ(std::vector<int>({5, 5, 1}), arguments);
+    EXPECT_EQ(arguments, t.column<int>("count"));
+}
+
+TEST(TableTest, typedColumnsAreConvertedOnceForThreadsAskingAtOnce) {
+    Table t;
+    t.addColumn("count");
+    for (int row = 0; row < 1000; ++row) {
+        t.addRow({std::to_string(row)});
+    }
+
+    std::vector<const std::vector<long>*> converted(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < converted.size(); ++i) {
+        threads.emplace_back([&t, &converted, i] {
+            converted[i] = &t.column<long>("count");
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const std::vector<long>* column : converted) {
+        EXPECT_EQ(&t.column<long>("count"), column);
+    }
+    EXPECT_EQ(999, t.column<long>("count").back());
+}
+
+TEST(TableTest, typedColumnsIncludeRowsAddedAfterTheyWereConverted) {
+    Table t;
+    t.addColumn("count");
+    t.addRow({"1"});
+    ASSERT_EQ(std::vector<long>({1}), t.column<long>("count"));
+
+    t.addRow({"2"});
+
+    EXPECT_EQ(std::vector<long>({1, 2}), t.column<long>("count"));
+}
+
+TEST(TableTest, rowsAreViewedWhereTheyAreStored) {
+    Table t;
+    t.addColumn("C1");
+    t.addColumn("C2");
+    t.reserveRows(2);
+    Table::row_type row({"R11", "R12"});
+    t.addRow(std::move(row));
+    t.addRow({"R21", "R22"});
+    EXPECT_TRUE(row.empty());
+
+    std::vector<std::string> cells;
+    for (const Table::RowView& view : t.rows()) {
+        ASSERT_EQ(2, view.size());
+        cells.insert(cells.end(), view.begin(), view.end());
+    }
+
+    EXPECT_EQ(std::vector<std::string>({"R11", "R12", "R21", "R22"}), cells);
+    EXPECT_EQ(&t.cell(1, 0), &(*++t.rows().begin())[0]);
+}
@@ -68,3 +68,69 @@ TEST(TagTest, compositeTagExpressionsAreHandled) {
     EXPECT_TRUE(tagExpr.matches({"a", "c", "d"}));
     EXPECT_FALSE(tagExpr.matches({"x", "c", "f"}));
 }
+
+TEST(TagTest, tagSetsOnlyHoldTagsKnownToSomeExpression) {
+    OrTagExpression tagExpr("@known");
+    EXPECT_TRUE(tagExpr.matches(TagSet({"unknown", "known"})));
+    EXPECT_FALSE(tagExpr.matches(TagSet({"unknown"})));
+}
+
+TEST(TagTest, tagSetsSpanSeveralWords) {
+    std::string csvTagNotation;
+    for (int i = 0; i < 150; ++i) {
+        csvTagNotation += "@tag" + std::to_string(i) + ",";
+    }
+    OrTagExpression manyTags(csvTagNotation);
+    OrTagExpression lastTag("@tag149");
+    EXPECT_TRUE(manyTags.matches({"tag149"}));
+    EXPECT_TRUE(lastTag.matches({"x", "tag149"}));
+    EXPECT_FALSE(lastTag.matches({"tag148"}));
+}
+
+TEST(TagTest, emptyBooleanExpressionMatchesAnyTag) {
+    BooleanTagExpression tagExpr("");
+    EXPECT_TRUE(tagExpr.matches({"x"}));
+    EXPECT_TRUE(tagExpr.matches(TagExpression::tag_list()));
+}
+
+TEST(TagTest, booleanExpressionsCombineTags) {
+    BooleanTagExpression tagExpr("@a and not (@b or @c)");
+    EXPECT_TRUE(tagExpr.matches({"a"}));
+    EXPECT_TRUE(tagExpr.matches({"a", "x"}));
+    EXPECT_FALSE(tagExpr.matches({"a", "b"}));
+    EXPECT_FALSE(tagExpr.matches({"a", "c"}));
+    EXPECT_FALSE(tagExpr.matches({"x"}));
+}
+
+TEST(TagTest, booleanExpressionsBindNotTighterThanAndTighterThanOr) {
+    BooleanTagExpression tagExpr("@a or @b and not @c");
+    EXPECT_TRUE(tagExpr.matches({"a", "c"}));
+    EXPECT_TRUE(tagExpr.matches({"b"}));
+    EXPECT_FALSE(tagExpr.matches({"b", "c"}));
+    EXPECT_FALSE(tagExpr.matches({"c"}));
+}
+
+TEST(TagTest, booleanExpressionsAllowNesting) {
+    BooleanTagExpression tagExpr("not(not (@a)) and ((@b))");
+    EXPECT_TRUE(tagExpr.matches({"a", "b"}));
+    EXPECT_FALSE(tagExpr.matches({"a"}));
+}
+
+TEST(TagTest, malformedBooleanExpressionsAreRejected) {
+    EXPECT_THROW(BooleanTagExpression("@a and"), std::invalid_argument);
+    EXPECT_THROW(BooleanTagExpression("@a @b"), std::invalid_argument);
+    EXPECT_THROW(BooleanTagExpression("(@a or @b"), std::invalid_argument);
+    EXPECT_THROW(BooleanTagExpression("@a)"), std::invalid_argument);
+    EXPECT_THROW(BooleanTagExpression("a"), std::invalid_argument);
+    EXPECT_THROW(BooleanTagExpression("not"), std::invalid_argument);
+}
+
+TEST(TagTest, hookNotationAcceptsLegacyAndBooleanArguments) {
+    const BooleanTagExpression tagExpr =
+        BooleanTagExpression::fromHookNotation("\"@a, @b\", \"not @c\"");
+    EXPECT_TRUE(tagExpr.matches({"a"}));
+    EXPECT_TRUE(tagExpr.matches({"b", "x"}));
+    EXPECT_FALSE(tagExpr.matches({"a", "c"}));
+    EXPECT_FALSE(tagExpr.matches({"x"}));
+    EXPECT_TRUE(BooleanTagExpression::fromHookNotation("").matches({"x"}));
+}
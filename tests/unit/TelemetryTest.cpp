@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/Telemetry.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <stdexcept>
+
+using namespace cucumber::internal;
+
+namespace {
+const std::string TRACE_PARENT = "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01";
+
+class RecordingExporter : public SpanExporter {
+public:
+    explicit RecordingExporter(std::vector<Span>& exported, bool throwing = false) :
+        exported(exported),
+        throwing(throwing) {
+    }
+
+    void exportSpans(const std::vector<Span>& spans) override {
+        exported.insert(exported.end(), spans.begin(), spans.end());
+        if (throwing) {
+            throw std::runtime_error("collector down");
+        }
+    }
+
+private:
+    std::vector<Span>& exported;
+    const bool throwing;
+};
+
+Span spanNamed(const std::string& name) {
+    return Telemetry::startSpan(name, nullptr);
+}
+}
+
+TEST(TelemetryTest, parsesW3CTraceParents) {
+    const std::optional<TraceContext> context = TraceContext::parse(TRACE_PARENT);
+    ASSERT_TRUE(context);
+    EXPECT_EQ("4bf92f3577b34da6a3ce929d0e0e4736", context->traceId);
+    EXPECT_EQ("00f067aa0ba902b7", context->spanId);
+    EXPECT_TRUE(context->sampled);
+    EXPECT_EQ(TRACE_PARENT, context->traceParent());
+
+    EXPECT_FALSE(
+        TraceContext::parse("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-00")->sampled
+    );
+    // Later versions may add fields
+    EXPECT_TRUE(TraceContext::parse(
+        "01-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01-extra"
+    ));
+}
+
+TEST(TelemetryTest, rejectsMalformedTraceParents) {
+    EXPECT_FALSE(TraceContext::parse(""));
+    EXPECT_FALSE(TraceContext::parse(TRACE_PARENT + "-extra"));
+    EXPECT_FALSE(TraceContext::parse("00-4BF92F3577B34DA6A3CE929D0E0E4736-00f067aa0ba902b7-01"));
+    EXPECT_FALSE(TraceContext::parse("00-00000000000000000000000000000000-00f067aa0ba902b7-01"));
+    EXPECT_FALSE(TraceContext::parse("00-4bf92f3577b34da6a3ce929d0e0e4736-0000000000000000-01"));
+    EXPECT_FALSE(TraceContext::parse("ff-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01"));
+}
+
+TEST(TelemetryTest, startsSpansInTheTraceOfTheirParent) {
+    const TraceContext parent = *TraceContext::parse(TRACE_PARENT);
+    const Span child = Telemetry::startSpan("child", &parent);
+    EXPECT_EQ(parent.traceId, child.context.traceId);
+    EXPECT_EQ(parent.spanId, child.parentSpanId);
+    EXPECT_EQ(16, child.context.spanId.size());
+    EXPECT_NE(parent.spanId, child.context.spanId);
+
+    const Span root = spanNamed("root");
+    EXPECT_EQ(32, root.context.traceId.size());
+    EXPECT_NE(parent.traceId, root.context.traceId);
+    EXPECT_TRUE(root.parentSpanId.empty());
+}
+
+TEST(TelemetryTest, encodesSpansAsOtlpJson) {
+    const TraceContext parent = *TraceContext::parse(TRACE_PARENT);
+    Span span = Telemetry::startSpan("a step", &parent);
+    span.attributes.emplace_back("code.source", "steps.cpp:7");
+    span.failed = true;
+    span.statusMessage = "expected 1";
+
+    const nlohmann::json request =
+        nlohmann::json::parse(OtlpJsonExporter::encode({span, spanNamed("root")}, "tests"));
+    const nlohmann::json& resourceSpans = request.at("resourceSpans").at(0);
+    EXPECT_EQ(
+        "tests",
+        resourceSpans.at("resource").at("attributes").at(0).at("value").at("stringValue")
+    );
+    const nlohmann::json& spans = resourceSpans.at("scopeSpans").at(0).at("spans");
+    ASSERT_EQ(2, spans.size());
+    EXPECT_EQ("a step", spans[0].at("name"));
+    EXPECT_EQ(parent.traceId, spans[0].at("traceId"));
+    EXPECT_EQ(parent.spanId, spans[0].at("parentSpanId"));
+    EXPECT_EQ("code.source", spans[0].at("attributes").at(0).at("key"));
+    EXPECT_EQ(2, spans[0].at("status").at("code"));
+    EXPECT_EQ("expected 1", spans[0].at("status").at("message"));
+    EXPECT_FALSE(spans[1].contains("parentSpanId"));
+    EXPECT_FALSE(spans[1].contains("status"));
+}
+
+TEST(TelemetryTest, exportsQueuedSpansInBatchesWhenFlushed) {
+    std::vector<Span> exported;
+    BatchSpanProcessor processor(
+        std::make_unique<RecordingExporter>(exported), 2048, 2, std::chrono::hours(1)
+    );
+    for (int i = 0; i < 5; ++i) {
+        processor.onEnd(spanNamed("span"));
+    }
+    processor.forceFlush();
+    EXPECT_EQ(5, exported.size());
+    EXPECT_EQ(0, processor.getDropped());
+}
+
+TEST(TelemetryTest, dropsSpansEndingWhileTheQueueIsFull) {
+    std::vector<Span> exported;
+    {
+        BatchSpanProcessor processor(
+            std::make_unique<RecordingExporter>(exported), 3, 512, std::chrono::hours(1)
+        );
+        for (int i = 0; i < 5; ++i) {
+            processor.onEnd(spanNamed("span"));
+        }
+        EXPECT_EQ(2, processor.getDropped());
+    }
+    // Exported on destruction
+    EXPECT_EQ(3, exported.size());
+}
+
+TEST(TelemetryTest, countsFailedExports) {
+    std::vector<Span> exported;
+    BatchSpanProcessor processor(
+        std::make_unique<RecordingExporter>(exported, true), 2048, 512, std::chrono::hours(1)
+    );
+    processor.onEnd(spanNamed("span"));
+    processor.forceFlush();
+    EXPECT_EQ(1, processor.getFailedExports());
+}
+
+TEST(TelemetryTest, exposesTheSpanOfTheRunningStep) {
+    std::vector<Span> exported;
+    BatchSpanProcessor processor(std::make_unique<RecordingExporter>(exported));
+    Telemetry::setProcessor(&processor);
+    EXPECT_TRUE(Telemetry::isEnabled());
+    const TraceContext parent = *TraceContext::parse(TRACE_PARENT);
+    std::string traceParent;
+    {
+        ScopedSpan span("a step", parent);
+        span.fail("failed");
+        traceParent = Telemetry::currentTraceParent();
+    }
+    EXPECT_TRUE(Telemetry::currentTraceParent().empty());
+    processor.forceFlush();
+    Telemetry::setProcessor(nullptr);
+    EXPECT_FALSE(Telemetry::isEnabled());
+
+    ASSERT_EQ(1, exported.size());
+    EXPECT_EQ(exported[0].context.traceParent(), traceParent);
+    EXPECT_EQ(parent.spanId, exported[0].parentSpanId);
+    EXPECT_TRUE(exported[0].failed);
+}
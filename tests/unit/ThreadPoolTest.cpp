@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/utils/ThreadPool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace cucumber::internal;
+
+TEST(ThreadPoolTest, returnsTaskResults) {
+    ThreadPool pool(2);
+    EXPECT_EQ(2, pool.size());
+
+    std::future<int> first = pool.submit([] {
+        return 1;
+    });
+    std::future<int> second = pool.submit([] {
+        return 2;
+    });
+    EXPECT_EQ(1, first.get());
+    EXPECT_EQ(2, second.get());
+}
+
+TEST(ThreadPoolTest, forwardsTaskExceptions) {
+    ThreadPool pool(1);
+    std::future<void> failing = pool.submit([] {
+        throw std::runtime_error("failure");
+    });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, runsPendingTasksBeforeDestruction) {
+    std::atomic<int> executed(0);
+    {
+        ThreadPool pool(1);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&executed] {
+                ++executed;
+            });
+        }
+    }
+    EXPECT_EQ(100, executed);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/Timings.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace cucumber::internal;
+
+TEST(TimingsTest, bucketsKeepValuesWithinTheirPrecision) {
+    for (LatencyHistogram::value_type value = 0; value < 100000; value += 7) {
+        const std::size_t index = LatencyHistogram::bucketIndex(value);
+        ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+        const LatencyHistogram::value_type upper = LatencyHistogram::bucketUpperValue(index);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(upper - value, value / LatencyHistogram::SUB_BUCKET_COUNT);
+    }
+    EXPECT_EQ(
+        LatencyHistogram::BUCKET_COUNT - 1,
+        LatencyHistogram::bucketIndex(~LatencyHistogram::value_type(0))
+    );
+}
+
+TEST(TimingsTest, histogramsReportPercentilesAndExactCountTotalAndMax) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.percentile(50));
+    for (LatencyHistogram::value_type micros = 1; micros <= 1000; ++micros) {
+        histogram.record(micros * 1000);
+    }
+    EXPECT_EQ(1000, histogram.getCount());
+    EXPECT_EQ(500500000, histogram.getTotal());
+    EXPECT_EQ(1000000, histogram.getMax());
+    EXPECT_NEAR(500000, histogram.percentile(50), 500000 / 16);
+    EXPECT_NEAR(990000, histogram.percentile(99), 990000 / 16);
+    EXPECT_EQ(1000000, histogram.percentile(100));
+
+    LatencyHistogram merged(histogram);
+    merged.add(histogram);
+    EXPECT_EQ(2000, merged.getCount());
+    EXPECT_EQ(histogram.percentile(50), merged.percentile(50));
+}
+
+TEST(TimingsTest, mergesTheTimingsOfEveryThread) {
+    const step_id_type stepId = 424242;
+    Timings::setEnabled(true);
+    std::thread first([stepId] {
+        Timings::record(TIMED_INVOKE, std::chrono::microseconds(5), stepId);
+    });
+    first.join();
+    Timings::record(TIMED_INVOKE, std::chrono::microseconds(7), stepId);
+    {
+        const ScopedTiming timing(TIMED_INVOKE, stepId);
+    }
+    Timings::setEnabled(false);
+    {
+        const ScopedTiming timing(TIMED_INVOKE, stepId);
+    }
+
+    const TimingSnapshot snapshot = Timings::snapshot();
+    ASSERT_EQ(1, snapshot.steps.count(stepId));
+    const LatencyHistogram& step = snapshot.steps.at(stepId);
+    EXPECT_EQ(3, step.getCount());
+    EXPECT_GE(step.getTotal(), 12000);
+    EXPECT_GE(step.getMax(), 7000);
+    EXPECT_GE(snapshot.operations[TIMED_INVOKE].getCount(), 3);
+
+    std::ostringstream report;
+    Timings::report(report);
+    EXPECT_NE(std::string::npos, report.str().find("step_matches"));
+    EXPECT_NE(std::string::npos, report.str().find("step 424242"));
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/TraceRecorder.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+using namespace cucumber::internal;
+
+namespace {
+std::size_t countEvents(const std::string& name) {
+    const std::vector<TraceEvent> events = TraceRecorder::events();
+    return std::count_if(events.begin(), events.end(), [&name](const TraceEvent& event) {
+        return event.name == name;
+    });
+}
+}
+
+TEST(TraceRecorderTest, recordsTheEventsOfEveryThreadWhileEnabled) {
+    TraceRecorder::setEnabled(true);
+    std::thread other([] {
+        const ScopedTraceEvent trace("invoke", "traced step", "steps.cpp:7");
+    });
+    other.join();
+    {
+        const ScopedTraceEvent trace("invoke", "traced step", "steps.cpp:7");
+    }
+    TraceRecorder::setEnabled(false);
+    {
+        const ScopedTraceEvent trace("invoke", "traced step", "steps.cpp:7");
+    }
+
+    std::vector<TraceEvent> events = TraceRecorder::events();
+    events.erase(
+        std::remove_if(
+            events.begin(),
+            events.end(),
+            [](const TraceEvent& event) {
+                return event.name != "traced step";
+            }
+        ),
+        events.end()
+    );
+    ASSERT_EQ(2, events.size());
+    EXPECT_NE(events[0].thread, events[1].thread);
+    EXPECT_LE(events[0].begin, events[1].begin);
+    EXPECT_STREQ("invoke", events[1].category);
+    EXPECT_EQ("steps.cpp:7", events[1].source);
+}
+
+TEST(TraceRecorderTest, writesCompleteEventsInTheChromeTraceFormat) {
+    const auto begin = std::chrono::steady_clock::now();
+    TraceRecorder::record("scenario", "scenario \"quoted\"", "a.feature", begin, begin);
+    EXPECT_EQ(1, countEvents("scenario \"quoted\""));
+
+    std::ostringstream out;
+    TraceRecorder::write(out);
+    const nlohmann::json trace = nlohmann::json::parse(out.str());
+    const nlohmann::json& events = trace.at("traceEvents");
+    const auto event =
+        std::find_if(events.begin(), events.end(), [](const nlohmann::json& event) {
+            return event.value("name", "") == "scenario \"quoted\"";
+        });
+    ASSERT_NE(events.end(), event);
+    EXPECT_EQ("X", event->at("ph"));
+    EXPECT_EQ("scenario", event->at("cat"));
+    EXPECT_EQ("a.feature", event->at("args").at("source"));
+    EXPECT_EQ(0.0, event->at("dur").get<double>());
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/hook/HookRegistrar.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace cucumber::internal;
+
+namespace {
+
+class FunctionHook : public BeforeAllHook {
+public:
+    FunctionHook(const std::string& csvNameNotation, std::function<void()> function) :
+        function(std::move(function)) {
+        setDependencies(csvNameNotation);
+    }
+
+    void body() override {
+        function();
+    }
+
+private:
+    const std::function<void()> function;
+};
+
+class HookRegistrarDouble : public HookRegistrar {
+public:
+    using HookRegistrar::execUnconditionalHooks;
+};
+
+}
+
+class UnconditionalHookTest : public ::testing::Test {
+protected:
+    HookRegistrar::unconditionalhook_list_type hooks;
+    std::mutex mutex;
+    std::string order;
+
+    void addHook(const std::string& csvNameNotation, const std::string& marker) {
+        addHook(csvNameNotation, [this, marker] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order += marker;
+        });
+    }
+
+    void addHook(const std::string& csvNameNotation, std::function<void()> function) {
+        hooks.push_back(std::make_shared<FunctionHook>(csvNameNotation, std::move(function)));
+    }
+
+    void execHooks() {
+        HookRegistrarDouble::execUnconditionalHooks(hooks);
+    }
+};
+
+TEST_F(UnconditionalHookTest, readsNamesAndDependenciesFromTheMacroArguments) {
+    const FunctionHook unnamed("", [] {});
+    EXPECT_EQ("", unnamed.getName());
+    EXPECT_TRUE(unnamed.getDependencies().empty());
+
+    const FunctionHook broker("\"broker\", \"database\", \"mock servers\"", [] {});
+    EXPECT_EQ("broker", broker.getName());
+    EXPECT_EQ(
+        std::vector<std::string>({"database", "mock servers"}), broker.getDependencies()
+    );
+
+    EXPECT_THROW(FunctionHook("\"broker\", \" \"", [] {}), std::invalid_argument);
+}
+
+TEST_F(UnconditionalHookTest, runsIndependentHooksConcurrently) {
+    std::atomic<int> started(0);
+    const auto waitForTheOther = [&started] {
+        ++started;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (started.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        if (started.load() < 2) {
+            throw std::runtime_error("ran alone");
+        }
+    };
+    addHook("\"database\"", waitForTheOther);
+    addHook("\"broker\"", waitForTheOther);
+    EXPECT_NO_THROW(execHooks());
+}
+
+TEST_F(UnconditionalHookTest, runsHooksOnceTheirDependenciesRan) {
+    addHook("\"schema\", \"database\"", "S");
+    addHook("\"broker\", \"database\"", "B");
+    addHook("\"database\"", "D");
+    addHook("\"mocks\", \"schema\", \"broker\"", "M");
+    execHooks();
+
+    ASSERT_EQ(4, order.size());
+    EXPECT_EQ('D', order.front());
+    EXPECT_EQ('M', order.back());
+}
+
+TEST_F(UnconditionalHookTest, runsUnnamedHooksAlone) {
+    addHook("\"first\"", "1");
+    addHook("\"second\"", "2");
+    addHook("", "U");
+    addHook("\"third\"", "3");
+    addHook("\"fourth\"", "4");
+    execHooks();
+
+    ASSERT_EQ(5, order.size());
+    EXPECT_EQ('U', order[2]);
+}
+
+TEST_F(UnconditionalHookTest, joinsTheErrorsOfFailedHooks) {
+    addHook("\"database\"", [] {
+        throw std::runtime_error("database down");
+    });
+    addHook("\"broker\"", [] {
+        throw std::runtime_error("broker down");
+    });
+    addHook("\"schema\", \"database\"", "S");
+
+    try {
+        execHooks();
+        FAIL() << "No exception thrown";
+    } catch (const std::runtime_error& e) {
+        EXPECT_EQ(std::string("2 hooks failed: database down; broker down"), e.what());
+    }
+    EXPECT_EQ("", order);
+}
+
+TEST_F(UnconditionalHookTest, rethrowsTheErrorOfASingleFailedHook) {
+    addHook("\"database\"", [] {
+        throw std::logic_error("database down");
+    });
+    addHook("\"broker\"", "B");
+    EXPECT_THROW(execHooks(), std::logic_error);
+    EXPECT_EQ("B", order);
+}
+
+TEST_F(UnconditionalHookTest, rejectsInvalidDependenciesBeforeRunningAnyHook) {
+    addHook("\"database\"", "D");
+    addHook("\"broker\", \"cache\"", "B");
+    EXPECT_THROW(execHooks(), std::invalid_argument);
+
+    hooks.pop_back();
+    addHook("\"database\"", "D");
+    EXPECT_THROW(execHooks(), std::invalid_argument);
+
+    hooks.pop_back();
+    addHook("\"broker\", \"schema\"", "B");
+    addHook("\"schema\", \"broker\"", "S");
+    EXPECT_THROW(execHooks(), std::invalid_argument);
+    EXPECT_EQ("", order);
+}
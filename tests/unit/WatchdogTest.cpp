@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <cucumber-cpp/internal/utils/Watchdog.hpp>
+
+#include <atomic>
+#include <future>
+
+using namespace cucumber::internal;
+
+TEST(WatchdogTest, callsBackOnceExpired) {
+    Watchdog watchdog;
+    std::promise<void> called;
+    const Watchdog::clock_type::time_point start = Watchdog::clock_type::now();
+    watchdog.arm(std::chrono::milliseconds(20), [&called] {
+        called.set_value();
+    });
+    EXPECT_EQ(1u, watchdog.armed());
+
+    ASSERT_EQ(
+        std::future_status::ready, called.get_future().wait_for(std::chrono::seconds(5))
+    );
+    EXPECT_GE(Watchdog::clock_type::now() - start, std::chrono::milliseconds(20));
+    EXPECT_EQ(0u, watchdog.armed());
+}
+
+TEST(WatchdogTest, expiresTimersBeyondATurnOfTheWheel) {
+    Watchdog watchdog;
+    std::promise<void> called;
+    const std::chrono::milliseconds timeout = Watchdog::TICK * (Watchdog::WHEEL_SIZE + 10);
+    const Watchdog::clock_type::time_point start = Watchdog::clock_type::now();
+    watchdog.arm(timeout, [&called] {
+        called.set_value();
+    });
+
+    ASSERT_EQ(
+        std::future_status::ready, called.get_future().wait_for(std::chrono::seconds(10))
+    );
+    EXPECT_GE(Watchdog::clock_type::now() - start, timeout);
+}
+
+TEST(WatchdogTest, disarmedTimersDoNotCallBack) {
+    Watchdog watchdog;
+    std::atomic<int> calls(0);
+    const Watchdog::timer_type disarmed =
+        watchdog.arm(std::chrono::milliseconds(10), [&calls] {
+            ++calls;
+        });
+    std::promise<void> called;
+    watchdog.arm(std::chrono::milliseconds(30), [&called] {
+        called.set_value();
+    });
+
+    EXPECT_TRUE(watchdog.disarm(disarmed));
+    EXPECT_FALSE(watchdog.disarm(disarmed));
+    ASSERT_EQ(
+        std::future_status::ready, called.get_future().wait_for(std::chrono::seconds(5))
+    );
+    EXPECT_EQ(0, calls);
+}
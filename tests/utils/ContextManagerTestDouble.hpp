@@ -8,8 +8,8 @@ namespace internal {
 
 class ContextManagerTestDouble : public ContextManager {
 public:
-    contexts_type::size_type countContexts() {
-        return ContextManager::contexts.size();
+    ContextArena::size_type countContexts() {
+        return contexts().size();
     }
 };
 
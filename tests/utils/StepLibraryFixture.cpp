@@ -0,0 +1,5 @@
+// Loaded by StepLibraryTest, which cannot share its step registry with a
+// library linked to cucumber-cpp statically
+extern "C" int stepLibraryFixture() {
+    return 0;
+}
@@ -2,6 +2,9 @@
 #define CUKE_STEPMANAGERTESTDOUBLE_HPP_
 
 #include <cucumber-cpp/internal/step/StepManager.hpp>
+#include <cucumber-cpp/internal/step/StepIndex.hpp>
+
+#include <algorithm>
 
 namespace cucumber {
 namespace internal {
@@ -55,11 +58,16 @@ public:
 class StepManagerTestDouble : public StepManager {
 public:
     static void clearSteps() {
-        steps().clear();
+        clearRegistry();
     }
 
     static steps_type::size_type count() {
-        return steps().size();
+        const steps_type& steps = registeredSteps(*registry());
+        return steps.size() - std::count(steps.begin(), steps.end(), nullptr);
+    }
+
+    static match_cache_type::size_type cachedMatchCount() {
+        return matchCache().size();
     }
 
     static step_id_type addStepDefinition(const std::string& stepMatcher) {
@@ -107,15 +115,12 @@ public:
     }
 
     static step_id_type getStepId(const std::string& stepMatcher) {
-        step_id_type id = 0;
-        for (steps_type::const_iterator i = steps().begin(); i != steps().end(); ++i) {
-            const StepInfo& stepInfo = *i->second;
-            if (stepInfo.regex.str() == stepMatcher) {
-                id = stepInfo.id;
-                break;
+        for (const StepInfo* stepInfo : getSteps()) {
+            if (stepInfo->regex.str() == stepMatcher) {
+                return stepInfo->id;
             }
         }
-        return id;
+        return 0;
     }
 };
 
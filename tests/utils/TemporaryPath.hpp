@@ -0,0 +1,37 @@
+#ifndef CUKE_TEMPORARYPATH_HPP_
+#define CUKE_TEMPORARYPATH_HPP_
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#if defined(_WIN32)
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace cucumber {
+namespace internal {
+
+/**
+ * Path in the temporary directory of the running test alone: ctest runs
+ * every test both on its own and with the others of its binary, at once.
+ */
+inline std::filesystem::path temporaryTestPath(const std::string& suffix) {
+    const ::testing::TestInfo* test = ::testing::UnitTest::GetInstance()->current_test_info();
+#if defined(_WIN32)
+    const long pid = _getpid();
+#else
+    const long pid = getpid();
+#endif
+    return std::filesystem::temp_directory_path()
+           / (std::string(test->test_suite_name()) + "." + test->name() + "."
+              + std::to_string(pid) + suffix);
+}
+
+}
+}
+
+#endif /* CUKE_TEMPORARYPATH_HPP_ */
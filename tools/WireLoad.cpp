@@ -0,0 +1,319 @@
+#include <cucumber-cpp/internal/Timings.hpp>
+
+#include <asio.hpp>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace ::cucumber::internal;
+using json = nlohmann::json;
+
+struct Options {
+    std::string host = "127.0.0.1";
+    std::string port = "3902";
+    std::string unixPath;
+    std::size_t connections = 1;
+    std::size_t scenarios = 100;
+    std::string transcript;
+    std::vector<std::string> steps;
+};
+
+void usage(std::ostream& out, const char* program) {
+    out << "Usage: " << program << " [options]\n"
+        << "\n"
+        << "Loads a wire server with scenarios on concurrent connections, and reports\n"
+        << "the messages per second and the latency percentiles of every command.\n"
+        << "\n"
+        << "  -l, --listen <host>       Address of the wire server (default 127.0.0.1)\n"
+        << "  -p, --port <port>         Port of the wire server (default 3902)\n"
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        << "  -u, --unix <path>         Unix socket of the wire server, instead of a port\n"
+#endif
+        << "  -c, --connections <n>     Connections running scenarios at once (default 1)\n"
+        << "  -n, --scenarios <n>       Scenarios, or transcript replays, per connection\n"
+        << "                            (default 100)\n"
+        << "  -t, --transcript <file>   Replays the requests of the file, one per line,\n"
+        << "                            ignoring empty lines and lines starting with #\n"
+        << "  -s, --step <text>         Step of the synthetic scenarios, matched and invoked\n"
+        << "                            through begin_scenario and end_scenario; repeat for\n"
+        << "                            more steps\n"
+        << "  -h, --help                Show this help\n";
+}
+
+bool parseCount(const char* value, std::size_t& count) {
+    char* end;
+    count = std::strtoul(value, &end, 10);
+    return *end == '\0' && count != 0;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if ((arg == "-l" || arg == "--listen") && hasValue) {
+            options.host = argv[++i];
+        } else if ((arg == "-p" || arg == "--port") && hasValue) {
+            options.port = argv[++i];
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        } else if ((arg == "-u" || arg == "--unix") && hasValue) {
+            options.unixPath = argv[++i];
+#endif
+        } else if ((arg == "-c" || arg == "--connections") && hasValue) {
+            if (!parseCount(argv[++i], options.connections)) {
+                std::cerr << "Invalid number of connections: " << argv[i] << std::endl;
+                return false;
+            }
+        } else if ((arg == "-n" || arg == "--scenarios") && hasValue) {
+            if (!parseCount(argv[++i], options.scenarios)) {
+                std::cerr << "Invalid number of scenarios: " << argv[i] << std::endl;
+                return false;
+            }
+        } else if ((arg == "-t" || arg == "--transcript") && hasValue) {
+            options.transcript = argv[++i];
+        } else if ((arg == "-s" || arg == "--step") && hasValue) {
+            options.steps.push_back(argv[++i]);
+        } else if (arg == "-h" || arg == "--help") {
+            usage(std::cout, argv[0]);
+            std::exit(0);
+        } else {
+            std::cerr << "Unknown or incomplete option: " << arg << std::endl;
+            return false;
+        }
+    }
+    return options.transcript.empty() != options.steps.empty();
+}
+
+struct Request {
+    std::string command;
+    std::string line;
+};
+typedef std::vector<Request> transcript_type;
+
+transcript_type readTranscript(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Unable to read transcript " + path);
+    }
+    transcript_type transcript;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+        try {
+            transcript.push_back({json::parse(line).at(0).get<std::string>(), line});
+        } catch (const json::exception&) {
+            throw std::runtime_error("Not a wire request in " + path + ": " + line);
+        }
+    }
+    return transcript;
+}
+
+/** Latencies of a connection by command */
+typedef std::map<std::string, LatencyHistogram> latencies_type;
+
+/**
+ * Sends requests one at a time on a connection, timing each until its
+ * response arrived
+ */
+template<typename Stream>
+class Client {
+public:
+    Client(Stream& stream, latencies_type& latencies) :
+        stream(stream),
+        latencies(latencies) {
+    }
+
+    std::string exchange(const std::string& command, const std::string& request) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        stream << request << '\n' << std::flush;
+        std::string response;
+        if (!std::getline(stream, response)) {
+            throw std::runtime_error("Connection closed by the wire server");
+        }
+        latencies[command].record(static_cast<LatencyHistogram::value_type>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start
+            )
+                .count()
+        ));
+        return response;
+    }
+
+    void replay(const transcript_type& transcript) {
+        for (const Request& request : transcript) {
+            exchange(request.command, request.line);
+        }
+    }
+
+    /**
+     * Matches every step once, then invokes its first match with the
+     * arguments the match captured. Steps without a match are not invoked.
+     */
+    void runScenario(const std::vector<std::string>& steps) {
+        exchange("begin_scenario", "[\"begin_scenario\"]");
+        for (const std::string& step : steps) {
+            const json match = json::array({"step_matches", {{"name_to_match", step}}});
+            const std::string response = exchange("step_matches", match.dump());
+            std::map<std::string, std::string>::const_iterator invoke = invokes.find(step);
+            if (invoke == invokes.end()) {
+                invoke = invokes.emplace(step, invokeRequest(json::parse(response))).first;
+            }
+            if (!invoke->second.empty()) {
+                exchange("invoke", invoke->second);
+            }
+        }
+        exchange("end_scenario", "[\"end_scenario\"]");
+    }
+
+private:
+    static std::string invokeRequest(const json& matchResponse) {
+        if (matchResponse.at(0) != "success" || matchResponse.at(1).empty()) {
+            return std::string();
+        }
+        const json& match = matchResponse.at(1).at(0);
+        json args = json::array();
+        for (const json& arg : match.at("args")) {
+            args.push_back(arg.at("val"));
+        }
+        return json::array({"invoke", {{"id", match.at("id")}, {"args", args}}}).dump();
+    }
+
+    Stream& stream;
+    latencies_type& latencies;
+    /** Invoke request of every step, empty for undefined steps */
+    std::map<std::string, std::string> invokes;
+};
+
+template<typename Stream>
+void load(
+    Stream& stream,
+    const Options& options,
+    const transcript_type& transcript,
+    latencies_type& latencies
+) {
+    Client<Stream> client(stream, latencies);
+    for (std::size_t i = 0; i < options.scenarios; ++i) {
+        if (transcript.empty()) {
+            client.runScenario(options.steps);
+        } else {
+            client.replay(transcript);
+        }
+    }
+}
+
+void connectAndLoad(
+    const Options& options, const transcript_type& transcript, latencies_type& latencies
+) {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+    if (!options.unixPath.empty()) {
+        asio::local::stream_protocol::iostream stream;
+        stream.connect(asio::local::stream_protocol::endpoint(options.unixPath));
+        if (!stream) {
+            throw std::system_error(stream.error());
+        }
+        load(stream, options, transcript, latencies);
+        return;
+    }
+#endif
+    asio::ip::tcp::iostream stream(options.host, options.port);
+    if (!stream) {
+        throw std::system_error(stream.error());
+    }
+    // Requests wait for their response, Nagle's algorithm would only delay them
+    stream.socket().set_option(asio::ip::tcp::no_delay(true));
+    load(stream, options, transcript, latencies);
+}
+
+void report(const latencies_type& latencies, double seconds, std::size_t connections) {
+    std::uint64_t messages = 0;
+    for (const latencies_type::value_type& command : latencies) {
+        messages += command.second.getCount();
+    }
+    const auto micros = [](LatencyHistogram::value_type nanoseconds) {
+        return nanoseconds / 1000.0;
+    };
+    std::cout << std::fixed << std::setprecision(1) << messages << " messages in " << seconds
+              << " s over " << connections << " connections: " << messages / seconds
+              << " messages/s\n\n"
+              << std::left << std::setw(16) << "Latencies (us)" << std::right << std::setw(12)
+              << "count" << std::setw(12) << "p50" << std::setw(12) << "p90" << std::setw(12)
+              << "p99" << std::setw(12) << "max" << "\n";
+    for (const latencies_type::value_type& command : latencies) {
+        const LatencyHistogram& histogram = command.second;
+        std::cout << std::left << std::setw(16) << command.first << std::right << std::setw(12)
+                  << histogram.getCount() << std::setw(12) << micros(histogram.percentile(50))
+                  << std::setw(12) << micros(histogram.percentile(90)) << std::setw(12)
+                  << micros(histogram.percentile(99)) << std::setw(12)
+                  << micros(histogram.getMax()) << "\n";
+    }
+}
+
+int run(const Options& options) {
+    const transcript_type transcript =
+        options.transcript.empty() ? transcript_type() : readTranscript(options.transcript);
+
+    std::vector<latencies_type> latencies(options.connections);
+    std::vector<std::exception_ptr> errors(options.connections);
+    std::vector<std::thread> connections;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < options.connections; ++i) {
+        connections.emplace_back([&, i] {
+            try {
+                connectAndLoad(options, transcript, latencies[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (std::thread& connection : connections) {
+        connection.join();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    latencies_type merged;
+    for (const latencies_type& connectionLatencies : latencies) {
+        for (const latencies_type::value_type& command : connectionLatencies) {
+            merged[command.first].add(command.second);
+        }
+    }
+    report(merged, elapsed.count(), options.connections);
+    return 0;
+}
+
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage(std::cerr, argv[0]);
+        return 2;
+    }
+
+    try {
+        return run(options);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}